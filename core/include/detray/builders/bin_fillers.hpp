@@ -13,9 +13,13 @@
 #include "detray/utils/grid/detail/axis.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 #include "detray/utils/grid/populators.hpp"
+#include "detray/utils/grid/sorted_bins.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <cassert>
+#include <numeric>
+#include <thread>
 #include <vector>
 
 namespace detray {
@@ -52,8 +56,7 @@ struct fill_by_bin {
         -> void {
 
         for (const bin_data_type<grid_t> &bd : bins) {
-            grid.template populate<attach<>>(bd.local_bin_idx,
-                                             bd.single_element);
+            detail::attach_checked(grid, bd.local_bin_idx, bd.single_element);
         }
     }
 };
@@ -89,12 +92,126 @@ struct fill_by_pos {
                 const auto loc_pos = grid.project(vol.transform(), t, t);
 
                 // Populate
-                grid.template populate<attach<>>(loc_pos, sf);
+                detail::attach_checked(grid, grid.axes().bins(loc_pos), sf);
             }
         }
     }
 };
 
+/// Fill a surface grid using the surface translation, with exactly sized bins.
+///
+/// First finds the bins of all surfaces, which is split among several
+/// threads for large volumes, and counts the entries per bin. For grids with
+/// dynamic bin capacities, the bin storage is then sized exactly, so that
+/// neither the bin capacities have to be known in advance, nor does the
+/// storage have to be reallocated during the filling.
+///
+/// Optionally, the entries of every bin are sorted along a coordinate of the
+/// surface position in the volume frame (@see bin_sort_key ), so that the
+/// grid search of the navigator can stop early within a bin.
+///
+/// @param grid the grid that should be filled
+/// @param det the detector from which to get the surface placements
+/// @param vol the volume the grid belongs to
+/// @param ctx the geometry context
+struct fill_by_pos_counted {
+
+    /// Number of threads for the bin search (0: hardware concurrency)
+    std::size_t n_threads{1u};
+    /// Minimal number of surfaces that justifies an additional thread
+    std::size_t min_chunk_size{1024u};
+    /// Sort the entries of every bin in ascending order of this key
+    bin_sort_key sort_by{bin_sort_key::e_none};
+
+    template <concepts::surface_grid grid_t, typename volume_t,
+              typename surface_container_t, typename mask_container,
+              typename transform_container, typename context_t,
+              typename... Args>
+    DETRAY_HOST auto operator()(grid_t &grid, const volume_t &vol,
+                                const surface_container_t &surfaces,
+                                const transform_container &transforms,
+                                const mask_container & /*masks*/,
+                                const context_t ctx, Args &&...) const -> void {
+
+        using value_t = typename grid_t::value_type;
+
+        // No portals in grids allowed
+        std::vector<value_t> grid_sfs{};
+        for (const auto &sf : surfaces) {
+            if (sf.volume() == vol.index() && sf.is_sensitive()) {
+                grid_sfs.push_back(sf);
+            }
+        }
+
+        // Find the global bin of every surface
+        std::vector<dindex> gbins(grid_sfs.size());
+        auto find_bins = [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto &sf_trf =
+                    transforms.at(grid_sfs[i].transform(), ctx);
+                const auto &t = sf_trf.translation();
+
+                // transform to axis coordinate system
+                const auto loc_pos = grid.project(vol.transform(), t, t);
+
+                gbins[i] = grid.serialize(grid.axes().bins(loc_pos));
+            }
+        };
+
+        std::size_t n_workers{n_threads};
+        if (n_workers == 0u) {
+            n_workers = std::max(1u, std::thread::hardware_concurrency());
+        }
+        n_workers = std::clamp(
+            grid_sfs.size() / std::max(min_chunk_size, std::size_t{1u}),
+            std::size_t{1u}, n_workers);
+
+        // The calling thread searches as well
+        std::vector<std::thread> workers{};
+        for (std::size_t w = 1u; w < n_workers; ++w) {
+            workers.emplace_back(find_bins, w * gbins.size() / n_workers,
+                                 (w + 1u) * gbins.size() / n_workers);
+        }
+        find_bins(0u, gbins.size() / n_workers);
+        for (std::thread &w : workers) {
+            w.join();
+        }
+
+        // Count the entries per bin and set the exact bin capacities
+        if constexpr (concepts::dynamic_bin<typename grid_t::bin_type>) {
+            std::vector<dindex> capacities(grid.nbins(), 0u);
+            for (const dindex gbin : gbins) {
+                ++capacities[gbin];
+            }
+            grid.bins().set_capacities(capacities);
+        }
+
+        // Filling order: Surfaces with a smaller key are attached first
+        std::vector<std::size_t> order(grid_sfs.size());
+        std::iota(order.begin(), order.end(), 0u);
+
+        if (sort_by != bin_sort_key::e_none) {
+            std::vector<dscalar<typename grid_t::algebra_type>> keys{};
+            keys.reserve(grid_sfs.size());
+            for (const value_t &sf : grid_sfs) {
+                const auto &sf_trf = transforms.at(sf.transform(), ctx);
+                const auto &t = sf_trf.translation();
+                keys.push_back(detail::bin_sort_value(
+                    sort_by, vol.transform().point_to_local(t)));
+            }
+            std::ranges::stable_sort(
+                order, [&keys](const std::size_t i, const std::size_t j) {
+                    return keys[i] < keys[j];
+                });
+        }
+
+        // Populate
+        for (const std::size_t i : order) {
+            detail::attach_checked(grid, gbins[i], grid_sfs[i]);
+        }
+    }
+};
+
 /// Fill a grid surface finder by bin association.
 ///
 /// @param grid the grid that should be filled
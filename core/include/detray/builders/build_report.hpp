@@ -0,0 +1,142 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/utils/memory_report.hpp"
+
+// System include(s)
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Time and memory spent on building a detector
+///
+/// Filled by @c detector_builder::build if requested. If the builders are
+/// timed (@see detector_builder::time_builders ), every volume builder and
+/// decorator in the chain of a volume is timed separately, i.e. the time of a
+/// decorator does not contain the time of the builders it wraps.
+struct build_report {
+
+    using duration_type = std::chrono::duration<double, std::milli>;
+
+    /// Time spent in a single builder of a volume
+    struct builder_record {
+        dindex volume{dindex_invalid};
+        std::string builder{};
+        duration_type time{0.};
+    };
+
+    /// Builders in the order of the volumes and from the innermost builder
+    std::vector<builder_record> builders{};
+    /// Memory held by the detector containers after the build
+    memory_report memory{};
+    /// Time to set the volume finder
+    duration_type volume_finder_time{0.};
+    /// Time for the whole build
+    duration_type total_time{0.};
+
+    /// @returns the total time spent in every type of builder
+    DETRAY_HOST
+    std::map<std::string, duration_type> time_per_builder() const {
+        std::map<std::string, duration_type> times{};
+        for (const builder_record& rec : builders) {
+            times[rec.builder] += rec.time;
+        }
+        return times;
+    }
+
+    /// @returns the total memory held by the detector containers
+    DETRAY_HOST
+    std::size_t n_bytes() const { return memory.n_bytes(); }
+
+    /// Print the report
+    DETRAY_HOST
+    friend std::ostream& operator<<(std::ostream& out,
+                                    const build_report& report) {
+
+        out << "\nDetector build report\n"
+            << "----------------------------\n"
+            << "  Total time [ms]:      : " << report.total_time.count()
+            << "\n"
+            << "  Volume finder [ms]:   : "
+            << report.volume_finder_time.count() << "\n"
+            << "  Builders [ms]:\n";
+        for (const auto& [name, time] : report.time_per_builder()) {
+            out << "    -> " << std::setw(40) << std::left << name << " "
+                << time.count() << "\n";
+        }
+
+        out << "  Volumes [ms]:\n";
+        for (const builder_record& rec : report.builders) {
+            out << "    -> " << std::setw(6) << std::right << rec.volume << " "
+                << std::setw(40) << std::left << rec.builder << " "
+                << rec.time.count() << "\n";
+        }
+
+        out << report.memory;
+
+        return out;
+    }
+};
+
+namespace detail {
+
+/// @brief Measures the time spent in the build of the volume builder it wraps.
+template <typename detector_t>
+class timed_volume_builder final : public volume_decorator<detector_t> {
+
+    using clock_t = std::chrono::steady_clock;
+
+    public:
+    /// Wrap the builder @param vol_builder
+    DETRAY_HOST
+    explicit timed_volume_builder(
+        std::unique_ptr<volume_builder_interface<detector_t>> vol_builder)
+        : volume_decorator<detector_t>(std::move(vol_builder)) {}
+
+    /// Build the volume and measure the time it took
+    DETRAY_HOST
+    auto build(detector_t& det, typename detector_t::geometry_context ctx = {})
+        -> typename detector_t::volume_type* override {
+
+        const auto start{clock_t::now()};
+        auto* vol = volume_decorator<detector_t>::build(det, ctx);
+        m_time = clock_t::now() - start;
+
+        return vol;
+    }
+
+    /// @returns the time spent in the last build, including wrapped builders
+    DETRAY_HOST
+    build_report::duration_type time() const { return m_time; }
+
+    /// @returns the builder that is timed
+    DETRAY_HOST
+    volume_builder_interface<detector_t>* builder() {
+        return this->get_builder();
+    }
+
+    private:
+    build_report::duration_type m_time{0.};
+};
+
+}  // namespace detail
+
+}  // namespace detray
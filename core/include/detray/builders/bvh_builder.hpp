@@ -0,0 +1,142 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/volume_builder.hpp"
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/utils/bounding_volume.hpp"
+
+// System include(s)
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace detray {
+
+/// @brief Build a bounding volume hierarchy over the surfaces of a volume.
+///
+/// Decorator class to a volume builder that adds a BVH as the volumes
+/// geometry accelerator structure. The bounding boxes are built around the
+/// surfaces in the nominal geometry context.
+template <typename detector_t, typename bvh_collection_t>
+class bvh_builder : public volume_decorator<detector_t> {
+
+    using link_id_t = typename detector_t::volume_type::object_id;
+    using box_t = typename bvh_collection_t::box_type;
+
+    /// Build the global bounding box around every surface
+    struct bounding_box_creator {
+
+        template <typename mask_group_t, typename index_t,
+                  typename transform3_t, typename scalar_t>
+        DETRAY_HOST inline void operator()(const mask_group_t &mask_group,
+                                           const index_t &index,
+                                           const scalar_t envelope,
+                                           const transform3_t &trf,
+                                           std::vector<box_t> &boxes) const {
+            // Local minimum bounding box
+            box_t box{mask_group.at(index), boxes.size(), envelope};
+            // Bounding box in global coordinates (might no longer be minimum)
+            boxes.push_back(box.transform(trf));
+        }
+    };
+
+    public:
+    using detector_type = detector_t;
+    using algebra_type = typename detector_t::algebra_type;
+    using value_type = typename detector_type::surface_type;
+    using scalar_type = dscalar<algebra_type>;
+
+    /// Decorate a volume with a BVH
+    DETRAY_HOST
+    explicit bvh_builder(
+        std::unique_ptr<volume_builder_interface<detector_t>> vol_builder)
+        : volume_decorator<detector_t>(std::move(vol_builder)) {
+        // The BVH builder provides an acceleration structure to the
+        // volume, so don't add sensitive surfaces to the brute force method
+        if (this->get_builder()) {
+            this->has_accel(true);
+        }
+    }
+
+    /// Should the passive surfaces be added to the BVH ?
+    void set_add_passives(bool is_add_passive = true) {
+        m_add_passives = is_add_passive;
+    }
+
+    /// Set the surface category this BVH should contain (type id in the
+    /// accelrator link in the volume)
+    void set_type(std::size_t sf_id) {
+        set_type(static_cast<link_id_t>(sf_id));
+    }
+
+    /// Set the surface category this BVH should contain (type id in the
+    /// accelrator link in the volume)
+    void set_type(link_id_t sf_id) {
+        // Exclude zero, it is reserved for the brute force method
+        assert(static_cast<int>(sf_id) > 0);
+        // Make sure the id fits in the volume accelerator link
+        assert(sf_id < link_id_t::e_size);
+
+        m_id = sf_id;
+    }
+
+    /// Set the maximal number of surfaces per leaf node
+    void set_max_leaf_size(dindex n) { m_max_leaf_size = n; }
+
+    /// Set the envelope around the surface bounding boxes
+    void set_envelope(scalar_type env) { m_envelope = env; }
+
+    /// Add the volume and the BVH to the detector @param det
+    DETRAY_HOST
+    auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
+        -> typename detector_t::volume_type * override {
+
+        // Add the surfaces (portals and/or passives) that are owned by the vol
+        typename detector_t::volume_type *vol_ptr =
+            volume_decorator<detector_t>::build(det, ctx);
+
+        // Find the surfaces that should be placed in the tree
+        const auto vol = tracking_volume{det, vol_ptr->index()};
+
+        std::vector<value_type> surfaces{};
+        std::vector<box_t> boxes{};
+        for (auto &sf_desc : vol.surfaces()) {
+
+            if (sf_desc.is_sensitive() ||
+                (m_add_passives && sf_desc.is_passive())) {
+                surfaces.push_back(sf_desc);
+                det.mask_store().template visit<bounding_box_creator>(
+                    sf_desc.mask(), m_envelope,
+                    det.transform_store().at(sf_desc.transform(), ctx),
+                    boxes);
+            }
+        }
+
+        // Add the BVH to the detector and link it to its volume
+        constexpr auto bid{detector_t::accel::template get_id<
+            typename bvh_collection_t::value_type>()};
+        auto &bvh_coll = det._accelerators.template get<bid>();
+        bvh_coll.push_back(surfaces, boxes, m_max_leaf_size);
+        vol_ptr->set_link(m_id, bid, bvh_coll.size() - 1u);
+
+        return vol_ptr;
+    }
+
+    private:
+    link_id_t m_id{link_id_t::e_sensitive};
+    dindex m_max_leaf_size{4u};
+    scalar_type m_envelope{0.1f * unit<scalar_type>::mm};
+    bool m_add_passives{false};
+};
+
+}  // namespace detray
@@ -0,0 +1,184 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detail/accelerator_entries.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/materials/detail/concepts.hpp"
+#include "detray/utils/detector_hash.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Removes duplicate masks and homogeneous material from a detector.
+///
+/// The builders add one mask and one material slab/rod per surface, even if
+/// many surfaces share the same module type and material. This pass hashes
+/// the entries of every mask and homogeneous surface material collection
+/// (@see detail::detector_hasher ), keeps the first of every set of equal
+/// entries and relinks the surfaces, including the copies of the surface
+/// descriptors in the acceleration structures, to the shared entries.
+///
+/// @note Since the mask contains the volume link, portals that lead into
+/// different volumes do not share a mask. After the pass, a mask or material
+/// entry can belong to more than one surface, so it must not be modified
+/// per surface anymore.
+/// @note Material maps and volume material are not deduplicated.
+template <typename detector_t>
+class data_deduplicator {
+
+    using surface_type = typename detector_t::surface_type;
+    using mask_link_t = typename surface_type::mask_link;
+    using material_link_t = typename surface_type::material_link;
+
+    public:
+    /// Deduplicate the masks and surface material of @param det
+    ///
+    /// @returns the number of entries that were removed
+    DETRAY_HOST std::size_t operator()(detector_t &det) const {
+
+        std::size_t n_removed{0u};
+
+        // Only single links can be rewritten
+        if constexpr (is_single_link<mask_link_t>()) {
+            using mask_ids = typename detector_t::masks;
+
+            auto get_mask = [](const auto &sf) { return sf.mask(); };
+            auto set_mask = [](auto &sf, const mask_link_t &link) {
+                sf.set_mask(link);
+            };
+
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((n_removed += deduplicate<mask_ids::to_id(I)>(
+                      det._masks.template get<mask_ids::to_id(I)>(), det,
+                      get_mask, set_mask)),
+                 ...);
+            }
+            (std::make_index_sequence<
+                detector_t::mask_container::n_collections()>{});
+        }
+
+        if constexpr (is_single_link<material_link_t>()) {
+            using material_ids = typename detector_t::materials;
+
+            auto get_material = [](const auto &sf) { return sf.material(); };
+            auto set_material = [](auto &sf, const material_link_t &link) {
+                sf.material() = link;
+            };
+
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((n_removed += deduplicate<material_ids::to_id(I)>(
+                      det._materials.template get<material_ids::to_id(I)>(),
+                      det, get_material, set_material)),
+                 ...);
+            }
+            (std::make_index_sequence<
+                detector_t::material_container::n_collections()>{});
+        }
+
+        // The acceleration structures hold copies of the surface descriptors
+        if (n_removed > 0u) {
+            detail::refresh_accelerator_entries(det, det._accelerators,
+                                                std::vector<dindex>{});
+        }
+
+        return n_removed;
+    }
+
+    private:
+    /// @returns true if the link type @tparam link_t points to a single entry
+    template <typename link_t>
+    DETRAY_HOST static consteval bool is_single_link() {
+        return requires(link_t link) { link.set_index(dindex{}); } &&
+               std::is_integral_v<typename link_t::index_type>;
+    }
+
+    /// Remove the duplicate entries from the collection @param coll with the
+    /// type id @tparam id and relink the surfaces of @param det
+    ///
+    /// @param get_link returns the link of a surface into the collection
+    /// @param set_link sets the link of a surface into the collection
+    ///
+    /// @returns the number of entries that were removed
+    template <auto id, typename collection_t, typename get_link_t,
+              typename set_link_t>
+    DETRAY_HOST static std::size_t deduplicate(collection_t &coll,
+                                               detector_t &det,
+                                               const get_link_t &get_link,
+                                               const set_link_t &set_link) {
+
+        using value_t = typename collection_t::value_type;
+
+        // Only masks and homogeneous surface material
+        if constexpr (concepts::material_map<value_t> ||
+                      concepts::material_params<value_t>) {
+            return 0u;
+        } else {
+            if (coll.empty()) {
+                return 0u;
+            }
+
+            // Map the original index of every entry to its shared entry
+            std::vector<dindex> new_index(coll.size());
+            // Indices of the unique entries, sorted by their hash
+            std::unordered_map<std::uint64_t, std::vector<dindex>> buckets;
+
+            // Move the unique entries to the front, keeping their order
+            dindex n_unique{0u};
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                detail::detector_hasher hasher{};
+                hasher.add(coll[i]);
+
+                auto &bucket = buckets[hasher.value()];
+                const auto it = std::ranges::find_if(
+                    bucket, [&coll, i](const dindex j) {
+                        return coll[j] == coll[i];
+                    });
+
+                if (it != bucket.end()) {
+                    new_index[i] = *it;
+                    continue;
+                }
+                if (n_unique != i) {
+                    coll[n_unique] = coll[i];
+                }
+                bucket.push_back(n_unique);
+                new_index[i] = n_unique++;
+            }
+
+            const std::size_t n_removed{coll.size() - n_unique};
+            if (n_removed == 0u) {
+                return 0u;
+            }
+            coll.erase(coll.begin() + n_unique, coll.end());
+
+            for (auto &sf : det._surfaces) {
+                auto link = get_link(sf);
+                if (link.id() != id || link.index() >= new_index.size()) {
+                    continue;
+                }
+                link.set_index(new_index[link.index()]);
+                set_link(sf, link);
+            }
+
+            return n_removed;
+        }
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,82 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <type_traits>
+#include <utility>
+
+namespace detray::detail {
+
+/// Apply @param update to all entries of the acceleration data structure
+/// collection @param coll
+template <typename collection_t, typename functor_t>
+DETRAY_HOST inline void update_accelerator_entries(collection_t &coll,
+                                                   const functor_t &update) {
+    if constexpr (requires { coll.bin_storage(); }) {
+        auto &bins = coll.bin_storage();
+        if constexpr (requires { bins.entries; }) {
+            // Dynamic bin capacities: All entries are stored together
+            for (auto &entry : bins.entries) {
+                update(entry);
+            }
+        } else {
+            for (auto &bin : bins) {
+                for (auto &entry : bin) {
+                    update(entry);
+                }
+            }
+        }
+    } else if constexpr (requires { coll.all(); }) {
+        for (auto &entry : coll.all()) {
+            update(entry);
+        }
+    }
+}
+
+/// Replace every surface descriptor in the acceleration data structures of
+/// the container @param accels (of a detector of type @tparam detector_t ) by
+/// the current version of the surface in the detector @param det
+///
+/// @param new_index maps the surface index in the bin entry to the index of
+///                  the surface in the detector (identity if empty)
+template <typename detector_t, typename accel_container_t,
+          typename index_map_t>
+DETRAY_HOST inline void refresh_accelerator_entries(
+    const detector_t &det, accel_container_t &accels,
+    const index_map_t &new_index) {
+
+    using accel_ids = typename detector_t::accel;
+    using surface_t = typename detector_t::surface_type;
+
+    const auto n_surfaces{det.surfaces().size()};
+
+    auto update = [&det, &new_index, n_surfaces](auto &sf_desc) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(sf_desc)>,
+                                     surface_t>) {
+            // Skip empty bin entries
+            if (sf_desc.index() < n_surfaces) {
+                sf_desc = det.surface(new_index.empty()
+                                          ? sf_desc.index()
+                                          : new_index[sf_desc.index()]);
+            }
+        }
+    };
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (update_accelerator_entries(
+             accels.template get<accel_ids::to_id(I)>(), update),
+         ...);
+    }
+    (std::make_index_sequence<accel_container_t::n_collections()>{});
+}
+
+}  // namespace detray::detail
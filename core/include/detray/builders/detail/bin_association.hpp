@@ -11,6 +11,7 @@
 // Project include(s)
 #include "detray/builders/detail/associator.hpp"
 #include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/coordinates/concentric_cylindrical2D.hpp"
 #include "detray/geometry/coordinates/cylindrical2D.hpp"
@@ -21,10 +22,31 @@
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace detray::detail {
 
+/// Attach the @param value to the bin @param bin_idx of the @param grid
+///
+/// @throws std::out_of_range if the bin cannot hold the value, e.g. if the
+/// indices in a @c bins::bitset would span more than its capacity
+template <typename grid_t, typename bin_index_t, typename value_t>
+DETRAY_HOST inline void attach_checked(grid_t &grid, const bin_index_t &bin_idx,
+                                       const value_t &value) {
+    if constexpr (requires { grid.bin(bin_idx).fits(value); }) {
+        const auto &bin = grid.bin(bin_idx);
+        if (!bin.fits(value)) {
+            throw std::out_of_range(
+                "Grid bin cannot hold the new entry: The entries would span "
+                "more than the bin capacity of " +
+                std::to_string(bin.capacity()) + " indices");
+        }
+    }
+    grid.template populate<attach<>>(bin_idx, value);
+}
+
 /// Run the bin association of surfaces (via their contour) to a given 2D grid.
 ///
 /// @param context is the context to win which the association is done
@@ -111,8 +133,11 @@ static inline void bin_association(const context_t & /*context*/,
                             // The association has worked
                             if (cgs_assoc(bin_contour, surface_contour) ||
                                 edges_assoc(bin_contour, surface_contour)) {
-                                grid.template populate<attach<>>({bin_0, bin_1},
-                                                                 sf);
+                                attach_checked(
+                                    grid,
+                                    typename grid_t::loc_bin_index{bin_0,
+                                                                   bin_1},
+                                    sf);
                                 break;
                             }
                         }
@@ -243,7 +268,7 @@ static inline void bin_association(const context_t & /*context*/,
                             if (associated) {
                                 typename grid_t::loc_bin_index mbin{bin_0,
                                                                     bin_1};
-                                grid.template populate<attach<>>(mbin, sf);
+                                attach_checked(grid, mbin, sf);
                                 break;
                             }
                         }
@@ -8,19 +8,28 @@
 #pragma once
 
 // Project include(s).
+#include "detray/builders/build_report.hpp"
+#include "detray/builders/data_deduplicator.hpp"
 #include "detray/builders/grid_factory.hpp"
+#include "detray/builders/layout_optimizer.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/builders/volume_builder_interface.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/definitions/geometry.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/memory_report.hpp"
+#include "detray/utils/type_list.hpp"
 #include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace detray {
@@ -47,11 +56,15 @@ class detector_builder {
     DETRAY_HOST auto new_volume(const volume_id id, Args&&... args)
         -> volume_builder_interface<detector_type>* {
 
-        m_volumes.push_back(std::make_unique<volume_builder_t<detector_type>>(
+        auto vol_builder{std::make_unique<volume_builder_t<detector_type>>(
             id, static_cast<dindex>(m_volumes.size()),
-            std::forward<Args>(args)...));
+            std::forward<Args>(args)...)};
+        auto* vol_builder_ptr{vol_builder.get()};
 
-        return m_volumes.back().get();
+        set_builder<volume_builder_t<detector_type>>(m_volumes.size(),
+                                                     std::move(vol_builder));
+
+        return vol_builder_ptr;
     }
 
     /// @returns the number of volumes currently registered in the builder
@@ -71,11 +84,13 @@ class detector_builder {
     DETRAY_HOST auto decorate(dindex volume_idx) -> builder_t* {
         assert(has_volume(volume_idx));
 
-        m_volumes[volume_idx] =
-            std::make_unique<builder_t>(std::move(m_volumes[volume_idx]));
+        auto builder{
+            std::make_unique<builder_t>(std::move(m_volumes[volume_idx]))};
+        auto* builder_ptr{builder.get()};
+
+        set_builder<builder_t>(volume_idx, std::move(builder));
 
-        // Always works, we set it as this type in the line above
-        return dynamic_cast<builder_t*>(m_volumes[volume_idx].get());
+        return builder_ptr;
     }
 
     /// Decorate a volume builder @param v_builder with more functionality
@@ -92,23 +107,62 @@ class detector_builder {
     DETRAY_HOST
     auto operator[](dindex volume_idx)
         -> volume_builder_interface<detector_type>* {
-        return m_volumes[volume_idx].get();
+        auto* vol_builder{m_volumes[volume_idx].get()};
+
+        // Skip the timer around the outermost builder
+        if (auto* timer{dynamic_cast<timer_type*>(vol_builder)}) {
+            return timer->builder();
+        }
+        return vol_builder;
     }
 
     /// Assembles the final detector from the volumes builders and allocates
     /// the detector containers with the memory resource @param resource
+    ///
+    /// @param report if given, is filled with the time spent in the build and
+    ///               the memory held by the detector containers, as well as
+    ///               the time spent in every builder, if they are timed
     DETRAY_HOST
-    auto build(vecmem::memory_resource& resource) -> detector_type {
+    auto build(vecmem::memory_resource& resource,
+               build_report* report = nullptr) -> detector_type {
+
+        using clock_t = std::chrono::steady_clock;
+
+        const auto start{clock_t::now()};
 
         detector_type det{resource};
 
+        // Allocate the detector containers once for all volumes, instead of
+        // growing them volume by volume
+        reserve(det);
+
         for (auto& vol_builder : m_volumes) {
             vol_builder->build(det);
         }
 
+        if (m_optimize_layout) {
+            layout_optimizer<detector_type>{}(det);
+        }
+
+        if (m_deduplicate_data) {
+            data_deduplicator<detector_type>{}(det);
+        }
+
+        if (m_build_source_index) {
+            det.build_source_index();
+        }
+
+        const auto vol_finder_start{clock_t::now()};
         det.set_volume_finder(std::move(m_vol_finder));
 
-        // TODO: Add sorting, data deduplication etc. here later...
+        if (report != nullptr) {
+            const auto end{clock_t::now()};
+            report->total_time = end - start;
+            report->volume_finder_time = end - vol_finder_start;
+
+            fill_report(*report);
+            report->memory = get_memory_report(det);
+        }
 
         return det;
     }
@@ -147,17 +201,159 @@ class detector_builder {
         }
     }
 
+    /// Time every builder and decorator that is added from now on, so that
+    /// the build report holds the time per builder - off by default
+    DETRAY_HOST void time_builders(const bool do_time) {
+        m_time_builders = do_time;
+    }
+
+    /// Sort the surfaces by source link during the build, so that they can
+    /// be found by binary search (@see surface_lookup ) - off by default
+    DETRAY_HOST void build_source_index(const bool do_build) {
+        m_build_source_index = do_build;
+    }
+
+    /// Reorder the surfaces, transforms and masks of every volume after the
+    /// build, so that surfaces which share an acceleration structure bin are
+    /// contiguous in memory (@see layout_optimizer ) - off by default
+    DETRAY_HOST void optimize_layout(const bool do_optimize) {
+        m_optimize_layout = do_optimize;
+    }
+
+    /// Share identical masks and surface material slabs/rods between the
+    /// surfaces after the build (@see data_deduplicator ) - off by default
+    DETRAY_HOST void deduplicate_data(const bool do_deduplicate) {
+        m_deduplicate_data = do_deduplicate;
+    }
+
+    /// Only add the material maps of the volumes @param vol_indices that are
+    /// read from file (empty: all volumes) - all by default
+    DETRAY_HOST void material_volumes(std::vector<dindex> vol_indices) {
+        m_material_volumes = std::move(vol_indices);
+    }
+
+    /// @returns true if the material maps of the volume @param volume_idx
+    /// should be added from file
+    DETRAY_HOST bool is_material_volume(const dindex volume_idx) const {
+        return m_material_volumes.empty() ||
+               std::ranges::find(m_material_volumes, volume_idx) !=
+                   m_material_volumes.end();
+    }
+
     /// @returns access to the volume finder
     DETRAY_HOST typename detector_type::volume_finder& volume_finder() {
         return m_vol_finder;
     }
 
     private:
+    using timer_type = detail::timed_volume_builder<detector_type>;
+
+    /// Set the builder @param builder of type @tparam builder_t as the
+    /// outermost builder of the volume @param volume_idx. If the builders are
+    /// timed, it is wrapped in a timer first
+    template <class builder_t>
+    DETRAY_HOST void set_builder(
+        const std::size_t volume_idx,
+        std::unique_ptr<volume_builder_interface<detector_type>> builder) {
+
+        if (m_time_builders) {
+            auto timer{std::make_unique<timer_type>(std::move(builder))};
+            if (m_timers.size() <= volume_idx) {
+                m_timers.resize(volume_idx + 1u);
+            }
+            m_timers[volume_idx].emplace_back(types::get_name<builder_t>(),
+                                              timer.get());
+            builder = std::move(timer);
+        }
+
+        if (volume_idx == m_volumes.size()) {
+            m_volumes.push_back(std::move(builder));
+        } else {
+            m_volumes[volume_idx] = std::move(builder);
+        }
+    }
+
+    /// Reserve the memory in the containers of @param det for the data that
+    /// the volume builders and their decorators add, so that it is moved into
+    /// the detector with a single allocation per container
+    DETRAY_HOST void reserve(detector_type& det) const {
+
+        detail::build_sizes<detector_type> sizes{};
+        for (const auto& vol_builder : m_volumes) {
+            vol_builder->count_data(sizes);
+        }
+
+        det._volumes.reserve(m_volumes.size());
+        det._surfaces.reserve(sizes.n_surfaces);
+        det._transforms.reserve(sizes.n_transforms, {});
+
+        reserve_store(det._masks, sizes.n_masks);
+        reserve_store(det._materials, sizes.n_materials,
+                      sizes.n_material_entries);
+        reserve_store(det._accelerators, sizes.n_accel,
+                      sizes.n_accel_entries);
+    }
+
+    /// Reserve @param n elements in every collection of @param store and,
+    /// where the collection supports it, @param n_entries entries in their
+    /// shared storage (e.g. surfaces in the brute force accelerator)
+    template <typename store_t, std::size_t N>
+    DETRAY_HOST static void reserve_store(
+        store_t& store, const darray<std::size_t, N>& n,
+        const darray<std::size_t, N>& n_entries = {}) {
+        using ids = typename store_t::value_types;
+
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (reserve_coll(store.template get<ids::to_id(I)>(), n[I],
+                          n_entries[I]),
+             ...);
+        }
+        (std::make_index_sequence<N>{});
+    }
+
+    /// Reserve memory in the (empty) collection @param coll
+    template <typename collection_t>
+    DETRAY_HOST static void reserve_coll(collection_t& coll,
+                                         const std::size_t n,
+                                         const std::size_t n_entries) {
+        if constexpr (requires { coll.reserve(n, n_entries); }) {
+            coll.reserve(n, n_entries);
+        } else if constexpr (requires { coll.reserve(n); }) {
+            coll.reserve(n);
+        }
+    }
+
+    /// Add the time spent in the builders to @param report
+    DETRAY_HOST void fill_report(build_report& report) const {
+        for (std::size_t i = 0u; i < m_timers.size(); ++i) {
+            // The timers are sorted from the innermost builder outwards
+            build_report::duration_type inner{0.};
+            for (const auto& [name, timer] : m_timers[i]) {
+                report.builders.push_back(
+                    {static_cast<dindex>(i), name, timer->time() - inner});
+                inner = timer->time();
+            }
+        }
+    }
+
     /// Data structure that holds a volume builder for every detector volume
     volume_data_t<std::unique_ptr<volume_builder_interface<detector_type>>>
         m_volumes{};
+    /// Timers for every builder in the decorator chain of a volume
+    std::vector<std::vector<std::pair<std::string, const timer_type*>>>
+        m_timers{};
     /// Data structure to find volumes
     typename detector_type::volume_finder m_vol_finder{};
+    /// Time the builders for the build report
+    bool m_time_builders{false};
+    /// Build the source link index of the surfaces
+    bool m_build_source_index{false};
+    /// Optimize the memory layout of the surface data
+    bool m_optimize_layout{false};
+    /// Whether to share identical masks and material between surfaces
+    bool m_deduplicate_data{false};
+    /// Volumes for which to add the material maps from file (empty: all)
+    std::vector<dindex> m_material_volumes{};
 };
 
 }  // namespace detray
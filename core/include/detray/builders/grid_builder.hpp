@@ -132,6 +132,17 @@ class grid_builder : public volume_decorator<detector_t> {
         bin_filler(m_grid, vol, surfaces, transforms, masks, ctx, args...);
     }
 
+    /// Add the grid and its bins to the data count @param sizes
+    DETRAY_HOST
+    void count_data(detail::build_sizes<detector_t> &sizes) override {
+        volume_decorator<detector_t>::count_data(sizes);
+
+        constexpr auto gid{detector_t::accel::template get_id<grid_t>()};
+        constexpr auto idx{detector_t::accel::to_index(gid)};
+        sizes.n_accel[idx] += 1u;
+        sizes.n_accel_entries[idx] += m_grid.nbins();
+    }
+
     /// Add the volume and the grid to the detector @param det
     DETRAY_HOST
     auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
@@ -331,7 +331,7 @@ class grid_factory {
 
         return new_grid<local_frame>(
             {b_values[boundary::e_min_r], b_values[boundary::e_max_r], min_phi,
-             max_phi, -b_values[boundary::e_min_z],
+             max_phi, b_values[boundary::e_min_z],
              b_values[boundary::e_max_z]},
             {n_bins[e_r_axis], n_bins[e_phi_axis], n_bins[e_z_axis]},
             bin_capacities,
@@ -608,8 +608,7 @@ class grid_factory {
         typename owning_grid_t::bin_container_type bin_data{};
 
         // Bins with dynamic capacity and "index grids" need different treatment
-        if constexpr (std::is_same_v<bin_t, bins::dynamic_array<
-                                                typename grid_t::value_type>>) {
+        if constexpr (concepts::dynamic_bin<bin_t>) {
             // Bin and bin entries vector are separate containers
             bin_data.bins.resize(axes.nbins());
             // Set correct bin capacities, if they were provided
@@ -632,7 +631,7 @@ class grid_factory {
                 assert(total_cap > 0);
                 bin_data.entries.resize(
                     total_cap,
-                    detail::invalid_value<typename grid_t::value_type>());
+                    detail::invalid_value<typename bin_t::storage_type>());
             }
         } else {
             // Bin entries are contained in the bins directly
@@ -65,6 +65,13 @@ class homogeneous_material_builder final : public volume_decorator<detector_t> {
     }
     /// @}
 
+    /// Add the material slabs and rods to the data count @param sizes
+    DETRAY_HOST
+    void count_data(detail::build_sizes<detector_t> &sizes) override {
+        volume_decorator<detector_t>::count_data(sizes);
+        detail::add_coll_sizes(m_materials, sizes.n_materials);
+    }
+
     /// Add the volume and the material to the detector @param det
     DETRAY_HOST
     auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
@@ -45,6 +45,18 @@ class homogeneous_volume_material_builder final
     DETRAY_HOST
     void set_material(material<scalar_type> mat) { m_volume_material = mat; }
 
+    /// Add the volume material to the data count @param sizes
+    DETRAY_HOST
+    void count_data(detail::build_sizes<detector_t> &sizes) override {
+        volume_decorator<detector_t>::count_data(sizes);
+
+        if (m_volume_material != detray::vacuum<scalar_type>{}) {
+            constexpr auto idx{detector_t::materials::to_index(
+                detector_t::materials::id::e_raw_material)};
+            sizes.n_materials[idx] += 1u;
+        }
+    }
+
     /// Add the volume and the material to the detector @param det
     DETRAY_HOST
     auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
@@ -0,0 +1,268 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/portal_link_builder.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/navigation/landmark_cache.hpp"
+#include "detray/utils/bounding_volume.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Calculates the eta and phi range under which a surface is seen from a
+/// landmark, from the bounding box of the surface
+template <typename algebra_t>
+struct eta_phi_range_creator {
+
+    using scalar_t = dscalar<algebra_t>;
+    using point3_t = dpoint3D<algebra_t>;
+    using box_t = axis_aligned_bounding_volume<cuboid3D, algebra_t>;
+
+    /// The ranges are given as sinh(eta), to avoid the inverse function
+    struct eta_phi_range {
+        scalar_t sinh_eta_min;
+        scalar_t sinh_eta_max;
+        scalar_t phi_c;
+        scalar_t half_width;
+        scalar_t rho_max;
+    };
+
+    /// @param landmark the point the surface is seen from
+    /// @param max_distance the box is enlarged by this distance, which covers
+    ///                     all points within that distance of the landmark
+    ///
+    /// @returns the sinh(eta) range, the phi of the box center, the half
+    /// opening angle in phi and the furthest distance to the beamline
+    template <typename mask_group_t, typename index_t, typename transform3_t>
+    DETRAY_HOST inline eta_phi_range operator()(
+        const mask_group_t &mask_group, const index_t &index,
+        const transform3_t &trf, const point3_t &landmark,
+        const scalar_t max_distance) const {
+
+        constexpr scalar_t pi{constant<scalar_t>::pi};
+        constexpr scalar_t inf{std::numeric_limits<scalar_t>::max()};
+
+        const box_t box{box_t{mask_group.at(index), 0u,
+                              std::numeric_limits<scalar_t>::epsilon()}
+                            .transform(trf)};
+
+        // Box relative to the landmark
+        const scalar_t x0{box[0] - max_distance - landmark[0]};
+        const scalar_t y0{box[1] - max_distance - landmark[1]};
+        const scalar_t z0{box[2] - max_distance - landmark[2]};
+        const scalar_t x1{box[3] + max_distance - landmark[0]};
+        const scalar_t y1{box[4] + max_distance - landmark[1]};
+        const scalar_t z1{box[5] + max_distance - landmark[2]};
+
+        // Furthest distance to the beamline
+        const scalar_t x_max{-x0 > x1 ? -x0 : x1};
+        const scalar_t y_max{-y0 > y1 ? -y0 : y1};
+        const scalar_t rho_max{math::sqrt(x_max * x_max + y_max * y_max)};
+
+        // Box encloses the beamline: Surface covers all of phi and the
+        // direction along the beamline
+        if (x0 <= 0.f && x1 >= 0.f && y0 <= 0.f && y1 >= 0.f) {
+            return {z0 >= 0.f ? z0 / rho_max : -inf,
+                    z1 <= 0.f ? z1 / rho_max : inf, 0.f, pi, rho_max};
+        }
+
+        // Closest distance to the beamline
+        const scalar_t dx{x0 > 0.f ? x0 : (x1 < 0.f ? -x1 : 0.f)};
+        const scalar_t dy{y0 > 0.f ? y0 : (y1 < 0.f ? -y1 : 0.f)};
+        const scalar_t rho_min{math::sqrt(dx * dx + dy * dy)};
+
+        const scalar_t phi_c{
+            math::atan2(0.5f * (y0 + y1), 0.5f * (x0 + x1))};
+
+        scalar_t half_width{0.f};
+        for (const scalar_t x : {x0, x1}) {
+            for (const scalar_t y : {y0, y1}) {
+                const scalar_t d{math::fabs(phi_range_creator<algebra_t>::wrap(
+                    math::atan2(y, x) - phi_c))};
+                half_width = d > half_width ? d : half_width;
+            }
+        }
+
+        return {z0 >= 0.f ? z0 / rho_max : z0 / rho_min,
+                z1 <= 0.f ? z1 / rho_max : z1 / rho_min, phi_c, half_width,
+                rho_max};
+    }
+};
+
+}  // namespace detail
+
+/// @brief Build the landmark cache of the detector @param det
+///
+/// Lists, for every eta-phi bin of the track direction, the surfaces of the
+/// volume that contains the landmark, which can be reached by tracks that
+/// start within @param max_distance of the landmark. The selection is based
+/// on the surface bounding boxes and is therefore conservative.
+///
+/// A charged track turns by no more than the maximal bending angle before it
+/// reaches a surface. The phi range of every surface is therefore widened by
+/// that angle. The chord to a point on the helix is also shorter in the
+/// transverse plane than the arc, which stretches the sinh(eta) range of the
+/// surface by at most the ratio of arc and chord. The navigator only uses the
+/// cache for the tracks it @c applies() to.
+///
+/// @param landmark the common starting point of the tracks (e.g. beam spot)
+/// @param n_eta_bins number of eta bins
+/// @param n_phi_bins number of phi bins
+/// @param max_eta the eta bins span [-max_eta, max_eta]
+/// @param min_pT minimal transverse momentum per charge of the tracks, which
+///               should include the energy loss in the detector
+/// @param b_field maximal strength of the solenoid magnetic field (zero, if
+///                the tracks are straight lines)
+/// @param resource memory resource for the cache
+/// @param ctx geometry context of the surface placements
+///
+/// @returns the landmark cache
+template <typename detector_t>
+DETRAY_HOST auto build_landmark_cache(
+    const detector_t &det,
+    const dpoint3D<typename detector_t::algebra_type> &landmark,
+    const dscalar<typename detector_t::algebra_type> max_distance,
+    const dindex n_eta_bins, const dindex n_phi_bins,
+    const dscalar<typename detector_t::algebra_type> max_eta,
+    const dscalar<typename detector_t::algebra_type> min_pT,
+    const dscalar<typename detector_t::algebra_type> b_field,
+    vecmem::memory_resource &resource,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using surface_t = typename detector_t::surface_type;
+    using range_creator_t = detail::eta_phi_range_creator<algebra_t>;
+
+    if (n_eta_bins == 0u || n_phi_bins == 0u) {
+        throw std::invalid_argument(
+            "Landmark cache: Number of bins must be larger than zero");
+    }
+    if (!(max_eta > 0.f) || max_distance < 0.f) {
+        throw std::invalid_argument(
+            "Landmark cache: Invalid eta range or distance to landmark");
+    }
+    if (min_pT < 0.f || b_field < 0.f) {
+        throw std::invalid_argument(
+            "Landmark cache: Invalid transverse momentum or field strength");
+    }
+
+    constexpr scalar_t pi{constant<scalar_t>::pi};
+    constexpr scalar_t inf{std::numeric_limits<scalar_t>::max()};
+    const scalar_t phi_half_width{pi / static_cast<scalar_t>(n_phi_bins)};
+    const scalar_t eta_width{2.f * max_eta / static_cast<scalar_t>(n_eta_bins)};
+
+    // Lower edge of the eta bin @param b as sinh(eta), shifted by @param tol
+    // to guard against rounding differences to the bin lookup
+    auto sinh_eta_edge = [max_eta, eta_width](const dindex b,
+                                              const scalar_t tol) {
+        return static_cast<scalar_t>(std::sinh(
+            -max_eta + static_cast<scalar_t>(b) * eta_width + tol));
+    };
+    const scalar_t eta_tol{1e-3f * eta_width};
+
+    const dindex start_vol{det.volume(landmark).index()};
+
+    // Collect the surfaces of the starting volume and their ranges
+    std::vector<surface_t> surfaces{};
+    std::vector<typename range_creator_t::eta_phi_range> ranges{};
+    for (const auto &sf_desc : det.surfaces()) {
+        if (sf_desc.volume() != start_vol) {
+            continue;
+        }
+        surfaces.push_back(sf_desc);
+        ranges.push_back(det.mask_store().template visit<range_creator_t>(
+            sf_desc.mask(), det.transform_store().at(sf_desc.transform(), ctx),
+            landmark, max_distance));
+    }
+
+    // Maximal bending angle per surface and the resulting stretch factor of
+    // the sinh(eta) range (the tracks can curl, if the angle reaches pi)
+    std::vector<scalar_t> bending{};
+    std::vector<scalar_t> stretch{};
+    for (const auto &r : ranges) {
+        const scalar_t alpha{
+            detail::max_bending_angle(min_pT, b_field, r.rho_max)};
+        bending.push_back(alpha);
+        stretch.push_back(alpha > 0.f && alpha < pi
+                              ? 0.5f * alpha / math::sin(0.5f * alpha)
+                              : 1.f);
+    }
+
+    landmark_cache<algebra_t, surface_t> cache{
+        resource, landmark, max_distance, n_eta_bins, n_phi_bins, max_eta,
+        min_pT};
+
+    std::vector<std::vector<surface_t>> bins{};
+    for (dindex vol_idx = 0u; vol_idx < det.volumes().size(); ++vol_idx) {
+        bins.clear();
+        if (vol_idx == start_vol) {
+            bins.resize(n_eta_bins * n_phi_bins);
+        }
+
+        for (dindex b = 0u; b < bins.size(); ++b) {
+            const dindex eta_b{b / n_phi_bins};
+            const dindex phi_b{b % n_phi_bins};
+
+            // The outer eta bins are open
+            const scalar_t lower{
+                eta_b == 0u ? -inf : sinh_eta_edge(eta_b, -eta_tol)};
+            const scalar_t upper{eta_b == n_eta_bins - 1u
+                                     ? inf
+                                     : sinh_eta_edge(eta_b + 1u, eta_tol)};
+            const scalar_t phi_center{
+                -pi + static_cast<scalar_t>(2u * phi_b + 1u) * phi_half_width};
+
+            for (std::size_t i = 0u; i < surfaces.size(); ++i) {
+                const auto &r = ranges[i];
+
+                // The track might curl before it reaches the surface
+                if (bending[i] >= pi) {
+                    bins[b].push_back(surfaces[i]);
+                    continue;
+                }
+
+                // The chord is steeper than the track direction
+                const scalar_t k{stretch[i]};
+                const scalar_t lower_k{lower < 0.f ? lower * k : lower};
+                const scalar_t upper_k{upper > 0.f ? upper * k : upper};
+                if (r.sinh_eta_max < lower_k || r.sinh_eta_min > upper_k) {
+                    continue;
+                }
+                const scalar_t dist{math::fabs(
+                    detail::phi_range_creator<algebra_t>::wrap(r.phi_c -
+                                                               phi_center))};
+
+                if (dist <= r.half_width + phi_half_width + bending[i]) {
+                    bins[b].push_back(surfaces[i]);
+                }
+            }
+        }
+        cache.push_back(bins);
+    }
+
+    return cache;
+}
+
+}  // namespace detray
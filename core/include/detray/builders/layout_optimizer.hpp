@@ -0,0 +1,279 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detail/accelerator_entries.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// A functor that ranks the surfaces of a volume by the first bin of an
+/// acceleration structure in which they appear
+struct surface_ranker {
+
+    template <typename accel_group_t, typename accel_index_t>
+    DETRAY_HOST inline void operator()(const accel_group_t &group,
+                                       const accel_index_t &index,
+                                       const dindex first_sf,
+                                       std::vector<dindex> &ranks,
+                                       dindex &n_ranked) const {
+
+        for (const auto &sf_desc : group[index].all()) {
+            const dindex sf_idx{sf_desc.index()};
+            // Skip empty bin entries and surfaces of other volumes
+            if (sf_idx < first_sf || sf_idx - first_sf >= ranks.size()) {
+                continue;
+            }
+            dindex &rank = ranks[sf_idx - first_sf];
+            if (detail::is_invalid_value(rank)) {
+                rank = n_ranked++;
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/// @brief Optimizes the memory layout of a detector after it was built.
+///
+/// Reorders the surfaces of every volume, together with their transforms and
+/// masks, in the order in which they first appear in the bins of the volume
+/// acceleration structures (e.g. the surface grids). Surfaces that share a
+/// bin then lie next to each other in memory, so that the navigation reads
+/// consecutive cache lines. The surface links in the accelerators are updated
+/// accordingly.
+///
+/// @note The portal, sensitive and passive surface ranges of a volume are
+/// reordered separately and surfaces that are not contained in an
+/// acceleration structure (other than the brute force method) keep their
+/// order. Transforms and masks are only moved if every surface of the volume
+/// owns exactly one of them.
+/// @note Needs to run before any geometry contexts are added to the detector
+/// and before the source index is built.
+template <typename detector_t>
+class layout_optimizer {
+
+    using surface_type = typename detector_t::surface_type;
+    using sf_link_type =
+        typename detector_t::surface_lookup_container::value_type;
+
+    public:
+    /// Reorder the surfaces of all volumes in the detector @param det
+    DETRAY_HOST void operator()(detector_t &det) const {
+
+        // The surfaces in their original order
+        const std::vector<sf_link_type> surfaces(det.surfaces().begin(),
+                                                 det.surfaces().end());
+
+        // New global index of every surface
+        std::vector<dindex> new_index(surfaces.size());
+        std::iota(new_index.begin(), new_index.end(), 0u);
+
+        bool is_reordered{false};
+        for (const auto &vol_desc : det.volumes()) {
+
+            const std::vector<dindex> order{sort_surfaces(det, vol_desc)};
+            if (std::ranges::is_sorted(order)) {
+                continue;
+            }
+            is_reordered = true;
+
+            std::vector<sf_link_type> vol_surfaces;
+            vol_surfaces.reserve(order.size());
+            for (const dindex sf_idx : order) {
+                vol_surfaces.push_back(surfaces[sf_idx]);
+            }
+
+            permute_transforms(det, vol_surfaces);
+            permute_masks(det, vol_surfaces);
+
+            const dindex first_sf{vol_desc.full_sf_range()[0]};
+            for (dindex i = 0u; i < order.size(); ++i) {
+                new_index[order[i]] = first_sf + i;
+                vol_surfaces[i].set_index(first_sf + i);
+                det._surfaces[first_sf + i] = vol_surfaces[i];
+            }
+        }
+
+        if (is_reordered) {
+            update_accelerators(det, new_index);
+        }
+    }
+
+    private:
+    /// @returns the global indices of the surfaces of the volume
+    /// @param vol_desc in their new order
+    template <typename volume_t>
+    DETRAY_HOST static std::vector<dindex> sort_surfaces(
+        const detector_t &det, const volume_t &vol_desc) {
+
+        const auto sf_range{vol_desc.full_sf_range()};
+        const dindex first_sf{sf_range[0]};
+        const dindex n_surfaces{sf_range[1] - sf_range[0]};
+
+        // Rank the surfaces by the first bin they appear in
+        std::vector<dindex> ranks(n_surfaces, detail::invalid_value<dindex>());
+        dindex n_ranked{0u};
+        const auto &accel_links = vol_desc.accel_link();
+        for (std::size_t i = 0u; i < accel_links.size(); ++i) {
+            const auto &link = accel_links[i];
+            if (link.is_invalid_id() || link.is_invalid_index() ||
+                link.id() == detector_t::accel::id::e_default) {
+                continue;
+            }
+            det.accelerator_store().template visit<detail::surface_ranker>(
+                link, first_sf, ranks, n_ranked);
+        }
+
+        std::vector<dindex> order(n_surfaces);
+        std::iota(order.begin(), order.end(), first_sf);
+
+        // Don't mix portals, sensitives and passives
+        auto by_rank = [&ranks, first_sf](const dindex i, const dindex j) {
+            return ranks[i - first_sf] < ranks[j - first_sf];
+        };
+        for (const auto &rg :
+             {vol_desc.template sf_link<surface_id::e_portal>(),
+              vol_desc.template sf_link<surface_id::e_sensitive>(),
+              vol_desc.template sf_link<surface_id::e_passive>()}) {
+            if (rg[0] >= rg[1]) {
+                continue;
+            }
+            std::stable_sort(order.begin() + (rg[0] - first_sf),
+                             order.begin() + (rg[1] - first_sf), by_rank);
+        }
+
+        return order;
+    }
+
+    /// @returns true if the @param indices are a permutation of a range of
+    /// consecutive indices, which is starting at @param first
+    DETRAY_HOST static bool is_permuted_range(std::vector<dindex> indices,
+                                              dindex &first) {
+        if (indices.empty()) {
+            return false;
+        }
+        std::ranges::sort(indices);
+        first = indices.front();
+
+        return indices.back() - indices.front() + 1u == indices.size() &&
+               std::ranges::adjacent_find(indices) == indices.end();
+    }
+
+    /// Move the transforms of the surfaces @param vol_surfaces into the order
+    /// of the surfaces
+    DETRAY_HOST static void permute_transforms(
+        detector_t &det, std::vector<sf_link_type> &vol_surfaces) {
+
+        std::vector<dindex> old_indices;
+        old_indices.reserve(vol_surfaces.size());
+        for (const auto &sf : vol_surfaces) {
+            old_indices.push_back(sf.transform());
+        }
+
+        dindex first{0u};
+        if (!is_permuted_range(old_indices, first)) {
+            return;
+        }
+
+        std::vector<typename detector_t::transform3_type> transforms;
+        transforms.reserve(old_indices.size());
+        for (const dindex trf_idx : old_indices) {
+            transforms.push_back(det._transforms.at(trf_idx));
+        }
+        for (dindex i = 0u; i < transforms.size(); ++i) {
+            det._transforms.at(first + i) = transforms[i];
+            vol_surfaces[i].set_transform(first + i);
+        }
+    }
+
+    /// Move the masks of the surfaces @param vol_surfaces into the order of
+    /// the surfaces (for every mask type separately)
+    DETRAY_HOST static void permute_masks(
+        detector_t &det, std::vector<sf_link_type> &vol_surfaces) {
+
+        using mask_link_t = typename surface_type::mask_link;
+
+        // Only single mask links can be moved
+        if constexpr (requires(mask_link_t link) {
+                          link.set_index(dindex{});
+                      } &&
+                      std::is_integral_v<typename mask_link_t::index_type>) {
+
+            using mask_ids = typename detector_t::masks;
+
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (permute_masks<mask_ids::to_id(I)>(
+                     det._masks.template get<mask_ids::to_id(I)>(),
+                     vol_surfaces),
+                 ...);
+            }
+            (std::make_index_sequence<
+                detector_t::mask_container::n_collections()>{});
+        }
+    }
+
+    /// Move the masks in the collection @param masks of type @tparam mask_id
+    /// into the order of the surfaces @param vol_surfaces
+    template <auto mask_id, typename mask_collection_t>
+    DETRAY_HOST static void permute_masks(
+        mask_collection_t &masks, std::vector<sf_link_type> &vol_surfaces) {
+
+        std::vector<std::size_t> positions;
+        std::vector<dindex> old_indices;
+        for (std::size_t i = 0u; i < vol_surfaces.size(); ++i) {
+            if (vol_surfaces[i].mask().id() == mask_id) {
+                positions.push_back(i);
+                old_indices.push_back(vol_surfaces[i].mask().index());
+            }
+        }
+
+        dindex first{0u};
+        if (!is_permuted_range(old_indices, first)) {
+            return;
+        }
+
+        std::vector<typename mask_collection_t::value_type> values;
+        values.reserve(old_indices.size());
+        for (const dindex mask_idx : old_indices) {
+            values.push_back(masks[mask_idx]);
+        }
+        for (dindex i = 0u; i < values.size(); ++i) {
+            masks[first + i] = values[i];
+
+            auto &sf = vol_surfaces[positions[i]];
+            typename surface_type::mask_link link{sf.mask()};
+            link.set_index(first + i);
+            sf.set_mask(link);
+        }
+    }
+
+    /// Replace the surfaces in all acceleration structures of @param det by
+    /// their reordered version, using the new indices @param new_index
+    DETRAY_HOST static void update_accelerators(
+        detector_t &det, const std::vector<dindex> &new_index) {
+        detail::refresh_accelerator_entries(det, det._accelerators, new_index);
+    }
+};
+
+}  // namespace detray
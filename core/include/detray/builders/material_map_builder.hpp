@@ -93,6 +93,28 @@ class material_map_builder final : public volume_decorator<detector_t> {
     }
     /// @}
 
+    /// Add the material maps and their bins to the data count @param sizes
+    DETRAY_HOST
+    void count_data(detail::build_sizes<detector_t>& sizes) override {
+        volume_decorator<detector_t>::count_data(sizes);
+
+        const auto& surfaces = this->surfaces();
+        for (const auto& [sf_idx, n_bins] : m_n_bins) {
+            if (!surface_has_map(sf_idx)) {
+                continue;
+            }
+            const auto idx{materials_t::to_index(
+                surfaces[sf_idx].material().id())};
+
+            std::size_t n{1u};
+            for (const std::size_t n_axis_bins : n_bins) {
+                n *= n_axis_bins;
+            }
+            sizes.n_materials[idx] += 1u;
+            sizes.n_material_entries[idx] += n;
+        }
+    }
+
     /// Add the volume and the material maps to the detector @param det
     DETRAY_HOST
     auto build(detector_t& det, typename detector_t::geometry_context ctx = {})
@@ -0,0 +1,337 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/portal_links.hpp"
+#include "detray/navigation/volume_graph.hpp"
+#include "detray/utils/bounding_volume.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Calculates the cone around the direction of its center, under which a
+/// surface is seen from the origin, from the bounding box of the surface
+template <typename algebra_t>
+struct cone_range_creator {
+
+    using scalar_t = dscalar<algebra_t>;
+    using vector3_t = dvector3D<algebra_t>;
+    using box_t = axis_aligned_bounding_volume<cuboid3D, algebra_t>;
+
+    struct cone_range {
+        /// Unit vector in the direction of the box center
+        vector3_t center;
+        /// Half opening angle of the cone (pi, if the cone is not convex)
+        scalar_t half_angle;
+        /// Furthest distance of the box to the beamline
+        scalar_t rho_max;
+    };
+
+    /// @returns the direction of the box center, the half opening angle of
+    /// the cone that contains the box and the furthest distance of the box to
+    /// the beamline
+    template <typename mask_group_t, typename index_t, typename transform3_t>
+    DETRAY_HOST inline cone_range operator()(const mask_group_t &mask_group,
+                                             const index_t &index,
+                                             const transform3_t &trf) const {
+
+        constexpr scalar_t pi{constant<scalar_t>::pi};
+
+        const box_t box{box_t{mask_group.at(index), 0u,
+                              std::numeric_limits<scalar_t>::epsilon()}
+                            .transform(trf)};
+
+        const scalar_t x_max{-box[0] > box[3] ? -box[0] : box[3]};
+        const scalar_t y_max{-box[1] > box[4] ? -box[1] : box[4]};
+        const scalar_t rho_max{math::sqrt(x_max * x_max + y_max * y_max)};
+
+        const vector3_t center{0.5f * (box[0] + box[3]),
+                               0.5f * (box[1] + box[4]),
+                               0.5f * (box[2] + box[5])};
+
+        // Box encloses the origin: Surface is seen in every direction
+        if (box[0] <= 0.f && box[3] >= 0.f && box[1] <= 0.f &&
+            box[4] >= 0.f && box[2] <= 0.f && box[5] >= 0.f) {
+            return {center, pi, rho_max};
+        }
+
+        // If all corners lie in a convex cone, so does the box
+        const vector3_t c_dir{vector::normalize(center)};
+        scalar_t half_angle{0.f};
+        for (const scalar_t x : {box[0], box[3]}) {
+            for (const scalar_t y : {box[1], box[4]}) {
+                for (const scalar_t z : {box[2], box[5]}) {
+                    const scalar_t a{angle(c_dir, vector3_t{x, y, z})};
+                    half_angle = a > half_angle ? a : half_angle;
+                }
+            }
+        }
+        if (half_angle >= 0.5f * pi) {
+            half_angle = pi;
+        }
+
+        return {c_dir, half_angle, rho_max};
+    }
+
+    /// @returns the angle between the unit vector @param u and the vector
+    /// @param v
+    DETRAY_HOST static scalar_t angle(const vector3_t &u, const vector3_t &v) {
+        const scalar_t cos_a{vector::dot(u, v) / vector::norm(v)};
+        return math::acos(cos_a > 1.f ? 1.f : (cos_a < -1.f ? -1.f : cos_a));
+    }
+};
+
+/// Helper to wrap global phi values
+template <typename algebra_t>
+struct phi_range_creator {
+
+    using scalar_t = dscalar<algebra_t>;
+
+    /// @returns the angle @param phi wrapped into [-pi, pi]
+    DETRAY_HOST static scalar_t wrap(scalar_t phi) {
+        constexpr scalar_t pi{constant<scalar_t>::pi};
+        while (phi > pi) {
+            phi -= 2.f * pi;
+        }
+        while (phi < -pi) {
+            phi += 2.f * pi;
+        }
+        return phi;
+    }
+};
+
+/// @returns the maximal angle by which the direction of a track with the
+/// transverse momentum per charge @param pT turns in a solenoid field of
+/// strength @param b_field, before it leaves a cylinder of radius
+/// @param rho_max around the beamline
+///
+/// Two points in the cylinder are at most 2 * rho_max apart, which bounds
+/// the chord of the transverse track circle.
+template <typename scalar_t>
+DETRAY_HOST inline scalar_t max_bending_angle(const scalar_t pT,
+                                              const scalar_t b_field,
+                                              const scalar_t rho_max) {
+    if (b_field <= 0.f) {
+        return 0.f;
+    }
+    const scalar_t r_T{pT / b_field};
+    if (!(rho_max < r_T)) {
+        return constant<scalar_t>::pi;
+    }
+    return 2.f * math::asin(rho_max / r_T);
+}
+
+}  // namespace detail
+
+/// @brief Build the portal link table of the detector @param det
+///
+/// Walks the volume graph of the detector and lists, for every portal and
+/// eta-phi bin of the crossing position, the surfaces of the neighbouring
+/// volume that a track can reach from that bin.
+///
+/// A straight track that crosses the portal at the position p in direction d
+/// stays in the cone around p that contains d. Inside the next volume, a
+/// charged track turns by no more than the maximal bending angle for the
+/// radial extent of the volume. A surface is therefore reachable only if its
+/// bounding box is seen from the origin at an angle of at most the maximal
+/// direction angle plus the bending angle from one of the bin directions.
+/// The selection is conservative, as long as the navigator only uses the
+/// table for the tracks it @c applies() to.
+///
+/// @param n_eta_bins number of eta bins of the crossing position
+/// @param n_phi_bins number of phi bins of the crossing position
+/// @param max_eta the eta bins span [-max_eta, max_eta]
+/// @param max_angle maximal angle between the track direction and the
+///                  direction of the crossing position, in [0, pi/2)
+/// @param min_pT minimal transverse momentum per charge of the tracks, which
+///               should include the energy loss in the detector
+/// @param b_field maximal strength of the solenoid magnetic field (zero, if
+///                the tracks are straight lines)
+/// @param resource memory resource for the table
+/// @param ctx geometry context of the surface placements
+///
+/// @returns the portal link table
+template <typename detector_t>
+DETRAY_HOST auto build_portal_links(
+    const detector_t &det, const dindex n_eta_bins, const dindex n_phi_bins,
+    const dscalar<typename detector_t::algebra_type> max_eta,
+    const dscalar<typename detector_t::algebra_type> max_angle,
+    const dscalar<typename detector_t::algebra_type> min_pT,
+    const dscalar<typename detector_t::algebra_type> b_field,
+    vecmem::memory_resource &resource,
+    const typename detector_t::geometry_context ctx = {}) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using vector3_t = dvector3D<algebra_t>;
+    using surface_t = typename detector_t::surface_type;
+    using graph_t = volume_graph<detector_t>;
+    using range_creator_t = detail::cone_range_creator<algebra_t>;
+
+    constexpr scalar_t pi{constant<scalar_t>::pi};
+
+    if (n_eta_bins == 0u || n_phi_bins == 0u) {
+        throw std::invalid_argument(
+            "Portal links: Number of bins must be larger than zero");
+    }
+    if (!(max_eta > 0.f) || !(max_angle >= 0.f && max_angle < 0.5f * pi) ||
+        min_pT < 0.f || b_field < 0.f) {
+        throw std::invalid_argument(
+            "Portal links: Invalid eta range, direction angle, transverse "
+            "momentum or field strength");
+    }
+
+    // Guards against rounding differences to the bin lookup
+    constexpr scalar_t tol{1e-4f};
+
+    // Collect the non-portal surfaces and their cones per volume, and the
+    // radial extent of every volume
+    std::vector<std::vector<surface_t>> vol_surfaces(det.volumes().size());
+    std::vector<std::vector<typename range_creator_t::cone_range>> vol_cones(
+        det.volumes().size());
+    std::vector<scalar_t> vol_rho_max(det.volumes().size(), 0.f);
+    for (const auto &sf_desc : det.surfaces()) {
+        const auto cone = det.mask_store().template visit<range_creator_t>(
+            sf_desc.mask(), det.transform_store().at(sf_desc.transform(), ctx));
+
+        scalar_t &rho_max = vol_rho_max[sf_desc.volume()];
+        rho_max = cone.rho_max > rho_max ? cone.rho_max : rho_max;
+
+        if (sf_desc.is_portal()) {
+            continue;
+        }
+        vol_surfaces[sf_desc.volume()].push_back(sf_desc);
+        vol_cones[sf_desc.volume()].push_back(cone);
+    }
+
+    // Find the volumes behind every portal from the volume graph
+    std::vector<std::vector<dindex>> next_volumes(det.surfaces().size());
+
+    const graph_t graph(det);
+    typename graph_t::edge_generator edges(det.mask_store());
+    for (const auto &node : graph.nodes()) {
+        for (const auto &pt_desc :
+             tracking_volume{det, node.index()}.portals()) {
+            for (const auto &edg : edges(node.index(), pt_desc.mask())) {
+                if (edg.to() < det.volumes().size() &&
+                    edg.to() != node.index()) {
+                    next_volumes[pt_desc.index()].push_back(edg.to());
+                }
+            }
+        }
+    }
+
+    // Direction of the crossing positions and cone half angle per bin
+    const scalar_t eta_width{2.f * max_eta / static_cast<scalar_t>(n_eta_bins)};
+    const scalar_t phi_width{2.f * pi / static_cast<scalar_t>(n_phi_bins)};
+    // Polar angle of the lower edge of the eta bin @param b
+    auto theta_edge = [max_eta, eta_width](const dindex b) {
+        const scalar_t eta{-max_eta + static_cast<scalar_t>(b) * eta_width};
+        return 2.f * math::atan(math::exp(-eta));
+    };
+    auto dir_of = [](const scalar_t theta, const scalar_t phi) {
+        return vector3_t{math::sin(theta) * math::cos(phi),
+                         math::sin(theta) * math::sin(phi), math::cos(theta)};
+    };
+
+    std::vector<vector3_t> bin_centers(n_eta_bins * n_phi_bins);
+    std::vector<scalar_t> bin_half_angles(n_eta_bins * n_phi_bins, pi);
+    for (dindex eta_b = 0u; eta_b < n_eta_bins; ++eta_b) {
+        // The outer eta bins are open
+        const scalar_t theta_max{eta_b == 0u ? pi : theta_edge(eta_b)};
+        const scalar_t theta_min{
+            eta_b == n_eta_bins - 1u ? 0.f : theta_edge(eta_b + 1u)};
+        const scalar_t theta_c{0.5f * (theta_min + theta_max)};
+
+        for (dindex phi_b = 0u; phi_b < n_phi_bins; ++phi_b) {
+            const scalar_t phi_min{-pi +
+                                   static_cast<scalar_t>(phi_b) * phi_width};
+            const scalar_t phi_c{phi_min + 0.5f * phi_width};
+            const dindex b{eta_b * n_phi_bins + phi_b};
+
+            bin_centers[b] = dir_of(theta_c, phi_c);
+
+            // The largest angle to the center is found at one of the corners
+            // of the bin, if the bin spans less than pi in phi
+            if (n_phi_bins < 2u) {
+                continue;
+            }
+            scalar_t half_angle{0.f};
+            for (const scalar_t theta : {theta_min, theta_max}) {
+                for (const scalar_t phi : {phi_min, phi_min + phi_width}) {
+                    const scalar_t a{range_creator_t::angle(
+                        bin_centers[b], dir_of(theta, phi))};
+                    half_angle = a > half_angle ? a : half_angle;
+                }
+            }
+            bin_half_angles[b] = half_angle;
+        }
+    }
+
+    portal_link_table<algebra_t, surface_t> table{
+        resource, n_eta_bins, n_phi_bins, max_eta,
+        max_angle, b_field > 0.f ? min_pT : 0.f};
+
+    std::vector<std::vector<surface_t>> bins{};
+    for (dindex sf_idx = 0u; sf_idx < det.surfaces().size(); ++sf_idx) {
+        bins.clear();
+        if (!next_volumes[sf_idx].empty()) {
+            bins.resize(n_eta_bins * n_phi_bins);
+        }
+
+        for (const dindex vol_idx : next_volumes[sf_idx]) {
+            // Maximal angle between the track direction and the bin
+            const scalar_t max_dev{
+                max_angle + detail::max_bending_angle(min_pT, b_field,
+                                                      vol_rho_max[vol_idx])};
+
+            for (dindex b = 0u; b < bins.size(); ++b) {
+                for (std::size_t i = 0u; i < vol_surfaces[vol_idx].size();
+                     ++i) {
+                    const auto &cone = vol_cones[vol_idx][i];
+
+                    // The tracks are not confined to a convex cone anymore,
+                    // or the surface is seen in every direction
+                    bool is_reachable{max_dev >= 0.5f * pi ||
+                                      cone.half_angle >= pi};
+                    if (!is_reachable) {
+                        const scalar_t dist{range_creator_t::angle(
+                            bin_centers[b], cone.center)};
+                        is_reachable = dist <= cone.half_angle +
+                                                   bin_half_angles[b] +
+                                                   max_dev + tol;
+                    }
+                    if (is_reachable) {
+                        bins[b].push_back(vol_surfaces[vol_idx][i]);
+                    }
+                }
+            }
+        }
+        table.push_back(bins);
+    }
+
+    return table;
+}
+
+}  // namespace detray
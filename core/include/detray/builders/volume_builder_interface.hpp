@@ -11,7 +11,10 @@
 #include "detray/geometry/tracking_volume.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <utility>
 
 namespace detray {
 
@@ -21,6 +24,44 @@ class surface_factory_interface;
 template <typename detector_t>
 class volume_decorator;
 
+namespace detail {
+
+/// @brief Amount of data that the volume builders add to the detector, used
+/// to allocate the detector containers before the build
+template <typename detector_t>
+struct build_sizes {
+    /// Number of elements in every collection of a detector store
+    template <typename store_t>
+    using coll_sizes = darray<std::size_t, store_t::n_collections()>;
+
+    std::size_t n_surfaces{0u};
+    std::size_t n_transforms{0u};
+    coll_sizes<typename detector_t::mask_container> n_masks{};
+    /// Number of material collection elements per type...
+    coll_sizes<typename detector_t::material_container> n_materials{};
+    /// ... and their number of entries (e.g. bins of material maps)
+    coll_sizes<typename detector_t::material_container> n_material_entries{};
+    /// Number of acceleration structures per type...
+    coll_sizes<typename detector_t::accelerator_container> n_accel{};
+    /// ... and their number of entries (e.g. surfaces or grid bins)
+    coll_sizes<typename detector_t::accelerator_container> n_accel_entries{};
+};
+
+/// Add the number of elements in every collection of @param store to
+/// @param sizes
+template <typename store_t, std::size_t N>
+DETRAY_HOST void add_coll_sizes(const store_t &store,
+                                darray<std::size_t, N> &sizes) {
+    using ids = typename store_t::value_types;
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((sizes[I] += store.template size<ids::to_id(I)>()), ...);
+    }
+    (std::make_index_sequence<N>{});
+}
+
+}  // namespace detail
+
 /// @brief Interface for volume builders (and volume builder decorators)
 template <typename detector_t>
 class volume_builder_interface {
@@ -85,6 +126,32 @@ class volume_builder_interface {
         std::shared_ptr<surface_factory_interface<detector_t>> sf_factory,
         typename detector_t::geometry_context ctx = {}) = 0;
 
+    /// @brief Count the data that the builder adds to the detector
+    ///
+    /// Adds the number of surfaces, transforms (including the volume
+    /// placement), masks and the default accelerator entries that the
+    /// builder holds to @param sizes . Decorators add their own data.
+    DETRAY_HOST
+    virtual void count_data(detail::build_sizes<detector_t> &sizes) {
+        constexpr auto default_acc_id{
+            detector_t::accel::to_index(detector_t::accel::id::e_default)};
+
+        const auto &sfs = surfaces();
+        sizes.n_surfaces += sfs.size();
+        sizes.n_transforms += transforms().size() + 1u;
+        detail::add_coll_sizes(masks(), sizes.n_masks);
+
+        // Either all surfaces or only portals and passives are added to the
+        // default accelerator
+        sizes.n_accel[default_acc_id] += 1u;
+        sizes.n_accel_entries[default_acc_id] +=
+            has_accel() ? static_cast<std::size_t>(std::ranges::count_if(
+                              sfs, [](const auto &sf) {
+                                  return !sf.is_sensitive();
+                              }))
+                        : sfs.size();
+    }
+
     protected:
     /// Access to builder data
     /// @{
@@ -131,6 +198,11 @@ class volume_decorator : public volume_builder_interface<detector_t> {
     DETRAY_HOST
     bool has_accel() const override { return m_builder->has_accel(); }
 
+    DETRAY_HOST
+    void count_data(detail::build_sizes<detector_t> &sizes) override {
+        m_builder->count_data(sizes);
+    }
+
     DETRAY_HOST
     auto build(detector_t &det,
                typename detector_t::geometry_context /*ctx*/ = {}) ->
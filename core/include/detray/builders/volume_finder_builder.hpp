@@ -0,0 +1,118 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/accelerators/hierarchical_volume_finder.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail {
+
+/// Grows the cylindrical extent of a volume around one of its portals.
+/// Only cylinder and ring portals contribute, all other shapes are ignored.
+struct cylindrical_extent_creator {
+
+    template <typename mask_group_t, typename index_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST inline void operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf,
+                                       darray<scalar_t, 4> &ext) const {
+        using shape_t = typename mask_group_t::value_type::shape;
+
+        const auto &m = mask_group.at(index);
+        const scalar_t z{trf.translation()[2]};
+
+        if constexpr (std::is_same_v<shape_t, concentric_cylinder2D> ||
+                      std::is_same_v<shape_t, cylinder2D>) {
+            grow(ext, m[shape_t::e_r], m[shape_t::e_r],
+                 z + m[shape_t::e_lower_z], z + m[shape_t::e_upper_z]);
+        } else if constexpr (std::is_same_v<shape_t, ring2D>) {
+            grow(ext, m[shape_t::e_inner_r], m[shape_t::e_outer_r], z, z);
+        }
+    }
+
+    private:
+    template <typename scalar_t>
+    DETRAY_HOST static void grow(darray<scalar_t, 4> &ext, scalar_t r_min,
+                                 scalar_t r_max, scalar_t z_min,
+                                 scalar_t z_max) {
+        ext[0] = r_min < ext[0] ? r_min : ext[0];
+        ext[1] = r_max > ext[1] ? r_max : ext[1];
+        ext[2] = z_min < ext[2] ? z_min : ext[2];
+        ext[3] = z_max > ext[3] ? z_max : ext[3];
+    }
+};
+
+}  // namespace detail
+
+/// @brief Build a hierarchical volume finder for the detector @param det
+///
+/// The cylindrical extent of every volume is taken from its cylinder and
+/// ring portals in the geometry context @param ctx, which covers detectors
+/// of phi-symmetric, concentric volumes (e.g. the toy detector or ITk).
+/// Volumes without such portals cannot be found.
+///
+/// @param n_bins number of bins of the coarse grid in r, phi and z
+/// @param resource memory resource for the volume finder
+///
+/// @returns the volume finder
+template <typename detector_t,
+          typename volume_finder_t =
+              hierarchical_volume_finder<typename detector_t::algebra_type>>
+DETRAY_HOST auto build_volume_finder(
+    const detector_t &det, const darray<dindex, 3> &n_bins,
+    vecmem::memory_resource &resource,
+    const typename detector_t::geometry_context ctx = {}) -> volume_finder_t {
+
+    using scalar_t = dscalar<typename detector_t::algebra_type>;
+    using extent_t = typename volume_finder_t::extent_type;
+
+    constexpr auto inf{std::numeric_limits<scalar_t>::max()};
+
+    volume_finder_t vol_finder{resource};
+    for (const auto &vol_desc : det.volumes()) {
+        const auto vol = tracking_volume{det, vol_desc};
+
+        // r_min, r_max, z_min, z_max
+        darray<scalar_t, 4> ext{inf, -inf, inf, -inf};
+        for (const auto &pt_desc : vol.portals()) {
+            det.mask_store()
+                .template visit<detail::cylindrical_extent_creator>(
+                    pt_desc.mask(),
+                    det.transform_store().at(pt_desc.transform(), ctx), ext);
+        }
+        if (!(ext[0] < ext[1]) || !(ext[2] < ext[3])) {
+            continue;
+        }
+
+        vol_finder.push_back(extent_t{vol.index(), ext[0],
+                                      -constant<scalar_t>::pi, ext[2], ext[1],
+                                      constant<scalar_t>::pi, ext[3]});
+    }
+    vol_finder.build(n_bins);
+
+    return vol_finder;
+}
+
+}  // namespace detray
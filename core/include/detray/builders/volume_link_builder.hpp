@@ -0,0 +1,60 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/volume_links.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+namespace detray {
+
+/// @brief Build the volume link table of the detector @param det
+///
+/// Packs the links of the volume behind every portal into one record per
+/// surface. The surfaces that are not portals and the portals that leave the
+/// detector keep an invalid record.
+///
+/// @param resource memory resource for the table
+///
+/// @returns the volume link table
+template <typename detector_t>
+DETRAY_HOST auto build_volume_links(const detector_t &det,
+                                    vecmem::memory_resource &resource) {
+
+    using volume_t = typename detector_t::volume_type;
+    using record_t = typename volume_link_table<volume_t>::record_type;
+
+    volume_link_table<volume_t> table{resource};
+
+    for (const auto &sf_desc : det.surfaces()) {
+        const auto sf = tracking_surface{det, sf_desc};
+
+        record_t record{};
+        if (sf.is_portal() && !detail::is_invalid_value(sf.volume_link())) {
+            const volume_t &next_vol = det.volume(sf.volume_link());
+
+            record.volume = next_vol.index();
+            record.transform = next_vol.transform();
+            record.portals = next_vol.template sf_link<surface_id::e_portal>();
+            record.material = next_vol.material();
+            record.accel = next_vol.accel_link();
+            record.id = next_vol.id();
+        }
+        table.push_back(record);
+    }
+
+    return table;
+}
+
+}  // namespace detray
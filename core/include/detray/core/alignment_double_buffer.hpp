@@ -0,0 +1,275 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/device_detector_handle.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace detray {
+
+/// @brief Double buffered alignment of a detector on host and device
+///
+/// Holds two transform sets (slots) of the detector: One is published and
+/// used by the propagations that start now, while a new alignment can be
+/// written to the other one. On the host, the slots are two geometry contexts
+/// of the detector, which are overwritten in place. On the device, every slot
+/// has its own transform buffer, which shares the static detector data (@see
+/// device_detector_handle ).
+///
+/// A propagation leases the published slot for its duration. An update waits
+/// until the unpublished slot is no longer leased, copies the new transforms
+/// to host and device and then publishes the slot atomically. Running
+/// propagations finish on the previous alignment and no work has to be
+/// paused for the update.
+///
+/// @note The detector needs a transform store that keeps all transforms per
+/// context (@see single_store ). The two slots replace any geometry contexts
+/// that were added to the detector before. The detector must not be used
+/// while the buffer is constructed.
+template <typename detector_t>
+class alignment_double_buffer {
+
+    public:
+    using detector_type = detector_t;
+    using geometry_context = typename detector_t::geometry_context;
+    using transform_container = typename detector_t::transform_container;
+    using handle_type = device_detector_handle<detector_t>;
+    using view_type = typename handle_type::view_type;
+
+    /// Number of transform sets
+    static constexpr unsigned int n_slots{2u};
+
+    /// @brief Access to the published alignment for the duration of a
+    /// propagation
+    ///
+    /// The slot cannot be overwritten while the lease is alive. All kernels
+    /// that use the device view must have finished before it is released.
+    class lease {
+        public:
+        /// Not copyable, since every lease is counted once
+        lease(const lease &) = delete;
+        lease &operator=(const lease &) = delete;
+        lease &operator=(lease &&) = delete;
+
+        /// Move construction hands the slot over
+        lease(lease &&other) noexcept
+            : m_buffer{std::exchange(other.m_buffer, nullptr)},
+              m_slot{other.m_slot},
+              m_version{other.m_version} {}
+
+        /// Release the slot
+        ~lease() {
+            if (m_buffer != nullptr) {
+                m_buffer->release(m_slot);
+            }
+        }
+
+        /// @returns the geometry context of the host detector
+        DETRAY_HOST
+        geometry_context context() const {
+            return m_buffer->host_context(m_slot);
+        }
+
+        /// @returns the view of the device detector
+        DETRAY_HOST
+        view_type view() const { return m_buffer->m_device[m_slot].view(); }
+
+        /// @returns the index of the leased slot
+        DETRAY_HOST
+        unsigned int slot() const { return m_slot; }
+
+        /// @returns the number of the update that wrote the leased slot
+        /// (zero for the nominal transforms)
+        DETRAY_HOST
+        std::size_t version() const { return m_version; }
+
+        private:
+        friend class alignment_double_buffer;
+
+        lease(alignment_double_buffer &buffer, const unsigned int slot,
+              const std::size_t version)
+            : m_buffer{&buffer}, m_slot{slot}, m_version{version} {}
+
+        alignment_double_buffer *m_buffer{nullptr};
+        unsigned int m_slot{0u};
+        std::size_t m_version{0u};
+    };
+
+    /// Set up the slots with the nominal transforms of @param det
+    ///
+    /// @param host_mr memory resource for the host transform sets
+    /// @param dev_mr memory resource for the device detector
+    /// @param cpy copy object for the uploads to @param dev_mr
+    DETRAY_HOST
+    alignment_double_buffer(detector_t &det, vecmem::memory_resource &host_mr,
+                            vecmem::memory_resource &dev_mr, vecmem::copy &cpy)
+        : m_det{&det},
+          m_nominal{det, dev_mr, cpy},
+          m_transforms{copy_nominal(det, host_mr),
+                       copy_nominal(det, host_mr)},
+          m_device{m_nominal.with_transforms(m_transforms[0]),
+                   m_nominal.with_transforms(m_transforms[1])} {
+
+        // Add both slots as geometry contexts to the host detector
+        typename transform_container::base_type context_data{&host_mr};
+        for (unsigned int slot = 0u; slot < n_slots; ++slot) {
+            const auto &trfs = *m_transforms[slot].data();
+            context_data.insert(context_data.end(), trfs.begin(), trfs.end());
+        }
+        m_first_context = det.add_geometry_context(context_data).get();
+
+        if (m_first_context == 0u) {
+            throw std::invalid_argument(
+                "Alignment double buffer: Could not add the geometry contexts "
+                "to the detector");
+        }
+    }
+
+    /// Not copyable or movable, since the leases refer to the buffer
+    alignment_double_buffer(const alignment_double_buffer &) = delete;
+    alignment_double_buffer &operator=(const alignment_double_buffer &) =
+        delete;
+
+    /// @returns a lease on the published alignment
+    DETRAY_HOST
+    lease acquire() {
+        while (true) {
+            const unsigned int slot{m_published.load()};
+            m_n_leases[slot].fetch_add(1u);
+
+            // Make sure the slot was not given to an update in the meantime
+            if (slot == m_published.load()) {
+                return lease{*this, slot, m_slot_versions[slot]};
+            }
+            release(slot);
+        }
+    }
+
+    /// Write the transforms @param trfs to the unpublished slot and publish it
+    ///
+    /// Blocks until the slot is no longer leased. Updates from different
+    /// threads are applied one after the other.
+    ///
+    /// @note throws if the number of transforms does not match the detector
+    DETRAY_HOST
+    void update(const transform_container &trfs) {
+
+        if (trfs.size() != m_transforms[0].size()) {
+            throw std::invalid_argument(
+                "Alignment double buffer: Number of transforms does not match "
+                "the detector");
+        }
+
+        const std::scoped_lock lock{m_update_mutex};
+
+        const unsigned int slot{(m_published.load() + 1u) % n_slots};
+
+        // Wait for the propagations on the previous alignment in this slot
+        while (m_n_leases[slot].load() > 0u) {
+            std::this_thread::yield();
+        }
+
+        // Overwrite the slot in place on host and device
+        for (dindex i = 0u; i < trfs.size(); ++i) {
+            m_transforms[slot].at(i) = trfs.at(i);
+        }
+        m_det->update_geometry_context(*m_transforms[slot].data(),
+                                       host_context(slot));
+        m_device[slot].update_transforms(m_transforms[slot],
+                                         detray::copy::sync);
+
+        m_slot_versions[slot] = ++m_version;
+        m_published.store(slot);
+    }
+
+    /// Write and publish the transforms @param trfs in the background
+    ///
+    /// @returns a future that becomes ready when the update is published
+    DETRAY_HOST
+    std::future<void> update_async(transform_container trfs) {
+        return std::async(std::launch::async,
+                          [this, new_trfs = std::move(trfs)]() {
+                              update(new_trfs);
+                          });
+    }
+
+    /// @returns the index of the published slot
+    DETRAY_HOST
+    unsigned int published_slot() const { return m_published.load(); }
+
+    /// @returns the number of published updates
+    DETRAY_HOST
+    std::size_t version() const { return m_version.load(); }
+
+    /// @returns the geometry context of the host detector for @param slot
+    DETRAY_HOST
+    geometry_context host_context(const unsigned int slot) const {
+        return geometry_context{m_first_context + slot};
+    }
+
+    private:
+    /// Release a lease on @param slot
+    DETRAY_HOST
+    void release(const unsigned int slot) { m_n_leases[slot].fetch_sub(1u); }
+
+    /// @returns a copy of the nominal transforms of @param det
+    DETRAY_HOST
+    static transform_container copy_nominal(const detector_t &det,
+                                            vecmem::memory_resource &mr) {
+        transform_container trfs{mr};
+        const geometry_context ctx{};
+
+        trfs.reserve(det.transform_store().size(ctx), ctx);
+        for (const auto &trf : det.transform_store()) {
+            trfs.push_back(trf, ctx);
+        }
+        return trfs;
+    }
+
+    /// The host detector
+    detector_t *m_det{nullptr};
+    /// The device detector with the nominal transforms (shares its static
+    /// data with the slots)
+    handle_type m_nominal;
+    /// Host transform set per slot
+    std::array<transform_container, n_slots> m_transforms;
+    /// Device detector per slot
+    std::array<handle_type, n_slots> m_device;
+    /// Index of the first host geometry context of the slots
+    dindex m_first_context{0u};
+    /// The slot that new propagations use
+    std::atomic<unsigned int> m_published{0u};
+    /// Number of published updates, in total and when the slot was written
+    /// @{
+    std::atomic<std::size_t> m_version{0u};
+    std::array<std::size_t, n_slots> m_slot_versions{};
+    /// @}
+    /// Number of leases per slot
+    std::array<std::atomic<unsigned int>, n_slots> m_n_leases{};
+    /// Serializes the updates
+    std::mutex m_update_mutex;
+};
+
+}  // namespace detray
@@ -0,0 +1,409 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detail/data_context.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/utils/find_bound.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Data store that holds the nominal data and, per context, only the
+/// elements that differ from it.
+///
+/// The default context (zero) refers to the nominal data. Every further context
+/// (e.g. an alignment iteration) holds the indices of the changed elements,
+/// sorted, and the changed elements themselves. All other elements are shared
+/// with the nominal data. The deltas of all contexts are stored contiguously,
+/// the elements of a context are found by binary search over its indices.
+///
+/// @tparam T The type of the collection data, e.g. transforms
+/// @tparam container_t The type of container to use for the data collection.
+/// @tparam context_t the context with which to retrieve the correct data.
+template <typename T, template <typename...> class container_t = dvector,
+          typename context_t = geometry_context>
+class delta_store {
+
+    public:
+    /// Underlying container type that can handle vecmem views
+    using base_type = container_t<T>;
+    using size_type = typename base_type::size_type;
+    using value_type = typename base_type::value_type;
+    using iterator = typename base_type::iterator;
+    using const_iterator = typename base_type::const_iterator;
+    using context_type = context_t;
+
+    /// How to find data in the store
+    /// @{
+    using link_type = dindex;
+    using single_link = dindex;
+    using range_link = dindex_range;
+    /// @}
+
+    /// Vecmem view types: nominal data, deltas, delta indices and the
+    /// offsets of the contexts into the deltas
+    using view_type = dmulti_view<detail::get_view_t<container_t<T>>,
+                                  detail::get_view_t<container_t<T>>,
+                                  detail::get_view_t<container_t<dindex>>,
+                                  detail::get_view_t<container_t<dindex>>>;
+    using const_view_type =
+        dmulti_view<detail::get_view_t<const container_t<T>>,
+                    detail::get_view_t<const container_t<T>>,
+                    detail::get_view_t<const container_t<dindex>>,
+                    detail::get_view_t<const container_t<dindex>>>;
+    using buffer_type =
+        dmulti_buffer<detail::get_buffer_t<container_t<T>>,
+                      detail::get_buffer_t<container_t<T>>,
+                      detail::get_buffer_t<container_t<dindex>>,
+                      detail::get_buffer_t<container_t<dindex>>>;
+
+    /// Empty container
+    constexpr delta_store() = default;
+
+    /// Construct with a specific memory resource @param resource
+    /// (host-side only)
+    template <typename allocator_t = vecmem::memory_resource>
+    requires(std::derived_from<allocator_t, std::pmr::memory_resource>)
+        DETRAY_HOST explicit delta_store(allocator_t &resource)
+        : m_nominal(&resource),
+          m_deltas(&resource),
+          m_delta_indices(&resource),
+          m_context_offsets(&resource) {}
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <concepts::device_view container_view_t>
+    DETRAY_HOST_DEVICE explicit delta_store(container_view_t &view)
+        : m_nominal(detail::get<0>(view.m_view)),
+          m_deltas(detail::get<1>(view.m_view)),
+          m_delta_indices(detail::get<2>(view.m_view)),
+          m_context_offsets(detail::get<3>(view.m_view)) {}
+
+    /// @returns a pointer to the nominal data - const
+    DETRAY_HOST_DEVICE
+    constexpr auto data() const noexcept -> const base_type * {
+        return &m_nominal;
+    }
+
+    /// @returns a pointer to the nominal data - non-const
+    DETRAY_HOST_DEVICE
+    constexpr auto data() noexcept -> base_type * { return &m_nominal; }
+
+    /// @returns the number of elements, which is the same in every context
+    DETRAY_HOST_DEVICE
+    constexpr auto size(const context_type & /*ctx*/ = {}) const noexcept
+        -> dindex {
+        return static_cast<dindex>(m_nominal.size());
+    }
+
+    /// @returns true if the store is empty or does not contain the context
+    DETRAY_HOST_DEVICE
+    constexpr auto empty(const context_type &ctx = {}) const noexcept -> bool {
+        if (ctx.get() == 0u) {
+            return m_nominal.empty();
+        } else {
+            return ctx.get() > n_contexts();
+        }
+    }
+
+    /// @returns the number of contexts in addition to the nominal data
+    DETRAY_HOST_DEVICE
+    constexpr auto n_contexts() const noexcept -> dindex {
+        return m_context_offsets.empty()
+                   ? 0u
+                   : static_cast<dindex>(m_context_offsets.size() - 1u);
+    }
+
+    /// @returns the number of elements that differ from the nominal data in
+    /// the context @param ctx
+    DETRAY_HOST_DEVICE
+    constexpr auto n_deltas(const context_type &ctx) const noexcept -> dindex {
+        if (ctx.get() == 0u || ctx.get() > n_contexts()) {
+            return 0u;
+        }
+        return m_context_offsets[ctx.get()] - m_context_offsets[ctx.get() - 1u];
+    }
+
+    /// @returns the iterator at the start of the nominal data
+    DETRAY_HOST_DEVICE
+    constexpr auto begin(const context_type & /*ctx*/ = {}) const {
+        return m_nominal.begin();
+    }
+
+    /// @returns the sentinel of the nominal data
+    DETRAY_HOST_DEVICE
+    constexpr auto end(const context_type & /*ctx*/ = {}) const {
+        return m_nominal.end();
+    }
+
+    /// @returns access to the nominal data - const
+    DETRAY_HOST_DEVICE
+    constexpr auto get(const context_type & /*ctx*/) const noexcept
+        -> const base_type & {
+        return m_nominal;
+    }
+
+    /// @returns access to the nominal data - non-const
+    DETRAY_HOST_DEVICE
+    constexpr auto get(const context_type & /*ctx*/) noexcept -> base_type & {
+        return m_nominal;
+    }
+
+    /// @returns context based access to an element (also range checked)
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex i,
+                      const context_type &ctx = {}) const noexcept
+        -> const T & {
+        const dindex delta_idx{find_delta(i, ctx)};
+
+        return detail::is_invalid_value(delta_idx) ? m_nominal.at(i)
+                                                   : m_deltas.at(delta_idx);
+    }
+
+    /// @returns access to a nominal element (also range checked)
+    ///
+    /// @note the elements of other contexts can only be changed by adding a
+    /// new context
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex i, const context_type &ctx = {}) noexcept
+        -> T & {
+        assert(ctx.get() == 0u);
+        (void)ctx;
+        return m_nominal.at(i);
+    }
+
+    /// Removes and destructs all elements in the container.
+    DETRAY_HOST void clear(const context_type & /*ctx*/) {
+        assert(n_contexts() == 0u);
+        m_nominal.clear();
+    }
+
+    /// Reserve memory of size @param n for the nominal data
+    DETRAY_HOST void reserve(std::size_t n, const context_type & /*ctx*/) {
+        assert(n_contexts() == 0u);
+        m_nominal.reserve(n);
+    }
+
+    /// Resize the nominal data to @param n
+    DETRAY_HOST void resize(std::size_t n, const context_type & /*ctx*/) {
+        assert(n_contexts() == 0u);
+        m_nominal.resize(n);
+    }
+
+    /// Add a new element to the nominal data - copy
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param arg the constructor argument
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST constexpr auto push_back(
+        const U &arg, const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        assert(n_contexts() == 0u);
+        m_nominal.push_back(arg);
+    }
+
+    /// Add a new element to the nominal data - move
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param arg the constructor argument
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST constexpr auto push_back(
+        U &&arg, const context_type & /*ctx*/ = {}) noexcept(false) -> void {
+        assert(n_contexts() == 0u);
+        m_nominal.push_back(std::forward<U>(arg));
+    }
+
+    /// Add a new element to the nominal data in place
+    ///
+    /// @tparam Args are the types of the constructor arguments
+    ///
+    /// @param args is the list of constructor arguments
+    ///
+    /// @note in general can throw an exception
+    template <typename... Args>
+    DETRAY_HOST constexpr decltype(auto) emplace_back(
+        const context_type & /*ctx*/ = {}, Args &&... args) noexcept(false) {
+        assert(n_contexts() == 0u);
+        return m_nominal.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /// Insert another collection into the nominal data - copy
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param new_data is the new collection to be added
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST auto insert(container_t<U> &new_data,
+                            const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        assert(n_contexts() == 0u);
+        m_nominal.reserve(m_nominal.size() + new_data.size());
+        m_nominal.insert(m_nominal.end(), new_data.begin(), new_data.end());
+    }
+
+    /// Insert another collection into the nominal data - move
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param new_data is the new collection to be added
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST auto insert(container_t<U> &&new_data,
+                            const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        assert(n_contexts() == 0u);
+        m_nominal.reserve(m_nominal.size() + new_data.size());
+        m_nominal.insert(m_nominal.end(),
+                         std::make_move_iterator(new_data.begin()),
+                         std::make_move_iterator(new_data.end()));
+    }
+
+    /// Add a new context, in which the elements in @param deltas replace the
+    /// nominal elements at the given indices
+    ///
+    /// @param deltas pairs of element index and new element
+    ///
+    /// @returns the new context
+    ///
+    /// @note throws if an index is out of range or appears twice
+    DETRAY_HOST auto add_context(std::vector<std::pair<dindex, T>> deltas)
+        -> context_type {
+
+        std::ranges::stable_sort(deltas, std::less{}, [](const auto &delta) {
+            return delta.first;
+        });
+
+        for (std::size_t i = 0u; i < deltas.size(); ++i) {
+            const dindex idx{deltas[i].first};
+            if (idx >= m_nominal.size()) {
+                throw std::invalid_argument(
+                    "Delta store: Index " + std::to_string(idx) +
+                    " is out of range for " +
+                    std::to_string(m_nominal.size()) + " elements");
+            }
+            if (i > 0u && deltas[i - 1u].first == idx) {
+                throw std::invalid_argument("Delta store: Index " +
+                                            std::to_string(idx) +
+                                            " appears twice in the context");
+            }
+        }
+
+        if (m_context_offsets.empty()) {
+            m_context_offsets.push_back(0u);
+        }
+
+        m_deltas.reserve(m_deltas.size() + deltas.size());
+        m_delta_indices.reserve(m_delta_indices.size() + deltas.size());
+        for (auto &[idx, value] : deltas) {
+            m_delta_indices.push_back(idx);
+            m_deltas.push_back(std::move(value));
+        }
+        m_context_offsets.push_back(static_cast<dindex>(m_deltas.size()));
+
+        return context_type{n_contexts()};
+    }
+
+    /// Remove all contexts, the nominal data is kept
+    DETRAY_HOST void clear_contexts() {
+        m_deltas.clear();
+        m_delta_indices.clear();
+        m_context_offsets.clear();
+    }
+
+    /// Append the nominal data of another store to the current one
+    ///
+    /// @param other The other container
+    ///
+    /// @note in general can throw an exception
+    DETRAY_HOST void append(delta_store &other,
+                            const context_type &ctx = {}) noexcept(false) {
+        insert(other.m_nominal, ctx);
+    }
+
+    /// Append the nominal data of another store to the current one - move
+    ///
+    /// @param other The other container
+    ///
+    /// @note in general can throw an exception
+    DETRAY_HOST void append(delta_store &&other,
+                            const context_type &ctx = {}) noexcept(false) {
+        insert(std::move(other.m_nominal), ctx);
+    }
+
+    /// @return the view on the underlying containers - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{
+            detray::get_data(m_nominal), detray::get_data(m_deltas),
+            detray::get_data(m_delta_indices),
+            detray::get_data(m_context_offsets)};
+    }
+
+    /// @return the view on the underlying containers - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_nominal), detray::get_data(m_deltas),
+            detray::get_data(m_delta_indices),
+            detray::get_data(m_context_offsets)};
+    }
+
+    private:
+    /// @returns the position of element @param i in the deltas of the context
+    /// @param ctx or an invalid index if the nominal element is used
+    DETRAY_HOST_DEVICE
+    constexpr dindex find_delta(const dindex i,
+                                const context_type &ctx) const {
+        if (ctx.get() == 0u || ctx.get() > n_contexts()) {
+            return dindex_invalid;
+        }
+
+        const auto first{m_delta_indices.begin() +
+                         m_context_offsets[ctx.get() - 1u]};
+        const auto last{m_delta_indices.begin() + m_context_offsets[ctx.get()]};
+        const auto itr{detail::lower_bound(first, last, i)};
+
+        return (itr != last && *itr == i)
+                   ? static_cast<dindex>(itr - m_delta_indices.begin())
+                   : dindex_invalid;
+    }
+
+    /// The data of the default context
+    base_type m_nominal;
+    /// The changed elements of all contexts
+    base_type m_deltas;
+    /// The indices of the changed elements, sorted per context
+    container_t<dindex> m_delta_indices;
+    /// The start of the deltas of every context and the end of the last one
+    container_t<dindex> m_context_offsets;
+};
+
+}  // namespace detray
@@ -331,13 +331,31 @@ class multi_store {
     /// @tparam functor_t functor that will be called on the group.
     /// @tparam Args argument types for the functor
     ///
+    /// @tparam dispatch how to find the data collection for the id
+    ///
     /// @param id the element id
     /// @param args additional functor arguments
     ///
     /// @return the functor output
-    template <typename functor_t, typename... Args>
+    template <typename functor_t,
+              detail::visit_dispatch dispatch =
+                  detail::default_visit_dispatch<sizeof...(Ts)>,
+              typename... Args>
     DETRAY_HOST_DEVICE decltype(auto) visit(const ID id, Args &&... args) {
-        return m_tuple_container.template visit<functor_t>(
+        return m_tuple_container.template visit<functor_t, dispatch>(
+            static_cast<std::size_t>(id), std::forward<Args>(args)...);
+    }
+
+    /// Calls a functor for a collection with the id @param id - const
+    ///
+    /// @see visit
+    template <typename functor_t,
+              detail::visit_dispatch dispatch =
+                  detail::default_visit_dispatch<sizeof...(Ts)>,
+              typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit(const ID id,
+                                            Args &&... args) const {
+        return m_tuple_container.template visit<functor_t, dispatch>(
             static_cast<std::size_t>(id), std::forward<Args>(args)...);
     }
 
@@ -347,14 +365,19 @@ class multi_store {
     /// @tparam functor_t functor that will be called on the group.
     /// @tparam Args argument types for the functor
     ///
+    /// @tparam dispatch how to find the data collection for the link id
+    ///
     /// @param id the element id
     /// @param args additional functor arguments
     ///
     /// @return the functor output
-    template <typename functor_t, typename link_t, typename... Args>
+    template <typename functor_t,
+              detail::visit_dispatch dispatch =
+                  detail::default_visit_dispatch<sizeof...(Ts)>,
+              typename link_t, typename... Args>
     DETRAY_HOST_DEVICE decltype(auto) visit(const link_t link,
                                             Args &&... args) const {
-        return m_tuple_container.template visit<functor_t>(
+        return m_tuple_container.template visit<functor_t, dispatch>(
             static_cast<std::size_t>(detail::get<0>(link)),
             detail::get<1>(link), std::forward<Args>(args)...);
     }
@@ -0,0 +1,190 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detail/view_staging.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Helper trait to check whether all data of a (composite) view lives in
+/// vector views, which can be packed into a single allocation
+/// @{
+template <typename T>
+struct is_packable_view : public std::false_type {};
+
+template <typename T>
+struct is_packable_view<dvector_view<T>> : public std::true_type {};
+
+template <typename... view_ts>
+struct is_packable_view<dmulti_view<view_ts...>>
+    : public std::bool_constant<(is_packable_view<view_ts>::value && ...)> {
+};
+
+template <typename T>
+inline constexpr bool is_packable_view_v = is_packable_view<T>::value;
+/// @}
+
+/// @returns the number of vector views of @param view that are resizable
+/// @{
+template <typename T>
+DETRAY_HOST std::size_t n_resizable_views(const dvector_view<T> &view) {
+    return view.size_ptr() == nullptr ? 0u : 1u;
+}
+
+template <typename... view_ts, std::size_t... I>
+DETRAY_HOST std::size_t n_resizable_views(const dmulti_view<view_ts...> &view,
+                                          std::index_sequence<I...>) {
+    return (n_resizable_views(detail::get<I>(view.m_view)) + ... + 0u);
+}
+
+template <typename... view_ts>
+DETRAY_HOST std::size_t n_resizable_views(
+    const dmulti_view<view_ts...> &view) {
+    return n_resizable_views(view,
+                             std::make_index_sequence<sizeof...(view_ts)>{});
+}
+/// @}
+
+}  // namespace detail
+
+/// @brief Buffer that holds all data of a composite view (e.g. of a detector)
+/// in a single allocation.
+///
+/// The containers are laid out one after the other (aligned to their value
+/// types) in the order of the view members. They are gathered on the host
+/// and then copied with a single transfer, instead of one allocation and one
+/// copy per container as with @c get_buffer . The view of the buffer is
+/// compatible with the view of the original object.
+///
+/// @tparam view_t the view type of the original object
+template <concepts::device_view view_t>
+class dpacked_buffer : public detail::dbase_buffer {
+
+    static_assert(detail::is_packable_view_v<view_t>,
+                  "Only (composites of) vector views can be packed");
+
+    /// Unit of the allocation (sufficient alignment for all value types)
+    using block_type = std::max_align_t;
+
+    public:
+    /// Default constructor
+    dpacked_buffer() = default;
+
+    /// Pack the data of @param data_view into the memory resource @param mr
+    /// using the copy object @param cpy
+    ///
+    /// @note The data of the view needs to be accessible on the host
+    DETRAY_HOST
+    dpacked_buffer(const view_t &data_view, vecmem::memory_resource &mr,
+                   vecmem::copy &cpy,
+                   const detray::copy cpy_type = detray::copy::sync) {
+
+        if (detail::n_resizable_views(data_view) != 0u) {
+            throw std::invalid_argument(
+                "Resizable containers cannot be packed");
+        }
+
+        // Memory layout
+        detail::staging_area counter{};
+        detail::stage_view(data_view, counter, no_copy{});
+
+        const std::size_t n_blocks{
+            (counter.size() + sizeof(block_type) - 1u) / sizeof(block_type)};
+        m_n_bytes = n_blocks * sizeof(block_type);
+
+        // Gather the data in host memory
+        m_host_staging.resize(n_blocks);
+        detail::staging_area host_area{m_host_staging.data(), m_n_bytes};
+        detail::stage_view(data_view, host_area, host_copy{});
+
+        // Single allocation and single copy
+        m_buffer = dvector_buffer<block_type>{
+            static_cast<typename dvector_buffer<block_type>::size_type>(
+                n_blocks),
+            mr};
+
+        if (cpy_type == detray::copy::async) {
+            cpy(detray::get_data(m_host_staging), m_buffer)->ignore();
+        } else {
+            cpy(detray::get_data(m_host_staging), m_buffer)->wait();
+            m_host_staging = {};
+        }
+
+        // The same layout in the packed buffer
+        detail::staging_area area{m_buffer.ptr(), m_n_bytes};
+        m_view = detail::stage_view(data_view, area, no_copy{});
+    }
+
+    /// @returns the view on the packed data
+    DETRAY_HOST
+    view_t view() const { return m_view; }
+
+    /// @returns the size of the allocation in bytes
+    DETRAY_HOST
+    std::size_t size_bytes() const { return m_n_bytes; }
+
+    private:
+    /// Only computes the layout
+    struct no_copy {
+        void operator()(void *, const void *, std::size_t) const {}
+    };
+
+    /// Gathers the data on the host
+    struct host_copy {
+        void operator()(void *dst, const void *src,
+                        const std::size_t n_bytes) const {
+            std::memcpy(dst, src, n_bytes);
+        }
+    };
+
+    /// Host data that is copied from (kept for asynchronous copies)
+    std::vector<block_type> m_host_staging{};
+    /// The single allocation
+    dvector_buffer<block_type> m_buffer{};
+    /// The view into the allocation
+    view_t m_view{};
+    /// Size of the allocation
+    std::size_t m_n_bytes{0u};
+};
+
+/// @brief Get the packed buffer representation of a composite object
+///
+/// All containers of @param bufferable are copied into a single allocation in
+/// the memory resource @param mr with a single copy by @param cpy
+template <concepts::viewable T>
+dpacked_buffer<typename T::view_type> get_packed_buffer(
+    T &bufferable, vecmem::memory_resource &mr, vecmem::copy &cpy,
+    detray::copy cpy_type = detray::copy::sync) {
+    return dpacked_buffer<typename T::view_type>{bufferable.get_data(), mr,
+                                                 cpy, cpy_type};
+}
+
+/// @brief Get the view of a packed buffer
+template <concepts::device_view view_t>
+view_t get_data(const dpacked_buffer<view_t> &buff) {
+    return buff.view();
+}
+
+}  // namespace detray
@@ -0,0 +1,145 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/indexing.hpp"
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+
+/// Type traits to build a reduced detector metadata from an existing one,
+/// which only contains a subset of the mask, material and acceleration data
+/// structure types (@see write_reduced_metadata in
+/// "detray/utils/type_usage.hpp").
+namespace detray::detail {
+
+/// Make a new multi store from the collections @tparam I of the store
+/// @tparam store_t and index it with the ID enum @tparam new_id_t
+/// @{
+template <typename store_t, typename new_id_t, std::size_t... I>
+struct pruned_store {};
+
+template <typename ID, typename context_t,
+          template <typename...> class tuple_t, typename... Ts,
+          typename new_id_t, std::size_t... I>
+struct pruned_store<multi_store<ID, context_t, tuple_t, Ts...>, new_id_t,
+                    I...> {
+    static_assert(sizeof...(I) > 0u, "Cannot prune all types from a store");
+    static_assert(((I < sizeof...(Ts)) && ...), "Type index out of range");
+
+    using type = multi_store<new_id_t, context_t, tuple_t,
+                             types::at<types::list<Ts...>, I>...>;
+};
+
+template <typename store_t, typename new_id_t, std::size_t... I>
+using pruned_store_t = typename pruned_store<store_t, new_id_t, I...>::type;
+/// @}
+
+/// Replace the ID type of the typed index @tparam link_t by @tparam new_id_t
+/// @{
+template <typename link_t, typename new_id_t>
+struct relink {};
+
+template <typename id_t, typename index_t, typename value_t, value_t id_mask,
+          value_t index_mask, typename new_id_t>
+struct relink<typed_index<id_t, index_t, value_t, id_mask, index_mask>,
+              new_id_t> {
+    using type = typed_index<new_id_t, index_t, value_t, id_mask, index_mask>;
+};
+
+template <typename index_t, std::size_t DIM, typename new_id_t>
+struct relink<multi_index<index_t, DIM>, new_id_t> {
+    using type = multi_index<typename relink<index_t, new_id_t>::type, DIM>;
+};
+
+template <typename link_t, typename new_id_t>
+using relink_t = typename relink<link_t, new_id_t>::type;
+/// @}
+
+/// Replace the surface descriptor type @tparam old_sf_t by @tparam new_sf_t
+/// in the (accelerator) type @tparam T
+/// @{
+template <typename T, typename old_sf_t, typename new_sf_t>
+struct rebind_surface {
+    using type = std::conditional_t<std::is_same_v<T, old_sf_t>, new_sf_t, T>;
+};
+
+template <typename T, typename old_sf_t, typename new_sf_t>
+using rebind_surface_t = typename rebind_surface<T, old_sf_t, new_sf_t>::type;
+
+template <typename ID, typename context_t,
+          template <typename...> class tuple_t, typename... Ts,
+          typename old_sf_t, typename new_sf_t>
+struct rebind_surface<multi_store<ID, context_t, tuple_t, Ts...>, old_sf_t,
+                      new_sf_t> {
+    using type = multi_store<ID, context_t, tuple_t,
+                             rebind_surface_t<Ts, old_sf_t, new_sf_t>...>;
+};
+
+template <typename value_t, typename container_t, typename old_sf_t,
+          typename new_sf_t>
+struct rebind_surface<brute_force_collection<value_t, container_t>, old_sf_t,
+                      new_sf_t> {
+    using type =
+        brute_force_collection<rebind_surface_t<value_t, old_sf_t, new_sf_t>,
+                               container_t>;
+};
+
+template <typename algebra_t, typename value_t, typename container_t,
+          typename old_sf_t, typename new_sf_t>
+struct rebind_surface<bvh_collection<algebra_t, value_t, container_t>,
+                      old_sf_t, new_sf_t> {
+    using type =
+        bvh_collection<algebra_t, rebind_surface_t<value_t, old_sf_t, new_sf_t>,
+                       container_t>;
+};
+
+template <typename grid_t, typename old_sf_t, typename new_sf_t>
+struct rebind_surface<grid_collection<grid_t>, old_sf_t, new_sf_t> {
+    using type =
+        grid_collection<rebind_surface_t<grid_t, old_sf_t, new_sf_t>>;
+};
+
+template <typename axes_t, typename bin_t,
+          template <std::size_t> class serializer_t, typename old_sf_t,
+          typename new_sf_t>
+struct rebind_surface<grid_impl<axes_t, bin_t, serializer_t>, old_sf_t,
+                      new_sf_t> {
+    using type = grid_impl<axes_t, rebind_surface_t<bin_t, old_sf_t, new_sf_t>,
+                           serializer_t>;
+};
+
+template <typename entry_t, typename old_sf_t, typename new_sf_t>
+struct rebind_surface<bins::single<entry_t>, old_sf_t, new_sf_t> {
+    using type = bins::single<rebind_surface_t<entry_t, old_sf_t, new_sf_t>>;
+};
+
+template <typename entry_t, std::size_t N, typename old_sf_t,
+          typename new_sf_t>
+struct rebind_surface<bins::static_array<entry_t, N>, old_sf_t, new_sf_t> {
+    using type =
+        bins::static_array<rebind_surface_t<entry_t, old_sf_t, new_sf_t>, N>;
+};
+
+template <typename entry_t, typename old_sf_t, typename new_sf_t>
+struct rebind_surface<bins::dynamic_array<entry_t>, old_sf_t, new_sf_t> {
+    using type =
+        bins::dynamic_array<rebind_surface_t<entry_t, old_sf_t, new_sf_t>>;
+};
+/// @}
+
+}  // namespace detray::detail
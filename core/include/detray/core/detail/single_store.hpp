@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -18,6 +18,8 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
 #include <type_traits>
 
@@ -257,20 +259,25 @@ class single_store {
         m_context_size = m_container.size();
     }
 
+    /// Replace the contexts of the store by the data in @param context_data,
+    /// which holds a multiple of the context size (one block per context)
+    ///
+    /// @returns the first of the new contexts, or the default context if the
+    /// data could not be added
     template <typename U>
     DETRAY_HOST auto add_context(container_t<U> &context_data) noexcept(false)
-        -> void {
+        -> context_type {
         // Cannot add context data to an empty store
         if (m_context_size == 0u) {
             std::cout << "WARNING: Single Store. Cannot add a context to an "
                          "empty store ";
-            return;
+            return context_type{};
         }
         // Wrong size of the context_data vector
         if (context_data.size() % m_context_size != 0u) {
             std::cout << "WARNING: Single Store. Wrong size of the inserted "
                          "vector. Must be multiple of the context size";
-            return;
+            return context_type{};
         }
         // Drop previous contexts if any
         if (m_container.size() > m_context_size)
@@ -280,6 +287,31 @@ class single_store {
         m_container.reserve(m_container.size() + context_data.size());
         m_container.insert(m_container.end(), context_data.begin(),
                            context_data.end());
+
+        return context_type{1u};
+    }
+
+    /// Overwrite the data of the existing context @param ctx with
+    /// @param context_data in place, without reallocating the container
+    ///
+    /// @note Readers of other contexts are not affected by the update, so
+    /// that they can continue while the context is overwritten.
+    ///
+    /// @returns false if the context does not exist or the size of the data
+    /// does not match the context size
+    template <typename U>
+    DETRAY_HOST auto update_context(const container_t<U> &context_data,
+                                    const context_type &ctx) noexcept(false)
+        -> bool {
+        if (ctx.get() == 0u || ctx.get() > m_n_contexts ||
+            context_data.size() != m_context_size) {
+            return false;
+        }
+        std::copy(context_data.begin(), context_data.end(),
+                  m_container.begin() +
+                      static_cast<std::ptrdiff_t>(ctx.get() * m_context_size));
+
+        return true;
     }
 
     /// Append another store to the current one
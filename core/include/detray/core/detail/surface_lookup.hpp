@@ -13,34 +13,34 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/indexing.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/utils/find_bound.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <type_traits>
 
 namespace detray {
 
-/// General case: Brute force search for the corresponding sf-descriptor
+/// Search for the sf-descriptor that belongs to a source link: Uses the source
+/// index of the surface lookup, if it was built, otherwise a linear scan
 struct default_searcher {
 
-    template <typename source_link_contianer_t>
-    auto operator()(const source_link_contianer_t &sf_container) {
-        // Check that this searcher can be used on the passed surface container
-        static_assert(
-            std::is_same_v<decltype(sf_container[0].source), std::uint64_t>,
-            "Source link searcher not compatible with detector");
-
-        // Cannot assume any sorting
-        for (const auto &sf : sf_container) {
-            if (sf.source == m_source) {
-                return sf;
-            }
+    template <typename surface_lookup_t>
+    DETRAY_HOST_DEVICE auto operator()(const surface_lookup_t &sf_lookup) const {
+        using value_t = std::remove_cvref_t<decltype(sf_lookup[0u])>;
+
+        const dindex sf_idx{sf_lookup.find_source(m_source)};
+        if (detail::is_invalid_value(sf_idx)) {
+            return value_t{};
         }
 
-        return typename source_link_contianer_t::value_type{};
+        return value_t{sf_lookup[sf_idx]};
     }
 
     /// The query source link
@@ -59,9 +59,133 @@ struct source_link : sf_desc_t {
     std::uint64_t source{detail::invalid_value<std::uint64_t>()};
 };
 
+namespace detail {
+
+/// Source link and index of the respective surface in the lookup
+struct source_index_entry {
+    std::uint64_t source{invalid_value<std::uint64_t>()};
+    dindex surface{dindex_invalid};
+
+    /// Sort by source link
+    /// @{
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator<(const source_index_entry &lhs,
+                                    const source_index_entry &rhs) {
+        return lhs.source < rhs.source;
+    }
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator<(const source_index_entry &lhs,
+                                    const std::uint64_t src) {
+        return lhs.source < src;
+    }
+    /// @}
+};
+
+/// @brief Index of the surfaces sorted by their source links.
+///
+/// Finds the surface that belongs to a source link by binary search, on host
+/// and device.
+///
+/// @tparam container_t The type of container to use for the index entries
+template <template <typename...> class container_t = dvector>
+class source_index {
+
+    public:
+    /// The entry type does not depend on the container, so that the host
+    /// and device views are compatible
+    using entry = source_index_entry;
+
+    using view_type = detail::get_view_t<container_t<entry>>;
+    using const_view_type = detail::get_view_t<const container_t<entry>>;
+    using buffer_type = detail::get_buffer_t<container_t<entry>>;
+
+    /// Empty index
+    constexpr source_index() = default;
+
+    /// Construct with a specific memory resource @param resource
+    DETRAY_HOST
+    explicit source_index(vecmem::memory_resource *resource)
+        : m_entries(resource) {}
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <concepts::device_view container_view_t>
+    DETRAY_HOST_DEVICE explicit source_index(container_view_t &view)
+        : m_entries(view) {}
+
+    /// @returns the number of indexed surfaces
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> dindex {
+        return static_cast<dindex>(m_entries.size());
+    }
+
+    /// @returns true if the index was not built
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const noexcept { return m_entries.empty(); }
+
+    /// Index all surfaces with a valid source link in @param sf_lookup
+    template <typename surface_lookup_t>
+    DETRAY_HOST void build(const surface_lookup_t &sf_lookup) {
+        m_entries.clear();
+        m_entries.reserve(sf_lookup.size());
+        for (dindex i = 0u; i < sf_lookup.size(); ++i) {
+            if (!is_invalid_value(sf_lookup.source(i))) {
+                m_entries.push_back({sf_lookup.source(i), i});
+            }
+        }
+        std::stable_sort(m_entries.begin(), m_entries.end());
+    }
+
+    /// Removes all entries
+    DETRAY_HOST void clear() { m_entries.clear(); }
+
+    /// @returns the index of the first surface with source link @param src
+    /// or an invalid index, if there is none
+    DETRAY_HOST_DEVICE
+    constexpr dindex find(const std::uint64_t src) const {
+        const auto itr{
+            detail::lower_bound(m_entries.begin(), m_entries.end(), src)};
+
+        return (itr != m_entries.end() && (*itr).source == src)
+                   ? (*itr).surface
+                   : dindex_invalid;
+    }
+
+    /// @return the view on the index entries - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return detray::get_data(m_entries);
+    }
+
+    /// @return the view on the index entries - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return detray::get_data(m_entries);
+    }
+
+    private:
+    container_t<entry> m_entries;
+};
+
+/// @returns the index of the first surface with source link @param src in
+/// @param sf_lookup by linear search, or an invalid index
+template <typename surface_lookup_t>
+DETRAY_HOST_DEVICE constexpr dindex find_source_linear(
+    const surface_lookup_t &sf_lookup, const std::uint64_t src) {
+    // Cannot assume any sorting
+    for (dindex i = 0u; i < sf_lookup.size(); ++i) {
+        if (sf_lookup.source(i) == src) {
+            return i;
+        }
+    }
+    return dindex_invalid;
+}
+
+}  // namespace detail
+
 /// @brief Wraps a vector-like container that holds the surface descriptors of a
 /// detector and makes them searchable by index and source link.
 ///
+/// The search by source link is a linear scan, unless the source index is
+/// built (@see build_source_index ).
+///
 /// @tparam sf_desc_t The surface descriptor type
 /// @tparam container_t The type of container to use for the descriptor
 /// collection.
@@ -77,12 +201,18 @@ class surface_lookup {
     using iterator = typename base_type::iterator;
     using const_iterator = typename base_type::const_iterator;
 
+    using index_type = detail::source_index<container_t>;
+
     /// Vecmem view types
-    using view_type = detail::get_view_t<container_t<source_link<sf_desc_t>>>;
-    using const_view_type =
-        detail::get_view_t<const container_t<source_link<sf_desc_t>>>;
+    using view_type =
+        dmulti_view<detail::get_view_t<container_t<source_link<sf_desc_t>>>,
+                    typename index_type::view_type>;
+    using const_view_type = dmulti_view<
+        detail::get_view_t<const container_t<source_link<sf_desc_t>>>,
+        typename index_type::const_view_type>;
     using buffer_type =
-        detail::get_buffer_t<container_t<source_link<sf_desc_t>>>;
+        dmulti_buffer<detail::get_buffer_t<container_t<source_link<sf_desc_t>>>,
+                      typename index_type::buffer_type>;
 
     /// Empty container
     constexpr surface_lookup() = default;
@@ -92,7 +222,7 @@ class surface_lookup {
     template <typename allocator_t = vecmem::memory_resource>
     requires(!concepts::device_view<allocator_t>) DETRAY_HOST
         explicit surface_lookup(allocator_t &resource)
-        : m_container(&resource) {}
+        : m_container(&resource), m_source_index(&resource) {}
 
     /// Copy Construct with a specific memory resource @param resource
     /// (host-side only)
@@ -101,12 +231,13 @@ class surface_lookup {
     requires std::is_same_v<C, std::vector<source_link<sf_desc_t>>>
         DETRAY_HOST explicit surface_lookup(allocator_t &resource,
                                             const source_link<sf_desc_t> &arg)
-        : m_container(&resource, arg) {}
+        : m_container(&resource, arg), m_source_index(&resource) {}
 
     /// Construct from the container @param view . Mainly used device-side.
     template <concepts::device_view container_view_t>
     DETRAY_HOST_DEVICE explicit surface_lookup(container_view_t &view)
-        : m_container(view) {}
+        : m_container(detail::get<0>(view.m_view)),
+          m_source_index(detail::get<1>(view.m_view)) {}
 
     /// @returns the size of the underlying container
     DETRAY_HOST_DEVICE
@@ -127,7 +258,10 @@ class surface_lookup {
     DETRAY_HOST void resize(std::size_t n) { m_container.resize(n); }
 
     /// Removes and destructs all elements in the container.
-    DETRAY_HOST void clear() { m_container.clear(); }
+    DETRAY_HOST void clear() {
+        m_container.clear();
+        m_source_index.clear();
+    }
 
     /// @returns the collections iterator at the start position.
     DETRAY_HOST_DEVICE
@@ -196,12 +330,36 @@ class surface_lookup {
         return search(bcd.index());
     }
 
+    /// @returns the source link of the surface with index @param sf_index
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t source(const dindex sf_index) const {
+        assert(sf_index < m_container.size());
+        return m_container[sf_index].source;
+    }
+
+    /// Sort the surfaces by source link, so that they can be found by binary
+    /// search. Has to be repeated after the surfaces were modified.
+    DETRAY_HOST void build_source_index() { m_source_index.build(*this); }
+
+    /// @returns the source index
+    DETRAY_HOST_DEVICE
+    constexpr const index_type &source_index() const { return m_source_index; }
+
+    /// @returns the index of the first surface with source link @param src
+    /// or an invalid index, if there is none
+    DETRAY_HOST_DEVICE
+    constexpr dindex find_source(const std::uint64_t src) const {
+        return m_source_index.empty()
+                   ? detail::find_source_linear(*this, src)
+                   : m_source_index.find(src);
+    }
+
     /// @returns the surface descriptor according to the searcher passed as
     /// @param source_searcher
     template <typename searcher_t = default_searcher>
     DETRAY_HOST_DEVICE constexpr decltype(auto) search(
         searcher_t &&source_searcher) const {
-        return source_searcher(m_container);
+        return source_searcher(*this);
     }
 
     /// Add a new element to the collection
@@ -212,6 +370,7 @@ class surface_lookup {
                                          std::uint64_t src) noexcept(false)
         -> void {
         m_container.push_back({sf_desc, src});
+        m_source_index.clear();
     }
 
     /// Add a new element to the collection - copy
@@ -220,6 +379,7 @@ class surface_lookup {
     DETRAY_HOST constexpr auto push_back(
         source_link<sf_desc_t> sf_link) noexcept(false) -> void {
         m_container.push_back(sf_link);
+        m_source_index.clear();
     }
 
     /// Insert a surface descriptor @param sf_desc and its source index
@@ -242,21 +402,303 @@ class surface_lookup {
             m_container.resize(sf_link.index() + 1u);
         }
         m_container.at(sf_link.index()) = sf_link;
+        m_source_index.clear();
     }
 
     /// @return the view on the underlying container - non-const
     DETRAY_HOST auto get_data() -> view_type {
-        return detray::get_data(m_container);
+        return view_type{detray::get_data(m_container),
+                         detray::get_data(m_source_index)};
     }
 
     /// @return the view on the underlying container - const
     DETRAY_HOST auto get_data() const -> const_view_type {
-        return detray::get_data(m_container);
+        return const_view_type{detray::get_data(m_container),
+                               detray::get_data(m_source_index)};
     }
 
     private:
     /// The underlying container implementation
     base_type m_container;
+    /// Surfaces sorted by source link (optional)
+    index_type m_source_index;
+};
+
+/// @brief Surface lookup that keeps the source links in a separate container.
+///
+/// Same interface as @c surface_lookup, but the surface descriptors are stored
+/// without their source links, which halves the memory that is loaded for
+/// every surface access. The source links are only read when they are
+/// explicitly requested, e.g. to map a measurement to its surface. As for the
+/// @c surface_lookup, a source index can be built for the search by source
+/// link.
+///
+/// @tparam sf_desc_t The surface descriptor type
+/// @tparam container_t The type of container to use for the descriptors and
+/// the source links.
+template <typename sf_desc_t,
+          template <typename...> class container_t = dvector>
+class compact_surface_lookup {
+
+    /// Container types
+    using desc_container = container_t<sf_desc_t>;
+    using source_container = container_t<std::uint64_t>;
+
+    public:
+    using size_type = typename desc_container::size_type;
+    /// The source links are added together with the descriptors
+    using value_type = source_link<sf_desc_t>;
+    using iterator = typename desc_container::iterator;
+    using const_iterator = typename desc_container::const_iterator;
+
+    using index_type = detail::source_index<container_t>;
+
+    /// Vecmem view types
+    using view_type = dmulti_view<detail::get_view_t<desc_container>,
+                                  detail::get_view_t<source_container>,
+                                  typename index_type::view_type>;
+    using const_view_type =
+        dmulti_view<detail::get_view_t<const desc_container>,
+                    detail::get_view_t<const source_container>,
+                    typename index_type::const_view_type>;
+    using buffer_type = dmulti_buffer<detail::get_buffer_t<desc_container>,
+                                      detail::get_buffer_t<source_container>,
+                                      typename index_type::buffer_type>;
+
+    /// Empty container
+    constexpr compact_surface_lookup() = default;
+
+    /// Construct with a specific memory resource @param resource
+    /// (host-side only)
+    template <typename allocator_t = vecmem::memory_resource>
+    requires(!concepts::device_view<allocator_t>) DETRAY_HOST
+        explicit compact_surface_lookup(allocator_t &resource)
+        : m_descriptors(&resource),
+          m_sources(&resource),
+          m_source_index(&resource) {}
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <concepts::device_view container_view_t>
+    DETRAY_HOST_DEVICE explicit compact_surface_lookup(container_view_t &view)
+        : m_descriptors(detail::get<0>(view.m_view)),
+          m_sources(detail::get<1>(view.m_view)),
+          m_source_index(detail::get<2>(view.m_view)) {}
+
+    /// @returns the size of the underlying container
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> dindex {
+        return static_cast<dindex>(m_descriptors.size());
+    }
+
+    /// @returns true if the underlying container is empty
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return m_descriptors.empty();
+    }
+
+    /// Reserve memory of size @param n
+    DETRAY_HOST void reserve(std::size_t n) {
+        m_descriptors.reserve(n);
+        m_sources.reserve(n);
+    }
+
+    /// Resize the underlying containers to @param n
+    DETRAY_HOST void resize(std::size_t n) {
+        m_descriptors.resize(n);
+        m_sources.resize(n, detail::invalid_value<std::uint64_t>());
+    }
+
+    /// Removes and destructs all elements in the container.
+    DETRAY_HOST void clear() {
+        m_descriptors.clear();
+        m_sources.clear();
+        m_source_index.clear();
+    }
+
+    /// @returns the descriptor iterator at the start position.
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) begin() { return m_descriptors.begin(); }
+
+    /// @returns the descriptor iterator sentinel.
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) end() { return m_descriptors.end(); }
+
+    /// @returns the descriptor iterator at the start position - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) begin() const { return m_descriptors.begin(); }
+
+    /// @returns the descriptor iterator sentinel - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) end() const { return m_descriptors.end(); }
+
+    /// @returns the reverse iterator at the start position - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) rbegin() const { return m_descriptors.rbegin(); }
+
+    /// @returns the reverse iterator sentinel - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) rend() const { return m_descriptors.rend(); }
+
+    /// Elementwise access to the descriptors - non-const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) operator[](const std::size_t i) {
+        assert(i < m_descriptors.size());
+        return m_descriptors[i];
+    }
+
+    /// Elementwise access to the descriptors - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) operator[](const std::size_t i) const {
+        assert(i < m_descriptors.size());
+        return m_descriptors[i];
+    }
+
+    /// @returns access to a descriptor (also range checked)
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) at(const dindex i) noexcept {
+        assert(i < m_descriptors.size());
+        return m_descriptors.at(i);
+    }
+
+    /// @returns access to a descriptor (also range checked) - const
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) at(const dindex i) const noexcept {
+        assert(i < m_descriptors.size());
+        return m_descriptors.at(i);
+    }
+
+    /// @returns the source link of the surface with index @param sf_index
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t source(const dindex sf_index) const {
+        assert(sf_index < m_sources.size());
+        return m_sources[sf_index];
+    }
+
+    /// Sort the surfaces by source link, so that they can be found by binary
+    /// search. Has to be repeated after the surfaces were modified.
+    DETRAY_HOST void build_source_index() { m_source_index.build(*this); }
+
+    /// @returns the source index
+    DETRAY_HOST_DEVICE
+    constexpr const index_type &source_index() const { return m_source_index; }
+
+    /// @returns the index of the first surface with source link @param src
+    /// or an invalid index, if there is none
+    DETRAY_HOST_DEVICE
+    constexpr dindex find_source(const std::uint64_t src) const {
+        return m_source_index.empty()
+                   ? detail::find_source_linear(*this, src)
+                   : m_source_index.find(src);
+    }
+
+    /// @returns the surface descriptor according to the global surface index
+    /// @param sf_index
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) search(dindex sf_index) const {
+        assert(sf_index < m_descriptors.size());
+        return m_descriptors[sf_index];
+    }
+
+    /// @returns the surface descriptor according to the surface barcode
+    /// @param bcd
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) search(geometry::barcode bcd) const {
+        return search(bcd.index());
+    }
+
+    /// @returns the surface descriptor according to the searcher passed as
+    /// @param source_searcher
+    template <typename searcher_t = default_searcher>
+    DETRAY_HOST_DEVICE constexpr decltype(auto) search(
+        searcher_t &&source_searcher) const {
+        return source_searcher(*this);
+    }
+
+    /// Add a new element to the collection
+    ///
+    /// @param sf_desc the surface descriptor
+    /// @param src the source index
+    DETRAY_HOST constexpr auto push_back(sf_desc_t sf_desc,
+                                         std::uint64_t src) noexcept(false)
+        -> void {
+        m_descriptors.push_back(sf_desc);
+        m_sources.push_back(src);
+        m_source_index.clear();
+    }
+
+    /// Add a new element to the collection - copy
+    ///
+    /// @param sf_link the detray source link
+    DETRAY_HOST constexpr auto push_back(
+        source_link<sf_desc_t> sf_link) noexcept(false) -> void {
+        push_back(static_cast<sf_desc_t>(sf_link), sf_link.source);
+    }
+
+    /// Insert a surface descriptor @param sf_desc and its source index
+    /// @param src into the container
+    DETRAY_HOST void insert(
+        sf_desc_t sf_desc,
+        std::uint64_t src =
+            detail::invalid_value<std::uint64_t>()) noexcept(false) {
+        insert({sf_desc, src});
+    }
+
+    /// Insert a source link @param sf_link at the position of its surface
+    /// index.
+    DETRAY_HOST void insert(source_link<sf_desc_t> sf_link) noexcept(false) {
+        if (detail::is_invalid_value(sf_link.index())) {
+            std::cout << "ERROR: Invalid surface descriptor: " << sf_link
+                      << std::endl;
+        }
+        if (m_descriptors.size() <= sf_link.index()) {
+            resize(sf_link.index() + 1u);
+        }
+        m_descriptors.at(sf_link.index()) = static_cast<sf_desc_t>(sf_link);
+        m_sources.at(sf_link.index()) = sf_link.source;
+        m_source_index.clear();
+    }
+
+    /// @return the view on the underlying containers - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_descriptors),
+                         detray::get_data(m_sources),
+                         detray::get_data(m_source_index)};
+    }
+
+    /// @return the view on the underlying containers - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_descriptors),
+                               detray::get_data(m_sources),
+                               detray::get_data(m_source_index)};
+    }
+
+    private:
+    /// The surface descriptors, accessed during navigation
+    desc_container m_descriptors;
+    /// The source links, accessed rarely
+    source_container m_sources;
+    /// Surfaces sorted by source link (optional)
+    index_type m_source_index;
 };
 
+namespace detail {
+
+/// Select the surface lookup of the detector: The metadata can opt into a
+/// different layout (e.g. @c compact_surface_lookup ) by defining a
+/// @c surface_lookup template
+/// @{
+template <typename metadata_t, template <typename...> class vector_t>
+struct surface_lookup_selector {
+    using type = surface_lookup<typename metadata_t::surface_type, vector_t>;
+};
+
+template <typename metadata_t, template <typename...> class vector_t>
+requires requires { typename metadata_t::template surface_lookup<vector_t>; }
+struct surface_lookup_selector<metadata_t, vector_t> {
+    using type = typename metadata_t::template surface_lookup<vector_t>;
+};
+/// @}
+
+}  // namespace detail
+
 }  // namespace detray
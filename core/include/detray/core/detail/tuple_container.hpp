@@ -20,11 +20,25 @@
 
 // System include(s)
 #include <concepts>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 
 namespace detray::detail {
 
+/// Strategies to find the tuple element that belongs to a runtime index
+enum class visit_dispatch : std::uint_least8_t {
+    e_linear = 0u,  ///< Comparison cascade over the element indices
+    e_switch = 1u,  ///< Switch statements (jump tables) over blocks of indices
+    e_binary = 2u,  ///< Binary search over the indices, switch at the leaves
+};
+
+/// Default dispatch strategy for a tuple with @tparam N elements: A switch
+/// for short type lists and a binary search for long ones
+template <std::size_t N>
+inline constexpr visit_dispatch default_visit_dispatch{
+    N <= 16u ? visit_dispatch::e_switch : visit_dispatch::e_binary};
+
 /// @brief detray tuple wrapper.
 ///
 /// @tparam An enum of type IDs that needs to match the [value] types of the
@@ -126,20 +140,67 @@ class tuple_container {
     /// Visits a tuple element according to its @param idx and calls
     /// @tparam functor_t with the arguments @param As on it.
     ///
+    /// @tparam dispatch how to find the tuple element for the index
+    ///
     /// @returns the functor result (this is necessarily always of the same
     /// type, regardless the input tuple element type).
-    template <typename functor_t, typename... Args>
+    template <typename functor_t,
+              visit_dispatch dispatch = default_visit_dispatch<sizeof...(Ts)>,
+              typename... Args>
     DETRAY_HOST_DEVICE decltype(auto) visit(const std::size_t idx,
                                             Args &&... As) const
         requires std::invocable<
             functor_t, decltype(detail::get<0>(std::declval<tuple_type>())),
             Args...> {
-        return visit_helper<functor_t>(
-            idx, std::make_index_sequence<sizeof...(Ts)>{},
-            std::forward<Args>(As)...);
+
+        static_assert(
+            has_uniform_result<functor_t, Args...>(
+                std::make_index_sequence<sizeof...(Ts)>{}),
+            "Functor return type must be the same for all elements of the "
+            "tuple.");
+
+        if constexpr (dispatch == visit_dispatch::e_linear) {
+            return visit_helper<functor_t>(
+                idx, std::make_index_sequence<sizeof...(Ts)>{},
+                std::forward<Args>(As)...);
+        } else if constexpr (dispatch == visit_dispatch::e_switch) {
+            return visit_switch<functor_t, 0u, sizeof...(Ts)>(
+                idx, std::forward<Args>(As)...);
+        } else {
+            return visit_binary<functor_t, 0u, sizeof...(Ts)>(
+                idx, std::forward<Args>(As)...);
+        }
     }
 
     private:
+    /// Number of tuple indices that are handled by a single switch statement
+    static constexpr std::size_t k_switch_block{8u};
+
+    /// Result type of the functor @tparam functor_t on the tuple elements
+    template <typename functor_t, typename... Args>
+    using visit_result_t = std::invoke_result_t<
+        functor_t, const detail::tuple_element_t<0, tuple_type> &, Args...>;
+
+    /// @returns whether the functor returns the same type for all elements
+    template <typename functor_t, typename... Args, std::size_t... I>
+    static consteval bool has_uniform_result(
+        std::index_sequence<I...> /*seq*/) {
+        return (std::is_same_v<visit_result_t<functor_t, Args...>,
+                               std::invoke_result_t<
+                                   functor_t,
+                                   const detail::tuple_element_t<I, tuple_type>
+                                       &,
+                                   Args...>> &&
+                ...);
+    }
+
+    /// @returns the functor result for an index that matches no element
+    template <typename return_t>
+    DETRAY_HOST_DEVICE static constexpr return_t no_match() {
+        if constexpr (!std::is_same_v<return_t, void>) {
+            return return_t{};
+        }
+    }
     /// @returns the view for all contained types.
     template <std::size_t... I>
     requires(concepts::viewable<Ts> &&...) DETRAY_HOST view_type
@@ -190,24 +251,6 @@ class tuple_container {
         const std::size_t idx,
         std::index_sequence<first_idx, remaining_idcs...> /*seq*/,
         Args &&... As) const {
-        using return_type = std::invoke_result_t<
-            functor_t, const detail::tuple_element_t<0, tuple_type> &, Args...>;
-
-        static_assert(
-            std::is_same_v<return_type,
-                           std::invoke_result_t<functor_t,
-                                                const detail::tuple_element_t<
-                                                    first_idx, tuple_type> &,
-                                                Args...>> &&
-                (std::is_same_v<
-                     return_type,
-                     std::invoke_result_t<functor_t,
-                                          const detail::tuple_element_t<
-                                              remaining_idcs, tuple_type> &,
-                                          Args...>> &&
-                 ...),
-            "Functor return type must be the same for all elements of the "
-            "tuple.");
 
         // Check if the first tuple index is matched to the target ID
         if (idx == first_idx) {
@@ -218,10 +261,92 @@ class tuple_container {
             return visit_helper<functor_t>(
                 idx, std::index_sequence<remaining_idcs...>{},
                 std::forward<Args>(As)...);
-        } else if constexpr (std::is_same_v<return_type, void>) {
-            return;
         } else {
-            return return_type{};
+            return no_match<visit_result_t<functor_t, Args...>>();
+        }
+    }
+
+    /// Calls the functor on the element @tparam I, if it is smaller than the
+    /// end @tparam last of the index range
+    template <typename functor_t, std::size_t I, std::size_t last,
+              typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit_case(Args &&... As) const {
+        if constexpr (I < last) {
+            return functor_t()(get<I>(), std::forward<Args>(As)...);
+        } else {
+            return no_match<visit_result_t<functor_t, Args...>>();
+        }
+    }
+
+    /// Calls the functor on the element that corresponds to @param idx in the
+    /// index range [@tparam first, @tparam last), with one switch statement
+    /// per block of @c k_switch_block indices (the compiler can emit a jump
+    /// table instead of a comparison cascade).
+    ///
+    /// @note @param idx must not be smaller than @tparam first
+    template <typename functor_t, std::size_t first, std::size_t last,
+              typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit_switch(const std::size_t idx,
+                                                   Args &&... As) const {
+        static_assert(k_switch_block == 8u, "Update the switch cases");
+
+        switch (idx - first) {
+            case 0u:
+                return visit_case<functor_t, first, last>(
+                    std::forward<Args>(As)...);
+            case 1u:
+                return visit_case<functor_t, first + 1u, last>(
+                    std::forward<Args>(As)...);
+            case 2u:
+                return visit_case<functor_t, first + 2u, last>(
+                    std::forward<Args>(As)...);
+            case 3u:
+                return visit_case<functor_t, first + 3u, last>(
+                    std::forward<Args>(As)...);
+            case 4u:
+                return visit_case<functor_t, first + 4u, last>(
+                    std::forward<Args>(As)...);
+            case 5u:
+                return visit_case<functor_t, first + 5u, last>(
+                    std::forward<Args>(As)...);
+            case 6u:
+                return visit_case<functor_t, first + 6u, last>(
+                    std::forward<Args>(As)...);
+            case 7u:
+                return visit_case<functor_t, first + 7u, last>(
+                    std::forward<Args>(As)...);
+            default:
+                break;
+        }
+
+        // Continue with the next block of indices
+        if constexpr (first + k_switch_block < last) {
+            return visit_switch<functor_t, first + k_switch_block, last>(
+                idx, std::forward<Args>(As)...);
+        } else {
+            return no_match<visit_result_t<functor_t, Args...>>();
+        }
+    }
+
+    /// Calls the functor on the element that corresponds to @param idx in the
+    /// index range [@tparam first, @tparam last) by bisection of the range,
+    /// until it fits a single switch statement.
+    template <typename functor_t, std::size_t first, std::size_t last,
+              typename... Args>
+    DETRAY_HOST_DEVICE decltype(auto) visit_binary(const std::size_t idx,
+                                                   Args &&... As) const {
+        if constexpr (last - first <= k_switch_block) {
+            return visit_switch<functor_t, first, last>(
+                idx, std::forward<Args>(As)...);
+        } else {
+            constexpr std::size_t mid{first + (last - first) / 2u};
+
+            if (idx < mid) {
+                return visit_binary<functor_t, first, mid>(
+                    idx, std::forward<Args>(As)...);
+            }
+            return visit_binary<functor_t, mid, last>(
+                idx, std::forward<Args>(As)...);
         }
     }
 
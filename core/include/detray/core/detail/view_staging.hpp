@@ -0,0 +1,238 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace detray::detail {
+
+/// @brief Hands out the memory of a small staging area (e.g. the shared
+/// memory of a thread block) in the order of the requests.
+///
+/// An area without memory only counts the number of bytes that would be
+/// needed to stage the requested data (@see staging_size).
+class staging_area {
+
+    public:
+    /// Area that only counts the requested bytes
+    constexpr staging_area() = default;
+
+    /// Area of @param capacity bytes at @param data
+    DETRAY_HOST_DEVICE
+    staging_area(void *data, const std::size_t capacity)
+        : m_data{static_cast<std::byte *>(data)}, m_capacity{capacity} {}
+
+    /// @returns the capacity of the area in bytes
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t capacity() const { return m_capacity; }
+
+    /// @returns the number of bytes that were handed out (including padding)
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t size() const { return m_size; }
+
+    /// @returns true if the area only counts the requested bytes
+    DETRAY_HOST_DEVICE
+    constexpr bool is_counting() const { return m_data == nullptr; }
+
+    /// Reserve memory for @param n values of type @tparam T
+    ///
+    /// @returns a pointer to the reserved memory, or nullptr if the values do
+    /// not fit into the area (then nothing is reserved) or if the area only
+    /// counts the requested bytes
+    template <typename T>
+    DETRAY_HOST_DEVICE T *allocate(const std::size_t n) {
+        // The offsets are aligned relative to the start of the area
+        assert(reinterpret_cast<std::uintptr_t>(m_data) % alignof(T) == 0u);
+
+        const std::size_t offset{(m_size + alignof(T) - 1u) / alignof(T) *
+                                 alignof(T)};
+        const std::size_t n_bytes{n * sizeof(T)};
+
+        if (offset > m_capacity || n_bytes > m_capacity - offset) {
+            return nullptr;
+        }
+
+        m_size = offset + n_bytes;
+
+        return is_counting() ? nullptr
+                             : reinterpret_cast<T *>(m_data + offset);
+    }
+
+    private:
+    std::byte *m_data{nullptr};
+    std::size_t m_capacity{std::numeric_limits<std::size_t>::max()};
+    std::size_t m_size{0u};
+};
+
+/// @brief Copies a range of bytes with a group of threads.
+///
+/// Every thread of the group copies a strided share of 32 bit words, so that
+/// neighbouring threads access neighbouring addresses. The data is only
+/// complete after the threads of the group were synchronized.
+struct strided_copy {
+    /// Index of the calling thread in the group
+    unsigned int rank{0u};
+    /// Number of threads in the group
+    unsigned int n_threads{1u};
+
+    DETRAY_HOST_DEVICE
+    void operator()(void *dst, const void *src,
+                    const std::size_t n_bytes) const {
+        using word_t = std::uint32_t;
+
+        auto *dst_bytes = static_cast<std::byte *>(dst);
+        const auto *src_bytes = static_cast<const std::byte *>(src);
+
+        std::size_t n_words{0u};
+        if (reinterpret_cast<std::uintptr_t>(dst) % alignof(word_t) == 0u &&
+            reinterpret_cast<std::uintptr_t>(src) % alignof(word_t) == 0u) {
+            n_words = n_bytes / sizeof(word_t);
+
+            auto *dst_words = reinterpret_cast<word_t *>(dst);
+            const auto *src_words = reinterpret_cast<const word_t *>(src);
+            for (std::size_t i = rank; i < n_words; i += n_threads) {
+                dst_words[i] = src_words[i];
+            }
+        }
+
+        // Remainder (or unaligned data)
+        for (std::size_t i = n_words * sizeof(word_t) + rank; i < n_bytes;
+             i += n_threads) {
+            dst_bytes[i] = src_bytes[i];
+        }
+    }
+};
+
+/// Stage the data of a vector view
+///
+/// @param view the view on the original data
+/// @param area where to place the data
+/// @param cpy copies the data into the area (called as cpy(dst, src, n))
+///
+/// @returns a view on the staged data, or the original view, if it does not
+/// fit into the staging area. Resizable views are never staged.
+template <typename T, typename copy_t>
+DETRAY_HOST_DEVICE inline dvector_view<T> stage_view(
+    const dvector_view<T> &view, staging_area &area, const copy_t &cpy) {
+
+    // The size of a resizable view lives in device memory
+    if (view.size_ptr() != nullptr || view.capacity() == 0u) {
+        return view;
+    }
+
+    using value_t = std::remove_cv_t<T>;
+    static_assert(std::is_trivially_copyable_v<value_t>,
+                  "Only trivially copyable data can be staged");
+
+    value_t *staged = area.template allocate<value_t>(view.capacity());
+    if (staged == nullptr) {
+        return view;
+    }
+
+    cpy(staged, view.ptr(), view.capacity() * sizeof(value_t));
+
+    return dvector_view<T>{view.capacity(), staged};
+}
+
+/// Stage all vector views of an aggregate view in the order of its members
+template <typename... view_ts, typename copy_t>
+DETRAY_HOST_DEVICE inline dmulti_view<view_ts...> stage_view(
+    const dmulti_view<view_ts...> &view, staging_area &area,
+    const copy_t &cpy);
+
+/// Views that cannot be staged (e.g. jagged vector views) stay unchanged
+template <concepts::device_view view_t, typename copy_t>
+DETRAY_HOST_DEVICE inline view_t stage_view(const view_t &view, staging_area &,
+                                            const copy_t &) {
+    return view;
+}
+
+/// @cond
+template <typename... view_ts, typename copy_t, std::size_t... I>
+DETRAY_HOST_DEVICE inline dmulti_view<view_ts...> stage_multi_view(
+    const dmulti_view<view_ts...> &view, staging_area &area,
+    const copy_t &cpy, std::index_sequence<I...>) {
+
+    dmulti_view<view_ts...> staged{view};
+    ((detail::get<I>(staged.m_view) =
+          stage_view(detail::get<I>(view.m_view), area, cpy)),
+     ...);
+
+    return staged;
+}
+/// @endcond
+
+template <typename... view_ts, typename copy_t>
+DETRAY_HOST_DEVICE inline dmulti_view<view_ts...> stage_view(
+    const dmulti_view<view_ts...> &view, staging_area &area,
+    const copy_t &cpy) {
+    return stage_multi_view(view, area, cpy,
+                            std::make_index_sequence<sizeof...(view_ts)>{});
+}
+
+/// Stage the geometry of a detector view: Volume descriptors, surface
+/// descriptors, transforms and masks (in this order, for as long as they fit).
+///
+/// Small detectors (e.g. telescopes of a test-beam setup) fit entirely into
+/// the shared memory of a thread block, which is then used by the navigation
+/// instead of global memory. The material, the acceleration structures and
+/// the volume finder are not staged.
+///
+/// @note Every thread of the block has to stage the view with the same area,
+/// so that all threads obtain the same view. The threads have to be
+/// synchronized before the staged detector is accessed.
+///
+/// @param det_view the view on the detector in global memory
+/// @param area where to place the geometry
+/// @param cpy copies the data into the area (called as cpy(dst, src, n))
+///
+/// @returns the detector view on the staged geometry
+template <concepts::device_view detector_view_t, typename copy_t>
+DETRAY_HOST_DEVICE inline detector_view_t stage_detector_view(
+    const detector_view_t &det_view, staging_area &area, const copy_t &cpy) {
+
+    detector_view_t staged{det_view};
+
+    // Volumes, surfaces, transforms, masks
+    detail::get<0>(staged.m_view) =
+        stage_view(detail::get<0>(det_view.m_view), area, cpy);
+    detail::get<1>(staged.m_view) =
+        stage_view(detail::get<1>(det_view.m_view), area, cpy);
+    detail::get<2>(staged.m_view) =
+        stage_view(detail::get<2>(det_view.m_view), area, cpy);
+    detail::get<3>(staged.m_view) =
+        stage_view(detail::get<3>(det_view.m_view), area, cpy);
+
+    return staged;
+}
+
+/// @returns the number of bytes that are needed to stage the entire geometry
+/// of the detector view @param det_view (e.g. the dynamic shared memory size
+/// of the kernel launch)
+template <concepts::device_view detector_view_t>
+DETRAY_HOST_DEVICE inline std::size_t staging_size(
+    const detector_view_t &det_view) {
+
+    staging_area counter{};
+    stage_detector_view(det_view, counter,
+                        [](void *, const void *, std::size_t) {});
+
+    return counter.size();
+}
+
+}  // namespace detray::detail
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2024 CERN for the benefit of the ACTS project
+ * (c) 2021-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/builders/bvh_builder.hpp"
 #include "detray/builders/grid_builder.hpp"
 #include "detray/builders/homogeneous_material_builder.hpp"
 #include "detray/builders/homogeneous_volume_material_builder.hpp"
@@ -58,6 +59,10 @@ class detector {
 
     // Allow the building of the detector containers
     friend class volume_builder<detector<metadata_t, container_t>>;
+    template <typename, template <typename> class, template <typename...> class>
+    friend class detector_builder;
+    template <typename, typename>
+    friend class bvh_builder;
     template <typename, concepts::grid, typename, typename>
     friend class grid_builder;
     friend class homogeneous_material_builder<
@@ -68,6 +73,10 @@ class detector {
     friend class material_map_builder;
     template <typename>
     friend class volume_accelerator_builder;
+    template <typename>
+    friend class layout_optimizer;
+    template <typename>
+    friend class data_deduplicator;
     /// @todo Remove
     friend void
     detail::set_transform<detector<metadata_t, container_t>,
@@ -100,6 +109,9 @@ class detector {
     using surface_type = typename metadata::surface_type;
     using surface_container = vector_type<surface_type>;
     using surface_lookup_container = surface_lookup<surface_type, vector_type>;
+    /// Surface lookup of the detector (can differ from the builder lookup)
+    using surface_lookup_store =
+        typename detail::surface_lookup_selector<metadata, vector_type>::type;
 
     /// Forward the alignable transform container (surface placements) and
     /// the geo context (e.g. for alignment)
@@ -138,7 +150,7 @@ class detector {
     /// Detector view types
     /// @TODO: Switch to const_view_type always if possible
     using view_type = dmulti_view<dvector_view<volume_type>,
-                                  typename surface_lookup_container::view_type,
+                                  typename surface_lookup_store::view_type,
                                   typename transform_container::view_type,
                                   typename mask_container::view_type,
                                   typename material_container::view_type,
@@ -150,7 +162,7 @@ class detector {
 
     using const_view_type =
         dmulti_view<dvector_view<const volume_type>,
-                    typename surface_lookup_container::const_view_type,
+                    typename surface_lookup_store::const_view_type,
                     typename transform_container::const_view_type,
                     typename mask_container::const_view_type,
                     typename material_container::const_view_type,
@@ -163,7 +175,7 @@ class detector {
     /// Detector buffer types
     using buffer_type =
         dmulti_buffer<dvector_buffer<volume_type>,
-                      typename surface_lookup_container::buffer_type,
+                      typename surface_lookup_store::buffer_type,
                       typename transform_container::buffer_type,
                       typename mask_container::buffer_type,
                       typename material_container::buffer_type,
@@ -228,14 +240,19 @@ class detector {
     /// @return the volume by global cartesian @param position - const access
     DETRAY_HOST_DEVICE
     inline const auto &volume(const point3_type &p) const {
-        // The 3D cylindrical volume search grid is concentric
-        const transform3_type identity{};
-        const auto loc_pos =
-            _volume_finder.project(identity, p, identity.translation());
-
-        // Only one entry per bin
-        dindex volume_index{_volume_finder.search(loc_pos).value()};
-        return _volumes[volume_index];
+        if constexpr (concepts::grid<volume_finder>) {
+            // The 3D cylindrical volume search grid is concentric
+            const transform3_type identity{};
+            const auto loc_pos =
+                _volume_finder.project(identity, p, identity.translation());
+
+            // Only one entry per bin
+            dindex volume_index{_volume_finder.search(loc_pos).value()};
+            return _volumes[volume_index];
+        } else {
+            // The volume finder searches the global position directly
+            return _volumes[_volume_finder.search(p)];
+        }
     }
 
     /// @returns all portals - const
@@ -250,7 +267,7 @@ class detector {
 
     /// @return the sub-volumes of the detector - const access
     DETRAY_HOST_DEVICE
-    inline auto surfaces() const -> const surface_lookup_container & {
+    inline auto surfaces() const -> const surface_lookup_store & {
         return _surfaces;
     }
 
@@ -341,6 +358,45 @@ class detector {
         return ss.str();
     }
 
+    /// Sort the surfaces by their source links for a fast search by source
+    /// link (@see surface_lookup )
+    DETRAY_HOST
+    inline auto build_source_index() -> void {
+        _surfaces.build_source_index();
+    }
+
+    /// Add a geometry context (e.g. an alignment iteration), in which the
+    /// transforms in @param deltas replace the nominal ones
+    ///
+    /// @note A transform store that keeps only the transforms that differ per
+    /// context (@see delta_store ) expects pairs of index and transform. A
+    /// store that keeps all transforms per context (@see single_store )
+    /// expects all transforms of the new contexts and replaces the previous
+    /// contexts.
+    ///
+    /// @returns the new geometry context (the first one, if several contexts
+    /// were added at once)
+    template <typename deltas_t>
+    DETRAY_HOST inline auto add_geometry_context(deltas_t &&deltas)
+        -> geometry_context {
+        return _transforms.add_context(std::forward<deltas_t>(deltas));
+    }
+
+    /// Overwrite the transforms of the existing geometry context @param ctx
+    /// with @param trfs in place (e.g. a new alignment in a double buffered
+    /// context)
+    ///
+    /// @note requires a transform store that keeps all transforms per context
+    /// (@see single_store )
+    ///
+    /// @returns false if the context does not exist or the number of
+    /// transforms does not match
+    template <typename transforms_t>
+    DETRAY_HOST inline auto update_geometry_context(
+        const transforms_t &trfs, const geometry_context &ctx) -> bool {
+        return _transforms.update_context(trfs, ctx);
+    }
+
     /// Add the volume grid - move semantics
     ///
     /// @param v_grid the volume grid to be added
@@ -362,7 +418,7 @@ class detector {
     volume_container _volumes;
 
     /// Lookup for surfaces from barcodes
-    surface_lookup_container _surfaces;
+    surface_lookup_store _surfaces;
 
     /// Keeps all of the transform data in contiguous memory
     transform_container _transforms;
@@ -0,0 +1,139 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/alignment.hpp"
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <memory>
+#include <stdexcept>
+
+namespace detray {
+
+/// @brief Persistent copy of a host detector in (device) memory
+///
+/// The detector is copied once on construction. Copies of the handle share
+/// the same buffers (reference counted), so that a single upload can be used
+/// on multiple streams and for multiple events. The memory is released when
+/// the last handle that refers to it goes out of scope.
+///
+/// Alignment updates only copy the transforms: A handle that is created with
+/// @c with_transforms shares the static part of the detector (volumes,
+/// surfaces, masks, material and acceleration structures) with the handle it
+/// was created from.
+///
+/// @note The memory resource and the copy object have to outlive all handles
+template <typename detector_t>
+class device_detector_handle {
+
+    public:
+    using detector_type = detector_t;
+    using buffer_type = typename detector_t::buffer_type;
+    using view_type = typename detector_t::view_type;
+    using transform_container = typename detector_t::transform_container;
+    using transform_buffer_type = typename transform_container::buffer_type;
+
+    /// Copy the detector @param det into the memory resource @param mr using
+    /// the copy object @param cpy
+    DETRAY_HOST
+    device_detector_handle(detector_t &det, vecmem::memory_resource &mr,
+                           vecmem::copy &cpy,
+                           const detray::copy cpy_type = detray::copy::sync)
+        : m_mr{&mr},
+          m_copy{&cpy},
+          m_static{std::make_shared<buffer_type>(
+              detray::get_buffer(det, mr, cpy, cpy_type))} {}
+
+    /// @returns a handle that shares the static detector data with this
+    /// handle, but uses the transforms in @param trfs (e.g. for a different
+    /// geometry context)
+    DETRAY_HOST
+    device_detector_handle with_transforms(
+        transform_container &trfs,
+        const detray::copy cpy_type = detray::copy::sync) const {
+
+        check_size(trfs);
+
+        device_detector_handle handle{*this};
+        handle.m_transforms = std::make_shared<transform_buffer_type>(
+            detray::get_buffer(trfs, *m_mr, *m_copy, cpy_type));
+
+        return handle;
+    }
+
+    /// Overwrite the transforms that this handle uses with @param trfs,
+    /// without reallocating any memory
+    ///
+    /// @note The update is seen by all handles that share the transforms with
+    /// this handle. No kernel that uses one of their views may be running.
+    DETRAY_HOST
+    void update_transforms(const transform_container &trfs,
+                           const detray::copy cpy_type = detray::copy::sync) {
+
+        check_size(trfs);
+
+        auto event = (*m_copy)(detray::get_data(trfs), transform_buffer());
+        if (cpy_type == detray::copy::async) {
+            event->ignore();
+        } else {
+            event->wait();
+        }
+    }
+
+    /// @returns the view of the detector to be passed to a kernel
+    DETRAY_HOST
+    view_type view() const {
+        if (m_transforms) {
+            return detail::misaligned_detector_view<detector_t>(*m_static,
+                                                                *m_transforms);
+        }
+        return detray::get_data(*m_static);
+    }
+
+    /// @returns whether the handle uses its own transforms
+    DETRAY_HOST
+    bool has_own_transforms() const { return m_transforms != nullptr; }
+
+    /// @returns the number of handles that share the static detector data
+    DETRAY_HOST
+    long use_count() const { return m_static.use_count(); }
+
+    private:
+    /// @returns the transform buffer that this handle uses
+    DETRAY_HOST
+    transform_buffer_type &transform_buffer() const {
+        return m_transforms ? *m_transforms
+                            : detail::get<2>(m_static->m_buffer);
+    }
+
+    /// Check that the transforms @param trfs fit the detector
+    DETRAY_HOST
+    void check_size(const transform_container &trfs) const {
+        if (detray::get_data(trfs).size() != transform_buffer().size()) {
+            throw std::invalid_argument(
+                "Number of transforms does not match the detector");
+        }
+    }
+
+    /// Memory resource and copy object the detector was copied with
+    vecmem::memory_resource *m_mr{nullptr};
+    vecmem::copy *m_copy{nullptr};
+    /// The detector data (including the nominal transforms)
+    std::shared_ptr<buffer_type> m_static{};
+    /// Transforms that replace the nominal ones, if set
+    std::shared_ptr<transform_buffer_type> m_transforms{};
+};
+
+}  // namespace detray
@@ -74,3 +74,6 @@ using namespace algebra::concepts;
 }  // namespace concepts
 
 }  // namespace detray
+
+// Fixed-size matrix kernels of the track parameter transport
+#include "detray/definitions/detail/matrix_kernels.hpp"
@@ -0,0 +1,132 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <utility>
+
+// Included by "detray/definitions/algebra.hpp" after the algebra plugin
+// definitions: Expects @c getter::element to be declared
+
+namespace detray::matrix {
+
+namespace detail {
+
+/// @returns the element ( @param i, @param j ) of the product A * B, with the
+/// sum over the inner dimension unrolled at compile time
+template <typename lhs_t, typename rhs_t, std::size_t... K>
+DETRAY_HOST_DEVICE constexpr auto unrolled_dot(const lhs_t& A, const rhs_t& B,
+                                               const std::size_t i,
+                                               const std::size_t j,
+                                               std::index_sequence<K...>) {
+    return (... + (getter::element(A, i, K) * getter::element(B, K, j)));
+}
+
+/// Fill the column @param j of @param out with the product A * B
+template <std::size_t n_inner, typename out_t, typename lhs_t,
+          typename rhs_t, std::size_t... I>
+DETRAY_HOST_DEVICE constexpr void unrolled_column(out_t& out, const lhs_t& A,
+                                                  const rhs_t& B,
+                                                  const std::size_t j,
+                                                  std::index_sequence<I...>) {
+    ((getter::element(out, I, j) =
+          unrolled_dot(A, B, I, j, std::make_index_sequence<n_inner>{})),
+     ...);
+}
+
+/// Fill all columns of @param out with the product A * B
+template <std::size_t n_rows, std::size_t n_inner, typename out_t,
+          typename lhs_t, typename rhs_t, std::size_t... J>
+DETRAY_HOST_DEVICE constexpr void unrolled_product(out_t& out, const lhs_t& A,
+                                                   const rhs_t& B,
+                                                   std::index_sequence<J...>) {
+    (unrolled_column<n_inner>(out, A, B, J, std::make_index_sequence<n_rows>{}),
+     ...);
+}
+
+}  // namespace detail
+
+/// @brief Fully unrolled product of fixed-size matrices.
+///
+/// Computes @param out = A * B for a ROWS x INNER matrix @param A and an
+/// INNER x COLS matrix @param B . All loops are unrolled at compile time and
+/// every element is a single chain of multiply-adds, which the compiler can
+/// contract into FMA instructions. Meant for the small shapes of the track
+/// parameter transport, where the loop overhead of the generic plugin
+/// products is not negligible.
+template <std::size_t ROWS, std::size_t INNER, std::size_t COLS,
+          typename out_t, typename lhs_t, typename rhs_t>
+DETRAY_HOST_DEVICE constexpr void fixed_size_multiply(const lhs_t& A,
+                                                      const rhs_t& B,
+                                                      out_t& out) {
+    detail::unrolled_product<ROWS, INNER>(out, A, B,
+                                          std::make_index_sequence<COLS>{});
+}
+
+/// @returns the product of the 8x8 (free) matrices @param A and @param B ,
+/// e.g. of the step jacobian and the accumulated transport jacobian
+template <typename matrix_t>
+DETRAY_HOST_DEVICE constexpr matrix_t multiply_8x8(const matrix_t& A,
+                                                   const matrix_t& B) {
+#if DETRAY_ALGEBRA_VC_AOS
+    // The plugin product is computed column-wise on SIMD registers already
+    return A * B;
+#else
+    matrix_t out{};
+    fixed_size_multiply<8u, 8u, 8u>(A, B, out);
+    return out;
+#endif
+}
+
+/// @returns the product of the 6x6 (bound) matrices @param A and @param B
+template <typename matrix_t>
+DETRAY_HOST_DEVICE constexpr matrix_t multiply_6x6(const matrix_t& A,
+                                                   const matrix_t& B) {
+#if DETRAY_ALGEBRA_VC_AOS
+    // The plugin product is computed column-wise on SIMD registers already
+    return A * B;
+#else
+    matrix_t out{};
+    fixed_size_multiply<6u, 6u, 6u>(A, B, out);
+    return out;
+#endif
+}
+
+/// @returns the similarity transform J * C * J^T of the 6x6 (bound)
+/// covariance @param C with the jacobian @param J
+///
+/// Only the upper triangle of the result is computed, the lower triangle is
+/// mirrored.
+template <typename matrix_t>
+DETRAY_HOST_DEVICE constexpr matrix_t similarity_6x6(const matrix_t& J,
+                                                     const matrix_t& C) {
+    constexpr std::size_t dim{6u};
+
+    const matrix_t T = multiply_6x6(J, C);
+
+    matrix_t out{};
+    for (std::size_t i = 0u; i < dim; ++i) {
+        for (std::size_t j = i; j < dim; ++j) {
+            // Row i of T times row j of J
+            auto sum = getter::element(T, i, 0u) * getter::element(J, j, 0u);
+            for (std::size_t k = 1u; k < dim; ++k) {
+                sum += getter::element(T, i, k) * getter::element(J, j, k);
+            }
+            getter::element(out, i, j) = sum;
+            getter::element(out, j, i) = sum;
+        }
+    }
+
+    return out;
+}
+
+}  // namespace detray::matrix
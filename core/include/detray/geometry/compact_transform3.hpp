@@ -0,0 +1,201 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <concepts>
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Compact placement transform of a rigid body
+///
+/// Holds the inverse (global to local) transform as a 3x4 matrix, followed by
+/// the translation of the forward transform. The rows of the inverse rotation
+/// are the local axes in global coordinates, so that both directions of the
+/// transformation can be done without a second matrix: A conversion to the
+/// local frame is one row-wise dot product per coordinate and a conversion to
+/// the global frame is a linear combination of the rows.
+///
+/// The four rows of the layout are aligned for vector loads. In single
+/// precision, the transform fits into one cache line, which is half the memory
+/// of the algebra transform that stores the full matrix and its inverse.
+///
+/// The entries can be stored in a different precision than the algebra
+/// computes in (e.g. float storage for a double precision propagation). They
+/// are converted to the algebra scalar type when they are loaded.
+///
+/// @note Can be used as the value type of the transform store of a detector.
+/// Wherever the algebra transform type is required (e.g. for the jacobians),
+/// it is constructed on the fly.
+///
+/// @tparam algebra_t the algebra the transform computes with
+/// @tparam storage_t the scalar type the entries are stored in
+template <algebra::concepts::aos algebra_t,
+          std::floating_point storage_t = dscalar<algebra_t>>
+class compact_transform3 {
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using storage_type = storage_t;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+
+    /// Identity transform
+    constexpr compact_transform3() = default;
+
+    /// Construct from the translation @param t and the local z- and x-axis
+    /// @param z and @param x in global coordinates
+    DETRAY_HOST_DEVICE
+    compact_transform3(const vector3_type &t, const vector3_type &z,
+                       const vector3_type &x, const bool normalize = true) {
+        const vector3_type z_axis{normalize ? vector::normalize(z) : z};
+        const vector3_type x_axis{normalize ? vector::normalize(x) : x};
+
+        set(t, x_axis, vector::cross(z_axis, x_axis), z_axis);
+    }
+
+    /// Construct a translation @param t
+    DETRAY_HOST_DEVICE
+    explicit compact_transform3(const vector3_type &t) {
+        set(t, {1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}, {0.f, 0.f, 1.f});
+    }
+
+    /// Construct from the algebra transform @param trf
+    ///
+    /// @note not explicit, so that the builders can fill a store of compact
+    /// transforms with the algebra transforms
+    DETRAY_HOST_DEVICE
+    compact_transform3(const transform3_type &trf) {  // NOLINT
+        set(trf.translation(), trf.x(), trf.y(), trf.z());
+    }
+
+    /// @returns the algebra transform (also computes the inverse matrix)
+    DETRAY_HOST_DEVICE
+    operator transform3_type() const {  // NOLINT
+        return transform3_type{translation(), z(), x()};
+    }
+
+    /// @returns the local x-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type x() const { return row(0u); }
+
+    /// @returns the local y-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type y() const { return row(1u); }
+
+    /// @returns the local z-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type z() const { return row(2u); }
+
+    /// @returns the translation of the forward transform
+    DETRAY_HOST_DEVICE
+    constexpr point3_type translation() const { return row(3u); }
+
+    /// Transform the point @param p from the global to the local frame
+    DETRAY_HOST_DEVICE
+    constexpr point3_type point_to_local(const point3_type &p) const {
+        return {dot_row(0u, p) + value(3u), dot_row(1u, p) + value(7u),
+                dot_row(2u, p) + value(11u)};
+    }
+
+    /// Transform the vector @param v from the global to the local frame
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type vector_to_local(const vector3_type &v) const {
+        return {dot_row(0u, v), dot_row(1u, v), dot_row(2u, v)};
+    }
+
+    /// Transform the point @param p from the local to the global frame
+    DETRAY_HOST_DEVICE
+    constexpr point3_type point_to_global(const point3_type &p) const {
+        return {combine_rows(0u, p) + value(12u),
+                combine_rows(1u, p) + value(13u),
+                combine_rows(2u, p) + value(14u)};
+    }
+
+    /// Transform the vector @param v from the local to the global frame
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type vector_to_global(const vector3_type &v) const {
+        return {combine_rows(0u, v), combine_rows(1u, v), combine_rows(2u, v)};
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const compact_transform3 &rhs) const {
+        for (std::size_t i = 0u; i < 16u; ++i) {
+            if (m_data[i] != rhs.m_data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private:
+    /// Fill the layout from the translation @param t and the local axes
+    /// @param x, @param y and @param z
+    DETRAY_HOST_DEVICE
+    constexpr void set(const vector3_type &t, const vector3_type &x,
+                       const vector3_type &y, const vector3_type &z) {
+        const darray<vector3_type, 3u> axes{x, y, z};
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            m_data[4u * i] = static_cast<storage_t>(axes[i][0]);
+            m_data[4u * i + 1u] = static_cast<storage_t>(axes[i][1]);
+            m_data[4u * i + 2u] = static_cast<storage_t>(axes[i][2]);
+            // Translation of the inverse transform: -R^T * t
+            m_data[4u * i + 3u] =
+                static_cast<storage_t>(-vector::dot(axes[i], t));
+        }
+        m_data[12u] = static_cast<storage_t>(t[0]);
+        m_data[13u] = static_cast<storage_t>(t[1]);
+        m_data[14u] = static_cast<storage_t>(t[2]);
+        m_data[15u] = 0.f;
+    }
+
+    /// @returns the entry @param i converted to the algebra scalar type
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type value(const std::size_t i) const {
+        return static_cast<scalar_type>(m_data[i]);
+    }
+
+    /// @returns the first three entries of row @param i
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type row(const std::size_t i) const {
+        return {value(4u * i), value(4u * i + 1u), value(4u * i + 2u)};
+    }
+
+    /// @returns the dot product of row @param i of the inverse rotation with
+    /// the vector @param v
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type dot_row(const std::size_t i,
+                                  const vector3_type &v) const {
+        return value(4u * i) * v[0] + value(4u * i + 1u) * v[1] +
+               value(4u * i + 2u) * v[2];
+    }
+
+    /// @returns coordinate @param j of the rows of the inverse rotation
+    /// combined with the coefficients in @param v
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type combine_rows(const std::size_t j,
+                                       const vector3_type &v) const {
+        return value(j) * v[0] + value(4u + j) * v[1] + value(8u + j) * v[2];
+    }
+
+    /// Inverse rotation and translation (3x4), forward translation (1x4)
+    alignas(4u * sizeof(storage_t)) darray<storage_t, 16u> m_data{
+        1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f,
+        0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+};
+
+}  // namespace detray
@@ -29,8 +29,9 @@ struct cartesian3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cartesian point
+    template <typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3D_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type &dir) {
         return cartesian3D<algebra_t>::global_to_local(trf, p, dir);
@@ -38,8 +39,9 @@ struct cartesian3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cartesian point
+    template <typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3D_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         return trf.point_to_local(p);
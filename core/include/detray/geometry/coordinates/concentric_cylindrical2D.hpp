@@ -11,6 +11,10 @@
 #include "detray/definitions/algebra.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/math.hpp"
+#include "detray/utils/fast_math.hpp"
+
+// System include(s)
+#include <type_traits>
 
 namespace detray {
 
@@ -31,17 +35,36 @@ struct concentric_cylindrical2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D cylindrical point
+    ///
+    /// @tparam with_phi whether to compute the phi coordinate (set to zero
+    ///                  otherwise)
+    template <bool with_phi = true, typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(
-        const transform3_type & /*trf*/, const point3_type &p,
-        const vector3_type & /*dir*/) {
-        return {vector::phi(p), p[2], vector::perp(p)};
+    static inline point3_type global_to_local_3D(const transform3D_t & /*trf*/,
+                                                 const point3_type &p,
+                                                 const vector3_type & /*dir*/) {
+        if constexpr (with_phi) {
+            return {vector::phi(p), p[2], vector::perp(p)};
+        } else {
+            return {scalar_type{0.f}, p[2], vector::perp(p)};
+        }
+    }
+
+    /// Same as @c global_to_local_3D , but with an approximate phi in single
+    /// precision (see @c detail::fast_atan2 )
+    template <typename transform3D_t>
+    requires std::is_arithmetic_v<scalar_type> DETRAY_HOST_DEVICE
+        static inline point3_type approx_global_to_local_3D(
+            const transform3D_t &/*trf*/, const point3_type &p,
+            const vector3_type & /*dir*/) {
+        return {detail::fast_phi(p), p[2], vector::perp(p)};
     }
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 2D cylindrical point
+    template <typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type & /*trf*/,
+    static inline loc_point global_to_local(const transform3D_t & /*trf*/,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         return {vector::phi(p), p[2]};
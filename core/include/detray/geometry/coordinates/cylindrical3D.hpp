@@ -30,8 +30,9 @@ struct cylindrical3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cylindrical point
+    template <typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3D_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type &dir) {
         return cylindrical3D<algebra_t>::global_to_local(trf, p, dir);
@@ -39,8 +40,9 @@ struct cylindrical3D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D cylindrical point
+    template <typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3D_t &trf,
                                             const point3_type &p,
                                             const vector3_type & /*dir*/) {
         const auto local3 = trf.point_to_local(p);
@@ -30,8 +30,12 @@ struct line2D {
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D line point
+    ///
+    /// @tparam with_phi whether to compute the phi coordinate (set to zero
+    ///                  otherwise)
+    template <bool with_phi = true, typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline point3_type global_to_local_3D(const transform3_type &trf,
+    static inline point3_type global_to_local_3D(const transform3D_t &trf,
                                                  const point3_type &p,
                                                  const vector3_type &dir) {
 
@@ -51,13 +55,19 @@ struct line2D {
         // Left: 1
         const scalar_type sign = vector::dot(r, t - p) > 0.f ? -1.f : 1.f;
 
-        return {sign * vector::perp(local3), local3[2], vector::phi(local3)};
+        if constexpr (with_phi) {
+            return {sign * vector::perp(local3), local3[2],
+                    vector::phi(local3)};
+        } else {
+            return {sign * vector::perp(local3), local3[2], scalar_type{0.f}};
+        }
     }
 
     /// This method transforms a point from a global cartesian 3D frame to a
     /// local 3D line point
+    template <typename transform3D_t>
     DETRAY_HOST_DEVICE
-    static inline loc_point global_to_local(const transform3_type &trf,
+    static inline loc_point global_to_local(const transform3D_t &trf,
                                             const point3_type &p,
                                             const vector3_type &dir) {
 
@@ -10,6 +10,9 @@
 // Project include(s)
 #include "detray/definitions/algebra.hpp"
 
+// System include(s)
+#include <type_traits>
+
 namespace detray::detail {
 
 /// Generate phi tolerance from distance tolerance
@@ -20,8 +23,23 @@ namespace detray::detail {
 /// @return the opening angle of a chord the size of tol (= 2*arcsin(c/(2r)))
 /// using a small angle approximation
 template <concepts::scalar scalar_t>
-constexpr scalar_t phi_tolerance(scalar_t tol, scalar_t radius) {
+requires std::is_arithmetic_v<scalar_t> constexpr scalar_t phi_tolerance(
+    scalar_t tol, scalar_t radius) {
     return radius > 0.f ? tol / radius : tol;
 }
 
+/// Generate phi tolerance from distance tolerance - SIMD
+///
+/// @param tol is the distance tolerance in mm per lane
+/// @param radius is the radius of the shape per lane
+///
+/// @return the opening angle of a chord the size of tol per lane
+template <concepts::scalar scalar_t>
+requires(!std::is_arithmetic_v<scalar_t>) constexpr scalar_t
+    phi_tolerance(const scalar_t &tol, const scalar_t &radius) {
+    scalar_t phi_tol{tol / radius};
+    phi_tol(radius <= 0.f) = tol;
+    return phi_tol;
+}
+
 }  // namespace detray::detail
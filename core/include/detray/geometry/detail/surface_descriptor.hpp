@@ -118,6 +118,12 @@ class surface_descriptor {
         m_barcode.set_transform(transform() + offset);
     }
 
+    /// Sets a new transform index @param new_idx
+    DETRAY_HOST
+    auto set_transform(const dindex new_idx) -> void {
+        m_barcode.set_transform(new_idx);
+    }
+
     /// @return the transform index
     DETRAY_HOST_DEVICE
     constexpr auto transform() const -> dindex { return m_barcode.transform(); }
@@ -128,6 +134,10 @@ class surface_descriptor {
     DETRAY_HOST
     auto update_mask(dindex offset) -> void { m_mask += offset; }
 
+    /// Sets a new mask link @param link
+    DETRAY_HOST
+    auto set_mask(const mask_link &link) -> void { m_mask = link; }
+
     /// @return the mask link
     DETRAY_HOST_DEVICE
     constexpr auto mask() const -> const mask_link & { return m_mask; }
@@ -68,6 +68,30 @@ class volume_descriptor {
     /// @param id id values that determines how to interpret the bounds.
     explicit constexpr volume_descriptor(const volume_id id) : m_id{id} {}
 
+    /// Constructor from the links that are needed to search the volume for
+    /// navigation candidates, e.g. from a packed record of a portal.
+    ///
+    /// @note Only the portal range is set among the surface ranges.
+    ///
+    /// @param id shape id of the volume
+    /// @param index index of the volume in the detector volume container
+    /// @param trf_idx index of the volume transform in the transform store
+    /// @param pt_range range of the portals in the surface lookup
+    /// @param mat_link link to the volume material
+    /// @param accel_links links to the acceleration data structures
+    DETRAY_HOST_DEVICE
+    constexpr volume_descriptor(
+        const volume_id id, const dindex index, const dindex trf_idx,
+        const typename sf_link_type::index_type& pt_range,
+        const material_link& mat_link, const accel_link_type& accel_links)
+        : m_id{id},
+          m_index{index},
+          m_transform{trf_idx},
+          m_mat_link{mat_link},
+          m_accel_links{accel_links} {
+        sf_link<surface_id::e_portal>() = pt_range;
+    }
+
     /// @returns the volume shape id, e.g. 'cylinder'
     DETRAY_HOST_DEVICE
     constexpr auto id() const -> volume_id { return m_id; }
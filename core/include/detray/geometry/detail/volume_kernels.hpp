@@ -14,6 +14,10 @@
 #include "detray/materials/detail/concepts.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/material.hpp"
+#include "detray/navigation/accelerators/search_buffer.hpp"
+
+// System include(s)
+#include <type_traits>
 
 namespace detray::detail {
 
@@ -43,6 +47,17 @@ struct get_material_params {
     }
 };
 
+/// A functor to check whether the volume material is homogeneous (i.e. does
+/// not depend on the position in the volume)
+struct is_homogeneous_material {
+    template <typename mat_group_t, typename index_t>
+    DETRAY_HOST_DEVICE constexpr bool operator()(
+        const mat_group_t & /*mat_group*/, const index_t & /*idx*/) const {
+        return concepts::homogeneous_material<
+            typename mat_group_t::value_type>;
+    }
+};
+
 /// A functor to access the surfaces of a volume
 template <typename functor_t>
 struct surface_getter {
@@ -79,9 +94,38 @@ struct neighborhood_getter {
 
         decltype(auto) accel = group[index];
 
+        // Let the accelerator write the surface indices to a flat buffer
+        // instead of iterating the (joined) range views of the search
+        if constexpr (requires { cfg.use_search_buffer; } &&
+                      requires(search_buffer<> &buffer) {
+                          accel.search_into(det, volume, track, cfg, ctx,
+                                            buffer);
+                      }) {
+            if (cfg.use_search_buffer) {
+                search_buffer<> buffer;
+                accel.search_into(det, volume, track, cfg, ctx, buffer);
+
+                // Fall back to the range search, if surfaces were dropped
+                if (!buffer.overflow()) {
+                    for (const dindex sf_idx : buffer) {
+                        functor_t{}(det.surface(sf_idx),
+                                    std::forward<Args>(args)...);
+                    }
+                    return;
+                }
+            }
+        }
+
         // Run over the surfaces in a single acceleration data structure
         for (const auto &sf : accel.search(det, volume, track, cfg, ctx)) {
-            functor_t{}(sf, std::forward<Args>(args)...);
+            using entry_t = std::remove_cvref_t<decltype(sf)>;
+
+            // Index based accelerators only hold the surface indices
+            if constexpr (std::is_integral_v<entry_t>) {
+                functor_t{}(det.surface(sf), std::forward<Args>(args)...);
+            } else {
+                functor_t{}(sf, std::forward<Args>(args)...);
+            }
         }
     }
 };
@@ -17,6 +17,7 @@
 // System include(s)
 #include <algorithm>
 #include <cassert>
+#include <concepts>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -62,13 +63,17 @@ class mask {
     template <typename... Args>
     requires(sizeof...(Args) == shape::boundaries::e_size) DETRAY_HOST_DEVICE
         explicit constexpr mask(const links_type& link, Args&&... args)
-        : _values({{std::forward<Args>(args)...}}), _volume_link(link) {}
+        : _values({{std::forward<Args>(args)...}}), _volume_link(link) {
+        set_derived_values();
+    }
 
     /// Constructor from mask boundary array @param values and
     /// volume link @param link
     DETRAY_HOST_DEVICE
     constexpr mask(const mask_values& values, const links_type& link)
-        : _values{values}, _volume_link{link} {}
+        : _values{values}, _volume_link{link} {
+        set_derived_values();
+    }
 
     /// Constructor from mask boundary vector @param values and
     /// volume link @param link
@@ -79,6 +84,7 @@ class mask {
                " Given number of boundaries does not match mask shape.");
         std::ranges::copy(std::cbegin(values), std::cend(values),
                           std::begin(_values));
+        set_derived_values();
     }
 
     /// Assignment operator from an array, convenience function
@@ -88,6 +94,7 @@ class mask {
     auto operator=(const mask_values& rhs)
         -> mask<shape_t, algebra_t, links_t>& {
         _values = rhs;
+        set_derived_values();
         return (*this);
     }
 
@@ -124,12 +131,35 @@ class mask {
         return local_frame{};
     }
 
+    /// Whether the boundary check of the shape needs the local phi coordinate
+    static constexpr bool check_uses_phi{[]() {
+        if constexpr (requires { shape::check_uses_phi; }) {
+            return shape::check_uses_phi;
+        } else {
+            return true;
+        }
+    }()};
+
     /// @returns the global point projected onto the surface
-    template <typename transform3D_t>
+    ///
+    /// @tparam check_only only compute the local coordinates that are needed
+    ///                    by the boundary check (e.g. no phi coordinate on
+    ///                    cylinders and rings, which is then set to zero)
+    template <bool check_only = false, typename transform3D_t>
     DETRAY_HOST_DEVICE inline static auto to_local_frame(
         const transform3D_t& trf, const point3_type& glob_p,
         const point3_type& glob_dir = {}) -> point3_type {
-        return get_local_frame().global_to_local_3D(trf, glob_p, glob_dir);
+        if constexpr (check_only && !check_uses_phi &&
+                      requires {
+                          local_frame::template global_to_local_3D<false>(
+                              trf, glob_p, glob_dir);
+                      }) {
+            return local_frame::template global_to_local_3D<false>(
+                trf, glob_p, glob_dir);
+        } else {
+            return get_local_frame().global_to_local_3D(trf, glob_p,
+                                                        glob_dir);
+        }
     }
 
     /// @returns the global point for a local position on the surface
@@ -161,6 +191,23 @@ class mask {
         return get_shape().check_boundaries(_values, loc_p, t);
     }
 
+    /// @brief Mask this shape onto several local points at once.
+    ///
+    /// @note Needs a shape that supports SIMD points against scalar bounds
+    /// (@c rectangle2D, @c trapezoid2D, @c ring2D and @c annulus2D )
+    ///
+    /// @param loc_p the points to be checked in the local system, given as a
+    ///              point of an SoA algebra (one point per SIMD lane)
+    /// @param tol dynamic tolerance determined by caller (per SIMD lane)
+    ///
+    /// @return the intersection status of every lane as a SIMD mask
+    template <concepts::point point_t, concepts::scalar tol_t>
+    requires(!std::same_as<point_t, point3_type>) DETRAY_HOST_DEVICE
+        inline auto is_inside(const point_t& loc_p, const tol_t& tol) const {
+
+        return get_shape().check_boundaries(_values, loc_p, tol);
+    }
+
     /// @returns the boundary values
     DETRAY_HOST_DEVICE
     auto values() const -> const mask_values& { return _values; }
@@ -270,6 +317,17 @@ class mask {
     }
 
     private:
+    /// Let the shape compute the values that it derives from the boundary
+    /// values (if any), so that they are not recomputed in every check
+    DETRAY_HOST_DEVICE
+    constexpr void set_derived_values() {
+        if constexpr (requires(const shape& sh, mask_values& v) {
+                          sh.set_derived_values(v);
+                      }) {
+            get_shape().set_derived_values(_values);
+        }
+    }
+
     mask_values _values{};
     links_type _volume_link{std::numeric_limits<links_type>::max()};
 };
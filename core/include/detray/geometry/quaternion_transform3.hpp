@@ -0,0 +1,269 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+
+// System include(s)
+#include <concepts>
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Placement transform of a rigid body that stores the rotation as a
+/// unit quaternion
+///
+/// Holds the quaternion (x, y, z, w) of the forward (local to global) rotation,
+/// followed by the translation. In single precision, the transform needs 32
+/// bytes, which is half of the @c compact_transform3 and a quarter of the
+/// algebra transform. The rotation is not stored as a matrix: It is applied
+/// directly with the quaternion, and the rotation matrix is only reconstructed
+/// where it is needed (the axes or the conversion to the algebra transform).
+/// This trades a few extra multiplications per conversion for less memory
+/// traffic when many surfaces are visited.
+///
+/// Like for the @c compact_transform3 , the entries can be stored in a
+/// different precision than the algebra computes in.
+///
+/// @note Can be used as the value type of the transform store of a detector.
+/// The quaternion is normalized on construction and kept in the hemisphere
+/// w >= 0, so that equal rotations compare equal.
+///
+/// @tparam algebra_t the algebra the transform computes with
+/// @tparam storage_t the scalar type the entries are stored in
+template <algebra::concepts::aos algebra_t,
+          std::floating_point storage_t = dscalar<algebra_t>>
+class quaternion_transform3 {
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using storage_type = storage_t;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+
+    /// Identity transform
+    constexpr quaternion_transform3() = default;
+
+    /// Construct from the translation @param t and the local z- and x-axis
+    /// @param z and @param x in global coordinates
+    DETRAY_HOST_DEVICE
+    quaternion_transform3(const vector3_type &t, const vector3_type &z,
+                          const vector3_type &x, const bool normalize = true) {
+        const vector3_type z_axis{normalize ? vector::normalize(z) : z};
+        const vector3_type x_axis{normalize ? vector::normalize(x) : x};
+
+        set(t, x_axis, vector::cross(z_axis, x_axis), z_axis);
+    }
+
+    /// Construct a translation @param t
+    DETRAY_HOST_DEVICE
+    explicit quaternion_transform3(const vector3_type &t) {
+        set_translation(t);
+    }
+
+    /// Construct from the algebra transform @param trf
+    ///
+    /// @note not explicit, so that the builders can fill a store of
+    /// quaternion transforms with the algebra transforms
+    DETRAY_HOST_DEVICE
+    quaternion_transform3(const transform3_type &trf) {  // NOLINT
+        set(trf.translation(), trf.x(), trf.y(), trf.z());
+    }
+
+    /// @returns the algebra transform (also computes the inverse matrix)
+    DETRAY_HOST_DEVICE
+    operator transform3_type() const {  // NOLINT
+        return transform3_type{translation(), z(), x()};
+    }
+
+    /// @returns the local x-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type x() const {
+        const scalar_type qx{value(0u)};
+        const scalar_type qy{value(1u)};
+        const scalar_type qz{value(2u)};
+        const scalar_type qw{value(3u)};
+
+        return {1.f - 2.f * (qy * qy + qz * qz), 2.f * (qx * qy + qw * qz),
+                2.f * (qx * qz - qw * qy)};
+    }
+
+    /// @returns the local y-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type y() const {
+        const scalar_type qx{value(0u)};
+        const scalar_type qy{value(1u)};
+        const scalar_type qz{value(2u)};
+        const scalar_type qw{value(3u)};
+
+        return {2.f * (qx * qy - qw * qz), 1.f - 2.f * (qx * qx + qz * qz),
+                2.f * (qy * qz + qw * qx)};
+    }
+
+    /// @returns the local z-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type z() const {
+        const scalar_type qx{value(0u)};
+        const scalar_type qy{value(1u)};
+        const scalar_type qz{value(2u)};
+        const scalar_type qw{value(3u)};
+
+        return {2.f * (qx * qz + qw * qy), 2.f * (qy * qz - qw * qx),
+                1.f - 2.f * (qx * qx + qy * qy)};
+    }
+
+    /// @returns the translation
+    DETRAY_HOST_DEVICE
+    constexpr point3_type translation() const {
+        return {value(4u), value(5u), value(6u)};
+    }
+
+    /// @returns the unit quaternion of the rotation as (x, y, z, w)
+    DETRAY_HOST_DEVICE
+    constexpr darray<scalar_type, 4u> quaternion() const {
+        return {value(0u), value(1u), value(2u), value(3u)};
+    }
+
+    /// Transform the point @param p from the global to the local frame
+    DETRAY_HOST_DEVICE
+    constexpr point3_type point_to_local(const point3_type &p) const {
+        return rotate(p - translation(), -1.f);
+    }
+
+    /// Transform the vector @param v from the global to the local frame
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type vector_to_local(const vector3_type &v) const {
+        return rotate(v, -1.f);
+    }
+
+    /// Transform the point @param p from the local to the global frame
+    DETRAY_HOST_DEVICE
+    constexpr point3_type point_to_global(const point3_type &p) const {
+        return rotate(p, 1.f) + translation();
+    }
+
+    /// Transform the vector @param v from the local to the global frame
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type vector_to_global(const vector3_type &v) const {
+        return rotate(v, 1.f);
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const quaternion_transform3 &rhs) const {
+        for (std::size_t i = 0u; i < 8u; ++i) {
+            if (m_data[i] != rhs.m_data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private:
+    /// Fill the layout from the translation @param t and the local axes
+    /// @param x, @param y and @param z (the columns of the rotation matrix)
+    ///
+    /// Uses the largest of the four possible pivots for numerical stability
+    DETRAY_HOST_DEVICE
+    constexpr void set(const vector3_type &t, const vector3_type &x,
+                       const vector3_type &y, const vector3_type &z) {
+        // Matrix element m_ij is component i of the axis j
+        const scalar_type trace{x[0] + y[1] + z[2]};
+
+        scalar_type qx{0.f};
+        scalar_type qy{0.f};
+        scalar_type qz{0.f};
+        scalar_type qw{1.f};
+
+        if (trace > 0.f) {
+            const scalar_type s{2.f * math::sqrt(trace + 1.f)};
+            qw = 0.25f * s;
+            qx = (y[2] - z[1]) / s;
+            qy = (z[0] - x[2]) / s;
+            qz = (x[1] - y[0]) / s;
+        } else if (x[0] > y[1] && x[0] > z[2]) {
+            const scalar_type s{2.f * math::sqrt(1.f + x[0] - y[1] - z[2])};
+            qw = (y[2] - z[1]) / s;
+            qx = 0.25f * s;
+            qy = (y[0] + x[1]) / s;
+            qz = (z[0] + x[2]) / s;
+        } else if (y[1] > z[2]) {
+            const scalar_type s{2.f * math::sqrt(1.f + y[1] - x[0] - z[2])};
+            qw = (z[0] - x[2]) / s;
+            qx = (y[0] + x[1]) / s;
+            qy = 0.25f * s;
+            qz = (z[1] + y[2]) / s;
+        } else {
+            const scalar_type s{2.f * math::sqrt(1.f + z[2] - x[0] - y[1])};
+            qw = (x[1] - y[0]) / s;
+            qx = (z[0] + x[2]) / s;
+            qy = (z[1] + y[2]) / s;
+            qz = 0.25f * s;
+        }
+
+        // Normalize and choose the hemisphere w >= 0
+        scalar_type norm{math::sqrt(qx * qx + qy * qy + qz * qz + qw * qw)};
+        if (qw < 0.f) {
+            norm = -norm;
+        }
+
+        m_data[0u] = static_cast<storage_t>(qx / norm);
+        m_data[1u] = static_cast<storage_t>(qy / norm);
+        m_data[2u] = static_cast<storage_t>(qz / norm);
+        m_data[3u] = static_cast<storage_t>(qw / norm);
+        set_translation(t);
+    }
+
+    /// Set the translation @param t
+    DETRAY_HOST_DEVICE
+    constexpr void set_translation(const vector3_type &t) {
+        m_data[4u] = static_cast<storage_t>(t[0]);
+        m_data[5u] = static_cast<storage_t>(t[1]);
+        m_data[6u] = static_cast<storage_t>(t[2]);
+    }
+
+    /// @returns the entry @param i converted to the algebra scalar type
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type value(const std::size_t i) const {
+        return static_cast<scalar_type>(m_data[i]);
+    }
+
+    /// Rotate the vector @param v with the quaternion (@param sign = 1) or
+    /// with its conjugate, i.e. the inverse rotation (@param sign = -1)
+    ///
+    /// v' = v + 2w (q x v) + 2 q x (q x v)
+    DETRAY_HOST_DEVICE
+    constexpr vector3_type rotate(const vector3_type &v,
+                                  const scalar_type sign) const {
+        const scalar_type qx{sign * value(0u)};
+        const scalar_type qy{sign * value(1u)};
+        const scalar_type qz{sign * value(2u)};
+        const scalar_type qw{value(3u)};
+
+        // t = 2 (q x v)
+        const scalar_type tx{2.f * (qy * v[2] - qz * v[1])};
+        const scalar_type ty{2.f * (qz * v[0] - qx * v[2])};
+        const scalar_type tz{2.f * (qx * v[1] - qy * v[0])};
+
+        return {v[0] + qw * tx + (qy * tz - qz * ty),
+                v[1] + qw * ty + (qz * tx - qx * tz),
+                v[2] + qw * tz + (qx * ty - qy * tx)};
+    }
+
+    /// Quaternion (x, y, z, w) and translation (padded to four entries)
+    alignas(8u * sizeof(storage_t)) darray<storage_t, 8u> m_data{
+        0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f};
+};
+
+}  // namespace detray
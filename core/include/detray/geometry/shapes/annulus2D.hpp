@@ -22,6 +22,7 @@
 #include <limits>
 #include <ostream>
 #include <string_view>
+#include <type_traits>
 
 namespace detray {
 
@@ -43,6 +44,11 @@ namespace detray {
 /// origin from the beam polar system, two additional conversion parameters are
 /// included (bounds[4], bounds[5]). These are the origin shift in x and y
 /// respectively.
+/// The origin shift in polar coordinates is derived from these when the mask
+/// is created and stored after the boundary values, so that the boundary check
+/// only needs a few FMAs and one cosine. Together with it, a conservative
+/// radial range in the focal system is stored, which rejects most points that
+/// are clearly outside of the mask before the cosine is evaluated.
 class annulus2D {
     public:
     /// The name for this shape
@@ -60,9 +66,20 @@ class annulus2D {
         e_size = 7u,
     };
 
-    /// Container definition for the shape boundary values
+    /// Names for the values that are derived from the boundary values
+    enum derived_values : unsigned int {
+        e_shift_r2 = boundaries::e_size,  // squared origin shift
+        e_two_shift_r = 8u,               // 2 * origin shift
+        e_shift_phi = 9u,  // phi of the origin shift plus average phi
+        e_min_r_focal = 10u,  // lower bound on r in the focal system
+        e_max_r_focal = 11u,  // upper bound on r in the focal system
+        e_n_values = 12u,
+    };
+
+    /// Container definition for the shape boundary values (followed by the
+    /// derived values)
     template <concepts::scalar scalar_t>
-    using bounds_type = darray<scalar_t, boundaries::e_size>;
+    using bounds_type = darray<scalar_t, derived_values::e_n_values>;
 
     /// Local coordinate frame ( focal system )
     template <concepts::algebra algebra_t>
@@ -81,7 +98,7 @@ class annulus2D {
 
     /// @returns The phi position in relative to the average phi of the annulus.
     template <concepts::scalar scalar_t, concepts::point point_t>
-    DETRAY_HOST_DEVICE inline scalar_t get_phi_rel(
+    DETRAY_HOST_DEVICE inline auto get_phi_rel(
         const bounds_type<scalar_t> &bounds, const point_t &loc_p) const {
         // Rotate by avr phi in the focal system (this is usually zero)
         return loc_p[1] - bounds[e_average_phi];
@@ -89,19 +106,40 @@ class annulus2D {
 
     /// @returns The squared radial position in the beam frame.
     template <concepts::scalar scalar_t, concepts::point point_t>
-    DETRAY_HOST_DEVICE inline scalar_t get_r2_beam_frame(
+    DETRAY_HOST_DEVICE inline auto get_r2_beam_frame(
         const bounds_type<scalar_t> &bounds, const point_t &loc_p) const {
 
         // Go to beam frame to check r boundaries. Use the origin
         // shift in polar coordinates for that
-        // TODO: Put shift in r-phi into the bounds?
-        const point_t shift_xy = {-bounds[e_shift_x], -bounds[e_shift_y], 0.f};
-        const scalar_t shift_r = vector::perp(shift_xy);
-        const scalar_t shift_phi = vector::phi(shift_xy);
-
-        return shift_r * shift_r + loc_p[0] * loc_p[0] +
-               2.f * shift_r * loc_p[0] *
-                   math::cos(get_phi_rel(bounds, loc_p) - shift_phi);
+        return bounds[e_shift_r2] +
+               loc_p[0] * (loc_p[0] + bounds[e_two_shift_r] *
+                                          math::cos(loc_p[1] -
+                                                    bounds[e_shift_phi]));
+    }
+
+    /// @brief Compute the values that are derived from the boundary values
+    /// (called when the mask is created).
+    ///
+    /// @param bounds the boundary values for this shape
+    template <concepts::scalar scalar_t>
+    DETRAY_HOST_DEVICE inline void set_derived_values(
+        bounds_type<scalar_t> &bounds) const {
+
+        const scalar_t shift_x{-bounds[e_shift_x]};
+        const scalar_t shift_y{-bounds[e_shift_y]};
+        const scalar_t shift_r2{shift_x * shift_x + shift_y * shift_y};
+
+        const scalar_t shift_r{math::sqrt(shift_r2)};
+
+        bounds[e_shift_r2] = shift_r2;
+        bounds[e_two_shift_r] = 2.f * shift_r;
+        bounds[e_shift_phi] =
+            math::atan2(shift_y, shift_x) + bounds[e_average_phi];
+
+        // The radius in the beam and focal systems can differ by at most the
+        // length of the origin shift (triangle inequality)
+        bounds[e_min_r_focal] = bounds[e_min_r] - shift_r;
+        bounds[e_max_r_focal] = bounds[e_max_r] + shift_r;
     }
 
     /// @brief Find the minimum distance to any boundary.
@@ -148,29 +186,44 @@ class annulus2D {
     /// @param loc_p the point to be checked in the local coordinate system
     /// @param tol dynamic tolerance determined by caller
     ///
+    /// @note @c loc_p and @c tol can hold several points in SIMD vectors,
+    /// with a tolerance per lane, while the @c bounds are scalar
+    ///
     /// @return true if the local point lies within the given boundaries.
-    template <concepts::scalar scalar_t, concepts::point point_t>
+    template <concepts::scalar scalar_t, concepts::point point_t,
+              concepts::scalar tol_t = scalar_t>
     DETRAY_HOST_DEVICE inline auto check_boundaries(
         const bounds_type<scalar_t> &bounds, const point_t &loc_p,
-        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+        const tol_t tol = std::numeric_limits<tol_t>::epsilon()) const {
         // The two quantities to check: r^2 in beam system, phi in focal system:
 
+        using value_t = std::remove_cvref_t<decltype(loc_p[0])>;
+
         // Rotate by avr phi in the focal system (this is usually zero)
-        const scalar_t phi_focal = get_phi_rel(bounds, loc_p);
+        const auto phi_focal = get_phi_rel(bounds, loc_p);
 
         // Check phi boundaries, which are well def. in focal frame
-        const scalar_t phi_tol = detail::phi_tolerance(tol, loc_p[0]);
+        const auto phi_tol =
+            detail::phi_tolerance(static_cast<value_t>(tol), loc_p[0]);
         const auto phi_check =
             !((phi_focal < (bounds[e_min_phi_rel] - phi_tol)) ||
               (phi_focal > (bounds[e_max_phi_rel] + phi_tol)));
 
+        // Conservative pre-rejection before the beam frame radius is computed
+        if constexpr (std::is_arithmetic_v<value_t>) {
+            if (!phi_check || (loc_p[0] < (bounds[e_min_r_focal] - tol)) ||
+                (loc_p[0] > (bounds[e_max_r_focal] + tol))) {
+                return false;
+            }
+        }
+
         const auto r_beam2 = get_r2_beam_frame(bounds, loc_p);
 
         // Apply tolerances as squares: 0 <= a, 0 <= b: a^2 <= b^2 <=> a <= b
-        const scalar_t minR_tol = bounds[e_min_r] - tol;
-        const scalar_t maxR_tol = bounds[e_max_r] + tol;
+        const auto minR_tol = bounds[e_min_r] - tol;
+        const auto maxR_tol = bounds[e_max_r] + tol;
 
-        assert(detail::all_of(minR_tol >= scalar_t(0.f)));
+        assert(detail::all_of(minR_tol >= 0.f));
 
         return ((r_beam2 >= (minR_tol * minR_tol)) &&
                 (r_beam2 <= (maxR_tol * maxR_tol))) &&
@@ -458,6 +511,16 @@ class annulus2D {
             return false;
         }
 
+        bounds_type<scalar_t> derived{bounds};
+        set_derived_values(derived);
+        for (unsigned int i = e_size; i < e_n_values; ++i) {
+            if (math::fabs(bounds[i] - derived[i]) > tol) {
+                os << "ERROR: Derived value " << i
+                   << " incorrect. Should be: " << derived[i];
+                return false;
+            }
+        }
+
         return true;
     }
 };
@@ -49,6 +49,9 @@ class cylinder2D {
     /// Dimension of the local coordinate system
     static constexpr std::size_t dim{2u};
 
+    /// The boundary check does not need the local phi coordinate
+    static constexpr bool check_uses_phi{false};
+
     /// @brief Find the minimum distance to any boundary.
     ///
     /// @note the point is expected to be given in local coordinates by the
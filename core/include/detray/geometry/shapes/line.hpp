@@ -59,6 +59,10 @@ class line {
     /// Dimension of the local coordinate system
     static constexpr std::size_t dim{2u};
 
+    /// Only the boundary check of the square cross section needs the local
+    /// phi coordinate
+    static constexpr bool check_uses_phi{square_cross_sect};
+
     /// @brief Find the minimum distance to any boundary.
     ///
     /// @note the point is expected to be given in local coordinates by the
@@ -49,6 +49,9 @@ class ring2D {
     /// Dimension of the local coordinate system
     static constexpr std::size_t dim{2u};
 
+    /// The boundary check does not need the local phi coordinate
+    static constexpr bool check_uses_phi{false};
+
     /// @brief Find the minimum distance to any boundary.
     ///
     /// @note the point is expected to be given in local coordinates by the
@@ -76,11 +79,15 @@ class ring2D {
     /// @param loc_p the point to be checked in the local coordinate system
     /// @param tol dynamic tolerance determined by caller
     ///
+    /// @note @c loc_p and @c tol can hold several points in SIMD vectors,
+    /// with a tolerance per lane, while the @c bounds are scalar
+    ///
     /// @return true if the local point lies within the given boundaries.
-    template <concepts::scalar scalar_t, concepts::point point_t>
+    template <concepts::scalar scalar_t, concepts::point point_t,
+              concepts::scalar tol_t = scalar_t>
     DETRAY_HOST_DEVICE inline auto check_boundaries(
         const bounds_type<scalar_t> &bounds, const point_t &loc_p,
-        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
+        const tol_t tol = std::numeric_limits<tol_t>::epsilon()) const {
 
         return ((loc_p[0] + tol) >= bounds[e_inner_r] &&
                 loc_p[0] <= (bounds[e_outer_r] + tol));
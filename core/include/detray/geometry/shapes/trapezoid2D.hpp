@@ -90,12 +90,16 @@ class trapezoid2D {
     /// @param loc_p the point to be checked in the local coordinate system
     /// @param tol dynamic tolerance determined by caller
     ///
+    /// @note @c loc_p and @c tol can hold several points in SIMD vectors,
+    /// with a tolerance per lane, while the @c bounds are scalar
+    ///
     /// @return true if the local point lies within the given boundaries.
-    template <concepts::scalar scalar_t, concepts::point point_t>
+    template <concepts::scalar scalar_t, concepts::point point_t,
+              concepts::scalar tol_t = scalar_t>
     DETRAY_HOST_DEVICE inline auto check_boundaries(
         const bounds_type<scalar_t> &bounds, const point_t &loc_p,
-        const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
-        const scalar_t rel_y =
+        const tol_t tol = std::numeric_limits<tol_t>::epsilon()) const {
+        const auto rel_y =
             (bounds[e_half_length_2] + loc_p[1]) * bounds[e_divisor];
         return (math::fabs(loc_p[0]) <= (bounds[e_half_length_0] +
                                          rel_y * (bounds[e_half_length_1] -
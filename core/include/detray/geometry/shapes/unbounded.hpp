@@ -31,7 +31,7 @@ class unbounded {
 
     /// Container definition for the shape boundary values
     template <concepts::scalar scalar_t>
-    using bounds_type = darray<scalar_t, boundaries::e_size>;
+    using bounds_type = typename shape::template bounds_type<scalar_t>;
 
     /// Convenience member to construct the name
     static constexpr std::string_view name_prefix = "unbounded ";
@@ -47,6 +47,9 @@ class unbounded {
     /// Dimension of the local coordinate system
     static constexpr std::size_t dim{shape_t::dim};
 
+    /// No boundary check, so no local phi coordinate is needed
+    static constexpr bool check_uses_phi{false};
+
     /// @brief Find the minimum distance to any boundary.
     ///
     /// @note the point is expected to be given in local coordinates by the
@@ -78,6 +81,18 @@ class unbounded {
         return true;
     }
 
+    /// @brief Compute the values that the underlying shape derives from the
+    /// boundary values (if any).
+    ///
+    /// @param bounds the boundary values for this shape
+    template <concepts::scalar scalar_t>
+    requires(requires(const shape &sh, bounds_type<scalar_t> &b) {
+        sh.set_derived_values(b);
+    }) DETRAY_HOST_DEVICE
+        inline void set_derived_values(bounds_type<scalar_t> &bounds) const {
+        shape{}.set_derived_values(bounds);
+    }
+
     /// @brief Measure of the shape: Inf
     ///
     /// @param bounds the boundary values for this shape
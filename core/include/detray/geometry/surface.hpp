@@ -124,7 +124,7 @@ class surface {
     /// @returns the surface source link
     DETRAY_HOST_DEVICE
     constexpr auto source() const {
-        return m_detector.surface(barcode()).source;
+        return m_detector.surfaces().source(barcode().index());
     }
 
     /// @returns true if the surface is a senstive detector module.
@@ -168,8 +168,8 @@ class surface {
 
     /// @returns the coordinate transform matrix of the surface
     DETRAY_HOST_DEVICE
-    constexpr auto transform(const context &ctx) const
-        -> const transform3_type & {
+    constexpr auto transform(const context &ctx) const -> const
+        typename detector_t::transform_container::value_type & {
         assert(m_desc.transform() < m_detector.transform_store().size());
         return m_detector.transform_store().at(m_desc.transform(), ctx);
     }
@@ -91,7 +91,7 @@ class tracking_volume {
     /// volume in the detector geometry.
     DETRAY_HOST_DEVICE
     constexpr auto transform() const -> const
-        typename detector_t::transform3_type & {
+        typename detector_t::transform_container::value_type & {
         return m_detector.transform_store().at(m_desc.transform());
     }
 
@@ -117,6 +117,26 @@ class tracking_volume {
                    detector_t::materials::id::e_none);
     }
 
+    /// @returns true if the volume carries material that is the same
+    /// everywhere in the volume.
+    DETRAY_HOST_DEVICE
+    constexpr auto has_homogeneous_material() const -> bool {
+        return has_material() &&
+               visit_material<typename detail::is_homogeneous_material>();
+    }
+
+    /// @returns true if the volume contains no other surfaces than its
+    /// portals (e.g. a gap volume)
+    DETRAY_HOST_DEVICE
+    constexpr auto has_only_portals() const -> bool {
+        const auto &sens_range =
+            m_desc.template sf_link<surface_id::e_sensitive>();
+        const auto &psv_range =
+            m_desc.template sf_link<surface_id::e_passive>();
+
+        return sens_range[0] == sens_range[1] && psv_range[0] == psv_range[1];
+    }
+
     /// @returns an iterator pair for the requested type of surfaces.
     template <surface_id sf_type = surface_id::e_all>
     DETRAY_HOST_DEVICE constexpr decltype(auto) surfaces() const {
@@ -0,0 +1,239 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/materials/detail/concepts.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/utils/float16.hpp"
+#include "detray/utils/grid/detail/axis_helpers.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+#include "detray/utils/grid/serializers.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Bin entry of a compact material map.
+///
+/// Refers to a material in the palette of the map and stores the thickness in
+/// half precision (four bytes per bin instead of the full material slab).
+template <concepts::scalar scalar_t>
+struct compact_material_slab {
+
+    using scalar_type = scalar_t;
+    using index_type = std::uint16_t;
+
+    /// Index of the material in the palette of the map
+    index_type m_palette_idx{0u};
+    /// Thickness of the material slab
+    float16 m_thickness{};
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const compact_material_slab &rhs) const {
+        return m_palette_idx == rhs.m_palette_idx &&
+               m_thickness.bits() == rhs.m_thickness.bits();
+    }
+};
+
+/// @brief Material map with a reduced memory footprint.
+///
+/// Maps usually contain only a handful of distinct materials, while the
+/// material slab of every bin holds the full material description. The compact
+/// map keeps the distinct materials in a per-map palette and every bin only
+/// stores the palette index and the thickness in half precision. The material
+/// slab is expanded on access, so that lookups return the same type as the
+/// regular material map (@see material_map ).
+///
+/// @note the thickness is rounded to half precision, i.e. to a relative
+/// precision of about 5e-4.
+///
+/// @tparam algebra_t the algebra type
+/// @tparam shape the shape of the map (determines the axes)
+/// @tparam container_t the types of underlying containers to be used.
+template <concepts::algebra algebra_t, typename shape,
+          typename container_t = host_container_types>
+class compact_material_map {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+
+    using scalar_type = dscalar<algebra_t>;
+    using material_type = material<scalar_type>;
+    using value_type = material_slab<scalar_type>;
+    using entry_type = compact_material_slab<scalar_type>;
+    using index_type = typename entry_type::index_type;
+
+    /// Owning grid of the compact bins
+    using grid_type =
+        detray::grid<algebra_t, axes<shape>, bins::single<entry_type>,
+                     simple_serializer, container_t, true>;
+    using point_type = typename grid_type::point_type;
+
+    static constexpr auto dim{grid_type::dim};
+
+    /// Maximal number of distinct materials per map
+    static constexpr std::size_t max_palette_size{
+        std::numeric_limits<index_type>::max() + 1u};
+
+    using view_type =
+        dmulti_view<dvector_view<material_type>, typename grid_type::view_type>;
+    using const_view_type = dmulti_view<dvector_view<const material_type>,
+                                        typename grid_type::const_view_type>;
+    using buffer_type = dmulti_buffer<dvector_buffer<material_type>,
+                                      typename grid_type::buffer_type>;
+
+    /// Default constructor
+    constexpr compact_material_map() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit compact_material_map(vecmem::memory_resource &resource)
+        : m_palette(&resource), m_grid(resource) {}
+
+    /// Construct from a material @param palette and the @param grid of the
+    /// compact bins
+    DETRAY_HOST
+    compact_material_map(vector_type<material_type> &&palette,
+                         grid_type &&grid)
+        : m_palette(std::move(palette)), m_grid(std::move(grid)) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view map_view_t>
+    DETRAY_HOST_DEVICE explicit compact_material_map(map_view_t &view)
+        : m_palette(detail::get<0>(view.m_view)),
+          m_grid(detail::get<1>(view.m_view)) {}
+
+    /// @returns the number of bins of the map
+    DETRAY_HOST_DEVICE
+    constexpr dindex nbins() const { return m_grid.nbins(); }
+
+    /// @returns the distinct materials of the map
+    DETRAY_HOST_DEVICE
+    constexpr auto palette() const -> const vector_type<material_type> & {
+        return m_palette;
+    }
+
+    /// @returns the grid of compact bin entries
+    DETRAY_HOST_DEVICE
+    constexpr auto compact_grid() const -> const grid_type & {
+        return m_grid;
+    }
+
+    /// @returns the expanded material slab of the bin @param gbin
+    DETRAY_HOST_DEVICE
+    value_type at(const dindex gbin) const {
+        return expand(m_grid.bin(gbin).value());
+    }
+
+    /// @returns the expanded material slab at the local point @param p
+    DETRAY_HOST_DEVICE
+    value_type search(const point_type &p) const {
+        return expand(m_grid.search(p).value());
+    }
+
+    /// Build a compact map from the material map @param map
+    ///
+    /// @throws std::length_error if the map holds too many distinct
+    /// materials
+    template <concepts::material_map map_t>
+    DETRAY_HOST static compact_material_map compress(const map_t &map) {
+
+        static_assert(map_t::dim == dim, "Map dimensions do not match");
+
+        using axes_type = typename grid_type::axes_type;
+
+        const auto &ax = map.axes();
+        const auto &edge_offsets = ax.bin_edge_offsets();
+
+        vector_type<dindex_range> axes_data(edge_offsets.begin(),
+                                            edge_offsets.end());
+        vector_type<scalar_type> bin_edges(ax.bin_edges().begin(),
+                                           ax.bin_edges().end());
+
+        vector_type<material_type> palette{};
+        typename grid_type::bin_container_type bin_data(map.nbins());
+
+        for (dindex gbin = 0u; gbin < map.nbins(); ++gbin) {
+            const auto &slab = map.bin(gbin).value();
+            const material_type &mat = slab.get_material();
+
+            dindex idx{0u};
+            while (idx < palette.size() &&
+                   !(palette[idx] == mat &&
+                     palette[idx].molar_density() == mat.molar_density())) {
+                ++idx;
+            }
+            if (idx == palette.size()) {
+                if (palette.size() == max_palette_size) {
+                    throw std::length_error(
+                        "Too many distinct materials for a compact map");
+                }
+                palette.push_back(mat);
+            }
+
+            bin_data[gbin].init(
+                entry_type{static_cast<index_type>(idx),
+                           float16{static_cast<float>(slab.thickness())}});
+        }
+
+        return compact_material_map{
+            std::move(palette),
+            grid_type{std::move(bin_data),
+                      axes_type{std::move(axes_data), std::move(bin_edges)}}};
+    }
+
+    /// @return the view on the map - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type {
+        return view_type{detray::get_data(m_palette), m_grid.get_data()};
+    }
+
+    /// @return the view on the map - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_palette),
+                               m_grid.get_data()};
+    }
+
+    private:
+    /// @returns the material slab that corresponds to the entry @param e
+    DETRAY_HOST_DEVICE
+    value_type expand(const entry_type &e) const {
+        assert(e.m_palette_idx < m_palette.size());
+
+        return value_type{m_palette[e.m_palette_idx],
+                          static_cast<scalar_type>(
+                              static_cast<float>(e.m_thickness))};
+    }
+
+    /// The distinct materials of the map
+    vector_type<material_type> m_palette{};
+    /// Palette index and thickness per bin
+    grid_type m_grid{};
+};
+
+}  // namespace detray
@@ -43,6 +43,9 @@ struct relativistic_quantities {
     scalar_type m_E{0.f};
     scalar_type m_Wmax{0.f};
 
+    /// Default constructor (all quantities zero)
+    constexpr relativistic_quantities() = default;
+
     DETRAY_HOST_DEVICE
     relativistic_quantities(const pdg_particle<scalar_type>& ptc,
                             const scalar_type qop)
@@ -0,0 +1,223 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace detray {
+
+/// @brief Precomputed material interaction quantities for a single material
+/// and particle species.
+///
+/// The table holds the mean energy loss (Bethe-Bloch, including the density
+/// effect correction) and the logarithmic term of the multiple scattering
+/// angle in bins that are uniform in ln(beta * gamma). The values are linearly
+/// interpolated between the bins, which replaces the logarithms and powers of
+/// the analytic formulas (@see interaction ) by a single logarithm. The q/p
+/// sigma of the energy loss and the prefactor of the scattering angle only
+/// depend on q²/beta² and 1/p, for which the material terms are precomputed.
+///
+/// @tparam scalar_t the scalar type
+/// @tparam N the number of bins
+template <concepts::scalar scalar_t, std::size_t N = 128u>
+class interaction_table {
+
+    static_assert(N > 1u, "Interaction table needs at least two bins");
+
+    public:
+    using scalar_type = scalar_t;
+    using interaction_type = interaction<scalar_type>;
+    using relativistic_quantities =
+        detail::relativistic_quantities<scalar_type>;
+
+    /// The interpolated quantities for a given q/p value
+    struct values {
+        /// Mean energy loss per unit length (Bethe-Bloch)
+        scalar_type stopping_power{0.f};
+        /// Sigma of q/p per unit length (Landau)
+        scalar_type sigma_qop_per_length{0.f};
+        /// Momentum dependent prefactor of the scattering angle
+        scalar_type theta0_prefactor{0.f};
+        /// ln(q²/beta²) for the log correction of the scattering angle
+        scalar_type log_q2_over_beta2{0.f};
+    };
+
+    /// Default constructor: empty table
+    constexpr interaction_table() = default;
+
+    /// Construct the table for the material @param mat and the particle
+    /// @param ptc between @param bg_min and @param bg_max in beta * gamma
+    DETRAY_HOST
+    interaction_table(const material<scalar_type> &mat,
+                      const pdg_particle<scalar_type> &ptc,
+                      const scalar_type bg_min = 0.1f,
+                      const scalar_type bg_max = 1e7f)
+        : m_mat{mat},
+          m_pdg_num{ptc.pdg_num()},
+          m_mass{ptc.mass()},
+          m_charge{ptc.charge()},
+          m_log_bg_min{math::log(bg_min)},
+          m_log_bg_max{math::log(bg_max)},
+          m_is_valid{true} {
+
+        assert(bg_min > 0.f);
+        assert(bg_max > bg_min);
+
+        m_inv_bin_width = static_cast<scalar_type>(N - 1u) /
+                          (m_log_bg_max - m_log_bg_min);
+
+        const scalar_type q{m_charge != 0.f ? m_charge : scalar_type{1.f}};
+        const bool is_electron{m_pdg_num == 11 || m_pdg_num == -11};
+        m_theta0_scale = is_electron ? 17.5f * unit<scalar_type>::MeV
+                                     : 13.6f * unit<scalar_type>::MeV;
+
+        for (std::size_t i = 0u; i < N; ++i) {
+            const scalar_type bg{math::exp(
+                m_log_bg_min + static_cast<scalar_type>(i) / m_inv_bin_width)};
+            const relativistic_quantities rq(ptc, q / (m_mass * bg));
+
+            // Tabulate the slowly varying part of the stopping power, which
+            // is proportional to q²/beta² times a logarithmic term
+            m_stopping_power[i] =
+                interaction_type().compute_bethe_bloch(mat, ptc, rq) /
+                rq.m_q2OverBeta2;
+            m_log_q2_over_beta2[i] = math::log(rq.m_q2OverBeta2);
+        }
+
+        // The q/p sigma is proportional to (q²/beta²)^(3/2) / p²
+        const relativistic_quantities rq(ptc, q / m_mass);
+        const scalar_type p_inv{1.f / m_mass};
+        m_sigma_qop_scale =
+            interaction_type().compute_energy_loss_landau_sigma_QOverP(
+                1.f, mat, ptc, rq) /
+            (rq.m_q2OverBeta2 * math::sqrt(rq.m_q2OverBeta2) * p_inv * p_inv);
+    }
+
+    /// @returns whether the table was built
+    DETRAY_HOST_DEVICE
+    constexpr bool is_valid() const { return m_is_valid; }
+
+    /// @returns the material of the table
+    DETRAY_HOST_DEVICE
+    constexpr const material<scalar_type> &get_material() const {
+        return m_mat;
+    }
+
+    /// @returns true if the table was built for the material @param mat and
+    /// the particle @param ptc
+    DETRAY_HOST_DEVICE
+    constexpr bool matches(const material<scalar_type> &mat,
+                           const pdg_particle<scalar_type> &ptc) const {
+        return m_is_valid && ptc.pdg_num() == m_pdg_num &&
+               ptc.mass() == m_mass && mat == m_mat &&
+               mat.molar_density() == m_mat.molar_density();
+    }
+
+    /// Look up the values for a track with q/p value @param qop
+    ///
+    /// @param[out] v the interpolated values
+    ///
+    /// @returns false if the track lies outside of the table
+    DETRAY_HOST_DEVICE
+    bool lookup(const scalar_type qop, values &v) const {
+        if (!m_is_valid || qop == 0.f) {
+            return false;
+        }
+
+        // 1 / (beta * gamma) = m / p
+        const scalar_type p_inv{m_charge != 0.f ? math::fabs(qop / m_charge)
+                                                : math::fabs(qop)};
+        const scalar_type log_bg{-math::log(m_mass * p_inv)};
+
+        if (log_bg < m_log_bg_min || log_bg > m_log_bg_max) {
+            return false;
+        }
+
+        const scalar_type u{(log_bg - m_log_bg_min) * m_inv_bin_width};
+        std::size_t i{static_cast<std::size_t>(u)};
+        i = i < N - 1u ? i : N - 2u;
+        const scalar_type w{u - static_cast<scalar_type>(i)};
+
+        const scalar_type m_qop{m_mass * qop};
+        const scalar_type q2_over_beta2{m_charge * m_charge + m_qop * m_qop};
+        const scalar_type q_over_beta{math::sqrt(q2_over_beta2)};
+
+        v.stopping_power = q2_over_beta2 * lerp(m_stopping_power, i, w);
+        v.sigma_qop_per_length =
+            m_sigma_qop_scale * q2_over_beta2 * q_over_beta * p_inv * p_inv;
+        v.theta0_prefactor = m_theta0_scale * p_inv * q_over_beta;
+        v.log_q2_over_beta2 = lerp(m_log_q2_over_beta2, i, w);
+
+        return true;
+    }
+
+    /// @returns the projected multiple scattering angle for the path length
+    /// in X0 @param xOverX0 from the interpolated values @param v
+    DETRAY_HOST_DEVICE
+    scalar_type theta0(const values &v, const scalar_type xOverX0) const {
+        if (xOverX0 <= 0.f) {
+            return 0.f;
+        }
+
+        const scalar_type log_x{math::log(xOverX0)};
+        const scalar_type corr{
+            (m_pdg_num == 11 || m_pdg_num == -11)
+                ? 0.125f * (log_x + constant<scalar_type>::ln10) /
+                      constant<scalar_type>::ln10
+                // 2 * ln(t) = ln(x/X0) + ln(q²/beta²)
+                : 0.038f * (log_x + v.log_q2_over_beta2)};
+
+        return v.theta0_prefactor * math::sqrt(xOverX0) * (1.f + corr);
+    }
+
+    private:
+    /// @returns the linear interpolation of @param t between bin @param i and
+    /// the next bin with weight @param w
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_type lerp(const darray<scalar_type, N> &t,
+                                      const std::size_t i,
+                                      const scalar_type w) {
+        return t[i] + w * (t[i + 1u] - t[i]);
+    }
+
+    /// Material and particle species of the table
+    material<scalar_type> m_mat{};
+    std::int32_t m_pdg_num{0};
+    scalar_type m_mass{0.f};
+    scalar_type m_charge{0.f};
+
+    /// Binning in ln(beta * gamma)
+    scalar_type m_log_bg_min{0.f};
+    scalar_type m_log_bg_max{0.f};
+    scalar_type m_inv_bin_width{0.f};
+
+    /// Tabulated quantities
+    darray<scalar_type, N> m_stopping_power{};
+    darray<scalar_type, N> m_log_q2_over_beta2{};
+
+    /// Precomputed material and particle terms
+    scalar_type m_sigma_qop_scale{0.f};
+    scalar_type m_theta0_scale{0.f};
+
+    bool m_is_valid{false};
+};
+
+}  // namespace detray
@@ -0,0 +1,331 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/geometry/coordinates/cylindrical3D.hpp"
+#include "detray/materials/detail/concepts.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+
+// System include(s)
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Material that is traversed along a straight step through a volume
+///
+/// Accumulates the path length weighted material parameters of the bins of a
+/// volume material map that a step crosses, from which the integrated
+/// radiation and interaction lengths and a path-averaged material follow.
+template <concepts::scalar scalar_t>
+struct volume_material_integral {
+
+    using scalar_type = scalar_t;
+
+    /// Total path length of the step
+    scalar_type path{0.f};
+    /// Path length in units of the radiation and nuclear interaction length
+    /// @{
+    scalar_type path_in_x0{0.f};
+    scalar_type path_in_l0{0.f};
+    /// @}
+    /// Path length weighted mass density, mass density over the relative
+    /// atomic mass and electron density over the molar density
+    /// @{
+    scalar_type mass{0.f};
+    scalar_type moles{0.f};
+    scalar_type electrons{0.f};
+    /// @}
+    /// Number of material map bins that were visited
+    dindex n_bins{0u};
+
+    /// Add the material @param mat along the path segment @param s
+    DETRAY_HOST_DEVICE
+    constexpr void add(const material<scalar_type> &mat, const scalar_type s) {
+        if (s <= 0.f) {
+            return;
+        }
+        path += s;
+        ++n_bins;
+
+        // Vacuum
+        if (mat.mass_density() <= 0.f) {
+            return;
+        }
+        path_in_x0 += s / mat.X0();
+        path_in_l0 += s / mat.L0();
+        mass += s * mat.mass_density();
+        moles += s * mat.mass_density() / mat.Ar();
+        electrons += s * mat.mass_density() * mat.Z() / mat.Ar();
+    }
+
+    /// Add the material integral @param other of a subsequent step
+    DETRAY_HOST_DEVICE
+    constexpr volume_material_integral &operator+=(
+        const volume_material_integral &other) {
+        path += other.path;
+        path_in_x0 += other.path_in_x0;
+        path_in_l0 += other.path_in_l0;
+        mass += other.mass;
+        moles += other.moles;
+        electrons += other.electrons;
+        n_bins += other.n_bins;
+
+        return *this;
+    }
+
+    /// @returns the average material along the step: The radiation and
+    /// interaction lengths reproduce the integrated path in X0 and L0 and the
+    /// mass, molar and electron densities are averaged over the path
+    DETRAY_HOST_DEVICE
+    constexpr material<scalar_type> average_material() const {
+        if (path <= 0.f || mass <= 0.f) {
+            return vacuum<scalar_type>{};
+        }
+
+        const scalar_type ar{mass / moles};
+
+        return {path / path_in_x0, path / path_in_l0,
+                ar,                ar * electrons / mass,
+                mass / path,       material_state::e_unknown};
+    }
+};
+
+namespace detail {
+
+/// Crossing of a straight line with the edge of a material map bin
+template <concepts::scalar scalar_t>
+struct bin_crossing {
+    /// Path length along the line at the crossing (infinity, if none)
+    scalar_t path{std::numeric_limits<scalar_t>::max()};
+    /// Step of the bin index on the axis (zero: look the bin up again)
+    int step{0};
+};
+
+/// @returns the crossing of the line @param p + t * @param dp into the
+/// neighbouring bin of the bin with index @param bin and @param edges on a
+/// cartesian axis with @param n_bins bins, after the path length @param s
+///
+/// Outside of the axis span, the closest bin is used. The line therefore only
+/// enters a neighbouring bin through the inner edges of the axis.
+template <concepts::scalar scalar_t>
+DETRAY_HOST_DEVICE constexpr bin_crossing<scalar_t> linear_crossing(
+    const scalar_t p, const scalar_t dp, const darray<scalar_t, 2> &edges,
+    const dindex bin, const dindex n_bins, const scalar_t s) {
+    if (dp > 0.f && bin + 1u < n_bins) {
+        return {math::max((edges[1] - p) / dp, s), 1};
+    }
+    if (dp < 0.f && bin > 0u) {
+        return {math::max((edges[0] - p) / dp, s), -1};
+    }
+    return {};
+}
+
+/// @returns the crossing of the line @param p + t * @param d into the
+/// neighbouring bin of the bin with index @param bin and radial @param edges
+/// on an axis with @param n_bins bins, after the path length @param s
+///
+/// The line moves to the lower bin where it enters the circle of the inner
+/// edge and to the upper bin where it leaves the circle of the outer edge.
+template <concepts::point3D point3_t, concepts::vector3D vector3_t,
+          concepts::scalar scalar_t>
+DETRAY_HOST_DEVICE constexpr bin_crossing<scalar_t> radial_crossing(
+    const point3_t &p, const vector3_t &d, const darray<scalar_t, 2> &edges,
+    const dindex bin, const dindex n_bins, const scalar_t s) {
+    bin_crossing<scalar_t> crossing{};
+
+    const scalar_t a{d[0] * d[0] + d[1] * d[1]};
+    if (a <= 0.f) {
+        return crossing;
+    }
+    const scalar_t b{p[0] * d[0] + p[1] * d[1]};
+    const scalar_t r2{p[0] * p[0] + p[1] * p[1]};
+
+    // Tangents do not change the bin
+    if (const scalar_t disc{b * b - a * (r2 - edges[0] * edges[0])};
+        bin > 0u && disc > 0.f) {
+        if (const scalar_t t{(-b - math::sqrt(disc)) / a}; t > s) {
+            crossing = {t, -1};
+        }
+    }
+    if (const scalar_t disc{b * b - a * (r2 - edges[1] * edges[1])};
+        bin + 1u < n_bins && disc > 0.f) {
+        if (const scalar_t t{(-b + math::sqrt(disc)) / a};
+            t > s && t < crossing.path) {
+            crossing = {t, 1};
+        }
+    }
+
+    return crossing;
+}
+
+/// @returns the crossing of the line @param p + t * @param d into the
+/// neighbouring bin of a bin with azimuthal @param edges on a circular axis,
+/// after the path length @param s
+///
+/// The sense of rotation around the z-axis does not change along a straight
+/// line, so only one edge can be crossed. A line through the z-axis jumps in
+/// phi where it crosses the axis, after which the bin has to be looked up
+/// again (zero step).
+template <concepts::point3D point3_t, concepts::vector3D vector3_t,
+          concepts::scalar scalar_t>
+DETRAY_HOST_DEVICE constexpr bin_crossing<scalar_t> azimuthal_crossing(
+    const point3_t &p, const vector3_t &d, const darray<scalar_t, 2> &edges,
+    const scalar_t s) {
+
+    const scalar_t lz{p[0] * d[1] - p[1] * d[0]};
+    if (lz == 0.f) {
+        const scalar_t a{d[0] * d[0] + d[1] * d[1]};
+        if (a > 0.f) {
+            if (const scalar_t t{-(p[0] * d[0] + p[1] * d[1]) / a}; t > s) {
+                return {t, 0};
+            }
+        }
+        return {};
+    }
+
+    const scalar_t phi{lz > 0.f ? edges[1] : edges[0]};
+    const scalar_t cos_phi{math::cos(phi)};
+    const scalar_t sin_phi{math::sin(phi)};
+
+    // Normal of the plane through the z-axis
+    const scalar_t denom{-sin_phi * d[0] + cos_phi * d[1]};
+    if (denom == 0.f) {
+        return {};
+    }
+    const scalar_t t{(sin_phi * p[0] - cos_phi * p[1]) / denom};
+
+    // The crossing has to lie on the half-plane of the angle
+    const scalar_t x{p[0] + t * d[0]};
+    const scalar_t y{p[1] + t * d[1]};
+    if (t <= s || cos_phi * x + sin_phi * y <= 0.f) {
+        return {};
+    }
+
+    return {t, lz > 0.f ? 1 : -1};
+}
+
+}  // namespace detail
+
+/// @brief Integrate the material of a 3D volume material map along a step
+///
+/// Walks along the straight step from bin to bin of the map: The path length
+/// to the next bin crossing is calculated from the edges of the current bin
+/// and the bin index is then stepped to the neighbouring bin, so that every
+/// bin along the step is visited exactly once, instead of sampling the
+/// material at many points. Supports the maps on cuboid3D (cartesian) and
+/// cylinder3D (r, phi, z) axes.
+///
+/// @note Curved steps are approximated by their chord, which is accurate if
+/// the step is short compared to the radius of curvature (e.g. muons and
+/// electrons in a calorimeter). Outside of the map span, the material of the
+/// closest bin is used.
+///
+/// @param map the volume material map
+/// @param trf the placement of the volume
+/// @param pos the global start position of the step
+/// @param dir the global (normalized) direction of the step
+/// @param path_length the length of the step
+/// @param max_bins the maximal number of bins to visit
+///
+/// @returns the accumulated material along the step
+template <concepts::material_map map_t, concepts::transform3D transform3_t,
+          concepts::point3D point3_t, concepts::vector3D vector3_t>
+requires(map_t::dim == 3) DETRAY_HOST_DEVICE constexpr auto
+integrate_material(const map_t &map, const transform3_t &trf,
+                   const point3_t &pos, const vector3_t &dir,
+                   const dscalar<typename map_t::algebra_type> path_length,
+                   const dindex max_bins = 1000u) {
+
+    using algebra_t = typename map_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using point_t = typename map_t::point_type;
+
+    constexpr bool is_cylindrical{
+        std::is_same_v<typename map_t::local_frame_type,
+                       cylindrical3D<algebra_t>>};
+
+    volume_material_integral<scalar_t> integral{};
+
+    // Walk in the cartesian frame of the volume
+    const auto p0 = trf.point_to_local(pos);
+    const auto d = trf.vector_to_local(dir);
+
+    const auto ax0 = map.template get_axis<0>();
+    const auto ax1 = map.template get_axis<1>();
+    const auto ax2 = map.template get_axis<2>();
+
+    // Start bin (closest bin, if the start position is outside the span)
+    point_t loc{p0[0], p0[1], p0[2]};
+    if constexpr (is_cylindrical) {
+        // On the z-axis, the line moves along its own phi direction
+        const scalar_t r{vector::perp(p0)};
+        loc = {r, r > 0.f ? vector::phi(p0) : vector::phi(d), p0[2]};
+    }
+    auto lbin = map.axes().bins(loc);
+
+    scalar_t s{0.f};
+    for (dindex i = 0u; i < max_bins && s < path_length; ++i) {
+
+        // Next crossing into a neighbouring bin on every axis
+        darray<detail::bin_crossing<scalar_t>, 3u> crossings{};
+        crossings[2] = detail::linear_crossing(
+            p0[2], d[2], ax2.bin_edges(lbin[2]), lbin[2], ax2.nbins(), s);
+        if constexpr (is_cylindrical) {
+            crossings[0] = detail::radial_crossing(
+                p0, d, ax0.bin_edges(lbin[0]), lbin[0], ax0.nbins(), s);
+            crossings[1] =
+                detail::azimuthal_crossing(p0, d, ax1.bin_edges(lbin[1]), s);
+        } else {
+            crossings[0] = detail::linear_crossing(
+                p0[0], d[0], ax0.bin_edges(lbin[0]), lbin[0], ax0.nbins(), s);
+            crossings[1] = detail::linear_crossing(
+                p0[1], d[1], ax1.bin_edges(lbin[1]), lbin[1], ax1.nbins(), s);
+        }
+
+        dindex k{crossings[1].path < crossings[0].path ? 1u : 0u};
+        k = crossings[2].path < crossings[k].path ? 2u : k;
+
+        // Material of the current bin up to the crossing
+        const scalar_t s_next{math::min(crossings[k].path, path_length)};
+        integral.add(map.bin(lbin).value().get_material(), s_next - s);
+        s = s_next;
+
+        if (s >= path_length) {
+            break;
+        }
+
+        // Step into the neighbouring bin
+        if (crossings[k].step == 0) {
+            // The line crossed the z-axis
+            lbin[1] = ax1.bin(vector::phi(d));
+        } else if (k == 1u && is_cylindrical) {
+            // Wrap around on the circular phi axis
+            const auto n{static_cast<int>(ax1.nbins())};
+            lbin[1] = static_cast<dindex>(
+                (static_cast<int>(lbin[1]) + crossings[k].step + n) % n);
+        } else {
+            lbin[k] = static_cast<dindex>(static_cast<int>(lbin[k]) +
+                                          crossings[k].step);
+        }
+    }
+
+    // Remaining path after the bin limit: Material of the last bin
+    integral.add(map.bin(lbin).value().get_material(), path_length - s);
+
+    return integral;
+}
+
+}  // namespace detray
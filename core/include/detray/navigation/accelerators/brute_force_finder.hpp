@@ -20,6 +20,7 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <cstddef>
 #include <type_traits>
 
 namespace detray {
@@ -64,6 +65,21 @@ class brute_force_collection {
             return *this;
         }
 
+        /// Write the indices of all surfaces of the search volume to the
+        /// caller-provided buffer @param result (@see search_buffer )
+        template <typename detector_t, typename track_t, typename config_t,
+                  typename buffer_t>
+        DETRAY_HOST_DEVICE constexpr void search_into(
+            const detector_t& /*det*/,
+            const typename detector_t::volume_type& /*volume*/,
+            const track_t& /*track*/, const config_t& /*navigation_config*/,
+            const typename detector_t::geometry_context& /*ctx*/,
+            buffer_t& result) const {
+            for (const auto& sf : *this) {
+                result.push_back(sf);
+            }
+        }
+
         /// @returns the surface at a given index @param i - const
         DETRAY_HOST_DEVICE constexpr value_t at(const dindex i) const {
             return (*this)[i];
@@ -153,6 +169,15 @@ class brute_force_collection {
         return {m_surfaces, dindex_range{m_offsets[i], m_offsets[i + 1u]}};
     }
 
+    /// Reserve memory for @param n_colls surface collections with a total of
+    /// @param n_surfaces surfaces
+    DETRAY_HOST void reserve(const std::size_t n_colls,
+                             const std::size_t n_surfaces) {
+        // The start index of the first range is always present
+        m_offsets.reserve(n_colls + 1u);
+        m_surfaces.reserve(n_surfaces);
+    }
+
     /// Add a new surface collection
     template <detray::ranges::range sf_container_t>
     requires std::is_same_v<typename sf_container_t::value_type, value_t>
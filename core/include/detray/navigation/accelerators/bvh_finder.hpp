@@ -0,0 +1,454 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/tracks/ray.hpp"
+#include "detray/utils/bounding_volume.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// A node of a bounding volume hierarchy: Bounding box around all surfaces
+/// of the subtree
+template <concepts::algebra algebra_t>
+struct bvh_node {
+    /// Bounding box in global coordinates
+    axis_aligned_bounding_volume<cuboid3D, algebra_t> box{};
+    /// Index of the left child (inner node) or of the first surface (leaf)
+    dindex first{0u};
+    /// Number of surfaces in a leaf (zero for inner nodes)
+    dindex n_surfaces{0u};
+
+    /// @returns true if the node does not have any children
+    DETRAY_HOST_DEVICE
+    constexpr bool is_leaf() const { return n_surfaces != 0u; }
+};
+
+}  // namespace detail
+
+/// @brief A collection of bounding volume hierarchies, callable by index.
+///
+/// Every volume holds a binary tree of axis aligned bounding boxes in global
+/// coordinates, that is traversed with the track ray. Only the surfaces in the
+/// intersected leaf nodes are returned as candidates, which makes it a good
+/// fit for volumes with irregularly placed surfaces that cannot be binned in a
+/// grid. The nodes of all volumes are stored in a single flat array, with the
+/// children of an inner node stored next to each other. The surfaces of a
+/// volume are reordered, so that every leaf holds a contiguous range of them.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam algebra_t the linear algebra implementation of the boxes.
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+template <concepts::algebra algebra_t, class value_t,
+          typename container_t = host_container_types>
+class bvh_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = dscalar<algebra_t>;
+    using box_type = axis_aligned_bounding_volume<cuboid3D, algebra_t>;
+
+    /// Maximal depth of a tree, determines the traversal stack size
+    static constexpr dindex max_depth{32u};
+
+    using node = detail::bvh_node<algebra_t>;
+
+    /// @brief Iterable over the surfaces in all leaves hit by a ray
+    ///
+    /// The tree is traversed lazily while iterating, so that no candidate
+    /// storage is needed.
+    struct search_range {
+
+        /// Sentinel of the traversal
+        struct sentinel {};
+
+        /// Depth first traversal of the tree
+        class iterator {
+
+            public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = value_t;
+            using pointer = const value_t*;
+            using reference = const value_t&;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() = default;
+
+            /// Start the traversal at the root node of @param range
+            DETRAY_HOST_DEVICE
+            explicit iterator(const search_range& range) : m_range{&range} {
+                if (range.m_nodes.size() != 0u) {
+                    m_stack[m_stack_size++] = 0u;
+                }
+                next_leaf();
+            }
+
+            /// @returns the current surface
+            DETRAY_HOST_DEVICE
+            reference operator*() const { return m_range->m_surfaces[m_sf]; }
+
+            /// Advance to the next surface, possibly in the next leaf
+            DETRAY_HOST_DEVICE
+            iterator& operator++() {
+                ++m_sf;
+                next_leaf();
+                return *this;
+            }
+
+            /// @returns true if all nodes on the stack have been visited
+            DETRAY_HOST_DEVICE
+            constexpr bool operator==(const sentinel&) const {
+                return (m_sf == m_sf_end) && (m_stack_size == 0u);
+            }
+
+            private:
+            /// Pop nodes from the stack until the next leaf with surfaces is
+            /// found that is intersected by the ray
+            DETRAY_HOST_DEVICE
+            void next_leaf() {
+                while (m_sf == m_sf_end && m_stack_size != 0u) {
+                    const node& n = m_range->m_nodes[m_stack[--m_stack_size]];
+
+                    if (!n.box.intersect(m_range->m_ray)) {
+                        continue;
+                    }
+                    if (n.is_leaf()) {
+                        m_sf = n.first;
+                        m_sf_end = n.first + n.n_surfaces;
+                    } else {
+                        assert(m_stack_size + 2u <= max_depth + 1u);
+                        m_stack[m_stack_size++] = n.first + 1u;
+                        m_stack[m_stack_size++] = n.first;
+                    }
+                }
+            }
+
+            /// The surfaces and tree of the volume
+            const search_range* m_range{nullptr};
+            /// Nodes that still need to be visited
+            darray<dindex, max_depth + 1u> m_stack{};
+            dindex m_stack_size{0u};
+            /// Current surface range in a leaf
+            dindex m_sf{0u};
+            dindex m_sf_end{0u};
+        };
+
+        /// @returns the start of the traversal
+        DETRAY_HOST_DEVICE
+        iterator begin() const { return iterator{*this}; }
+
+        /// @returns the sentinel of the traversal
+        DETRAY_HOST_DEVICE
+        constexpr sentinel end() const { return {}; }
+
+        /// The subtree and surfaces of the volume
+        detray::ranges::subrange<const vector_type<node>> m_nodes;
+        detray::ranges::subrange<const vector_type<value_t>> m_surfaces;
+        /// The ray that is tested against the bounding boxes
+        detail::ray<algebra_t> m_ray;
+    };
+
+    /// A nested surface finder that traverses the bounding volume hierarchy
+    /// of a volume. This type will be returned when the surface collection is
+    /// queried for the surfaces of a particular volume.
+    struct bvh_finder {
+
+        /// Default constructor
+        bvh_finder() = default;
+
+        /// Constructor from the node and surface containers and the
+        /// respective ranges of the volume
+        DETRAY_HOST_DEVICE constexpr bvh_finder(
+            const vector_type<node>& nodes, const dindex_range& node_range,
+            const vector_type<value_t>& surfaces, const dindex_range& sf_range)
+            : m_nodes(nodes, node_range), m_surfaces(surfaces, sf_range) {}
+
+        /// @returns the surfaces in all leaves that are intersected by the
+        /// straight line approximation of the @param track
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE auto search(
+            const detector_t& /*det*/,
+            const typename detector_t::volume_type& /*volume*/,
+            const track_t& track, const config_t& /*navigation_config*/,
+            const typename detector_t::geometry_context& /*ctx*/) const {
+            return search(detail::ray<algebra_t>{track.pos(), 0.f,
+                                                 track.dir(), 0.f});
+        }
+
+        /// @returns the surfaces in all leaves that are intersected by the
+        /// ray @param r
+        DETRAY_HOST_DEVICE
+        auto search(const detail::ray<algebra_t>& r) const -> search_range {
+            return {m_nodes, m_surfaces, r};
+        }
+
+        /// @returns the surface at a given index @param i
+        DETRAY_HOST_DEVICE constexpr value_t at(const dindex i) const {
+            return m_surfaces[i];
+        }
+
+        /// @returns the nodes of the tree
+        DETRAY_HOST_DEVICE constexpr auto nodes() const { return m_nodes; }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const { return m_surfaces; }
+
+        private:
+        detray::ranges::subrange<const vector_type<node>> m_nodes;
+        detray::ranges::subrange<const vector_type<value_t>> m_surfaces;
+    };
+
+    using value_type = bvh_finder;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<size_type>,
+                    dvector_view<node>, dvector_view<value_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const size_type>,
+                    dvector_view<const size_type>, dvector_view<const node>,
+                    dvector_view<const value_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<size_type>,
+                      dvector_buffer<node>, dvector_buffer<value_t>>;
+
+    /// Default constructor
+    constexpr bvh_collection() {
+        // Start of first subrange
+        m_node_offsets.push_back(0u);
+        m_sf_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource* resource)
+        : m_node_offsets(resource),
+          m_sf_offsets(resource),
+          m_nodes(resource),
+          m_surfaces(resource) {
+        // Start of first subrange
+        m_node_offsets.push_back(0u);
+        m_sf_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource& resource)
+        : bvh_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view coll_view_t>
+    DETRAY_HOST_DEVICE explicit bvh_collection(coll_view_t& view)
+        : m_node_offsets(detail::get<0>(view.m_view)),
+          m_sf_offsets(detail::get<1>(view.m_view)),
+          m_nodes(detail::get<2>(view.m_view)),
+          m_surfaces(detail::get<3>(view.m_view)) {}
+
+    /// @returns number of trees (one per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_sf_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t>& { return m_surfaces; }
+
+    /// @return access to the surface container - non-const.
+    DETRAY_HOST_DEVICE
+    auto all() -> vector_type<value_t>& { return m_surfaces; }
+
+    /// @return access to the node container - const.
+    DETRAY_HOST_DEVICE
+    auto nodes() const -> const vector_type<node>& { return m_nodes; }
+
+    /// Create the surface finder of the volume tree @param i
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_nodes,
+                dindex_range{m_node_offsets[i], m_node_offsets[i + 1u]},
+                m_surfaces,
+                dindex_range{m_sf_offsets[i], m_sf_offsets[i + 1u]}};
+    }
+
+    /// Build a new tree from the @param surfaces and their global bounding
+    /// boxes @param boxes
+    ///
+    /// The surfaces are split at the median of their box centers along the
+    /// longest axis, until at most @param max_leaf_size surfaces remain.
+    template <detray::ranges::range sf_container_t>
+    requires std::is_same_v<typename sf_container_t::value_type, value_t>
+        DETRAY_HOST auto push_back(const sf_container_t& surfaces,
+                                   const std::vector<box_type>& boxes,
+                                   const dindex max_leaf_size = 4u) noexcept(
+            false) -> void {
+
+        if (surfaces.size() != boxes.size()) {
+            throw std::invalid_argument(
+                "BVH: Number of bounding boxes does not match number of "
+                "surfaces");
+        }
+        if (max_leaf_size == 0u) {
+            throw std::invalid_argument("BVH: Leaves cannot be empty");
+        }
+
+        const auto n_surfaces{static_cast<dindex>(surfaces.size())};
+
+        // Order in which the surfaces end up in the leaves
+        std::vector<dindex> order(n_surfaces);
+        std::iota(order.begin(), order.end(), 0u);
+
+        std::vector<node> tree{};
+        if (n_surfaces != 0u) {
+            tree.reserve(2u * n_surfaces);
+            tree.emplace_back();
+            build(tree, 0u, order, boxes, 0u, n_surfaces, max_leaf_size, 0u);
+        }
+
+        // Add the surfaces in leaf order
+        std::vector<value_t> sorted_sf(surfaces.begin(), surfaces.end());
+        m_surfaces.reserve(m_surfaces.size() + n_surfaces);
+        for (const dindex i : order) {
+            m_surfaces.push_back(sorted_sf[i]);
+        }
+        m_nodes.insert(m_nodes.end(), tree.begin(), tree.end());
+
+        // End of this range is the start of the next range
+        m_node_offsets.push_back(static_cast<dindex>(m_nodes.size()));
+        m_sf_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+    }
+
+    /// @return the view on the trees - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_node_offsets), detray::get_data(m_sf_offsets),
+            detray::get_data(m_nodes), detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the trees - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_node_offsets), detray::get_data(m_sf_offsets),
+            detray::get_data(m_nodes), detray::get_data(m_surfaces)};
+    }
+
+    private:
+    /// Recursively build the subtree below the node at @param node_idx from
+    /// the surfaces in [ @param begin, @param end ) of @param order
+    DETRAY_HOST
+    static void build(std::vector<node>& tree, const dindex node_idx,
+                      std::vector<dindex>& order,
+                      const std::vector<box_type>& boxes, const dindex begin,
+                      const dindex end, const dindex max_leaf_size,
+                      const dindex depth) {
+
+        using point3_t = dpoint3D<algebra_t>;
+
+        // Bounding box around the surfaces and extent of their centers
+        constexpr scalar_type inv{detail::invalid_value<scalar_type>()};
+        darray<scalar_type, 3u> min{inv, inv, inv};
+        darray<scalar_type, 3u> max{-inv, -inv, -inv};
+        darray<scalar_type, 3u> c_min{inv, inv, inv};
+        darray<scalar_type, 3u> c_max{-inv, -inv, -inv};
+        for (dindex i = begin; i < end; ++i) {
+            const box_type& box = boxes[order[i]];
+            const auto box_min = box.template loc_min<point3_t>();
+            const auto box_max = box.template loc_max<point3_t>();
+            const auto center = box.template center<point3_t>();
+
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                min[j] = math::min(min[j], box_min[j]);
+                max[j] = math::max(max[j], box_max[j]);
+                c_min[j] = math::min(c_min[j], center[j]);
+                c_max[j] = math::max(c_max[j], center[j]);
+            }
+        }
+        tree[node_idx].box = box_type{node_idx, min[0], min[1], min[2],
+                                      max[0],   max[1], max[2]};
+
+        // Leaf node
+        const dindex n{end - begin};
+        if (n <= max_leaf_size || depth + 1u == max_depth) {
+            tree[node_idx].first = begin;
+            tree[node_idx].n_surfaces = n;
+            return;
+        }
+
+        // Split at the median along the longest axis of the box centers
+        unsigned int axis{0u};
+        for (unsigned int j = 1u; j < 3u; ++j) {
+            if (c_max[j] - c_min[j] > c_max[axis] - c_min[axis]) {
+                axis = j;
+            }
+        }
+        const dindex mid{begin + n / 2u};
+        std::nth_element(order.begin() + begin, order.begin() + mid,
+                         order.begin() + end,
+                         [&boxes, axis](const dindex a, const dindex b) {
+                             return boxes[a].template center<point3_t>()[axis] <
+                                    boxes[b].template center<point3_t>()[axis];
+                         });
+
+        // The children are stored next to each other
+        const auto left{static_cast<dindex>(tree.size())};
+        tree[node_idx].first = left;
+        tree[node_idx].n_surfaces = 0u;
+        tree.resize(tree.size() + 2u);
+
+        build(tree, left, order, boxes, begin, mid, max_leaf_size, depth + 1u);
+        build(tree, left + 1u, order, boxes, mid, end, max_leaf_size,
+              depth + 1u);
+    }
+
+    /// Offsets for the respective volumes into the node storage
+    vector_type<size_type> m_node_offsets{};
+    /// Offsets for the respective volumes into the surface storage
+    vector_type<size_type> m_sf_offsets{};
+    /// The nodes of all trees
+    vector_type<node> m_nodes{};
+    /// The storage for all surface handles, sorted by leaf
+    vector_type<value_t> m_surfaces{};
+};
+
+}  // namespace detray
@@ -0,0 +1,343 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/cylinder3D.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace detray {
+
+namespace detail {
+
+/// Regular binning of one axis of the coarse volume grid
+template <concepts::scalar scalar_t>
+struct coarse_axis {
+    /// Lower edge of the axis
+    scalar_t min{0.f};
+    /// Inverse bin width
+    scalar_t inv_width{0.f};
+    /// Number of bins
+    dindex n_bins{0u};
+
+    /// @returns the bin of the value @param v, or @c dindex_invalid if the
+    /// value is outside of the axis span (the upper edge is included)
+    DETRAY_HOST_DEVICE
+    constexpr dindex bin(const scalar_t v) const {
+        const scalar_t b{(v - min) * inv_width};
+        if (b < 0.f || b > static_cast<scalar_t>(n_bins)) {
+            return dindex_invalid;
+        }
+        const auto i{static_cast<dindex>(b)};
+        return i < n_bins ? i : n_bins - 1u;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Two-level search for the volume that contains a global position.
+///
+/// A coarse, regular grid in cylindrical coordinates (r, phi, z) holds a list
+/// of candidate volumes per cell, namely all volumes whose cylindrical extent
+/// overlaps with the cell. A query looks up the cell of the position and then
+/// checks the position precisely against the extents of the candidates. The
+/// cost of a query is therefore bounded by the longest candidate list
+/// (@see max_candidates ), independent of the volume layout.
+///
+/// The class can be used as the @c volume_finder of a detector.
+///
+/// @tparam algebra_t the algebra type of the volume extents.
+/// @tparam container_t the types of underlying containers to be used.
+template <concepts::algebra algebra_t,
+          typename container_t = host_container_types>
+class hierarchical_volume_finder {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    /// Cylindrical extent of a volume, linked to the volume index
+    using extent_type = mask<cylinder3D, algebra_t, dindex>;
+    using axis_type = detail::coarse_axis<scalar_type>;
+
+    using view_type =
+        dmulti_view<dvector_view<axis_type>, dvector_view<size_type>,
+                    dvector_view<dindex>, dvector_view<extent_type>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const axis_type>,
+                    dvector_view<const size_type>, dvector_view<const dindex>,
+                    dvector_view<const extent_type>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<axis_type>, dvector_buffer<size_type>,
+                      dvector_buffer<dindex>, dvector_buffer<extent_type>>;
+
+    /// Default constructor
+    constexpr hierarchical_volume_finder() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr hierarchical_volume_finder(
+        vecmem::memory_resource* resource)
+        : m_axes(resource),
+          m_cell_offsets(resource),
+          m_candidates(resource),
+          m_extents(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr hierarchical_volume_finder(
+        vecmem::memory_resource& resource)
+        : hierarchical_volume_finder(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view finder_view_t>
+    DETRAY_HOST_DEVICE explicit hierarchical_volume_finder(
+        finder_view_t& view)
+        : m_axes(detail::get<0>(view.m_view)),
+          m_cell_offsets(detail::get<1>(view.m_view)),
+          m_candidates(detail::get<2>(view.m_view)),
+          m_extents(detail::get<3>(view.m_view)) {}
+
+    /// @returns the number of cells in the coarse grid
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return m_cell_offsets.empty()
+                   ? 0u
+                   : static_cast<size_type>(m_cell_offsets.size()) - 1u;
+    }
+
+    /// @returns true if the coarse grid has not been built
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @returns the candidate volume indices of all cells
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<dindex>& { return m_candidates; }
+
+    /// @returns the volume extents, indexed by volume index
+    DETRAY_HOST_DEVICE
+    auto extents() const -> const vector_type<extent_type>& {
+        return m_extents;
+    }
+
+    /// @returns the candidate volume indices of the cell that contains the
+    /// global position @param p (empty if outside of the grid)
+    DETRAY_HOST_DEVICE
+    auto candidates(const point3_type& p) const {
+        const dindex c{cell(p)};
+        if (c == dindex_invalid) {
+            return detray::ranges::subrange(m_candidates, dindex_range{0u, 0u});
+        }
+        return detray::ranges::subrange(
+            m_candidates,
+            dindex_range{m_cell_offsets[c], m_cell_offsets[c + 1u]});
+    }
+
+    /// @returns the index of the volume that contains the global position
+    /// @param p, or @c dindex_invalid if no such volume was found
+    DETRAY_HOST_DEVICE
+    dindex search(const point3_type& p) const {
+        const dindex c{cell(p)};
+        if (c == dindex_invalid) {
+            return dindex_invalid;
+        }
+
+        const point3_type loc_p{vector::perp(p), vector::phi(p), p[2]};
+        for (dindex i = m_cell_offsets[c]; i < m_cell_offsets[c + 1u]; ++i) {
+            const dindex vol_idx{m_candidates[i]};
+            if (m_extents[vol_idx].is_inside(loc_p, tolerance)) {
+                return vol_idx;
+            }
+        }
+        return dindex_invalid;
+    }
+
+    /// @returns the length of the longest candidate list, i.e. the maximal
+    /// number of precise checks that a query needs
+    DETRAY_HOST_DEVICE
+    dindex max_candidates() const {
+        dindex n_max{0u};
+        for (dindex c = 0u; c < size(); ++c) {
+            const dindex n{m_cell_offsets[c + 1u] - m_cell_offsets[c]};
+            n_max = n > n_max ? n : n_max;
+        }
+        return n_max;
+    }
+
+    /// Add the cylindrical extent @param ext of a volume. The volume index is
+    /// taken from the volume link of the extent.
+    ///
+    /// @note Invalidates the coarse grid, which needs to be rebuilt
+    DETRAY_HOST
+    void push_back(const extent_type& ext) {
+        const dindex vol_idx{ext.volume_link()};
+        if (vol_idx == dindex_invalid) {
+            throw std::invalid_argument(
+                "Volume finder: Extent is not linked to a volume");
+        }
+        if (vol_idx >= m_extents.size()) {
+            m_extents.resize(vol_idx + 1u);
+        }
+        m_extents[vol_idx] = ext;
+
+        m_axes.clear();
+        m_cell_offsets.clear();
+        m_candidates.clear();
+    }
+
+    /// Build the coarse grid over the union of all volume extents with
+    /// @param n_bins bins in r, phi and z and fill the candidate lists
+    DETRAY_HOST
+    void build(const darray<dindex, 3>& n_bins) {
+        using shape_t = cylinder3D;
+
+        if (n_bins[0] == 0u || n_bins[1] == 0u || n_bins[2] == 0u) {
+            throw std::invalid_argument(
+                "Volume finder: Number of bins must be larger than zero");
+        }
+
+        // Span of the grid: Union of all volume extents
+        constexpr auto inf{std::numeric_limits<scalar_type>::max()};
+        darray<scalar_type, 3> lower{inf, -constant<scalar_type>::pi, inf};
+        darray<scalar_type, 3> upper{-inf, constant<scalar_type>::pi, -inf};
+        for (const extent_type& ext : m_extents) {
+            if (ext.volume_link() == dindex_invalid) {
+                continue;
+            }
+            lower[0] = math::min(lower[0], ext[shape_t::e_min_r]);
+            lower[2] = math::min(lower[2], ext[shape_t::e_min_z]);
+            upper[0] = math::max(upper[0], ext[shape_t::e_max_r]);
+            upper[2] = math::max(upper[2], ext[shape_t::e_max_z]);
+        }
+
+        m_axes.clear();
+        m_cell_offsets.clear();
+        m_candidates.clear();
+        if (!(lower[0] < upper[0])) {
+            return;
+        }
+
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            m_axes.push_back(
+                {lower[i],
+                 static_cast<scalar_type>(n_bins[i]) / (upper[i] - lower[i]),
+                 n_bins[i]});
+        }
+
+        // Fill the candidates of every cell (phi is the fastest index)
+        m_cell_offsets.push_back(0u);
+        for (dindex iz = 0u; iz < n_bins[2]; ++iz) {
+            for (dindex ir = 0u; ir < n_bins[0]; ++ir) {
+                for (dindex iphi = 0u; iphi < n_bins[1]; ++iphi) {
+                    const darray<dindex, 3> bin{ir, iphi, iz};
+                    for (const extent_type& ext : m_extents) {
+                        if (ext.volume_link() != dindex_invalid &&
+                            overlaps(ext, bin)) {
+                            m_candidates.push_back(ext.volume_link());
+                        }
+                    }
+                    m_cell_offsets.push_back(
+                        static_cast<dindex>(m_candidates.size()));
+                }
+            }
+        }
+    }
+
+    /// @return the view on the volume finder - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_axes), detray::get_data(m_cell_offsets),
+            detray::get_data(m_candidates), detray::get_data(m_extents)};
+    }
+
+    /// @return the view on the volume finder - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_axes), detray::get_data(m_cell_offsets),
+            detray::get_data(m_candidates), detray::get_data(m_extents)};
+    }
+
+    private:
+    /// Tolerance of the precise check against the volume extents
+    static constexpr scalar_type tolerance{
+        std::numeric_limits<scalar_type>::epsilon()};
+
+    /// @returns the global index of the cell that contains @param p
+    DETRAY_HOST_DEVICE
+    dindex cell(const point3_type& p) const {
+        if (m_axes.size() != 3u) {
+            return dindex_invalid;
+        }
+        const dindex ir{m_axes[0].bin(vector::perp(p))};
+        const dindex iz{m_axes[2].bin(p[2])};
+        if (ir == dindex_invalid || iz == dindex_invalid) {
+            return dindex_invalid;
+        }
+        // Skip the phi calculation for a grid without phi binning
+        const dindex iphi{
+            m_axes[1].n_bins > 1u ? m_axes[1].bin(vector::phi(p)) : 0u};
+        return (iz * m_axes[0].n_bins + ir) * m_axes[1].n_bins + iphi;
+    }
+
+    /// @returns true if the extent @param ext overlaps with the cell @param bin
+    DETRAY_HOST
+    bool overlaps(const extent_type& ext, const darray<dindex, 3>& bin) const {
+        using shape_t = cylinder3D;
+
+        constexpr darray<unsigned int, 3> min_idx{
+            shape_t::e_min_r, shape_t::e_min_phi, shape_t::e_min_z};
+        constexpr darray<unsigned int, 3> max_idx{
+            shape_t::e_max_r, shape_t::e_max_phi, shape_t::e_max_z};
+
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            const axis_type& ax = m_axes[i];
+            const scalar_type width{1.f / ax.inv_width};
+            const scalar_type lo{ax.min +
+                                 static_cast<scalar_type>(bin[i]) * width};
+            if (ext[max_idx[i]] < lo - tolerance ||
+                lo + width + tolerance < ext[min_idx[i]]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Binning of the coarse grid in r, phi and z
+    vector_type<axis_type> m_axes{};
+    /// Offsets of the candidate lists per cell
+    vector_type<size_type> m_cell_offsets{};
+    /// Candidate volume indices of all cells
+    vector_type<dindex> m_candidates{};
+    /// Cylindrical extents of the volumes, indexed by volume index
+    vector_type<extent_type> m_extents{};
+};
+
+}  // namespace detray
@@ -0,0 +1,535 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/tracks/ray.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail {
+
+/// A block of surfaces of the same shape in SoA layout: Every lane of
+/// the SIMD vectors holds the placement and the mask of one surface.
+template <algebra::concepts::soa soa_algebra_t, typename shape_t>
+struct packed_surface_block {
+
+    using scalar_type = dscalar<soa_algebra_t>;
+    using transform3_type = dtransform3D<soa_algebra_t>;
+    using mask_type = mask<shape_t, soa_algebra_t>;
+
+    /// Number of surfaces in a block
+    static constexpr dindex width{static_cast<dindex>(scalar_type::size())};
+
+    /// Surface placements
+    transform3_type transforms{};
+    /// Surface masks
+    mask_type masks{};
+    /// Index of the surface in the first lane (in the volume surface range)
+    dindex first{0u};
+    /// Number of lanes that hold a surface
+    dindex n_lanes{0u};
+};
+
+}  // namespace detail
+
+/// @brief A collection of brute force surface finders that test the surfaces
+/// of a given shape block-wise with a SIMD ray intersection.
+///
+/// The shape can be planar or a line (e.g. the wire cells and straw tubes of
+/// a wire chamber), for which the SoA ray-line intersector is used.
+///
+/// At build time, the surfaces of a volume that have the shape @tparam shape_t
+/// are packed into blocks, that hold the transforms and masks of as many
+/// surfaces as the SIMD width of the @tparam soa_algebra_t (e.g. @c vc_soa ).
+/// During the neighborhood search, a track is tested against a whole block at
+/// once and only the surfaces that are hit are returned as candidates. All
+/// other surfaces of the volume are returned without a test, like in the
+/// @c brute_force_collection.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam soa_algebra_t the SoA algebra implementation of the blocks.
+/// @tparam shape_t the planar or line shape of the packed surfaces.
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+template <algebra::concepts::soa soa_algebra_t, typename shape_t,
+          class value_t, typename container_t = host_container_types>
+class packed_brute_force_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using block_type = detail::packed_surface_block<soa_algebra_t, shape_t>;
+    using simd_scalar_type = typename block_type::scalar_type;
+    using shape = shape_t;
+
+    static_assert(block_type::width <= 32u,
+                  "Block hit mask can hold at most 32 surfaces");
+
+    /// The SoA intersector for the packed surfaces
+    using intersector_type = ray_intersector<shape_t, soa_algebra_t>;
+
+    /// @brief Iterable over the unpacked surfaces and the packed surfaces that
+    /// are hit by a ray
+    ///
+    /// The blocks are tested lazily while iterating, so that no candidate
+    /// storage is needed.
+    template <typename ray_t>
+    struct search_range {
+
+        /// Sentinel of the search
+        struct sentinel {};
+
+        /// Visits the unpacked surfaces first, then the hits per block
+        class iterator {
+
+            public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = value_t;
+            using pointer = const value_t*;
+            using reference = const value_t&;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() = default;
+
+            /// Start the search in @param range
+            DETRAY_HOST_DEVICE
+            explicit iterator(const search_range& range) : m_range{&range} {
+                if (m_sf == n_unpacked()) {
+                    next_block();
+                }
+            }
+
+            /// @returns the current surface
+            DETRAY_HOST_DEVICE
+            reference operator*() const {
+                if (m_sf < n_unpacked()) {
+                    return m_range->m_surfaces[m_sf];
+                }
+                const block_type& b = m_range->m_blocks[m_block];
+                return m_range->m_surfaces[b.first +
+                                           static_cast<dindex>(
+                                               std::countr_zero(m_lanes))];
+            }
+
+            /// Advance to the next surface, possibly in the next block
+            DETRAY_HOST_DEVICE
+            iterator& operator++() {
+                if (m_sf < n_unpacked()) {
+                    if (++m_sf == n_unpacked()) {
+                        next_block();
+                    }
+                    return *this;
+                }
+                // Clear the current lane
+                m_lanes &= m_lanes - 1u;
+                if (m_lanes == 0u) {
+                    ++m_block;
+                    next_block();
+                }
+                return *this;
+            }
+
+            /// @returns true if all blocks have been tested
+            DETRAY_HOST_DEVICE
+            constexpr bool operator==(const sentinel&) const {
+                return (m_sf == n_unpacked()) &&
+                       (m_block == m_range->m_blocks.size());
+            }
+
+            private:
+            /// @returns the number of surfaces that are not packed
+            DETRAY_HOST_DEVICE
+            constexpr dindex n_unpacked() const {
+                return m_range->m_blocks.size() == 0u
+                           ? static_cast<dindex>(m_range->m_surfaces.size())
+                           : m_range->m_blocks[0].first;
+            }
+
+            /// Test the blocks until a block with at least one hit is found
+            DETRAY_HOST_DEVICE
+            void next_block() {
+                const auto n_blocks{
+                    static_cast<dindex>(m_range->m_blocks.size())};
+
+                for (; m_block < n_blocks; ++m_block) {
+                    const block_type& b = m_range->m_blocks[m_block];
+
+                    const auto is = intersector_type{}(
+                        m_range->m_ray, m_range->m_surfaces[b.first], b.masks,
+                        b.transforms, m_range->m_mask_tolerance,
+                        m_range->m_mask_tol_scalor,
+                        m_range->m_overstep_tolerance);
+
+                    m_lanes = 0u;
+                    for (dindex l = 0u; l < b.n_lanes; ++l) {
+                        if (is.status[l]) {
+                            m_lanes |= (1u << l);
+                        }
+                    }
+                    if (m_lanes != 0u) {
+                        return;
+                    }
+                }
+            }
+
+            /// The surfaces and blocks of the volume
+            const search_range* m_range{nullptr};
+            /// Current unpacked surface
+            dindex m_sf{0u};
+            /// Current block and its lanes that are hit, but not yet visited
+            dindex m_block{0u};
+            std::uint32_t m_lanes{0u};
+        };
+
+        /// @returns the start of the search
+        DETRAY_HOST_DEVICE
+        iterator begin() const { return iterator{*this}; }
+
+        /// @returns the sentinel of the search
+        DETRAY_HOST_DEVICE
+        constexpr sentinel end() const { return {}; }
+
+        /// The surfaces and blocks of the volume
+        detray::ranges::subrange<const vector_type<value_t>> m_surfaces;
+        detray::ranges::subrange<const vector_type<block_type>> m_blocks;
+        /// The ray that is tested against the blocks
+        ray_t m_ray;
+        /// Tolerances of the intersection
+        darray<simd_scalar_type, 2u> m_mask_tolerance;
+        simd_scalar_type m_mask_tol_scalor;
+        simd_scalar_type m_overstep_tolerance;
+    };
+
+    /// A nested surface finder that tests the packed surfaces of a volume
+    /// and returns the unpacked ones (brute force). This type will be
+    /// returned when the surface collection is queried for the surfaces of a
+    /// particular volume.
+    struct packed_brute_forcer {
+
+        /// Default constructor
+        packed_brute_forcer() = default;
+
+        /// Constructor from the surface and block containers and the
+        /// respective ranges of the volume
+        DETRAY_HOST_DEVICE constexpr packed_brute_forcer(
+            const vector_type<value_t>& surfaces, const dindex_range& sf_range,
+            const vector_type<block_type>& blocks,
+            const dindex_range& block_range)
+            : m_surfaces(surfaces, sf_range), m_blocks(blocks, block_range) {}
+
+        /// @returns the unpacked surfaces and the packed surfaces that are
+        /// hit by the straight line approximation of the @param track
+        ///
+        /// @note the path dependent mask tolerance of the navigation config
+        /// is evaluated for all lanes of a block at once, so that no surface
+        /// is missed that the navigator would accept
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE auto search(
+            const detector_t& /*det*/,
+            const typename detector_t::volume_type& /*volume*/,
+            const track_t& track, const config_t& cfg,
+            const typename detector_t::geometry_context& /*ctx*/) const {
+            using algebra_t = typename detector_t::algebra_type;
+
+            return search(
+                detail::ray<algebra_t>{track.pos(), 0.f, track.dir(), 0.f},
+                darray<float, 2u>{cfg.min_mask_tolerance,
+                                  cfg.max_mask_tolerance},
+                cfg.mask_tolerance_scalor, cfg.overstep_tolerance);
+        }
+
+        /// @returns the unpacked surfaces and the packed surfaces that are
+        /// hit by the ray @param r within the tolerances @param mask_tol and
+        /// @param overstep_tol
+        template <typename ray_t>
+        DETRAY_HOST_DEVICE auto search(const ray_t& r, const float mask_tol,
+                                       const float overstep_tol) const
+            -> search_range<ray_t> {
+            return search(r, darray<float, 2u>{mask_tol, mask_tol}, 0.f,
+                          overstep_tol);
+        }
+
+        /// @returns the unpacked surfaces and the packed surfaces that are
+        /// hit by the ray @param r, where the mask tolerance grows with the
+        /// distance to every surface of a block
+        /// (@see detail::path_mask_tolerance )
+        ///
+        /// @param mask_tol minimal and maximal mask tolerance
+        /// @param mask_tol_scalor scale factor on the distance
+        /// @param overstep_tol the overstep tolerance
+        template <typename ray_t>
+        DETRAY_HOST_DEVICE auto search(const ray_t& r,
+                                       const darray<float, 2u>& mask_tol,
+                                       const float mask_tol_scalor,
+                                       const float overstep_tol) const
+            -> search_range<ray_t> {
+            // Broadcast once for all blocks
+            return {m_surfaces,
+                    m_blocks,
+                    r,
+                    detail::broadcast_mask_tolerance<simd_scalar_type>(
+                        mask_tol),
+                    simd_scalar_type(mask_tol_scalor),
+                    simd_scalar_type(overstep_tol)};
+        }
+
+        /// @returns the surface at a given index @param i
+        DETRAY_HOST_DEVICE constexpr value_t at(const dindex i) const {
+            return m_surfaces[i];
+        }
+
+        /// @returns the blocks of packed surfaces
+        DETRAY_HOST_DEVICE constexpr auto blocks() const { return m_blocks; }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const { return m_surfaces; }
+
+        private:
+        detray::ranges::subrange<const vector_type<value_t>> m_surfaces;
+        detray::ranges::subrange<const vector_type<block_type>> m_blocks;
+    };
+
+    using value_type = packed_brute_forcer;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<size_type>,
+                    dvector_view<value_t>, dvector_view<block_type>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const size_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const value_t>,
+                    dvector_view<const block_type>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<size_type>,
+                      dvector_buffer<value_t>, dvector_buffer<block_type>>;
+
+    /// Default constructor
+    constexpr packed_brute_force_collection() {
+        // Start of first subrange
+        m_offsets.push_back(0u);
+        m_block_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr packed_brute_force_collection(
+        vecmem::memory_resource* resource)
+        : m_offsets(resource),
+          m_block_offsets(resource),
+          m_surfaces(resource),
+          m_blocks(resource) {
+        // Start of first subrange
+        m_offsets.push_back(0u);
+        m_block_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr packed_brute_force_collection(
+        vecmem::memory_resource& resource)
+        : packed_brute_force_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view coll_view_t>
+    DETRAY_HOST_DEVICE explicit packed_brute_force_collection(
+        coll_view_t& view)
+        : m_offsets(detail::get<0>(view.m_view)),
+          m_block_offsets(detail::get<1>(view.m_view)),
+          m_surfaces(detail::get<2>(view.m_view)),
+          m_blocks(detail::get<3>(view.m_view)) {}
+
+    /// @returns number of surface collections (at least on per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t>& { return m_surfaces; }
+
+    /// @return access to the surface container - non-const.
+    DETRAY_HOST_DEVICE
+    auto all() -> vector_type<value_t>& { return m_surfaces; }
+
+    /// @return access to the block container - const.
+    DETRAY_HOST_DEVICE
+    auto blocks() const -> const vector_type<block_type>& { return m_blocks; }
+
+    /// Create the surface finder of the volume @param i
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_surfaces, dindex_range{m_offsets[i], m_offsets[i + 1u]},
+                m_blocks,
+                dindex_range{m_block_offsets[i], m_block_offsets[i + 1u]}};
+    }
+
+    /// Add a new surface collection without packed surfaces
+    template <detray::ranges::range sf_container_t>
+    requires std::is_same_v<typename sf_container_t::value_type, value_t>
+        DETRAY_HOST auto push_back(const sf_container_t& surfaces) noexcept(
+            false) -> void {
+        m_surfaces.reserve(m_surfaces.size() + surfaces.size());
+        m_surfaces.insert(m_surfaces.end(), surfaces.begin(), surfaces.end());
+        // End of this range is the start of the next range
+        m_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+        m_block_offsets.push_back(static_cast<dindex>(m_blocks.size()));
+    }
+
+    /// Add a new surface collection
+    ///
+    /// @param surfaces the surfaces that are always returned
+    /// @param packed_surfaces the surfaces that are packed into blocks
+    /// @param masks the (AoS) masks of the packed surfaces
+    /// @param transforms the (AoS) placements of the packed surfaces
+    template <detray::ranges::range sf_container_t,
+              detray::ranges::range packed_container_t,
+              detray::ranges::range mask_container_t,
+              detray::ranges::range transform_container_t>
+    requires std::is_same_v<typename sf_container_t::value_type, value_t>&&
+        std::is_same_v<typename packed_container_t::value_type, value_t>&&
+            std::is_same_v<typename mask_container_t::value_type::shape,
+                           shape_t>
+                DETRAY_HOST auto push_back(
+                    const sf_container_t& surfaces,
+                    const packed_container_t& packed_surfaces,
+                    const mask_container_t& masks,
+                    const transform_container_t& transforms) noexcept(false)
+                    -> void {
+
+        if (packed_surfaces.size() != masks.size() ||
+            packed_surfaces.size() != transforms.size()) {
+            throw std::invalid_argument(
+                "Packed brute force: Number of masks or transforms does not "
+                "match number of surfaces");
+        }
+
+        const auto vol_offset{static_cast<dindex>(m_offsets.back())};
+        m_surfaces.reserve(m_surfaces.size() + surfaces.size() +
+                           packed_surfaces.size());
+        m_surfaces.insert(m_surfaces.end(), surfaces.begin(), surfaces.end());
+
+        const auto n_packed{static_cast<dindex>(packed_surfaces.size())};
+        for (dindex i = 0u; i < n_packed; i += block_type::width) {
+            const dindex n{n_packed - i < block_type::width
+                               ? n_packed - i
+                               : block_type::width};
+            const auto first{static_cast<dindex>(m_surfaces.size()) -
+                             vol_offset};
+
+            m_blocks.push_back(pack(masks, transforms, i, n, first));
+            m_surfaces.insert(m_surfaces.end(), packed_surfaces.begin() + i,
+                              packed_surfaces.begin() + i + n);
+        }
+
+        // End of this range is the start of the next range
+        m_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+        m_block_offsets.push_back(static_cast<dindex>(m_blocks.size()));
+    }
+
+    /// @return the view on the surface finders - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_offsets), detray::get_data(m_block_offsets),
+            detray::get_data(m_surfaces), detray::get_data(m_blocks)};
+    }
+
+    /// @return the view on the surface finders - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_offsets), detray::get_data(m_block_offsets),
+            detray::get_data(m_surfaces), detray::get_data(m_blocks)};
+    }
+
+    private:
+    /// Pack @param n masks and transforms starting at @param offset into a
+    /// block. The unused lanes repeat the first surface.
+    template <typename mask_container_t, typename transform_container_t>
+    DETRAY_HOST static auto pack(const mask_container_t& masks,
+                                 const transform_container_t& trfs,
+                                 const dindex offset, const dindex n,
+                                 const dindex first) -> block_type {
+
+        using vector3_t = dvector3D<soa_algebra_t>;
+        using mask_values_t = typename block_type::mask_type::mask_values;
+
+        vector3_t t{};
+        vector3_t z{};
+        vector3_t x{};
+        mask_values_t values{};
+
+        for (dindex l = 0u; l < block_type::width; ++l) {
+            const dindex i{offset + (l < n ? l : 0u)};
+
+            const auto trl = trfs[i].translation();
+            const auto z_axis = trfs[i].z();
+            const auto x_axis = trfs[i].x();
+            for (unsigned int c = 0u; c < 3u; ++c) {
+                t[c][l] = trl[c];
+                z[c][l] = z_axis[c];
+                x[c][l] = x_axis[c];
+            }
+            for (std::size_t j = 0u; j < values.size(); ++j) {
+                values[j][l] = masks[i].values()[j];
+            }
+        }
+
+        block_type block{};
+        block.transforms = typename block_type::transform3_type{t, z, x};
+        block.masks = typename block_type::mask_type{values, 0u};
+        block.first = first;
+        block.n_lanes = n;
+
+        return block;
+    }
+
+    /// Offsets for the respective volumes into the surface storage
+    vector_type<size_type> m_offsets{};
+    /// Offsets for the respective volumes into the block storage
+    vector_type<size_type> m_block_offsets{};
+    /// The storage for all surface handles: Per volume, the unpacked surfaces
+    /// followed by the packed surfaces in block order
+    vector_type<value_t> m_surfaces{};
+    /// The blocks of packed surfaces of all volumes
+    vector_type<block_type> m_blocks{};
+};
+
+}  // namespace detray
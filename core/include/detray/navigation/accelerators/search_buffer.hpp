@@ -0,0 +1,101 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Small, fixed size buffer of surface indices.
+///
+/// Accelerators can write the result of a neighborhood search into this
+/// buffer (@c search_into ), instead of returning a composition of range
+/// views (e.g. a @c join over the bins of a grid search window). The buffer
+/// lives on the stack of the caller and is iterated as a contiguous array.
+///
+/// If the search yields more surfaces than the buffer can hold, the
+/// remaining surfaces are dropped and the buffer is marked as overflowed, so
+/// that the caller can fall back to the range based search.
+///
+/// @tparam CAPACITY the maximal number of surface indices
+template <std::size_t CAPACITY = 64u>
+class search_buffer {
+
+    public:
+    using value_type = dindex;
+    using size_type = dindex;
+
+    /// Add the surface @param sf to the buffer: Either a surface index or
+    /// a surface descriptor
+    template <typename entry_t>
+    DETRAY_HOST_DEVICE constexpr void push_back(const entry_t &sf) {
+        if (m_size == CAPACITY) {
+            m_overflow = true;
+            return;
+        }
+        if constexpr (std::is_integral_v<entry_t>) {
+            m_indices[m_size++] = static_cast<dindex>(sf);
+        } else {
+            m_indices[m_size++] = sf.index();
+        }
+    }
+
+    /// Remove all entries
+    DETRAY_HOST_DEVICE constexpr void clear() {
+        m_size = 0u;
+        m_overflow = false;
+    }
+
+    /// @returns the surface index at position @param i
+    DETRAY_HOST_DEVICE constexpr dindex operator[](const size_type i) const {
+        assert(i < m_size);
+        return m_indices[i];
+    }
+
+    /// @returns the number of surface indices in the buffer
+    DETRAY_HOST_DEVICE constexpr size_type size() const { return m_size; }
+
+    /// @returns the maximal number of surface indices
+    DETRAY_HOST_DEVICE static constexpr size_type capacity() {
+        return static_cast<size_type>(CAPACITY);
+    }
+
+    /// @returns true if the buffer does not hold any surface index
+    DETRAY_HOST_DEVICE constexpr bool empty() const { return m_size == 0u; }
+
+    /// @returns true if surfaces were dropped, because the buffer was full
+    DETRAY_HOST_DEVICE constexpr bool overflow() const { return m_overflow; }
+
+    /// @returns pointer to the first surface index
+    DETRAY_HOST_DEVICE constexpr const dindex *begin() const {
+        return m_indices.data();
+    }
+
+    /// @returns pointer past the last surface index
+    DETRAY_HOST_DEVICE constexpr const dindex *end() const {
+        return m_indices.data() + m_size;
+    }
+
+    private:
+    /// Number of valid entries
+    size_type m_size{0u};
+    /// Whether surfaces were dropped
+    bool m_overflow{false};
+    /// The surface indices (not initialized beyond @c m_size )
+    darray<dindex, CAPACITY> m_indices;
+};
+
+}  // namespace detray
@@ -0,0 +1,363 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/navigation/navigation_config.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Navigates a fixed-size batch of tracks in lock-step.
+///
+/// Wraps a scalar navigator and drives the @c init() and @c update() calls of
+/// @tparam batch_size tracks together. Every track (lane) keeps its own
+/// navigation state and lanes that are no longer alive are masked out of the
+/// batch, so that a batch can be refilled lane by lane by the caller. The
+/// distances to the next candidates of all lanes are gathered into one
+/// contiguous array, which is the input layout expected by a batched (SoA)
+/// stepper.
+///
+/// If an SoA algebra @tparam soa_algebra_t (e.g. @c vc_soa ) is given, the
+/// tracks of a bundle (@see init_bundle ) are gathered into the lanes of its
+/// SIMD vectors and every shared surface is intersected with all tracks in
+/// one call of the SoA ray intersectors
+/// (@see navigator::init_lanes_from_neighborhood ). The batch size should
+/// then be a multiple of the SIMD width. Without an SoA algebra, and for all
+/// other calls, the lanes are navigated one after the other by the scalar
+/// navigator.
+///
+/// @tparam navigator_t the scalar navigator type that handles a single lane
+/// @tparam batch_size the number of tracks that are navigated per call
+/// @tparam soa_algebra_t the SoA algebra to intersect the bundle with
+///                       (void: scalar intersection per lane)
+template <typename navigator_t, std::size_t batch_size = 8u,
+          typename soa_algebra_t = void>
+class batched_navigator {
+
+    static_assert(batch_size > 0u, "Batch needs to contain at least one lane");
+    static_assert(batch_size <= 32u,
+                  "Lane mask can hold at most 32 tracks per batch");
+    static_assert(std::is_void_v<soa_algebra_t> ||
+                      algebra::concepts::soa<soa_algebra_t>,
+                  "Bundles can only be intersected with an SoA algebra");
+
+    public:
+    using navigator_type = navigator_t;
+    using detector_type = typename navigator_t::detector_type;
+    using context_type = typename navigator_t::context_type;
+    using scalar_type = typename navigator_t::scalar_type;
+    using intersection_type = typename navigator_t::intersection_type;
+    using lane_state_type = typename navigator_t::state;
+    using neighborhood_type = typename navigator_t::bundle_neighborhood;
+
+    /// Bitmask type that flags the active lanes of the batch
+    using lane_mask_type = std::uint32_t;
+
+    /// @returns the number of lanes in the batch
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t size() { return batch_size; }
+
+    /// @brief The navigation state of the batch.
+    ///
+    /// Holds one navigation state per lane and the mask of lanes that
+    /// still take part in the navigation.
+    class state {
+
+        friend class batched_navigator;
+
+        public:
+        /// Default constructor (needs a detector)
+        state() = delete;
+
+        /// Construct all lanes from the same detector @param det
+        DETRAY_HOST_DEVICE
+        explicit state(const detector_type &det)
+            : state(det, std::make_index_sequence<batch_size>{}) {}
+
+        /// @returns the navigation state of lane @param i
+        DETRAY_HOST_DEVICE
+        constexpr lane_state_type &operator[](const std::size_t i) {
+            assert(i < batch_size);
+            return m_lanes[i];
+        }
+
+        /// @returns the navigation state of lane @param i - const
+        DETRAY_HOST_DEVICE
+        constexpr const lane_state_type &operator[](const std::size_t i) const {
+            assert(i < batch_size);
+            return m_lanes[i];
+        }
+
+        /// @returns the mask of lanes that are active in the batch
+        DETRAY_HOST_DEVICE
+        constexpr lane_mask_type active_lanes() const { return m_active; }
+
+        /// @returns true if lane @param i takes part in the navigation
+        DETRAY_HOST_DEVICE
+        constexpr bool is_active(const std::size_t i) const {
+            assert(i < batch_size);
+            return (m_active >> i) & 1u;
+        }
+
+        /// Add lane @param i back into the batch (e.g. after refilling it)
+        DETRAY_HOST_DEVICE
+        constexpr void activate(const std::size_t i) {
+            assert(i < batch_size);
+            m_active |= (lane_mask_type{1u} << i);
+        }
+
+        /// Remove lane @param i from the batch
+        DETRAY_HOST_DEVICE
+        constexpr void deactivate(const std::size_t i) {
+            assert(i < batch_size);
+            m_active &= ~(lane_mask_type{1u} << i);
+        }
+
+        /// @returns the number of active lanes
+        DETRAY_HOST_DEVICE
+        constexpr std::size_t n_active() const {
+            std::size_t n{0u};
+            for (std::size_t i = 0u; i < batch_size; ++i) {
+                n += is_active(i) ? 1u : 0u;
+            }
+            return n;
+        }
+
+        /// @returns true if at least one lane is still alive
+        DETRAY_HOST_DEVICE
+        constexpr bool is_alive() const { return m_active != 0u; }
+
+        /// @returns true if the lanes are navigated as a bundle
+        /// (@see init_bundle )
+        DETRAY_HOST_DEVICE
+        constexpr bool is_bundle() const { return m_is_bundle; }
+
+        /// @returns the neighborhood that is shared by the lanes of a bundle
+        DETRAY_HOST_DEVICE
+        constexpr const neighborhood_type &neighborhood() const {
+            return m_neighborhood;
+        }
+
+        /// @returns the signed distances to the next candidates of all lanes.
+        /// Inactive lanes report a distance of zero.
+        DETRAY_HOST_DEVICE
+        constexpr const darray<scalar_type, batch_size> &distances() const {
+            return m_distances;
+        }
+
+        private:
+        /// Expand the detector into every lane state
+        template <std::size_t... I>
+        DETRAY_HOST_DEVICE state(const detector_type &det,
+                                 std::index_sequence<I...>)
+            : m_lanes{((void)I, lane_state_type{det})...} {}
+
+        /// Remove dead lanes and gather the distances of the live lanes
+        DETRAY_HOST_DEVICE
+        constexpr void sync() {
+            for (std::size_t i = 0u; i < batch_size; ++i) {
+                if (is_active(i) && !m_lanes[i].is_alive()) {
+                    deactivate(i);
+                }
+                m_distances[i] = (is_active(i) && !m_lanes[i].is_exhausted())
+                                     ? m_lanes[i]()
+                                     : static_cast<scalar_type>(0.f);
+            }
+        }
+
+        /// The per lane navigation states
+        darray<lane_state_type, batch_size> m_lanes;
+        /// Gathered distances to the next candidate per lane
+        darray<scalar_type, batch_size> m_distances{};
+        /// Lanes that are active in the batch
+        lane_mask_type m_active{0u};
+        /// Volume neighborhood that is shared by the lanes of a bundle
+        neighborhood_type m_neighborhood{};
+        /// Whether the lanes are navigated as a bundle
+        bool m_is_bundle{false};
+    };
+
+    /// @brief Initialize all lanes of the batch.
+    ///
+    /// @tparam tracks_t indexable collection of tracks, one per lane, that
+    ///         provide pos() and dir() methods
+    ///
+    /// @param tracks the track parameters of every lane
+    /// @param navigation the batched navigation state
+    /// @param cfg the navigation configuration (shared by all lanes)
+    /// @param ctx the geometry context
+    template <typename tracks_t>
+    DETRAY_HOST_DEVICE inline void init(
+        const tracks_t &tracks, state &navigation,
+        const navigation::config &cfg, const context_type &ctx = {}) const {
+
+        navigation.m_is_bundle = false;
+        for (std::size_t i = 0u; i < batch_size; ++i) {
+            navigation.activate(i);
+            m_navigator.init(tracks[i], navigation[i], cfg, ctx);
+        }
+        navigation.sync();
+    }
+
+    /// @brief Initialize all lanes of the batch as a bundle of tracks.
+    ///
+    /// All tracks start close to each other in nearly the same direction
+    /// (e.g. in a jet or a material scan). The acceleration structures are
+    /// queried only once, for the track of the first lane, and the shared
+    /// surfaces are intersected with the tracks of all lanes
+    /// (@see navigator::collect_neighborhood ), lane-parallel if the batch
+    /// has an SoA algebra. The search window is widened by the envelope of
+    /// the bundle (@see envelope ).
+    ///
+    /// The updates of the batch then share the look-ups of the volumes that
+    /// the lanes enter: the first lane that enters a volume looks up the
+    /// neighborhood, and the other lanes use it, as long as they enter the
+    /// same volume within the envelope of the bundle. Lanes that leave the
+    /// bundle do their own look-ups.
+    ///
+    /// @param tracks the track parameters of every lane
+    /// @param navigation the batched navigation state (all lanes in the same
+    ///                   volume)
+    /// @param cfg the navigation configuration (shared by all lanes)
+    /// @param ctx the geometry context
+    template <typename tracks_t>
+    DETRAY_HOST_DEVICE inline void init_bundle(
+        const tracks_t &tracks, state &navigation,
+        const navigation::config &cfg, const context_type &ctx = {}) const {
+
+        for (std::size_t i = 0u; i < batch_size; ++i) {
+            navigation.activate(i);
+        }
+        navigation.m_is_bundle = true;
+
+        neighborhood_type &neighborhood = navigation.m_neighborhood;
+        envelope(tracks, navigation, neighborhood);
+        m_navigator.collect_neighborhood(tracks[0], navigation[0], cfg, ctx,
+                                         neighborhood);
+
+        for (std::size_t i = 0u; i < batch_size; ++i) {
+            assert(navigation[i].volume() == navigation[0].volume());
+
+            if constexpr (std::is_void_v<soa_algebra_t>) {
+                m_navigator.init_from_neighborhood(tracks[i], navigation[i],
+                                                   cfg, ctx, neighborhood);
+            }
+        }
+        if constexpr (!std::is_void_v<soa_algebra_t>) {
+            m_navigator.template init_lanes_from_neighborhood<soa_algebra_t>(
+                tracks, navigation.m_lanes, navigation.active_lanes(), cfg,
+                ctx, neighborhood);
+        }
+        navigation.sync();
+    }
+
+    /// @brief Initialize a single lane, e.g. after it was refilled.
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init_lane(const std::size_t i,
+                                             const track_t &track,
+                                             state &navigation,
+                                             const navigation::config &cfg,
+                                             const context_type &ctx = {}) const {
+        // The new track is not part of a bundle
+        navigation.m_is_bundle = false;
+        navigation.activate(i);
+        m_navigator.init(track, navigation[i], cfg, ctx);
+        navigation.sync();
+    }
+
+    /// @brief Update all active lanes of the batch.
+    ///
+    /// @param tracks the track parameters of every lane
+    /// @param navigation the batched navigation state
+    /// @param cfg the navigation configuration (shared by all lanes)
+    /// @param ctx the geometry context
+    ///
+    /// @returns the mask of lanes that were re-initialized by the update
+    template <typename tracks_t>
+    DETRAY_HOST_DEVICE inline lane_mask_type update(
+        const tracks_t &tracks, state &navigation,
+        const navigation::config &cfg, const context_type &ctx = {},
+        const bool is_before_actor = true) const {
+
+        if (navigation.is_bundle()) {
+            envelope(tracks, navigation, navigation.m_neighborhood);
+        }
+
+        lane_mask_type is_init{0u};
+        for (std::size_t i = 0u; i < batch_size; ++i) {
+            if (!navigation.is_active(i)) {
+                continue;
+            }
+            const bool lane_init{
+                navigation.is_bundle()
+                    ? m_navigator.update(tracks[i], navigation[i], cfg, ctx,
+                                         navigation.m_neighborhood)
+                    : m_navigator.update(tracks[i], navigation[i], cfg, ctx,
+                                         is_before_actor)};
+            if (lane_init) {
+                is_init |= (lane_mask_type{1u} << i);
+            }
+        }
+        navigation.sync();
+
+        return is_init;
+    }
+
+    private:
+    /// Set the envelope of the active lanes in @param neighborhood
+    ///
+    /// The envelope is measured from the first active lane: Any two lanes are
+    /// at most twice the largest distance and angle to this lane apart.
+    template <typename tracks_t>
+    DETRAY_HOST_DEVICE static void envelope(const tracks_t &tracks,
+                                            const state &navigation,
+                                            neighborhood_type &neighborhood) {
+        scalar_type max_dist{0.f};
+        scalar_type max_angle{0.f};
+
+        std::size_t first{batch_size};
+        for (std::size_t i = 0u; i < batch_size; ++i) {
+            if (!navigation.is_active(i)) {
+                continue;
+            }
+            if (first == batch_size) {
+                first = i;
+                continue;
+            }
+            const auto &axis = tracks[first];
+            const auto &track = tracks[i];
+
+            const scalar_type dist{vector::norm(track.pos() - axis.pos())};
+            const scalar_type cos_a{vector::dot(track.dir(), axis.dir())};
+            const scalar_type cos_angle{
+                cos_a < 1.f ? cos_a : static_cast<scalar_type>(1.f)};
+
+            max_dist = math::max(max_dist, dist);
+            max_angle = math::max(max_angle, math::acos(cos_angle));
+        }
+
+        neighborhood.radius = 2.f * max_dist;
+        neighborhood.max_angle = 2.f * max_angle;
+    }
+
+    /// The scalar navigator that is applied to every lane
+    navigator_t m_navigator{};
+};
+
+}  // namespace detray
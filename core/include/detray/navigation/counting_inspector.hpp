@@ -0,0 +1,237 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/navigation_config.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s)
+#include <cstdint>
+#include <type_traits>
+
+namespace detray::navigation {
+
+/// Counters of the @c counting_inspector
+enum class counter : std::uint_least8_t {
+    /// Finished tracks (exited or aborted)
+    e_tracks = 0u,
+    /// Full local navigations (incl. the first one of every track)
+    e_init = 1u,
+    /// Reinitializations during the navigation of the tracks
+    e_reinit = 2u,
+    /// Initializations from the portal links
+    e_init_portal_links = 3u,
+    /// Updates with high trust
+    e_update_high_trust = 4u,
+    /// Updates with fair trust
+    e_update_fair_trust = 5u,
+    /// Updates that ended between surfaces
+    e_towards_object = 6u,
+    /// Updates that ended on a module surface
+    e_on_module = 7u,
+    /// Updates that ended on a portal
+    e_on_portal = 8u,
+    /// Tracks that left the detector
+    e_exit = 9u,
+    /// Tracks with aborted navigation
+    e_abort = 10u,
+    /// Navigation paused by an actor
+    e_pause = 11u,
+    /// Candidates that did not fit into the cache
+    e_cache_overflow = 12u,
+    /// Sum of the cache occupancy after the updates
+    e_cached_candidates = 13u,
+    /// Maximal cache occupancy
+    e_max_cached_candidates = 14u,
+    /// Exhausted caches that were restored with a widened overstep tolerance
+    e_overstep_recovery = 15u,
+    /// Exhausted caches that could not be restored (volume reinitialization)
+    e_overstep_recovery_failed = 16u,
+    e_size = 17u,
+};
+
+/// @brief Navigation inspector that only counts the navigation calls.
+///
+/// Counts the (re-)initializations, the updates per trust level, the resulting
+/// navigation status and the occupancy of the candidate cache of a track. The
+/// counters are kept in the inspector during the navigation and are only
+/// added atomically to a global counter buffer (@see counter ) when the
+/// navigation of the track ends, so that the navigation of many tracks in
+/// parallel (e.g. on device) can be monitored without much overhead.
+///
+/// Without a global buffer, the counters only stay available in the
+/// navigation state of the track.
+class counting_inspector {
+
+    public:
+    using counter_type = unsigned long long int;
+    using view_type = dvector_view<counter_type>;
+    using const_view_type = dvector_view<const counter_type>;
+
+    /// Number of counters
+    static constexpr unsigned int n_counters{
+        static_cast<unsigned int>(counter::e_size)};
+
+    /// Default constructor: no global buffer
+    constexpr counting_inspector() = default;
+
+    /// Construct from the @param view of the global counter buffer, which
+    /// needs to hold @c n_counters elements
+    DETRAY_HOST_DEVICE
+    explicit counting_inspector(view_type view) : m_global{view} {}
+
+    /// @returns the local count of the counter @param c
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int count(const counter c) const {
+        return m_counts[static_cast<unsigned int>(c)];
+    }
+
+    /// Inspector interface: count the candidates that were dropped from the
+    /// cache
+    template <typename state_type>
+    DETRAY_HOST_DEVICE void cache_overflow(const state_type & /*state*/) {
+        increment(counter::e_cache_overflow);
+    }
+
+    /// Inspector interface: classify the navigation call by its @param message
+    template <typename state_type, concepts::point3D point3_t,
+              concepts::vector3D vector3_t, typename... Args>
+    DETRAY_HOST_DEVICE void operator()(const state_type &state,
+                                       const navigation::config &,
+                                       const point3_t &, const vector3_t &,
+                                       const char *message, Args &&...) {
+        if (starts_with(message, "Update complete: high")) {
+            increment(counter::e_update_high_trust);
+            count_update(state);
+        } else if (starts_with(message, "Update complete: fair")) {
+            increment(counter::e_update_fair_trust);
+            count_update(state);
+        } else if (starts_with(message, "Init complete")) {
+            increment(counter::e_init);
+            count_update(state);
+        } else if (starts_with(message, "Init from portal links")) {
+            increment(counter::e_init_portal_links);
+            count_update(state);
+        } else if (starts_with(message, "Exited")) {
+            increment(counter::e_exit);
+            finish();
+        } else if (starts_with(message, "Aborted")) {
+            increment(counter::e_abort);
+            finish();
+        } else if (starts_with(message, "Paused")) {
+            increment(counter::e_pause);
+        } else if (starts_with(message, "Overstep recovery: success")) {
+            increment(counter::e_overstep_recovery);
+        } else if (starts_with(message, "Overstep recovery: failed")) {
+            increment(counter::e_overstep_recovery_failed);
+        }
+    }
+
+    /// Inspector interface
+    template <typename state_type>
+    DETRAY_HOST_DEVICE void operator()(const state_type & /*state*/,
+                                       const char * /*message*/) const {
+        /* Do nothing*/
+    }
+
+    private:
+    /// @returns true if @param str starts with @param prefix
+    DETRAY_HOST_DEVICE
+    static constexpr bool starts_with(const char *str, const char *prefix) {
+        if (str == nullptr) {
+            return false;
+        }
+        for (; *prefix != '\0'; ++str, ++prefix) {
+            if (*str != *prefix) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    DETRAY_HOST_DEVICE
+    constexpr void increment(const counter c, const unsigned int n = 1u) {
+        m_counts[static_cast<unsigned int>(c)] += n;
+    }
+
+    /// Count the navigation status and the cache occupancy after an update
+    template <typename state_type>
+    DETRAY_HOST_DEVICE void count_update(const state_type &state) {
+        using status_t = std::remove_cvref_t<decltype(state.status())>;
+
+        switch (state.status()) {
+            case status_t::e_towards_object:
+                increment(counter::e_towards_object);
+                break;
+            case status_t::e_on_module:
+                increment(counter::e_on_module);
+                break;
+            case status_t::e_on_portal:
+                increment(counter::e_on_portal);
+                break;
+            default:
+                break;
+        }
+
+        const auto n_cached{static_cast<unsigned int>(state.n_cached())};
+        increment(counter::e_cached_candidates, n_cached);
+
+        constexpr auto max_idx{
+            static_cast<unsigned int>(counter::e_max_cached_candidates)};
+        auto &max_cached = m_counts[max_idx];
+        max_cached = n_cached > max_cached ? n_cached : max_cached;
+    }
+
+    /// The navigation of the track ended: add the counts to the global buffer
+    DETRAY_HOST_DEVICE void finish() {
+        increment(counter::e_tracks);
+
+        const unsigned int n_init{count(counter::e_init)};
+        m_counts[static_cast<unsigned int>(counter::e_reinit)] =
+            n_init > 0u ? n_init - 1u : 0u;
+
+        if (m_global.size() < n_counters) {
+            return;
+        }
+
+        vecmem::device_vector<counter_type> global(m_global);
+
+        constexpr auto max_idx{
+            static_cast<unsigned int>(counter::e_max_cached_candidates)};
+        for (unsigned int i = 0u; i < n_counters; ++i) {
+            if (i == max_idx || m_counts[i] == 0u) {
+                continue;
+            }
+            vecmem::device_atomic_ref<counter_type>(global[i]).fetch_add(
+                static_cast<counter_type>(m_counts[i]));
+        }
+
+        // Atomic maximum
+        vecmem::device_atomic_ref<counter_type> max_ref(global[max_idx]);
+        const auto local_max{static_cast<counter_type>(m_counts[max_idx])};
+        counter_type current{max_ref.load()};
+        while (current < local_max &&
+               !max_ref.compare_exchange_strong(current, local_max)) {
+        }
+    }
+
+    /// Counts of the current track
+    darray<unsigned int, n_counters> m_counts{};
+    /// Global counter buffer
+    view_type m_global{};
+};
+
+}  // namespace detray::navigation
@@ -0,0 +1,151 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+namespace detray::detail {
+
+/// @brief A group of lanes that work on the same track together.
+///
+/// All lanes of a group run the same navigation on identical copies of the
+/// track state. Where the work can be split (e.g. intersecting the candidates
+/// of a volume), every lane takes a share and the results are exchanged
+/// between the lanes with the @c shuffle methods, so that all lanes end up
+/// with the same state again.
+///
+/// This is the trivial group of a single lane: Every thread works on its own
+/// track and nothing is exchanged.
+struct single_lane {
+
+    /// Number of lanes in the group
+    static constexpr unsigned int size{1u};
+
+    /// @returns the index of the calling lane in the group
+    DETRAY_HOST_DEVICE
+    static constexpr unsigned int rank() { return 0u; }
+
+    /// @returns the value @param v of the lane @param src_rank
+    template <typename T>
+    DETRAY_HOST_DEVICE static constexpr T shuffle(const T& v,
+                                                  const unsigned int) {
+        return v;
+    }
+
+    /// @returns the value @param v of the lane rank() ^ @param lane_mask
+    template <typename T>
+    DETRAY_HOST_DEVICE static constexpr T shuffle_xor(const T& v,
+                                                      const unsigned int) {
+        return v;
+    }
+};
+
+#if defined(__CUDACC__)
+
+/// @brief Group of @tparam N neighbouring lanes of a CUDA warp (sub-warp tile)
+///
+/// The values are exchanged with warp shuffles, which only synchronize the
+/// lanes of the group, so that the groups of a warp can diverge.
+///
+/// @note Assumes one dimensional thread blocks with a multiple of the warp
+/// size. Values are shuffled as 32 bit words, so they need to be trivially
+/// copyable.
+template <unsigned int N>
+struct cuda_lane_group {
+
+    static_assert(N > 0u && N <= 32u && (N & (N - 1u)) == 0u,
+                  "The group size has to be a power of two up to warp size");
+
+    /// Number of lanes in the group
+    static constexpr unsigned int size{N};
+
+    /// @returns the index of the calling lane in the group
+    DETRAY_HOST_DEVICE
+    static inline unsigned int rank() {
+#if defined(__CUDA_ARCH__)
+        return (threadIdx.x % 32u) % N;
+#else
+        return 0u;
+#endif
+    }
+
+    /// @returns the value @param v of the lane @param src_rank
+    template <typename T>
+    DETRAY_HOST_DEVICE static inline T shuffle(const T& v,
+                                               const unsigned int src_rank) {
+        return shuffle_words<T, false>(v, src_rank);
+    }
+
+    /// @returns the value @param v of the lane rank() ^ @param lane_mask
+    template <typename T>
+    DETRAY_HOST_DEVICE static inline T shuffle_xor(
+        const T& v, const unsigned int lane_mask) {
+        return shuffle_words<T, true>(v, lane_mask);
+    }
+
+    private:
+    /// @returns the participation mask of the group of the calling lane
+    DETRAY_HOST_DEVICE
+    static inline unsigned int group_mask() {
+#if defined(__CUDA_ARCH__)
+        if constexpr (N == 32u) {
+            return 0xffffffffu;
+        } else {
+            return ((1u << N) - 1u) << ((threadIdx.x % 32u) / N * N);
+        }
+#else
+        return 0u;
+#endif
+    }
+
+    /// Shuffle an arbitrary trivially copyable type as 32 bit words
+    template <typename T, bool is_xor>
+    DETRAY_HOST_DEVICE static inline T shuffle_words(
+        const T& v, [[maybe_unused]] const unsigned int lane) {
+
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Shuffled values need to be trivially copyable");
+
+#if defined(__CUDA_ARCH__)
+        constexpr unsigned int n_words{(sizeof(T) + 3u) / 4u};
+
+        unsigned int words[n_words]{};
+        memcpy(words, &v, sizeof(T));
+
+        const unsigned int mask{group_mask()};
+        for (unsigned int w = 0u; w < n_words; ++w) {
+            if constexpr (is_xor) {
+                words[w] = __shfl_xor_sync(mask, words[w],
+                                           static_cast<int>(lane), N);
+            } else {
+                words[w] =
+                    __shfl_sync(mask, words[w], static_cast<int>(lane), N);
+            }
+        }
+
+        T out;
+        memcpy(&out, words, sizeof(T));
+
+        return out;
+#else
+        // Only meaningful in device code
+        assert(false);
+        return v;
+#endif
+    }
+};
+
+#endif
+
+}  // namespace detray::detail
@@ -180,7 +180,7 @@ DETRAY_HOST inline std::string print_candidates(const state_type &state,
 
         debug_stream << std::left << std::setw(6) << "-> " << sf_cand;
 
-        assert(!sf_cand.sf_desc.barcode().is_invalid());
+        assert(!sf_cand.surface(state.detector()).barcode().is_invalid());
 
         // Use additional debug information that was gathered on the cand.
         if constexpr (state_type::value_type::is_debug()) {
@@ -0,0 +1,77 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/concentric_cylindrical2D.hpp"
+#include "detray/geometry/coordinates/cylindrical2D.hpp"
+#include "detray/geometry/coordinates/line2D.hpp"
+#include "detray/geometry/coordinates/polar2D.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray::detail {
+
+/// @brief Lower bound on the distance between a point and a surface
+///
+/// A trajectory that starts at the point has to travel at least this path
+/// length before it can reach the surface, regardless of its curvature. The
+/// distance is taken to the unbounded surface (the plane, the cylinder or the
+/// outer edge of the tube around a line), so that it is cheap to compute.
+/// Shapes that are not covered give a distance of zero.
+struct safe_distance {
+
+    template <typename mask_group_t, typename index_t,
+              typename transform_store_t, typename context_t,
+              concepts::point3D point3_t>
+    DETRAY_HOST_DEVICE inline auto operator()(
+        const mask_group_t &mask_group, const index_t &index,
+        const transform_store_t &transforms, const dindex trf_idx,
+        const context_t &ctx, const point3_t &pos) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using shape_t = typename mask_t::shape;
+        using algebra_t = typename mask_t::algebra_type;
+        using frame_t = typename mask_t::local_frame;
+        using scalar_t = dscalar<algebra_t>;
+
+        const auto &mask = mask_group[index];
+        const auto loc = transforms.at(trf_idx, ctx).point_to_local(pos);
+
+        using cyl_frame_t = cylindrical2D<algebra_t>;
+        using conc_cyl_frame_t = concentric_cylindrical2D<algebra_t>;
+
+        if constexpr (std::is_same_v<frame_t, cartesian2D<algebra_t>> ||
+                      std::is_same_v<frame_t, polar2D<algebra_t>>) {
+            return math::fabs(loc[2]);
+        } else if constexpr (std::is_same_v<frame_t, cyl_frame_t> ||
+                             std::is_same_v<frame_t, conc_cyl_frame_t>) {
+            return math::fabs(vector::perp(loc) - mask[shape_t::e_r]);
+        } else if constexpr (std::is_same_v<frame_t, line2D<algebra_t>>) {
+            // Radius of the tube that encloses the cross section
+            scalar_t r{mask[shape_t::e_cross_section]};
+            if constexpr (shape_t::square_cross_sect) {
+                r *= constant<scalar_t>::sqrt2;
+            }
+            const scalar_t d{vector::perp(loc) - r};
+
+            return d > 0.f ? d : scalar_t{0.f};
+        } else {
+            return scalar_t{0.f};
+        }
+    }
+};
+
+}  // namespace detray::detail
@@ -0,0 +1,33 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+namespace detray::navigation {
+
+/// @brief Compact record of a surface that was reached during the navigation
+///
+/// Holds the index of the surface in the detector surface lookup and the path
+/// length of the track at the surface, so that a recorded trajectory can be
+/// replayed by the @c direct_navigator without looking up the barcodes.
+struct trajectory_point {
+    /// Index of the surface in the detector
+    dindex sf_index{detail::invalid_value<dindex>()};
+    /// Path length of the track when reaching the surface
+    float path{0.f};
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const trajectory_point &other) const = default;
+};
+
+}  // namespace detray::navigation
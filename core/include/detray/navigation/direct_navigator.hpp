@@ -15,6 +15,7 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/navigation/detail/trajectory_point.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
@@ -23,11 +24,43 @@
 #include "detray/tracks/ray.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s)
+#include <cstdint>
+#include <type_traits>
+
 namespace detray {
 
-template <typename detector_t>
+namespace navigation {
+
+/// What the surface sequence of the direct navigator holds
+enum class sequence_type : std::uint_least8_t {
+    /// The surface barcodes (e.g. recorded by the @c barcode_sequencer )
+    e_barcode = 0u,
+    /// The resolved surface descriptors and volume links: Avoids all surface
+    /// lookups during the navigation (see @c direct_navigator::resolve )
+    e_resolved = 1u,
+    /// The surface indices and path lengths of a recorded trajectory (e.g.
+    /// recorded by the @c trajectory_recorder )
+    e_trajectory = 2u,
+};
+
+}  // namespace navigation
+
+/// @brief Navigator that follows a precomputed sequence of surfaces
+///
+/// @tparam detector_t the detector to navigate
+/// @tparam seq_type what the sequence holds (@see navigation::sequence_type)
+template <typename detector_t, navigation::sequence_type seq_type =
+                                   navigation::sequence_type::e_barcode>
 class direct_navigator {
 
+    /// Does the sequence hold resolved surfaces
+    static constexpr bool prefetch_surfaces{
+        seq_type == navigation::sequence_type::e_resolved};
+    /// Does the sequence hold a recorded trajectory
+    static constexpr bool is_trajectory{
+        seq_type == navigation::sequence_type::e_trajectory};
+
     public:
     using detector_type = detector_t;
     using context_type = detector_type::geometry_context;
@@ -36,6 +69,44 @@ class direct_navigator {
     using intersection_type =
         intersection2D<typename detector_t::surface_type,
                        typename detector_t::algebra_type, false>;
+    using nav_link_type = typename detector_type::surface_type::navigation_link;
+
+    /// A surface of the navigation sequence, resolved in the detector
+    struct sequence_entry {
+        /// Surface descriptor: Holds the transform and mask indices
+        typename detector_type::surface_type sf_desc{};
+        /// Volume the surface links to
+        nav_link_type volume_link{detail::invalid_value<nav_link_type>()};
+    };
+
+    /// Element type of the navigation sequence
+    using sequence_value_type = std::conditional_t<
+        prefetch_surfaces, sequence_entry,
+        std::conditional_t<is_trajectory, navigation::trajectory_point,
+                           detray::geometry::barcode>>;
+
+    /// @returns the resolved sequence entry of the surface @param bcd
+    DETRAY_HOST_DEVICE
+    static sequence_entry resolve(const detector_type &det,
+                                  const detray::geometry::barcode bcd) {
+        const auto sf_desc = det.surface(bcd);
+
+        return {sf_desc, static_cast<nav_link_type>(
+                             tracking_surface{det, sf_desc}.volume_link())};
+    }
+
+    /// Resolve the barcode sequence @param barcodes (e.g. recorded by the
+    /// @c barcode_sequencer ) into the surface entries @param entries
+    template <typename barcode_range_t, typename entry_vector_t>
+    DETRAY_HOST static void resolve(const detector_type &det,
+                                    const barcode_range_t &barcodes,
+                                    entry_vector_t &entries) {
+        entries.clear();
+        entries.reserve(barcodes.size());
+        for (const auto bcd : barcodes) {
+            entries.push_back(resolve(det, bcd));
+        }
+    }
 
     class state {
 
@@ -44,11 +115,10 @@ class direct_navigator {
         using candidate_t = intersection_type;
 
         public:
-        using sequence_t = vecmem::device_vector<detray::geometry::barcode>;
+        using sequence_t = vecmem::device_vector<sequence_value_type>;
         using detector_type = direct_navigator::detector_type;
-        using nav_link_type =
-            typename detector_type::surface_type::navigation_link;
-        using view_type = dvector_view<detray::geometry::barcode>;
+        using nav_link_type = direct_navigator::nav_link_type;
+        using view_type = dvector_view<sequence_value_type>;
 
         state() = delete;
 
@@ -98,10 +168,23 @@ class direct_navigator {
             }
 
             if (!is_complete()) {
-                m_candidate.sf_desc = m_detector->surface(get_target_barcode());
-                m_candidate.volume_link =
-                    tracking_surface{*m_detector, m_candidate.sf_desc}
-                        .volume_link();
+                if constexpr (prefetch_surfaces) {
+                    const sequence_entry &entry = get_target_entry();
+                    m_candidate.sf_desc = entry.sf_desc;
+                    m_candidate.volume_link = entry.volume_link;
+                } else if constexpr (is_trajectory) {
+                    m_candidate.sf_desc =
+                        m_detector->surface(get_target_entry().sf_index);
+                    m_candidate.volume_link =
+                        tracking_surface{*m_detector, m_candidate.sf_desc}
+                            .volume_link();
+                } else {
+                    m_candidate.sf_desc =
+                        m_detector->surface(get_target_barcode());
+                    m_candidate.volume_link =
+                        tracking_surface{*m_detector, m_candidate.sf_desc}
+                            .volume_link();
+                }
                 m_candidate.path = std::numeric_limits<scalar_type>::max();
                 set_volume(m_candidate.volume_link);
             }
@@ -129,8 +212,9 @@ class direct_navigator {
             }
         }
 
+        /// @returns the sequence entry of the next surface
         DETRAY_HOST_DEVICE
-        detray::geometry::barcode get_target_barcode() const {
+        const sequence_value_type &get_target_entry() const {
             if (m_direction == navigation::direction::e_forward) {
                 return *m_it;
             } else {
@@ -138,8 +222,9 @@ class direct_navigator {
             }
         }
 
+        /// @returns the sequence entry of the current surface
         DETRAY_HOST_DEVICE
-        detray::geometry::barcode get_current_barcode() const {
+        const sequence_value_type &get_current_entry() const {
             if (m_direction == navigation::direction::e_forward) {
                 return *(m_it - 1);
             } else {
@@ -147,6 +232,29 @@ class direct_navigator {
             }
         }
 
+        DETRAY_HOST_DEVICE
+        detray::geometry::barcode get_target_barcode() const {
+            return to_barcode(get_target_entry());
+        }
+
+        DETRAY_HOST_DEVICE
+        detray::geometry::barcode get_current_barcode() const {
+            return to_barcode(get_current_entry());
+        }
+
+        /// @returns the recorded path length between the current and the
+        /// next surface of a trajectory (absolute value). For the first
+        /// surface, the path from the start of the recording.
+        DETRAY_HOST_DEVICE
+        scalar_type get_segment_length() const requires is_trajectory {
+            const float target_path{get_target_entry().path};
+            const float current_path{is_init() ? 0.f
+                                               : get_current_entry().path};
+
+            return math::fabs(
+                static_cast<scalar_type>(target_path - current_path));
+        }
+
         /// Advance the iterator
         DETRAY_HOST_DEVICE
         void next() {
@@ -204,6 +312,19 @@ class direct_navigator {
                    (get_current_barcode().id() == surface_id::e_sensitive);
         }
 
+        /// Helper method to check the track has reached a passive surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_passive() const -> bool {
+            return (m_status == navigation::status::e_on_module) &&
+                   (get_current_barcode().id() == surface_id::e_passive);
+        }
+
+        /// Helper method to check the track has reached a portal surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_portal() const -> bool {
+            return m_status == navigation::status::e_on_portal;
+        }
+
         DETRAY_HOST_DEVICE
         inline auto barcode() const -> geometry::barcode {
             return m_candidate_prev.sf_desc.barcode();
@@ -256,6 +377,13 @@ class direct_navigator {
             m_direction = dir;
         }
 
+        /// @returns the navigation trust level: the direct navigator always
+        /// updates the intersection of the next surface in its sequence only
+        DETRAY_HOST_DEVICE
+        inline auto trust_level() const -> navigation::trust_level {
+            return navigation::trust_level::e_high;
+        }
+
         DETRAY_HOST_DEVICE
         inline void set_no_trust() { return; }
 
@@ -268,6 +396,22 @@ class direct_navigator {
         DETRAY_HOST_DEVICE
         inline void set_fair_trust() { return; }
 
+        DETRAY_HOST_DEVICE
+        inline void advance(const scalar_type) { return; }
+
+        /// @returns the barcode of a sequence entry @param entry
+        DETRAY_HOST_DEVICE
+        constexpr detray::geometry::barcode to_barcode(
+            const sequence_value_type &entry) const {
+            if constexpr (prefetch_surfaces) {
+                return entry.sf_desc.barcode();
+            } else if constexpr (is_trajectory) {
+                return m_detector->surface(entry.sf_index).barcode();
+            } else {
+                return entry;
+            }
+        }
+
         /// Intersection candidate
         candidate_t m_candidate;
         candidate_t m_candidate_prev;
@@ -384,8 +528,15 @@ class direct_navigator {
         if (!res) {
             const auto path = navigation.target().path;
             navigation.update_candidate(false);
-            navigation.target().path =
-                math::copysign(navigation.safe_step_size, path);
+
+            // Do not step beyond the next surface of a recorded trajectory
+            scalar_type step{navigation.safe_step_size};
+            if constexpr (is_trajectory) {
+                step = math::min(step, navigation.get_segment_length());
+                step = math::max(
+                    step, static_cast<scalar_type>(cfg.path_tolerance));
+            }
+            navigation.target().path = math::copysign(step, path);
         }
     }
 };
@@ -74,7 +74,7 @@ struct cuboid_intersector {
         scalar_type tmin{t_comp ? t2[0] : t1[0]};
         scalar_type tmax{t_comp ? t1[0] : t2[0]};
 
-        for (unsigned int i{0u}; i < 2u; ++i) {
+        for (unsigned int i{1u}; i < 3u; ++i) {
             if (t1[i] > t2[i]) {
                 tmin = t2[i] < tmin ? tmin : t2[i];
                 tmax = t1[i] > tmax ? tmax : t1[i];
@@ -0,0 +1,131 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <utility>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief View on a mask that converts into the local frame with an
+/// approximate phi coordinate.
+///
+/// Falls back to the exact conversion for local frames that do not provide an
+/// approximate one (e.g. cartesian frames, or SoA algebras).
+template <typename mask_t>
+struct approx_phi_mask {
+
+    using shape = typename mask_t::shape;
+    using local_frame = typename mask_t::local_frame;
+    using point3_type = typename mask_t::point3_type;
+    using vector3_type = typename mask_t::vector3_type;
+
+    /// The mask that is being viewed
+    const mask_t &m_mask;
+
+    /// @returns the boundary value at @param value_index
+    DETRAY_HOST_DEVICE
+    constexpr auto operator[](const std::size_t value_index) const {
+        return m_mask[value_index];
+    }
+
+    /// @returns the volume link of the mask
+    DETRAY_HOST_DEVICE
+    constexpr decltype(auto) volume_link() const {
+        return m_mask.volume_link();
+    }
+
+    /// @returns the boundary check of the mask
+    template <typename... Args>
+    DETRAY_HOST_DEVICE constexpr auto is_inside(Args &&...args) const {
+        return m_mask.is_inside(std::forward<Args>(args)...);
+    }
+
+    /// @returns the global point projected onto the surface
+    template <bool check_only = false, typename transform3D_t>
+    DETRAY_HOST_DEVICE static inline point3_type to_local_frame(
+        const transform3D_t &trf, const point3_type &glob_p,
+        const vector3_type &glob_dir = {}) {
+        // No need to approximate a phi that is not computed
+        if constexpr (!(check_only && !mask_t::check_uses_phi) &&
+                      requires {
+                          local_frame::approx_global_to_local_3D(trf, glob_p,
+                                                                 glob_dir);
+                      }) {
+            return local_frame::approx_global_to_local_3D(trf, glob_p,
+                                                          glob_dir);
+        } else {
+            return mask_t::template to_local_frame<check_only>(trf, glob_p,
+                                                               glob_dir);
+        }
+    }
+};
+
+}  // namespace detail
+
+/// @brief Ray intersector for the less precise tracking stages (e.g. pattern
+/// recognition).
+///
+/// Same as the @c ray_intersector , except that the phi coordinate of the
+/// local intersection point is computed with a single precision approximation
+/// of @c atan2 on cylinders and discs (error about 2e-6 rad, see
+/// @c detail::fast_atan2 ), also if the detector is in double precision. The
+/// path and the remaining local coordinates are computed as before.
+///
+/// @note the mask tolerance has to cover the error on the local position
+/// (r * 2e-6 rad, i.e. 2um at r = 1m)
+template <typename frame_t, concepts::algebra algebra_t, bool do_debug>
+struct fast_ray_intersector_impl
+    : public ray_intersector_impl<frame_t, algebra_t, do_debug> {
+
+    using base_type = ray_intersector_impl<frame_t, algebra_t, do_debug>;
+
+    template <typename surface_descr_t>
+    using intersection_type =
+        typename base_type::template intersection_type<surface_descr_t>;
+    using ray_type = typename base_type::ray_type;
+
+    /// @returns the intersection(s) between the ray @param ray and the surface
+    /// @param sf that is restricted by the mask @param mask
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t,
+              typename... Args>
+    DETRAY_HOST_DEVICE inline auto operator()(const ray_type &ray,
+                                              const surface_descr_t &sf,
+                                              const mask_t &mask,
+                                              const transform3D_t &trf,
+                                              Args &&...args) const {
+        return base_type::operator()(ray, sf,
+                                     detail::approx_phi_mask<mask_t>{mask},
+                                     trf, std::forward<Args>(args)...);
+    }
+
+    /// Update the intersection @param sfi with the ray @param ray
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t,
+              typename... Args>
+    DETRAY_HOST_DEVICE inline void update(
+        const ray_type &ray, intersection_type<surface_descr_t> &sfi,
+        const mask_t &mask, const transform3D_t &trf, Args &&...args) const {
+        base_type::update(ray, sfi, detail::approx_phi_mask<mask_t>{mask}, trf,
+                          std::forward<Args>(args)...);
+    }
+};
+
+template <typename shape_t, concepts::algebra algebra_t, bool do_debug = false>
+using fast_ray_intersector = fast_ray_intersector_impl<
+    typename shape_t::template local_frame_type<algebra_t>, algebra_t,
+    do_debug>;
+
+}  // namespace detray
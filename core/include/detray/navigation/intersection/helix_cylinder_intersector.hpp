@@ -19,6 +19,7 @@
 #include "detray/navigation/intersection/ray_cylinder_intersector.hpp"
 #include "detray/tracks/helix.hpp"
 #include "detray/utils/invalid_values.hpp"
+#include "detray/utils/root_finding.hpp"
 
 // System include(s)
 #include <limits>
@@ -209,33 +210,44 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
             // Initial helix path length parameter
             darray<scalar_type, 2> paths{default_s, default_s};
 
-            // try to guess good starting path by calculating the intersection
-            // path of the helix tangential with the cylinder. This only has a
-            // chance of working for tracks with reasonably high p_T !
-            detail::ray<algebra_t> t{h.pos(), h.time(), h_dir, h.qop()};
-            const auto qe = this->solve_intersection(t, mask, trf);
+            // If the magnetic field is parallel to the cylinder axis, the
+            // intersections are given by two intersecting circles
+            bool is_parallel{false};
+            const unsigned int n_circle_sol{
+                circle_intersection(h, sc, sz, r, paths, is_parallel)};
 
             // Obtain both possible solutions by looping over the (different)
             // starting positions
-            auto n_runs{static_cast<unsigned int>(qe.solutions())};
-
-            // Note: the default path length might be smaller than either
-            // solution
-            switch (qe.solutions()) {
-                case 2:
-                    paths[1] = qe.larger();
-                    // If there are two solutions, reuse the case for a single
-                    // solution to setup the intersection with the smaller path
-                    // in ret[0]
-                    [[fallthrough]];
-                case 1: {
-                    paths[0] = qe.smaller();
-                    break;
-                }
-                default: {
-                    n_runs = 2u;
-                    paths[0] = r;
-                    paths[1] = -r;
+            unsigned int n_runs{n_circle_sol};
+
+            if (!is_parallel) {
+                // try to guess good starting path by calculating the
+                // intersection path of the helix tangential with the
+                // cylinder. This only has a chance of working for tracks with
+                // reasonably high p_T !
+                detail::ray<algebra_t> t{h.pos(), h.time(), h_dir, h.qop()};
+                const auto qe = this->solve_intersection(t, mask, trf);
+
+                n_runs = static_cast<unsigned int>(qe.solutions());
+
+                // Note: the default path length might be smaller than either
+                // solution
+                switch (qe.solutions()) {
+                    case 2:
+                        paths[1] = qe.larger();
+                        // If there are two solutions, reuse the case for a
+                        // single solution to setup the intersection with the
+                        // smaller path in ret[0]
+                        [[fallthrough]];
+                    case 1: {
+                        paths[0] = qe.smaller();
+                        break;
+                    }
+                    default: {
+                        n_runs = 2u;
+                        paths[0] = r;
+                        paths[1] = -r;
+                    }
                 }
             }
 
@@ -258,9 +270,9 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
                 intersection_type<surface_descr_t> &sfi = ret[i];
 
                 // Run the root finding algorithm
-                const auto [s, ds] = newton_raphson_safe(cyl_inters_func, s_ini,
-                                                         convergence_tolerance,
-                                                         max_n_tries, max_path);
+                const auto [s, ds] = newton_raphson_seeded(
+                    cyl_inters_func, s_ini, convergence_tolerance,
+                    max_n_fast_tries, max_n_tries, max_path, histogram);
 
                 // Build intersection struct from the root
                 build_intersection(h, sfi, s, ds, sf_desc, mask, trf,
@@ -290,6 +302,92 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
     scalar_type max_path{5.f * unit<scalar_type>::m};
     // Complement the Newton algorithm with Bisection steps
     bool run_rtsafe{true};
+    // Pure Newton steps from the initial guess, before falling back to rtsafe
+    std::size_t max_n_fast_tries{5u};
+    // Record the number of iterations, if given (not thread-safe)
+    iteration_histogram *histogram{nullptr};
+
+    private:
+    /// Calculate the path lengths to the intersections of the helix @param h
+    /// with the cylinder, if the magnetic field is parallel to the cylinder
+    /// axis @param sz. In the plane transverse to the field, the helix is
+    /// then a circle and the intersections follow in closed form.
+    ///
+    /// @param sc the cylinder center
+    /// @param r the cylinder radius
+    /// @param [out] paths the (sorted) path lengths
+    /// @param [out] is_parallel whether the closed form solution applies
+    ///
+    /// @returns the number of solutions
+    DETRAY_HOST_DEVICE
+    static inline unsigned int circle_intersection(
+        const helix_type &h, const point3_type &sc, const vector3_type &sz,
+        const scalar_type r, darray<scalar_type, 2> &paths,
+        bool &is_parallel) {
+
+        is_parallel = false;
+
+        if (h.B() == 0.f) {
+            return 0u;
+        }
+        const vector3_type h0{vector::normalize(h.b_field())};
+        if (vector::norm(vector::cross(h0, sz)) > 1e-5f) {
+            return 0u;
+        }
+
+        // Transverse direction of the track and orthogonal to it
+        const vector3_type t0{h.dir()};
+        const scalar_type delta{vector::dot(h0, t0)};
+        const vector3_type t0_perp{t0 - delta * h0};
+        const scalar_type alpha{vector::norm(t0_perp)};
+        // Path length scaler
+        const scalar_type K{-h.qop() * h.B()};
+
+        // The helix does not move in the transverse plane (p_T ~ 0)
+        if (alpha < 1e-6f || K == 0.f) {
+            return 0u;
+        }
+        const vector3_type e1{(1.f / alpha) * t0_perp};
+        const vector3_type e2{vector::cross(h0, e1)};
+
+        // Circle of the helix in the transverse plane: center and radius
+        const scalar_type rho{alpha / math::fabs(K)};
+        const point3_type hc{h.pos() + (alpha / K) * e2};
+
+        // Transverse distance between the helix and the cylinder centers
+        vector3_type D{sc - hc};
+        D = D - vector::dot(D, h0) * h0;
+        const scalar_type d{vector::norm(D)};
+
+        // Concentric circles: Use the iterative solution
+        if (d < std::numeric_limits<scalar_type>::epsilon() * rho) {
+            return 0u;
+        }
+        is_parallel = true;
+
+        // Distance of the chord from the helix center and half chord length
+        const scalar_type a{(rho * rho - r * r + d * d) / (2.f * d)};
+        const scalar_type h2{rho * rho - a * a};
+        if (h2 < 0.f) {
+            return 0u;
+        }
+        const vector3_type u{(1.f / d) * D};
+        const vector3_type v{vector::cross(h0, u)};
+        const scalar_type hw{math::sqrt(h2)};
+
+        // Phase of the intersection points on the helix circle
+        for (unsigned int i = 0u; i < 2u; ++i) {
+            const vector3_type x{
+                (K / alpha) * (a * u + (i == 0u ? hw : -hw) * v)};
+            paths[i] =
+                math::atan2(vector::dot(x, e1), -vector::dot(x, e2)) / K;
+        }
+        if (paths[0] > paths[1]) {
+            paths = {paths[1], paths[0]};
+        }
+
+        return 2u;
+    }
 };
 
 template <concepts::algebra algebra_t>
@@ -15,6 +15,7 @@
 #include "detray/geometry/coordinates/line2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/tracks/helix.hpp"
+#include "detray/utils/root_finding.hpp"
 
 // System include(s)
 #include <iostream>
@@ -248,9 +249,9 @@ struct helix_intersector_impl<line2D<algebra_t>, algebra_t> {
             };
 
             // Run the root finding algorithm
-            const auto [s, ds] = newton_raphson_safe(line_inters_func, s_ini,
-                                                     convergence_tolerance,
-                                                     max_n_tries, max_path);
+            const auto [s, ds] = newton_raphson_seeded(
+                line_inters_func, s_ini, convergence_tolerance,
+                max_n_fast_tries, max_n_tries, max_path, histogram);
 
             // Build intersection struct from the root
             build_intersection(h, sfi, s, ds, sf_desc, mask, trf,
@@ -278,6 +279,10 @@ struct helix_intersector_impl<line2D<algebra_t>, algebra_t> {
     scalar_type max_path{5.f * unit<scalar_type>::m};
     // Complement the Newton algorithm with Bisection steps
     bool run_rtsafe{true};
+    // Pure Newton steps from the initial guess, before falling back to rtsafe
+    std::size_t max_n_fast_tries{5u};
+    // Record the number of iterations, if given (not thread-safe)
+    iteration_histogram *histogram{nullptr};
 };
 
 }  // namespace detray
@@ -16,6 +16,7 @@
 #include "detray/geometry/coordinates/polar2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/tracks/helix.hpp"
+#include "detray/utils/quadratic_equation.hpp"
 #include "detray/utils/root_finding.hpp"
 
 // System include(s)
@@ -150,6 +151,24 @@ struct helix_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
                 s_ini = vector::dot(sn, dist) / denom;
             }
 
+            // Refine the guess with the parabolic approximation of the helix:
+            // sn * (h.pos() - st) + s * sn * t0 + s^2/2 * sn * dtds == 0
+            const vector3_type t0{h.dir()};
+            const vector3_type dtds{h.qop() * vector::cross(t0, h.b_field())};
+            const detail::quadratic_equation<scalar_type> qe{
+                0.5f * vector::dot(sn, dtds), vector::dot(sn, t0),
+                vector::dot(sn, h.pos() - st)};
+
+            // Take the solution closest to the linear estimate
+            if (qe.solutions() == 2) {
+                s_ini = (math::fabs(qe.smaller() - s_ini) <
+                         math::fabs(qe.larger() - s_ini))
+                            ? qe.smaller()
+                            : qe.larger();
+            } else if (qe.solutions() == 1) {
+                s_ini = qe.smaller();
+            }
+
             /// Evaluate the function and its derivative at the point @param x
             auto plane_inters_func = [&h, &st, &sn](const scalar_type x) {
                 // f(s) = sn * (h.pos(s) - st) == 0
@@ -161,9 +180,9 @@ struct helix_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
             };
 
             // Run the root finding algorithm
-            const auto [s, ds] = newton_raphson_safe(plane_inters_func, s_ini,
-                                                     convergence_tolerance,
-                                                     max_n_tries, max_path);
+            const auto [s, ds] = newton_raphson_seeded(
+                plane_inters_func, s_ini, convergence_tolerance,
+                max_n_fast_tries, max_n_tries, max_path, histogram);
 
             // Build intersection struct from the root
             build_intersection(h, sfi, s, ds, sf_desc, mask, trf,
@@ -191,6 +210,10 @@ struct helix_intersector_impl<cartesian2D<algebra_t>, algebra_t> {
     scalar_type max_path{5.f * unit<scalar_type>::m};
     // Complement the Newton algorithm with Bisection steps
     bool run_rtsafe{true};
+    // Pure Newton steps from the initial guess, before falling back to rtsafe
+    std::size_t max_n_fast_tries{5u};
+    // Record the number of iterations, if given (not thread-safe)
+    iteration_histogram *histogram{nullptr};
 };
 
 template <algebra::concepts::aos algebra_t>
@@ -102,6 +102,14 @@ struct intersection2D<surface_descr_t, algebra_t, false> {
     DETRAY_HOST_DEVICE
     constexpr bool_t is_inside() const { return detail::any_of(this->status); }
 
+    /// @returns the descriptor of the surface (same interface as the slim
+    /// candidate, the detector is not needed)
+    template <typename detector_t>
+    DETRAY_HOST_DEVICE constexpr const surface_descr_t &surface(
+        const detector_t & /*det*/) const {
+        return sf_desc;
+    }
+
     /// Transform to a string for output debugging
     DETRAY_HOST
     friend std::ostream &operator<<(std::ostream &out_stream,
@@ -0,0 +1,51 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+
+namespace detray::detail {
+
+/// @brief Path dependent tolerance of the mask 'is_inside' check.
+///
+/// The tolerance grows with the distance to the candidate, clamped to
+/// [@param mask_tolerance[0], @param mask_tolerance[1]]. The computation is
+/// branch-free, so that it evaluates the tolerance of all lanes at once if
+/// @tparam scalar_t is a SIMD vector. This is how a batch of candidates is
+/// evaluated, e.g. a block of the packed brute force finder in the SoA
+/// intersectors.
+///
+/// @param mask_tol_scalor scale factor on the path
+/// @param path the distance to the candidate
+///
+/// @returns the mask tolerance for the candidate
+template <typename scalar_t>
+DETRAY_HOST_DEVICE constexpr scalar_t path_mask_tolerance(
+    const darray<scalar_t, 2u> &mask_tolerance, const scalar_t mask_tol_scalor,
+    const scalar_t path) {
+    return math::max(mask_tolerance[0],
+                     math::min(mask_tolerance[1],
+                               mask_tol_scalor * math::fabs(path)));
+}
+
+/// Broadcast the tolerance limits @param mask_tolerance of a track to the
+/// SIMD vector type @tparam simd_scalar_t. Should be done once per track and
+/// navigation step, before the candidates are tested in SoA blocks.
+///
+/// @returns the tolerance limits in every lane
+template <typename simd_scalar_t, typename scalar_t>
+DETRAY_HOST_DEVICE constexpr darray<simd_scalar_t, 2u> broadcast_mask_tolerance(
+    const darray<scalar_t, 2u> &mask_tolerance) {
+    return {simd_scalar_t(mask_tolerance[0]),
+            simd_scalar_t(mask_tolerance[1])};
+}
+
+}  // namespace detray::detail
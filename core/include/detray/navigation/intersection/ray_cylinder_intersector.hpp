@@ -14,6 +14,7 @@
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/coordinates/cylindrical2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
 #include "detray/tracks/ray.hpp"
 #include "detray/utils/invalid_values.hpp"
 #include "detray/utils/quadratic_equation.hpp"
@@ -56,10 +57,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersections.
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline darray<intersection_type<surface_descr_t>, 2>
     operator()(const ray_type &ray, const surface_descr_t &sf,
-               const mask_t &mask, const transform3_type &trf,
+               const mask_t &mask, const transform3D_t &trf,
                const darray<scalar_type, 2u> mask_tolerance =
                    {0.f, 100.f * unit<scalar_type>::um},
                const scalar_type mask_tol_scalor = 0.f,
@@ -97,10 +98,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
     }
 
     /// Interface to use fixed mask tolerance
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline darray<intersection_type<surface_descr_t>, 2>
     operator()(const ray_type &ray, const surface_descr_t &sf,
-               const mask_t &mask, const transform3_type &trf,
+               const mask_t &mask, const transform3D_t &trf,
                const scalar_type mask_tolerance,
                const scalar_type overstep_tol = 0.f) const {
         return this->operator()(ray, sf, mask, trf, {mask_tolerance, 0.f}, 0.f,
@@ -117,10 +118,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3D_t &trf,
         const darray<scalar_type, 2u> mask_tolerance =
             {0.f, 1.f * unit<scalar_type>::mm},
         const scalar_type mask_tol_scalor = 0.f,
@@ -145,10 +146,21 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
     /// cylinder in global coordinates.
     ///
     /// @returns a quadratic equation object that contains the solution(s).
-    template <typename mask_t>
-    DETRAY_HOST_DEVICE inline detail::quadratic_equation<scalar_type>
+    template <typename mask_t, typename transform3D_t>
+    DETRAY_HOST_DEVICE inline detail::branchless_quadratic_equation<scalar_type>
     solve_intersection(const ray_type &ray, const mask_t &mask,
-                       const transform3_type &trf) const {
+                       const transform3D_t &trf) const {
+        const auto [a, b, c] = quadratic_coefficients(ray, mask, trf);
+
+        return detail::branchless_quadratic_equation<scalar_type>{a, b, c};
+    }
+
+    /// @returns the coefficients (a, b, c) of the quadratic equation in the
+    /// path length, the solutions of which are the intersection points
+    template <typename mask_t, typename transform3D_t>
+    DETRAY_HOST_DEVICE inline darray<scalar_type, 3> quadratic_coefficients(
+        const ray_type &ray, const mask_t &mask,
+        const transform3D_t &trf) const {
         const scalar_type r{mask[mask_t::shape::e_r]};
         const vector3_type &sz = trf.z();
         const vector3_type &sc = trf.translation();
@@ -162,7 +174,7 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
         const scalar_type b{2.f * vector::dot(rd_cross_sz, pc_cross_sz)};
         const scalar_type c{vector::dot(pc_cross_sz, pc_cross_sz) - (r * r)};
 
-        return detail::quadratic_equation<scalar_type>{a, b, c};
+        return {a, b, c};
     }
 
     /// From the intersection path, construct an intersection candidate and
@@ -171,10 +183,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
     /// @returns the intersection candidate. Might be (partially) uninitialized
     /// if the overstepping tolerance is not met or the intersection lies
     /// outside of the mask.
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t>
     build_candidate(const ray_type &ray, mask_t &mask,
-                    const transform3_type &trf, const scalar_type path,
+                    const transform3D_t &trf, const scalar_type path,
                     const darray<scalar_type, 2u> mask_tolerance,
                     const scalar_type mask_tol_scalor,
                     const scalar_type overstep_tol) const {
@@ -189,15 +201,15 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
 
             const point3_type p3 = ro + path * rd;
 
-            const auto loc{mask_t::to_local_frame(trf, p3)};
+            // The full local point is only needed in debug mode
+            const auto loc{mask_t::template to_local_frame<!do_debug>(trf, p3)};
             if constexpr (intersection_type<surface_descr_t>::is_debug()) {
                 is.local = loc;
             }
             // Tolerance: per mille of the distance
             is.status = mask.is_inside(
-                loc, math::max(mask_tolerance[0],
-                               math::min(mask_tolerance[1],
-                                         mask_tol_scalor * math::fabs(path))));
+                loc, detail::path_mask_tolerance(
+                         mask_tolerance, mask_tol_scalor, path));
             is.direction = !detail::signbit(path);
             is.volume_link = mask.volume_link();
         } else {
@@ -20,6 +20,7 @@
 #include "detray/utils/quadratic_equation.hpp"
 
 // System include(s)
+#include <limits>
 #include <type_traits>
 
 namespace detray {
@@ -64,10 +65,10 @@ struct ray_intersector_impl<concentric_cylindrical2D<algebra_t>, algebra_t,
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the closest intersection
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf,
+        const transform3D_t &trf,
         const darray<scalar_type, 2u> mask_tolerance =
             {0.f, 1.f * unit<scalar_type>::mm},
         const scalar_type mask_tol_scalor = 0.f,
@@ -75,9 +76,28 @@ struct ray_intersector_impl<concentric_cylindrical2D<algebra_t>, algebra_t,
 
         intersection_type<surface_descr_t> is;
 
+        const auto [a, b, c] = this->quadratic_coefficients(ray, mask, trf);
+
+        // Fast path for the portals that the track moves away from (e.g. the
+        // inner portal of a barrel volume for an outgoing track): The
+        // quadratic is the squared distance to the cylinder axis minus r^2,
+        // so both solutions lie below the overstepping tolerance, if it is
+        // positive and rising there. Skip the square root and mask check
+        const scalar_type t0{overstep_tol};
+        if ((a * t0 + b) * t0 + c > 0.f && 2.f * a * t0 + b > 0.f) {
+            // Keep the sign of the path (point of closest approach, which
+            // lies behind the cutoff), so that callers that step towards the
+            // surface without a valid intersection (e.g. the direct
+            // navigator) keep stepping into the right direction
+            is.status = false;
+            is.path = (a > 0.f) ? -b / (2.f * a)
+                                : -std::numeric_limits<scalar_type>::max();
+            return is;
+        }
+
         // Intersecting the cylinder from the inside yield one intersection
         // along the direction of the track and one behind it
-        const auto qe = this->solve_intersection(ray, mask, trf);
+        const detail::branchless_quadratic_equation<scalar_type> qe{a, b, c};
 
         // Find the closest valid intersection
         if (qe.solutions() > 0) {
@@ -101,10 +121,10 @@ struct ray_intersector_impl<concentric_cylindrical2D<algebra_t>, algebra_t,
     }
 
     /// Interface to use fixed mask tolerance
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf, const scalar_type mask_tolerance,
+        const transform3D_t &trf, const scalar_type mask_tolerance,
         const scalar_type overstep_tol = 0.f) const {
         return this->operator()(ray, sf, mask, trf, {mask_tolerance, 0.f}, 0.f,
                                 overstep_tol);
@@ -120,10 +140,10 @@ struct ray_intersector_impl<concentric_cylindrical2D<algebra_t>, algebra_t,
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3D_t &trf,
         const darray<scalar_type, 2u> &mask_tolerance =
             {0.f, 1.f * unit<scalar_type>::mm},
         const scalar_type mask_tol_scalor = 0.f,
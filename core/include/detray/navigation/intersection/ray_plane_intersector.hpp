@@ -15,6 +15,7 @@
 #include "detray/geometry/coordinates/cartesian2D.hpp"
 #include "detray/geometry/coordinates/polar2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
 #include "detray/tracks/ray.hpp"
 
 // System include(s)
@@ -55,10 +56,10 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t, do_debug> {
     /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersection
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf,
+        const transform3D_t &trf,
         const darray<scalar_type, 2u> mask_tolerance =
             {0.f, 1.f * unit<scalar_type>::mm},
         const scalar_type mask_tol_scalor = 0.f,
@@ -82,16 +83,16 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t, do_debug> {
             if (is.path >= overstep_tol) {
 
                 const point3_type p3 = ro + is.path * rd;
-                const auto loc{mask_t::to_local_frame(trf, p3, rd)};
+                // The full local point is only needed in debug mode
+                const auto loc{
+                    mask_t::template to_local_frame<!do_debug>(trf, p3, rd)};
                 if constexpr (intersection_type<surface_descr_t>::is_debug()) {
                     is.local = loc;
                 }
                 // Tolerance: per mille of the distance
                 is.status = mask.is_inside(
-                    loc, math::max(
-                             mask_tolerance[0],
-                             math::min(mask_tolerance[1],
-                                       mask_tol_scalor * math::fabs(is.path))));
+                    loc, detail::path_mask_tolerance(
+                             mask_tolerance, mask_tol_scalor, is.path));
                 is.sf_desc = sf;
                 is.direction = !detail::signbit(is.path);
                 is.volume_link = mask.volume_link();
@@ -104,10 +105,10 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t, do_debug> {
     }
 
     /// Interface to use fixed mask tolerance
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline intersection_type<surface_descr_t> operator()(
         const ray_type &ray, const surface_descr_t &sf, const mask_t &mask,
-        const transform3_type &trf, const scalar_type mask_tolerance,
+        const transform3D_t &trf, const scalar_type mask_tolerance,
         const scalar_type overstep_tol = 0.f) const {
         return this->operator()(ray, sf, mask, trf, {mask_tolerance, 0.f}, 0.f,
                                 overstep_tol);
@@ -124,10 +125,10 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t, do_debug> {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     /// @param overstep_tol negative cutoff for the path
-    template <typename surface_descr_t, typename mask_t>
+    template <typename surface_descr_t, typename mask_t, typename transform3D_t>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection_type<surface_descr_t> &sfi,
-        const mask_t &mask, const transform3_type &trf,
+        const mask_t &mask, const transform3D_t &trf,
         const darray<scalar_type, 2u> &mask_tolerance =
             {0.f, 1.f * unit<scalar_type>::mm},
         const scalar_type mask_tol_scalor = 0.f,
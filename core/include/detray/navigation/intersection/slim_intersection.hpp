@@ -0,0 +1,167 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cstdint>
+#include <limits>
+#include <ostream>
+
+namespace detray {
+
+/// @brief Compact navigation candidate.
+///
+/// Holds the index of the surface in the detector surface container instead
+/// of the full surface descriptor, the path in single precision and the
+/// intersection status and direction as packed flags. The surface descriptor
+/// is fetched from the detector when it is needed.
+///
+/// Can be used as candidate type of the navigator, which reduces the memory
+/// that is moved when the candidate cache is filled and sorted.
+///
+/// @tparam surface_descr_t is the type of surface descriptor
+template <typename surface_descr_t, concepts::algebra algebra_t>
+struct slim_intersection2D {
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using nav_link_t = typename surface_descr_t::navigation_link;
+    using full_intersection_type =
+        intersection2D<surface_descr_t, algebra_t, false>;
+
+    /// Bits of the packed flags: inside the surface mask and along the track
+    /// direction
+    /// @{
+    static constexpr std::uint8_t e_inside{1u << 0u};
+    static constexpr std::uint8_t e_along{1u << 1u};
+    /// @}
+
+    /// Index of the surface in the detector surface container
+    dindex sf_index{detail::invalid_value<dindex>()};
+
+    /// Distance between track and candidate
+    float path = detail::invalid_value<float>();
+
+    /// Navigation information (next volume to go to)
+    nav_link_t volume_link{detail::invalid_value<nav_link_t>()};
+
+    /// Intersection status and direction (default: outside, along)
+    std::uint8_t flags{e_along};
+
+    /// Default constructor
+    constexpr slim_intersection2D() = default;
+
+    /// Construct from a full intersection @param is (drops the descriptor)
+    template <bool debug>
+    DETRAY_HOST_DEVICE constexpr slim_intersection2D(
+        const intersection2D<surface_descr_t, algebra_t, debug> &is)
+        : sf_index{is.sf_desc.barcode().is_invalid()
+                       ? detail::invalid_value<dindex>()
+                       : is.sf_desc.index()},
+          path{static_cast<float>(is.path)},
+          volume_link{is.volume_link},
+          flags{static_cast<std::uint8_t>(
+              (is.status ? e_inside : std::uint8_t{0u}) |
+              (is.direction ? e_along : std::uint8_t{0u}))} {}
+
+    /// @returns true if debug information needs to be filled
+    static consteval bool is_debug() { return false; }
+
+    /// @returns result of the intersection (true = inside the mask)
+    DETRAY_HOST_DEVICE
+    constexpr bool is_inside() const { return (flags & e_inside) != 0u; }
+
+    /// @returns direction of the intersection with respect to the track
+    /// (true = along, false = opposite)
+    DETRAY_HOST_DEVICE
+    constexpr bool is_along() const { return (flags & e_along) != 0u; }
+
+    /// @returns the descriptor of the surface, fetched from @param det
+    /// (a default descriptor with invalid barcode, if no surface is set)
+    template <typename detector_t>
+    DETRAY_HOST_DEVICE constexpr surface_descr_t surface(
+        const detector_t &det) const {
+        if (detail::is_invalid_value(sf_index)) {
+            return surface_descr_t{};
+        }
+        return det.surface(sf_index);
+    }
+
+    /// @returns the full intersection for the surface @param sf_desc
+    DETRAY_HOST_DEVICE
+    constexpr full_intersection_type expand(
+        const surface_descr_t &sf_desc) const {
+        full_intersection_type is{};
+        is.sf_desc = sf_desc;
+        is.path = static_cast<scalar_type>(path);
+        is.volume_link = volume_link;
+        is.status = is_inside();
+        is.direction = is_along();
+
+        return is;
+    }
+
+    /// @param rhs is the right hand side intersection for comparison
+    /// @{
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator<(const slim_intersection2D &lhs,
+                                    const slim_intersection2D &rhs) noexcept {
+        return (math::fabs(lhs.path) < math::fabs(rhs.path));
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator<=(const slim_intersection2D &lhs,
+                                     const slim_intersection2D &rhs) noexcept {
+        return (math::fabs(lhs.path) <= math::fabs(rhs.path));
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator>(const slim_intersection2D &lhs,
+                                    const slim_intersection2D &rhs) noexcept {
+        return (math::fabs(lhs.path) > math::fabs(rhs.path));
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator>=(const slim_intersection2D &lhs,
+                                     const slim_intersection2D &rhs) noexcept {
+        return (math::fabs(lhs.path) >= math::fabs(rhs.path));
+    }
+
+    DETRAY_HOST_DEVICE
+    friend constexpr bool operator==(const slim_intersection2D &lhs,
+                                     const slim_intersection2D &rhs) noexcept {
+        return math::fabs(lhs.path - rhs.path) <
+               std::numeric_limits<float>::epsilon();
+    }
+    /// @}
+
+    /// Transform to a string for output debugging
+    DETRAY_HOST
+    friend std::ostream &operator<<(std::ostream &out_stream,
+                                    const slim_intersection2D &is) {
+        out_stream << "dist:" << is.path << "\tsurface index: " << is.sf_index
+                   << ", links to vol:" << is.volume_link << ")";
+        out_stream << (is.is_inside() ? ", status: inside"
+                                      : ", status: outside");
+        out_stream << (is.is_along() ? ", direction: along"
+                                     : ", direction: opposite");
+        out_stream << std::endl;
+
+        return out_stream;
+    }
+};
+
+}  // namespace detray
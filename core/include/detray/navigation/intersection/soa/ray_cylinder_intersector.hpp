@@ -14,6 +14,7 @@
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/coordinates/cylindrical2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
 #include "detray/tracks/ray.hpp"
 #include "detray/utils/quadratic_equation.hpp"
 
@@ -77,6 +78,10 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
             overstep_tol);
         ret[0].sf_desc = sf;
 
+        // The lanes without a solution carry an invalid path
+        ret[1].status &= (qe.solutions() > 1.f);
+        ret[0].status &= (qe.solutions() > 0.f);
+
         // Even if there are two geometrically valid solutions, the smaller one
         // might not be passed on if it is below the overstepping tolerance:
         // see 'build_candidate'
@@ -106,15 +111,17 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
         const auto qe = solve_intersection(ray, mask, trf);
 
         // Construct the candidate only when needed
-        sfi.status = (qe.solutions() > 0.f);
+        const auto has_solution = (qe.solutions() > 0.f);
 
-        if (detray::detail::none_of(sfi.status)) {
+        if (detray::detail::none_of(has_solution)) {
+            sfi.status = has_solution;
             return;
         }
 
         sfi = build_candidate<surface_descr_t>(ray, mask, trf, qe.smaller(),
                                                mask_tolerance, mask_tol_scalor,
                                                overstep_tol);
+        sfi.status &= has_solution;
     }
 
     protected:
@@ -144,7 +151,7 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
         const scalar_type b = 2.f * vector::dot(rd_cross_sz, pc_cross_sz);
         const scalar_type c = vector::dot(pc_cross_sz, pc_cross_sz) - (r * r);
 
-        return detail::quadratic_equation<scalar_type>{a, b, c};
+        return detail::branchless_quadratic_equation<scalar_type>{a, b, c};
     }
 
     /// From the intersection path, construct an intersection candidate and
@@ -173,14 +180,14 @@ struct ray_intersector_impl<cylindrical2D<algebra_t>, algebra_t, do_debug> {
         is.path = path;
         const point3_type p3 = ro + is.path * rd;
 
-        const auto loc = mask_t::to_local_frame(trf, p3);
+        // The full local point is only needed in debug mode
+        const auto loc = mask_t::template to_local_frame<!do_debug>(trf, p3);
         if constexpr (intersection_type<surface_descr_t>::is_debug()) {
             is.local = loc;
         }
         is.status = mask.is_inside(
-            loc, math::max(mask_tolerance[0],
-                           math::min(mask_tolerance[1],
-                                     mask_tol_scalor * math::fabs(is.path))));
+            loc, detail::path_mask_tolerance(
+                     mask_tolerance, mask_tol_scalor, is.path));
 
         is.direction = !math::signbit(is.path);
         is.volume_link = mask.volume_link();
@@ -13,6 +13,7 @@
 #include "detray/definitions/math.hpp"
 #include "detray/geometry/coordinates/line2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
 #include "detray/tracks/ray.hpp"
 
 // System include(s)
@@ -99,14 +100,15 @@ struct ray_intersector_impl<line2D<algebra_t>, algebra_t, do_debug> {
 
         // point of closest approach on the track
         const point3_type m = ro + rd * is.path;
-        const auto loc = mask_t::to_local_frame(trf, m, rd);
+        // The full local point is only needed in debug mode
+        const auto loc =
+            mask_t::template to_local_frame<!do_debug>(trf, m, rd);
         if constexpr (intersection_type<surface_descr_t>::is_debug()) {
             is.local = loc;
         }
         is.status = mask.is_inside(
-            loc, math::max(mask_tolerance[0],
-                           math::min(mask_tolerance[1],
-                                     mask_tol_scalor * math::fabs(is.path))));
+            loc, detail::path_mask_tolerance(
+                     mask_tolerance, mask_tol_scalor, is.path));
 
         // Early return, in case all intersections are invalid
         if (detray::detail::none_of(is.status)) {
@@ -14,6 +14,7 @@
 #include "detray/geometry/coordinates/cartesian2D.hpp"
 #include "detray/geometry/coordinates/polar2D.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
 #include "detray/tracks/ray.hpp"
 
 // System include(s)
@@ -82,15 +83,15 @@ struct ray_intersector_impl<cartesian2D<algebra_t>, algebra_t, do_debug> {
         if (!std::isnan(check_sum) && !std::isinf(check_sum)) {
 
             const point3_type p3 = ro + is.path * rd;
-            const auto loc = mask_t::to_local_frame(trf, p3, rd);
+            // The full local point is only needed in debug mode
+            const auto loc =
+                mask_t::template to_local_frame<!do_debug>(trf, p3, rd);
             if constexpr (intersection_type<surface_descr_t>::is_debug()) {
                 is.local = loc;
             }
             is.status = mask.is_inside(
-                loc,
-                math::max(mask_tolerance[0],
-                          math::min(mask_tolerance[1],
-                                    mask_tol_scalor * math::fabs(is.path))));
+                loc, detail::path_mask_tolerance(
+                         mask_tolerance, mask_tol_scalor, is.path));
 
             // Early return, if no intersection was found
             if (detray::detail::none_of(is.status)) {
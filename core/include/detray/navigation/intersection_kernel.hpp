@@ -75,20 +75,21 @@ struct intersection_initialize {
     }
 
     private:
-    template <typename is_container_t>
+    /// @note The intersection type @tparam sfi_t of the intersector may
+    /// differ from the container value type (e.g. a slim candidate), in
+    /// which case it is converted on insertion
+    template <typename is_container_t, typename sfi_t>
     DETRAY_HOST_DEVICE bool place_in_collection(
-        const typename is_container_t::value_type &sfi,
-        is_container_t &intersections) const {
+        const sfi_t &sfi, is_container_t &intersections) const {
         if (sfi.status) {
             insert_sorted(sfi, intersections);
         }
         return sfi.status;
     }
 
-    template <typename is_container_t>
+    template <typename is_container_t, typename sfi_t>
     DETRAY_HOST_DEVICE bool place_in_collection(
-        darray<typename is_container_t::value_type, 2> &&solutions,
-        is_container_t &intersections) const {
+        darray<sfi_t, 2> &&solutions, is_container_t &intersections) const {
         bool is_valid = false;
         for (auto &sfi : std::move(solutions)) {
             if (sfi.status) {
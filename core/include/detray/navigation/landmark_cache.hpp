@@ -0,0 +1,306 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+namespace detray {
+
+/// @brief Cache of the initial navigation candidates for tracks that start
+/// close to a common point (landmark), e.g. the beam spot.
+///
+/// For every volume that contains the landmark, the cache holds a number of
+/// bins in the pseudorapidity and global phi of the track direction. Every
+/// bin lists the surfaces of the volume (including its portals) that can be
+/// reached from within the maximal distance to the landmark by a track above
+/// the minimal transverse momentum. The first navigation initialization of a
+/// track can then skip the full volume search and test only these candidates
+/// (@see navigator ).
+///
+/// @tparam algebra_t the algebra type of the track positions.
+/// @tparam surface_t the surface descriptor type of the candidates.
+/// @tparam container_t the types of underlying containers to be used.
+template <concepts::algebra algebra_t, typename surface_t,
+          typename container_t = host_container_types>
+class landmark_cache {
+
+    /// Positions of the parameters in the axis vector
+    enum axis_param : dindex {
+        e_x = 0u,
+        e_y = 1u,
+        e_z = 2u,
+        e_max_dist = 3u,
+        e_max_eta = 4u,
+        e_min_pT = 5u,
+        e_size = 6u,
+    };
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using scalar_type = dscalar<algebra_t>;
+
+    using view_type =
+        dmulti_view<dvector_view<scalar_type>, dvector_view<size_type>,
+                    dvector_view<size_type>, dvector_view<size_type>,
+                    dvector_view<surface_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const scalar_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const surface_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<scalar_type>, dvector_buffer<size_type>,
+                      dvector_buffer<size_type>, dvector_buffer<size_type>,
+                      dvector_buffer<surface_t>>;
+
+    /// Default constructor
+    constexpr landmark_cache() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr landmark_cache(vecmem::memory_resource* resource)
+        : m_axes(resource),
+          m_n_bins(resource),
+          m_volume_offsets(resource),
+          m_bin_offsets(resource),
+          m_candidates(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr landmark_cache(vecmem::memory_resource& resource)
+        : landmark_cache(&resource) {}
+
+    /// Constructor from memory resource and binning
+    ///
+    /// @param landmark the common starting point of the tracks
+    /// @param max_distance maximal distance of a track origin to the landmark
+    /// @param n_eta_bins number of bins in eta of the track direction
+    /// @param n_phi_bins number of bins in phi of the track direction
+    /// @param max_eta the eta bins span [-max_eta, max_eta], the outer bins
+    ///                also contain the directions beyond
+    /// @param min_pT minimal transverse momentum per charge of the tracks
+    ///               (zero, if the tracks do not bend)
+    DETRAY_HOST
+    landmark_cache(vecmem::memory_resource& resource,
+                   const point3_type& landmark, const scalar_type max_distance,
+                   const size_type n_eta_bins, const size_type n_phi_bins,
+                   const scalar_type max_eta, const scalar_type min_pT)
+        : landmark_cache(&resource) {
+        m_axes = {landmark[0], landmark[1], landmark[2], max_distance, max_eta,
+                  min_pT};
+        m_n_bins = {n_eta_bins, n_phi_bins};
+    }
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view cache_view_t>
+    DETRAY_HOST_DEVICE explicit landmark_cache(cache_view_t& view)
+        : m_axes(detail::get<0>(view.m_view)),
+          m_n_bins(detail::get<1>(view.m_view)),
+          m_volume_offsets(detail::get<2>(view.m_view)),
+          m_bin_offsets(detail::get<3>(view.m_view)),
+          m_candidates(detail::get<4>(view.m_view)) {}
+
+    /// @returns the number of volumes the cache was built for
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return m_volume_offsets.empty()
+                   ? 0u
+                   : static_cast<size_type>(m_volume_offsets.size()) - 1u;
+    }
+
+    /// @returns true if the cache was not built
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0} || m_axes.size() != e_size ||
+               m_n_bins.size() != 2u;
+    }
+
+    /// @returns the candidates of all volumes and bins
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<surface_t>& { return m_candidates; }
+
+    /// @returns the landmark the candidates were computed for
+    DETRAY_HOST_DEVICE
+    constexpr auto landmark() const -> point3_type {
+        return {m_axes[e_x], m_axes[e_y], m_axes[e_z]};
+    }
+
+    /// @returns the maximal distance of a track origin to the landmark
+    DETRAY_HOST_DEVICE
+    constexpr auto max_distance() const -> scalar_type {
+        return m_axes[e_max_dist];
+    }
+
+    /// @returns the range of the eta binning
+    DETRAY_HOST_DEVICE
+    constexpr auto max_eta() const -> scalar_type { return m_axes[e_max_eta]; }
+
+    /// @returns the minimal transverse momentum per charge of the tracks
+    DETRAY_HOST_DEVICE
+    constexpr auto min_pT() const -> scalar_type { return m_axes[e_min_pT]; }
+
+    /// @returns the number of bins in eta
+    DETRAY_HOST_DEVICE
+    constexpr auto n_eta_bins() const -> size_type { return m_n_bins[0]; }
+
+    /// @returns the number of bins in phi
+    DETRAY_HOST_DEVICE
+    constexpr auto n_phi_bins() const -> size_type { return m_n_bins[1]; }
+
+    /// @returns true if the cache holds candidates for the volume with
+    /// index @param vol_idx
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex vol_idx) const {
+        return !empty() && vol_idx < size() &&
+               m_volume_offsets[vol_idx + 1u] > m_volume_offsets[vol_idx];
+    }
+
+    /// @returns true if a track that starts at @param pos in the volume
+    /// @param vol_idx with direction @param dir and charge over momentum
+    /// @param qop can be initialized from the cache
+    DETRAY_HOST_DEVICE
+    constexpr bool applies(const dindex vol_idx, const point3_type& pos,
+                           const vector3_type& dir,
+                           const scalar_type qop) const {
+        if (!contains(vol_idx)) {
+            return false;
+        }
+        const vector3_type diff{pos - landmark()};
+        if (!(vector::dot(diff, diff) <= max_distance() * max_distance())) {
+            return false;
+        }
+
+        // Neutral tracks do not bend
+        if (qop == 0.f) {
+            return true;
+        }
+        const scalar_type sin_theta{vector::perp(dir) / vector::norm(dir)};
+
+        return sin_theta >= min_pT() * math::fabs(qop);
+    }
+
+    /// @returns the candidates in the volume @param vol_idx for a track that
+    /// starts close to the landmark in direction @param dir
+    DETRAY_HOST_DEVICE
+    auto candidates(const dindex vol_idx, const vector3_type& dir) const {
+        if (!contains(vol_idx)) {
+            return detray::ranges::subrange(m_candidates,
+                                            dindex_range{0u, 0u});
+        }
+        const dindex bin{
+            m_volume_offsets[vol_idx] +
+            eta_bin(dir, n_eta_bins(), max_eta()) * n_phi_bins() +
+            phi_bin(vector::phi(dir), n_phi_bins())};
+
+        return detray::ranges::subrange(
+            m_candidates, dindex_range{m_bin_offsets[bin],
+                                       m_bin_offsets[bin + 1u]});
+    }
+
+    /// @returns the eta bin of the direction @param dir for @param n bins in
+    /// [-max_eta, max_eta]
+    DETRAY_HOST_DEVICE
+    static constexpr dindex eta_bin(const vector3_type& dir, const dindex n,
+                                    const scalar_type max_eta) {
+        const scalar_type cos_theta{dir[2] / vector::norm(dir)};
+        const scalar_type eta{
+            0.5f * math::log((1.f + cos_theta) / (1.f - cos_theta))};
+
+        // Also catches invalid directions
+        if (!(eta > -max_eta)) {
+            return 0u;
+        }
+        if (eta >= max_eta) {
+            return n - 1u;
+        }
+        const auto b{static_cast<dindex>((eta + max_eta) / (2.f * max_eta) *
+                                         static_cast<scalar_type>(n))};
+
+        return b < n ? b : n - 1u;
+    }
+
+    /// @returns the phi bin of @param phi for @param n bins in [-pi, pi]
+    DETRAY_HOST_DEVICE
+    static constexpr dindex phi_bin(const scalar_type phi, const dindex n) {
+        constexpr scalar_type two_pi{2.f * constant<scalar_type>::pi};
+
+        const auto b{static_cast<dindex>(
+            (phi + constant<scalar_type>::pi) / two_pi *
+            static_cast<scalar_type>(n))};
+
+        return b < n ? b : n - 1u;
+    }
+
+    /// Add the bins of the next volume in the detector volume lookup. The
+    /// volumes have to be added in order of their index.
+    ///
+    /// @param bins the candidates per eta-phi bin, phi runs fastest (empty,
+    ///             if the volume does not contain the landmark)
+    template <typename bin_container_t>
+    DETRAY_HOST void push_back(const bin_container_t& bins) {
+        if (m_volume_offsets.empty()) {
+            m_volume_offsets.push_back(0u);
+            m_bin_offsets.push_back(0u);
+        }
+        for (const auto& bin : bins) {
+            m_candidates.insert(m_candidates.end(), bin.begin(), bin.end());
+            m_bin_offsets.push_back(static_cast<dindex>(m_candidates.size()));
+        }
+        m_volume_offsets.push_back(
+            static_cast<dindex>(m_bin_offsets.size()) - 1u);
+    }
+
+    /// @return the view on the cache - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_axes), detray::get_data(m_n_bins),
+                         detray::get_data(m_volume_offsets),
+                         detray::get_data(m_bin_offsets),
+                         detray::get_data(m_candidates)};
+    }
+
+    /// @return the view on the cache - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_axes), detray::get_data(m_n_bins),
+            detray::get_data(m_volume_offsets),
+            detray::get_data(m_bin_offsets), detray::get_data(m_candidates)};
+    }
+
+    private:
+    /// Landmark position, maximal distance and eta range
+    vector_type<scalar_type> m_axes{};
+    /// Number of bins in eta and phi
+    vector_type<size_type> m_n_bins{};
+    /// Range of bins per volume
+    vector_type<size_type> m_volume_offsets{};
+    /// Range of candidates per bin
+    vector_type<size_type> m_bin_offsets{};
+    /// The candidates of all bins
+    vector_type<surface_t> m_candidates{};
+};
+
+}  // namespace detray
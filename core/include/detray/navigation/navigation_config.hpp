@@ -11,8 +11,10 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/indexing.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/utils/grid/sorted_bins.hpp"
 
 // System include(s)
+#include <limits>
 #include <ostream>
 
 namespace detray::navigation {
@@ -25,6 +27,23 @@ enum class trust_level : std::uint_least8_t {
     e_full = 4u   ///< don't update anything
 };
 
+/// Navigation parameters that can be set for a single volume
+/// (@see volume_config_table )
+struct volume_config {
+    /// Index of the volume the parameters apply to
+    dindex volume{dindex_invalid};
+    /// Tolerance on the mask 'is_inside' check
+    /// @{
+    float min_mask_tolerance{1e-5f * unit<float>::mm};
+    float max_mask_tolerance{3.f * unit<float>::mm};
+    float mask_tolerance_scalor{5e-2f};
+    /// @}
+    /// How far behind the track position to look for candidates
+    float overstep_tolerance{-1000.f * unit<float>::um};
+    /// Search window size for grid based acceleration structures
+    darray<dindex, 2> search_window = {0u, 0u};
+};
+
 /// Navigation configuration
 struct config {
     /// Tolerance on the mask 'is_inside' check:
@@ -40,9 +59,89 @@ struct config {
     float path_tolerance{1.f * unit<float>::um};
     /// How far behind the track position to look for candidates
     float overstep_tolerance{-1000.f * unit<float>::um};
+    /// When no candidate in the cache is reachable anymore after an update
+    /// (e.g. the track overstepped its target by more than the overstep
+    /// tolerance), retry the cached candidates with a widened overstep
+    /// tolerance, before the volume is initialized again
+    bool retry_overstepped_candidates{false};
+    /// Factor on the overstep tolerance for the retry
+    float overstep_retry_scalor{10.f};
     /// Search window size for grid based acceleration structures
     /// (0, 0): only look at current bin
     darray<dindex, 2> search_window = {0u, 0u};
+    /// Adapt the search window to the incidence angle of the track on the
+    /// grid: The window covers the bins that the track passes within the
+    /// search depth (plus max. mask tolerance) normal to the grid and is
+    /// bounded by @c search_window. Requires grids, in which every bin holds
+    /// all surfaces that overlap with it, since stiff tracks will only query
+    /// a single bin
+    bool adaptive_search_window{false};
+    /// Like the adaptive search window, but only search the bins that the
+    /// track passes in front of its position (and behind it, within the
+    /// overstep tolerance): The window is set per axis and does not extend
+    /// to the bins behind or beside the track. Takes precedence over the
+    /// adaptive search window and has the same requirements on the grids
+    bool directed_search_window{false};
+    /// Distance normal to the grid within which the surfaces of the grid
+    /// are located (e.g. half the layer thickness)
+    float search_window_depth{5.f * unit<float>::mm};
+    /// Distance around the track position, within which the bins are added
+    /// to the search window, e.g. the envelope of a track bundle
+    /// (@see navigator::collect_neighborhood ). Only widens the search window
+    /// as configured, not the adaptive or directed search windows
+    float search_envelope{0.f};
+    /// Skip the navigation updates while the track cannot have reached any
+    /// candidate: After every update, the navigator calculates the distance
+    /// to the closest candidate surface, which the track has to travel before
+    /// anything can change
+    bool use_safe_distance{false};
+    /// Group the surfaces of the volume neighborhood by mask type before
+    /// intersecting them: The mask store is visited once per run of surfaces
+    /// with the same mask type, instead of once per surface
+    bool group_by_mask_type{false};
+    /// In volumes that contain only portals (e.g. gap volumes), target the
+    /// exit portal along a helix in the local magnetic field, so that the
+    /// track is moved there directly
+    bool fast_forward_gap_volumes{false};
+    /// Maximal relative change of the field strength across a gap volume,
+    /// above which the general navigation is used instead of the helix
+    float fast_forward_field_tolerance{1e-2f};
+    /// Only navigate to sensitive surfaces and portals (e.g. for fast
+    /// simulation): Passive surfaces are not intersected, so their material
+    /// has to be approximated by the volume material
+    bool sensitive_only{false};
+    /// Let the grids and brute force finders write the surface indices of
+    /// the neighborhood to a small buffer on the stack, instead of iterating
+    /// the range views of the search. Falls back to the range views, if the
+    /// neighborhood does not fit into the buffer
+    bool use_search_buffer{false};
+    /// Number of candidates, starting at the current target, for which the
+    /// transform and mask data are prefetched into the cache before the next
+    /// step is taken (zero: no prefetching)
+    unsigned int n_prefetch_candidates{0u};
+    /// Key along which the entries of the grid bins are sorted (has to match
+    /// the @c sort_by key of the bin filler): The search buffer then only
+    /// receives the surfaces that the track can reach within the maximal
+    /// search path. Takes effect together with @c use_search_buffer
+    bin_sort_key sorted_bin_key{bin_sort_key::e_none};
+    /// Maximal path length ahead of the track within which candidates are
+    /// searched in sorted bins (e.g. the maximal step size)
+    float max_search_path{std::numeric_limits<float>::max()};
+
+    /// @returns the configuration with the mask tolerances, the overstep
+    /// tolerance and the search window of the volume parameters @param entry
+    DETRAY_HOST_DEVICE
+    constexpr config for_volume(const volume_config& entry) const {
+        config vol_cfg{*this};
+
+        vol_cfg.min_mask_tolerance = entry.min_mask_tolerance;
+        vol_cfg.max_mask_tolerance = entry.max_mask_tolerance;
+        vol_cfg.mask_tolerance_scalor = entry.mask_tolerance_scalor;
+        vol_cfg.overstep_tolerance = entry.overstep_tolerance;
+        vol_cfg.search_window = entry.search_window;
+
+        return vol_cfg;
+    }
 
     /// Print the navigation configuration
     DETRAY_HOST
@@ -56,8 +155,38 @@ struct config {
             << cfg.path_tolerance / detray::unit<float>::um << " [um]\n"
             << "  Overstep tolerance    : "
             << cfg.overstep_tolerance / detray::unit<float>::um << " [um]\n"
+            << "  Retry overstepped     : " << std::boolalpha
+            << cfg.retry_overstepped_candidates << std::noboolalpha << "\n"
+            << "  Overstep retry scalor : " << cfg.overstep_retry_scalor
+            << "\n"
             << "  Search window         : " << cfg.search_window[0] << " x "
-            << cfg.search_window[1] << "\n";
+            << cfg.search_window[1] << "\n"
+            << "  Adaptive search window: " << std::boolalpha
+            << cfg.adaptive_search_window << std::noboolalpha << "\n"
+            << "  Directed search window: " << std::boolalpha
+            << cfg.directed_search_window << std::noboolalpha << "\n"
+            << "  Search window depth   : "
+            << cfg.search_window_depth / detray::unit<float>::mm << " [mm]\n"
+            << "  Search envelope       : "
+            << cfg.search_envelope / detray::unit<float>::mm << " [mm]\n"
+            << "  Use safe distance     : " << std::boolalpha
+            << cfg.use_safe_distance << std::noboolalpha << "\n"
+            << "  Group by mask type    : " << std::boolalpha
+            << cfg.group_by_mask_type << std::noboolalpha << "\n"
+            << "  Fast-forward gaps     : " << std::boolalpha
+            << cfg.fast_forward_gap_volumes << std::noboolalpha << "\n"
+            << "  Fast-forward field tol: "
+            << cfg.fast_forward_field_tolerance << "\n"
+            << "  Sensitive only        : " << std::boolalpha
+            << cfg.sensitive_only << std::noboolalpha << "\n"
+            << "  Use search buffer     : " << std::boolalpha
+            << cfg.use_search_buffer << std::noboolalpha << "\n"
+            << "  Prefetch candidates   : " << cfg.n_prefetch_candidates
+            << "\n"
+            << "  Sorted bin key        : "
+            << static_cast<int>(cfg.sorted_bin_key) << "\n"
+            << "  Max. search path      : "
+            << cfg.max_search_path / detray::unit<float>::mm << " [mm]\n";
 
         return out;
     }
@@ -16,11 +16,22 @@
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
 #include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/detail/lane_group.hpp"
+#include "detray/navigation/detail/safe_distance.hpp"
+#include "detray/navigation/intersection/fast_ray_intersector.hpp"
+#include "detray/navigation/intersection/helix_intersector.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection/slim_intersection.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
 #include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/landmark_cache.hpp"
+#include "detray/navigation/portal_links.hpp"
+#include "detray/navigation/volume_configs.hpp"
+#include "detray/navigation/volume_links.hpp"
+#include "detray/tracks/helix.hpp"
 #include "detray/tracks/ray.hpp"
+#include "detray/utils/prefetch.hpp"
 #include "detray/utils/ranges.hpp"
 
 namespace detray {
@@ -103,13 +114,23 @@ struct void_inspector {
 /// @tparam k_cache_capacity the capacity of the candidate cache
 /// @tparam inspector_t is a validation inspector that can record information
 ///         about the navigation state at different points of the nav. flow.
-/// @tparam intersection_t candidate type
+/// @tparam intersection_t candidate type (@c intersection2D or the compact
+///         @c slim_intersection2D, which fetches the surface descriptor from
+///         the detector when needed)
+/// @tparam intersector_t how to intersect the surfaces (@c ray_intersector or
+///         the @c fast_ray_intersector with approximate local phi coordinates)
+/// @tparam lane_group_t the group of lanes that navigates a track together
+///         (@see detail::lane_group.hpp ). A group with more than one lane
+///         shares the candidate intersection in @c init() between its lanes
 template <typename detector_t,
           std::size_t k_cache_capacity = navigation::default_cache_size,
           typename inspector_t = navigation::void_inspector,
           typename intersection_t =
               intersection2D<typename detector_t::surface_type,
-                             typename detector_t::algebra_type, false>>
+                             typename detector_t::algebra_type, false>,
+          template <typename, typename, bool> class intersector_t =
+              ray_intersector,
+          typename lane_group_t = detail::single_lane>
 class navigator {
 
     static_assert(k_cache_capacity >= 2u,
@@ -127,7 +148,22 @@ class navigator {
     using volume_type = typename detector_type::volume_type;
     using nav_link_type = typename detector_type::surface_type::navigation_link;
     using intersection_type = intersection_t;
+    using candidate_path_type = decltype(intersection_t::path);
     using inspector_type = inspector_t;
+    using lane_group_type = lane_group_t;
+    /// Table of the likely next candidates after a volume switch
+    using portal_links_type =
+        portal_link_table<algebra_type, typename detector_type::surface_type,
+                          device_container_types>;
+    /// Table of the next volume per portal
+    using volume_links_type =
+        volume_link_table<volume_type, device_container_types>;
+    /// Table of the navigation parameters per volume
+    using volume_configs_type = volume_config_table<device_container_types>;
+    /// Cache of the initial candidates for tracks from a common start point
+    using landmark_cache_type =
+        landmark_cache<algebra_type, typename detector_type::surface_type,
+                       device_container_types>;
 
     public:
     /// @brief A navigation state object used to cache the information of the
@@ -143,8 +179,8 @@ class navigator {
         friend class navigator;
 
         // Allow the filling/updating of candidates
-        friend struct intersection_initialize<ray_intersector>;
-        friend struct intersection_update<ray_intersector>;
+        friend struct intersection_initialize<intersector_t>;
+        friend struct intersection_update<intersector_t>;
 
         using candidate_t = intersection_type;
         using candidate_cache_t = darray<candidate_t, k_cache_capacity>;
@@ -193,6 +229,87 @@ class navigator {
         DETRAY_HOST_DEVICE
         const detector_type &detector() const { return (*m_detector); }
 
+        /// Point the state to the detector @param det, e.g. when the state is
+        /// kept in global memory between kernels that each set up their own
+        /// device detector from the same detector view
+        DETRAY_HOST_DEVICE
+        void set_detector(const detector_type &det) { m_detector = &det; }
+
+        /// Reset the state for a new track, but keep the detector and the
+        /// optional navigation tables
+        DETRAY_HOST_DEVICE
+        void reset() {
+            const portal_links_type *pt_links{m_portal_links};
+            const landmark_cache_type *lm_cache{m_landmarks};
+            const volume_links_type *vol_links{m_volume_links};
+            const volume_configs_type *vol_cfgs{m_volume_configs};
+
+            *this = state(*m_detector);
+
+            m_portal_links = pt_links;
+            m_landmarks = lm_cache;
+            m_volume_links = vol_links;
+            m_volume_configs = vol_cfgs;
+        }
+
+        /// @returns the portal link table, if set - const
+        DETRAY_HOST_DEVICE
+        auto portal_links() const -> const portal_links_type * {
+            return m_portal_links;
+        }
+
+        /// Use the likely next candidates in the portal link table
+        /// @param links to initialize the next volume after a volume switch.
+        /// Falls back to the full neighborhood search, if the table does not
+        /// apply to the track or no candidate is reachable.
+        DETRAY_HOST_DEVICE
+        void set_portal_links(const portal_links_type &links) {
+            m_portal_links = &links;
+        }
+
+        /// @returns the landmark cache, if set - const
+        DETRAY_HOST_DEVICE
+        auto landmarks() const -> const landmark_cache_type * {
+            return m_landmarks;
+        }
+
+        /// Use the initial candidates in the landmark cache @param cache for
+        /// tracks that start close to the landmark. Falls back to the full
+        /// volume search, if the initialization from the cache fails.
+        DETRAY_HOST_DEVICE
+        void set_landmark_cache(const landmark_cache_type &cache) {
+            m_landmarks = &cache;
+        }
+
+        /// @returns the volume link table, if set - const
+        DETRAY_HOST_DEVICE
+        auto volume_links() const -> const volume_links_type * {
+            return m_volume_links;
+        }
+
+        /// Read the next volume after a portal from the records in the volume
+        /// link table @param links instead of the detector volume container
+        DETRAY_HOST_DEVICE
+        void set_volume_links(const volume_links_type &links) {
+            m_volume_links = &links;
+        }
+
+        /// @returns the table of the navigation parameters per volume, if
+        /// set - const
+        DETRAY_HOST_DEVICE
+        auto volume_configs() const -> const volume_configs_type * {
+            return m_volume_configs;
+        }
+
+        /// Replace the mask tolerances, the overstep tolerance and the search
+        /// window of the global configuration in the volumes that have an
+        /// entry in the table @param cfgs
+        DETRAY_HOST_DEVICE
+        void set_volume_configs(const volume_configs_type &cfgs) {
+            m_volume_configs = &cfgs;
+            reset_volume_config();
+        }
+
         /// @returns the navigation heartbeat
         DETRAY_HOST_DEVICE
         bool is_alive() const { return m_heartbeat; }
@@ -203,6 +320,19 @@ class navigator {
             return m_candidates;
         }
 
+        /// @returns the capacity of the candidate cache
+        DETRAY_HOST_DEVICE
+        static constexpr auto cache_capacity() -> std::size_t {
+            return k_cache_capacity;
+        }
+
+        /// @returns number of occupied slots in the cache, including the
+        /// candidates that were already passed - const
+        DETRAY_HOST_DEVICE
+        inline auto n_cached() const -> dindex {
+            return static_cast<dindex>(m_last + 1);
+        }
+
         /// @returns numer of currently cached (reachable) candidates - const
         DETRAY_HOST_DEVICE
         inline auto n_candidates() const -> dindex {
@@ -263,13 +393,13 @@ class navigator {
         /// (invalid when not on surface) - const
         DETRAY_HOST_DEVICE
         inline auto barcode() const -> geometry::barcode {
-            return current().sf_desc.barcode();
+            return current().surface(*m_detector).barcode();
         }
 
         /// @returns the next surface the navigator intends to reach
         template <template <typename> class surface_t = tracking_surface>
         DETRAY_HOST_DEVICE inline auto next_surface() const {
-            return surface_t{*m_detector, target().sf_desc};
+            return surface_t{*m_detector, target().surface(*m_detector)};
         }
 
         /// @returns current detector surface the navigator is on
@@ -277,7 +407,7 @@ class navigator {
         template <template <typename> class surface_t = tracking_surface>
         DETRAY_HOST_DEVICE inline auto get_surface() const {
             assert(is_on_surface());
-            return surface_t{*m_detector, current().sf_desc};
+            return surface_t{*m_detector, current().surface(*m_detector)};
         }
 
         /// @returns current detector volume of the navigation stream
@@ -309,6 +439,24 @@ class navigator {
             return m_trust_level;
         }
 
+        /// @returns the path length the track can still travel without
+        /// reaching any candidate - const
+        DETRAY_HOST_DEVICE
+        inline auto safe_distance() const -> scalar_type {
+            return m_safe_distance;
+        }
+
+        /// Notify the navigation that the track travelled the path length
+        /// @param step (only needed with @c use_safe_distance )
+        DETRAY_HOST_DEVICE
+        inline void advance(const scalar_type step) {
+            if (m_safe_distance > 0.f) {
+                m_safe_distance -= math::fabs(step);
+                target().path -=
+                    static_cast<candidate_path_type>(math::fabs(step));
+            }
+        }
+
         /// Update navigation trust level to no trust
         DETRAY_HOST_DEVICE
         inline void set_no_trust() {
@@ -369,8 +517,9 @@ class navigator {
         /// Helper method to check the track has encountered material
         DETRAY_HOST_DEVICE
         inline auto encountered_sf_material() const -> bool {
-            return (is_on_surface()) && (current().sf_desc.material().id() !=
-                                         detector_t::materials::id::e_none);
+            return (is_on_surface()) &&
+                   (current().surface(*m_detector).material().id() !=
+                    detector_t::materials::id::e_none);
         }
 
         /// Helper method to check if a kernel is exhausted - const
@@ -509,6 +658,12 @@ class navigator {
         constexpr void insert(candidate_itr_t pos,
                               const intersection_type &new_cadidate) {
 
+            // Cache is full: either the new candidate or the last candidate
+            // will be dropped (let the inspector know, if it is interested)
+            if (static_cast<std::size_t>(m_last + 1) == k_cache_capacity) {
+                run_overflow_inspector();
+            }
+
             // Candidate is too far away to be placed in cache
             if (pos == m_candidates.end()) {
                 return;
@@ -605,10 +760,45 @@ class navigator {
         inline void clear() {
             // Mark all data in the cache as unreachable
             for (std::size_t i = 0u; i < k_cache_capacity; ++i) {
-                m_candidates[i].path = std::numeric_limits<scalar_type>::max();
+                m_candidates[i].path =
+                    std::numeric_limits<candidate_path_type>::max();
             }
             m_next = 0;
             m_last = -1;
+            m_safe_distance = 0.f;
+        }
+
+        /// @returns the navigation parameters of the volume @param vol_idx,
+        /// if it has its own (nullptr otherwise)
+        DETRAY_HOST_DEVICE
+        inline auto find_volume_config(const dindex vol_idx) const
+            -> const navigation::volume_config * {
+            if (m_volume_configs == nullptr ||
+                !m_volume_configs->contains(vol_idx)) {
+                return nullptr;
+            }
+            return &(m_volume_configs->at(vol_idx));
+        }
+
+        /// @returns the navigation parameters of the current volume, if it
+        /// has its own (nullptr otherwise)
+        ///
+        /// The parameters are looked up in the table only when the volume
+        /// changed since the last call.
+        DETRAY_HOST_DEVICE
+        inline auto volume_config() -> const navigation::volume_config * {
+            if (m_config_volume != m_volume_index) {
+                m_volume_config = find_volume_config(m_volume_index);
+                m_config_volume = m_volume_index;
+            }
+            return m_volume_config;
+        }
+
+        /// Look up the configuration of the current volume again on the next
+        /// call to @c volume_config
+        DETRAY_HOST_DEVICE
+        constexpr void reset_volume_config() {
+            m_config_volume = detail::invalid_value<nav_link_type>();
         }
 
         /// Call the navigation inspector
@@ -638,12 +828,31 @@ class navigator {
             }
         }
 
+        /// Call the navigation inspector, if it records cache overflows
+        DETRAY_HOST_DEVICE
+        inline void run_overflow_inspector() {
+            if constexpr (requires(inspector_t & insp, const state &s) {
+                              insp.cache_overflow(s);
+                          }) {
+                m_inspector.cache_overflow(*this);
+            }
+        }
+
         /// Our cache of candidates (intersections with any kind of surface)
         candidate_cache_t m_candidates;
 
         /// Detector pointer
         const detector_type *m_detector{nullptr};
 
+        /// Optional portal link table (full neighborhood search, if not set)
+        const portal_links_type *m_portal_links{nullptr};
+        /// Optional landmark cache (full volume search on init, if not set)
+        const landmark_cache_type *m_landmarks{nullptr};
+        /// Optional volume link table (detector volume lookup, if not set)
+        const volume_links_type *m_volume_links{nullptr};
+        /// Optional navigation parameters per volume (global, if not set)
+        const volume_configs_type *m_volume_configs{nullptr};
+
         /// Index in the detector volume container of current navigation volume
         nav_link_type m_volume_index{0u};
 
@@ -655,6 +864,15 @@ class navigator {
         /// Can never be advanced beyond the last element
         dist_t m_last{-1};
 
+        /// Path length the track can still travel without reaching a
+        /// candidate (zero, if the next step needs a navigation update)
+        scalar_type m_safe_distance{0.f};
+
+        /// Navigation parameters of the volume @c m_config_volume in the
+        /// table (nullptr, if the volume uses the global configuration)
+        const navigation::volume_config *m_volume_config{nullptr};
+        nav_link_type m_config_volume{detail::invalid_value<nav_link_type>()};
+
         /// The navigation status
         navigation::status m_status{navigation::status::e_unknown};
 
@@ -669,6 +887,10 @@ class navigator {
         /// Heartbeat of this navigation flow signals navigation is alive
         bool m_heartbeat{false};
 
+        /// Whether the navigation was initialized before (the landmark cache
+        /// only applies to the first initialization of the track)
+        bool m_is_initialized{false};
+
         /// The inspector type of this navigation engine
         [[no_unique_address]] inspector_type m_inspector;
     };
@@ -690,7 +912,7 @@ class navigator {
 
             const auto sf = geometry::surface{det, sf_descr};
 
-            sf.template visit_mask<intersection_initialize<ray_intersector>>(
+            sf.template visit_mask<intersection_initialize<intersector_t>>(
                 nav_state,
                 detail::ray<algebra_type>(
                     track.pos(),
@@ -702,197 +924,1483 @@ class navigator {
         }
     };
 
-    public:
-    /// @brief Helper method to initialize a volume.
-    ///
-    /// Calls the volumes accelerator structure for local navigation, then tests
-    /// the surfaces for intersection and sorts the reachable candidates to find
-    /// the clostest one (next candidate).
-    ///
-    /// @tparam track_t type of track, needs to provide pos() and dir() methods
-    ///
-    /// @param track access to the track parameters
-    /// @param state the current navigation state
-    /// @param cfg the navigation configuration
-    template <typename track_t>
-    DETRAY_HOST_DEVICE inline void init(
-        const track_t &track, state &navigation, const navigation::config &cfg,
-        const context_type &ctx,
-        const bool use_path_tolerance_as_overstep_tolerance = true) const {
-        const auto &det = navigation.detector();
-        const auto volume = tracking_volume{det, navigation.volume()};
+    /// Calls the functor @tparam functor_t only on surfaces that are not
+    /// passive (@see navigation::config::sensitive_only)
+    template <typename functor_t>
+    struct skip_passive {
 
-        // Do not resurrect a failed/finished navigation state
-        assert(navigation.status() > navigation::status::e_on_target);
-        assert(!track.is_invalid());
+        template <typename... Args>
+        DETRAY_HOST_DEVICE void operator()(
+            const typename detector_type::surface_type &sf_descr,
+            Args &&... args) const {
+            if (!sf_descr.is_passive()) {
+                functor_t{}(sf_descr, std::forward<Args>(args)...);
+            }
+        }
+    };
 
-        // Clean up state
-        navigation.clear();
-        navigation.m_heartbeat = true;
+    /// Call the functor @tparam functor_t on the neighborhood of @param volume
+    /// and leave out the passive surfaces, if requested in @param cfg
+    template <typename functor_t, typename track_t, typename... Args>
+    DETRAY_HOST_DEVICE static void visit_candidates(
+        const tracking_volume<detector_type> &volume, const track_t &track,
+        const navigation::config &cfg, const context_type &ctx,
+        Args &&... args) {
+        if (cfg.sensitive_only) {
+            volume.template visit_neighborhood<skip_passive<functor_t>>(
+                track, cfg, ctx, std::forward<Args>(args)...);
+        } else {
+            volume.template visit_neighborhood<functor_t>(
+                track, cfg, ctx, std::forward<Args>(args)...);
+        }
+    }
 
-        // Search for neighboring surfaces and fill candidates into cache
-        const scalar_type overstep_tol =
-            use_path_tolerance_as_overstep_tolerance ? -cfg.path_tolerance
-                                                     : cfg.overstep_tolerance;
+    /// A functor that prefetches the first mask of a surface
+    struct mask_prefetcher {
 
-        volume.template visit_neighborhood<candidate_search>(
-            track, cfg, ctx, det, ctx, track, navigation,
-            darray<scalar_type, 2u>{cfg.min_mask_tolerance,
-                                    cfg.max_mask_tolerance},
-            static_cast<scalar_type>(cfg.mask_tolerance_scalor),
-            static_cast<scalar_type>(overstep_tol));
+        template <typename mask_group_t, typename mask_range_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const mask_group_t &mask_group,
+            const mask_range_t &mask_range) const {
+            const auto masks = detray::ranges::subrange(mask_group, mask_range);
+            detail::prefetch(&(*detray::ranges::begin(masks)));
+        }
+    };
 
-        // Determine overall state of the navigation after updating the cache
-        update_navigation_state(navigation, cfg);
+    /// Intersection of a portal with a helix
+    using helix_intersection_type =
+        intersection2D<typename detector_type::surface_type, algebra_type,
+                       true>;
 
-        // If init was not successful, the propagation setup might be broken
-        if (navigation.trust_level() != navigation::trust_level::e_full) {
-            // Do not exit if backward navigation starts on the outmost portal
-            if (navigation.is_on_portal() &&
-                navigation.direction() == navigation::direction::e_backward) {
-                navigation.m_trust_level =
-                    detail::is_invalid_value(navigation.current().volume_link)
-                        ? navigation::trust_level::e_full
-                        : navigation::trust_level::e_no_trust;
+    /// A functor that keeps the closest intersection of a portal with a helix
+    /// in front of the track (called on the mask group of the portal)
+    struct exit_portal_search {
+
+        template <typename mask_group_t, typename mask_range_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const mask_group_t &mask_group, const mask_range_t &mask_range,
+            const detail::helix<algebra_type> &hlx,
+            const typename detector_type::surface_type &pt_desc,
+            const detector_type &det, const context_type &ctx,
+            const scalar_type path_tol, helix_intersection_type &exit,
+            bool &is_supported) const {
+
+            using mask_t = typename mask_group_t::value_type;
+            using helix_intersector_t =
+                helix_intersector<typename mask_t::shape, algebra_type>;
+
+            // Not all shapes can be intersected with a helix
+            if constexpr (!std::is_invocable_v<
+                              helix_intersector_t,
+                              const detail::helix<algebra_type> &,
+                              const typename detector_type::surface_type &,
+                              const mask_t &,
+                              const dtransform3D<algebra_type> &,
+                              const darray<scalar_type, 2u>>) {
+                is_supported = false;
             } else {
-                navigation.m_heartbeat = false;
+                const auto &ctf =
+                    det.transform_store().at(pt_desc.transform(), ctx);
+
+                for (const auto &mask :
+                     detray::ranges::subrange(mask_group, mask_range)) {
+                    update_exit(helix_intersector_t{}(
+                                    hlx, pt_desc, mask, ctf,
+                                    darray<scalar_type, 2u>{0.f, 0.f}),
+                                path_tol, exit);
+                }
             }
         }
 
-        navigation.run_inspector(cfg, track.pos(), track.dir(),
-                                 "Init complete: ");
-    }
-
-    /// @brief Complete update of the navigation flow.
-    ///
-    /// Restores 'full trust' state to the cadidates cache and checks whether
-    /// the track stepped onto a portal and a volume switch is due. If so, or
-    /// when the previous update according to the given trust level
-    /// failed to restore trust, it performs a complete reinitialization of the
-    /// navigation.
-    ///
-    /// @tparam track_t type of track, needs to provide pos() and dir() methods
-    ///
-    /// @param track access to the track parameters
-    /// @param state the current navigation state
-    /// @param cfg the navigation configuration
-    ///
-    /// @returns a heartbeat to indicate if the navigation is still alive
-    template <typename track_t>
-    DETRAY_HOST_DEVICE inline bool update(
-        const track_t &track, state &navigation, const navigation::config &cfg,
-        const context_type &ctx = {},
-        const bool /*is_before_actor*/ = true) const {
-
-        assert(!track.is_invalid());
-
-        // Candidates are re-evaluated based on the current trust level.
-        // Should result in 'full trust'
-        bool is_init = update_kernel(track, navigation, cfg, ctx);
-
-        // Update was completely successful (most likely case)
-        if (navigation.trust_level() == navigation::trust_level::e_full) {
-            return is_init;
+        private:
+        DETRAY_HOST_DEVICE
+        void update_exit(const helix_intersection_type &sfi,
+                         const scalar_type path_tol,
+                         helix_intersection_type &exit) const {
+            if (sfi.status && sfi.path > path_tol && sfi.path < exit.path) {
+                exit = sfi;
+            }
         }
-        // Otherwise: did we run into a portal?
-        else if (navigation.is_on_portal()) {
-            // Navigation reached the end of the detector world
-            if (detail::is_invalid_value(navigation.current().volume_link)) {
-                navigation.exit();
-                return is_init;
+
+        DETRAY_HOST_DEVICE
+        void update_exit(const darray<helix_intersection_type, 2> &solutions,
+                         const scalar_type path_tol,
+                         helix_intersection_type &exit) const {
+            for (const auto &sfi : solutions) {
+                update_exit(sfi, path_tol, exit);
             }
+        }
+    };
 
-            // Set volume index to the next volume provided by the portal
-            navigation.set_volume(navigation.current().volume_link);
+    /// Surfaces of the volume neighborhood that are waiting to be
+    /// intersected, so that they can be grouped by mask type
+    struct candidate_batch {
+        /// Maximal number of surfaces before the batch is intersected
+        static constexpr dindex k_capacity{16u};
 
-            // Either end of world or valid volume index
-            assert(detail::is_invalid_value(navigation.volume()) ||
-                   navigation.volume() <
-                       navigation.detector().volumes().size());
+        darray<typename detector_type::surface_type, k_capacity> surfaces{};
+        dindex size{0u};
+    };
 
-            // Run inspection when needed (keep for debugging)
-            // navigation.run_inspector(cfg, track.pos(), track.dir(), "Volume
-            // switch: ");
+    /// A functor that intersects a run of surfaces that share the same mask
+    /// type (called on the mask group, the mask type is fixed per call)
+    struct grouped_candidate_search {
 
-            init(track, navigation, cfg, ctx);
-            is_init = true;
+        template <typename mask_group_t, typename surface_range_t,
+                  typename track_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const mask_group_t &mask_group, const surface_range_t &surfaces,
+            const detector_type &det, const context_type &ctx,
+            const track_t &track, state &nav_state,
+            const darray<scalar_type, 2> mask_tol,
+            const scalar_type mask_tol_scalor,
+            const scalar_type overstep_tol) const {
 
-            // Fresh initialization, reset trust and hearbeat even though we are
-            // on inner portal
-            navigation.m_trust_level = navigation::trust_level::e_full;
-            navigation.m_heartbeat = true;
+            const detail::ray<algebra_type> ray(
+                track.pos(),
+                static_cast<scalar_type>(nav_state.direction()) * track.dir());
+
+            for (const auto &sf_descr : surfaces) {
+                intersection_initialize<intersector_t>{}(
+                    mask_group, sf_descr.mask().index(), nav_state, ray,
+                    sf_descr, det.transform_store(), ctx,
+                    sf_descr.is_portal() ? darray<scalar_type, 2>{0.f, 0.f}
+                                         : mask_tol,
+                    mask_tol_scalor, overstep_tol);
+            }
         }
-        // If no trust could be restored for the current state, (local)
-        // navigation might be exhausted: re-initialize volume
-        else {
-            // Use overstep tolerance instead of path tolerance
-            const bool use_path_tolerance_as_overstep_tolerance = false;
+    };
 
-            init(track, navigation, cfg, ctx,
-                 use_path_tolerance_as_overstep_tolerance);
-            is_init = true;
+    /// A functor that collects the surfaces of the volume neighborhood into
+    /// a batch, which is intersected when it is full
+    struct candidate_collector {
 
-            // Sanity check: Should never be the case after complete update call
-            if (navigation.trust_level() != navigation::trust_level::e_full) {
-                // Try to save the navigation flow: Look further behind the
-                // track
-                auto loose_cfg{cfg};
-                // Use the max mask tolerance in case a track leaves the volume
-                // when a sf is 'sticking' out of the portals due to the tol
-                loose_cfg.overstep_tolerance =
-                    math::min(100.f * cfg.overstep_tolerance,
-                              -10.f * cfg.max_mask_tolerance);
+        template <typename track_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const typename detector_type::surface_type &sf_descr,
+            candidate_batch &batch, const detector_type &det,
+            const context_type &ctx, const track_t &track, state &nav_state,
+            const darray<scalar_type, 2> mask_tol,
+            const scalar_type mask_tol_scalor,
+            const scalar_type overstep_tol) const {
+
+            batch.surfaces[batch.size] = sf_descr;
+            ++batch.size;
 
-                init(track, navigation, loose_cfg, ctx,
-                     use_path_tolerance_as_overstep_tolerance);
+            if (batch.size == candidate_batch::k_capacity) {
+                intersect_batch(batch, det, ctx, track, nav_state, mask_tol,
+                                mask_tol_scalor, overstep_tol);
             }
         }
-        // Unrecoverable
-        if (navigation.trust_level() != navigation::trust_level::e_full ||
-            navigation.is_exhausted()) {
-            navigation.abort("Navigator: No reachable surfaces");
+    };
+
+    /// Intersect the surfaces in @param batch with one mask store visit per
+    /// mask type and empty the batch afterwards
+    template <typename track_t>
+    DETRAY_HOST_DEVICE static void intersect_batch(
+        candidate_batch &batch, const detector_type &det,
+        const context_type &ctx, const track_t &track, state &nav_state,
+        const darray<scalar_type, 2> mask_tol,
+        const scalar_type mask_tol_scalor, const scalar_type overstep_tol) {
+
+        auto &surfaces = batch.surfaces;
+
+        // Sort by mask type (insertion sort: the surfaces of an acceleration
+        // structure bin are often already grouped)
+        for (dindex i = 1u; i < batch.size; ++i) {
+            const auto sf_descr = surfaces[i];
+            dindex j{i};
+            for (; j > 0u &&
+                   sf_descr.mask().id() < surfaces[j - 1u].mask().id();
+                 --j) {
+                surfaces[j] = surfaces[j - 1u];
+            }
+            surfaces[j] = sf_descr;
         }
 
-        return is_init;
-    }
+        // Visit the mask store once for every run of the same mask type
+        dindex first{0u};
+        while (first < batch.size) {
+            const auto mask_id{surfaces[first].mask().id()};
 
-    private:
-    /// Helper method to update the candidates (surface intersections)
-    /// based on an externally provided trust level. Will (re-)initialize the
-    /// navigation if there is no trust.
-    ///
-    /// @tparam track_t type of track, needs to provide pos() and dir() methods
-    ///
-    /// @param track access to the track parameters
-    /// @param state the current navigation state
-    /// @param cfg the navigation configuration
-    template <typename track_t>
-    DETRAY_HOST_DEVICE inline bool update_kernel(
-        const track_t &track, state &navigation, const navigation::config &cfg,
-        const context_type &ctx) const {
+            dindex last{first + 1u};
+            while (last < batch.size && surfaces[last].mask().id() == mask_id) {
+                ++last;
+            }
 
-        const auto &det = navigation.detector();
+            det.mask_store().template visit<grouped_candidate_search>(
+                mask_id,
+                detray::ranges::subrange(surfaces, dindex_range{first, last}),
+                det, ctx, track, nav_state, mask_tol, mask_tol_scalor,
+                overstep_tol);
 
-        // Current candidates are up to date, nothing left to do
-        if (navigation.trust_level() == navigation::trust_level::e_full) {
-            return false;
+            first = last;
         }
 
-        // Update only the current candidate and the corresponding next target
-        // - do this only when the navigation state is still coherent
-        if (navigation.trust_level() == navigation::trust_level::e_high) {
-            // Update next candidate: If not reachable, 'high trust' is broken
-            if (!update_candidate(navigation.direction(), navigation.target(),
-                                  track, det, cfg, ctx)) {
-                navigation.m_status = navigation::status::e_unknown;
-                navigation.set_fair_trust();
-            } else {
-
-                // Update navigation flow on the new candidate information
-                update_navigation_state(navigation, cfg);
+        batch.size = 0u;
+    }
 
-                navigation.run_inspector(cfg, track.pos(), track.dir(),
-                                         "Update complete: high trust: ");
+    /// A functor that collects the surfaces of the volume neighborhood into
+    /// a batch, which is intersected by the lane group when it is full
+    struct cooperative_candidate_collector {
+
+        template <typename track_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const typename detector_type::surface_type &sf_descr,
+            candidate_batch &batch, const detector_type &det,
+            const context_type &ctx, const track_t &track, state &nav_state,
+            const darray<scalar_type, 2> mask_tol,
+            const scalar_type mask_tol_scalor,
+            const scalar_type overstep_tol) const {
+
+            batch.surfaces[batch.size] = sf_descr;
+            ++batch.size;
+
+            if (batch.size == candidate_batch::k_capacity) {
+                intersect_batch_cooperative(batch, det, ctx, track, nav_state,
+                                            mask_tol, mask_tol_scalor,
+                                            overstep_tol);
+            }
+        }
+    };
+
+    /// A functor that collects the surfaces of the volume neighborhood of a
+    /// track bundle (@see collect_neighborhood)
+    struct neighborhood_collector {
+
+        template <typename neighborhood_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const typename detector_type::surface_type &sf_descr,
+            neighborhood_t &neighborhood) const {
+
+            if (neighborhood.size == neighborhood_t::k_capacity) {
+                neighborhood.overflow = true;
+                return;
+            }
+            neighborhood.surfaces[neighborhood.size] = sf_descr;
+            ++neighborhood.size;
+        }
+    };
+
+    /// Intersect the surfaces in @param batch with the lanes of the group:
+    /// Every lane intersects every lane_group_t::size-th surface and inserts
+    /// the result into its own cache (@see merge_lane_candidates)
+    template <typename track_t>
+    DETRAY_HOST_DEVICE static void intersect_batch_cooperative(
+        candidate_batch &batch, const detector_type &det,
+        const context_type &ctx, const track_t &track, state &nav_state,
+        const darray<scalar_type, 2> mask_tol,
+        const scalar_type mask_tol_scalor, const scalar_type overstep_tol) {
+
+        auto &surfaces = batch.surfaces;
+
+        // Sort by mask type, so that neighbouring lanes intersect the same
+        // shape and do not diverge (the sorting network does not diverge
+        // either, which the insertion sort would)
+        detail::network_sort<candidate_batch::k_capacity>(
+            surfaces.begin(), surfaces.begin() + batch.size,
+            [](const auto &lhs, const auto &rhs) {
+                return lhs.mask().id() < rhs.mask().id();
+            });
+
+        for (dindex i = lane_group_t::rank(); i < batch.size;
+             i += lane_group_t::size) {
+            candidate_search{}(surfaces[i], det, ctx, track, nav_state,
+                               mask_tol, mask_tol_scalor, overstep_tol);
+        }
+
+        batch.size = 0u;
+    }
+
+    /// Merge the sorted candidates that the lanes of the group found into the
+    /// same sorted cache on every lane.
+    ///
+    /// In every round, the lanes find the closest of their next candidates
+    /// with a butterfly reduction and the candidate of the winning lane is
+    /// broadcast to the group. The result is the same as for a serial
+    /// search, which keeps the k_cache_capacity closest candidates.
+    DETRAY_HOST_DEVICE
+    static void merge_lane_candidates(state &navigation) {
+
+        using key_t = std::remove_cvref_t<candidate_path_type>;
+        constexpr key_t inv_key{std::numeric_limits<key_t>::max()};
+
+        // The candidates of this lane
+        const typename state::candidate_cache_t own{navigation.m_candidates};
+        const auto n_own{static_cast<dindex>(navigation.m_last + 1)};
+
+        navigation.clear();
+
+        dindex head{0u};
+        for (std::size_t k = 0u; k < k_cache_capacity; ++k) {
+            key_t key{head < n_own ? math::fabs(own[head].path) : inv_key};
+            unsigned int winner{lane_group_t::rank()};
+
+            // Minimum over the group (ties are broken by the lane index)
+            for (unsigned int offset = lane_group_t::size / 2u; offset > 0u;
+                 offset /= 2u) {
+                const key_t other_key{lane_group_t::shuffle_xor(key, offset)};
+                const unsigned int other_winner{
+                    lane_group_t::shuffle_xor(winner, offset)};
+
+                if (other_key < key ||
+                    (other_key == key && other_winner < winner)) {
+                    key = other_key;
+                    winner = other_winner;
+                }
+            }
+
+            // All lanes are exhausted
+            if (key == inv_key) {
+                break;
+            }
+
+            // Every lane has to take part in the broadcast
+            constexpr auto last_idx{static_cast<dindex>(k_cache_capacity - 1u)};
+            const dindex own_idx{head < n_own ? head : last_idx};
+            navigation.m_candidates[k] =
+                lane_group_t::shuffle(own[own_idx], winner);
+            ++navigation.m_last;
+
+            if (winner == lane_group_t::rank()) {
+                ++head;
+            }
+        }
+    }
+
+    public:
+    /// @brief Prefetch the detector data of the next candidates.
+    ///
+    /// Issues software prefetches for the transforms and masks of up to
+    /// @c navigation::config::n_prefetch_candidates candidates, starting at
+    /// the current target. Called before the stepper runs, so that the data
+    /// is in cache when the candidates are updated after the step.
+    ///
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration
+    /// @param ctx the geometry context
+    DETRAY_HOST_DEVICE inline void prefetch(const state &navigation,
+                                            const navigation::config &cfg,
+                                            const context_type &ctx) const {
+        if (cfg.n_prefetch_candidates == 0u || !navigation.is_alive() ||
+            navigation.is_exhausted()) {
+            return;
+        }
+
+        const auto &det = navigation.detector();
+        const auto &transforms = det.transform_store();
+
+        const auto first{static_cast<dindex>(navigation.m_next)};
+        const dindex last{math::min(first + cfg.n_prefetch_candidates,
+                                    navigation.n_cached())};
+
+        for (dindex i = first; i < last; ++i) {
+            const auto &sf_desc = navigation.m_candidates[i].surface(det);
+
+            // Only prefetch data that lives in the store
+            if constexpr (std::is_lvalue_reference_v<decltype(transforms.at(
+                              sf_desc.transform(), ctx))>) {
+                detail::prefetch(&transforms.at(sf_desc.transform(), ctx));
+            }
+            geometry::surface{det, sf_desc}
+                .template visit_mask<mask_prefetcher>();
+        }
+    }
+
+    /// @brief Target the exit portal of a volume that contains only portals.
+    ///
+    /// Gap volumes hold no other surfaces than their portals, so the track
+    /// can be moved to the exit portal directly: The portals are intersected
+    /// with the helix @param hlx and the closest portal in front of the track
+    /// becomes the only candidate, with the path length along the helix. A
+    /// track that does not reach the portal in the end is handled by the
+    /// general navigation update.
+    ///
+    /// @param hlx the trajectory of the track in the navigation direction
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration
+    ///
+    /// @returns true if the exit portal was found
+    DETRAY_HOST_DEVICE inline bool fast_forward(
+        const detail::helix<algebra_type> &hlx, state &navigation,
+        const navigation::config &cfg, const context_type &ctx) const {
+
+        const auto &det = navigation.detector();
+        const auto volume = tracking_volume{det, navigation.volume()};
+
+        if (!navigation.is_alive() || !volume.has_only_portals()) {
+            return false;
+        }
+
+        helix_intersection_type exit{};
+        exit.path = std::numeric_limits<scalar_type>::max();
+        bool is_supported{true};
+
+        for (const auto &pt_desc : volume.portals()) {
+            const auto sf = geometry::surface{det, pt_desc};
+            sf.template visit_mask<exit_portal_search>(
+                hlx, pt_desc, det, ctx,
+                static_cast<scalar_type>(cfg.path_tolerance), exit,
+                is_supported);
+        }
+
+        if (!is_supported || !exit.status) {
+            return false;
+        }
+
+        navigation.clear();
+        navigation.insert(navigation.m_candidates.begin(), exit);
+        navigation.m_status = navigation::status::e_towards_object;
+        navigation.m_trust_level = navigation::trust_level::e_full;
+
+        navigation.run_inspector(cfg, hlx.pos(), hlx.dir(0.f),
+                                 "Fast-forward to exit portal: ");
+
+        return true;
+    }
+
+    /// @brief Helper method to initialize a volume.
+    ///
+    /// Calls the volumes accelerator structure for local navigation, then tests
+    /// the surfaces for intersection and sorts the reachable candidates to find
+    /// the clostest one (next candidate).
+    ///
+    /// @tparam track_t type of track, needs to provide pos() and dir() methods
+    ///
+    /// @param track access to the track parameters
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration (the parameters of the current
+    ///            volume are applied, if it has any)
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx,
+        const bool use_path_tolerance_as_overstep_tolerance = true) const {
+        navigation.reset_volume_config();
+        if (const navigation::volume_config *entry{navigation.volume_config()};
+            entry != nullptr) {
+            const navigation::config vol_cfg{cfg.for_volume(*entry)};
+            if (!init_from_landmark(track, navigation, vol_cfg, ctx,
+                                    use_path_tolerance_as_overstep_tolerance)) {
+                init_impl(track, navigation, vol_cfg, ctx,
+                          use_path_tolerance_as_overstep_tolerance);
+            }
+        } else if (!init_from_landmark(
+                       track, navigation, cfg, ctx,
+                       use_path_tolerance_as_overstep_tolerance)) {
+            init_impl(track, navigation, cfg, ctx,
+                      use_path_tolerance_as_overstep_tolerance);
+        }
+        navigation.m_is_initialized = true;
+    }
+
+    /// @brief Complete update of the navigation flow.
+    ///
+    /// Restores 'full trust' state to the cadidates cache and checks whether
+    /// the track stepped onto a portal and a volume switch is due. If so, or
+    /// when the previous update according to the given trust level
+    /// failed to restore trust, it performs a complete reinitialization of the
+    /// navigation.
+    ///
+    /// @tparam track_t type of track, needs to provide pos() and dir() methods
+    ///
+    /// @param track access to the track parameters
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration (the parameters of the current
+    ///            volume are applied, if it has any)
+    ///
+    /// @returns a heartbeat to indicate if the navigation is still alive
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx = {},
+        const bool /*is_before_actor*/ = true) const {
+        return update_safe(track, navigation, cfg, ctx, nullptr);
+    }
+
+    /// Surfaces of a volume neighborhood, which are shared between the tracks
+    /// of a bundle (@see collect_neighborhood )
+    struct bundle_neighborhood {
+        /// Maximal number of surfaces in the neighborhood
+        static constexpr dindex k_capacity{64u};
+
+        darray<typename detector_type::surface_type, k_capacity> surfaces{};
+        dindex size{0u};
+        /// The neighborhood did not fit: Every track needs its own look-up
+        bool overflow{false};
+
+        /// Envelope of the bundle: Distance between the positions and angle
+        /// between the directions of any two tracks (set by the caller)
+        /// @{
+        scalar_type radius{0.f};
+        scalar_type max_angle{0.f};
+        /// @}
+
+        /// Volume and position of the look-up, and the distance from that
+        /// position up to which the look-up covers the bins of the tracks
+        dindex volume{dindex_invalid};
+        point3_type origin{0.f, 0.f, 0.f};
+        scalar_type reach{0.f};
+
+        /// @returns true if a track at @param pos in the volume @param vol
+        /// can use the neighborhood instead of its own look-up
+        DETRAY_HOST_DEVICE
+        bool covers(const dindex vol, const point3_type &pos) const {
+            return !overflow && vol == volume &&
+                   vector::norm(pos - origin) <= reach;
+        }
+    };
+
+    /// @brief Complete update of the navigation flow of a track in a bundle
+    ///
+    /// Like @c update , but on a volume switch, the track is initialized from
+    /// the shared @param neighborhood of the bundle, if the neighborhood was
+    /// looked up in the same volume and close enough to the track position.
+    /// Otherwise, the neighborhood is looked up anew at the track position,
+    /// so that the next tracks of the bundle that enter the volume can use
+    /// it (@see collect_neighborhood ).
+    ///
+    /// @returns a heartbeat to indicate if the navigation is still alive
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, bundle_neighborhood &neighborhood) const {
+        return update_safe(track, navigation, cfg, ctx, &neighborhood);
+    }
+
+    /// @brief Look up the volume neighborhood once for a bundle of tracks.
+    ///
+    /// The tracks of a bundle move close to each other in nearly the same
+    /// direction (e.g. in a jet or a material scan). The acceleration
+    /// structures of the volume are queried only once, at the position of the
+    /// bundle @param axis. The direction dependent search windows are not
+    /// used. Instead, the search window of the configuration is widened by
+    /// the bins within the envelope of the bundle: the distance between the
+    /// tracks (@c bundle_neighborhood::radius ), plus the distance their
+    /// directions diverge by across the search window depth
+    /// (@c bundle_neighborhood::max_angle ). The tracks are then intersected
+    /// with the shared surfaces one by one (@see init_from_neighborhood ).
+    ///
+    /// @param axis the track along the axis of the bundle
+    /// @param navigation the navigation state of any track of the bundle
+    /// @param cfg the navigation configuration
+    /// @param ctx the geometry context
+    /// @param neighborhood the surfaces found in the neighborhood
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void collect_neighborhood(
+        const track_t &axis, const state &navigation,
+        const navigation::config &cfg, const context_type &ctx,
+        bundle_neighborhood &neighborhood) const {
+
+        const navigation::volume_config *entry{
+            navigation.find_volume_config(navigation.volume())};
+        navigation::config lookup_cfg{
+            entry != nullptr ? cfg.for_volume(*entry) : cfg};
+        lookup_cfg.adaptive_search_window = false;
+        lookup_cfg.directed_search_window = false;
+        lookup_cfg.search_envelope = static_cast<float>(
+            neighborhood.radius +
+            neighborhood.max_angle *
+                static_cast<scalar_type>(lookup_cfg.search_window_depth +
+                                         lookup_cfg.max_mask_tolerance));
+
+        neighborhood.size = 0u;
+        neighborhood.overflow = false;
+        neighborhood.volume = navigation.volume();
+        neighborhood.origin = axis.pos();
+        neighborhood.reach = neighborhood.radius;
+
+        const auto volume =
+            tracking_volume{navigation.detector(), navigation.volume()};
+        visit_candidates<neighborhood_collector>(volume, axis, lookup_cfg, ctx,
+                                                 neighborhood);
+    }
+
+    /// @brief Initialize the navigation of a track of a bundle from the
+    /// shared volume @param neighborhood
+    ///
+    /// Falls back to the regular initialization, if the neighborhood did not
+    /// fit into its buffer.
+    ///
+    /// @param track access to the track parameters
+    /// @param navigation the navigation state of the track (needs to be in
+    ///                   the volume of the neighborhood)
+    /// @param cfg the navigation configuration
+    /// @param ctx the geometry context
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init_from_neighborhood(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx,
+        const bundle_neighborhood &neighborhood) const {
+
+        if (neighborhood.overflow) {
+            init(track, navigation, cfg, ctx);
+            return;
+        }
+
+        navigation.reset_volume_config();
+        if (const navigation::volume_config *entry{navigation.volume_config()};
+            entry != nullptr) {
+            init_from_neighborhood_impl(track, navigation,
+                                        cfg.for_volume(*entry), ctx,
+                                        neighborhood);
+        } else {
+            init_from_neighborhood_impl(track, navigation, cfg, ctx,
+                                        neighborhood);
+        }
+    }
+
+    /// @brief Initialize the navigation of all tracks of a bundle from the
+    /// shared volume @param neighborhood at once
+    ///
+    /// The positions and directions of the tracks are gathered into the lanes
+    /// of the SIMD vectors of @tparam soa_algebra_t (e.g. @c vc_soa ). Every
+    /// surface of the neighborhood is then broadcast to all lanes and
+    /// intersected with the tracks in one call of the SoA ray intersector
+    /// (@see soa/ray_plane_intersector.hpp ). Bundles with more tracks than
+    /// the SIMD width are intersected in chunks.
+    ///
+    /// @note The SoA ray intersectors are used in place of the intersector
+    /// type of the navigator.
+    ///
+    /// @param tracks access to the track parameters of every state
+    /// @param lanes the navigation states of the tracks (all in the volume of
+    ///              the neighborhood)
+    /// @param lane_mask the navigation states that are initialized
+    /// @param cfg the navigation configuration
+    /// @param ctx the geometry context
+    template <algebra::concepts::soa soa_algebra_t, typename tracks_t,
+              std::size_t N>
+    DETRAY_HOST_DEVICE inline void init_lanes_from_neighborhood(
+        const tracks_t &tracks, darray<state, N> &lanes,
+        const std::uint32_t lane_mask, const navigation::config &cfg,
+        const context_type &ctx,
+        const bundle_neighborhood &neighborhood) const {
+
+        static_assert(N <= 32u, "Lane mask can hold at most 32 tracks");
+        static_assert(!intersection_type::is_debug(),
+                      "SoA intersections do not carry debug information");
+
+        std::size_t first{N};
+        for (std::size_t i = 0u; i < N; ++i) {
+            if ((lane_mask >> i) & 1u) {
+                if (neighborhood.overflow) {
+                    init(tracks[i], lanes[i], cfg, ctx);
+                } else {
+                    lanes[i].reset_volume_config();
+                }
+                first = (first == N) ? i : first;
+            }
+        }
+        if (first == N || neighborhood.overflow) {
+            return;
+        }
+
+        // All tracks are in the same volume
+        if (const navigation::volume_config *entry{
+                lanes[first].volume_config()};
+            entry != nullptr) {
+            init_lanes_from_neighborhood_impl<soa_algebra_t>(
+                tracks, lanes, lane_mask, cfg.for_volume(*entry), ctx,
+                neighborhood);
+        } else {
+            init_lanes_from_neighborhood_impl<soa_algebra_t>(
+                tracks, lanes, lane_mask, cfg, ctx, neighborhood);
+        }
+    }
+
+    private:
+    /// Intersect a surface with the tracks in the lanes of a SoA ray and
+    /// insert the hits into the navigation state of every lane (called on the
+    /// mask group of the surface)
+    template <algebra::concepts::soa soa_algebra_t>
+    struct lane_intersection {
+
+        using simd_scalar_type = dscalar<soa_algebra_t>;
+        using simd_vector3_type = dvector3D<soa_algebra_t>;
+
+        /// @param lanes the navigation states of the lanes
+        /// @param lane_mask the lanes that intersect the surface
+        /// @param offset index of the state of the first lane
+        /// @param ray the rays of all lanes
+        ///
+        /// @returns the lanes that hit one of the masks of the surface
+        template <typename mask_group_t, typename mask_range_t,
+                  typename lanes_t, typename transform_container_t>
+        DETRAY_HOST_DEVICE std::uint32_t operator()(
+            const mask_group_t &mask_group, const mask_range_t &mask_range,
+            lanes_t &lanes, const std::uint32_t lane_mask,
+            const std::size_t offset,
+            const detail::ray<soa_algebra_t> &ray,
+            const typename detector_type::surface_type &sf_descr,
+            const transform_container_t &contextual_transforms,
+            const typename transform_container_t::context_type &ctx,
+            const darray<simd_scalar_type, 2u> &mask_tol,
+            const simd_scalar_type &mask_tol_scalor,
+            const simd_scalar_type &overstep_tol) const {
+
+            using mask_t = typename mask_group_t::value_type;
+            using soa_mask_t = mask<typename mask_t::shape, soa_algebra_t,
+                                    typename mask_t::links_type>;
+            using soa_intersector_t =
+                ray_intersector<typename mask_t::shape, soa_algebra_t>;
+
+            // Broadcast the placement of the surface to all lanes
+            const auto &trf =
+                contextual_transforms.at(sf_descr.transform(), ctx);
+            const dtransform3D<soa_algebra_t> soa_trf{
+                broadcast(trf.translation()), broadcast(trf.z()),
+                broadcast(trf.x())};
+
+            std::uint32_t hits{0u};
+            for (const auto &mask :
+                 detray::ranges::subrange(mask_group, mask_range)) {
+
+                typename soa_mask_t::mask_values values{};
+                for (std::size_t j = 0u; j < values.size(); ++j) {
+                    values[j] = simd_scalar_type(mask.values()[j]);
+                }
+
+                const auto result = soa_intersector_t{}(
+                    ray, sf_descr, soa_mask_t{values, mask.volume_link()},
+                    soa_trf, mask_tol, mask_tol_scalor, overstep_tol);
+
+                // Only one mask of a surface can be hit per lane
+                hits |= scatter(result, sf_descr, lanes, lane_mask & ~hits,
+                                offset);
+                if (hits == lane_mask) {
+                    break;
+                }
+            }
+
+            return hits;
+        }
+
+        private:
+        /// @returns the vector @param v in all lanes
+        template <typename vector3_t>
+        DETRAY_HOST_DEVICE static simd_vector3_type broadcast(
+            const vector3_t &v) {
+            simd_vector3_type soa_v{};
+            for (unsigned int c = 0u; c < 3u; ++c) {
+                soa_v[c] = simd_scalar_type(v[c]);
+            }
+            return soa_v;
+        }
+
+        /// Insert the intersections of the lanes in @param lane_mask that
+        /// are inside of the mask into their navigation state
+        ///
+        /// @returns the lanes that hit the mask
+        template <typename soa_intersection_t, typename lanes_t>
+        DETRAY_HOST_DEVICE static std::uint32_t scatter(
+            const soa_intersection_t &result,
+            const typename detector_type::surface_type &sf_descr,
+            lanes_t &lanes, const std::uint32_t lane_mask,
+            const std::size_t offset) {
+
+            std::uint32_t hits{0u};
+            for (std::size_t l = 0u; l < simd_scalar_type::size(); ++l) {
+                const std::size_t i{offset + l};
+                if (i >= lanes.size() || !((lane_mask >> i) & 1u) ||
+                    !result.status[l]) {
+                    continue;
+                }
+
+                intersection2D<typename detector_type::surface_type,
+                               algebra_type, false>
+                    sfi{};
+                sfi.sf_desc = sf_descr;
+                sfi.path = result.path[l];
+                sfi.volume_link = result.volume_link;
+                sfi.status = true;
+                sfi.direction = result.direction[l];
+
+                insert_candidate(lanes[i], sfi);
+                hits |= (std::uint32_t{1u} << i);
+            }
+
+            return hits;
+        }
+
+        /// Two solutions of a cylinder intersection
+        template <typename soa_intersection_t, typename lanes_t>
+        DETRAY_HOST_DEVICE static std::uint32_t scatter(
+            const darray<soa_intersection_t, 2> &result,
+            const typename detector_type::surface_type &sf_descr,
+            lanes_t &lanes, const std::uint32_t lane_mask,
+            const std::size_t offset) {
+            return scatter(result[0], sf_descr, lanes, lane_mask, offset) |
+                   scatter(result[1], sf_descr, lanes, lane_mask, offset);
+        }
+    };
+
+    /// Insert the candidate @param sfi into the cache of @param navigation
+    DETRAY_HOST_DEVICE
+    static void insert_candidate(state &navigation,
+                                 const intersection_type &sfi) {
+        navigation.insert(
+            detray::upper_bound(navigation.begin(), navigation.end(), sfi),
+            sfi);
+    }
+
+    /// @brief Implementation of the initialization of a bundle from the
+    /// neighborhood
+    ///
+    /// @see init_lanes_from_neighborhood
+    ///
+    /// @param vol_cfg the navigation configuration of the current volume
+    template <algebra::concepts::soa soa_algebra_t, typename tracks_t,
+              std::size_t N>
+    DETRAY_HOST_DEVICE inline void init_lanes_from_neighborhood_impl(
+        const tracks_t &tracks, darray<state, N> &lanes,
+        const std::uint32_t lane_mask, const navigation::config &vol_cfg,
+        const context_type &ctx,
+        const bundle_neighborhood &neighborhood) const {
+
+        using simd_scalar_t = dscalar<soa_algebra_t>;
+        constexpr std::size_t width{simd_scalar_t::size()};
+
+        for (std::size_t i = 0u; i < N; ++i) {
+            if ((lane_mask >> i) & 1u) {
+                // Do not resurrect a failed/finished navigation state
+                assert(lanes[i].status() > navigation::status::e_on_target);
+                assert(!tracks[i].is_invalid());
+
+                lanes[i].clear();
+                lanes[i].m_heartbeat = true;
+                lanes[i].m_is_initialized = true;
+            }
+        }
+
+        const auto &det = lanes[0].detector();
+        const darray<simd_scalar_t, 2u> mask_tol{
+            detail::broadcast_mask_tolerance<simd_scalar_t>(
+                darray<scalar_type, 2u>{vol_cfg.min_mask_tolerance,
+                                        vol_cfg.max_mask_tolerance})};
+        const darray<simd_scalar_t, 2u> no_mask_tol{simd_scalar_t(0.f),
+                                                    simd_scalar_t(0.f)};
+        const simd_scalar_t mask_tol_scalor(
+            static_cast<scalar_type>(vol_cfg.mask_tolerance_scalor));
+        const simd_scalar_t overstep_tol(
+            static_cast<scalar_type>(-vol_cfg.path_tolerance));
+
+        // Lanes of one SIMD vector
+        constexpr std::uint32_t chunk_bits{
+            width < 32u ? (std::uint32_t{1u} << width) - 1u
+                        : ~std::uint32_t{0u}};
+
+        for (std::size_t offset = 0u; offset < N; offset += width) {
+            const std::uint32_t chunk_mask{lane_mask & (chunk_bits << offset)};
+            if (chunk_mask == 0u) {
+                continue;
+            }
+
+            // Gather the rays of the chunk: Lanes without a track repeat the
+            // first track of the chunk
+            dpoint3D<soa_algebra_t> pos{};
+            dvector3D<soa_algebra_t> dir{};
+            std::size_t first{offset};
+            while (!((chunk_mask >> first) & 1u)) {
+                ++first;
+            }
+            for (std::size_t l = 0u; l < width; ++l) {
+                const std::size_t i{(offset + l < N &&
+                                     ((chunk_mask >> (offset + l)) & 1u))
+                                        ? offset + l
+                                        : first};
+                const auto track_pos = tracks[i].pos();
+                const auto track_dir =
+                    static_cast<scalar_type>(lanes[i].direction()) *
+                    tracks[i].dir();
+                for (unsigned int c = 0u; c < 3u; ++c) {
+                    pos[c][l] = track_pos[c];
+                    dir[c][l] = track_dir[c];
+                }
+            }
+            const detail::ray<soa_algebra_t> ray{std::move(pos),
+                                                 std::move(dir)};
+
+            for (dindex j = 0u; j < neighborhood.size; ++j) {
+                const auto &sf_descr = neighborhood.surfaces[j];
+                const auto sf = geometry::surface{det, sf_descr};
+
+                sf.template visit_mask<lane_intersection<soa_algebra_t>>(
+                    lanes, chunk_mask, offset, ray, sf_descr,
+                    det.transform_store(), ctx,
+                    sf.is_portal() ? no_mask_tol : mask_tol, mask_tol_scalor,
+                    overstep_tol);
+            }
+        }
+
+        for (std::size_t i = 0u; i < N; ++i) {
+            if ((lane_mask >> i) & 1u) {
+                finish_init(tracks[i], lanes[i], vol_cfg);
+            }
+        }
+    }
+    /// @brief Implementation of the initialization from the neighborhood
+    ///
+    /// @see init_from_neighborhood
+    ///
+    /// @param vol_cfg the navigation configuration of the current volume
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init_from_neighborhood_impl(
+        const track_t &track, state &navigation,
+        const navigation::config &vol_cfg, const context_type &ctx,
+        const bundle_neighborhood &neighborhood) const {
+        const auto &det = navigation.detector();
+
+        // Do not resurrect a failed/finished navigation state
+        assert(navigation.status() > navigation::status::e_on_target);
+        assert(!track.is_invalid());
+
+        navigation.clear();
+        navigation.m_heartbeat = true;
+        navigation.m_is_initialized = true;
+
+        const darray<scalar_type, 2u> mask_tol{vol_cfg.min_mask_tolerance,
+                                               vol_cfg.max_mask_tolerance};
+        const auto mask_tol_scalor{
+            static_cast<scalar_type>(vol_cfg.mask_tolerance_scalor)};
+        const auto overstep_tol{
+            static_cast<scalar_type>(-vol_cfg.path_tolerance)};
+
+        for (dindex i = 0u; i < neighborhood.size; ++i) {
+            candidate_search{}(neighborhood.surfaces[i], det, ctx, track,
+                               navigation, mask_tol, mask_tol_scalor,
+                               overstep_tol);
+        }
+
+        finish_init(track, navigation, vol_cfg);
+    }
+
+    /// Skip the update, if the track is still within the safe distance
+    ///
+    /// @see update
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update_safe(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, bundle_neighborhood *neighborhood) const {
+
+        if (!cfg.use_safe_distance) {
+            return update_volume(track, navigation, cfg, ctx, neighborhood);
+        }
+
+        // The track cannot have reached any candidate since the last update
+        if (is_within_safe_distance(navigation, cfg)) {
+            return false;
+        }
+
+        const bool is_init{
+            update_volume(track, navigation, cfg, ctx, neighborhood)};
+        update_safe_distance(track, navigation, ctx);
+
+        return is_init;
+    }
+
+    /// Apply the navigation parameters of the current volume, if it has any,
+    /// before the update
+    ///
+    /// @see update
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update_volume(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, bundle_neighborhood *neighborhood) const {
+        if (const navigation::volume_config *entry{navigation.volume_config()};
+            entry != nullptr) {
+            return update_impl(track, navigation, cfg.for_volume(*entry), cfg,
+                               ctx, neighborhood);
+        }
+        return update_impl(track, navigation, cfg, cfg, ctx, neighborhood);
+    }
+
+    /// @brief Implementation of the volume initialization
+    ///
+    /// @see init
+    ///
+    /// @param cfg the navigation configuration of the current volume
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init_impl(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx,
+        const bool use_path_tolerance_as_overstep_tolerance = true) const {
+        init_impl(track, navigation, cfg, ctx,
+                  navigation.detector().volume(navigation.volume()),
+                  use_path_tolerance_as_overstep_tolerance);
+    }
+
+    /// @brief Implementation of the volume initialization
+    ///
+    /// @param vol_desc the descriptor of the current volume
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init_impl(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, const volume_type &vol_desc,
+        const bool use_path_tolerance_as_overstep_tolerance) const {
+        const auto &det = navigation.detector();
+        const auto volume = tracking_volume{det, vol_desc};
+
+        // Do not resurrect a failed/finished navigation state
+        assert(navigation.status() > navigation::status::e_on_target);
+        assert(!track.is_invalid());
+
+        // Clean up state
+        navigation.clear();
+        navigation.m_heartbeat = true;
+
+        // Search for neighboring surfaces and fill candidates into cache
+        const scalar_type overstep_tol =
+            use_path_tolerance_as_overstep_tolerance ? -cfg.path_tolerance
+                                                     : cfg.overstep_tolerance;
+
+        const darray<scalar_type, 2u> mask_tol{cfg.min_mask_tolerance,
+                                               cfg.max_mask_tolerance};
+        const auto mask_tol_scalor{
+            static_cast<scalar_type>(cfg.mask_tolerance_scalor)};
+
+        if constexpr (lane_group_t::size > 1u) {
+            // Share the intersection of the candidates between the lanes
+            candidate_batch batch{};
+            visit_candidates<cooperative_candidate_collector>(
+                volume, track, cfg, ctx, batch, det, ctx, track, navigation,
+                mask_tol, mask_tol_scalor, overstep_tol);
+
+            intersect_batch_cooperative(batch, det, ctx, track, navigation,
+                                        mask_tol, mask_tol_scalor,
+                                        overstep_tol);
+
+            merge_lane_candidates(navigation);
+        } else if (cfg.group_by_mask_type) {
+            candidate_batch batch{};
+            visit_candidates<candidate_collector>(
+                volume, track, cfg, ctx, batch, det, ctx, track, navigation,
+                mask_tol, mask_tol_scalor, overstep_tol);
+
+            // Intersect the remaining surfaces
+            intersect_batch(batch, det, ctx, track, navigation, mask_tol,
+                            mask_tol_scalor, overstep_tol);
+        } else {
+            visit_candidates<candidate_search>(
+                volume, track, cfg, ctx, det, ctx, track, navigation, mask_tol,
+                mask_tol_scalor, overstep_tol);
+        }
+
+        finish_init(track, navigation, cfg);
+    }
+
+    /// Determine the navigation state after the candidates of a volume were
+    /// filled into the cache
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void finish_init(
+        const track_t &track, state &navigation,
+        const navigation::config &cfg) const {
+
+        // Determine overall state of the navigation after updating the cache
+        update_navigation_state(navigation, cfg);
+
+        // If init was not successful, the propagation setup might be broken
+        if (navigation.trust_level() != navigation::trust_level::e_full) {
+            // Do not exit if backward navigation starts on the outmost portal
+            if (navigation.is_on_portal() &&
+                navigation.direction() == navigation::direction::e_backward) {
+                navigation.m_trust_level =
+                    detail::is_invalid_value(navigation.current().volume_link)
+                        ? navigation::trust_level::e_full
+                        : navigation::trust_level::e_no_trust;
+            } else {
+                navigation.m_heartbeat = false;
+            }
+        }
+
+        navigation.run_inspector(cfg, track.pos(), track.dir(),
+                                 "Init complete: ");
+    }
+
+    /// Initialize the volume the track just entered through the portal
+    /// @param portal_idx
+    ///
+    /// @param cfg the navigation configuration of the new volume
+    /// @param vol_desc the descriptor of the new volume
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void enter_volume(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, const volume_type &vol_desc,
+        const dindex portal_idx) const {
+        if (!init_from_portal(track, navigation, cfg, ctx, vol_desc,
+                              portal_idx)) {
+            init_impl(track, navigation, cfg, ctx, vol_desc, true);
+        }
+    }
+
+    /// @brief Implementation of the complete navigation update
+    ///
+    /// @see update
+    ///
+    /// @param cfg the navigation configuration of the current volume
+    /// @param global_cfg the navigation configuration with the parameters of
+    ///                   all volumes (used after a volume switch)
+    /// @param neighborhood the shared neighborhood of a track bundle, if any
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update_impl(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const navigation::config &global_cfg, const context_type &ctx,
+        bundle_neighborhood *neighborhood) const {
+
+        assert(!track.is_invalid());
+
+        // Candidates are re-evaluated based on the current trust level.
+        // Should result in 'full trust'
+        bool is_init = update_kernel(track, navigation, cfg, ctx);
+
+        // Update was completely successful (most likely case)
+        if (navigation.trust_level() == navigation::trust_level::e_full) {
+            return is_init;
+        }
+        // Otherwise: did we run into a portal?
+        else if (navigation.is_on_portal()) {
+            const auto &det = navigation.detector();
+            const dindex portal_idx{navigation.current().surface(det).index()};
+
+            // Read the links of the next volume from the packed record of the
+            // portal instead of the detector volume container, if available
+            const volume_links_type *vol_links{navigation.volume_links()};
+            const bool has_record{vol_links != nullptr &&
+                                  vol_links->contains(portal_idx)};
+            assert(!has_record ||
+                   vol_links->at(portal_idx).is_exit() ==
+                       detail::is_invalid_value(
+                           navigation.current().volume_link));
+
+            // Navigation reached the end of the detector world
+            if (has_record ? vol_links->at(portal_idx).is_exit()
+                           : detail::is_invalid_value(
+                                 navigation.current().volume_link)) {
+                navigation.exit();
+                return is_init;
+            }
+
+            assert(!has_record || vol_links->at(portal_idx).volume ==
+                                      navigation.current().volume_link);
+
+            const volume_type vol_desc{
+                has_record ? vol_links->at(portal_idx).descriptor()
+                           : det.volume(navigation.current().volume_link)};
+
+            // Set volume index to the next volume provided by the portal
+            navigation.set_volume(vol_desc.index());
+
+            // Either end of world or valid volume index
+            assert(detail::is_invalid_value(navigation.volume()) ||
+                   navigation.volume() <
+                       navigation.detector().volumes().size());
+
+            // Run inspection when needed (keep for debugging)
+            // navigation.run_inspector(cfg, track.pos(), track.dir(), "Volume
+            // switch: ");
+
+            // The first track of a bundle that enters the volume looks up
+            // the neighborhood for the others
+            if (neighborhood != nullptr &&
+                neighborhood->volume != navigation.volume()) {
+                collect_neighborhood(track, navigation, global_cfg, ctx,
+                                     *neighborhood);
+            }
+
+            if (neighborhood != nullptr &&
+                neighborhood->covers(navigation.volume(), track.pos())) {
+                init_from_neighborhood(track, navigation, global_cfg, ctx,
+                                       *neighborhood);
+            } else if (const navigation::volume_config *entry{
+                           navigation.volume_config()};
+                       entry != nullptr) {
+                enter_volume(track, navigation, global_cfg.for_volume(*entry),
+                             ctx, vol_desc, portal_idx);
+            } else {
+                enter_volume(track, navigation, global_cfg, ctx, vol_desc,
+                             portal_idx);
+            }
+            is_init = true;
+
+            // Fresh initialization, reset trust and hearbeat even though we are
+            // on inner portal
+            navigation.m_trust_level = navigation::trust_level::e_full;
+            navigation.m_heartbeat = true;
+        }
+        // If no trust could be restored for the current state, (local)
+        // navigation might be exhausted: re-initialize volume
+        else {
+            // Use overstep tolerance instead of path tolerance
+            const bool use_path_tolerance_as_overstep_tolerance = false;
+
+            init_impl(track, navigation, cfg, ctx,
+                      use_path_tolerance_as_overstep_tolerance);
+            is_init = true;
+
+            // Sanity check: Should never be the case after complete update call
+            if (navigation.trust_level() != navigation::trust_level::e_full) {
+                // Try to save the navigation flow: Look further behind the
+                // track
+                auto loose_cfg{cfg};
+                // Use the max mask tolerance in case a track leaves the volume
+                // when a sf is 'sticking' out of the portals due to the tol
+                loose_cfg.overstep_tolerance =
+                    math::min(100.f * cfg.overstep_tolerance,
+                              -10.f * cfg.max_mask_tolerance);
+
+                init_impl(track, navigation, loose_cfg, ctx,
+                          use_path_tolerance_as_overstep_tolerance);
+            }
+        }
+        // Unrecoverable
+        if (navigation.trust_level() != navigation::trust_level::e_full ||
+            navigation.is_exhausted()) {
+            navigation.abort("Navigator: No reachable surfaces");
+        }
+
+        return is_init;
+    }
+
+    /// @brief Check, whether the navigation update can be skipped.
+    ///
+    /// This is the case, if the track has not yet travelled the safe distance
+    /// since the last update and nothing else, for instance an actor,
+    /// invalidated the candidates. The distance to the target is kept up to
+    /// date by @c state::advance in the meantime.
+    ///
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration
+    ///
+    /// @returns true if no update is needed
+    DETRAY_HOST_DEVICE inline bool is_within_safe_distance(
+        const state &navigation, const navigation::config &cfg) const {
+
+        return navigation.m_safe_distance > cfg.path_tolerance &&
+               navigation.is_alive() && !navigation.is_exhausted() &&
+               navigation.status() == navigation::status::e_towards_object &&
+               navigation.trust_level() != navigation::trust_level::e_no_trust;
+    }
+
+    /// @brief Find the minimal distance between the track and the reachable
+    /// candidates
+    ///
+    /// @tparam track_t type of track, needs to provide pos() and dir() methods
+    ///
+    /// @param track access to the track parameters
+    /// @param state the current navigation state
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void update_safe_distance(
+        const track_t &track, state &navigation,
+        const context_type &ctx) const {
+
+        navigation.m_safe_distance = 0.f;
+
+        if (!navigation.is_alive() || navigation.is_exhausted() ||
+            navigation.status() != navigation::status::e_towards_object) {
+            return;
+        }
+
+        const auto &det = navigation.detector();
+
+        scalar_type safe_dist{std::numeric_limits<scalar_type>::max()};
+        for (const auto &candidate : navigation) {
+            const auto &sf_desc = candidate.surface(det);
+            const auto sf = geometry::surface{det, sf_desc};
+            const scalar_type dist{
+                sf.template visit_mask<detail::safe_distance>(
+                    det.transform_store(), sf_desc.transform(), ctx,
+                    track.pos())};
+
+            safe_dist = math::min(safe_dist, dist);
+        }
+
+        navigation.m_safe_distance = safe_dist;
+    }
+
+    /// @brief Helper method to initialize a volume after a volume switch.
+    ///
+    /// Only tests the portals of the new volume and the likely next
+    /// candidates from the portal link table, instead of running the full
+    /// neighborhood search. Only applies to tracks, for which the candidates
+    /// of the table are complete (@see portal_link_table::applies ).
+    ///
+    /// @tparam track_t type of track, needs to provide pos(), dir() and qop()
+    ///         methods
+    ///
+    /// @param track access to the track parameters
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration
+    /// @param vol_desc the descriptor of the volume that was entered
+    /// @param portal_idx index of the portal that was crossed
+    ///
+    /// @returns true if a reachable candidate was found
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool init_from_portal(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, const volume_type &vol_desc,
+        const dindex portal_idx) const {
+
+        const portal_links_type *links{navigation.portal_links()};
+        if (links == nullptr ||
+            !links->applies(portal_idx, track.pos(), track.dir(),
+                            track.qop())) {
+            return false;
+        }
+
+        const auto &det = navigation.detector();
+        const auto volume = tracking_volume{det, vol_desc};
+
+        // Clean up state
+        navigation.clear();
+        navigation.m_heartbeat = true;
+
+        const darray<scalar_type, 2u> mask_tol{cfg.min_mask_tolerance,
+                                               cfg.max_mask_tolerance};
+        const auto mask_tol_scalor{
+            static_cast<scalar_type>(cfg.mask_tolerance_scalor)};
+        const auto overstep_tol{static_cast<scalar_type>(-cfg.path_tolerance)};
+
+        // The portals are always needed to leave the volume again
+        for (const auto &pt_desc : volume.portals()) {
+            candidate_search{}(pt_desc, det, ctx, track, navigation, mask_tol,
+                               mask_tol_scalor, overstep_tol);
+        }
+        for (const auto &sf_desc :
+             links->candidates(portal_idx, track.pos())) {
+            if (cfg.sensitive_only && sf_desc.is_passive()) {
+                continue;
+            }
+            candidate_search{}(sf_desc, det, ctx, track, navigation, mask_tol,
+                               mask_tol_scalor, overstep_tol);
+        }
+
+        // Determine overall state of the navigation after updating the cache
+        update_navigation_state(navigation, cfg);
+
+        navigation.run_inspector(cfg, track.pos(), track.dir(),
+                                 "Init from portal links complete: ");
+
+        // The track usually sits on the portal it entered through, so the
+        // trust level is not meaningful here: Only require a next candidate
+        return !navigation.is_exhausted();
+    }
+
+    /// @brief Initialize the volume from the landmark cache.
+    ///
+    /// Only applies to the first initialization of tracks that start close to
+    /// the landmark in one of the volumes of the cache and are above its
+    /// transverse momentum threshold. Tests the cached candidates of the
+    /// eta-phi bin of the track direction instead of running the full volume
+    /// search. Later reinitializations (e.g. after a material interaction)
+    /// start away from the landmark and use the full search.
+    ///
+    /// @tparam track_t type of track, needs to provide pos() and dir() methods
+    ///
+    /// @param track access to the track parameters
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration
+    ///
+    /// @returns true if the navigation was initialized successfully
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool init_from_landmark(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx,
+        const bool use_path_tolerance_as_overstep_tolerance) const {
+
+        // The lanes of a group share the candidates of the full search
+        if constexpr (lane_group_t::size > 1u) {
+            return false;
+        } else {
+            const landmark_cache_type *landmarks{navigation.landmarks()};
+            if (landmarks == nullptr || navigation.m_is_initialized ||
+                navigation.direction() == navigation::direction::e_backward ||
+                !landmarks->applies(navigation.volume(), track.pos(),
+                                    track.dir(), track.qop())) {
+                return false;
+            }
+
+            const auto &det = navigation.detector();
+
+            // Do not resurrect a failed/finished navigation state
+            assert(navigation.status() > navigation::status::e_on_target);
+            assert(!track.is_invalid());
+
+            // Clean up state
+            navigation.clear();
+            navigation.m_heartbeat = true;
+
+            const scalar_type overstep_tol =
+                use_path_tolerance_as_overstep_tolerance
+                    ? -cfg.path_tolerance
+                    : cfg.overstep_tolerance;
+            const darray<scalar_type, 2u> mask_tol{cfg.min_mask_tolerance,
+                                                   cfg.max_mask_tolerance};
+            const auto mask_tol_scalor{
+                static_cast<scalar_type>(cfg.mask_tolerance_scalor)};
+
+            // The cache contains the portals, too
+            for (const auto &sf_desc :
+                 landmarks->candidates(navigation.volume(), track.dir())) {
+                if (cfg.sensitive_only && sf_desc.is_passive()) {
+                    continue;
+                }
+                candidate_search{}(sf_desc, det, ctx, track, navigation,
+                                   mask_tol, mask_tol_scalor, overstep_tol);
+            }
+
+            // Determine overall state of the navigation after updating the
+            // cache
+            update_navigation_state(navigation, cfg);
+
+            // Leave the special cases to the full initialization
+            if (navigation.is_exhausted() ||
+                navigation.trust_level() != navigation::trust_level::e_full) {
+                return false;
+            }
+
+            navigation.run_inspector(cfg, track.pos(), track.dir(),
+                                     "Init from landmark cache complete: ");
+
+            return true;
+        }
+    }
+
+    /// Helper method to update the candidates (surface intersections)
+    /// based on an externally provided trust level. Will (re-)initialize the
+    /// navigation if there is no trust.
+    ///
+    /// @tparam track_t type of track, needs to provide pos() and dir() methods
+    ///
+    /// @param track access to the track parameters
+    /// @param state the current navigation state
+    /// @param cfg the navigation configuration
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update_kernel(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx) const {
+
+        const auto &det = navigation.detector();
+
+        // Current candidates are up to date, nothing left to do
+        if (navigation.trust_level() == navigation::trust_level::e_full) {
+            return false;
+        }
+
+        // Update only the current candidate and the corresponding next target
+        // - do this only when the navigation state is still coherent
+        if (navigation.trust_level() == navigation::trust_level::e_high) {
+            // Update next candidate: If not reachable, 'high trust' is broken
+            if (!update_candidate(navigation.direction(), navigation.target(),
+                                  track, det, cfg, ctx)) {
+                navigation.m_status = navigation::status::e_unknown;
+                navigation.set_fair_trust();
+            } else {
+
+                // Update navigation flow on the new candidate information
+                update_navigation_state(navigation, cfg);
+
+                navigation.run_inspector(cfg, track.pos(), track.dir(),
+                                         "Update complete: high trust: ");
 
                 // The work is done if: the track has not reached a surface yet
                 // or trust is gone (portal was reached or the cache is broken).
@@ -923,21 +2431,25 @@ class navigator {
         if (navigation.trust_level() == navigation::trust_level::e_fair &&
             !navigation.is_exhausted()) {
 
-            for (auto &candidate : navigation) {
-                // Disregard this candidate if it is not reachable
-                if (!update_candidate(navigation.direction(), candidate, track,
-                                      det, cfg, ctx)) {
-                    // Forcefully set dist to numeric max for sorting
-                    candidate.path = std::numeric_limits<scalar_type>::max();
-                }
+            const auto first = navigation.begin();
+            const auto last = navigation.end();
+            update_candidates(track, navigation, cfg, ctx, first, last);
+
+            // No candidate is reachable anymore: Retry the cache with a
+            // widened overstep tolerance, before the volume is reinitialized
+            // (the candidates are still in place, since none was moved)
+            if (cfg.retry_overstepped_candidates && navigation.is_exhausted()) {
+                navigation::config retry_cfg{cfg};
+                retry_cfg.overstep_tolerance *= cfg.overstep_retry_scalor;
+
+                update_candidates(track, navigation, retry_cfg, ctx, first,
+                                  last);
+
+                navigation.run_inspector(cfg, track.pos(), track.dir(),
+                                         navigation.is_exhausted()
+                                             ? "Overstep recovery: failed: "
+                                             : "Overstep recovery: success: ");
             }
-            detray::sequential_sort(navigation.begin(), navigation.end());
-            // Take the nearest (sorted) candidate first
-            navigation.set_next(navigation.begin());
-            // Ignore unreachable elements (needed to determine exhaustion)
-            navigation.set_last(find_invalid(navigation.candidates()));
-            // Update navigation flow on the new candidate information
-            update_navigation_state(navigation, cfg);
 
             navigation.run_inspector(cfg, track.pos(), track.dir(),
                                      "Update complete: fair trust: ");
@@ -953,14 +2465,63 @@ class navigator {
             // Use overstep tolerance instead of path tolerance
             const bool use_path_tolerance_as_overstep_tolerance = false;
 
-            init(track, navigation, cfg, ctx,
-                 use_path_tolerance_as_overstep_tolerance);
+            init_impl(track, navigation, cfg, ctx,
+                      use_path_tolerance_as_overstep_tolerance);
             return true;
         }
 
         return false;
     }
 
+    /// @brief Re-evaluate the candidates in the range [@param first,
+    /// @param last ) of the cache and sort the reachable ones to the front.
+    ///
+    /// @param cfg the navigation configuration (determines the reachability)
+    template <typename track_t, typename iterator_t>
+    DETRAY_HOST_DEVICE inline void update_candidates(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx, const iterator_t first,
+        const iterator_t last) const {
+
+        const auto &det = navigation.detector();
+
+        // Update the candidates and move the reachable ones to the front
+        // of the range, keeping their previous (sorted) order
+        auto reachable_end = first;
+        for (auto itr = first; itr != last; ++itr) {
+            if (update_candidate(navigation.direction(), *itr, track, det, cfg,
+                                 ctx)) {
+                if (reachable_end != itr) {
+                    *reachable_end = *itr;
+                }
+                ++reachable_end;
+            }
+        }
+        // Truncate the candidates that are no longer reachable
+        for (auto itr = reachable_end; itr != last; ++itr) {
+            itr->path = std::numeric_limits<candidate_path_type>::max();
+        }
+        // The cache was sorted before the step: Only repair the order. On
+        // device, a small cache is sorted by a network instead, which does
+        // not diverge between the threads (but is not stable)
+#if defined(__CUDACC__) || defined(__HIP__) || \
+    defined(CL_SYCL_LANGUAGE_VERSION) || defined(SYCL_LANGUAGE_VERSION)
+        if constexpr (k_cache_capacity <= detail::max_sorting_network_size) {
+            detail::network_sort<k_cache_capacity>(first, reachable_end);
+        } else {
+            detail::repair_sort(first, reachable_end);
+        }
+#else
+        detail::repair_sort(first, reachable_end);
+#endif
+        // Take the nearest (sorted) candidate first
+        navigation.set_next(first);
+        // Ignore unreachable elements (needed to determine exhaustion)
+        navigation.set_last(reachable_end);
+        // Update navigation flow on the new candidate information
+        update_navigation_state(navigation, cfg);
+    }
+
     /// @brief Helper method that re-establishes the navigation state after an
     /// update.
     ///
@@ -977,9 +2538,10 @@ class navigator {
         // portal, in which case the navigation needs to be re-initialized
         if (!navigation.is_exhausted() &&
             navigation.is_on_surface(navigation.target(), cfg)) {
-            navigation.m_status = (navigation.target().sf_desc.is_portal())
-                                      ? navigation::status::e_on_portal
-                                      : navigation::status::e_on_module;
+            navigation.m_status =
+                navigation.target().surface(navigation.detector()).is_portal()
+                    ? navigation::status::e_on_portal
+                    : navigation::status::e_on_module;
             // Set the next object that we want to reach (this function is only
             // called once the cache has been updated to a full trust state).
             // Might lead to exhausted cache.
@@ -1016,38 +2578,39 @@ class navigator {
         const track_t &track, const detector_type &det,
         const navigation::config &cfg, const context_type &ctx) const {
 
-        if (candidate.sf_desc.barcode().is_invalid()) {
+        const auto &sf_desc = candidate.surface(det);
+        if (sf_desc.barcode().is_invalid()) {
             return false;
         }
 
-        const auto sf = geometry::surface{det, candidate.sf_desc};
+        const auto sf = geometry::surface{det, sf_desc};
 
-        // Check whether this candidate is reachable by the track
-        return sf.template visit_mask<intersection_update<ray_intersector>>(
-            detail::ray<algebra_type>(
-                track.pos(), static_cast<scalar_type>(nav_dir) * track.dir()),
-            candidate, det.transform_store(), ctx,
+        const detail::ray<algebra_type> ray(
+            track.pos(), static_cast<scalar_type>(nav_dir) * track.dir());
+        const darray<scalar_type, 2> mask_tol{
             sf.is_portal() ? darray<scalar_type, 2>{0.f, 0.f}
                            : darray<scalar_type, 2>{cfg.min_mask_tolerance,
-                                                    cfg.max_mask_tolerance},
-            static_cast<scalar_type>(cfg.mask_tolerance_scalor),
-            static_cast<scalar_type>(cfg.overstep_tolerance));
-    }
+                                                    cfg.max_mask_tolerance}};
 
-    /// Helper to evict all unreachable/invalid candidates from the cache:
-    /// Finds the first unreachable candidate (has been invalidated during
-    /// update) in a sorted (!) cache.
-    ///
-    /// @param candidates the cache of candidates to be cleaned
-    DETRAY_HOST_DEVICE inline auto find_invalid(
-        typename state::candidate_cache_t &candidates) const {
-        // Depends on previous invalidation of unreachable candidates!
-        auto not_reachable = [](const intersection_type &candidate) {
-            return candidate.path == std::numeric_limits<scalar_type>::max();
-        };
-
-        return detray::find_if(candidates.begin(), candidates.end(),
-                               not_reachable);
+        // Check whether this candidate is reachable by the track
+        if constexpr (requires(const intersection_type &is) { is.sf_desc; }) {
+            return sf.template visit_mask<intersection_update<intersector_t>>(
+                ray, candidate, det.transform_store(), ctx, mask_tol,
+                static_cast<scalar_type>(cfg.mask_tolerance_scalor),
+                static_cast<scalar_type>(cfg.overstep_tolerance));
+        } else {
+            // The slim candidate does not hold the surface descriptor:
+            // Update a full intersection and keep the compact result
+            auto sfi = candidate.expand(sf_desc);
+            const bool is_reachable{
+                sf.template visit_mask<intersection_update<intersector_t>>(
+                    ray, sfi, det.transform_store(), ctx, mask_tol,
+                    static_cast<scalar_type>(cfg.mask_tolerance_scalor),
+                    static_cast<scalar_type>(cfg.overstep_tolerance))};
+            candidate = sfi;
+
+            return is_reachable;
+        }
     }
 };
 
@@ -0,0 +1,313 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+namespace detray {
+
+/// @brief Table of the likely next candidates when a track leaves a volume
+/// through a portal.
+///
+/// For every portal, the table holds a number of bins in the pseudorapidity
+/// and global phi of the position where the track crosses the portal. Every
+/// bin lists the surfaces of the neighbouring volume (except its portals)
+/// that are reachable from that part of the portal. After a volume switch,
+/// the navigator can initialize the next volume from the portals of the
+/// volume and this reduced candidate set (@see navigator ).
+///
+/// The candidates are only complete for tracks that point away from the
+/// beamline by at most the maximal angle between the track direction and
+/// the direction of the crossing position, and whose transverse momentum
+/// is at least the minimal transverse momentum the table was built for
+/// (@see build_portal_links ). All other tracks need a full initialization.
+///
+template <concepts::algebra algebra_t, typename surface_t,
+          typename container_t = host_container_types>
+class portal_link_table {
+
+    /// Positions of the parameters in the axis vector
+    enum axis_param : dindex {
+        e_max_eta = 0u,
+        e_cos_max_angle = 1u,
+        e_min_pT = 2u,
+        e_size = 3u,
+    };
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using scalar_type = dscalar<algebra_t>;
+
+    using view_type =
+        dmulti_view<dvector_view<scalar_type>, dvector_view<size_type>,
+                    dvector_view<size_type>, dvector_view<size_type>,
+                    dvector_view<surface_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const scalar_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const surface_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<scalar_type>, dvector_buffer<size_type>,
+                      dvector_buffer<size_type>, dvector_buffer<size_type>,
+                      dvector_buffer<surface_t>>;
+
+    /// Default constructor
+    constexpr portal_link_table() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr portal_link_table(vecmem::memory_resource* resource)
+        : m_axes(resource),
+          m_n_bins(resource),
+          m_portal_offsets(resource),
+          m_bin_offsets(resource),
+          m_candidates(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr portal_link_table(vecmem::memory_resource& resource)
+        : portal_link_table(&resource) {}
+
+    /// Constructor from memory resource and binning
+    ///
+    /// @param n_eta_bins number of bins in eta of the crossing position
+    /// @param n_phi_bins number of bins in phi of the crossing position
+    /// @param max_eta the eta bins span [-max_eta, max_eta], the outer bins
+    ///                also contain the positions beyond
+    /// @param max_angle maximal angle between the track direction and the
+    ///                  direction of the crossing position
+    /// @param min_pT minimal transverse momentum per charge of the tracks
+    ///               (zero, if the tracks do not bend)
+    DETRAY_HOST
+    portal_link_table(vecmem::memory_resource& resource,
+                      const size_type n_eta_bins, const size_type n_phi_bins,
+                      const scalar_type max_eta, const scalar_type max_angle,
+                      const scalar_type min_pT)
+        : portal_link_table(&resource) {
+        m_axes = {max_eta, math::cos(max_angle), min_pT};
+        m_n_bins = {n_eta_bins, n_phi_bins};
+    }
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view table_view_t>
+    DETRAY_HOST_DEVICE explicit portal_link_table(table_view_t& view)
+        : m_axes(detail::get<0>(view.m_view)),
+          m_n_bins(detail::get<1>(view.m_view)),
+          m_portal_offsets(detail::get<2>(view.m_view)),
+          m_bin_offsets(detail::get<3>(view.m_view)),
+          m_candidates(detail::get<4>(view.m_view)) {}
+
+    /// @returns the number of surfaces the table was built for
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return m_portal_offsets.empty()
+                   ? 0u
+                   : static_cast<size_type>(m_portal_offsets.size()) - 1u;
+    }
+
+    /// @returns true if the table was not built
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0} || m_axes.size() != e_size ||
+               m_n_bins.size() != 2u;
+    }
+
+    /// @returns the candidates of all portals and bins
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<surface_t>& { return m_candidates; }
+
+    /// @returns the range of the eta binning
+    DETRAY_HOST_DEVICE
+    constexpr auto max_eta() const -> scalar_type { return m_axes[e_max_eta]; }
+
+    /// @returns the cosine of the maximal angle between the track direction
+    /// and the direction of the crossing position
+    DETRAY_HOST_DEVICE
+    constexpr auto cos_max_angle() const -> scalar_type {
+        return m_axes[e_cos_max_angle];
+    }
+
+    /// @returns the minimal transverse momentum per charge of the tracks
+    DETRAY_HOST_DEVICE
+    constexpr auto min_pT() const -> scalar_type { return m_axes[e_min_pT]; }
+
+    /// @returns the number of bins in eta
+    DETRAY_HOST_DEVICE
+    constexpr auto n_eta_bins() const -> size_type { return m_n_bins[0]; }
+
+    /// @returns the number of bins in phi
+    DETRAY_HOST_DEVICE
+    constexpr auto n_phi_bins() const -> size_type { return m_n_bins[1]; }
+
+    /// @returns true if the table holds candidates for the surface with
+    /// index @param sf_idx
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex sf_idx) const {
+        return !empty() && sf_idx < size() &&
+               m_portal_offsets[sf_idx + 1u] > m_portal_offsets[sf_idx];
+    }
+
+    /// @returns the number of eta-phi bins of the portal @param sf_idx
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_bins(const dindex sf_idx) const {
+        return contains(sf_idx)
+                   ? m_portal_offsets[sf_idx + 1u] - m_portal_offsets[sf_idx]
+                   : 0u;
+    }
+
+    /// @returns true if the candidates of the portal @param sf_idx are
+    /// complete for a track that crosses it at @param pos with direction
+    /// @param dir and charge over momentum @param qop
+    DETRAY_HOST_DEVICE
+    constexpr bool applies(const dindex sf_idx, const point3_type& pos,
+                           const vector3_type& dir,
+                           const scalar_type qop) const {
+        if (!contains(sf_idx)) {
+            return false;
+        }
+
+        // The track has to point away from the beamline
+        const scalar_type pos_norm{vector::norm(pos)};
+        const scalar_type dir_norm{vector::norm(dir)};
+        if (pos_norm == 0.f || !(vector::dot(pos, dir) >=
+                                 cos_max_angle() * pos_norm * dir_norm)) {
+            return false;
+        }
+
+        // Neutral tracks do not bend
+        if (qop == 0.f) {
+            return true;
+        }
+        const scalar_type sin_theta{vector::perp(dir) / dir_norm};
+
+        return sin_theta >= min_pT() * math::fabs(qop);
+    }
+
+    /// @returns the candidates in the neighbouring volume of the portal
+    /// @param sf_idx for a track that crosses the portal at @param pos
+    ///
+    /// @note Only complete if the table @c applies() to the track
+    DETRAY_HOST_DEVICE
+    auto candidates(const dindex sf_idx, const point3_type& pos) const {
+        if (!contains(sf_idx)) {
+            return detray::ranges::subrange(m_candidates,
+                                            dindex_range{0u, 0u});
+        }
+        const dindex bin{m_portal_offsets[sf_idx] +
+                         eta_bin(pos, n_eta_bins(), max_eta()) *
+                             n_phi_bins() +
+                         phi_bin(vector::phi(pos), n_phi_bins())};
+
+        return detray::ranges::subrange(
+            m_candidates, dindex_range{m_bin_offsets[bin],
+                                       m_bin_offsets[bin + 1u]});
+    }
+
+    /// @returns the eta bin of the position @param pos for @param n bins in
+    /// [-max_eta, max_eta]
+    DETRAY_HOST_DEVICE
+    static constexpr dindex eta_bin(const point3_type& pos, const dindex n,
+                                    const scalar_type max_eta) {
+        const scalar_type cos_theta{pos[2] / vector::norm(pos)};
+        const scalar_type eta{
+            0.5f * math::log((1.f + cos_theta) / (1.f - cos_theta))};
+
+        // Also catches invalid positions
+        if (!(eta > -max_eta)) {
+            return 0u;
+        }
+        if (eta >= max_eta) {
+            return n - 1u;
+        }
+        const auto b{static_cast<dindex>((eta + max_eta) / (2.f * max_eta) *
+                                         static_cast<scalar_type>(n))};
+
+        return b < n ? b : n - 1u;
+    }
+
+    /// @returns the phi bin of @param phi for @param n bins in [-pi, pi]
+    DETRAY_HOST_DEVICE
+    static constexpr dindex phi_bin(const scalar_type phi, const dindex n) {
+        constexpr scalar_type two_pi{2.f * constant<scalar_type>::pi};
+
+        const auto b{static_cast<dindex>(
+            (phi + constant<scalar_type>::pi) / two_pi *
+            static_cast<scalar_type>(n))};
+
+        return b < n ? b : n - 1u;
+    }
+
+    /// Add the bins of the next surface in the detector surface lookup. The
+    /// surfaces have to be added in order of their index.
+    ///
+    /// @param bins the candidates per eta-phi bin, phi runs fastest (empty,
+    ///             if not a portal)
+    template <typename bin_container_t>
+    DETRAY_HOST void push_back(const bin_container_t& bins) {
+        if (m_portal_offsets.empty()) {
+            m_portal_offsets.push_back(0u);
+            m_bin_offsets.push_back(0u);
+        }
+        for (const auto& bin : bins) {
+            m_candidates.insert(m_candidates.end(), bin.begin(), bin.end());
+            m_bin_offsets.push_back(static_cast<dindex>(m_candidates.size()));
+        }
+        m_portal_offsets.push_back(
+            static_cast<dindex>(m_bin_offsets.size()) - 1u);
+    }
+
+    /// @return the view on the table - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_axes), detray::get_data(m_n_bins),
+                         detray::get_data(m_portal_offsets),
+                         detray::get_data(m_bin_offsets),
+                         detray::get_data(m_candidates)};
+    }
+
+    /// @return the view on the table - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_axes), detray::get_data(m_n_bins),
+            detray::get_data(m_portal_offsets),
+            detray::get_data(m_bin_offsets), detray::get_data(m_candidates)};
+    }
+
+    private:
+    /// Eta range, maximal direction angle and minimal transverse momentum
+    vector_type<scalar_type> m_axes{};
+    /// Number of bins in eta and phi
+    vector_type<size_type> m_n_bins{};
+    /// Range of bins per surface
+    vector_type<size_type> m_portal_offsets{};
+    /// Range of candidates per bin
+    vector_type<size_type> m_bin_offsets{};
+    /// The candidates of all bins
+    vector_type<surface_t> m_candidates{};
+};
+
+}  // namespace detray
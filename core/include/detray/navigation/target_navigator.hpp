@@ -0,0 +1,386 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/ray.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cassert>
+#include <limits>
+
+namespace detray {
+
+/// @brief Navigator that steps directly towards a single target surface
+///
+/// For short extrapolations, e.g. to the next measurement or to the perigee
+/// surface, the local navigation in every crossed volume is not needed: This
+/// navigator only intersects the target surface and ignores all other
+/// surfaces of the detector. The navigation is complete once the target is
+/// reached (@see propagator::propagate_to ).
+///
+/// If @tparam track_volumes is set, the volume that contains the track is
+/// looked up in the volume finder of the detector after every step, so that
+/// the stepper picks up the volume material along the way. Otherwise, the
+/// navigation state does not hold a volume and no volume material is applied.
+///
+/// @note Surface material is only collected on the target surface.
+///
+/// @tparam detector_t the detector that contains the target surface
+template <typename detector_t, bool track_volumes = false>
+class target_navigator {
+
+    public:
+    using detector_type = detector_t;
+    using context_type = detector_type::geometry_context;
+    using algebra_type = typename detector_type::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using intersection_type =
+        intersection2D<typename detector_t::surface_type,
+                       typename detector_t::algebra_type, false>;
+    using nav_link_type = typename detector_type::surface_type::navigation_link;
+
+    class state {
+
+        friend class target_navigator;
+        friend struct intersection_update<ray_intersector>;
+
+        using candidate_t = intersection_type;
+
+        public:
+        using detector_type = target_navigator::detector_type;
+        using nav_link_type = target_navigator::nav_link_type;
+        /// The state does not hold any external data
+        using view_type = navigation::void_inspector::view_type;
+
+        state() = delete;
+
+        /// Construct from the detector @param det and the barcode of the
+        /// @param target surface (can also be set later)
+        DETRAY_HOST_DEVICE explicit state(
+            const detector_t &det, const geometry::barcode target = {})
+            : m_detector(&det) {
+            set_target(target);
+        }
+
+        /// Constructor from detector @param det and an empty view
+        DETRAY_HOST_DEVICE state(const detector_t &det, const view_type &)
+            : state(det) {}
+
+        /// Scalar representation of the navigation state,
+        /// @returns distance to next
+        DETRAY_HOST_DEVICE
+        scalar_type operator()() const {
+            return static_cast<scalar_type>(direction()) * target().path;
+        }
+
+        /// @returns a pointer of detector
+        DETRAY_HOST_DEVICE
+        const detector_type &detector() const { return (*m_detector); }
+
+        /// @returns the navigation heartbeat
+        DETRAY_HOST_DEVICE
+        bool is_alive() const { return m_heartbeat; }
+
+        /// @returns current/previous object that was reached
+        DETRAY_HOST_DEVICE
+        inline auto current() const -> const candidate_t & {
+            return m_candidate_prev;
+        }
+
+        /// @returns next object that we want to reach (current target) - const
+        DETRAY_HOST_DEVICE
+        inline auto target() const -> const candidate_t & {
+            return m_candidate;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto target() -> candidate_t & { return m_candidate; }
+
+        /// Set the surface with the barcode @param bcd as the target of the
+        /// navigation (before the navigation is initialized)
+        DETRAY_HOST_DEVICE
+        inline void set_target(const geometry::barcode bcd) {
+            m_reached = bcd.is_invalid();
+            if (!m_reached) {
+                m_candidate.sf_desc = m_detector->surface(bcd);
+                m_candidate.volume_link = static_cast<nav_link_type>(
+                    tracking_surface{*m_detector, m_candidate.sf_desc}
+                        .volume_link());
+                m_candidate.path = std::numeric_limits<scalar_type>::max();
+            }
+        }
+
+        /// @returns current detector surface the navigator is on
+        /// (cannot be used when not on surface) - const
+        DETRAY_HOST_DEVICE
+        inline auto get_surface() const -> tracking_surface<detector_type> {
+            assert(is_on_surface());
+            return tracking_surface<detector_type>{*m_detector,
+                                                   current().sf_desc};
+        }
+
+        /// @returns current navigation status - const
+        DETRAY_HOST_DEVICE
+        inline auto status() const -> navigation::status { return m_status; }
+
+        /// @return true if the target was reached
+        DETRAY_HOST_DEVICE
+        bool is_complete() const { return m_reached; }
+
+        /// @returns current navigation direction - const
+        DETRAY_HOST_DEVICE
+        inline auto direction() const -> navigation::direction {
+            return m_direction;
+        }
+
+        /// Helper method to check the track has reached a module surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_surface() const -> bool {
+            return (m_status == navigation::status::e_on_module ||
+                    m_status == navigation::status::e_on_portal);
+        }
+
+        /// Helper method to check if a candidate lies on a surface - const
+        DETRAY_HOST_DEVICE inline auto is_on_surface(
+            const intersection_type &candidate,
+            const navigation::config &cfg) const -> bool {
+            return (math::fabs(candidate.path) < cfg.path_tolerance);
+        }
+
+        /// Helper method to check the track has encountered material
+        DETRAY_HOST_DEVICE
+        inline auto encountered_sf_material() const -> bool {
+            return (is_on_surface()) && (current().sf_desc.material().id() !=
+                                         detector_t::materials::id::e_none);
+        }
+
+        /// Helper method to check the track has reached a sensitive surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_sensitive() const -> bool {
+            return (m_status == navigation::status::e_on_module) &&
+                   (barcode().id() == surface_id::e_sensitive);
+        }
+
+        /// Helper method to check the track has reached a passive surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_passive() const -> bool {
+            return (m_status == navigation::status::e_on_module) &&
+                   (barcode().id() == surface_id::e_passive);
+        }
+
+        /// Helper method to check the track has reached a portal surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_portal() const -> bool {
+            return m_status == navigation::status::e_on_portal;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto barcode() const -> geometry::barcode {
+            return m_candidate_prev.sf_desc.barcode();
+        }
+
+        /// @returns current volume (index) - const
+        DETRAY_HOST_DEVICE
+        inline auto volume() const -> nav_link_type { return m_volume_index; }
+
+        /// Set start/new volume: Only kept if the volumes are tracked
+        DETRAY_HOST_DEVICE
+        inline void set_volume(dindex v) {
+            assert(detail::is_invalid_value(static_cast<nav_link_type>(v)) ||
+                   v < detector().volumes().size());
+            if constexpr (track_volumes) {
+                m_volume_index = static_cast<nav_link_type>(v);
+            }
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto abort(const char * = nullptr) -> bool {
+            m_status = navigation::status::e_abort;
+            m_heartbeat = false;
+            return m_heartbeat;
+        }
+
+        template <typename debug_msg_generator_t>
+        DETRAY_HOST_DEVICE inline auto abort(const debug_msg_generator_t &)
+            -> bool {
+            return abort();
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto exit() -> bool {
+            m_status = navigation::status::e_on_target;
+            m_heartbeat = false;
+            return m_heartbeat;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto pause() const -> bool { return false; }
+
+        /// @returns current detector volume of the navigation stream
+        DETRAY_HOST_DEVICE
+        inline auto get_volume() const {
+            assert(!detail::is_invalid_value(m_volume_index));
+            return tracking_volume<detector_type>{*m_detector, m_volume_index};
+        }
+
+        /// Set direction
+        DETRAY_HOST_DEVICE
+        inline void set_direction(const navigation::direction dir) {
+            m_direction = dir;
+        }
+
+        /// @returns the navigation trust level: only the target surface is
+        /// ever updated
+        DETRAY_HOST_DEVICE
+        inline auto trust_level() const -> navigation::trust_level {
+            return navigation::trust_level::e_high;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline void set_no_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void set_full_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void set_high_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void set_fair_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void advance(const scalar_type) { return; }
+
+        private:
+        /// Intersection with the target surface
+        candidate_t m_candidate;
+        candidate_t m_candidate_prev;
+
+        /// Detector pointer
+        const detector_type *m_detector{nullptr};
+
+        /// Index of the volume that contains the track (only if tracked)
+        nav_link_type m_volume_index{detail::invalid_value<nav_link_type>()};
+
+        /// The navigation direction
+        navigation::direction m_direction{navigation::direction::e_forward};
+
+        /// The navigation status
+        navigation::status m_status{navigation::status::e_unknown};
+
+        /// Step size when no valid intersection is found for the target
+        scalar_type safe_step_size = 10.f * unit<scalar_type>::mm;
+
+        /// Whether the target surface was reached
+        bool m_reached{true};
+
+        /// Heartbeat of this navigation flow signals navigation is alive
+        bool m_heartbeat{false};
+    };
+
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init(const track_t &track, state &navigation,
+                                        const navigation::config &cfg,
+                                        const context_type &ctx) const {
+        // Do not resurrect a failed/finished navigation state
+        assert(navigation.status() > navigation::status::e_on_target);
+        assert(!track.is_invalid());
+
+        if (navigation.is_complete()) {
+            navigation.m_heartbeat = false;
+            return;
+        }
+
+        navigation.m_heartbeat = true;
+        update(track, navigation, cfg, ctx);
+    }
+
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx = {},
+        const bool is_before_actor_run = true) const {
+
+        assert(!track.is_invalid());
+
+        if (navigation.is_complete()) {
+            navigation.m_heartbeat = false;
+            return true;
+        }
+
+        if constexpr (track_volumes) {
+            navigation.m_volume_index = static_cast<nav_link_type>(
+                navigation.detector().volume(track.pos()).index());
+        }
+
+        update_intersection(track, navigation, cfg, ctx);
+
+        if (is_before_actor_run &&
+            navigation.is_on_surface(navigation.target(), cfg)) {
+            navigation.m_status = (navigation.target().sf_desc.is_portal())
+                                      ? navigation::status::e_on_portal
+                                      : navigation::status::e_on_module;
+            navigation.m_candidate_prev = navigation.m_candidate;
+            navigation.m_reached = true;
+
+            // Return true to reset the step size
+            return true;
+        }
+
+        // Otherwise the track is moving towards the target
+        navigation.m_status = navigation::status::e_towards_object;
+
+        // Return false to scale the step size with RK4
+        return false;
+    }
+
+    /// Intersect the target surface with the tangent to the track
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void update_intersection(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx = {}) const {
+
+        const auto &det = navigation.detector();
+        const auto sf = tracking_surface{det, navigation.target().sf_desc};
+
+        const bool res =
+            sf.template visit_mask<intersection_update<ray_intersector>>(
+                detail::ray<algebra_type>(
+                    track.pos(),
+                    static_cast<scalar_type>(navigation.direction()) *
+                        track.dir()),
+                navigation.target(), det.transform_store(), ctx,
+                darray<scalar_type, 2>{cfg.min_mask_tolerance,
+                                       cfg.max_mask_tolerance},
+                static_cast<scalar_type>(cfg.mask_tolerance_scalor),
+                static_cast<scalar_type>(cfg.overstep_tolerance));
+
+        // If the tangent misses the target (e.g. a strongly bent track),
+        // proceed with a safe step size and try again
+        if (!res) {
+            navigation.target().path = navigation.safe_step_size;
+        }
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,413 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/ray.hpp"
+
+// System include(s)
+#include <cassert>
+#include <limits>
+
+namespace detray {
+
+/// @brief Navigator for telescope detectors
+///
+/// In a telescope detector (@see telescope_metadata ), the sensitive planes
+/// are placed in a single volume in the order of their positions along the
+/// pilot track, so the navigation sequence is known from the surface indices.
+/// Instead of collecting and sorting the candidates of the volume, this
+/// navigator only intersects the next plane in the navigation direction and
+/// steps plane by plane. Planes that are missed by the track are skipped.
+///
+/// @note The navigation ends after the last plane in the navigation
+/// direction, the portals of the telescope volume are not visited.
+///
+/// @tparam detector_t the telescope detector to navigate
+template <typename detector_t>
+class telescope_navigator {
+
+    static_assert(detector_t::accelerator_container::n_collections() == 1u,
+                  "The telescope navigator needs a detector without "
+                  "acceleration data structures");
+
+    public:
+    using detector_type = detector_t;
+    using context_type = detector_type::geometry_context;
+    using algebra_type = typename detector_type::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using intersection_type =
+        intersection2D<typename detector_t::surface_type,
+                       typename detector_t::algebra_type, false>;
+    using nav_link_type = typename detector_type::surface_type::navigation_link;
+
+    class state {
+
+        friend class telescope_navigator;
+        friend struct intersection_update<ray_intersector>;
+
+        using candidate_t = intersection_type;
+
+        public:
+        using detector_type = telescope_navigator::detector_type;
+        using nav_link_type = telescope_navigator::nav_link_type;
+        /// The state does not hold any external data
+        using view_type = navigation::void_inspector::view_type;
+
+        state() = delete;
+
+        /// Construct from the telescope detector @param det : The planes are
+        /// the sensitive surfaces of the volume @param volume
+        DETRAY_HOST_DEVICE explicit state(const detector_t &det,
+                                          const dindex volume = 0u)
+            : m_detector(&det),
+              m_planes(det.volumes()[volume]
+                           .template sf_link<surface_id::e_sensitive>()),
+              m_volume_index(static_cast<nav_link_type>(volume)) {
+            assert(det.volumes().size() == 1u);
+        }
+
+        /// Constructor from detector @param det and an empty view
+        DETRAY_HOST_DEVICE state(const detector_t &det, const view_type &)
+            : state(det) {}
+
+        /// Scalar representation of the navigation state,
+        /// @returns distance to next
+        DETRAY_HOST_DEVICE
+        scalar_type operator()() const {
+            return static_cast<scalar_type>(direction()) * target().path;
+        }
+
+        /// @returns a pointer of detector
+        DETRAY_HOST_DEVICE
+        const detector_type &detector() const { return (*m_detector); }
+
+        /// @returns the navigation heartbeat
+        DETRAY_HOST_DEVICE
+        bool is_alive() const { return m_heartbeat; }
+
+        /// @returns current/previous object that was reached
+        DETRAY_HOST_DEVICE
+        inline auto current() const -> const candidate_t & {
+            return m_candidate_prev;
+        }
+
+        /// @returns next object that we want to reach (current target) - const
+        DETRAY_HOST_DEVICE
+        inline auto target() const -> const candidate_t & {
+            return m_candidate;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto target() -> candidate_t & { return m_candidate; }
+
+        /// @returns the number of planes in the telescope
+        DETRAY_HOST_DEVICE
+        inline dindex n_planes() const {
+            return detail::get<1>(m_planes) - detail::get<0>(m_planes);
+        }
+
+        /// @returns the number of planes that were passed or skipped
+        DETRAY_HOST_DEVICE
+        inline dindex n_passed() const { return m_n_passed; }
+
+        /// @returns the surface index of the next plane
+        DETRAY_HOST_DEVICE
+        inline dindex next_plane() const {
+            assert(!is_complete());
+            return (m_direction == navigation::direction::e_forward)
+                       ? detail::get<0>(m_planes) + m_n_passed
+                       : detail::get<1>(m_planes) - 1u - m_n_passed;
+        }
+
+        /// Set the next plane as target
+        DETRAY_HOST_DEVICE
+        void update_candidate(bool update_candidate_prev = true) {
+
+            if (update_candidate_prev) {
+                m_candidate_prev = m_candidate;
+            }
+
+            if (!is_complete()) {
+                m_candidate.sf_desc = m_detector->surface(next_plane());
+                m_candidate.volume_link = m_volume_index;
+                m_candidate.path = std::numeric_limits<scalar_type>::max();
+            }
+        }
+
+        /// @returns current detector surface the navigator is on
+        /// (cannot be used when not on surface) - const
+        DETRAY_HOST_DEVICE
+        inline auto get_surface() const -> tracking_surface<detector_type> {
+            assert(is_on_surface());
+            return tracking_surface<detector_type>{*m_detector,
+                                                   current().sf_desc};
+        }
+
+        /// @returns current navigation status - const
+        DETRAY_HOST_DEVICE
+        inline auto status() const -> navigation::status { return m_status; }
+
+        /// Advance to the next plane
+        DETRAY_HOST_DEVICE
+        void next() { ++m_n_passed; }
+
+        /// @return true if all planes were passed
+        DETRAY_HOST_DEVICE
+        bool is_complete() const { return m_n_passed >= n_planes(); }
+
+        /// @returns current navigation direction - const
+        DETRAY_HOST_DEVICE
+        inline auto direction() const -> navigation::direction {
+            return m_direction;
+        }
+
+        /// Helper method to check the track has reached a module surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_surface() const -> bool {
+            return (m_status == navigation::status::e_on_module ||
+                    m_status == navigation::status::e_on_portal);
+        }
+
+        /// Helper method to check if a candidate lies on a surface - const
+        DETRAY_HOST_DEVICE inline auto is_on_surface(
+            const intersection_type &candidate,
+            const navigation::config &cfg) const -> bool {
+            return (math::fabs(candidate.path) < cfg.path_tolerance);
+        }
+
+        /// Helper method to check the track has encountered material
+        DETRAY_HOST_DEVICE
+        inline auto encountered_sf_material() const -> bool {
+            return (is_on_surface()) && (current().sf_desc.material().id() !=
+                                         detector_t::materials::id::e_none);
+        }
+
+        /// Helper method to check the track has reached a sensitive surface
+        DETRAY_HOST_DEVICE
+        inline auto is_on_sensitive() const -> bool {
+            return (m_status == navigation::status::e_on_module);
+        }
+
+        /// The telescope has no passive surfaces
+        DETRAY_HOST_DEVICE
+        inline auto is_on_passive() const -> bool { return false; }
+
+        /// The portals are not part of the navigation
+        DETRAY_HOST_DEVICE
+        inline auto is_on_portal() const -> bool { return false; }
+
+        DETRAY_HOST_DEVICE
+        inline auto barcode() const -> geometry::barcode {
+            return m_candidate_prev.sf_desc.barcode();
+        }
+
+        /// @returns current volume (index) - const
+        DETRAY_HOST_DEVICE
+        inline auto volume() const -> nav_link_type { return m_volume_index; }
+
+        /// Set start/new volume
+        DETRAY_HOST_DEVICE
+        inline void set_volume(dindex v) {
+            assert(detail::is_invalid_value(static_cast<nav_link_type>(v)) ||
+                   v < detector().volumes().size());
+            m_volume_index = static_cast<nav_link_type>(v);
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto abort(const char * = nullptr) -> bool {
+            m_status = navigation::status::e_abort;
+            m_heartbeat = false;
+            return m_heartbeat;
+        }
+
+        template <typename debug_msg_generator_t>
+        DETRAY_HOST_DEVICE inline auto abort(const debug_msg_generator_t &)
+            -> bool {
+            return abort();
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto exit() -> bool {
+            m_status = navigation::status::e_on_target;
+            m_heartbeat = false;
+            return m_heartbeat;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline auto pause() const -> bool { return false; }
+
+        /// @returns current detector volume of the navigation stream
+        DETRAY_HOST_DEVICE
+        inline auto get_volume() const {
+            return tracking_volume<detector_type>{*m_detector, m_volume_index};
+        }
+
+        /// Set direction (before the navigation is initialized)
+        DETRAY_HOST_DEVICE
+        inline void set_direction(const navigation::direction dir) {
+            assert(m_n_passed == 0u);
+            m_direction = dir;
+        }
+
+        /// @returns the navigation trust level: only the next plane is ever
+        /// updated
+        DETRAY_HOST_DEVICE
+        inline auto trust_level() const -> navigation::trust_level {
+            return navigation::trust_level::e_high;
+        }
+
+        DETRAY_HOST_DEVICE
+        inline void set_no_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void set_full_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void set_high_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void set_fair_trust() { return; }
+
+        DETRAY_HOST_DEVICE
+        inline void advance(const scalar_type) { return; }
+
+        private:
+        /// Intersection candidate
+        candidate_t m_candidate;
+        candidate_t m_candidate_prev;
+
+        /// Detector pointer
+        const detector_type *m_detector{nullptr};
+
+        /// Index range of the planes in the detector surface lookup
+        dindex_range m_planes{0u, 0u};
+
+        /// Number of planes that were passed in the navigation direction
+        dindex m_n_passed{0u};
+
+        /// Index in the detector volume container of the telescope volume
+        nav_link_type m_volume_index{0u};
+
+        /// The navigation direction
+        navigation::direction m_direction{navigation::direction::e_forward};
+
+        /// The navigation status
+        navigation::status m_status{navigation::status::e_unknown};
+
+        /// Heartbeat of this navigation flow signals navigation is alive
+        bool m_heartbeat{false};
+    };
+
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void init(const track_t &track, state &navigation,
+                                        const navigation::config &cfg,
+                                        const context_type &ctx) const {
+        // Do not resurrect a failed/finished navigation state
+        assert(navigation.status() > navigation::status::e_on_target);
+        assert(!track.is_invalid());
+
+        if (navigation.is_complete()) {
+            navigation.m_heartbeat = false;
+            return;
+        }
+
+        navigation.m_heartbeat = true;
+        navigation.update_candidate(navigation.n_passed() > 0u);
+        update(track, navigation, cfg, ctx);
+    }
+
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx = {},
+        const bool is_before_actor_run = true) const {
+
+        assert(!track.is_invalid());
+
+        if (navigation.is_complete()) {
+            navigation.m_heartbeat = false;
+            return true;
+        }
+
+        // The track misses all remaining planes
+        if (!update_intersection(track, navigation, cfg, ctx)) {
+            navigation.exit();
+            return true;
+        }
+
+        if (is_before_actor_run) {
+            if (navigation.is_on_surface(navigation.target(), cfg)) {
+                navigation.m_status = navigation::status::e_on_module;
+                navigation.next();
+                navigation.update_candidate(true);
+                assert(navigation.is_on_surface(navigation.current(), cfg));
+
+                if (!navigation.is_complete()) {
+                    update_intersection(track, navigation, cfg, ctx);
+                }
+
+                // Return true to reset the step size
+                return true;
+            }
+        }
+
+        // Otherwise the track is moving towards a surface
+        navigation.m_status = navigation::status::e_towards_object;
+
+        // Return false to scale the step size with RK4
+        return false;
+    }
+
+    /// Intersect the next plane and skip all planes that the track misses
+    ///
+    /// @returns false if no plane is left
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool update_intersection(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx = {}) const {
+
+        const auto &det = navigation.detector();
+        const detail::ray<algebra_type> ray(
+            track.pos(),
+            static_cast<scalar_type>(navigation.direction()) * track.dir());
+
+        while (!navigation.is_complete()) {
+            const auto sf = tracking_surface{det, navigation.target().sf_desc};
+
+            if (sf.template visit_mask<intersection_update<ray_intersector>>(
+                    ray, navigation.target(), det.transform_store(), ctx,
+                    darray<scalar_type, 2>{cfg.min_mask_tolerance,
+                                           cfg.max_mask_tolerance},
+                    static_cast<scalar_type>(cfg.mask_tolerance_scalor),
+                    static_cast<scalar_type>(cfg.overstep_tolerance))) {
+                return true;
+            }
+
+            // The plane is behind the track or missed: try the next one
+            navigation.next();
+            navigation.update_candidate(false);
+        }
+
+        return false;
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,124 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <stdexcept>
+
+namespace detray {
+
+/// @brief Table of the navigation parameters per volume.
+///
+/// Holds one entry per volume index, up to the largest volume that was added,
+/// so that the parameters of a volume are found directly by its index. The
+/// volumes without an entry use the global navigation configuration, e.g.
+/// tight search windows are only set for the dense pixel volumes and wider
+/// ones for the coarse outer volumes (@see navigator ).
+///
+/// @tparam container_t the types of underlying containers to be used.
+template <typename container_t = host_container_types>
+class volume_config_table {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using value_type = navigation::volume_config;
+
+    using view_type = dmulti_view<dvector_view<value_type>>;
+    using const_view_type = dmulti_view<dvector_view<const value_type>>;
+    using buffer_type = dmulti_buffer<dvector_buffer<value_type>>;
+
+    /// Default constructor
+    constexpr volume_config_table() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr volume_config_table(vecmem::memory_resource* resource)
+        : m_configs(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr volume_config_table(vecmem::memory_resource& resource)
+        : volume_config_table(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view table_view_t>
+    DETRAY_HOST_DEVICE explicit volume_config_table(table_view_t& view)
+        : m_configs(detail::get<0>(view.m_view)) {}
+
+    /// @returns the number of entries, including the empty ones
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return static_cast<size_type>(m_configs.size());
+    }
+
+    /// @returns true if no volume has its own navigation parameters
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @returns true if the volume with index @param vol_idx has its own
+    /// navigation parameters
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex vol_idx) const {
+        return vol_idx < size() && m_configs[vol_idx].volume == vol_idx;
+    }
+
+    /// @returns the navigation parameters of the volume @param vol_idx
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex vol_idx) const -> const value_type& {
+        assert(contains(vol_idx));
+        return m_configs[vol_idx];
+    }
+
+    /// Set the navigation parameters @param vol_cfg of a volume (replaces any
+    /// parameters that were set for the same volume before)
+    DETRAY_HOST void insert(const value_type& vol_cfg) {
+        if (detail::is_invalid_value(vol_cfg.volume)) {
+            throw std::invalid_argument(
+                "Volume navigation parameters need a volume index");
+        }
+        if (vol_cfg.volume >= size()) {
+            m_configs.resize(vol_cfg.volume + 1u);
+        }
+        m_configs[vol_cfg.volume] = vol_cfg;
+    }
+
+    /// @return the view on the table - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_configs)};
+    }
+
+    /// @return the view on the table - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{detray::get_data(m_configs)};
+    }
+
+    private:
+    /// The navigation parameters by volume index
+    vector_type<value_type> m_configs{};
+};
+
+}  // namespace detray
@@ -11,6 +11,7 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/definitions/math.hpp"
 #include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/volume_hop_table.hpp"
 #include "detray/utils/ranges.hpp"
 #include "detray/utils/type_traits.hpp"
 
@@ -338,6 +339,12 @@ class volume_graph {
     /// @return graph adjacency - const access.
     const auto &adjacency_matrix() const { return _adj_matrix; }
 
+    /// @returns the shortest paths between all pairs of nodes, allocated
+    /// with the memory resource @param mr
+    volume_hop_table<> hop_table(vecmem::memory_resource &mr) const {
+        return {_adj_matrix, n_nodes(), mr};
+    }
+
     /// Walks breadth first through the geometry objects.
     /*template <typename action_t = void_actor<node_type>>
     void bfs(action_t actor = {}) const {
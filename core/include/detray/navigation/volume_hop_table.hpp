@@ -0,0 +1,187 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <queue>
+
+namespace detray {
+
+namespace detail {
+
+/// Entry of the volume hop table for a pair of volumes
+struct volume_hop {
+    /// Next volume on the way to the target volume
+    dindex next{dindex_invalid};
+    /// Number of portal crossings to reach the target volume
+    dindex n_hops{dindex_invalid};
+};
+
+}  // namespace detail
+
+/// @brief Precomputed shortest paths between the volumes of a detector.
+///
+/// For every pair of volumes, the table holds the adjacent volume of the
+/// start volume that lies on a shortest path (least number of portal
+/// crossings) to the target volume, as well as the length of that path. The
+/// table is built once on the host from the volume adjacency (@see
+/// volume_graph ) and can then be queried on host or device, e.g. to
+/// pre-select the next volume during navigation or to check reachability
+/// without walking the graph again.
+///
+/// @tparam container_t the types of underlying containers to be used.
+template <typename container_t = host_container_types>
+class volume_hop_table {
+
+    public:
+    using hop = detail::volume_hop;
+
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+
+    using view_type = dvector_view<hop>;
+    using const_view_type = dvector_view<const hop>;
+
+    /// Default constructor
+    constexpr volume_hop_table() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr volume_hop_table(vecmem::memory_resource &resource)
+        : m_hops(&resource) {}
+
+    /// Build the table from the adjacency matrix @param adj_matrix of
+    /// @param n_volumes volumes (@see volume_graph::adjacency_matrix ).
+    ///
+    /// The last column of the adjacency matrix counts the links that leave
+    /// the detector world and self-links are not counted as hops.
+    template <typename adj_matrix_t>
+    DETRAY_HOST volume_hop_table(const adj_matrix_t &adj_matrix,
+                                 const dindex n_volumes,
+                                 vecmem::memory_resource &resource)
+        : m_hops(&resource) {
+        build(adj_matrix, n_volumes);
+    }
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view view_t>
+    DETRAY_HOST_DEVICE explicit volume_hop_table(view_t &view)
+        : m_hops(view) {}
+
+    /// @returns the number of volumes the table was built for
+    DETRAY_HOST_DEVICE
+    dindex n_volumes() const {
+        return static_cast<dindex>(
+            math::sqrt(static_cast<double>(m_hops.size())) + 0.5);
+    }
+
+    /// @returns true if no table was built
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return m_hops.empty(); }
+
+    /// @returns the table entry for the start volume @param from and the
+    /// target volume @param to
+    DETRAY_HOST_DEVICE
+    const hop &at(const dindex from, const dindex to) const {
+        const dindex n{n_volumes()};
+        assert(from < n);
+        assert(to < n);
+        return m_hops[from * n + to];
+    }
+
+    /// @returns the volume that follows the volume @param from on a shortest
+    /// path to the volume @param to (invalid if @param to cannot be reached)
+    DETRAY_HOST_DEVICE
+    dindex next_volume(const dindex from, const dindex to) const {
+        return at(from, to).next;
+    }
+
+    /// @returns the minimal number of portal crossings from the volume
+    /// @param from to the volume @param to (invalid if it cannot be reached)
+    DETRAY_HOST_DEVICE
+    dindex n_hops(const dindex from, const dindex to) const {
+        return at(from, to).n_hops;
+    }
+
+    /// @returns true if the volume @param to can be reached from the volume
+    /// @param from
+    DETRAY_HOST_DEVICE
+    bool is_reachable(const dindex from, const dindex to) const {
+        return at(from, to).n_hops != dindex_invalid;
+    }
+
+    /// @returns a view of the table - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type { return detray::get_data(m_hops); }
+
+    /// @returns a view of the table - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return detray::get_data(m_hops);
+    }
+
+    private:
+    /// Run a breadth first search from every volume
+    template <typename adj_matrix_t>
+    DETRAY_HOST void build(const adj_matrix_t &adj_matrix,
+                           const dindex n_volumes) {
+
+        // Contains the column for the links that leave the world
+        const dindex dim{n_volumes + 1u};
+        assert(adj_matrix.size() == static_cast<std::size_t>(dim * dim));
+
+        m_hops.assign(static_cast<std::size_t>(n_volumes) * n_volumes, hop{});
+
+        std::queue<dindex> volumes;
+        for (dindex from = 0u; from < n_volumes; ++from) {
+
+            hop *row{m_hops.data() + from * n_volumes};
+            row[from] = {from, 0u};
+
+            // The direct neighbors are their own next volume
+            for (dindex to = 0u; to < n_volumes; ++to) {
+                if (to != from && adj_matrix[dim * from + to] > 0u) {
+                    row[to] = {to, 1u};
+                    volumes.push(to);
+                }
+            }
+
+            // Any other volume is reached via the neighbor that was used to
+            // reach its predecessor
+            while (!volumes.empty()) {
+                const dindex current{volumes.front()};
+                volumes.pop();
+
+                for (dindex to = 0u; to < n_volumes; ++to) {
+                    if (row[to].n_hops == dindex_invalid &&
+                        adj_matrix[dim * current + to] > 0u) {
+                        row[to] = {row[current].next,
+                                   row[current].n_hops + 1u};
+                        volumes.push(to);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Table of size n_volumes x n_volumes, row major in the start volume
+    vector_type<hop> m_hops{};
+};
+
+}  // namespace detray
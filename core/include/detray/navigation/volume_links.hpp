@@ -0,0 +1,159 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+namespace detray {
+
+/// @brief Record of the volume behind a portal.
+///
+/// Packs the index of the next volume together with its accelerator and
+/// material links. The search in the next volume also needs the volume
+/// transform (grids) and the portal range of the volume, so these are packed,
+/// too. The record is aligned, so that a volume switch reads it with a single
+/// load and does not go through the detector volume container.
+///
+/// @tparam volume_t the volume descriptor type
+template <typename volume_t>
+struct alignas(32) portal_volume_link {
+
+    using material_link = typename volume_t::material_link;
+    using accel_link_type = typename volume_t::accel_link_type;
+    using sf_range_type = typename volume_t::sf_link_type::index_type;
+
+    /// Index of the next volume (invalid, if the portal leaves the detector)
+    dindex volume{dindex_invalid};
+    /// Index of the transform of the next volume
+    dindex transform{dindex_invalid};
+    /// Range of the portals of the next volume in the surface lookup
+    sf_range_type portals{};
+    /// Material link of the next volume
+    material_link material{};
+    /// Accelerator links of the next volume
+    accel_link_type accel{};
+    /// Shape of the next volume
+    volume_id id{volume_id::e_unknown};
+
+    /// @returns true if the portal leaves the detector
+    DETRAY_HOST_DEVICE
+    constexpr bool is_exit() const {
+        return detail::is_invalid_value(volume);
+    }
+
+    /// @returns a descriptor of the next volume that can be searched for
+    /// candidates (only the portal range is set among the surface ranges)
+    DETRAY_HOST_DEVICE
+    constexpr auto descriptor() const -> volume_t {
+        return volume_t{id, volume, transform, portals, material, accel};
+    }
+};
+
+/// @brief Table of the next volume per portal.
+///
+/// Holds one record per surface in the detector surface lookup, so that the
+/// record of a portal is found directly by its index. The records of surfaces
+/// that are not portals stay invalid, like the ones of the portals that leave
+/// the detector. After reaching a portal, the navigator reads the next volume
+/// and the links it needs to initialize the volume from a single record
+/// (@see navigator ).
+///
+/// @tparam volume_t the volume descriptor type
+/// @tparam container_t the types of underlying containers to be used.
+template <typename volume_t, typename container_t = host_container_types>
+class volume_link_table {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using record_type = portal_volume_link<volume_t>;
+
+    using view_type = dmulti_view<dvector_view<record_type>>;
+    using const_view_type = dmulti_view<dvector_view<const record_type>>;
+    using buffer_type = dmulti_buffer<dvector_buffer<record_type>>;
+
+    /// Default constructor
+    constexpr volume_link_table() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr volume_link_table(vecmem::memory_resource* resource)
+        : m_records(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr volume_link_table(vecmem::memory_resource& resource)
+        : volume_link_table(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view table_view_t>
+    DETRAY_HOST_DEVICE explicit volume_link_table(table_view_t& view)
+        : m_records(detail::get<0>(view.m_view)) {}
+
+    /// @returns the number of surfaces the table was built for
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return static_cast<size_type>(m_records.size());
+    }
+
+    /// @returns true if the table was not built
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @returns true if the table holds a record for the surface with index
+    /// @param sf_idx
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex sf_idx) const {
+        return sf_idx < size();
+    }
+
+    /// @returns the record of the volume behind the portal @param sf_idx
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex sf_idx) const -> const record_type& {
+        return m_records[sf_idx];
+    }
+
+    /// Add the record of the next surface in the detector surface lookup. The
+    /// surfaces have to be added in order of their index.
+    ///
+    /// @param record the next volume (invalid, if not a portal into a volume)
+    DETRAY_HOST void push_back(const record_type& record) {
+        m_records.push_back(record);
+    }
+
+    /// @return the view on the table - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_records)};
+    }
+
+    /// @return the view on the table - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{detray::get_data(m_records)};
+    }
+
+    private:
+    /// The record of the next volume for every surface
+    vector_type<record_type> m_records{};
+};
+
+}  // namespace detray
@@ -81,6 +81,10 @@ class actor_chain {
     private:
     /// Call the actors. Either single actor or composition.
     ///
+    /// Actors that do not apply to the current navigation state (as declared
+    /// by their trigger) are skipped. For actors that run on every step, the
+    /// check is removed at compile time.
+    ///
     /// @param actr the actor (might be a composite actor)
     /// @param states states of all actors (only bare actors)
     /// @param p_state the state of the propagator (stepper and navigator)
@@ -89,6 +93,12 @@ class actor_chain {
     DETRAY_HOST_DEVICE inline void run(const actor_t &actr,
                                        actor_states_t &states,
                                        propagator_state_t &p_state) const {
+        if constexpr (actor_t::trigger != actor_trigger::e_every_step) {
+            if (!detail::is_triggered<actor_t::trigger>(p_state._navigation)) {
+                return;
+            }
+        }
+
         if constexpr (!typename actor_t::is_comp_actor()) {
             // No actor state defined (empty)
             if constexpr (std::same_as<typename actor_t::state,
@@ -111,7 +121,27 @@ class actor_chain {
     DETRAY_HOST_DEVICE inline void run(
         actor_states_t &states, propagator_state_t &p_state,
         std::index_sequence<indices...> /*ids*/) const {
-        (run(detail::get<indices>(m_actors), states, p_state), ...);
+        (run_timed<indices>(detail::get<indices>(m_actors), states, p_state),
+         ...);
+    }
+
+    /// Call the actor at position @tparam I in the chain and add the time
+    /// it took to the timer of the propagation, if there is one
+    /// (@see propagation::phase_timer )
+    template <std::size_t I, concepts::actor actor_t, typename actor_states_t,
+              typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void run_timed(
+        const actor_t &actr, actor_states_t &states,
+        propagator_state_t &p_state) const {
+        if constexpr (requires(propagator_state_t & s) {
+                          s._timer.stop_actor(I, s._timer.start());
+                      }) {
+            const auto t0 = p_state._timer.start();
+            run(actr, states, p_state);
+            p_state._timer.stop_actor(I, t0);
+        } else {
+            run(actr, states, p_state);
+        }
     }
 
     /// @returns a tuple of reference for every state in the tuple @param t
@@ -11,7 +11,11 @@
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/actors/aborters.hpp"
 #include "detray/propagator/actors/barcode_sequencer.hpp"
+#include "detray/propagator/actors/looper_aborter.hpp"
 #include "detray/propagator/actors/parameter_resetter.hpp"
 #include "detray/propagator/actors/parameter_transporter.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/actors/step_budget_aborter.hpp"
+#include "detray/propagator/actors/trajectory_recorder.hpp"
+#include "detray/propagator/actors/volume_material_integrator.hpp"
 #include "detray/propagator/concepts.hpp"
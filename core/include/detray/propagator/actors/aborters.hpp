@@ -133,6 +133,9 @@ struct momentum_aborter : actor {
 /// Aborter checks whether a specific surface was reached
 struct target_aborter : actor {
 
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
     /// Keeps the index for the target surface
     struct state {
         /// Unique surface id of the target
@@ -20,6 +20,9 @@ namespace detray {
 
 struct barcode_sequencer : actor {
 
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
     struct state {
 
         using sequence_t = vecmem::device_vector<detray::geometry::barcode>;
@@ -47,7 +50,7 @@ struct barcode_sequencer : actor {
             return;
         }
 
-        const auto& bcd = navigation.current().sf_desc.barcode();
+        const auto& bcd = navigation.barcode();
         assert(!bcd.is_invalid());
 
         actor_state._sequence.push_back(bcd);
@@ -0,0 +1,186 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/propagator/base_actor.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s)
+#include <cstdint>
+
+namespace detray {
+
+/// How the @c bound_state_writer finds the slot of a track state
+enum class state_slot_layout : std::uint_least8_t {
+    /// Every track owns a fixed range of @c max_states slots, starting at
+    /// @c track_index * max_states. The number of states of the track is
+    /// written to the counter of the track.
+    e_per_track = 0u,
+    /// The slots of all tracks are taken from a single atomic counter, so that
+    /// the buffer is filled densely. The track index of every state is written
+    /// alongside.
+    e_atomic = 1u,
+};
+
+/// @brief Writes the bound track states on the sensitive surfaces into a
+/// preallocated buffer.
+///
+/// The bound parameters, the covariance, the surface index and the path length
+/// are written in separate columns (structure of arrays), which can live in
+/// host or device memory. No memory is allocated during the propagation.
+///
+/// @note The bound parameters are only up to date on the surface, if the
+/// writer runs after the @c parameter_transporter in the actor chain.
+///
+/// @tparam algebra_t the algebra type of the track
+/// @tparam layout how the slots are assigned to the track states
+template <concepts::algebra algebra_t,
+          state_slot_layout layout = state_slot_layout::e_per_track>
+struct bound_state_writer : actor {
+
+    using scalar_type = dscalar<algebra_t>;
+    using vector_type = bound_vector<algebra_t>;
+    using matrix_type = bound_matrix<algebra_t>;
+    using counter_type = unsigned int;
+
+    /// Only acts on sensitive surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_sensitive};
+
+    /// Views of the columns of the output buffer. All columns, except for the
+    /// counters, need to hold the same number of slots.
+    struct buffer_view {
+        dvector_view<vector_type> params{};
+        dvector_view<matrix_type> covariances{};
+        dvector_view<dindex> surface_indices{};
+        dvector_view<scalar_type> path_lengths{};
+        /// Only filled in the @c e_atomic layout (can be empty otherwise)
+        dvector_view<dindex> track_indices{};
+        /// One counter per track (@c e_per_track) or a single global
+        /// counter (@c e_atomic). Must be set to zero before the propagation.
+        dvector_view<counter_type> counters{};
+    };
+
+    struct state {
+
+        /// Construct from the @param view of the output buffer
+        ///
+        /// @param track_idx index of the track in the buffer
+        /// @param max_states maximal number of states per track (only used in
+        ///                   the @c e_per_track layout)
+        DETRAY_HOST_DEVICE
+        state(const buffer_view &view, const dindex track_idx,
+              const unsigned int max_states = 0u)
+            : m_view{view}, m_track_idx{track_idx}, m_max_states{max_states} {}
+
+        /// @returns the index of the track
+        DETRAY_HOST_DEVICE
+        constexpr dindex track_index() const { return m_track_idx; }
+
+        /// @returns the number of states written for this track
+        DETRAY_HOST_DEVICE
+        constexpr unsigned int n_states() const { return m_n_states; }
+
+        /// @returns true if a state did not fit into the buffer
+        DETRAY_HOST_DEVICE
+        constexpr bool overflow() const { return m_overflow; }
+
+        private:
+        friend struct bound_state_writer;
+
+        /// @returns the next free slot, or an invalid index if the buffer is
+        /// full
+        DETRAY_HOST_DEVICE dindex next_slot(const dindex capacity) {
+            vecmem::device_vector<counter_type> counters(m_view.counters);
+
+            if constexpr (layout == state_slot_layout::e_per_track) {
+                if (m_n_states >= m_max_states) {
+                    return dindex_invalid;
+                }
+                const dindex slot{m_track_idx * m_max_states + m_n_states};
+                ++m_n_states;
+                counters[m_track_idx] = m_n_states;
+
+                return slot < capacity ? slot : dindex_invalid;
+            } else {
+                const dindex slot{
+                    vecmem::device_atomic_ref<counter_type>(counters[0])
+                        .fetch_add(counter_type{1u})};
+                if (slot >= capacity) {
+                    return dindex_invalid;
+                }
+                ++m_n_states;
+
+                return slot;
+            }
+        }
+
+        buffer_view m_view{};
+        dindex m_track_idx{dindex_invalid};
+        unsigned int m_max_states{0u};
+        unsigned int m_n_states{0u};
+        bool m_overflow{false};
+    };
+
+    /// Write the bound state, if the track is on a sensitive surface
+    ///
+    /// @param writer_state contains the views of the output buffer
+    /// @param propagation state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state &writer_state, const propagator_state_t &propagation) const {
+
+        const auto &navigation = propagation._navigation;
+        const auto &stepping = propagation._stepping;
+
+        if (!navigation.is_on_sensitive()) {
+            return;
+        }
+
+        vecmem::device_vector<vector_type> params(writer_state.m_view.params);
+
+        const dindex slot{writer_state.next_slot(params.size())};
+        if (slot == dindex_invalid) {
+            writer_state.m_overflow = true;
+            return;
+        }
+
+        const auto &bound_params = stepping.bound_params();
+
+        params[slot] = bound_params.vector();
+
+        vecmem::device_vector<matrix_type> covariances(
+            writer_state.m_view.covariances);
+        covariances[slot] = bound_params.covariance();
+
+        vecmem::device_vector<dindex> sf_indices(
+            writer_state.m_view.surface_indices);
+        sf_indices[slot] = navigation.barcode().index();
+
+        vecmem::device_vector<scalar_type> paths(
+            writer_state.m_view.path_lengths);
+        paths[slot] = stepping.path_length();
+
+        if constexpr (layout == state_slot_layout::e_atomic) {
+            vecmem::device_vector<dindex> trk_indices(
+                writer_state.m_view.track_indices);
+            trk_indices[slot] = writer_state.m_track_idx;
+        }
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,226 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/propagator/base_actor.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s)
+#include <cstdint>
+
+namespace detray {
+
+/// Reasons for which the @c looper_aborter stopped a track
+///
+/// The global counter of @c e_none holds the total number of aborted tracks
+enum class looper_reason : std::uint_least8_t {
+    e_none = 0u,
+    /// The same surface was reached too often
+    e_surface_revisit = 1u,
+    /// The track direction turned by more than the maximal angle
+    e_turning_angle = 2u,
+    e_size = 3u,
+};
+
+/// @brief Aborter that stops low momentum tracks which loop in the detector.
+///
+/// A track is considered a looper, if it reaches the same surface more than
+/// @c max_surface_visits times, or if its direction turned by more than
+/// @c max_turning_angle in total (the angles between the directions of
+/// consecutive steps are accumulated). Such tracks would otherwise only be
+/// stopped at the path limit, after many steps.
+///
+/// The number of aborted tracks per @c looper_reason can be added atomically
+/// to a global counter buffer, so that the loopers of many tracks in parallel
+/// (e.g. on device) can be monitored.
+///
+/// @tparam algebra_t the algebra type of the track
+/// @tparam k_n_surfaces number of recently reached surfaces that are kept
+template <concepts::algebra algebra_t, std::size_t k_n_surfaces = 8u>
+struct looper_aborter : actor {
+
+    using scalar_type = dscalar<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using counter_type = unsigned long long int;
+    using view_type = dvector_view<counter_type>;
+
+    /// Number of global counters (one per @c looper_reason )
+    static constexpr unsigned int n_counters{
+        static_cast<unsigned int>(looper_reason::e_size)};
+
+    struct state {
+
+        /// Default constructor: no global counters
+        constexpr state() = default;
+
+        /// Construct from the @param view of the global counter buffer, which
+        /// needs to hold @c n_counters elements
+        DETRAY_HOST_DEVICE
+        explicit state(view_type view) : m_global{view} {}
+
+        /// Set the maximal number of times a surface can be reached to @param n
+        DETRAY_HOST_DEVICE
+        constexpr void max_surface_visits(const unsigned int n) {
+            m_max_visits = n;
+        }
+
+        /// @returns the maximal number of times a surface can be reached
+        DETRAY_HOST_DEVICE
+        constexpr unsigned int max_surface_visits() const {
+            return m_max_visits;
+        }
+
+        /// Set the maximal total turning angle to @param a
+        DETRAY_HOST_DEVICE
+        constexpr void max_turning_angle(const scalar_type a) {
+            m_max_angle = a;
+        }
+
+        /// @returns the maximal total turning angle
+        DETRAY_HOST_DEVICE
+        constexpr scalar_type max_turning_angle() const { return m_max_angle; }
+
+        /// @returns the total turning angle of the track so far
+        DETRAY_HOST_DEVICE
+        constexpr scalar_type turning_angle() const { return m_angle; }
+
+        /// @returns why the track was aborted (@c e_none if it was not)
+        DETRAY_HOST_DEVICE
+        constexpr looper_reason reason() const { return m_reason; }
+
+        /// @returns true if the track was aborted as a looper
+        DETRAY_HOST_DEVICE
+        constexpr bool is_looper() const {
+            return m_reason != looper_reason::e_none;
+        }
+
+        private:
+        friend struct looper_aborter;
+
+        /// Count a visit of the surface @param bcd
+        ///
+        /// @returns the number of times the surface was reached
+        DETRAY_HOST_DEVICE
+        constexpr unsigned int visit(const geometry::barcode bcd,
+                                     const scalar_type path) {
+            for (std::size_t i = 0u; i < k_n_surfaces; ++i) {
+                if (m_surfaces[i] == bcd) {
+                    // Same surface as in the previous call (e.g. a portal
+                    // is reported before and after the volume switch)
+                    if (math::fabs(path - m_paths[i]) < min_path) {
+                        return m_visits[i];
+                    }
+                    m_paths[i] = path;
+                    return ++m_visits[i];
+                }
+            }
+            // Replace the oldest entry
+            m_surfaces[m_next] = bcd;
+            m_paths[m_next] = path;
+            m_visits[m_next] = 1u;
+            m_next = (m_next + 1u) % k_n_surfaces;
+
+            return 1u;
+        }
+
+        /// Mark the track as looper and add it to the global counter
+        DETRAY_HOST_DEVICE void abort(const looper_reason r) {
+            m_reason = r;
+
+            if (m_global.size() < n_counters) {
+                return;
+            }
+
+            vecmem::device_vector<counter_type> global(m_global);
+            vecmem::device_atomic_ref<counter_type>(global[0]).fetch_add(
+                counter_type{1u});
+            vecmem::device_atomic_ref<counter_type>(
+                global[static_cast<unsigned int>(r)])
+                .fetch_add(counter_type{1u});
+        }
+
+        /// Minimal path between two visits of the same surface
+        static constexpr scalar_type min_path{1.f * unit<scalar_type>::mm};
+
+        /// Configuration
+        unsigned int m_max_visits{2u};
+        scalar_type m_max_angle{4.f * constant<scalar_type>::pi};
+
+        /// Recently reached surfaces, their visit count and path length
+        darray<geometry::barcode, k_n_surfaces> m_surfaces{};
+        darray<unsigned int, k_n_surfaces> m_visits{};
+        darray<scalar_type, k_n_surfaces> m_paths{};
+        std::size_t m_next{0u};
+
+        /// Turning angle accumulation
+        vector3_type m_prev_dir{0.f, 0.f, 0.f};
+        scalar_type m_angle{0.f};
+
+        looper_reason m_reason{looper_reason::e_none};
+
+        /// Global counter buffer
+        view_type m_global{};
+    };
+
+    /// Check whether the track is looping
+    ///
+    /// @param abrt_state contains the looper limits
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        const auto &stepping = prop_state._stepping;
+        auto &navigation = prop_state._navigation;
+
+        // Nothing left to do. Propagation will exit successfully
+        if (navigation.is_complete() || abrt_state.is_looper()) {
+            return;
+        }
+
+        // Accumulate the turning angle
+        const vector3_type &dir = stepping().dir();
+        if (vector::norm(abrt_state.m_prev_dir) > 0.f) {
+            const scalar_type cos_a{vector::dot(abrt_state.m_prev_dir, dir)};
+            abrt_state.m_angle += math::acos(
+                math::max(math::min(cos_a, scalar_type{1}), scalar_type{-1}));
+        }
+        abrt_state.m_prev_dir = dir;
+
+        if (abrt_state.m_angle > abrt_state.max_turning_angle()) {
+            abrt_state.abort(looper_reason::e_turning_angle);
+            prop_state._heartbeat &=
+                navigation.abort("Aborter: Looper (turning angle)");
+            return;
+        }
+
+        // Count the surface visits
+        if (navigation.is_on_surface()) {
+            const unsigned int n_visits{abrt_state.visit(
+                navigation.barcode(), stepping.abs_path_length())};
+
+            if (n_visits > abrt_state.max_surface_visits()) {
+                abrt_state.abort(looper_reason::e_surface_revisit);
+                prop_state._heartbeat &=
+                    navigation.abort("Aborter: Looper (surface revisit)");
+            }
+        }
+    }
+};
+
+}  // namespace detray
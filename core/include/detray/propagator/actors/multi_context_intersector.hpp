@@ -0,0 +1,197 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/tracks/ray.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+namespace detray {
+
+/// @brief Re-evaluates the surfaces of a propagation in further geometry
+/// contexts.
+///
+/// Alignment studies propagate the same track through many geometry contexts
+/// that differ only by small shifts of the surface placements. Instead of a
+/// full propagation per context, the track is propagated once in the context
+/// of the propagation state and the navigation decisions are shared: On every
+/// sensitive surface and every surface with material that the track reaches
+/// (the same surfaces as the @c trajectory_recorder ), the surface is
+/// intersected again with the transform of each of the @tparam n_contexts
+/// additional contexts. The resulting path length and local position are
+/// recorded per context.
+///
+/// A context diverges when the shared navigation no longer holds for it, i.e.
+/// when the surface is missed in that context or when the order of the
+/// surfaces along the track changes. Diverged contexts are not evaluated
+/// further and their records have to be discarded: The order change is only
+/// detected on the surface after the swap. These contexts need to be
+/// propagated separately by the caller.
+///
+/// @note the distance to the surface in a context is measured along the
+/// tangent of the track at the nominal intersection, which is exact for
+/// straight line propagation and a good approximation for small
+/// misalignments in a magnetic field.
+template <typename detector_t, std::size_t n_contexts>
+struct multi_context_intersector : actor {
+
+    static_assert(n_contexts > 0u, "Needs at least one context");
+    static_assert(n_contexts <= 32u,
+                  "Context mask can hold at most 32 contexts");
+
+    using algebra_type = typename detector_t::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using point3_type = dpoint3D<algebra_type>;
+    using context_type = typename detector_t::geometry_context;
+    /// Debug intersection, which holds the local position
+    using intersection_type =
+        intersection2D<typename detector_t::surface_type, algebra_type, true>;
+
+    /// Bitmask type that flags the diverged contexts
+    using context_mask_type = std::uint32_t;
+
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    /// The surface as seen in one of the contexts
+    struct record {
+        /// The surface that was reached
+        geometry::barcode barcode{};
+        /// Position of the context in the actor state
+        dindex context_idx{detail::invalid_value<dindex>()};
+        /// Path length of the track up to the surface in the context
+        scalar_type path_length{detail::invalid_value<scalar_type>()};
+        /// Local position on the surface in the context
+        point3_type local{};
+    };
+
+    struct state {
+
+        using sequence_t = vecmem::device_vector<record>;
+
+        /// Constructor with the contexts to evaluate and the vector of
+        /// records
+        DETRAY_HOST_DEVICE
+        state(const darray<context_type, n_contexts> &ctxs, sequence_t seq)
+            : _contexts(ctxs), _sequence(seq) {}
+
+        /// @returns true if the navigation diverged in context @param i
+        DETRAY_HOST_DEVICE
+        constexpr bool is_diverged(const std::size_t i) const {
+            assert(i < n_contexts);
+            return (_diverged >> i) & 1u;
+        }
+
+        /// @returns the number of diverged contexts
+        DETRAY_HOST_DEVICE
+        constexpr std::size_t n_diverged() const {
+            std::size_t n{0u};
+            for (std::size_t i = 0u; i < n_contexts; ++i) {
+                n += is_diverged(i) ? 1u : 0u;
+            }
+            return n;
+        }
+
+        /// The contexts in which to re-evaluate the surfaces
+        darray<context_type, n_contexts> _contexts;
+        /// The records of all contexts, in the order of the surfaces
+        sequence_t _sequence;
+        /// Mask tolerance that decides whether a surface was missed
+        scalar_type mask_tolerance{1.f * unit<scalar_type>::um};
+        bool overflow = false;
+
+        /// Contexts in which the shared navigation no longer holds
+        context_mask_type _diverged{0u};
+        /// Path length of the last surface per context
+        darray<scalar_type, n_contexts> _path_lengths{};
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &actor_state,
+                                       propagator_state_t &propagation) const {
+
+        const auto &navigation = propagation._navigation;
+        const auto &stepping = propagation._stepping;
+
+        if (!(navigation.is_on_sensitive() ||
+              navigation.encountered_sf_material())) {
+            return;
+        }
+
+        const auto &det = navigation.detector();
+        const auto sf = navigation.get_surface();
+
+        // Tangent to the trajectory in the direction of the navigation
+        const detail::ray<algebra_type> tangent(
+            stepping().pos(),
+            static_cast<scalar_type>(navigation.direction()) *
+                stepping().dir());
+
+        // The surfaces may lie before the current position in some contexts
+        constexpr scalar_type no_cutoff{
+            -std::numeric_limits<scalar_type>::max()};
+
+        for (std::size_t i = 0u; i < n_contexts; ++i) {
+            if (actor_state.is_diverged(i)) {
+                continue;
+            }
+
+            intersection_type sfi{};
+            sfi.sf_desc = sf.descriptor();
+
+            const bool is_inside =
+                sf.template visit_mask<intersection_update<ray_intersector>>(
+                    tangent, sfi, det.transform_store(),
+                    actor_state._contexts[i],
+                    darray<scalar_type, 2>{actor_state.mask_tolerance,
+                                           actor_state.mask_tolerance},
+                    static_cast<scalar_type>(0.f), no_cutoff);
+
+            const scalar_type path_length{stepping.abs_path_length() +
+                                          sfi.path};
+
+            // The track misses the surface or passes the surfaces in a
+            // different order: The navigation has to be redone
+            if (!is_inside || path_length < actor_state._path_lengths[i]) {
+                actor_state._diverged |= (context_mask_type{1u} << i);
+                continue;
+            }
+            actor_state._path_lengths[i] = path_length;
+
+            if (actor_state._sequence.size() ==
+                actor_state._sequence.capacity()) {
+                actor_state.overflow = true;
+                continue;
+            }
+
+            actor_state._sequence.push_back(
+                {sf.barcode(), static_cast<dindex>(i), path_length,
+                 sfi.local});
+        }
+    }
+};
+
+}  // namespace detray
@@ -19,6 +19,9 @@ namespace detray {
 template <concepts::algebra algebra_t>
 struct parameter_resetter : actor {
 
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
     template <typename propagator_state_t>
     DETRAY_HOST_DEVICE void operator()(propagator_state_t& propagation) const {
 
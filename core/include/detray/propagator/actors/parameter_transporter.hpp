@@ -14,6 +14,7 @@
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/tracks/detail/packed_covariance.hpp"
 
 namespace detray {
 
@@ -31,6 +32,9 @@ struct parameter_transporter : actor {
     using bound_to_free_matrix_t = bound_to_free_matrix<algebra_t>;
     /// @}
 
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
     struct get_full_jacobian_kernel {
 
         template <typename mask_group_t, typename index_t,
@@ -47,7 +51,6 @@ struct parameter_transporter : actor {
 
             using jacobian_engine_t = detail::jacobian_engine<frame_t>;
 
-            using free_matrix_t = free_matrix<algebra_t>;
             using free_to_bound_matrix_t =
                 typename jacobian_engine_t::free_to_bound_matrix_type;
 
@@ -55,18 +58,11 @@ struct parameter_transporter : actor {
             const free_to_bound_matrix_t free_to_bound_jacobian =
                 jacobian_engine_t::free_to_bound_jacobian(trf3, stepping());
 
-            // Path correction factor
-            const free_matrix_t path_correction =
-                jacobian_engine_t::path_correction(
-                    stepping().pos(), stepping().dir(), stepping.dtds(),
-                    stepping.dqopds(vol_mat_ptr), trf3);
-
-            const free_matrix_t correction_term =
-                matrix::identity<free_matrix_t>() + path_correction;
-
-            return free_to_bound_jacobian *
-                   (correction_term *
-                    (stepping.transport_jacobian() * bound_to_free_jacobian));
+            // Includes the path correction at the destination surface
+            return jacobian_engine_t::bound_to_bound_jacobian(
+                free_to_bound_jacobian, stepping.transport_jacobian(),
+                bound_to_free_jacobian, stepping().pos(), stepping().dir(),
+                stepping.dtds(), stepping.dqopds(vol_mat_ptr), trf3);
         }
     };
 
@@ -98,11 +94,7 @@ struct parameter_transporter : actor {
             const auto full_jacobian = get_full_jacobian(propagation);
 
             // Calculate surface-to-surface covariance transport
-            const bound_matrix_t new_cov = full_jacobian *
-                                           bound_params.covariance() *
-                                           matrix::transpose(full_jacobian);
-
-            stepping.bound_params().set_covariance(new_cov);
+            transport_covariance(full_jacobian, bound_params);
         }
 
         // Convert free to bound vector
@@ -115,6 +107,20 @@ struct parameter_transporter : actor {
         assert(!bound_params.is_invalid());
     }
 
+    /// Transport the covariance of @param bound_params with the full jacobian
+    /// @param J, i.e. C' = J * C * J^T
+    ///
+    /// Only the upper triangle of the symmetric result is computed. This works
+    /// on the full and the packed covariance storage alike, without unpacking
+    template <typename bound_params_t>
+    DETRAY_HOST_DEVICE static inline void transport_covariance(
+        const bound_matrix_t& J, bound_params_t& bound_params) {
+        // The input is fully read before the output is written
+        detail::symmetric_transport<algebra_t>(
+            J, bound_params.covariance_storage(),
+            bound_params.covariance_storage());
+    }
+
     template <typename propagator_state_t>
     DETRAY_HOST_DEVICE inline bound_matrix_t get_full_jacobian(
         propagator_state_t& propagation) const {
@@ -14,6 +14,8 @@
 #include "detray/materials/detail/concepts.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/geometry_utils.hpp"
@@ -28,9 +30,40 @@ struct pointwise_material_interactor : actor {
     using vector3_type = dvector3D<algebra_t>;
     using transform3_type = dtransform3D<algebra_t>;
     using interaction_type = interaction<scalar_type>;
+    using interaction_table_type = interaction_table<scalar_type>;
     using bound_param_vector_type = bound_parameters_vector<algebra_t>;
     using bound_matrix_type = bound_matrix<algebra_t>;
 
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    /// Material quantities of the last interaction of a track that do not
+    /// depend on the path length through the material
+    struct material_cache {
+        /// Whether the cache holds data
+        bool is_valid{false};
+        /// Material of the last interaction
+        material<scalar_type> mat{};
+        /// q/p of the track at the last interaction
+        scalar_type qop{0.f};
+        /// Relativistic quantities of the track at the last interaction
+        detail::relativistic_quantities<scalar_type> rq{};
+        /// Mean energy loss per unit length (Bethe-Bloch)
+        scalar_type e_loss_per_length{0.f};
+        /// Sigma of qoverp (Landau) per unit length
+        scalar_type sigma_qop_per_length{0.f};
+
+        /// @returns whether the cache can be used for the material @param m
+        /// and q/p value @param q, given a relative tolerance @param tol
+        DETRAY_HOST_DEVICE
+        constexpr bool matches(const material<scalar_type> &m,
+                               const scalar_type q,
+                               const scalar_type tol) const {
+            return is_valid && math::fabs(q - qop) <= tol * math::fabs(qop) &&
+                   m == mat && m.molar_density() == mat.molar_density();
+        }
+    };
+
     struct state {
 
         /// Evaluated energy loss
@@ -44,6 +77,33 @@ struct pointwise_material_interactor : actor {
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
 
+        /// Reuse the material quantities of the previous interaction, if the
+        /// track traverses the same material again and the relative change of
+        /// its q/p is below this value (a value of zero disables the cache)
+        scalar_type max_rel_qop_change{0.f};
+        /// The quantities of the previous interaction
+        material_cache cache{};
+
+        /// Optional precomputed tables that are used instead of the analytic
+        /// formulas for the materials and particle species they cover
+        const interaction_table_type *tables{nullptr};
+        /// Number of tables
+        unsigned int n_tables{0u};
+
+        /// @returns the table for the material @param mat and particle
+        /// @param ptc, if any
+        DETRAY_HOST_DEVICE
+        const interaction_table_type *find_table(
+            const material<scalar_type> &mat,
+            const pdg_particle<scalar_type> &ptc) const {
+            for (unsigned int i = 0u; i < n_tables; ++i) {
+                if (tables[i].matches(mat, ptc)) {
+                    return &tables[i];
+                }
+            }
+            return nullptr;
+        }
+
         DETRAY_HOST_DEVICE
         void reset() {
             e_loss = 0.f;
@@ -87,6 +147,21 @@ struct pointwise_material_interactor : actor {
                 const scalar_type path_segment{
                     mat.path_segment(cos_inc_angle, approach)};
 
+                if (s.n_tables > 0u &&
+                    tabulated_interaction(mat.get_material(), s, ptc, qop,
+                                          path_segment,
+                                          mat.path_segment_in_X0(
+                                              cos_inc_angle, approach))) {
+                    return true;
+                }
+
+                if (s.max_rel_qop_change > 0.f) {
+                    return cached_interaction(mat.get_material(), s, ptc, qop,
+                                              path_segment,
+                                              mat.path_segment_in_X0(
+                                                  cos_inc_angle, approach));
+                }
+
                 detail::relativistic_quantities rq(ptc, qop);
 
                 // Energy Loss
@@ -121,6 +196,78 @@ struct pointwise_material_interactor : actor {
                 return false;
             }
         }
+
+        private:
+        /// Evaluate the material interaction from a precomputed table
+        ///
+        /// @returns false if no table covers the material or the momentum
+        DETRAY_HOST_DEVICE inline bool tabulated_interaction(
+            const material<scalar_type> &mat, state &s,
+            const pdg_particle<scalar_type> &ptc, const scalar_type qop,
+            const scalar_type path_segment,
+            const scalar_type path_segment_in_X0) const {
+
+            const interaction_table_type *table{s.find_table(mat, ptc)};
+
+            typename interaction_table_type::values v{};
+            if (table == nullptr || !table->lookup(qop, v)) {
+                return false;
+            }
+
+            if (s.do_energy_loss) {
+                s.e_loss = path_segment * v.stopping_power;
+            }
+            if (s.do_energy_loss && s.do_covariance_transport) {
+                s.sigma_qop = path_segment * v.sigma_qop_per_length;
+            }
+            if (s.do_multiple_scattering) {
+                s.projected_scattering_angle =
+                    table->theta0(v, path_segment_in_X0);
+            }
+
+            return true;
+        }
+
+        /// Evaluate the material interaction through the per-track cache
+        ///
+        /// The energy loss and its sigma scale linearly with the path length
+        /// through the material, so that only multiple scattering has to be
+        /// evaluated again when the cache is used.
+        DETRAY_HOST_DEVICE inline bool cached_interaction(
+            const material<scalar_type> &mat, state &s,
+            const pdg_particle<scalar_type> &ptc, const scalar_type qop,
+            const scalar_type path_segment,
+            const scalar_type path_segment_in_X0) const {
+
+            auto &cache = s.cache;
+
+            if (!cache.matches(mat, qop, s.max_rel_qop_change)) {
+                cache.is_valid = true;
+                cache.mat = mat;
+                cache.qop = qop;
+                cache.rq = detail::relativistic_quantities(ptc, qop);
+                cache.e_loss_per_length =
+                    interaction_type().compute_energy_loss_bethe_bloch(
+                        1.f, mat, ptc, cache.rq);
+                cache.sigma_qop_per_length =
+                    interaction_type().compute_energy_loss_landau_sigma_QOverP(
+                        1.f, mat, ptc, cache.rq);
+            }
+
+            if (s.do_energy_loss) {
+                s.e_loss = path_segment * cache.e_loss_per_length;
+            }
+            if (s.do_energy_loss && s.do_covariance_transport) {
+                s.sigma_qop = path_segment * cache.sigma_qop_per_length;
+            }
+            if (s.do_multiple_scattering) {
+                s.projected_scattering_angle =
+                    interaction_type().compute_multiple_scattering_theta0(
+                        path_segment_in_X0, ptc, cache.rq);
+            }
+
+            return true;
+        }
     };
 
     template <typename propagator_state_t>
@@ -0,0 +1,190 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/navigation/counting_inspector.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+/// Cost record of the propagation of a single track
+struct track_cost {
+    /// Accepted steps of the stepper
+    unsigned int n_steps{0u};
+    /// Step trials that were rejected by the adaptive step size control
+    unsigned int n_rejected_steps{0u};
+    /// Reinitializations of the navigation (without the first one)
+    unsigned int n_reinit{0u};
+    /// Sum of the candidates that were held in the navigation cache after
+    /// the navigation updates
+    unsigned int n_candidates{0u};
+    /// Whether the track was stopped by the step budget
+    bool is_over_budget{false};
+};
+
+/// @brief Aborter that stops a track after a maximal number of steps and
+/// keeps the cost record of the track.
+///
+/// In contrast to the path limit, the step budget caps the time that is
+/// spent on a single track, e.g. on tracks that are stuck in a tight helix or
+/// in a dense region of the geometry. The cost record counts the steps and
+/// the rejected adaptive step trials of the track. If the navigator uses the
+/// @c navigation::counting_inspector , the reinitializations of the
+/// navigation and the number of candidates are recorded, too.
+///
+/// Optionally, the steps can be added atomically per volume to a global
+/// counter buffer, in order to find the geometry regions that are most
+/// expensive to navigate. The steps are only added when the track leaves a
+/// volume or when the propagation ends.
+///
+/// @note The actor should run last in the actor chain, so that it sees the
+/// propagation end, when another actor aborts the track.
+struct step_budget_aborter : actor {
+
+    using counter_type = unsigned long long int;
+    using view_type = dvector_view<counter_type>;
+
+    struct state {
+
+        /// Default constructor: no per-volume counters
+        constexpr state() = default;
+
+        /// Construct from the @param view of the global step counters, which
+        /// needs to hold one element per detector volume
+        DETRAY_HOST_DEVICE
+        explicit state(view_type view) : m_volume_steps{view} {}
+
+        /// Set the maximal number of steps to @param n
+        DETRAY_HOST_DEVICE
+        constexpr void max_steps(const unsigned int n) { m_max_steps = n; }
+
+        /// @returns the maximal number of steps
+        DETRAY_HOST_DEVICE
+        constexpr unsigned int max_steps() const { return m_max_steps; }
+
+        /// @returns the cost record of the track
+        DETRAY_HOST_DEVICE
+        constexpr const track_cost &cost() const { return m_cost; }
+
+        private:
+        friend struct step_budget_aborter;
+
+        /// Add the steps taken in the current volume to the global counters
+        DETRAY_HOST_DEVICE void flush_volume_steps() {
+            const unsigned int n{m_cost.n_steps - m_volume_start};
+            m_volume_start = m_cost.n_steps;
+
+            if (n == 0u || m_volume >= m_volume_steps.size()) {
+                return;
+            }
+
+            vecmem::device_vector<counter_type> volume_steps(m_volume_steps);
+            vecmem::device_atomic_ref<counter_type>(volume_steps[m_volume])
+                .fetch_add(static_cast<counter_type>(n));
+        }
+
+        /// Configuration
+        unsigned int m_max_steps{std::numeric_limits<unsigned int>::max()};
+
+        /// Cost of the current track
+        track_cost m_cost{};
+        /// Whether the first actor call (after the initialization) was seen
+        bool m_is_started{false};
+        /// Whether the steps were added to the global counters at the end
+        bool m_is_finished{false};
+
+        /// Current volume and step count when it was entered
+        dindex m_volume{detail::invalid_value<dindex>()};
+        unsigned int m_volume_start{0u};
+
+        /// Global step counters per volume
+        view_type m_volume_steps{};
+    };
+
+    /// Count the step and enforce the step budget
+    ///
+    /// @param abrt_state contains the step budget and the cost record
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state &abrt_state,
+                                       propagator_state_t &prop_state) const {
+        const auto &stepping = prop_state._stepping;
+        auto &nav_state = prop_state._navigation;
+        track_cost &cost = abrt_state.m_cost;
+
+        if (abrt_state.m_is_finished) {
+            return;
+        }
+
+        // The first call follows the navigation initialization: no step yet
+        if (abrt_state.m_is_started) {
+            ++cost.n_steps;
+        }
+        abrt_state.m_is_started = true;
+
+        // Steppers without step size control count one trial per step
+        const auto n_trials{
+            static_cast<unsigned int>(stepping.n_total_trials())};
+        cost.n_rejected_steps =
+            n_trials > cost.n_steps ? n_trials - cost.n_steps : 0u;
+
+        using inspector_t =
+            std::remove_cvref_t<decltype(nav_state.inspector())>;
+        if constexpr (std::is_same_v<inspector_t,
+                                     navigation::counting_inspector>) {
+            using enum navigation::counter;
+            const auto &insp = nav_state.inspector();
+            const unsigned int n_init{insp.count(e_init)};
+
+            cost.n_reinit = n_init > 0u ? n_init - 1u : 0u;
+            cost.n_candidates = insp.count(e_cached_candidates);
+        }
+
+        // Steps per volume
+        if (nav_state.volume() != abrt_state.m_volume) {
+            abrt_state.flush_volume_steps();
+            abrt_state.m_volume = nav_state.volume();
+        }
+
+        // Nothing left to do. Propagation will exit
+        if (nav_state.is_complete() || !nav_state.is_alive() ||
+            !prop_state.is_alive()) {
+            abrt_state.flush_volume_steps();
+            abrt_state.m_is_finished = true;
+            return;
+        }
+
+        // Check the step budget
+        if (cost.n_steps >= abrt_state.max_steps()) {
+            cost.is_over_budget = true;
+
+            // Stop navigation
+            prop_state._heartbeat &=
+                nav_state.abort("Aborter: Step budget exhausted");
+
+            abrt_state.flush_volume_steps();
+            abrt_state.m_is_finished = true;
+        }
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,71 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/detail/trajectory_point.hpp"
+#include "detray/propagator/base_actor.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+
+namespace detray {
+
+/// @brief Records the trajectory of a track for a later replay
+///
+/// Records the surface index and path length of every sensitive surface and
+/// every surface with material that the track reaches (the same surfaces as
+/// the @c barcode_sequencer ). The record can be replayed, forward or
+/// backward, by a @c direct_navigator with the
+/// @c navigation::sequence_type::e_trajectory sequence type, e.g. in the
+/// refits of a track fit.
+struct trajectory_recorder : actor {
+
+    /// Only acts on surfaces
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    struct state {
+
+        using sequence_t = vecmem::device_vector<navigation::trajectory_point>;
+        sequence_t _sequence;
+        bool overflow = false;
+
+        /// Constructor with the vector of trajectory points
+        DETRAY_HOST_DEVICE
+        explicit state(sequence_t seq) : _sequence(seq) {}
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state& actor_state,
+                                       propagator_state_t& propagation) const {
+
+        const auto& navigation = propagation._navigation;
+
+        if (!(navigation.is_on_sensitive() ||
+              navigation.encountered_sf_material())) {
+            return;
+        }
+
+        if (actor_state._sequence.size() == actor_state._sequence.capacity()) {
+            actor_state.overflow = true;
+            return;
+        }
+
+        const auto& bcd = navigation.barcode();
+        assert(!bcd.is_invalid());
+
+        actor_state._sequence.push_back(
+            {bcd.index(),
+             static_cast<float>(propagation._stepping.path_length())});
+
+        return;
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,128 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/materials/detail/concepts.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/materials/volume_material_integral.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+namespace detray {
+
+/// @brief Actor that integrates the volume material along the track.
+///
+/// After every step, the material of the volume in which the step was taken
+/// is integrated along the chord of the step: Homogeneous volume material is
+/// weighted with the chord length, while 3D volume material maps are
+/// integrated bin by bin (@see integrate_material ). Volumes without material
+/// only add to the path. The steppers still use the volume material at their
+/// evaluation points for the energy loss, the integral gives the material
+/// budget of the track, e.g. for the extension of muon and electron tracks
+/// through the calorimeters.
+template <concepts::algebra algebra_t>
+struct volume_material_integrator : actor {
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using integral_type = volume_material_integral<scalar_type>;
+
+    struct state {
+
+        /// @returns the material along the track so far
+        DETRAY_HOST_DEVICE
+        constexpr const integral_type &integral() const { return m_integral; }
+
+        /// Start over for a new track
+        DETRAY_HOST_DEVICE
+        constexpr void reset() { *this = state{}; }
+
+        private:
+        friend struct volume_material_integrator;
+
+        /// Material along the track
+        integral_type m_integral{};
+        /// Start position of the current step
+        point3_type m_pos{};
+        /// Volume in which the current step is taken
+        dindex m_volume{detail::invalid_value<dindex>()};
+    };
+
+    /// Integrate the volume material along a step (called on the material
+    /// group of the volume)
+    struct integrate_step {
+
+        template <typename mat_group_t, typename index_t>
+        DETRAY_HOST_DEVICE inline void operator()(
+            const mat_group_t &material_group, const index_t &mat_index,
+            const transform3_type &trf, const point3_type &pos,
+            const vector3_type &dir, const scalar_type length,
+            integral_type &integral) const {
+
+            using material_t = typename mat_group_t::value_type;
+
+            if constexpr (concepts::volume_material<material_t>) {
+
+                if constexpr (concepts::homogeneous_material<material_t>) {
+                    // Homogeneous volume material
+                    integral.add(material_group[mat_index], length);
+                } else {
+                    // Volume material maps
+                    integral += integrate_material(material_group[mat_index],
+                                                   trf, pos, dir, length);
+                }
+            }
+        }
+    };
+
+    /// Integrate the volume material along the last step
+    ///
+    /// @param integrator_state contains the material along the track
+    /// @param prop_state state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state &integrator_state, propagator_state_t &prop_state) const {
+
+        const auto &navigation = prop_state._navigation;
+        const point3_type pos{prop_state._stepping().pos()};
+
+        // The first call follows the navigation initialization: no step yet
+        if (!detail::is_invalid_value(integrator_state.m_volume)) {
+            const vector3_type chord{pos - integrator_state.m_pos};
+            const scalar_type length{vector::norm(chord)};
+
+            if (length > 0.f) {
+                const tracking_volume vol{navigation.detector(),
+                                          integrator_state.m_volume};
+                if (vol.has_material()) {
+                    vol.template visit_material<integrate_step>(
+                        vol.transform(), integrator_state.m_pos,
+                        (1.f / length) * chord, length,
+                        integrator_state.m_integral);
+                } else {
+                    integrator_state.m_integral.add(vacuum<scalar_type>{},
+                                                    length);
+                }
+            }
+        }
+
+        // Start of the next step
+        integrator_state.m_pos = pos;
+        integrator_state.m_volume = navigation.volume();
+    }
+};
+
+}  // namespace detray
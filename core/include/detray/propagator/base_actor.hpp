@@ -7,11 +7,48 @@
 
 #pragma once
 
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
 // System include(s)
+#include <cstdint>
 #include <type_traits>
 
 namespace detray {
 
+/// Navigation situations in which an actor has to be called by the actor chain
+///
+/// The triggers can be combined into a bitmask. An actor is called, if any of
+/// its triggers applies to the current navigation state.
+enum class actor_trigger : std::uint_least8_t {
+    e_never = 0u,
+    e_on_sensitive = 1u << 0u,
+    e_on_passive = 1u << 1u,
+    e_on_portal = 1u << 2u,
+    e_on_surface = e_on_sensitive | e_on_passive | e_on_portal,
+    /// The navigation was exited or aborted
+    e_on_exit = 1u << 3u,
+    /// The track is between surfaces
+    e_between_surfaces = 1u << 4u,
+    e_every_step = e_on_surface | e_on_exit | e_between_surfaces,
+};
+
+/// @returns a trigger that applies, if either @param lhs or @param rhs applies
+DETRAY_HOST_DEVICE
+constexpr actor_trigger operator|(const actor_trigger lhs,
+                                  const actor_trigger rhs) {
+    return static_cast<actor_trigger>(static_cast<std::uint_least8_t>(lhs) |
+                                      static_cast<std::uint_least8_t>(rhs));
+}
+
+/// @returns the trigger that @param lhs and @param rhs have in common
+DETRAY_HOST_DEVICE
+constexpr actor_trigger operator&(const actor_trigger lhs,
+                                  const actor_trigger rhs) {
+    return static_cast<actor_trigger>(static_cast<std::uint_least8_t>(lhs) &
+                                      static_cast<std::uint_least8_t>(rhs));
+}
+
 /// Base class actor implementation
 struct actor {
     /// Tag whether this is a composite type
@@ -19,6 +56,57 @@ struct actor {
 
     /// Defines the actors state. Hidden by actor implementations.
     struct state {};
+
+    /// When the actor needs to be called. Hidden by actor implementations.
+    static constexpr actor_trigger trigger{actor_trigger::e_every_step};
 };
 
+namespace detail {
+
+/// @returns true if the trigger @param mask includes any of @param t
+DETRAY_HOST_DEVICE
+constexpr bool has_trigger(const actor_trigger mask, const actor_trigger t) {
+    return (mask & t) != actor_trigger::e_never;
+}
+
+/// @returns whether an actor with trigger @tparam T has to be called for the
+/// navigation state @param navigation
+///
+/// Actors that run on every step do not check the navigation state at all.
+template <actor_trigger T, typename navigation_state_t>
+DETRAY_HOST_DEVICE constexpr bool is_triggered(
+    [[maybe_unused]] const navigation_state_t &navigation) {
+
+    if constexpr (T == actor_trigger::e_every_step) {
+        return true;
+    } else if constexpr (T == actor_trigger::e_never) {
+        return false;
+    } else {
+        bool triggered{false};
+        if constexpr ((T & actor_trigger::e_on_surface) ==
+                      actor_trigger::e_on_surface) {
+            triggered |= navigation.is_on_surface();
+        } else {
+            if constexpr (has_trigger(T, actor_trigger::e_on_sensitive)) {
+                triggered |= navigation.is_on_sensitive();
+            }
+            if constexpr (has_trigger(T, actor_trigger::e_on_passive)) {
+                triggered |= navigation.is_on_passive();
+            }
+            if constexpr (has_trigger(T, actor_trigger::e_on_portal)) {
+                triggered |= navigation.is_on_portal();
+            }
+        }
+        if constexpr (has_trigger(T, actor_trigger::e_between_surfaces)) {
+            triggered |= !navigation.is_on_surface();
+        }
+        if constexpr (has_trigger(T, actor_trigger::e_on_exit)) {
+            triggered |= !navigation.is_alive();
+        }
+        return triggered;
+    }
+}
+
+}  // namespace detail
+
 }  // namespace detray
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -18,8 +18,13 @@
 #include "detray/propagator/constrained_step.hpp"
 #include "detray/propagator/stepping_config.hpp"
 #include "detray/tracks/tracks.hpp"
+#include "detray/utils/compensated_sum.hpp"
 #include "detray/utils/curvilinear_frame.hpp"
 
+// System include(s).
+#include <cstdint>
+#include <type_traits>
+
 namespace detray {
 
 namespace stepping {
@@ -35,11 +40,90 @@ struct void_inspector {
     }
 };
 
+/// @brief Data of the stepping state that is only needed for the covariance
+/// transport and when the bound track parameters are requested.
+template <concepts::algebra algebra_t, bool has_jacobian = true>
+struct cold_state {
+    /// Jacobian transport matrix
+    free_matrix<algebra_t> jac_transport =
+        matrix::identity<free_matrix<algebra_t>>();
+
+    /// Bound covariance
+    bound_track_parameters<algebra_t> bound_params{};
+};
+
+/// @brief Cold state without transport jacobian
+template <concepts::algebra algebra_t>
+struct cold_state<algebra_t, false> {
+    /// Bound covariance
+    bound_track_parameters<algebra_t> bound_params{};
+};
+
+/// Where the cold part of the stepping state is kept
+enum class cold_storage : std::uint_least8_t {
+    /// The cold state is a member of the stepping state
+    e_inline = 0u,
+    /// The cold state lives in an external buffer (e.g. one entry per track
+    /// in device global memory) and is bound to the stepping state after
+    /// construction. This keeps the per-thread stepping state small.
+    e_external = 1u,
+};
+
+/// @brief Rounding error compensation of the path lengths and the position
+template <concepts::algebra algebra_t, bool with_compensation>
+struct compensation {
+    /// Compensation of the path length and the absolute path length
+    dscalar<algebra_t> path{0.f};
+    dscalar<algebra_t> abs_path{0.f};
+    /// Compensation of the position
+    dvector3D<algebra_t> pos{0.f, 0.f, 0.f};
+    /// The position the compensation belongs to. If the track position no
+    /// longer matches, it was set from outside and the compensation is stale
+    dpoint3D<algebra_t> last_pos{0.f, 0.f, 0.f};
+};
+
+/// @brief No rounding error compensation
+template <concepts::algebra algebra_t>
+struct compensation<algebra_t, false> {};
+
+/// @brief Storage options of the stepping state
+///
+/// The options are independent of each other.
+///
+/// @tparam location where the cold state is kept
+/// @tparam with_jacobian whether the state carries a transport jacobian.
+/// Without it, the stepper never evaluates the jacobian, regardless of
+/// @c stepping::config::do_covariance_transport . This is meant for use
+/// cases that only need the trajectory (e.g. simulation, seeding).
+/// @note Actors that need the jacobian (e.g. the parameter_transporter) can
+/// not be used without it.
+/// @tparam with_compensation whether the path lengths and the position are
+/// accumulated with compensated (Kahan) summation, so that they do not drift
+/// over many small steps in single precision. Costs eight scalars of state
+/// and a few additions per step.
+template <cold_storage location = cold_storage::e_inline,
+          bool with_jacobian = true, bool with_compensation = false>
+struct storage {
+    static constexpr cold_storage cold_state_location{location};
+    static constexpr bool has_transport_jacobian{with_jacobian};
+    static constexpr bool has_compensated_sum{with_compensation};
+};
+
+/// Cold state in the stepping state, with jacobian (default)
+using inline_storage = storage<>;
+/// Cold state in an external buffer, with jacobian
+using external_storage = storage<cold_storage::e_external>;
+/// Cold state in the stepping state, without jacobian
+using trajectory_only = storage<cold_storage::e_inline, false>;
+/// Cold state in the stepping state, with jacobian and compensated summation
+using compensated_storage = storage<cold_storage::e_inline, true, true>;
+
 }  // namespace stepping
 
 /// Base stepper implementation
 template <concepts::algebra algebra_t, typename constraint_t, typename policy_t,
-          typename inspector_t = stepping::void_inspector>
+          typename inspector_t = stepping::void_inspector,
+          typename storage_t = stepping::inline_storage>
 class base_stepper {
 
     public:
@@ -52,6 +136,19 @@ class base_stepper {
 
     using inspector_type = inspector_t;
     using policy_type = policy_t;
+    using storage_type = storage_t;
+
+    /// Whether the cold state is held in an external buffer
+    static constexpr bool has_external_storage{
+        storage_t::cold_state_location == stepping::cold_storage::e_external};
+    /// Whether the transport jacobian is part of the state and is evaluated
+    static constexpr bool has_transport_jacobian{
+        storage_t::has_transport_jacobian};
+    /// Whether the path lengths and the position use compensated summation
+    static constexpr bool has_compensated_sum{storage_t::has_compensated_sum};
+
+    using cold_state_type =
+        stepping::cold_state<algebra_t, has_transport_jacobian>;
 
     /// @brief State struct holding the track
     ///
@@ -63,31 +160,25 @@ class base_stepper {
         explicit state(const free_track_parameters_type &free_params)
             : m_track(free_params) {
 
-            curvilinear_frame<algebra_t> cf(free_params);
-
-            // Set bound track parameters
-            m_bound_params.set_parameter_vector(cf.m_bound_vec);
-
-            // A dummy covariance - should not be used
-            m_bound_params.set_covariance(
-                matrix::identity<bound_matrix_type>());
-
-            // An invalid barcode - should not be used
-            m_bound_params.set_surface_link(geometry::barcode{});
-
-            assert(!m_bound_params.is_invalid());
+            // The cold state is set up once the external buffer is bound
+            if constexpr (!has_external_storage) {
+                init_cold_state();
+            }
         }
 
         /// Sets track parameters from bound track parameter.
+        ///
+        /// @note Not available with external storage, since the bound
+        /// parameters are kept in the cold state
         template <typename detector_t>
-        DETRAY_HOST_DEVICE state(
-            const bound_track_parameters_type &bound_params,
-            const detector_t &det,
-            const typename detector_t::geometry_context &ctx)
-            : m_bound_params(bound_params) {
+        requires(!has_external_storage) DETRAY_HOST_DEVICE
+            state(const bound_track_parameters_type &bound_params,
+                  const detector_t &det,
+                  const typename detector_t::geometry_context &ctx)
+            : m_cold{make_cold_state(bound_params)} {
 
-            assert(!m_bound_params.is_invalid());
-            assert(!m_bound_params.surface_link().is_invalid());
+            assert(!bound_params.is_invalid());
+            assert(!bound_params.surface_link().is_invalid());
 
             // Departure surface
             const auto sf = tracking_surface{det, bound_params.surface_link()};
@@ -115,12 +206,33 @@ class base_stepper {
 
         /// @returns bound track parameters - const access
         DETRAY_HOST_DEVICE
-        bound_track_parameters_type &bound_params() { return m_bound_params; }
+        bound_track_parameters_type &bound_params() {
+            return cold().bound_params;
+        }
 
         /// @returns bound track parameters - non-const access
         DETRAY_HOST_DEVICE
         const bound_track_parameters_type &bound_params() const {
-            return m_bound_params;
+            return cold().bound_params;
+        }
+
+        /// Bind the external buffer entry @param cold_data of this track and
+        /// initialize it from the current track parameters
+        DETRAY_HOST_DEVICE
+        inline void bind_cold_state(cold_state_type &cold_data) requires(
+            has_external_storage) {
+            m_cold = &cold_data;
+            init_cold_state();
+        }
+
+        /// @returns whether the cold state can be accessed
+        DETRAY_HOST_DEVICE
+        inline bool has_cold_state() const {
+            if constexpr (has_external_storage) {
+                return m_cold != nullptr;
+            } else {
+                return true;
+            }
         }
 
         /// Get stepping direction
@@ -159,8 +271,37 @@ class base_stepper {
 
         /// Add a new segment to all path lengths (forward or backward)
         DETRAY_HOST_DEVICE inline void update_path_lengths(scalar_type seg) {
-            m_path_length += seg;
-            m_abs_path_length += math::fabs(seg);
+            if constexpr (has_compensated_sum) {
+                m_path_length =
+                    detail::compensated_add(m_path_length, m_comp.path, seg);
+                m_abs_path_length = detail::compensated_add(
+                    m_abs_path_length, m_comp.abs_path, math::fabs(seg));
+            } else {
+                m_path_length += seg;
+                m_abs_path_length += math::fabs(seg);
+            }
+        }
+
+        /// Move the track position by @param delta
+        ///
+        /// With compensated summation, the rounding errors are carried over to
+        /// the next step, so that the position does not drift over many small
+        /// steps. They are dropped, if the position was set in between.
+        DETRAY_HOST_DEVICE inline void advance_pos(
+            const dvector3D<algebra_t> &delta) {
+            if constexpr (has_compensated_sum) {
+                const auto &pos = m_track.pos();
+                const auto &last = m_comp.last_pos;
+                if (pos[0] != last[0] || pos[1] != last[1] ||
+                    pos[2] != last[2]) {
+                    m_comp.pos = {0.f, 0.f, 0.f};
+                }
+                m_track.set_pos(
+                    detail::compensated_add(m_track.pos(), m_comp.pos, delta));
+                m_comp.last_pos = m_track.pos();
+            } else {
+                m_track.set_pos(m_track.pos() + delta);
+            }
         }
 
         /// Set new step constraint
@@ -191,14 +332,17 @@ class base_stepper {
 
         /// @returns the current transport Jacbian.
         DETRAY_HOST_DEVICE
-        inline const free_matrix_type &transport_jacobian() const {
-            return m_jac_transport;
+        inline const free_matrix_type &transport_jacobian() const
+            requires(has_transport_jacobian) {
+            return cold().jac_transport;
         }
 
-        /// Reset transport Jacbian.
+        /// Reset transport Jacbian (no-op if the state has no jacobian).
         DETRAY_HOST_DEVICE
         inline void reset_transport_jacobian() {
-            m_jac_transport = matrix::identity<free_matrix_type>();
+            if constexpr (has_transport_jacobian) {
+                cold().jac_transport = matrix::identity<free_matrix_type>();
+            }
         }
 
         /// @returns access to this states navigation policy state
@@ -224,16 +368,70 @@ class base_stepper {
         protected:
         /// Set new transport Jacbian.
         DETRAY_HOST_DEVICE
-        inline void set_transport_jacobian(const free_matrix_type &jac) {
-            m_jac_transport = jac;
+        inline void set_transport_jacobian(const free_matrix_type &jac)
+            requires(has_transport_jacobian) {
+            cold().jac_transport = jac;
         }
 
         private:
-        /// Jacobian transport matrix
-        free_matrix_type m_jac_transport = matrix::identity<free_matrix_type>();
+        /// @returns the cold state, wherever it is stored
+        DETRAY_HOST_DEVICE
+        inline cold_state_type &cold() {
+            if constexpr (has_external_storage) {
+                assert(m_cold != nullptr);
+                return *m_cold;
+            } else {
+                return m_cold;
+            }
+        }
+
+        /// @returns the cold state, wherever it is stored - const
+        DETRAY_HOST_DEVICE
+        inline const cold_state_type &cold() const {
+            if constexpr (has_external_storage) {
+                assert(m_cold != nullptr);
+                return *m_cold;
+            } else {
+                return m_cold;
+            }
+        }
 
-        /// Bound covariance
-        bound_track_parameters_type m_bound_params;
+        /// Set the bound parameters from the current free track parameters
+        DETRAY_HOST_DEVICE
+        inline void init_cold_state() {
+            reset_transport_jacobian();
+
+            curvilinear_frame<algebra_t> cf(m_track);
+
+            // Set bound track parameters
+            auto &bound_params = cold().bound_params;
+            bound_params.set_parameter_vector(cf.m_bound_vec);
+
+            // A dummy covariance - should not be used
+            bound_params.set_covariance(matrix::identity<bound_matrix_type>());
+
+            // An invalid barcode - should not be used
+            bound_params.set_surface_link(geometry::barcode{});
+
+            assert(!bound_params.is_invalid());
+        }
+
+        /// @returns a cold state that holds the bound parameters @param bp
+        DETRAY_HOST_DEVICE
+        static inline cold_state_type make_cold_state(
+            const bound_track_parameters_type &bp) {
+            if constexpr (has_transport_jacobian) {
+                return {matrix::identity<free_matrix_type>(), bp};
+            } else {
+                return {bp};
+            }
+        }
+
+        /// Jacobian transport matrix and bound parameters (or a pointer to
+        /// them, if stored externally)
+        std::conditional_t<has_external_storage, cold_state_type *,
+                           cold_state_type>
+            m_cold{};
 
         /// Free track parameters
         free_track_parameters_type m_track;
@@ -253,6 +451,11 @@ class base_stepper {
         /// Absolute path length (total path length covered by the integration)
         scalar_type m_abs_path_length{0.f};
 
+        /// Rounding error compensation of the path lengths and the position
+        [[no_unique_address]] stepping::compensation<algebra_t,
+                                                     has_compensated_sum>
+            m_comp{};
+
         /// Step size constraints (optional)
         [[no_unique_address]] constraint_t m_constraint = {};
 
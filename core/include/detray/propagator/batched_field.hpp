@@ -0,0 +1,117 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+
+namespace detray {
+
+namespace concepts {
+
+/// Field views that can evaluate a batch of positions in SoA layout
+/// themselves (e.g. @c bfield::rz_field_view )
+template <typename field_view_t, typename scalar_t>
+concept batched_field_view = requires(const field_view_t &field,
+                                      const darray<scalar_t, 1u> &pos,
+                                      darray<scalar_t, 1u> &b) {
+    field.at_batch(pos, pos, pos, b, b, b);
+};
+
+}  // namespace concepts
+
+/// @brief Batched evaluation of a magnetic field view.
+///
+/// Evaluates the field for N positions at once, e.g. for the tracks of a
+/// batch that are stepped in lock-step (@see batched_navigator ). Positions
+/// and field components are passed in SoA layout (one container per
+/// component), which is the layout of the track collections (@see
+/// track_collection.hpp ). The containers only need to provide @c size() and
+/// @c operator[] (e.g. @c darray or @c dvector ).
+///
+/// Field views that provide their own batched evaluation are called with the
+/// whole batch, so that they can vectorize the transformation into the field
+/// grid and the interpolation. A constant field is only queried once per
+/// batch. All other field views are evaluated position by position.
+///
+/// On device, every thread evaluates its own lane with @c at_lane . Since
+/// the positions and field components are stored in columns, neighbouring
+/// threads read and write neighbouring addresses.
+///
+/// @tparam field_view_t the underlying field view type
+/// @tparam scalar_t the scalar type of the positions
+template <typename field_view_t, typename scalar_t = float>
+class batched_field {
+
+    public:
+    using field_type = field_view_t;
+
+    /// Construct from the field view @param field
+    DETRAY_HOST_DEVICE
+    explicit batched_field(const field_view_t &field) : m_field{field} {}
+
+    /// Evaluate the field at the positions ( @param x, @param y, @param z )
+    /// and write the field components to @param bx, @param by and @param bz
+    template <typename pos_cont_t, typename field_cont_t>
+    DETRAY_HOST_DEVICE void at(const pos_cont_t &x, const pos_cont_t &y,
+                               const pos_cont_t &z, field_cont_t &bx,
+                               field_cont_t &by, field_cont_t &bz) const {
+
+        assert(y.size() == x.size());
+        assert(z.size() == x.size());
+        assert(bx.size() >= x.size());
+        assert(by.size() >= x.size());
+        assert(bz.size() >= x.size());
+
+        if constexpr (concepts::batched_field_view<field_view_t, scalar_t>) {
+            m_field.at_batch(x, y, z, bx, by, bz);
+        } else if constexpr (detail::is_constant_field_v<field_view_t>) {
+            if (x.size() == 0u) {
+                return;
+            }
+            const auto b = m_field.at(x[0], y[0], z[0]);
+            for (std::size_t i = 0u; i < x.size(); ++i) {
+                bx[i] = b[0];
+                by[i] = b[1];
+                bz[i] = b[2];
+            }
+        } else {
+            for (std::size_t i = 0u; i < x.size(); ++i) {
+                at_lane(i, x, y, z, bx, by, bz);
+            }
+        }
+    }
+
+    /// Evaluate the field for the lane @param i of the batch only
+    template <typename pos_cont_t, typename field_cont_t>
+    DETRAY_HOST_DEVICE void at_lane(const std::size_t i, const pos_cont_t &x,
+                                    const pos_cont_t &y, const pos_cont_t &z,
+                                    field_cont_t &bx, field_cont_t &by,
+                                    field_cont_t &bz) const {
+        const auto b = m_field.at(x[i], y[i], z[i]);
+        bx[i] = b[0];
+        by[i] = b[1];
+        bz[i] = b[2];
+    }
+
+    /// @returns the underlying field view
+    DETRAY_HOST_DEVICE
+    const field_view_t &field() const { return m_field; }
+
+    private:
+    /// The wrapped field view
+    field_view_t m_field;
+};
+
+}  // namespace detray
@@ -0,0 +1,121 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
+
+// System include(s).
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Magnetic field view with a single-entry lookup cache.
+///
+/// Wraps a field view (e.g. a covfie field view) and can be used as the
+/// magnetic field type of the @c rk_stepper. If a field value is requested
+/// within @c tolerance of the position of the previous lookup, the previous
+/// value is returned without querying the underlying field. For
+/// interpolated field maps, a tolerance well below the size of a field cell
+/// (e.g. a tenth) skips most of the trilinear interpolations of the RK stages
+/// of short steps at a negligible loss of precision. A tolerance of zero only
+/// reuses the value for repeated lookups at the exact same position.
+///
+/// @note The cache is per stepping state, since every state holds its own
+/// copy of the field view.
+///
+/// @tparam field_view_t the underlying field view type
+/// @tparam scalar_t the scalar type of the positions
+template <typename field_view_t, typename scalar_t = float>
+class cached_field {
+
+    public:
+    using field_type = field_view_t;
+    using output_type = std::remove_cvref_t<decltype(
+        std::declval<const field_view_t &>().at(scalar_t{}, scalar_t{},
+                                                scalar_t{}))>;
+
+    /// Construct from the field view @param field and the distance
+    /// @param tolerance within which a cached value is reused
+    DETRAY_HOST_DEVICE
+    explicit cached_field(const field_view_t &field,
+                          const scalar_t tolerance = 0.f)
+        : m_field{field}, m_tol2{tolerance * tolerance} {}
+
+    /// @returns the field value at the position ( @param x, @param y,
+    /// @param z ), from the cache, if possible
+    DETRAY_HOST_DEVICE
+    output_type at(const scalar_t x, const scalar_t y, const scalar_t z) const {
+
+        if (m_is_valid) {
+            const scalar_t dx{x - m_pos[0]};
+            const scalar_t dy{y - m_pos[1]};
+            const scalar_t dz{z - m_pos[2]};
+
+            if (dx * dx + dy * dy + dz * dz <= m_tol2) {
+                ++m_n_hits;
+                return m_value;
+            }
+        }
+
+        ++m_n_misses;
+        m_value = m_field.at(x, y, z);
+        m_pos[0] = x;
+        m_pos[1] = y;
+        m_pos[2] = z;
+        m_is_valid = true;
+
+        return m_value;
+    }
+
+    /// Drop the cached value (e.g. when the track is reset)
+    DETRAY_HOST_DEVICE
+    void invalidate() const { m_is_valid = false; }
+
+    /// @returns the underlying field view
+    DETRAY_HOST_DEVICE
+    const field_view_t &field() const { return m_field; }
+
+    /// @returns the number of lookups that were served from the cache
+    DETRAY_HOST_DEVICE
+    std::uint32_t n_hits() const { return m_n_hits; }
+
+    /// @returns the number of lookups that queried the underlying field
+    DETRAY_HOST_DEVICE
+    std::uint32_t n_misses() const { return m_n_misses; }
+
+    private:
+    /// The wrapped field view
+    field_view_t m_field;
+    /// Squared distance within which the cached value is reused
+    scalar_t m_tol2{0.f};
+
+    /// Position and value of the last lookup
+    mutable darray<scalar_t, 3> m_pos{0.f, 0.f, 0.f};
+    mutable output_type m_value{};
+    mutable bool m_is_valid{false};
+
+    /// Cache statistics
+    mutable std::uint32_t m_n_hits{0u};
+    mutable std::uint32_t m_n_misses{0u};
+};
+
+namespace detail {
+
+/// A cached constant field is still constant
+template <typename field_view_t, typename scalar_t>
+struct is_constant_field<cached_field<field_view_t, scalar_t>>
+    : public is_constant_field<field_view_t> {};
+
+}  // namespace detail
+
+}  // namespace detray
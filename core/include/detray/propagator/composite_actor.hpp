@@ -41,6 +41,11 @@ class composite_actor final : public principal_actor_t {
     using actor_type = principal_actor_t;
     using state = typename actor_type::state;
 
+    /// The composite is called whenever its own actor or any of its observers
+    /// have to be called (hides the def in the actor)
+    static constexpr actor_trigger trigger{
+        (principal_actor_t::trigger | ... | observers::trigger)};
+
     /// Tuple of states of observing actors
     using observer_states =
         detail::tuple_cat_t<detail::state_tuple_t<observers>...>;
@@ -66,14 +71,23 @@ class composite_actor final : public principal_actor_t {
         // State of the primary actor that is implement by this composite actor
         auto &actor_state = detail::get<typename actor_type::state &>(states);
 
-        // Do your own work ...
+        // Do your own work (if it applies, the composite might only have been
+        // called for its observers) ...
         // Two cases: This is a simple actor or observing actor (pass on its
         // subject's state)
-        if constexpr (std::same_as<subj_state_t, typename actor::state>) {
-            actor_type::operator()(actor_state, p_state);
-        } else {
-            actor_type::operator()(actor_state, p_state,
-                                   std::forward<subj_state_t>(subject_state));
+        bool run_self{true};
+        if constexpr (actor_type::trigger != trigger) {
+            run_self =
+                detail::is_triggered<actor_type::trigger>(p_state._navigation);
+        }
+        if (run_self) {
+            if constexpr (std::same_as<subj_state_t, typename actor::state>) {
+                actor_type::operator()(actor_state, p_state);
+            } else {
+                actor_type::operator()(
+                    actor_state, p_state,
+                    std::forward<subj_state_t>(subject_state));
+            }
         }
 
         // ... then run the observers on the updated state
@@ -95,6 +109,14 @@ class composite_actor final : public principal_actor_t {
                                           actor_states_t &states,
                                           state &actor_state,
                                           propagator_state_t &p_state) const {
+        // Skip observers that do not apply
+        if constexpr (observer_t::trigger != trigger) {
+            if (!detail::is_triggered<observer_t::trigger>(
+                    p_state._navigation)) {
+                return;
+            }
+        }
+
         // Two cases: observer is a simple actor or a composite actor
         if constexpr (!concepts::composite_actor<observer_t>) {
             // No actor state defined (empty)
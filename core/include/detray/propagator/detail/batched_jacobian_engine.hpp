@@ -0,0 +1,119 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/tracks/bound_track_parameters.hpp"
+#include "detray/tracks/detail/transform_track_parameters.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+
+namespace detray::detail {
+
+/// @brief Transforms batches of track parameters and their covariances
+/// between the bound frame of a surface and the free frame.
+///
+/// All parameter sets of a batch belong to the same surface, so that the
+/// surface placement and mask are fetched once per batch instead of once per
+/// track (e.g. for all measurements on a surface in the smoothing pass of a
+/// fitter). The batch containers only need to provide @c size() and
+/// @c operator[] (e.g. @c darray or @c dvector ). The SoA track collections
+/// (@see track_collection.hpp ) keep the data of every component contiguous.
+///
+/// @note The entries of a batch are transformed one after the other with the
+/// scalar kernels of the @c jacobian_engine . The batch is not vectorized
+/// over the tracks: The per-shape jacobians branch on the track parameters
+/// (e.g. the sign of the local coordinate on line surfaces), and the track
+/// parameter types are only defined for the scalar algebras. The saving is
+/// the single surface lookup.
+///
+/// @tparam frame_t the local frame of the surface
+template <typename frame_t>
+struct batched_jacobian_engine {
+
+    /// @name Type definitions for the struct
+    /// @{
+    using engine_type = jacobian_engine<frame_t>;
+
+    using algebra_type = typename frame_t::algebra_type;
+    using transform3_type = dtransform3D<algebra_type>;
+
+    using bound_to_free_matrix_type = bound_to_free_matrix<algebra_type>;
+    using free_to_bound_matrix_type = free_to_bound_matrix<algebra_type>;
+    using free_matrix_type = free_matrix<algebra_type>;
+    using bound_matrix_type = bound_matrix<algebra_type>;
+    /// @}
+
+    /// Transform a batch of bound track parameters to free track parameters
+    ///
+    /// @param trf3 the placement of the surface
+    /// @param mask the mask of the surface
+    /// @param bound_params the bound parameters and covariances of the batch
+    /// @param free_vecs the resulting free parameter vectors
+    /// @param free_covs the resulting free covariances
+    template <typename mask_t, typename bound_cont_t, typename free_vec_cont_t,
+              typename free_cov_cont_t>
+    DETRAY_HOST_DEVICE static inline void bound_to_free(
+        const transform3_type &trf3, const mask_t &mask,
+        const bound_cont_t &bound_params, free_vec_cont_t &free_vecs,
+        free_cov_cont_t &free_covs) {
+
+        assert(free_vecs.size() >= bound_params.size());
+        assert(free_covs.size() >= bound_params.size());
+
+        for (std::size_t i = 0u; i < bound_params.size(); ++i) {
+            const auto &bound = bound_params[i];
+
+            const bound_to_free_matrix_type jac =
+                engine_type::bound_to_free_jacobian(trf3, mask, bound);
+
+            free_vecs[i] = bound_to_free_vector(trf3, mask, bound);
+            free_covs[i] =
+                jac * bound.covariance() * matrix::transpose(jac);
+        }
+    }
+
+    /// Transform a batch of free track parameters to bound track parameters
+    ///
+    /// @param trf3 the placement of the surface
+    /// @param free_vecs the free parameter vectors of the batch
+    /// @param free_covs the free covariances of the batch
+    /// @param bound_params the resulting bound parameters and covariances
+    ///                     (the surface link is left untouched)
+    template <typename free_vec_cont_t, typename free_cov_cont_t,
+              typename bound_cont_t>
+    DETRAY_HOST_DEVICE static inline void free_to_bound(
+        const transform3_type &trf3, const free_vec_cont_t &free_vecs,
+        const free_cov_cont_t &free_covs, bound_cont_t &bound_params) {
+
+        assert(free_covs.size() >= free_vecs.size());
+        assert(bound_params.size() >= free_vecs.size());
+
+        for (std::size_t i = 0u; i < free_vecs.size(); ++i) {
+            const auto &free_vec = free_vecs[i];
+
+            const free_to_bound_matrix_type jac =
+                engine_type::free_to_bound_jacobian(trf3, free_vec);
+
+            // Can be an element proxy into a SoA collection
+            auto &&bound = bound_params[i];
+            bound.set_parameter_vector(
+                free_to_bound_vector<frame_t>(trf3, free_vec));
+            bound.set_covariance(jac * free_covs[i] *
+                                 matrix::transpose(jac));
+        }
+    }
+};
+
+}  // namespace detray::detail
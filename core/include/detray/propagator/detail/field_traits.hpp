@@ -0,0 +1,25 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <type_traits>
+
+namespace detray::detail {
+
+/// Whether the magnetic field view @tparam field_t returns the same value
+/// everywhere. Field types specialize this trait where they are defined.
+/// The steppers can then use the analytic helix solution in such fields.
+template <typename field_t>
+struct is_constant_field : public std::false_type {};
+
+template <typename field_t>
+inline constexpr bool is_constant_field_v{
+    is_constant_field<std::remove_cvref_t<field_t>>::value};
+
+}  // namespace detray::detail
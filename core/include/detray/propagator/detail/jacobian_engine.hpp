@@ -148,6 +148,14 @@ requires std::is_object_v<typename frame_t::loc_point> struct jacobian_engine {
         free_to_path_matrix_type path_derivative =
             jacobian_t::path_derivative(trf3, pos, dir, dtds);
 
+        return path_to_free_derivative(dir, dtds, dqopds) * path_derivative;
+    }
+
+    /// @returns the derivative of the free track parameters w.r.t. the path
+    DETRAY_HOST_DEVICE static inline path_to_free_matrix_type
+    path_to_free_derivative(const vector3_type& dir, const vector3_type& dtds,
+                            const scalar_type dqopds) {
+
         path_to_free_matrix_type derivative =
             matrix::zero<path_to_free_matrix_type>();
         getter::element(derivative, e_free_pos0, 0u) = dir[0];
@@ -158,7 +166,107 @@ requires std::is_object_v<typename frame_t::loc_point> struct jacobian_engine {
         getter::element(derivative, e_free_dir2, 0u) = dtds[2];
         getter::element(derivative, e_free_qoverp, 0u) = dqopds;
 
-        return derivative * path_derivative;
+        return derivative;
+    }
+
+    /// @brief Full jacobian from the bound frame of the departure surface to
+    /// the bound frame of the destination surface
+    ///
+    /// Evaluates
+    /// free_to_bound * (I + path_correction) * transport * bound_to_free
+    /// without the full matrix products: The path correction is a rank-one
+    /// update and the structural zeros of the bound-to-free and free-to-bound
+    /// jacobians are skipped. These are:
+    ///  - bound_to_free: d(pos)/d(loc), d(pos, dir)/d(phi, theta) and unit
+    ///    entries for time and q/p
+    ///  - free_to_bound: d(loc)/d(pos), d(phi)/d(n_x, n_y),
+    ///    d(theta)/d(n_x, n_y, n_z) and unit entries for time and q/p
+    ///
+    /// @param free_to_bound_jac free to bound jacobian at the destination
+    /// @param transport_jac the transport jacobian between the surfaces
+    /// @param bound_to_free_jac bound to free jacobian at the departure
+    /// @param pos the track position on the destination surface
+    /// @param dir the track direction on the destination surface
+    /// @param dtds the derivative of the track direction w.r.t. the path
+    /// @param dqopds the derivative of q/p w.r.t. the path
+    /// @param trf3 the placement of the destination surface
+    DETRAY_HOST_DEVICE static inline bound_matrix<algebra_type>
+    bound_to_bound_jacobian(const free_to_bound_matrix_type& free_to_bound_jac,
+                            const free_matrix<algebra_type>& transport_jac,
+                            const bound_to_free_matrix_type& bound_to_free_jac,
+                            const point3_type& pos, const vector3_type& dir,
+                            const vector3_type& dtds,
+                            const scalar_type dqopds,
+                            const transform3_type& trf3) {
+
+        constexpr unsigned int n_pos{3u};
+        constexpr unsigned int n_dir{3u};
+
+        // transport * bound_to_free
+        bound_to_free_matrix_type A = matrix::zero<bound_to_free_matrix_type>();
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = e_bound_loc0; j <= e_bound_theta; ++j) {
+                scalar_type sum{0.f};
+                for (unsigned int k = 0u; k < n_pos; ++k) {
+                    sum += getter::element(transport_jac, i, e_free_pos0 + k) *
+                           getter::element(bound_to_free_jac, e_free_pos0 + k,
+                                           j);
+                }
+                // Only the angles change the direction
+                if (j == e_bound_phi || j == e_bound_theta) {
+                    for (unsigned int k = 0u; k < n_dir; ++k) {
+                        sum += getter::element(transport_jac, i,
+                                               e_free_dir0 + k) *
+                               getter::element(bound_to_free_jac,
+                                               e_free_dir0 + k, j);
+                    }
+                }
+                getter::element(A, i, j) = sum;
+            }
+            getter::element(A, i, e_bound_time) =
+                getter::element(transport_jac, i, e_free_time);
+            getter::element(A, i, e_bound_qoverp) =
+                getter::element(transport_jac, i, e_free_qoverp);
+        }
+
+        // (I + path_to_free * free_to_path) * A
+        const free_to_path_matrix_type free_to_path =
+            jacobian_t::path_derivative(trf3, pos, dir, dtds);
+        const path_to_free_matrix_type path_to_free =
+            path_to_free_derivative(dir, dtds, dqopds);
+
+        const auto path_row = free_to_path * A;
+        A = A + path_to_free * path_row;
+
+        // free_to_bound * A
+        bound_matrix<algebra_type> J =
+            matrix::zero<bound_matrix<algebra_type>>();
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            for (unsigned int i = e_bound_loc0; i <= e_bound_loc1; ++i) {
+                scalar_type sum{0.f};
+                for (unsigned int k = 0u; k < n_pos; ++k) {
+                    sum += getter::element(free_to_bound_jac, i,
+                                           e_free_pos0 + k) *
+                           getter::element(A, e_free_pos0 + k, j);
+                }
+                getter::element(J, i, j) = sum;
+            }
+            for (unsigned int i = e_bound_phi; i <= e_bound_theta; ++i) {
+                scalar_type sum{0.f};
+                for (unsigned int k = 0u; k < n_dir; ++k) {
+                    sum += getter::element(free_to_bound_jac, i,
+                                           e_free_dir0 + k) *
+                           getter::element(A, e_free_dir0 + k, j);
+                }
+                getter::element(J, i, j) = sum;
+            }
+            getter::element(J, e_bound_time, j) =
+                getter::element(A, e_free_time, j);
+            getter::element(J, e_bound_qoverp, j) =
+                getter::element(A, e_free_qoverp, j);
+        }
+
+        return J;
     }
 };
 
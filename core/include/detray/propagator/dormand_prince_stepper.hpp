@@ -0,0 +1,267 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/navigation/policies.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
+#include "detray/tracks/helix.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <limits>
+
+namespace detray {
+
+namespace detail {
+
+/// Butcher tableau of the Dormand-Prince 5(4) method
+///
+/// Reference: J.R. Dormand, P.J. Prince, "A family of embedded Runge-Kutta
+/// formulae", https://doi.org/10.1016/0771-050X(80)90013-3
+template <concepts::scalar scalar_t>
+struct dormand_prince_tableau {
+
+    /// Number of stages
+    static constexpr std::size_t n_stages{7u};
+
+    /// @returns the coefficient a_ij of the stage @param i
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t a(const std::size_t i, const std::size_t j) {
+        constexpr double a_ij[n_stages][n_stages - 1u]{
+            {0., 0., 0., 0., 0., 0.},
+            {1. / 5., 0., 0., 0., 0., 0.},
+            {3. / 40., 9. / 40., 0., 0., 0., 0.},
+            {44. / 45., -56. / 15., 32. / 9., 0., 0., 0.},
+            {19372. / 6561., -25360. / 2187., 64448. / 6561., -212. / 729., 0.,
+             0.},
+            {9017. / 3168., -355. / 33., 46732. / 5247., 49. / 176.,
+             -5103. / 18656., 0.},
+            {35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784.,
+             11. / 84.}};
+
+        return static_cast<scalar_t>(a_ij[i][j]);
+    }
+
+    /// @returns the weight of the stage @param i in the fifth order solution
+    /// (the same as the coefficients of the last stage: first same as last)
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t b(const std::size_t i) {
+        return i < n_stages - 1u ? a(n_stages - 1u, i) : scalar_t{0};
+    }
+
+    /// @returns the difference between the weights of the fifth and the
+    /// fourth order solution for the stage @param i
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t e(const std::size_t i) {
+        constexpr double e_i[n_stages]{
+            71. / 57600.,      0.,          -71. / 16695., 71. / 1920.,
+            -17253. / 339200., 22. / 525., -1. / 40.};
+
+        return static_cast<scalar_t>(e_i[i]);
+    }
+};
+
+}  // namespace detail
+
+/// Embedded Runge-Kutta stepper of fifth order (Dormand-Prince 5(4))
+///
+/// The error of the fifth order solution is estimated from the embedded
+/// fourth order solution, so that larger steps are accepted at the same
+/// @c stepping::config::rk_error_tol than for the fourth order
+/// @c rk_stepper. The last stage of a step is evaluated at the
+/// new track position: If the next step starts from there, the field value of
+/// that stage is reused for the first stage (FSAL), so that an accepted step
+/// costs six field lookups.
+///
+/// The long steps can leave a volume between two of the navigation
+/// candidates in strongly bending tracks. The
+/// @c stepping::config::max_step_deviation limits them, if necessary.
+///
+/// @tparam magnetic_field_t the type of magnetic field
+/// @tparam constraint_ the type of constraints on the stepper
+/// @tparam storage_t storage options of the state (@see stepping::storage )
+template <typename magnetic_field_t, concepts::algebra algebra_t,
+          typename constraint_t = unconstrained_step<dscalar<algebra_t>>,
+          typename policy_t = stepper_rk_policy<dscalar<algebra_t>>,
+          typename inspector_t = stepping::void_inspector,
+          typename storage_t = stepping::inline_storage>
+class dormand_prince_stepper final
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t,
+                          storage_t> {
+
+    using base_type =
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t, storage_t>;
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using magnetic_field_type = magnetic_field_t;
+    template <std::size_t ROWS, std::size_t COLS>
+    using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
+
+    using tableau = detail::dormand_prince_tableau<scalar_type>;
+    static constexpr std::size_t n_stages{tableau::n_stages};
+
+    dormand_prince_stepper() = default;
+
+    struct intermediate_state {
+        // r = position
+        darray<point3_type, n_stages> r;
+        // Magnetic field at the stage positions
+        darray<vector3_type, n_stages> b;
+        // t = tangential direction = dr/ds
+        darray<vector3_type, n_stages> t;
+        // q/p
+        darray<scalar_type, n_stages> qop;
+        // dt/ds = d^2r/ds^2 = q/p ( t X B )
+        darray<vector3_type, n_stages> dtds;
+        // d(q/p)/ds
+        darray<scalar_type, n_stages> dqopds;
+    };
+
+    struct state : public base_type::state {
+
+        friend dormand_prince_stepper;
+
+        static constexpr const stepping::id id = stepping::id::e_rk;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : base_type::state(t), m_magnetic_field(mag_field) {}
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det,
+            const typename detector_t::geometry_context& ctx)
+            : base_type::state(bound_params, det, ctx),
+              m_magnetic_field(mag_field) {}
+
+        /// @returns the B-field view
+        magnetic_field_type field() const { return m_magnetic_field; }
+
+        /// Set the next step size
+        DETRAY_HOST_DEVICE
+        inline void set_next_step_size(const scalar_type step) {
+            m_next_step_size = step;
+        }
+
+        /// @returns the next step size to be taken on the following step.
+        DETRAY_HOST_DEVICE
+        inline scalar_type next_step_size() const { return m_next_step_size; }
+
+        /// @returns the number of field lookups that were saved, because the
+        /// field of the last stage could be reused
+        DETRAY_HOST_DEVICE
+        inline std::size_t n_reused_lookups() const { return m_n_fsal; }
+
+        /// Update the track state with the fifth order solution
+        DETRAY_HOST_DEVICE
+        void advance_track(const intermediate_state& sd,
+                           const material<scalar_type>* vol_mat_ptr);
+
+        /// Update the jacobian transport from free propagation
+        DETRAY_HOST_DEVICE
+        void advance_jacobian(const stepping::config& cfg,
+                              const intermediate_state&,
+                              const material<scalar_type>* vol_mat_ptr);
+
+        /// Evaluate the stage @param i of a Runge-Kutta step of size @param h
+        DETRAY_HOST_DEVICE
+        void evaluate_stage(intermediate_state& sd, const std::size_t i,
+                            const scalar_type h,
+                            const material<scalar_type>* vol_mat_ptr,
+                            const stepping::config& cfg) const;
+
+        /// @returns the magnetic field at the position @param pos
+        DETRAY_HOST_DEVICE
+        vector3_type get_field(const point3_type& pos) const;
+
+        DETRAY_HOST_DEVICE
+        matrix_type<3, 3> evaluate_field_gradient(const point3_type& pos);
+
+        /// Evaluate dtds, where t is the unit tangential direction
+        DETRAY_HOST_DEVICE
+        vector3_type dtds() const;
+
+        /// Evaulate d(qop)/ds
+        DETRAY_HOST_DEVICE
+        scalar_type dqopds(const material<scalar_type>* vol_mat_ptr) const;
+
+        DETRAY_HOST_DEVICE
+        scalar_type dqopds(const scalar_type qop,
+                           const material<scalar_type>* vol_mat_ptr) const;
+
+        /// Evaulate d(d(qop)/ds)dqop
+        DETRAY_HOST_DEVICE
+        scalar_type d2qopdsdqop(const scalar_type qop,
+                                const material<scalar_type>* vol_mat_ptr) const;
+
+        /// Call the stepping inspector
+        template <typename... Args>
+        DETRAY_HOST_DEVICE void run_inspector(
+            [[maybe_unused]] const stepping::config& cfg,
+            [[maybe_unused]] const char* message,
+            [[maybe_unused]] Args&&... args) {
+            if constexpr (!std::is_same_v<inspector_t,
+                                          stepping::void_inspector>) {
+                this->inspector()(*this, cfg, message,
+                                  std::forward<Args>(args)...);
+            }
+        }
+
+        private:
+        vector3_type m_dtds_last;
+        scalar_type m_dqopds_last;
+
+        /// Position and field of the last stage of the previous step (FSAL)
+        point3_type m_fsal_pos{0.f, 0.f, 0.f};
+        vector3_type m_fsal_b{0.f, 0.f, 0.f};
+        bool m_has_fsal{false};
+
+        /// Number of reused field lookups
+        std::size_t m_n_fsal{0u};
+
+        /// Next step size after adaptive step size scaling
+        scalar_type m_next_step_size{0.f};
+
+        /// Magnetic field view
+        const magnetic_field_t m_magnetic_field;
+    };
+
+    /// Take a step, using an adaptive embedded Runge-Kutta algorithm.
+    ///
+    /// @param dist_to_next The straight line distance to the next surface
+    /// @param stepping The state object of a stepper
+    /// @param cfg The stepping configuration
+    /// @param do_reset whether to reset the step size to "dist to next"
+    ///
+    /// @return returning the heartbeat, indicating if the stepping is alive
+    DETRAY_HOST_DEVICE bool step(
+        const scalar_type dist_to_next, state& stepping,
+        const stepping::config& cfg, bool do_reset,
+        const material<scalar_type>* vol_mat_ptr = nullptr) const;
+};
+
+}  // namespace detray
+
+#include "detray/propagator/dormand_prince_stepper.ipp"
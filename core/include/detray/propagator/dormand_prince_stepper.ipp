@@ -0,0 +1,617 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/materials/interaction.hpp"
+#include "detray/utils/matrix_helper.hpp"
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline void
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    advance_track(const intermediate_state& sd,
+                  const material<scalar_type>* vol_mat_ptr) {
+
+    const scalar_type h{this->step_size()};
+    auto& track = (*this)();
+
+    // Fifth order solution
+    vector3_type delta_pos{0.f, 0.f, 0.f};
+    vector3_type delta_dir{0.f, 0.f, 0.f};
+    scalar_type delta_qop{0.f};
+    for (std::size_t i = 0u; i < n_stages - 1u; ++i) {
+        const scalar_type hb{h * tableau::b(i)};
+        delta_pos = delta_pos + hb * sd.t[i];
+        delta_dir = delta_dir + hb * sd.dtds[i];
+        delta_qop += hb * sd.dqopds[i];
+    }
+
+    this->advance_pos(delta_pos);
+    track.set_dir(vector::normalize(track.dir() + delta_dir));
+
+    if (vol_mat_ptr != nullptr) {
+        track.set_qop(track.qop() + delta_qop);
+    }
+
+    // Update path lengths
+    this->update_path_lengths(h);
+
+    // The last stage was evaluated at the new position
+    constexpr std::size_t last{n_stages - 1u};
+    m_fsal_pos = track.pos();
+    m_fsal_b = sd.b[last];
+    m_has_fsal = true;
+
+    m_dtds_last = track.qop() * vector::cross(track.dir(), sd.b[last]);
+    m_dqopds_last = sd.dqopds[last];
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline void
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    advance_jacobian(const detray::stepping::config& cfg,
+                     const intermediate_state& sd,
+                     const material<scalar_type>* vol_mat_ptr) {
+
+    // In a constant field without volume material, the track follows a helix
+    // and the step transport matrix is known analytically.
+    if constexpr (detail::is_constant_field_v<magnetic_field_t>) {
+        if (vol_mat_ptr == nullptr && vector::norm(sd.b[0u]) > 0.f) {
+            const detail::helix<algebra_t> hlx(point3_type{0.f, 0.f, 0.f},
+                                               0.f, sd.t[0u], sd.qop[0u],
+                                               sd.b[0u]);
+
+            this->set_transport_jacobian(matrix::multiply_8x8(
+                hlx.jacobian(this->step_size()), this->transport_jacobian()));
+            return;
+        }
+    }
+
+    /*---------------------------------------------------------------------------
+     *  The derivatives of the stage values with respect to the initial track
+     *  parameters follow from the stage equations like in the RKN4 case
+     *  (@see rk_stepper::state::advance_jacobian ):
+     *
+     *  t_n = t_1 + h * sum_j a_nj * k_j,    k_n = qop_n * ( t_n X B_n )
+     *  r_n = r_1 + h * sum_j a_nj * t_j
+     *  qop_n = qop_1 + h * sum_j a_nj * dqop_j/ds
+     *
+     *  and e.g. dk_n/dt1 = qop_n * ( dt_n/dt1 X B_n ), where X is the column
+     *  wise cross product. The derivatives of the new track parameters are
+     *  then given by the weights of the fifth order solution.
+    ---------------------------------------------------------------------------*/
+
+    using mat_helper = matrix_helper<algebra_t>;
+
+    auto D = matrix::identity<free_matrix<algebra_t>>();
+
+    const scalar_type h{this->step_size()};
+
+    // 3X3 Identity matrix
+    const auto I33 = matrix::identity<matrix_type<3, 3>>();
+    const auto Z33 = matrix::zero<matrix_type<3, 3>>();
+
+    // The last stage does not enter the fifth order solution
+    constexpr std::size_t n{n_stages - 1u};
+
+    // Derivatives of the stage directions and of k_n
+    darray<matrix_type<3u, 3u>, n> dtndt;
+    darray<matrix_type<3u, 3u>, n> dkndt;
+    darray<vector3_type, n> dtndqop;
+    darray<vector3_type, n> dkndqop;
+    // d(dqop_n/ds)/dqop1
+    darray<scalar_type, n> dgndqop;
+
+    // Only needed for the field gradient
+    darray<matrix_type<3u, 3u>, n> dtndr;
+    darray<matrix_type<3u, 3u>, n> dkndr;
+
+    for (std::size_t i = 0u; i < n; ++i) {
+
+        // Accumulate the derivatives of the previous stages
+        matrix_type<3u, 3u> dtdt = I33;
+        vector3_type dtdqop{0.f, 0.f, 0.f};
+        scalar_type dqopdqop{1.f};
+        for (std::size_t j = 0u; j < i; ++j) {
+            const scalar_type ha{h * tableau::a(i, j)};
+            dtdt = dtdt + ha * dkndt[j];
+            dtdqop = dtdqop + ha * dkndqop[j];
+            dqopdqop += ha * dgndqop[j];
+        }
+
+        dtndt[i] = dtdt;
+        dtndqop[i] = dtdqop;
+
+        dkndt[i] = sd.qop[i] * mat_helper().column_wise_cross(dtdt, sd.b[i]);
+        dkndqop[i] = dqopdqop * vector::cross(sd.t[i], sd.b[i]) +
+                     sd.qop[i] * vector::cross(dtdqop, sd.b[i]);
+
+        if (!cfg.use_eloss_gradient) {
+            dgndqop[i] = 0.f;
+        } else if (cfg.linear_eloss_per_step) {
+            // The energy loss only depends on qop at the first stage
+            dgndqop[i] = (i == 0u) ? this->d2qopdsdqop(sd.qop[0u], vol_mat_ptr)
+                                   : dgndqop[0u];
+        } else {
+            dgndqop[i] = this->d2qopdsdqop(sd.qop[i], vol_mat_ptr) * dqopdqop;
+        }
+
+        // Calculate dkndr in case of considering B field gradient
+        if (cfg.use_field_gradient) {
+            matrix_type<3u, 3u> drdr = I33;
+            matrix_type<3u, 3u> dtdr = Z33;
+            for (std::size_t j = 0u; j < i; ++j) {
+                const scalar_type ha{h * tableau::a(i, j)};
+                drdr = drdr + ha * dtndr[j];
+                dtdr = dtdr + ha * dkndr[j];
+            }
+            dtndr[i] = dtdr;
+
+            const matrix_type<3, 3> dBdr = evaluate_field_gradient(sd.r[i]);
+
+            dkndr[i] =
+                sd.qop[i] * mat_helper().column_wise_cross(dtdr, sd.b[i]) -
+                sd.qop[i] *
+                    mat_helper().column_wise_cross(dBdr * drdr, sd.t[i]);
+        }
+    }
+
+    // Fifth order solution for the derivatives
+    auto dFdt = Z33;
+    auto dGdt = I33;
+    vector3_type dFdqop{0.f, 0.f, 0.f};
+    vector3_type dGdqop{0.f, 0.f, 0.f};
+    scalar_type dqopdqop{1.f};
+    for (std::size_t i = 0u; i < n; ++i) {
+        const scalar_type hb{h * tableau::b(i)};
+        dFdt = dFdt + hb * dtndt[i];
+        dGdt = dGdt + hb * dkndt[i];
+        dFdqop = dFdqop + hb * dtndqop[i];
+        dGdqop = dGdqop + hb * dkndqop[i];
+        dqopdqop += hb * dgndqop[i];
+    }
+
+    if (cfg.use_field_gradient) {
+        auto dFdr = I33;
+        auto dGdr = Z33;
+        for (std::size_t i = 0u; i < n; ++i) {
+            const scalar_type hb{h * tableau::b(i)};
+            dFdr = dFdr + hb * dtndr[i];
+            dGdr = dGdr + hb * dkndr[i];
+        }
+
+        getter::set_block(D, dFdr, 0u, 0u);
+        getter::set_block(D, dGdr, 4u, 0u);
+    }
+
+    getter::set_block(D, dFdt, 0u, 4u);
+    getter::set_block(D, dGdt, 4u, 4u);
+
+    getter::set_block(D, dFdqop, 0u, 7u);
+    getter::set_block(D, dGdqop, 4u, 7u);
+
+    getter::element(D, e_free_qoverp, e_free_qoverp) = dqopdqop;
+
+    this->set_transport_jacobian(
+        matrix::multiply_8x8(D, this->transport_jacobian()));
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline void
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    evaluate_stage(intermediate_state& sd, const std::size_t i,
+                   const scalar_type h,
+                   const material<scalar_type>* vol_mat_ptr,
+                   const detray::stepping::config& cfg) const {
+
+    assert(i > 0u);
+    assert(i < n_stages);
+
+    const auto& track = (*this)();
+
+    point3_type r = track.pos();
+    vector3_type t = track.dir();
+    scalar_type qop = track.qop();
+    for (std::size_t j = 0u; j < i; ++j) {
+        const scalar_type ha{h * tableau::a(i, j)};
+        r = r + ha * sd.t[j];
+        t = t + ha * sd.dtds[j];
+        qop += ha * sd.dqopds[j];
+    }
+
+    sd.r[i] = r;
+    sd.t[i] = t;
+    sd.b[i] = get_field(r);
+
+    if (!vol_mat_ptr) {
+        sd.qop[i] = track.qop();
+        sd.dqopds[i] = 0.f;
+    } else if (cfg.linear_eloss_per_step) {
+        // Keep the energy loss of the first stage for the whole step
+        sd.qop[i] = qop;
+        sd.dqopds[i] = sd.dqopds[0u];
+    } else if (cfg.use_mean_loss) {
+        sd.qop[i] = qop;
+        sd.dqopds[i] = this->dqopds(qop, vol_mat_ptr);
+    } else {
+        sd.qop[i] = track.qop();
+        sd.dqopds[i] = this->dqopds(track.qop(), vol_mat_ptr);
+    }
+
+    // dtds = qop * (t X B) from Lorentz force
+    sd.dtds[i] = sd.qop[i] * vector::cross(t, sd.b[i]);
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    get_field(const point3_type& pos) const -> vector3_type {
+
+    const auto bvec = this->m_magnetic_field.at(pos[0], pos[1], pos[2]);
+    assert(math::isfinite(bvec[0]));
+    assert(math::isfinite(bvec[1]));
+    assert(math::isfinite(bvec[2]));
+
+    return {bvec[0], bvec[1], bvec[2]};
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    evaluate_field_gradient(const point3_type& pos) -> matrix_type<3, 3> {
+
+    auto dBdr = matrix::zero<matrix_type<3, 3>>();
+
+    constexpr auto delta{1e-1f * unit<scalar_type>::mm};
+
+    for (unsigned int i = 0; i < 3; i++) {
+
+        point3_type dpos1 = pos;
+        dpos1[i] += delta;
+        const vector3_type bvec1 = get_field(dpos1);
+
+        point3_type dpos2 = pos;
+        dpos2[i] -= delta;
+        const vector3_type bvec2 = get_field(dpos2);
+
+        const vector3_type gradient = (bvec1 - bvec2) * (1.f / (2.f * delta));
+
+        getter::element(dBdr, 0u, i) = gradient[0u];
+        getter::element(dBdr, 1u, i) = gradient[1u];
+        getter::element(dBdr, 2u, i) = gradient[2u];
+    }
+
+    return dBdr;
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::dtds()
+    const -> vector3_type {
+
+    // In case there was no step before
+    if (this->path_length() == 0.f) {
+        const vector3_type bvec = get_field((*this)().pos());
+
+        return (*this)().qop() * vector::cross((*this)().dir(), bvec);
+    }
+
+    return m_dtds_last;
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    dqopds(const material<scalar_type>* vol_mat_ptr) const -> scalar_type {
+
+    // In case there was no step before
+    if (this->path_length() == 0.f) {
+        return this->dqopds((*this)().qop(), vol_mat_ptr);
+    }
+
+    return m_dqopds_last;
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE auto
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    dqopds(const scalar_type qop,
+           const material<scalar_type>* vol_mat_ptr) const -> scalar_type {
+
+    // d(qop)ds is zero for empty space
+    if (!vol_mat_ptr) {
+        return 0.f;
+    }
+
+    assert(qop != 0.f);
+    const scalar_type q = this->particle_hypothesis().charge();
+    const scalar_type p = q / qop;
+    const scalar_type mass = this->particle_hypothesis().mass();
+    const scalar_type E = math::sqrt(p * p + mass * mass);
+
+    // Compute stopping power
+    const scalar_type stopping_power =
+        interaction<scalar_type>().compute_stopping_power(
+            *vol_mat_ptr, this->particle_hypothesis(), {mass, qop, q});
+
+    // Assert that a momentum is a positive value
+    assert(p >= 0.f);
+    assert(q != 0.f);
+
+    // d(qop)ds, which is equal to (qop) * E * (-dE/ds) / p^2
+    // or equal to (qop)^3 * E * (-dE/ds) / q^2
+    return qop * qop * qop * E * stopping_power / (q * q);
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE auto
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::state::
+    d2qopdsdqop(const scalar_type qop,
+                const material<scalar_type>* vol_mat_ptr) const
+    -> scalar_type {
+
+    if (!vol_mat_ptr) {
+        return 0.f;
+    }
+
+    const scalar_type q = this->particle_hypothesis().charge();
+    const scalar_type p = q / qop;
+    const scalar_type p2 = p * p;
+
+    const auto& mass = this->particle_hypothesis().mass();
+    const scalar_type E2 = p2 + mass * mass;
+
+    // Interaction object
+    interaction<scalar_type> I;
+
+    // g = dE/ds = -1 * (-dE/ds) = -1 * stopping power
+    const detail::relativistic_quantities<scalar_type> rq(mass, qop, q);
+    const scalar_type g =
+        -1.f *
+        I.compute_stopping_power(*vol_mat_ptr, this->particle_hypothesis(), rq);
+
+    // dg/d(qop) = -1 * derivation of stopping power
+    const scalar_type dgdqop =
+        -1.f *
+        I.derive_stopping_power(*vol_mat_ptr, this->particle_hypothesis(), rq);
+
+    // d(qop)/ds = - qop^3 * E * g / q^2
+    const scalar_type dqopds = this->dqopds(qop, vol_mat_ptr);
+
+    // Check Eq 3.12 of
+    // (https://iopscience.iop.org/article/10.1088/1748-0221/4/04/P04016/meta)
+    assert(E2 != 0.f);
+    assert(g != 0.f);
+    return dqopds * (1.f / qop * (3.f - p2 / E2) + 1.f / g * dgdqop);
+}
+
+template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline bool
+detray::dormand_prince_stepper<magnetic_field_t, algebra_t, constraint_t,
+                               policy_t, inspector_t, storage_t>::
+    step(const scalar_type dist_to_next,
+         detray::dormand_prince_stepper<magnetic_field_t, algebra_t,
+                                        constraint_t, policy_t, inspector_t,
+                                        storage_t>::state& stepping,
+         const detray::stepping::config& cfg, const bool do_reset,
+         const material<scalar_type>* vol_mat_ptr) const {
+
+    // Check navigator and actor results
+    assert(dist_to_next != 0.f);
+    assert(!stepping().is_invalid());
+
+    if (do_reset) {
+        // Carry the predicted step size across the reset, if it is smaller
+        // than the distance to the next surface
+        if (cfg.predict_step_size && stepping.next_step_size() != 0.f) {
+            stepping.set_step_size(math::copysign(
+                math::min(math::fabs(stepping.next_step_size()),
+                          math::fabs(dist_to_next)),
+                dist_to_next));
+        } else {
+            stepping.set_step_size(dist_to_next);
+        }
+    } else if (stepping.next_step_size() > 0) {
+        stepping.set_step_size(
+            math::min(stepping.next_step_size(), dist_to_next));
+    } else {
+        stepping.set_step_size(
+            math::max(stepping.next_step_size(), dist_to_next));
+    }
+
+    // Check constraints before the stages are evaluated, since the stage
+    // values depend on the step size
+    if (const scalar_type max_step =
+            stepping.constraints().template size<>(stepping.direction());
+        math::fabs(stepping.step_size()) > math::fabs(max_step)) {
+
+        // Run inspection before step size is cut
+        stepping.run_inspector(cfg, "Before constraint: ");
+
+        stepping.set_step_size(max_step);
+    }
+
+    // Don't allow too small stepsizes, unless the navigation needs it
+    const scalar_type min_stepsize{
+        math::min(math::fabs(stepping.step_size()),
+                  static_cast<scalar_type>(cfg.min_stepsize))};
+
+    const auto& track = stepping();
+    const point3_type pos = track.pos();
+
+    intermediate_state sd{};
+
+    // First stage: Reuse the field of the last stage of the previous step,
+    // if the track has not been moved in the meantime (FSAL)
+    if (stepping.m_has_fsal && stepping.m_fsal_pos[0] == pos[0] &&
+        stepping.m_fsal_pos[1] == pos[1] && stepping.m_fsal_pos[2] == pos[2]) {
+        sd.b[0u] = stepping.m_fsal_b;
+        ++stepping.m_n_fsal;
+    } else {
+        sd.b[0u] = stepping.get_field(pos);
+    }
+    sd.r[0u] = pos;
+    sd.t[0u] = track.dir();
+    sd.qop[0u] = track.qop();
+    sd.dqopds[0u] = stepping.dqopds(track.qop(), vol_mat_ptr);
+    sd.dtds[0u] = sd.qop[0u] * vector::cross(sd.t[0u], sd.b[0u]);
+
+    // The high order error estimate allows long steps, over which the track
+    // can leave the volume without crossing one of the surface candidates,
+    // since these were found by a straight line extrapolation: Limit the
+    // distance to the tangent (~ h^2 * |dtds| / 2), if requested
+    const bool limit_deviation{cfg.max_step_deviation <
+                               std::numeric_limits<float>::max()};
+    if (const scalar_type curv{vector::norm(sd.dtds[0u])};
+        limit_deviation && curv > 0.f) {
+        const scalar_type max_h{math::sqrt(
+            2.f * static_cast<scalar_type>(cfg.max_step_deviation) / curv)};
+
+        if (math::fabs(stepping.step_size()) > max_h) {
+            stepping.set_step_size(
+                math::copysign(max_h, stepping.step_size()));
+        }
+    }
+
+    // Step size for which the stages were evaluated
+    scalar_type h_stages{0.f};
+    const auto evaluate_stages = [&](const scalar_type& h) {
+        for (std::size_t i = 1u; i < n_stages; ++i) {
+            stepping.evaluate_stage(sd, i, h, vol_mat_ptr, cfg);
+        }
+        h_stages = h;
+    };
+
+    /// Evaluate the remaining stages and estimate the error
+    const auto estimate_error = [&](const scalar_type& h) {
+        assert(h != 0);
+
+        evaluate_stages(h);
+
+        // Difference between the fifth and the fourth order solution
+        vector3_type err_pos{0.f, 0.f, 0.f};
+        vector3_type err_dir{0.f, 0.f, 0.f};
+        for (std::size_t i = 0u; i < n_stages; ++i) {
+            err_pos = err_pos + tableau::e(i) * sd.t[i];
+            err_dir = err_dir + tableau::e(i) * sd.dtds[i];
+        }
+
+        // The direction error is converted to the position error it causes
+        // over the length of the step
+        const scalar_type abs_h{math::fabs(h)};
+        return math::max(abs_h * vector::norm(err_pos),
+                         abs_h * abs_h * vector::norm(err_dir));
+    };
+
+    /// Calculate the scale factor for the stepsize adjustment using the error
+    /// estimate @param err
+    const auto step_size_scaling =
+        [&cfg](const scalar_type& err) -> scalar_type {
+        assert(err != 0.f);
+        return static_cast<scalar_type>(math::min(
+            math::max(math::pow(static_cast<scalar_type>(cfg.rk_error_tol) /
+                                    err,
+                                static_cast<scalar_type>(0.2)),
+                      static_cast<scalar_type>(0.25)),
+            static_cast<scalar_type>(4.)));
+    };
+
+    scalar_type error{1e20f};
+
+    // If the estimated error is larger than the tolerance with an additional
+    // margin, reduce the step size and try again
+    const auto n_trials{cfg.max_rk_updates};
+    for (unsigned int i = 0u; i < n_trials; i++) {
+        stepping.count_trials();
+
+        error = math::max(estimate_error(stepping.step_size()),
+                          static_cast<scalar_type>(1e-20));
+        assert(math::isfinite(error));
+
+        // Error is small enough
+        // ---> break and advance track
+        if (error <= 4.f * cfg.rk_error_tol) {
+            break;
+        }
+        // Error estimate is too big
+        // ---> Make step size smaller and estimate error again
+        else {
+            stepping.set_step_size(stepping.step_size() *
+                                   step_size_scaling(error));
+
+            // Run inspection while the stepsize is getting adjusted
+            stepping.run_inspector(cfg, "Adjust stepsize: ", i,
+                                   step_size_scaling(error));
+        }
+    }
+
+    // Adjust the min step size
+    if (math::fabs(stepping.step_size()) < min_stepsize) {
+        stepping.set_step_size(
+            math::copysign(min_stepsize, stepping.step_size()));
+    }
+
+    // The stages have to belong to the step that is taken
+    if (stepping.step_size() != h_stages) {
+        evaluate_stages(stepping.step_size());
+    }
+
+    // Advance jacobian transport (needs the initial track state)
+    if constexpr (base_type::has_transport_jacobian) {
+        if (cfg.do_covariance_transport) {
+            stepping.advance_jacobian(cfg, sd, vol_mat_ptr);
+        }
+    }
+
+    // Advance track state
+    stepping.advance_track(sd, vol_mat_ptr);
+    assert(!stepping().is_invalid());
+
+    // The step size estimation fot the next step
+    stepping.set_next_step_size(stepping.step_size() *
+                                step_size_scaling(error));
+
+    // Don't allow a too small step size
+    if (math::fabs(stepping.next_step_size()) < cfg.min_stepsize) {
+        stepping.set_next_step_size(
+            math::copysign(static_cast<scalar_type>(cfg.min_stepsize),
+                           stepping.next_step_size()));
+    }
+
+    // Run final inspection
+    stepping.run_inspector(cfg, "Step complete: ");
+
+    return true;
+}
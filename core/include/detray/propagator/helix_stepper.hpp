@@ -0,0 +1,244 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/navigation/policies.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
+#include "detray/tracks/helix.hpp"
+
+// System include(s).
+#include <cassert>
+#include <type_traits>
+
+namespace detray {
+
+/// Analytic helix stepper for homogeneous magnetic fields
+///
+/// In a constant field the track follows a helix, so the stepper moves the
+/// track along the exact trajectory in a single step and transports the
+/// covariance with the analytic helix jacobian. The field is sampled once,
+/// when the stepping state is constructed.
+///
+/// @note Energy loss in the volume material is not taken into account.
+///
+/// @tparam magnetic_field_t the type of magnetic field (needs to be constant)
+/// @tparam constraint_ the type of constraints on the stepper
+/// @tparam storage_t storage options of the state (@see stepping::storage )
+template <typename magnetic_field_t, concepts::algebra algebra_t,
+          typename constraint_t = unconstrained_step<dscalar<algebra_t>>,
+          typename policy_t = stepper_default_policy<dscalar<algebra_t>>,
+          typename inspector_t = stepping::void_inspector,
+          typename storage_t = stepping::inline_storage>
+class helix_stepper final
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t,
+                          storage_t> {
+
+    static_assert(detail::is_constant_field_v<magnetic_field_t>,
+                  "The helix stepper needs a homogeneous magnetic field");
+
+    using base_type =
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t, storage_t>;
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using magnetic_field_type = magnetic_field_t;
+    template <std::size_t ROWS, std::size_t COLS>
+    using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
+
+    helix_stepper() = default;
+
+    struct state : public base_type::state {
+
+        static constexpr const stepping::id id = stepping::id::e_helix;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : base_type::state(t),
+              m_magnetic_field(mag_field),
+              m_b_field{sample_field(mag_field, t.pos())} {}
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det,
+            const typename detector_t::geometry_context& ctx)
+            : base_type::state(bound_params, det, ctx),
+              m_magnetic_field(mag_field),
+              m_b_field{sample_field(mag_field, (*this)().pos())} {}
+
+        /// @returns the B-field view
+        magnetic_field_type field() const { return m_magnetic_field; }
+
+        /// @returns the field vector
+        DETRAY_HOST_DEVICE
+        const vector3_type& b_field() const { return m_b_field; }
+
+        /// @returns true if the track is bent by the field
+        DETRAY_HOST_DEVICE
+        inline bool is_curved() const {
+            return vector::norm(m_b_field) > 0.f && (*this)().qop() != 0.f;
+        }
+
+        /// @returns the helix that starts at the current track position
+        /// (the origin is at zero, so that it yields the displacement)
+        DETRAY_HOST_DEVICE
+        inline detail::helix<algebra_t> local_helix() const {
+            const auto& track = (*this)();
+            return {point3_type{0.f, 0.f, 0.f}, track.time(), track.dir(),
+                    track.qop(), m_b_field};
+        }
+
+        /// Update the track state along the helix @param hlx
+        DETRAY_HOST_DEVICE
+        inline void advance_track(const detail::helix<algebra_t>& hlx) {
+            const scalar_type h{this->step_size()};
+
+            this->advance_pos(hlx.pos(h));
+            (*this)().set_dir(hlx.dir(h));
+
+            this->update_path_lengths(h);
+        }
+
+        /// Update the track state in a straight line (no field or neutral)
+        DETRAY_HOST_DEVICE
+        inline void advance_track() {
+            this->advance_pos((*this)().dir() * this->step_size());
+
+            this->update_path_lengths(this->step_size());
+        }
+
+        /// Update the jacobian transport with the helix jacobian of @param hlx
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian(const detail::helix<algebra_t>& hlx) {
+            this->set_transport_jacobian(matrix::multiply_8x8(
+                hlx.jacobian(this->step_size()), this->transport_jacobian()));
+        }
+
+        /// Update the jacobian transport for a straight line step
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian() {
+            free_matrix<algebra_t> D =
+                matrix::identity<free_matrix<algebra_t>>();
+
+            // d(x,y,z)/d(n_x,n_y,n_z)
+            matrix_type<3, 3> dxdn =
+                this->step_size() * matrix::identity<matrix_type<3, 3>>();
+            getter::set_block(D, dxdn, e_free_pos0, e_free_dir0);
+
+            this->set_transport_jacobian(
+                matrix::multiply_8x8(D, this->transport_jacobian()));
+        }
+
+        /// Evaluate dtds, where t is the unit tangential direction
+        DETRAY_HOST_DEVICE
+        inline vector3_type dtds() const {
+            return (*this)().qop() * vector::cross((*this)().dir(), m_b_field);
+        }
+
+        /// Evaulate d(qop)/ds (no energy loss)
+        DETRAY_HOST_DEVICE
+        constexpr scalar_type dqopds(const material<scalar_type>*) const {
+            return 0.f;
+        }
+
+        private:
+        /// @returns the field vector at the position @param pos
+        DETRAY_HOST_DEVICE
+        static inline vector3_type sample_field(const magnetic_field_t& field,
+                                                const point3_type& pos) {
+            const auto bvec = field.at(pos[0], pos[1], pos[2]);
+            assert(math::isfinite(bvec[0]));
+            assert(math::isfinite(bvec[1]));
+            assert(math::isfinite(bvec[2]));
+
+            return {bvec[0], bvec[1], bvec[2]};
+        }
+
+        /// Magnetic field view
+        const magnetic_field_t m_magnetic_field;
+
+        /// Field vector (the same everywhere)
+        vector3_type m_b_field;
+    };
+
+    /// Take a step along the helix, regulated by a constrained step
+    ///
+    /// @param dist_to_next The distance to the next surface
+    /// @param stepping The state object of a stepper
+    /// @param cfg The stepping configuration
+    ///
+    /// @returns returning the heartbeat, indicating if the stepping is alive
+    DETRAY_HOST_DEVICE bool step(const scalar_type dist_to_next,
+                                 state& stepping, const stepping::config& cfg,
+                                 const bool = true,
+                                 const material<scalar_type>* = nullptr) const {
+
+        assert(dist_to_next != 0.f);
+        assert(!stepping().is_invalid());
+
+        // The trajectory is exact: Go to the next surface in one step
+        stepping.set_step_size(dist_to_next);
+
+        // Check constraints
+        if (const scalar_type max_step =
+                stepping.constraints().template size<>(stepping.direction());
+            math::fabs(stepping.step_size()) > math::fabs(max_step)) {
+
+            // Run inspection before step size is cut
+            stepping.run_inspector(cfg, "Before constraint: ");
+
+            stepping.set_step_size(max_step);
+        }
+
+        if (stepping.is_curved()) {
+            const detail::helix<algebra_t> hlx{stepping.local_helix()};
+
+            // Advance jacobian transport (needs the initial track state)
+            if constexpr (base_type::has_transport_jacobian) {
+                if (cfg.do_covariance_transport) {
+                    stepping.advance_jacobian(hlx);
+                }
+            }
+
+            stepping.advance_track(hlx);
+        } else {
+            if constexpr (base_type::has_transport_jacobian) {
+                if (cfg.do_covariance_transport) {
+                    stepping.advance_jacobian();
+                }
+            }
+
+            stepping.advance_track();
+        }
+        assert(!stepping().is_invalid());
+
+        // Count the number of steps
+        stepping.count_trials();
+
+        // Run inspection if needed
+        stepping.run_inspector(cfg, "Step complete: ");
+
+        return true;
+    }
+};
+
+}  // namespace detray
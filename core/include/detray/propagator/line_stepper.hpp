@@ -20,12 +20,14 @@ namespace detray {
 template <concepts::algebra algebra_t,
           typename constraint_t = unconstrained_step<dscalar<algebra_t>>,
           typename policy_t = stepper_default_policy<dscalar<algebra_t>>,
-          typename inspector_t = stepping::void_inspector>
+          typename inspector_t = stepping::void_inspector,
+          typename storage_t = stepping::inline_storage>
 class line_stepper final
-    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t,
+                          storage_t> {
 
     using base_type =
-        base_stepper<algebra_t, constraint_t, policy_t, inspector_t>;
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t, storage_t>;
 
     public:
     using algebra_type = algebra_t;
@@ -50,8 +52,7 @@ class line_stepper final
         /// Update the track state in a straight line.
         DETRAY_HOST_DEVICE
         inline void advance_track() {
-            auto& track = (*this)();
-            track.set_pos(track.pos() + track.dir() * this->step_size());
+            this->advance_pos((*this)().dir() * this->step_size());
 
             this->update_path_lengths(this->step_size());
         }
@@ -71,7 +72,8 @@ class line_stepper final
             /// NOTE: Let's skip the element for d(time)/d(qoverp) for the
             /// moment..
 
-            this->set_transport_jacobian(D * this->transport_jacobian());
+            this->set_transport_jacobian(
+                matrix::multiply_8x8(D, this->transport_jacobian()));
         }
 
         DETRAY_HOST_DEVICE
@@ -113,8 +115,10 @@ class line_stepper final
         stepping.advance_track();
 
         // Advance jacobian transport
-        if (cfg.do_covariance_transport) {
-            stepping.advance_jacobian();
+        if constexpr (base_type::has_transport_jacobian) {
+            if (cfg.do_covariance_transport) {
+                stepping.advance_jacobian();
+            }
         }
 
         // Count the number of steps
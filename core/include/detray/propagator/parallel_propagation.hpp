@@ -0,0 +1,606 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory_resource>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray::propagation {
+
+/// Configuration of the host-side parallel propagation
+struct parallel_config {
+    /// Number of worker threads (zero: use the hardware concurrency)
+    std::size_t n_threads{0u};
+    /// Number of tracks a worker takes from its queue at a time
+    std::size_t chunk_size{8u};
+    /// Adapt the particle hypothesis to the charge of every track
+    bool update_particle_hypothesis{true};
+    /// Size of the per-thread arena for transient per-track allocations in
+    /// bytes (zero: allocate directly from the upstream resource)
+    std::size_t arena_size{64u * 1024u};
+    /// Upstream resource of the arenas (null: new/delete resource)
+    vecmem::memory_resource *upstream_mr{nullptr};
+    /// Number of tracks a worker advances in turns, one step at a time, so
+    /// that the memory accesses of one track overlap with the computations
+    /// of the others (one: propagate every track to the end). Does not apply
+    /// to the arena-aware propagation with a user provided track kernel
+    std::size_t n_interleaved{1u};
+};
+
+namespace detail {
+
+/// @brief Range of track indices [begin, end) that is owned by a worker.
+///
+/// Both bounds are packed into a single atomic word: The owning worker takes
+/// chunks from the front of the range, while idle workers steal the back half
+/// of the remaining range.
+class alignas(64) work_range {
+
+    static constexpr std::uint64_t lower_mask{0xffffffffu};
+
+    public:
+    /// Set a new range (only called while no other thread steals from it)
+    void assign(const std::uint32_t begin, const std::uint32_t end) {
+        m_range.store(pack(begin, end), std::memory_order_release);
+    }
+
+    /// Take up to @param chunk_size indices from the front of the range
+    ///
+    /// @returns false if the range was empty
+    bool pop_front(const std::uint32_t chunk_size, std::uint32_t &begin,
+                   std::uint32_t &end) {
+        std::uint64_t range = m_range.load(std::memory_order_acquire);
+        while (true) {
+            const auto [b, e] = unpack(range);
+            if (b >= e) {
+                return false;
+            }
+            const std::uint32_t new_b{std::min(e, b + chunk_size)};
+            if (m_range.compare_exchange_weak(range, pack(new_b, e),
+                                              std::memory_order_acq_rel)) {
+                begin = b;
+                end = new_b;
+                return true;
+            }
+        }
+    }
+
+    /// Steal the back half of the remaining range
+    ///
+    /// @returns false if there was nothing left to steal
+    bool steal_back(std::uint32_t &begin, std::uint32_t &end) {
+        std::uint64_t range = m_range.load(std::memory_order_acquire);
+        while (true) {
+            const auto [b, e] = unpack(range);
+            if (b >= e) {
+                return false;
+            }
+            const std::uint32_t mid{b + (e - b) / 2u};
+            if (m_range.compare_exchange_weak(range, pack(b, mid),
+                                              std::memory_order_acq_rel)) {
+                begin = mid;
+                end = e;
+                return true;
+            }
+        }
+    }
+
+    private:
+    static constexpr std::uint64_t pack(const std::uint32_t b,
+                                        const std::uint32_t e) {
+        return (static_cast<std::uint64_t>(b) << 32u) | e;
+    }
+
+    static constexpr std::pair<std::uint32_t, std::uint32_t> unpack(
+        const std::uint64_t range) {
+        return {static_cast<std::uint32_t>(range >> 32u),
+                static_cast<std::uint32_t>(range & lower_mask)};
+    }
+
+    std::atomic<std::uint64_t> m_range{0u};
+};
+
+/// @brief Hands out the track indices to the workers of the pool.
+///
+/// The tracks are initially partitioned evenly among the workers. Every
+/// worker takes chunks from its own range and steals from the other workers
+/// once its range is empty.
+class track_queue {
+
+    public:
+    /// Partition @param n_tracks tracks among @param n_threads workers
+    track_queue(const std::uint32_t n_tracks, const std::size_t n_threads,
+                const std::uint32_t chunk_size)
+        : m_ranges{std::make_unique<work_range[]>(n_threads)},
+          m_n_threads{n_threads},
+          m_chunk_size{chunk_size} {
+        for (std::size_t t = 0u; t < n_threads; ++t) {
+            m_ranges[t].assign(
+                static_cast<std::uint32_t>(t * n_tracks / n_threads),
+                static_cast<std::uint32_t>((t + 1u) * n_tracks / n_threads));
+        }
+    }
+
+    /// Take the next chunk of track indices [@param begin, @param end) for
+    /// the worker @param thread_idx
+    ///
+    /// @returns false if no tracks are left
+    bool next_chunk(const std::size_t thread_idx, std::uint32_t &begin,
+                    std::uint32_t &end) {
+        // Work through the own range first
+        if (m_ranges[thread_idx].pop_front(m_chunk_size, begin, end)) {
+            return true;
+        }
+
+        // Then try to steal from the other workers
+        for (std::size_t k = 1u; k < m_n_threads; ++k) {
+            const std::size_t victim{(thread_idx + k) % m_n_threads};
+            if (m_ranges[victim].steal_back(begin, end)) {
+                m_ranges[thread_idx].assign(begin, end);
+                return m_ranges[thread_idx].pop_front(m_chunk_size, begin,
+                                                      end);
+            }
+        }
+
+        return false;
+    }
+
+    private:
+    std::unique_ptr<work_range[]> m_ranges;
+    std::size_t m_n_threads;
+    std::uint32_t m_chunk_size;
+};
+
+/// @returns the number of worker threads for @param n_tracks tracks
+DETRAY_HOST inline std::size_t n_workers(const parallel_config &cfg,
+                                         const std::uint32_t n_tracks) {
+    std::size_t n_threads{cfg.n_threads};
+    if (n_threads == 0u) {
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return std::min(n_threads, static_cast<std::size_t>(n_tracks));
+}
+
+/// Run @param worker on @param n_threads threads, including the calling
+/// thread
+///
+/// If workers throw, all threads are joined first and then the exception of
+/// the worker with the lowest index is rethrown.
+template <typename worker_t>
+DETRAY_HOST inline void run_pool(const std::size_t n_threads,
+                                 worker_t &&worker) {
+    std::vector<std::exception_ptr> errors(n_threads);
+
+    auto guarded_worker = [&worker, &errors](const std::size_t thread_idx) {
+        try {
+            worker(thread_idx);
+        } catch (...) {
+            errors[thread_idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> pool{};
+    pool.reserve(n_threads - 1u);
+    auto join_all = [&pool]() {
+        for (auto &thread : pool) {
+            thread.join();
+        }
+    };
+
+    try {
+        for (std::size_t t = 1u; t < n_threads; ++t) {
+            pool.emplace_back(guarded_worker, t);
+        }
+    } catch (...) {
+        // A thread could not be started: Wait for the ones that run
+        join_all();
+        throw;
+    }
+    guarded_worker(0u);
+    join_all();
+
+    for (const std::exception_ptr &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/// Run the propagation of all @param tracks on a pool of worker threads
+///
+/// @param prop the propagator that is handed to @param propagate_track
+/// @param propagate_track callable that runs the propagation of track @c i
+///        with a prepared propagation state and the arena of the worker
+template <typename propagator_t, typename track_kernel_t,
+          typename... field_t>
+DETRAY_HOST inline std::size_t parallel_propagate_impl(
+    const propagator_t &prop, const typename propagator_t::detector_type &det,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    track_kernel_t &&propagate_track, const parallel_config &cfg,
+    const typename propagator_t::detector_type::geometry_context &ctx,
+    const field_t &... field) {
+
+    using propagation_state_t = typename propagator_t::state;
+
+    assert(tracks.size() < std::numeric_limits<std::uint32_t>::max());
+
+    const auto n_tracks{static_cast<std::uint32_t>(tracks.size())};
+    if (n_tracks == 0u) {
+        return 0u;
+    }
+
+    const std::size_t n_threads{n_workers(cfg, n_tracks)};
+    const auto chunk_size{
+        static_cast<std::uint32_t>(std::max(cfg.chunk_size, std::size_t{1u}))};
+
+    track_queue queue(n_tracks, n_threads, chunk_size);
+
+    std::atomic<std::size_t> n_success{0u};
+
+    vecmem::memory_resource *upstream_mr{cfg.upstream_mr != nullptr
+                                             ? cfg.upstream_mr
+                                             : std::pmr::new_delete_resource()};
+
+    auto worker = [&](const std::size_t thread_idx) {
+        // Propagation state that is reused for all tracks of this worker
+        std::optional<propagation_state_t> propagation{};
+        std::size_t n_local_success{0u};
+
+        // Thread-local arena: Released after every track, so that the
+        // transient per-track storage is recycled instead of reallocated
+        std::vector<std::byte> arena_buffer(cfg.arena_size);
+        std::optional<std::pmr::monotonic_buffer_resource> arena{};
+        if (cfg.arena_size > 0u) {
+            arena.emplace(arena_buffer.data(), arena_buffer.size(),
+                          upstream_mr);
+        }
+        vecmem::memory_resource &track_mr =
+            arena.has_value() ? *arena : *upstream_mr;
+
+        auto run = [&](const std::uint32_t i) {
+            const auto &track = tracks[i];
+
+            if (!propagation.has_value()) {
+                propagation.emplace(track, field..., det, ctx);
+            } else {
+                propagation->reset(track, field...);
+            }
+
+            if (cfg.update_particle_hypothesis) {
+                const auto &ptc = propagation->_stepping.particle_hypothesis();
+                propagation->set_particle(
+                    detray::update_particle_hypothesis(ptc, track));
+            }
+
+            const bool success{
+                propagate_track(prop, i, *propagation, track_mr)};
+            n_local_success += success ? 1u : 0u;
+
+            if (arena.has_value()) {
+                arena->release();
+            }
+        };
+
+        std::uint32_t begin{0u};
+        std::uint32_t end{0u};
+        while (queue.next_chunk(thread_idx, begin, end)) {
+            for (std::uint32_t i = begin; i < end; ++i) {
+                run(i);
+            }
+        }
+
+        n_success.fetch_add(n_local_success, std::memory_order_relaxed);
+    };
+
+    // The calling thread takes part in the work as well
+    run_pool(n_threads, worker);
+
+    return n_success.load();
+}
+
+/// @brief Run the propagation of all @param tracks on a pool of worker
+/// threads, where every worker advances several tracks in turns.
+///
+/// A worker keeps up to @c parallel_config::n_interleaved propagations in
+/// flight and takes one step of each in turn (manual interleaving over
+/// @c propagator::propagate_step ). While one track waits for the detector
+/// data of its navigation update to arrive, the other tracks keep the core
+/// busy. A finished track is immediately replaced by the next one from the
+/// queue.
+template <typename propagator_t, typename actor_states_t, typename... field_t>
+DETRAY_HOST inline std::size_t interleaved_propagate_states(
+    const propagator_t &prop, const typename propagator_t::detector_type &det,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    std::span<actor_states_t> actor_states, const parallel_config &cfg,
+    const typename propagator_t::detector_type::geometry_context &ctx,
+    const field_t &... field) {
+
+    using propagation_state_t = typename propagator_t::state;
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    assert(tracks.size() < std::numeric_limits<std::uint32_t>::max());
+
+    const auto n_tracks{static_cast<std::uint32_t>(tracks.size())};
+    if (n_tracks == 0u) {
+        return 0u;
+    }
+
+    const std::size_t n_threads{n_workers(cfg, n_tracks)};
+    const auto chunk_size{
+        static_cast<std::uint32_t>(std::max(cfg.chunk_size, std::size_t{1u}))};
+
+    track_queue queue(n_tracks, n_threads, chunk_size);
+
+    std::atomic<std::size_t> n_success{0u};
+
+    /// A propagation that is in flight on a worker
+    struct slot {
+        std::optional<propagation_state_t> propagation{};
+        std::optional<actor_states_t> default_states{};
+        actor_states_t *states{nullptr};
+        bool is_init{false};
+        bool is_active{false};
+    };
+
+    auto worker = [&](const std::size_t thread_idx) {
+        std::vector<slot> slots(std::max(cfg.n_interleaved, std::size_t{1u}));
+        std::size_t n_local_success{0u};
+
+        // Tracks of the current chunk
+        std::uint32_t next{0u};
+        std::uint32_t end{0u};
+
+        // Start the propagation of the next track in @param s
+        auto start = [&](slot &s) {
+            if (next == end && !queue.next_chunk(thread_idx, next, end)) {
+                return false;
+            }
+            const std::uint32_t i{next++};
+            const auto &track = tracks[i];
+
+            if (!s.propagation.has_value()) {
+                s.propagation.emplace(track, field..., det, ctx);
+            } else {
+                s.propagation->reset(track, field...);
+            }
+
+            if (cfg.update_particle_hypothesis) {
+                const auto &ptc =
+                    s.propagation->_stepping.particle_hypothesis();
+                s.propagation->set_particle(
+                    detray::update_particle_hypothesis(ptc, track));
+            }
+
+            if (!actor_states.empty()) {
+                s.states = &actor_states[i];
+            } else if constexpr (std::default_initializable<actor_states_t>) {
+                // Fresh actor states for every track
+                s.default_states.emplace();
+                s.states = &(*s.default_states);
+            }
+
+            prop.propagate_init(*s.propagation,
+                                actor_chain_t::setup_actor_states(*s.states));
+            s.is_init = true;
+            s.is_active = true;
+
+            return true;
+        };
+
+        std::size_t n_active{0u};
+        for (auto &s : slots) {
+            n_active += start(s) ? 1u : 0u;
+        }
+
+        // Take one step of every track in turn
+        while (n_active > 0u) {
+            for (auto &s : slots) {
+                if (!s.is_active) {
+                    continue;
+                }
+
+                auto &propagation = *s.propagation;
+                if (propagation.is_alive()) {
+                    s.is_init = prop.propagate_step(
+                        propagation, s.is_init,
+                        actor_chain_t::setup_actor_states(*s.states));
+                    continue;
+                }
+
+                // Finished: Replace by the next track
+                const bool success{prop.is_complete(propagation) ||
+                                   prop.is_paused(propagation)};
+                n_local_success += success ? 1u : 0u;
+                s.is_active = false;
+                --n_active;
+
+                n_active += start(s) ? 1u : 0u;
+            }
+        }
+
+        n_success.fetch_add(n_local_success, std::memory_order_relaxed);
+    };
+
+    run_pool(n_threads, worker);
+
+    return n_success.load();
+}
+
+/// Propagate with caller provided actor states, or with default constructed
+/// actor states, if @param actor_states is empty
+template <typename propagator_t, typename actor_states_t, typename... field_t>
+DETRAY_HOST inline std::size_t parallel_propagate_states(
+    const propagator_t &prop, const typename propagator_t::detector_type &det,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    std::span<actor_states_t> actor_states, const parallel_config &cfg,
+    const typename propagator_t::detector_type::geometry_context &ctx,
+    const field_t &... field) {
+
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    assert(actor_states.empty() || actor_states.size() == tracks.size());
+
+    if constexpr (!std::default_initializable<actor_states_t>) {
+        if (actor_states.empty() && !tracks.empty()) {
+            throw std::invalid_argument(
+                "Parallel propagation: Actor states need to be provided");
+        }
+    }
+
+    auto propagate_track = [actor_states](
+                               const propagator_t &p, const std::size_t i,
+                               typename propagator_t::state &propagation,
+                               vecmem::memory_resource &) {
+        if (!actor_states.empty()) {
+            return p.propagate(propagation, actor_chain_t::setup_actor_states(
+                                                 actor_states[i]));
+        } else if constexpr (std::default_initializable<actor_states_t>) {
+            // Fresh actor states for every track
+            actor_states_t default_states{};
+            return p.propagate(
+                propagation, actor_chain_t::setup_actor_states(default_states));
+        }
+        return false;
+    };
+
+    if (cfg.n_interleaved > 1u) {
+        return interleaved_propagate_states(prop, det, tracks, actor_states,
+                                            cfg, ctx, field...);
+    }
+
+    return parallel_propagate_impl(prop, det, tracks, propagate_track, cfg,
+                                   ctx, field...);
+}
+
+}  // namespace detail
+
+/// @brief Propagate a collection of tracks on a work-stealing thread pool.
+///
+/// Every worker owns a contiguous range of track indices and processes it in
+/// chunks. Workers that run out of tracks steal half of the remaining range of
+/// another worker, so that long-running tracks don't stall the pool. The
+/// propagation state is created once per worker and reset between tracks.
+///
+/// @param prop the propagator (shared by all workers, must be stateless)
+/// @param det the detector to propagate through
+/// @param field the magnetic field (view) that is passed to the stepper
+/// @param tracks the initial track parameters
+/// @param actor_states one actor state tuple per track, which will be
+///        updated during the propagation. If empty, default constructed actor
+///        states are used for every track.
+/// @param cfg the configuration of the parallel propagation
+/// @param ctx the geometry context
+///
+/// @returns the number of tracks that were propagated successfully
+template <typename propagator_t, typename field_t>
+DETRAY_HOST inline std::size_t parallel_propagate(
+    const propagator_t &prop, const typename propagator_t::detector_type &det,
+    const field_t &field,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    std::span<typename propagator_t::actor_chain_type::state_tuple>
+        actor_states = {},
+    const parallel_config &cfg = {},
+    const typename propagator_t::detector_type::geometry_context &ctx = {}) {
+    return detail::parallel_propagate_states(prop, det, tracks, actor_states,
+                                             cfg, ctx, field);
+}
+
+/// @brief Propagate a collection of tracks on a work-stealing thread pool,
+/// without magnetic field (e.g. straight line stepper).
+///
+/// @see parallel_propagate above
+template <typename propagator_t>
+DETRAY_HOST inline std::size_t parallel_propagate(
+    const propagator_t &prop, const typename propagator_t::detector_type &det,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    std::span<typename propagator_t::actor_chain_type::state_tuple>
+        actor_states = {},
+    const parallel_config &cfg = {},
+    const typename propagator_t::detector_type::geometry_context &ctx = {}) {
+    return detail::parallel_propagate_states(prop, det, tracks, actor_states,
+                                             cfg, ctx);
+}
+
+/// @brief Propagate a collection of tracks on a work-stealing thread pool and
+/// build the actor states of every track in the per-thread arena.
+///
+/// The @param propagate_track callable is invoked for every track index with
+/// the propagator @param prop , the prepared propagation state and the arena
+/// of the worker thread. It
+/// should set up the actor states (e.g. the buffers of a
+/// @c barcode_sequencer) from the arena, run the propagation, copy out the
+/// results and return whether the propagation succeeded. The arena is
+/// released once the callable returns, so no arena allocation must outlive
+/// the call.
+///
+/// @note The memory resource argument of the callable is the only hook into
+/// the arena: The propagation state does not carry a resource, since the
+/// propagator, the stepper and the navigator do not allocate per track.
+///
+/// @see parallel_propagate above
+template <typename propagator_t, typename field_t, typename track_kernel_t>
+requires std::is_invocable_r_v<bool, track_kernel_t, const propagator_t &,
+                               std::size_t, typename propagator_t::state &,
+                               vecmem::memory_resource &>
+    DETRAY_HOST inline std::size_t parallel_propagate(
+        const propagator_t &prop,
+        const typename propagator_t::detector_type &det, const field_t &field,
+        std::span<const typename propagator_t::free_track_parameters_type>
+            tracks,
+        track_kernel_t &&propagate_track, const parallel_config &cfg = {},
+        const typename propagator_t::detector_type::geometry_context &ctx =
+            {}) {
+    return detail::parallel_propagate_impl(
+        prop, det, tracks, std::forward<track_kernel_t>(propagate_track), cfg,
+        ctx, field);
+}
+
+/// @brief Arena-aware parallel propagation without magnetic field.
+///
+/// @see parallel_propagate above
+template <typename propagator_t, typename track_kernel_t>
+requires std::is_invocable_r_v<bool, track_kernel_t, const propagator_t &,
+                               std::size_t, typename propagator_t::state &,
+                               vecmem::memory_resource &>
+    DETRAY_HOST inline std::size_t parallel_propagate(
+        const propagator_t &prop,
+        const typename propagator_t::detector_type &det,
+        std::span<const typename propagator_t::free_track_parameters_type>
+            tracks,
+        track_kernel_t &&propagate_track, const parallel_config &cfg = {},
+        const typename propagator_t::detector_type::geometry_context &ctx =
+            {}) {
+    return detail::parallel_propagate_impl(
+        prop, det, tracks, std::forward<track_kernel_t>(propagate_track), cfg,
+        ctx);
+}
+
+}  // namespace detray::propagation
@@ -0,0 +1,215 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/navigation_config.hpp"
+
+// System include(s)
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+
+namespace detray::propagation {
+
+/// The phases of the propagation flow that are timed
+enum class phase : std::uint_least8_t {
+    /// Initialization of the navigation
+    e_init = 0u,
+    /// Step of the stepper, incl. the step policy
+    e_stepper = 1u,
+    /// Navigation updates per trust level
+    /// @{
+    e_update_no_trust = 2u,
+    e_update_fair_trust = 3u,
+    e_update_high_trust = 4u,
+    e_update_full_trust = 5u,
+    /// @}
+    /// All actors
+    e_actors = 6u,
+    e_size = 7u,
+};
+
+/// @returns the phase of a navigation update with trust level @param tl
+DETRAY_HOST_DEVICE
+constexpr phase update_phase(const navigation::trust_level tl) {
+    switch (tl) {
+        case navigation::trust_level::e_no_trust:
+            return phase::e_update_no_trust;
+        case navigation::trust_level::e_fair:
+            return phase::e_update_fair_trust;
+        case navigation::trust_level::e_high:
+            return phase::e_update_high_trust;
+        default:
+            return phase::e_update_full_trust;
+    }
+}
+
+/// Accumulated time and number of calls per propagation phase and actor
+struct timing_record {
+
+    /// Number of phases
+    static constexpr std::size_t n_phases{
+        static_cast<std::size_t>(phase::e_size)};
+    /// Maximal number of actors (in the top level of the actor chain)
+    static constexpr std::size_t max_actors{16u};
+
+    /// Time per phase in nanoseconds
+    darray<std::uint64_t, n_phases> phase_ns{};
+    /// Number of calls per phase
+    darray<std::uint64_t, n_phases> phase_calls{};
+    /// Time per actor in nanoseconds
+    darray<std::uint64_t, max_actors> actor_ns{};
+
+    /// @returns the time of the phase @param p in nanoseconds
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t time(const phase p) const {
+        return phase_ns[static_cast<std::size_t>(p)];
+    }
+
+    /// @returns the number of calls of the phase @param p
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t calls(const phase p) const {
+        return phase_calls[static_cast<std::size_t>(p)];
+    }
+
+    /// @returns the time spent in all phases in nanoseconds
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t total_time() const {
+        std::uint64_t t{0u};
+        for (const std::uint64_t t_phase : phase_ns) {
+            t += t_phase;
+        }
+        return t;
+    }
+
+    /// Add the timings of @param other (e.g. to aggregate per thread)
+    DETRAY_HOST_DEVICE
+    constexpr timing_record &operator+=(const timing_record &other) {
+        for (std::size_t i = 0u; i < n_phases; ++i) {
+            phase_ns[i] += other.phase_ns[i];
+            phase_calls[i] += other.phase_calls[i];
+        }
+        for (std::size_t i = 0u; i < max_actors; ++i) {
+            actor_ns[i] += other.actor_ns[i];
+        }
+        return *this;
+    }
+
+    /// Print the timings
+    DETRAY_HOST
+    friend std::ostream &operator<<(std::ostream &out,
+                                    const timing_record &rec) {
+        constexpr const char *names[n_phases]{
+            "Navigation init       ", "Stepper               ",
+            "Update (no trust)     ", "Update (fair trust)   ",
+            "Update (high trust)   ", "Update (full trust)   ",
+            "Actors                "};
+
+        const double total{static_cast<double>(rec.total_time())};
+        for (std::size_t i = 0u; i < n_phases; ++i) {
+            const auto t{static_cast<double>(rec.phase_ns[i])};
+            out << "  " << names[i] << ": " << std::setw(12) << t * 1e-3
+                << " us (" << std::setw(5) << std::fixed
+                << std::setprecision(1)
+                << (total > 0. ? 100. * t / total : 0.) << "%, "
+                << rec.phase_calls[i] << " calls)\n";
+            out.unsetf(std::ios_base::floatfield);
+        }
+        for (std::size_t i = 0u; i < max_actors; ++i) {
+            if (rec.actor_ns[i] > 0u) {
+                out << "    Actor " << std::setw(2) << i << "            : "
+                    << std::setw(12)
+                    << static_cast<double>(rec.actor_ns[i]) * 1e-3 << " us\n";
+            }
+        }
+
+        return out;
+    }
+};
+
+/// Timer that does not measure anything (default of the propagator)
+struct void_timer {
+
+    /// Empty time stamp
+    struct time_point {};
+
+    DETRAY_HOST_DEVICE
+    constexpr time_point start() const { return {}; }
+
+    DETRAY_HOST_DEVICE
+    constexpr void stop(const phase, const time_point) const {
+        /*Do nothing*/
+    }
+
+    DETRAY_HOST_DEVICE
+    constexpr void stop_actor(const std::size_t, const time_point) const {
+        /*Do nothing*/
+    }
+};
+
+/// @brief Measures the time spent in the phases of the propagation.
+///
+/// Accumulates the wall-clock time of the stepper, of the navigation updates
+/// per trust level and of every actor in the propagation state. The record is
+/// not cleared when the propagation state is reset, so that a state that is
+/// reused for the tracks of a thread aggregates the timings of the thread.
+///
+/// @note Host only: Uses the steady clock of the standard library.
+struct phase_timer {
+
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+
+    /// @returns the current time stamp
+    DETRAY_HOST
+    time_point start() const { return clock_type::now(); }
+
+    /// Add the time since @param t0 to the phase @param p
+    DETRAY_HOST
+    void stop(const phase p, const time_point t0) {
+        const auto i{static_cast<std::size_t>(p)};
+        m_record.phase_ns[i] += elapsed(t0);
+        ++m_record.phase_calls[i];
+    }
+
+    /// Add the time since @param t0 to the actor at position @param i in
+    /// the actor chain
+    DETRAY_HOST
+    void stop_actor(const std::size_t i, const time_point t0) {
+        const std::size_t idx{i < timing_record::max_actors
+                                  ? i
+                                  : timing_record::max_actors - 1u};
+        m_record.actor_ns[idx] += elapsed(t0);
+    }
+
+    /// @returns the accumulated timings
+    DETRAY_HOST
+    const timing_record &record() const { return m_record; }
+
+    /// Clear the accumulated timings
+    DETRAY_HOST
+    void reset() { m_record = {}; }
+
+    private:
+    /// @returns the time since @param t0 in nanoseconds
+    DETRAY_HOST
+    static std::uint64_t elapsed(const time_point t0) {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                clock_type::now() - t0)
+                .count());
+    }
+
+    timing_record m_record{};
+};
+
+}  // namespace detray::propagation
@@ -16,11 +16,19 @@
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/base_stepper.hpp"
 #include "detray/propagator/concepts.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
 #include "detray/propagator/propagation_config.hpp"
+#include "detray/propagator/propagation_timer.hpp"
+#include "detray/tracks/detail/concepts.hpp"
+#include "detray/tracks/helix.hpp"
 #include "detray/tracks/tracks.hpp"
 
 // System include(s).
+#include <concepts>
 #include <iomanip>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace detray {
 
@@ -29,8 +37,12 @@ namespace detray {
 ///
 /// @tparam stepper_t for the transport
 /// @tparam navigator_t for the navigation
+/// @tparam actor_chain_t the actors that are run after every step
+/// @tparam timer_t measures the time spent in the propagation phases
+///                 (@see propagation::phase_timer ), no timing by default
 template <typename stepper_t, typename navigator_t,
-          concepts::actor_chain actor_chain_t>
+          concepts::actor_chain actor_chain_t,
+          typename timer_t = propagation::void_timer>
 struct propagator {
 
     using stepper_type = stepper_t;
@@ -38,8 +50,11 @@ struct propagator {
     using intersection_type = typename navigator_type::intersection_type;
     using detector_type = typename navigator_type::detector_type;
     using actor_chain_type = actor_chain_t;
+    using timer_type = timer_t;
     using algebra_type = typename stepper_t::algebra_type;
     using scalar_type = dscalar<algebra_type>;
+    using point3_type = dpoint3D<algebra_type>;
+    using vector3_type = dvector3D<algebra_type>;
     using free_track_parameters_type =
         typename stepper_t::free_track_parameters_type;
     using bound_track_parameters_type =
@@ -139,6 +154,77 @@ struct propagator {
             _navigation.set_volume(param.surface_link().volume());
         }
 
+        /// Construct the propagation state from free track parameters in a
+        /// user-provided layout (e.g. a proxy into a track collection). The
+        /// remaining arguments are the same as for @c free_track_parameters
+        template <concepts::free_track_params track_t, typename... args_t>
+        requires(!std::same_as<track_t, free_track_parameters_type>)
+            DETRAY_HOST_DEVICE
+            state(const track_t &track, args_t &&... args)
+            : state(free_track_parameters_type{track},
+                    std::forward<args_t>(args)...) {}
+
+        /// Construct the propagation state from bound track parameters in a
+        /// user-provided layout (e.g. a proxy into a track collection). The
+        /// remaining arguments are the same as for @c bound_track_parameters
+        template <concepts::bound_track_params track_t, typename... args_t>
+        requires(!std::same_as<track_t, bound_track_parameters_type>)
+            DETRAY_HOST_DEVICE
+            state(const track_t &track, args_t &&... args)
+            : state(bound_track_parameters_type{track.surface_link(),
+                                                {track.bound_local(),
+                                                 track.phi(), track.theta(),
+                                                 track.qop(), track.time()},
+                                                track.covariance()},
+                    std::forward<args_t>(args)...) {}
+
+        /// Write the current free track parameters to @param track, which can
+        /// be in a user-provided layout (e.g. a proxy into a track collection)
+        template <typename track_t>
+        requires concepts::mutable_free_track_params<
+            std::remove_cvref_t<track_t>>
+            DETRAY_HOST_DEVICE void write_free_params(track_t &&track) const {
+            const auto &free_params = _stepping();
+            track.set_pos(free_params.pos());
+            track.set_dir(free_params.dir());
+            track.set_time(free_params.time());
+            track.set_qop(free_params.qop());
+        }
+
+        /// Write the current bound track parameters to @param track, which can
+        /// be in a user-provided layout (e.g. a proxy into a track collection)
+        template <typename track_t>
+        requires std::assignable_from<std::remove_cvref_t<track_t> &,
+                                      const bound_track_parameters_type &>
+            DETRAY_HOST_DEVICE void write_bound_params(track_t &&track) const {
+            track = _stepping.bound_params();
+        }
+
+        /// Reset the state for a new track @param free_params, so that the
+        /// state can be reused without being reconstructed
+        template <typename... field_t>
+        requires(sizeof...(field_t) <= 1u) DETRAY_HOST_DEVICE
+            void reset(const free_track_parameters_type &free_params,
+                       const field_t &... magnetic_field) {
+            // The stepper states may hold const members (e.g. the field view)
+            using stepping_state_t = typename stepper_t::state;
+            _stepping.~stepping_state_t();
+            new (&_stepping) stepping_state_t(free_params, magnetic_field...);
+            if constexpr (requires { _navigation.reset(); }) {
+                // Keeps the optional navigation tables
+                _navigation.reset();
+            } else {
+                _navigation = navigator_state_type(_navigation.detector());
+            }
+            _heartbeat = false;
+            _vol_mat_volume = detail::invalid_value<dindex>();
+            _vol_mat_ptr = nullptr;
+#if defined(__NO_DEVICE__)
+            debug_stream.str("");
+            debug_stream.clear();
+#endif
+        }
+
         /// Set the particle hypothesis
         DETRAY_HOST_DEVICE
         void set_particle(const pdg_particle<scalar_type> &ptc) {
@@ -149,13 +235,60 @@ struct propagator {
         DETRAY_HOST_DEVICE
         bool is_alive() const { return _heartbeat; }
 
+        /// Point the state to the detector @param det , e.g. after the state
+        /// of a suspended propagation was copied from device to host, in
+        /// order to finish it there (@see propagator::propagate_resume )
+        DETRAY_HOST_DEVICE
+        void set_detector(const detector_type &det) {
+            _navigation.set_detector(det);
+            // The cached material pointed into the previous detector
+            _vol_mat_volume = detail::invalid_value<dindex>();
+            _vol_mat_ptr = nullptr;
+        }
+
+        /// @returns the material of the current volume at the track position
+        ///
+        /// Homogeneous volume material is looked up only once per volume
+        DETRAY_HOST_DEVICE
+        const material<scalar_type> *volume_material() {
+            const dindex vol_idx{_navigation.volume()};
+            if (vol_idx == _vol_mat_volume) {
+                return _vol_mat_ptr;
+            }
+
+            const auto vol = _navigation.get_volume();
+            if (!vol.has_material()) {
+                _vol_mat_volume = vol_idx;
+                _vol_mat_ptr = nullptr;
+                return nullptr;
+            }
+
+            const auto *mat_ptr = vol.material_parameters(_stepping().pos());
+            if (vol.has_homogeneous_material()) {
+                _vol_mat_volume = vol_idx;
+                _vol_mat_ptr = mat_ptr;
+            }
+            return mat_ptr;
+        }
+
         // Is the propagation still alive?
         bool _heartbeat = false;
+        /// Whether the navigation was (re-)initialized in the last step (needed
+        /// to continue a suspended propagation)
+        bool _is_init = false;
 
         typename stepper_t::state _stepping;
         typename navigator_t::state _navigation;
         context_type _context;
 
+        /// Volume for which the volume material is cached
+        dindex _vol_mat_volume{detail::invalid_value<dindex>()};
+        /// Cached homogeneous volume material (null if none)
+        const material<scalar_type> *_vol_mat_ptr{nullptr};
+
+        /// Time spent in the propagation phases (not reset with the state)
+        [[no_unique_address]] timer_t _timer{};
+
         bool do_debug = false;
 #if defined(__NO_DEVICE__)
         std::stringstream debug_stream{};
@@ -185,6 +318,120 @@ struct propagator {
         propagation._heartbeat = true;
     }
 
+    /// Update the navigation of the @param propagation and add the time it
+    /// took to the phase of the trust level the update started with
+    ///
+    /// @param is_before_actor whether the update runs before the actors
+    ///
+    /// @returns whether the navigation was (re-)initialized
+    DETRAY_HOST_DEVICE
+    inline bool update_navigation(state &propagation,
+                                  const bool is_before_actor) const {
+        auto &navigation = propagation._navigation;
+
+        const auto t0 = propagation._timer.start();
+        const auto ph = propagation::update_phase(navigation.trust_level());
+
+        const bool is_init{m_navigator.update(
+            propagation._stepping(), navigation, m_cfg.navigation,
+            propagation._context, is_before_actor)};
+        propagation._heartbeat &= navigation.is_alive();
+
+        if (is_init) {
+            fast_forward(propagation);
+        }
+
+        propagation._timer.stop(ph, t0);
+
+        return is_init;
+    }
+
+    /// Target the exit portal of a gap volume along the helix in the local
+    /// magnetic field, after the navigation was (re-)initialized in it
+    /// (@see navigator::fast_forward ). The straight line estimate of the
+    /// exit by the initialization is used to check the field homogeneity.
+    DETRAY_HOST_DEVICE
+    inline void fast_forward(state &propagation) const {
+
+        using helix_t = detail::helix<algebra_type>;
+
+        constexpr bool can_fast_forward{
+            requires(const navigator_t &nav,
+                     typename navigator_t::state &nav_state,
+                     const typename stepper_t::state &stepping,
+                     const helix_t &hlx, const navigation::config &cfg,
+                     const typename state::context_type &ctx) {
+                stepping.field();
+                nav.fast_forward(hlx, nav_state, cfg, ctx);
+            }};
+
+        if constexpr (can_fast_forward) {
+            auto &navigation = propagation._navigation;
+            const auto &stepping = propagation._stepping;
+            const auto &track = stepping();
+
+            if (!m_cfg.navigation.fast_forward_gap_volumes ||
+                !navigation.is_alive() || navigation.is_exhausted() ||
+                navigation.status() != navigation::status::e_towards_object ||
+                !navigation.get_volume().has_only_portals()) {
+                return;
+            }
+
+            const auto field = stepping.field();
+            const point3_type &pos = track.pos();
+            const auto b_vec = field.at(pos[0], pos[1], pos[2]);
+            const vector3_type b_entry{b_vec[0], b_vec[1], b_vec[2]};
+
+            // The straight line estimate is already exact
+            const scalar_type b_norm{vector::norm(b_entry)};
+            if (b_norm == 0.f || track.qop() == 0.f) {
+                return;
+            }
+
+            // Strongly inhomogeneous field: Use the general navigation
+            if constexpr (!detail::is_constant_field_v<decltype(field)>) {
+                const point3_type exit_pos{pos + navigation() * track.dir()};
+                const auto b_vec_exit =
+                    field.at(exit_pos[0], exit_pos[1], exit_pos[2]);
+                const vector3_type b_exit{b_vec_exit[0], b_vec_exit[1],
+                                          b_vec_exit[2]};
+
+                if (vector::norm(b_exit - b_entry) >
+                    m_cfg.navigation.fast_forward_field_tolerance * b_norm) {
+                    return;
+                }
+            }
+
+            // Helix in the navigation direction
+            const auto nav_dir{
+                static_cast<scalar_type>(navigation.direction())};
+            const helix_t hlx(pos, track.time(), nav_dir * track.dir(),
+                              nav_dir * track.qop(), b_entry);
+
+            m_navigator.fast_forward(hlx, navigation, m_cfg.navigation,
+                                     propagation._context);
+        }
+    }
+
+    /// Prefetch the detector data of the next navigation candidates, so that
+    /// it arrives while the stepper runs (@see navigator::prefetch )
+    DETRAY_HOST_DEVICE
+    inline void prefetch_candidates(const state &propagation) const {
+
+        constexpr bool can_prefetch{
+            requires(const navigator_t &nav,
+                     const typename navigator_t::state &nav_state,
+                     const navigation::config &cfg,
+                     const typename state::context_type &ctx) {
+                nav.prefetch(nav_state, cfg, ctx);
+            }};
+
+        if constexpr (can_prefetch) {
+            m_navigator.prefetch(propagation._navigation, m_cfg.navigation,
+                                 propagation._context);
+        }
+    }
+
     /// Propagate method init: Initialize a propagation state
     ///
     /// @param propagation the state of a propagation flow
@@ -204,68 +451,96 @@ struct propagator {
         const auto &track = stepping();
         assert(!track.is_invalid());
 
+        auto &timer = propagation._timer;
+
         // Initialize the navigation
+        auto t0 = timer.start();
         m_navigator.init(track, navigation, m_cfg.navigation, context);
         propagation._heartbeat = navigation.is_alive();
+        fast_forward(propagation);
+        timer.stop(propagation::phase::e_init, t0);
 
         // Run all registered actors/aborters after init
+        t0 = timer.start();
         run_actors(actor_state_refs, propagation);
         assert(!track.is_invalid());
+        timer.stop(propagation::phase::e_actors, t0);
 
         // Find next candidate
-        m_navigator.update(track, navigation, m_cfg.navigation, context);
-        propagation._heartbeat &= navigation.is_alive();
+        update_navigation(propagation, true);
     }
 
-    /// Propagate method step: Perform a single propagation step.
-    ///
-    /// @param propagation the state of a propagation flow
-    /// @param actor_state_refs tuple containing refences to the actor states
+    /// @name Stages of a propagation step
     ///
-    /// @return The heartbeat at the end of the step.
+    /// Run in this order, the stages are equivalent to @c propagate_step .
+    /// They can be run separately for many tracks in turns, e.g. as separate
+    /// kernels on device (@see propagation::propagate_wavefront ).
+    /// @{
+
+    /// Stepper stage: Take a step towards the next navigation candidate
     ///
-    /// @note If the return value of this function is true, another step can
-    /// be taken afterwards.
-    template <typename actor_states_t>
-    requires concepts::is_state_of<actor_states_t, actor_chain_type>
-        DETRAY_HOST_DEVICE bool propagate_step(
-            state &propagation, bool is_init,
-            actor_states_t actor_state_refs) const {
+    /// @param propagation the state of a propagation flow
+    /// @param is_init whether the navigation was (re-)initialized before
+    DETRAY_HOST_DEVICE void propagate_stepper(state &propagation,
+                                              const bool is_init) const {
         auto &navigation = propagation._navigation;
         auto &stepping = propagation._stepping;
-        auto &context = propagation._context;
-        const auto &track = stepping();
-        assert(!track.is_invalid());
+        assert(!stepping().is_invalid());
 
         // Set access to the volume material for the stepper
-        auto vol = navigation.get_volume();
-        const material<scalar_type> *vol_mat_ptr =
-            vol.has_material() ? vol.material_parameters(track.pos()) : nullptr;
+        const material<scalar_type> *vol_mat_ptr{propagation.volume_material()};
+
+        auto &timer = propagation._timer;
 
         // Break automatic step size scaling by the stepper when a surface
         // was reached and whenever the navigation is (re-)initialized
         const bool reset_stepsize{navigation.is_on_surface() || is_init};
+
+        prefetch_candidates(propagation);
+
         // Take the step
+        const auto t0 = timer.start();
         propagation._heartbeat &=
             m_stepper.step(navigation(), stepping, m_cfg.stepping,
                            reset_stepsize, vol_mat_ptr);
 
         // Reduce navigation trust level according to stepper update
         typename stepper_t::policy_type{}(stepping.policy_state(), propagation);
+        timer.stop(propagation::phase::e_stepper, t0);
 
-        // Find next candidate
-        is_init =
-            m_navigator.update(track, navigation, m_cfg.navigation, context);
-        propagation._heartbeat &= navigation.is_alive();
+        // Let the navigation know how far the track moved
+        navigation.advance(stepping.step_size());
+    }
 
-        // Run all registered actors/aborters after update
+    /// Navigation stage: Find the next candidate after the step
+    ///
+    /// @param propagation the state of a propagation flow
+    ///
+    /// @returns whether the navigation was (re-)initialized
+    DETRAY_HOST_DEVICE bool propagate_navigation(state &propagation) const {
+        return update_navigation(propagation, true);
+    }
+
+    /// Actor stage: Run all registered actors/aborters and check the status
+    /// of the navigation afterwards
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_state_refs tuple containing refences to the actor states
+    ///
+    /// @returns whether the navigation was (re-)initialized
+    template <typename actor_states_t>
+    requires concepts::is_state_of<actor_states_t, actor_chain_type>
+        DETRAY_HOST_DEVICE bool propagate_actors(
+            state &propagation, actor_states_t actor_state_refs) const {
+        auto &timer = propagation._timer;
+
+        const auto t0 = timer.start();
         run_actors(actor_state_refs, propagation);
-        assert(!track.is_invalid());
+        assert(!propagation._stepping().is_invalid());
+        timer.stop(propagation::phase::e_actors, t0);
 
         // And check the status
-        is_init |= m_navigator.update(track, navigation, m_cfg.navigation,
-                                      context, false);
-        propagation._heartbeat &= navigation.is_alive();
+        const bool is_init{update_navigation(propagation, false)};
 
 #if defined(__NO_DEVICE__)
         if (propagation.do_debug) {
@@ -275,6 +550,33 @@ struct propagator {
 
         return is_init;
     }
+    /// @}
+
+    /// Propagate method step: Perform a single propagation step.
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_state_refs tuple containing refences to the actor states
+    ///
+    /// @return The heartbeat at the end of the step.
+    ///
+    /// @note If the return value of this function is true, another step can
+    /// be taken afterwards.
+    template <typename actor_states_t>
+    requires concepts::is_state_of<actor_states_t, actor_chain_type>
+        DETRAY_HOST_DEVICE bool propagate_step(
+            state &propagation, bool is_init,
+            actor_states_t actor_state_refs) const {
+
+        propagate_stepper(propagation, is_init);
+
+        // Find next candidate
+        is_init = propagate_navigation(propagation);
+
+        // Run all registered actors/aborters after update
+        is_init |= propagate_actors(propagation, actor_state_refs);
+
+        return is_init;
+    }
 
     /// Propagate method: Coordinates the calls of the stepper, navigator and
     /// all registered actors.
@@ -301,6 +603,58 @@ struct propagator {
         return is_complete(propagation) || is_paused(propagation);
     }
 
+    /// Propagate for at most @param max_steps steps.
+    ///
+    /// If the track has not finished within the step budget, the propagation
+    /// is suspended (@see is_paused ). It can be continued later with
+    /// @c propagate_resume , e.g. on the host after the state was copied back
+    /// from device, or in a follow-up kernel that only runs on the suspended
+    /// tracks. This way, a few long-running tracks do not hold up all others.
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_state_refs tuple containing refences to the actor states
+    ///
+    /// @return propagation success, i.e. whether the track finished
+    /// successfully or was suspended.
+    template <typename actor_states_t>
+    requires concepts::is_state_of<actor_states_t, actor_chain_type>
+        DETRAY_HOST_DEVICE bool propagate_for(
+            state &propagation, actor_states_t actor_state_refs,
+            const unsigned int max_steps) const {
+
+        propagate_init(propagation, actor_state_refs);
+        propagation._is_init = true;
+
+        return propagate_steps(propagation, actor_state_refs, max_steps);
+    }
+
+    /// Continue a suspended propagation for at most @param max_steps steps
+    /// (@see propagate_for ).
+    ///
+    /// @note If the state was copied between memory spaces, it needs to be
+    /// pointed to the detector in the new memory space first
+    /// (@see state::set_detector ). The actor states need to be accessible
+    /// there as well.
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_state_refs tuple containing refences to the actor states
+    ///
+    /// @return propagation success, i.e. whether the track finished
+    /// successfully or was suspended again.
+    template <typename actor_states_t>
+    requires concepts::is_state_of<actor_states_t, actor_chain_type>
+        DETRAY_HOST_DEVICE bool propagate_resume(
+            state &propagation, actor_states_t actor_state_refs,
+            const unsigned int max_steps =
+                detail::invalid_value<unsigned int>()) const {
+
+        if (is_paused(propagation)) {
+            resume(propagation);
+        }
+
+        return propagate_steps(propagation, actor_state_refs, max_steps);
+    }
+
     /// Overload for emtpy actor chain
     DETRAY_HOST_DEVICE bool propagate(state &propagation) {
         // Will not be used
@@ -309,6 +663,37 @@ struct propagator {
         return propagate(propagation, empty_state);
     }
 
+    /// Propagate directly to the surface @param target, without navigating
+    /// the volumes in between (@see target_navigator )
+    ///
+    /// @param propagation the state of a propagation flow
+    /// @param actor_state_refs tuple containing refences to the actor states
+    ///
+    /// @return propagation success, i.e. whether the target was reached.
+    template <typename actor_states_t>
+    requires concepts::is_state_of<actor_states_t, actor_chain_type> &&
+        requires(typename navigator_t::state &nav_state,
+                 const geometry::barcode bcd) {
+        nav_state.set_target(bcd);
+    }
+    DETRAY_HOST_DEVICE bool propagate_to(
+        state &propagation, const geometry::barcode target,
+        actor_states_t actor_state_refs = dtuple<>{}) const {
+
+        propagation._navigation.set_target(target);
+
+        return propagate(propagation, actor_state_refs);
+    }
+
+    /// Overload for emtpy actor chain
+    DETRAY_HOST_DEVICE bool propagate_to(state &propagation,
+                                         const geometry::barcode target) {
+        // Will not be used
+        actor_chain<>::state empty_state{};
+        // Run propagation
+        return propagate_to(propagation, target, empty_state);
+    }
+
     /// Propagate method with two while loops. In the CPU, propagate and
     /// propagate_sync() should be equivalent to each other. In the SIMT level
     /// (e.g. GPU), the instruction of threads in the same warp is synchornized
@@ -331,7 +716,7 @@ struct propagator {
 
         auto &navigation = propagation._navigation;
         auto &stepping = propagation._stepping;
-        auto &context = propagation._context;
+        auto &timer = propagation._timer;
         const auto &track = stepping();
 
         while (propagation.is_alive()) {
@@ -341,15 +726,17 @@ struct propagator {
             while (propagation.is_alive()) {
 
                 // Set access to the volume material for the stepper
-                auto vol = navigation.get_volume();
-                const material<scalar_type> *vol_mat_ptr =
-                    vol.has_material() ? vol.material_parameters(track.pos())
-                                       : nullptr;
+                const material<scalar_type> *vol_mat_ptr{
+                    propagation.volume_material()};
 
                 // Break automatic step size scaling by the stepper
                 const bool reset_stepsize{navigation.is_on_surface() ||
                                           is_init};
+
+                prefetch_candidates(propagation);
+
                 // Take the step
+                auto t0 = timer.start();
                 propagation._heartbeat &=
                     m_stepper.step(navigation(), stepping, m_cfg.stepping,
                                    reset_stepsize, vol_mat_ptr);
@@ -357,11 +744,10 @@ struct propagator {
                 // Reduce navigation trust level according to stepper update
                 typename stepper_t::policy_type{}(stepping.policy_state(),
                                                   propagation);
+                timer.stop(propagation::phase::e_stepper, t0);
 
                 // Find next candidate
-                is_init = m_navigator.update(track, navigation,
-                                             m_cfg.navigation, context);
-                propagation._heartbeat &= navigation.is_alive();
+                is_init = update_navigation(propagation, true);
 
                 // If the track is on a sensitive surface, break the loop to
                 // synchornize the threads
@@ -369,26 +755,26 @@ struct propagator {
                     skip = false;
                     break;
                 } else {
+                    t0 = timer.start();
                     run_actors(actor_state_refs, propagation);
                     assert(!track.is_invalid());
+                    timer.stop(propagation::phase::e_actors, t0);
 
                     // And check the status
-                    is_init |= m_navigator.update(
-                        track, navigation, m_cfg.navigation, context, false);
-                    propagation._heartbeat &= navigation.is_alive();
+                    is_init |= update_navigation(propagation, false);
                 }
             }
 
             if (!skip) {
 
                 // Synchronized actor
+                const auto t0 = timer.start();
                 run_actors(actor_state_refs, propagation);
                 assert(!track.is_invalid());
+                timer.stop(propagation::phase::e_actors, t0);
 
                 // And check the status
-                is_init |= m_navigator.update(track, navigation,
-                                              m_cfg.navigation, context, false);
-                propagation._heartbeat &= navigation.is_alive();
+                is_init |= update_navigation(propagation, false);
             }
 
 #if defined(__NO_DEVICE__)
@@ -402,6 +788,28 @@ struct propagator {
         return is_complete(propagation) || is_paused(propagation);
     }
 
+    private:
+    /// Take at most @param max_steps steps and suspend the propagation, if
+    /// the track is still alive afterwards
+    template <typename actor_states_t>
+    DETRAY_HOST_DEVICE bool propagate_steps(
+        state &propagation, actor_states_t actor_state_refs,
+        const unsigned int max_steps) const {
+
+        bool is_init{propagation._is_init};
+        for (unsigned int i = 0u; i < max_steps && propagation.is_alive();
+             ++i) {
+            is_init = propagate_step(propagation, is_init, actor_state_refs);
+        }
+        propagation._is_init = is_init;
+
+        // Step budget exhausted: Suspend the propagation
+        propagation._heartbeat = false;
+
+        return is_complete(propagation) || is_paused(propagation);
+    }
+
+    public:
     template <typename state_t>
     DETRAY_HOST void inspect(state_t &propagation) const {
         const auto &navigation = propagation._navigation;
@@ -13,6 +13,8 @@
 #include "detray/definitions/units.hpp"
 #include "detray/navigation/policies.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
+#include "detray/tracks/helix.hpp"
 #include "detray/tracks/tracks.hpp"
 
 namespace detray {
@@ -22,15 +24,17 @@ namespace detray {
 /// @tparam magnetic_field_t the type of magnetic field
 /// @tparam track_t the type of track that is being advanced by the stepper
 /// @tparam constraint_ the type of constraints on the stepper
+/// @tparam storage_t storage options of the state (@see stepping::storage )
 template <typename magnetic_field_t, concepts::algebra algebra_t,
           typename constraint_t = unconstrained_step<dscalar<algebra_t>>,
           typename policy_t = stepper_rk_policy<dscalar<algebra_t>>,
-          typename inspector_t = stepping::void_inspector>
-class rk_stepper final
-    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
+          typename inspector_t = stepping::void_inspector,
+          typename storage_t = stepping::inline_storage>
+class rk_stepper final : public base_stepper<algebra_t, constraint_t, policy_t,
+                                             inspector_t, storage_t> {
 
     using base_type =
-        base_stepper<algebra_t, constraint_t, policy_t, inspector_t>;
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t, storage_t>;
 
     public:
     using algebra_type = algebra_t;
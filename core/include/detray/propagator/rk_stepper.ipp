@@ -12,24 +12,26 @@
 #include "detray/utils/matrix_helper.hpp"
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline void detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t>::state::
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline void
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
     advance_track(
         const detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t,
-                                 policy_t, inspector_t>::intermediate_state& sd,
+                                 policy_t, inspector_t,
+                                 storage_t>::intermediate_state& sd,
         const material<scalar_type>* vol_mat_ptr) {
 
     const scalar_type h{this->step_size()};
     const scalar_type h_6{h * static_cast<scalar_type>(1. / 6.)};
     auto& track = (*this)();
-    auto pos = track.pos();
     auto dir = track.dir();
 
     // Update the track parameters according to the equations of motion
     // Reference: Eq (82) of https://doi.org/10.1016/0029-554X(81)90063-X
-    pos = pos + h * (sd.t[0u] + h_6 * (sd.dtds[0] + sd.dtds[1] + sd.dtds[2]));
-    track.set_pos(pos);
+    this->advance_pos(
+        h * (sd.t[0u] + h_6 * (sd.dtds[0] + sd.dtds[1] + sd.dtds[2])));
 
     // Reference: Eq (82) of https://doi.org/10.1016/0029-554X(81)90063-X
     dir =
@@ -51,13 +53,14 @@ DETRAY_HOST_DEVICE inline void detray::rk_stepper<
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline void detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t,
-    inspector_t>::state::advance_jacobian(const detray::stepping::config& cfg,
-                                          const intermediate_state& sd,
-                                          const material<scalar_type>*
-                                              vol_mat_ptr) {
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline void
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
+    advance_jacobian(const detray::stepping::config& cfg,
+                     const intermediate_state& sd,
+                     const material<scalar_type>* vol_mat_ptr) {
     /// The calculations are based on ATL-SOFT-PUB-2009-002. The update of the
     /// Jacobian matrix is requires only the calculation of eq. 17 and 18.
     /// Since the terms of eq. 18 are currently 0, this matrix is not needed
@@ -70,6 +73,20 @@ DETRAY_HOST_DEVICE inline void detray::rk_stepper<
     /// eq. 11 and are directly related to the initial problem in eq. 7. The
     /// evaluation is based by propagating the parameters T and lambda as given
     /// in eq. 16 and evaluating the derivations for matrix A.
+
+    // In a constant field without volume material, the track follows a helix
+    // and the step transport matrix is known analytically.
+    if constexpr (detail::is_constant_field_v<magnetic_field_t>) {
+        if (vol_mat_ptr == nullptr && vector::norm(sd.b_first) > 0.f) {
+            const detail::helix<algebra_t> hlx(point3_type{0.f, 0.f, 0.f},
+                                               0.f, sd.t[0u], sd.qop[0u],
+                                               sd.b_first);
+
+            this->set_transport_jacobian(matrix::multiply_8x8(
+                hlx.jacobian(this->step_size()), this->transport_jacobian()));
+            return;
+        }
+    }
     /// @note The translation for u_{n+1} in eq. 7 is in this case a
     /// 3-dimensional vector without a dependency of Lambda or lambda neither in
     /// u_n nor in u_n'. The second and fourth eq. in eq. 14 have the constant
@@ -189,6 +206,18 @@ DETRAY_HOST_DEVICE inline void detray::rk_stepper<
 
     if (!cfg.use_eloss_gradient) {
         getter::element(D, e_free_qoverp, e_free_qoverp) = 1.f;
+    } else if (cfg.linear_eloss_per_step) {
+        // The energy loss only depends on qop at the first point
+        const scalar_type d2qop1dsdqop1 =
+            this->d2qopdsdqop(sd.qop[0u], vol_mat_ptr);
+
+        dqopn_dqop[0u] = 1.f;
+        dqopn_dqop[1u] = 1.f + half_h * d2qop1dsdqop1;
+        dqopn_dqop[2u] = dqopn_dqop[1u];
+        dqopn_dqop[3u] = 1.f + h * d2qop1dsdqop1;
+
+        getter::element(D, e_free_qoverp, e_free_qoverp) =
+            1.f + h * d2qop1dsdqop1;
     } else {
         // Pre-calculate dqop_n/dqop1
         const scalar_type d2qop1dsdqop1 =
@@ -331,13 +360,16 @@ DETRAY_HOST_DEVICE inline void detray::rk_stepper<
     getter::set_block(D, dFdqop, 0u, 7u);
     getter::set_block(D, dGdqop, 4u, 7u);
 
-    this->set_transport_jacobian(D * this->transport_jacobian());
+    this->set_transport_jacobian(
+        matrix::multiply_8x8(D, this->transport_jacobian()));
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t>::state::
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
     evaluate_dqopds(const std::size_t i, const scalar_type h,
                     const scalar_type dqopds_prev,
                     const material<scalar_type>* vol_mat_ptr,
@@ -349,6 +381,11 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
     if (!vol_mat_ptr) {
         const scalar_type qop = track.qop();
         return detray::make_pair(scalar_type(0.f), qop);
+    } else if (cfg.linear_eloss_per_step && i != 0u) {
+        // Keep the energy loss of the first Runge-Kutta point for the whole
+        // step (dqopds_prev is the same for all points)
+        const scalar_type qop = track.qop() + h * dqopds_prev;
+        return detray::make_pair(dqopds_prev, qop);
     } else if (cfg.use_mean_loss && i != 0u) {
         // qop_n is calculated recursively like the direction of
         // evaluate_dtds.
@@ -365,14 +402,15 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t,
-    inspector_t>::state::evaluate_dtds(const vector3_type& b_field,
-                                       const std::size_t i, const scalar_type h,
-                                       const vector3_type& dtds_prev,
-                                       const scalar_type qop)
-    -> detray::pair<vector3_type, vector3_type> {
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
+    evaluate_dtds(const vector3_type& b_field, const std::size_t i,
+                  const scalar_type h, const vector3_type& dtds_prev,
+                  const scalar_type qop)
+        -> detray::pair<vector3_type, vector3_type> {
     auto& track = (*this)();
     const auto dir = track.dir();
 
@@ -385,11 +423,12 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t,
-    inspector_t>::state::evaluate_field_gradient(const point3_type& pos)
-    -> matrix_type<3, 3> {
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
+    evaluate_field_gradient(const point3_type& pos) -> matrix_type<3, 3> {
 
     auto dBdr = matrix::zero<matrix_type<3, 3>>();
 
@@ -427,10 +466,12 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
 DETRAY_HOST_DEVICE inline auto
 detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
-                   inspector_t>::state::dtds() const -> vector3_type {
+                   inspector_t, storage_t>::state::dtds() const
+    -> vector3_type {
 
     // In case there was no step before
     if (this->path_length() == 0.f) {
@@ -449,11 +490,12 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t,
-    inspector_t>::state::dqopds(const material<scalar_type>* vol_mat_ptr) const
-    -> scalar_type {
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline auto
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
+    dqopds(const material<scalar_type>* vol_mat_ptr) const -> scalar_type {
 
     // In case there was no step before
     if (this->path_length() == 0.f) {
@@ -464,12 +506,13 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE auto detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t,
-    inspector_t>::state::dqopds(const scalar_type qop,
-                                const material<scalar_type>* vol_mat_ptr) const
-    -> scalar_type {
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE auto
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::state::
+    dqopds(const scalar_type qop,
+           const material<scalar_type>* vol_mat_ptr) const -> scalar_type {
 
     // d(qop)ds is zero for empty space
     if (!vol_mat_ptr) {
@@ -497,12 +540,13 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
 DETRAY_HOST_DEVICE auto
 detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
-                   inspector_t>::state::d2qopdsdqop(const scalar_type qop,
-                                                    const material<scalar_type>*
-                                                        vol_mat_ptr) const
+                   inspector_t, storage_t>::state::
+    d2qopdsdqop(const scalar_type qop,
+                const material<scalar_type>* vol_mat_ptr) const
     -> scalar_type {
 
     if (!vol_mat_ptr) {
@@ -541,12 +585,14 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
 }
 
 template <typename magnetic_field_t, detray::concepts::algebra algebra_t,
-          typename constraint_t, typename policy_t, typename inspector_t>
-DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
-    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t>::
+          typename constraint_t, typename policy_t, typename inspector_t,
+          typename storage_t>
+DETRAY_HOST_DEVICE inline bool
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t, storage_t>::
     step(const scalar_type dist_to_next,
          detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
-                            inspector_t>::state& stepping,
+                            inspector_t, storage_t>::state& stepping,
          const detray::stepping::config& cfg, const bool do_reset,
          const material<scalar_type>* vol_mat_ptr) const {
 
@@ -558,7 +604,16 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
     auto& magnetic_field = stepping.m_magnetic_field;
 
     if (do_reset) {
-        stepping.set_step_size(dist_to_next);
+        // Carry the predicted step size across the reset, if it is smaller
+        // than the distance to the next surface
+        if (cfg.predict_step_size && stepping.next_step_size() != 0.f) {
+            stepping.set_step_size(math::copysign(
+                math::min(math::fabs(stepping.next_step_size()),
+                          math::fabs(dist_to_next)),
+                dist_to_next));
+        } else {
+            stepping.set_step_size(dist_to_next);
+        }
     } else if (stepping.next_step_size() > 0) {
         stepping.set_step_size(
             math::min(stepping.next_step_size(), dist_to_next));
@@ -662,6 +717,26 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
                       static_cast<scalar_type>(4.)));
     };
 
+    /// Calculate the scale factor for the predicted step size from the
+    /// relative change of the field strength over the step, as sampled by the
+    /// Runge-Kutta points. Allows a relative change of ten percent per step.
+    const auto field_variation_scaling =
+        [](const intermediate_state& isd) -> scalar_type {
+        constexpr scalar_type max_rel_change{0.1f};
+
+        const scalar_type b_mag{vector::norm(isd.b_first)};
+        if (b_mag == 0.f) {
+            return 1.f;
+        }
+        const scalar_type rel_change{vector::norm(isd.b_last - isd.b_first) /
+                                     b_mag};
+        if (rel_change <= max_rel_change) {
+            return 1.f;
+        }
+        return math::max(math::sqrt(max_rel_change / rel_change),
+                         static_cast<scalar_type>(0.25));
+    };
+
     scalar_type error{1e20f};
 
     // If the estimated error is larger than the tolerance with an additional
@@ -716,14 +791,22 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
     assert(!stepping().is_invalid());
 
     // Advance jacobian transport
-    if (cfg.do_covariance_transport) {
-        stepping.advance_jacobian(cfg, sd, vol_mat_ptr);
+    if constexpr (base_type::has_transport_jacobian) {
+        if (cfg.do_covariance_transport) {
+            stepping.advance_jacobian(cfg, sd, vol_mat_ptr);
+        }
     }
 
     // The step size estimation fot the next step
     stepping.set_next_step_size(stepping.step_size() *
                                 step_size_scaling(error));
 
+    // Don't let the prediction grow beyond what the field variation allows
+    if (cfg.predict_step_size) {
+        stepping.set_next_step_size(stepping.next_step_size() *
+                                    field_variation_scaling(sd));
+    }
+
     // Don't allow a too small step size
     if (math::fabs(stepping.next_step_size()) < cfg.min_stepsize) {
         stepping.set_next_step_size(
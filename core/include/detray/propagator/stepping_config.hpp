@@ -22,6 +22,8 @@ enum class id {
     e_linear = 0,
     // True for charged tracks
     e_rk = 1,
+    // Charged tracks in a homogeneous field
+    e_helix = 2,
 };
 
 struct config {
@@ -31,6 +33,11 @@ struct config {
     float rk_error_tol{1e-4f * unit<float>::mm};
     /// Step size constraint
     float step_constraint{std::numeric_limits<float>::max()};
+    /// Maximal distance between the end of a Dormand-Prince step and the
+    /// tangent at its start, along which the navigation extrapolates (off by
+    /// default). Limits the long steps of the stepper in strongly bending
+    /// tracks, which can otherwise leave a volume between two candidates
+    float max_step_deviation{std::numeric_limits<float>::max()};
     /// Maximal path length of track
     float path_limit{5.f * unit<float>::m};
     /// Maximum number of Runge-Kutta step trials
@@ -40,8 +47,15 @@ struct config {
     bool use_mean_loss{true};
     /// Use eloss gradient in error propagation
     bool use_eloss_gradient{false};
+    /// Evaluate the energy loss in the volume material only once at the start
+    /// of a step and integrate it linearly along the step
+    bool linear_eloss_per_step{false};
     /// Use b field gradient in error propagation
     bool use_field_gradient{false};
+    /// Start the Runge-Kutta step after a reset (e.g. on a surface) from the
+    /// step size prediction of the last accepted step, scaled down where the
+    /// magnetic field changes quickly along the track
+    bool predict_step_size{false};
     /// Do covariance transport
     bool do_covariance_transport{true};
 
@@ -55,10 +69,15 @@ struct config {
             << "  Max. step updates     : " << cfg.max_rk_updates << "\n"
             << "  Stepsize  constraint  : "
             << cfg.step_constraint / detray::unit<float>::mm << " [mm]\n"
+            << "  Max. step deviation   : "
+            << cfg.max_step_deviation / detray::unit<float>::mm << " [mm]\n"
             << "  Path limit            : "
             << cfg.path_limit / detray::unit<float>::m << " [m]\n"
             << std::boolalpha
             << "  Use Bethe energy loss : " << cfg.use_mean_loss << "\n"
+            << "  Linear eloss per step : " << cfg.linear_eloss_per_step
+            << "\n"
+            << "  Predict step size     : " << cfg.predict_step_size << "\n"
             << "  Do cov. transport     : " << cfg.do_covariance_transport
             << "\n";
 
@@ -0,0 +1,245 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/device_atomic_ref.hpp>
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace detray::propagation {
+
+/// @brief Views of the per-track data that the stages of the wavefront
+/// propagation hand on to each other.
+///
+/// In the wavefront propagation, every propagation step is split into the
+/// stepper, navigation and actor stages (@see propagator::propagate_stepper ),
+/// which are run for all active tracks before the next stage starts, e.g. as
+/// separate kernels on device. This way, the stepper and the navigator do
+/// not share the register budget and the threads do not diverge by stage.
+/// The propagation and actor states of all tracks are kept in (global) memory
+/// between the stages. After the actor stage, the tracks that are still alive
+/// are compacted into the queue for the next step.
+///
+/// @note The queues need to have room for all tracks. The navigation state
+/// needs to provide @c set_detector , since every stage sets up its own
+/// detector from the detector view.
+template <typename propagator_t>
+struct wavefront_view {
+
+    using state_type = typename propagator_t::state;
+    using actor_states_type =
+        typename propagator_t::actor_chain_type::state_tuple;
+
+    /// Propagation state of every track
+    dvector_view<state_type> states{};
+    /// Actor states of every track
+    dvector_view<actor_states_type> actor_states{};
+    /// Whether the navigation of a track was (re-)initialized in its last
+    /// stage (one entry per track)
+    dvector_view<unsigned int> is_init{};
+    /// Indices of the active tracks
+    dvector_view<dindex> queue{};
+    /// Indices of the tracks that are still alive after the step
+    dvector_view<dindex> next_queue{};
+    /// Size of the next queue (single counter)
+    dvector_view<unsigned int> n_next{};
+};
+
+/// The stages of the wavefront propagation for a single track (e.g. the body
+/// of a kernel that is run for every active track)
+namespace wavefront {
+
+/// Initialize the propagation of the track @param trk_idx
+///
+/// @param p the propagator
+/// @param view the per-track data (the propagation state of the track has to
+///             be constructed already)
+/// @param det the detector the stage runs on
+template <typename propagator_t, typename detector_t>
+DETRAY_HOST_DEVICE inline void init(const propagator_t &p,
+                                    wavefront_view<propagator_t> view,
+                                    const detector_t &det,
+                                    const dindex trk_idx) {
+    using view_t = wavefront_view<propagator_t>;
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    vecmem::device_vector<typename view_t::state_type> states(view.states);
+    vecmem::device_vector<typename view_t::actor_states_type> actor_states(
+        view.actor_states);
+    vecmem::device_vector<unsigned int> is_init(view.is_init);
+    vecmem::device_vector<dindex> queue(view.queue);
+
+    auto &propagation = states[trk_idx];
+    propagation._navigation.set_detector(det);
+
+    p.propagate_init(propagation,
+                     actor_chain_t::setup_actor_states(actor_states[trk_idx]));
+
+    is_init[trk_idx] = 1u;
+    queue[trk_idx] = trk_idx;
+}
+
+/// Stepper stage of the track at position @param q in the queue
+template <typename propagator_t, typename detector_t>
+DETRAY_HOST_DEVICE inline void step(const propagator_t &p,
+                                    wavefront_view<propagator_t> view,
+                                    const detector_t &det, const dindex q) {
+    using view_t = wavefront_view<propagator_t>;
+
+    vecmem::device_vector<typename view_t::state_type> states(view.states);
+    vecmem::device_vector<unsigned int> is_init(view.is_init);
+    vecmem::device_vector<dindex> queue(view.queue);
+
+    const dindex trk_idx{queue[q]};
+    auto &propagation = states[trk_idx];
+    propagation._navigation.set_detector(det);
+
+    p.propagate_stepper(propagation, is_init[trk_idx] != 0u);
+}
+
+/// Navigation stage of the track at position @param q in the queue
+template <typename propagator_t, typename detector_t>
+DETRAY_HOST_DEVICE inline void navigate(const propagator_t &p,
+                                        wavefront_view<propagator_t> view,
+                                        const detector_t &det,
+                                        const dindex q) {
+    using view_t = wavefront_view<propagator_t>;
+
+    vecmem::device_vector<typename view_t::state_type> states(view.states);
+    vecmem::device_vector<unsigned int> is_init(view.is_init);
+    vecmem::device_vector<dindex> queue(view.queue);
+
+    const dindex trk_idx{queue[q]};
+    auto &propagation = states[trk_idx];
+    propagation._navigation.set_detector(det);
+
+    is_init[trk_idx] = p.propagate_navigation(propagation) ? 1u : 0u;
+}
+
+/// Actor stage of the track at position @param q in the queue
+template <typename propagator_t, typename detector_t>
+DETRAY_HOST_DEVICE inline void run_actors(const propagator_t &p,
+                                          wavefront_view<propagator_t> view,
+                                          const detector_t &det,
+                                          const dindex q) {
+    using view_t = wavefront_view<propagator_t>;
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    vecmem::device_vector<typename view_t::state_type> states(view.states);
+    vecmem::device_vector<typename view_t::actor_states_type> actor_states(
+        view.actor_states);
+    vecmem::device_vector<unsigned int> is_init(view.is_init);
+    vecmem::device_vector<dindex> queue(view.queue);
+
+    const dindex trk_idx{queue[q]};
+    auto &propagation = states[trk_idx];
+    propagation._navigation.set_detector(det);
+
+    if (p.propagate_actors(propagation, actor_chain_t::setup_actor_states(
+                                            actor_states[trk_idx]))) {
+        is_init[trk_idx] = 1u;
+    }
+}
+
+/// Compaction: Append the track at position @param q in the queue to the
+/// next queue, if it is still alive
+template <typename propagator_t>
+DETRAY_HOST_DEVICE inline void compact(wavefront_view<propagator_t> view,
+                                       const dindex q) {
+    using view_t = wavefront_view<propagator_t>;
+
+    vecmem::device_vector<typename view_t::state_type> states(view.states);
+    vecmem::device_vector<dindex> queue(view.queue);
+    vecmem::device_vector<dindex> next_queue(view.next_queue);
+    vecmem::device_vector<unsigned int> n_next(view.n_next);
+
+    const dindex trk_idx{queue[q]};
+    if (!states[trk_idx].is_alive()) {
+        return;
+    }
+
+    const unsigned int slot{
+        vecmem::device_atomic_ref<unsigned int>(n_next[0]).fetch_add(1u)};
+    assert(slot < next_queue.size());
+    next_queue[slot] = trk_idx;
+}
+
+}  // namespace wavefront
+
+/// Run the wavefront propagation of all tracks in @param view on the host
+///
+/// Every stage is run for all active tracks before the next stage starts,
+/// like the kernels of a device implementation would be. The result of every
+/// track is the same as for @c propagator::propagate .
+///
+/// @param p the propagator
+/// @param view the per-track data, with the propagation states and the
+///             actor states of all tracks constructed
+/// @param det the detector
+///
+/// @returns the number of steps until all tracks finished
+template <typename propagator_t, typename detector_t>
+DETRAY_HOST inline std::size_t propagate_wavefront(
+    const propagator_t &p, wavefront_view<propagator_t> view,
+    const detector_t &det) {
+
+    const dindex n_tracks{view.states.size()};
+    assert(view.actor_states.size() == n_tracks);
+    assert(view.is_init.size() == n_tracks);
+    assert(view.queue.size() == n_tracks);
+    assert(view.next_queue.size() == n_tracks);
+    assert(view.n_next.size() == 1u);
+
+    vecmem::device_vector<unsigned int> n_next(view.n_next);
+
+    for (dindex trk_idx = 0u; trk_idx < n_tracks; ++trk_idx) {
+        wavefront::init(p, view, det, trk_idx);
+    }
+
+    // Remove the tracks that did not survive the initialization
+    dindex n_active{n_tracks};
+    const auto compact_queue = [&view, &n_next, &n_active]() {
+        n_next[0] = 0u;
+        for (dindex q = 0u; q < n_active; ++q) {
+            wavefront::compact(view, q);
+        }
+        std::swap(view.queue, view.next_queue);
+        n_active = n_next[0];
+    };
+    compact_queue();
+
+    std::size_t n_steps{0u};
+    while (n_active > 0u) {
+        for (dindex q = 0u; q < n_active; ++q) {
+            wavefront::step(p, view, det, q);
+        }
+        for (dindex q = 0u; q < n_active; ++q) {
+            wavefront::navigate(p, view, det, q);
+        }
+        for (dindex q = 0u; q < n_active; ++q) {
+            wavefront::run_actors(p, view, det, q);
+        }
+        compact_queue();
+
+        ++n_steps;
+    }
+
+    return n_steps;
+}
+
+}  // namespace detray::propagation
@@ -15,9 +15,11 @@
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/tracks/detail/packed_covariance.hpp"
 
 // System include(s)
 #include <ostream>
+#include <type_traits>
 
 namespace detray {
 
@@ -269,7 +271,12 @@ struct bound_parameters_vector {
 
 /// Combine the bound track parameter vector with the covariance and associated
 /// surface
-template <concepts::algebra algebra_t>
+///
+/// @tparam covariance_storage_t either the full covariance matrix, or the
+///         packed upper triangle (@c detail::packed_covariance), which is
+///         converted to the full matrix on access
+template <concepts::algebra algebra_t,
+          typename covariance_storage_t = bound_matrix<algebra_t>>
 struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
 
     using base_type = bound_parameters_vector<algebra_t>;
@@ -284,6 +291,15 @@ struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
     // Shorthand vector/matrix types related to bound track parameters.
     using parameter_vector_type = bound_parameters_vector<algebra_t>;
     using covariance_type = bound_matrix<algebra_t>;
+    using covariance_storage_type = covariance_storage_t;
+
+    /// Whether only the upper triangle of the covariance is kept
+    static constexpr bool has_packed_covariance{
+        detail::is_packed_covariance_v<covariance_storage_t>};
+
+    static_assert(has_packed_covariance ||
+                      std::is_same_v<covariance_storage_t, covariance_type>,
+                  "Unknown covariance storage type");
 
     /// @}
 
@@ -296,6 +312,15 @@ struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
                            const covariance_type& cov)
         : base_type(vec), m_covariance(cov), m_barcode(sf_idx) {}
 
+    /// Convert from track parameters with a different covariance storage
+    template <typename other_storage_t>
+    requires(!std::is_same_v<other_storage_t, covariance_storage_t>)
+        DETRAY_HOST_DEVICE explicit bound_track_parameters(
+            const bound_track_parameters<algebra_t, other_storage_t>& other)
+        : base_type(other),
+          m_covariance(other.covariance()),
+          m_barcode(other.surface_link()) {}
+
     /// @param rhs is the left hand side params for comparison
     DETRAY_HOST_DEVICE
     bool operator==(const bound_track_parameters& rhs) const {
@@ -309,8 +334,8 @@ struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
 
         for (unsigned int i = 0u; i < e_bound_size; i++) {
             for (unsigned int j = 0u; j < e_bound_size; j++) {
-                const auto lhs_val = getter::element(m_covariance, i, j);
-                const auto rhs_val = getter::element(rhs.covariance(), i, j);
+                const auto lhs_val = covariance_element(i, j);
+                const auto rhs_val = rhs.covariance_element(i, j);
 
                 if (math::fabs(lhs_val - rhs_val) >
                     std::numeric_limits<scalar_type>::epsilon()) {
@@ -339,15 +364,47 @@ struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
 
     /// @returns the track parameter covariance - non-const
     DETRAY_HOST_DEVICE
-    covariance_type& covariance() { return m_covariance; }
+    covariance_type& covariance() requires(!has_packed_covariance) {
+        return m_covariance;
+    }
 
     /// @returns the track parameter covariance - const
     DETRAY_HOST_DEVICE
-    const covariance_type& covariance() const { return m_covariance; }
+    decltype(auto) covariance() const {
+        if constexpr (has_packed_covariance) {
+            // Unpack to the full matrix
+            return m_covariance.unpack();
+        } else {
+            return static_cast<const covariance_type&>(m_covariance);
+        }
+    }
+
+    /// @returns the underlying covariance storage (full or packed) - non-const
+    DETRAY_HOST_DEVICE
+    covariance_storage_type& covariance_storage() { return m_covariance; }
+
+    /// @returns the underlying covariance storage (full or packed) - const
+    DETRAY_HOST_DEVICE
+    const covariance_storage_type& covariance_storage() const {
+        return m_covariance;
+    }
+
+    /// @returns the covariance element (i, j) without unpacking
+    DETRAY_HOST_DEVICE
+    scalar_type covariance_element(const unsigned int i,
+                                   const unsigned int j) const {
+        return detail::covariance_element(m_covariance, i, j);
+    }
 
     /// Set the track parameter covariance
     DETRAY_HOST_DEVICE
-    void set_covariance(const covariance_type& c) { m_covariance = c; }
+    void set_covariance(const covariance_type& c) {
+        if constexpr (has_packed_covariance) {
+            m_covariance.pack(c);
+        } else {
+            m_covariance = c;
+        }
+    }
 
     /// @param do_check toggle checking (e.g. don't trigger assertions for
     /// documented errors)
@@ -362,10 +419,24 @@ struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
         }
 
         // @TODO: Add tests positive semi-definite, check the determinant etc
-        return (m_covariance == matrix::zero<covariance_type>());
+        if constexpr (has_packed_covariance) {
+            return m_covariance.is_zero();
+        } else {
+            return (m_covariance == matrix::zero<covariance_type>());
+        }
     }
 
     private:
+    /// @returns a zero covariance in the storage format
+    DETRAY_HOST_DEVICE
+    static constexpr covariance_storage_type zero_covariance() {
+        if constexpr (has_packed_covariance) {
+            return covariance_storage_type{};
+        } else {
+            return matrix::zero<covariance_type>();
+        }
+    }
+
     /// Transform to a string for debugging output
     DETRAY_HOST
     friend std::ostream& operator<<(std::ostream& out_stream,
@@ -373,13 +444,19 @@ struct bound_track_parameters : public bound_parameters_vector<algebra_t> {
         out_stream << "Surface: " << bparam.m_barcode << std::endl;
         out_stream << "Param.:\n " << static_cast<parameter_vector_type>(bparam)
                    << std::endl;
-        out_stream << "Cov.:\n" << bparam.m_covariance;
+        out_stream << "Cov.:\n" << bparam.covariance();
 
         return out_stream;
     }
 
-    covariance_type m_covariance = matrix::zero<covariance_type>();
+    covariance_storage_type m_covariance = zero_covariance();
     geometry::barcode m_barcode{};
 };
 
+/// Bound track parameters with the packed covariance storage, e.g. for
+/// large track containers
+template <concepts::algebra algebra_t>
+using packed_bound_track_parameters =
+    bound_track_parameters<algebra_t, detail::packed_covariance<algebra_t>>;
+
 }  // namespace detray
@@ -0,0 +1,85 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/geometry/barcode.hpp"
+
+// System include(s)
+#include <concepts>
+
+namespace detray::concepts {
+
+/// Free track parameters (or a proxy into a collection of them)
+template <class T>
+concept free_track_params = requires(const T t) {
+
+    typename T::algebra_type;
+    typename T::scalar_type;
+
+    { t.pos() }
+    ->std::convertible_to<dpoint3D<typename T::algebra_type>>;
+
+    { t.dir() }
+    ->std::convertible_to<dvector3D<typename T::algebra_type>>;
+
+    { t.time() }
+    ->std::same_as<typename T::scalar_type>;
+
+    { t.qop() }
+    ->std::same_as<typename T::scalar_type>;
+};
+
+/// Free track parameters that can be written to (e.g. a mutable proxy into a
+/// collection of them)
+template <class T>
+concept mutable_free_track_params = free_track_params<T> &&
+    requires(T t, const dpoint3D<typename T::algebra_type> &p,
+             const dvector3D<typename T::algebra_type> &d,
+             const typename T::scalar_type s) {
+    t.set_pos(p);
+    t.set_dir(d);
+    t.set_time(s);
+    t.set_qop(s);
+};
+
+/// Bound track parameters (or a proxy into a collection of them)
+template <class T>
+concept bound_track_params = requires(const T t) {
+
+    typename T::algebra_type;
+    typename T::scalar_type;
+
+    { t.bound_local() }
+    ->std::convertible_to<dpoint2D<typename T::algebra_type>>;
+
+    { t.phi() }
+    ->std::same_as<typename T::scalar_type>;
+
+    { t.theta() }
+    ->std::same_as<typename T::scalar_type>;
+
+    { t.dir() }
+    ->std::convertible_to<dvector3D<typename T::algebra_type>>;
+
+    { t.time() }
+    ->std::same_as<typename T::scalar_type>;
+
+    { t.qop() }
+    ->std::same_as<typename T::scalar_type>;
+
+    { t.surface_link() }
+    ->std::convertible_to<detray::geometry::barcode>;
+
+    { t.covariance() }
+    ->std::convertible_to<bound_matrix<typename T::algebra_type>>;
+};
+
+}  // namespace detray::concepts
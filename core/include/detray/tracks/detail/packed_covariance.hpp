@@ -0,0 +1,195 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+
+// System include(s)
+#include <cassert>
+#include <type_traits>
+
+namespace detray::detail {
+
+/// Bound track covariance that only keeps the upper triangle of the
+/// symmetric matrix (21 instead of 36 elements), stored row by row.
+template <concepts::algebra algebra_t>
+struct packed_covariance {
+
+    /// @name Type definitions for the struct
+    /// @{
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using matrix_type = bound_matrix<algebra_t>;
+    /// @}
+
+    /// Number of rows/columns of the full matrix
+    static constexpr unsigned int dim{e_bound_size};
+    /// Number of stored elements
+    static constexpr unsigned int size{dim * (dim + 1u) / 2u};
+
+    /// Default constructor sets the covariance to zero
+    constexpr packed_covariance() = default;
+
+    /// Construct from a full (symmetric) covariance matrix
+    DETRAY_HOST_DEVICE
+    explicit packed_covariance(const matrix_type& cov) { pack(cov); }
+
+    /// @returns the position of the element (i, j) in the packed storage
+    DETRAY_HOST_DEVICE
+    static constexpr unsigned int index(const unsigned int i,
+                                        const unsigned int j) {
+        assert(i < dim && j < dim);
+        // Use the upper triangle for both (i, j) and (j, i)
+        const unsigned int r{i < j ? i : j};
+        const unsigned int c{i < j ? j : i};
+
+        return r * dim - r * (r - 1u) / 2u + (c - r);
+    }
+
+    /// @returns the element (i, j) - const
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type operator()(const unsigned int i,
+                                     const unsigned int j) const {
+        return m_data[index(i, j)];
+    }
+
+    /// @returns the element (i, j) and its mirror (j, i) - non-const
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type& operator()(const unsigned int i,
+                                      const unsigned int j) {
+        return m_data[index(i, j)];
+    }
+
+    /// Store the upper triangle of the matrix @param cov
+    DETRAY_HOST_DEVICE
+    constexpr void pack(const matrix_type& cov) {
+        unsigned int n{0u};
+        for (unsigned int i = 0u; i < dim; ++i) {
+            for (unsigned int j = i; j < dim; ++j) {
+                m_data[n++] = getter::element(cov, i, j);
+            }
+        }
+    }
+
+    /// @returns the full symmetric matrix
+    DETRAY_HOST_DEVICE
+    constexpr matrix_type unpack() const {
+        matrix_type cov = matrix::zero<matrix_type>();
+        unsigned int n{0u};
+        for (unsigned int i = 0u; i < dim; ++i) {
+            for (unsigned int j = i; j < dim; ++j) {
+                getter::element(cov, i, j) = m_data[n];
+                getter::element(cov, j, i) = m_data[n];
+                ++n;
+            }
+        }
+
+        return cov;
+    }
+
+    /// @returns true if all elements are zero
+    DETRAY_HOST_DEVICE
+    constexpr bool is_zero() const {
+        for (const scalar_type v : m_data) {
+            if (v != 0.f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @returns access to the packed elements
+    DETRAY_HOST_DEVICE
+    constexpr const darray<scalar_type, size>& data() const { return m_data; }
+
+    private:
+    darray<scalar_type, size> m_data{};
+};
+
+/// Check whether a covariance storage type is packed
+/// @{
+template <typename T>
+struct is_packed_covariance : public std::false_type {};
+
+template <concepts::algebra algebra_t>
+struct is_packed_covariance<packed_covariance<algebra_t>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_packed_covariance_v = is_packed_covariance<T>::value;
+/// @}
+
+/// @returns the element (i, j) of a full or packed covariance @param cov
+template <typename covariance_t>
+DETRAY_HOST_DEVICE constexpr auto covariance_element(const covariance_t& cov,
+                                                     const unsigned int i,
+                                                     const unsigned int j) {
+    if constexpr (is_packed_covariance_v<covariance_t>) {
+        return cov(i, j);
+    } else {
+        return getter::element(cov, i, j);
+    }
+}
+
+/// Symmetric similarity transform J * C * J^T of the covariance @param cov
+///
+/// Only the upper triangle of the result is computed (21 of the 36 dot
+/// products of the second product) and the result is written to @param out,
+/// which is exactly symmetric afterwards. The input and output storage can
+/// be full or packed.
+template <concepts::algebra algebra_t, typename in_covariance_t,
+          typename out_covariance_t>
+DETRAY_HOST_DEVICE constexpr void symmetric_transport(
+    const bound_matrix<algebra_t>& J, const in_covariance_t& cov,
+    out_covariance_t& out) {
+
+    using scalar_t = dscalar<algebra_t>;
+    using matrix_t = bound_matrix<algebra_t>;
+    constexpr unsigned int dim{e_bound_size};
+
+    // Full storage: Use the unrolled 6x6 kernel of the algebra layer
+    if constexpr (std::is_same_v<in_covariance_t, matrix_t> &&
+                  std::is_same_v<out_covariance_t, matrix_t>) {
+        out = matrix::similarity_6x6(J, cov);
+        return;
+    }
+
+    // T = J * C
+    scalar_t T[dim][dim];
+    for (unsigned int i = 0u; i < dim; ++i) {
+        for (unsigned int j = 0u; j < dim; ++j) {
+            scalar_t sum{0.f};
+            for (unsigned int k = 0u; k < dim; ++k) {
+                sum += getter::element(J, i, k) * covariance_element(cov, k, j);
+            }
+            T[i][j] = sum;
+        }
+    }
+
+    // Upper triangle of T * J^T
+    for (unsigned int i = 0u; i < dim; ++i) {
+        for (unsigned int j = i; j < dim; ++j) {
+            scalar_t sum{0.f};
+            for (unsigned int k = 0u; k < dim; ++k) {
+                sum += T[i][k] * getter::element(J, j, k);
+            }
+            if constexpr (is_packed_covariance_v<out_covariance_t>) {
+                out(i, j) = sum;
+            } else {
+                getter::element(out, i, j) = sum;
+                getter::element(out, j, i) = sum;
+            }
+        }
+    }
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,191 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace detray::detail {
+
+/// @brief Fixed number of scalar columns of the same length (SoA).
+///
+/// Every component of a collection of track parameters is kept in its own
+/// contiguous column, so that neighbouring threads/lanes that work on
+/// neighbouring tracks load neighbouring addresses.
+///
+/// @tparam value_t the value type of the columns
+/// @tparam N the number of columns
+/// @tparam container_t the types of underlying containers to be used.
+template <typename value_t, std::size_t N,
+          typename container_t = host_container_types>
+class soa_columns {
+
+    template <std::size_t>
+    using column_view_t = dvector_view<value_t>;
+    template <std::size_t>
+    using column_const_view_t = dvector_view<const value_t>;
+    template <std::size_t>
+    using column_buffer_t = dvector_buffer<value_t>;
+
+    /// Expand the column types into a multi-view/buffer type
+    template <typename>
+    struct column_types;
+
+    template <std::size_t... I>
+    struct column_types<std::index_sequence<I...>> {
+        using view_type = dmulti_view<column_view_t<I>...>;
+        using const_view_type = dmulti_view<column_const_view_t<I>...>;
+        using buffer_type = dmulti_buffer<column_buffer_t<I>...>;
+    };
+
+    using column_seq_t = std::make_index_sequence<N>;
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using value_type = value_t;
+    using size_type = dindex;
+
+    /// Number of columns
+    static constexpr std::size_t n_columns{N};
+
+    using view_type = typename column_types<column_seq_t>::view_type;
+    using const_view_type =
+        typename column_types<column_seq_t>::const_view_type;
+    using buffer_type = typename column_types<column_seq_t>::buffer_type;
+
+    /// Default constructor
+    constexpr soa_columns() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit soa_columns(vecmem::memory_resource* resource)
+        : soa_columns(resource, column_seq_t{}) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit soa_columns(vecmem::memory_resource& resource)
+        : soa_columns(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view columns_view_t>
+    DETRAY_HOST_DEVICE explicit soa_columns(columns_view_t& view)
+        : soa_columns(view, column_seq_t{}) {}
+
+    /// @returns the length of the columns
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const noexcept {
+        return static_cast<size_type>(m_columns[0].size());
+    }
+
+    /// @returns true if the columns are empty
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const noexcept { return size() == 0u; }
+
+    /// Reserve space for @param n entries in every column
+    DETRAY_HOST
+    void reserve(const std::size_t n) {
+        for (auto& col : m_columns) {
+            col.reserve(n);
+        }
+    }
+
+    /// Resize all columns to @param n entries
+    DETRAY_HOST
+    void resize(const std::size_t n) {
+        for (auto& col : m_columns) {
+            col.resize(n);
+        }
+    }
+
+    /// Remove all entries
+    DETRAY_HOST
+    void clear() {
+        for (auto& col : m_columns) {
+            col.clear();
+        }
+    }
+
+    /// @returns the column @param c - const
+    DETRAY_HOST_DEVICE
+    constexpr const vector_type<value_t>& column(const std::size_t c) const {
+        assert(c < N);
+        return m_columns[c];
+    }
+
+    /// @returns the column @param c - non-const
+    DETRAY_HOST_DEVICE
+    constexpr vector_type<value_t>& column(const std::size_t c) {
+        assert(c < N);
+        return m_columns[c];
+    }
+
+    /// @returns the entry @param i of the column @param c - const
+    DETRAY_HOST_DEVICE
+    constexpr value_t operator()(const std::size_t c,
+                                 const std::size_t i) const {
+        assert(i < size());
+        return column(c)[i];
+    }
+
+    /// @returns the entry @param i of the column @param c - non-const
+    DETRAY_HOST_DEVICE
+    constexpr value_t& operator()(const std::size_t c, const std::size_t i) {
+        assert(i < size());
+        return column(c)[i];
+    }
+
+    /// @return the view on the columns - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type { return get_data(column_seq_t{}); }
+
+    /// @return the view on the columns - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return get_data(column_seq_t{});
+    }
+
+    private:
+    template <std::size_t... I>
+    DETRAY_HOST soa_columns(vecmem::memory_resource* resource,
+                            std::index_sequence<I...>)
+        : m_columns{((void)I, vector_type<value_t>(resource))...} {}
+
+    template <typename columns_view_t, std::size_t... I>
+    DETRAY_HOST_DEVICE soa_columns(columns_view_t& view,
+                                   std::index_sequence<I...>)
+        : m_columns{vector_type<value_t>(detail::get<I>(view.m_view))...} {}
+
+    template <std::size_t... I>
+    DETRAY_HOST auto get_data(std::index_sequence<I...>) -> view_type {
+        return view_type{detray::get_data(m_columns[I])...};
+    }
+
+    template <std::size_t... I>
+    DETRAY_HOST auto get_data(std::index_sequence<I...>) const
+        -> const_view_type {
+        return const_view_type{detray::get_data(m_columns[I])...};
+    }
+
+    /// One contiguous container per component
+    darray<vector_type<value_t>, N> m_columns{};
+};
+
+}  // namespace detray::detail
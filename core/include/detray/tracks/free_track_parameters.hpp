@@ -12,8 +12,10 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/math.hpp"
 #include "detray/definitions/track_parametrization.hpp"
+#include "detray/tracks/detail/concepts.hpp"
 
 // System include(s)
+#include <concepts>
 #include <ostream>
 
 namespace detray {
@@ -63,6 +65,17 @@ struct free_parameters_vector {
         assert(!this->is_invalid());
     }
 
+    /// Construct from free track parameters in a different layout (e.g. a
+    /// proxy into a user track collection)
+    template <concepts::free_track_params track_t>
+    requires(!std::same_as<track_t, free_parameters_vector>) DETRAY_HOST_DEVICE
+        explicit free_parameters_vector(const track_t& track) {
+        set_pos(track.pos());
+        set_time(track.time());
+        set_dir(track.dir());
+        set_qop(track.qop());
+    }
+
     /// @param rhs is the left hand side params for comparison
     DETRAY_HOST_DEVICE
     bool operator==(const free_parameters_vector& rhs) const {
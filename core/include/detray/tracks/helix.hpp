@@ -136,7 +136,7 @@ class helix {
 
         // Handle the case of pT ~ 0
         if (_vz_over_vt == detail::invalid_value<scalar_type>()) {
-            return _pos + s * _h0;
+            return _pos + s * _t0;
         }
 
         point3_type ret = _pos;
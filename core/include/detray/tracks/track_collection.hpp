@@ -0,0 +1,643 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/tracks/bound_track_parameters.hpp"
+#include "detray/tracks/detail/concepts.hpp"
+#include "detray/tracks/detail/packed_covariance.hpp"
+#include "detray/tracks/detail/soa_columns.hpp"
+#include "detray/tracks/free_track_parameters.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Element proxy into a collection of free track parameters.
+///
+/// Reads and writes the components of one track directly in the columns of
+/// the collection. Converts to @c free_track_parameters on demand.
+///
+/// @tparam collection_t the (possibly const) collection type
+template <typename collection_t>
+class free_track_proxy {
+
+    static constexpr bool is_mutable{!std::is_const_v<collection_t>};
+
+    public:
+    /// @name Type definitions for the struct
+    /// @{
+    using algebra_type = typename collection_t::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using point3_type = dpoint3D<algebra_type>;
+    using vector3_type = dvector3D<algebra_type>;
+    using value_type = free_track_parameters<algebra_type>;
+    /// @}
+
+    DETRAY_HOST_DEVICE
+    free_track_proxy(collection_t& coll, const dindex i)
+        : m_coll{&coll}, m_idx{i} {
+        assert(i < coll.size());
+    }
+
+    free_track_proxy(const free_track_proxy&) = default;
+
+    /// Assign the values of another track
+    DETRAY_HOST_DEVICE
+    free_track_proxy& operator=(const free_track_proxy& other) requires(
+        is_mutable) {
+        return *this = static_cast<value_type>(other);
+    }
+
+    /// Assign the values of the free track parameters @param track
+    DETRAY_HOST_DEVICE
+    free_track_proxy& operator=(const value_type& track) requires(is_mutable) {
+        for (unsigned int c = 0u; c < e_free_size; ++c) {
+            at(c) = track[c];
+        }
+        return *this;
+    }
+
+    /// @returns the free track parameters (loaded from the columns)
+    DETRAY_HOST_DEVICE
+    operator value_type() const {
+        free_vector<algebra_type> vec =
+            matrix::zero<free_vector<algebra_type>>();
+        for (unsigned int c = 0u; c < e_free_size; ++c) {
+            getter::element(vec, c, 0u) = (*this)[c];
+        }
+        return value_type{vec};
+    }
+
+    /// @returns the free track parameter @param c
+    DETRAY_HOST_DEVICE
+    scalar_type operator[](const std::size_t c) const {
+        return m_coll->columns()(c, m_idx);
+    }
+
+    /// @returns the global track position
+    DETRAY_HOST_DEVICE
+    point3_type pos() const {
+        return {(*this)[e_free_pos0], (*this)[e_free_pos1],
+                (*this)[e_free_pos2]};
+    }
+
+    /// Set the global track position
+    DETRAY_HOST_DEVICE
+    void set_pos(const point3_type& pos) requires(is_mutable) {
+        at(e_free_pos0) = pos[0];
+        at(e_free_pos1) = pos[1];
+        at(e_free_pos2) = pos[2];
+    }
+
+    /// @returns the normalized, global track direction
+    DETRAY_HOST_DEVICE
+    vector3_type dir() const {
+        return {(*this)[e_free_dir0], (*this)[e_free_dir1],
+                (*this)[e_free_dir2]};
+    }
+
+    /// Set the global track direction
+    DETRAY_HOST_DEVICE
+    void set_dir(const vector3_type& dir) requires(is_mutable) {
+        at(e_free_dir0) = dir[0];
+        at(e_free_dir1) = dir[1];
+        at(e_free_dir2) = dir[2];
+    }
+
+    /// @returns the time
+    DETRAY_HOST_DEVICE
+    scalar_type time() const { return (*this)[e_free_time]; }
+
+    /// Set the time
+    DETRAY_HOST_DEVICE
+    void set_time(const scalar_type t) requires(is_mutable) {
+        assert(math::isfinite(t));
+        at(e_free_time) = t;
+    }
+
+    /// @returns the q/p value
+    DETRAY_HOST_DEVICE
+    scalar_type qop() const { return (*this)[e_free_qoverp]; }
+
+    /// Set the q/p value
+    DETRAY_HOST_DEVICE
+    void set_qop(const scalar_type qop) requires(is_mutable) {
+        assert(math::isfinite(qop));
+        at(e_free_qoverp) = qop;
+    }
+
+    private:
+    DETRAY_HOST_DEVICE
+    scalar_type& at(const std::size_t c) requires(is_mutable) {
+        return m_coll->columns()(c, m_idx);
+    }
+
+    collection_t* m_coll{nullptr};
+    dindex m_idx{dindex_invalid};
+};
+
+/// @brief Collection of free track parameters in SoA layout
+///
+/// @tparam algebra_t the algebra type of the track parameters
+/// @tparam container_t the types of underlying containers to be used.
+template <concepts::algebra algebra_t,
+          typename container_t = host_container_types>
+class free_track_collection {
+
+    using columns_type =
+        detail::soa_columns<dscalar<algebra_t>, e_free_size, container_t>;
+
+    public:
+    /// @name Type definitions for the struct
+    /// @{
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using size_type = dindex;
+    using value_type = free_track_parameters<algebra_t>;
+    using reference = free_track_proxy<free_track_collection>;
+    using const_reference = free_track_proxy<const free_track_collection>;
+
+    using view_type = typename columns_type::view_type;
+    using const_view_type = typename columns_type::const_view_type;
+    using buffer_type = typename columns_type::buffer_type;
+    /// @}
+
+    /// Default constructor
+    constexpr free_track_collection() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit free_track_collection(vecmem::memory_resource* resource)
+        : m_columns(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit free_track_collection(vecmem::memory_resource& resource)
+        : free_track_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view coll_view_t>
+    DETRAY_HOST_DEVICE explicit free_track_collection(coll_view_t& view)
+        : m_columns(view) {}
+
+    /// @returns the number of tracks
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const noexcept { return m_columns.size(); }
+
+    /// @returns true if the collection holds no tracks
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const noexcept { return m_columns.empty(); }
+
+    /// Reserve space for @param n tracks
+    DETRAY_HOST
+    void reserve(const std::size_t n) { m_columns.reserve(n); }
+
+    /// Resize to @param n tracks
+    DETRAY_HOST
+    void resize(const std::size_t n) { m_columns.resize(n); }
+
+    /// Remove all tracks
+    DETRAY_HOST
+    void clear() { m_columns.clear(); }
+
+    /// Append the track @param track
+    DETRAY_HOST
+    void push_back(const value_type& track) {
+        m_columns.resize(size() + 1u);
+        (*this)[size() - 1u] = track;
+    }
+
+    /// @returns the track @param i - const
+    DETRAY_HOST_DEVICE
+    const_reference operator[](const std::size_t i) const {
+        return {*this, static_cast<dindex>(i)};
+    }
+
+    /// @returns the track @param i - non-const
+    DETRAY_HOST_DEVICE
+    reference operator[](const std::size_t i) {
+        return {*this, static_cast<dindex>(i)};
+    }
+
+    /// @returns the columns of the track components (in the order of the
+    /// free parametrization) - const
+    DETRAY_HOST_DEVICE
+    constexpr const columns_type& columns() const { return m_columns; }
+
+    /// @returns the columns of the track components - non-const
+    DETRAY_HOST_DEVICE
+    constexpr columns_type& columns() { return m_columns; }
+
+    /// @return the view on the collection - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type { return m_columns.get_data(); }
+
+    /// @return the view on the collection - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type { return m_columns.get_data(); }
+
+    private:
+    columns_type m_columns{};
+};
+
+/// @brief Element proxy into a collection of bound track parameters.
+///
+/// Reads and writes the components of one track directly in the columns of
+/// the collection. Converts to @c bound_track_parameters on demand, the
+/// covariance is unpacked on access.
+///
+/// @tparam collection_t the (possibly const) collection type
+template <typename collection_t>
+class bound_track_proxy {
+
+    static constexpr bool is_mutable{!std::is_const_v<collection_t>};
+
+    public:
+    /// @name Type definitions for the struct
+    /// @{
+    using algebra_type = typename collection_t::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using point2_type = dpoint2D<algebra_type>;
+    using vector3_type = dvector3D<algebra_type>;
+    using parameter_vector_type = bound_parameters_vector<algebra_type>;
+    using covariance_type = bound_matrix<algebra_type>;
+    using value_type = bound_track_parameters<algebra_type>;
+    /// @}
+
+    DETRAY_HOST_DEVICE
+    bound_track_proxy(collection_t& coll, const dindex i)
+        : m_coll{&coll}, m_idx{i} {
+        assert(i < coll.size());
+    }
+
+    bound_track_proxy(const bound_track_proxy&) = default;
+
+    /// Assign the values of another track
+    DETRAY_HOST_DEVICE
+    bound_track_proxy& operator=(const bound_track_proxy& other) requires(
+        is_mutable) {
+        // Copy the packed covariance without unpacking
+        for (unsigned int c = 0u; c < collection_t::n_scalar_columns; ++c) {
+            at(c) = other.m_coll->columns()(c, other.m_idx);
+        }
+        set_surface_link(other.surface_link());
+
+        return *this;
+    }
+
+    /// Assign the values of the bound track parameters @param track
+    template <typename cov_storage_t>
+    DETRAY_HOST_DEVICE bound_track_proxy& operator=(
+        const bound_track_parameters<algebra_type, cov_storage_t>&
+            track) requires(is_mutable) {
+        set_parameter_vector(track);
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                at(cov_column(i, j)) = track.covariance_element(i, j);
+            }
+        }
+        set_surface_link(track.surface_link());
+
+        return *this;
+    }
+
+    /// @returns the bound track parameters (loaded from the columns)
+    DETRAY_HOST_DEVICE
+    operator value_type() const {
+        return {surface_link(), static_cast<parameter_vector_type>(*this),
+                covariance()};
+    }
+
+    /// @returns the bound parameter vector (loaded from the columns)
+    DETRAY_HOST_DEVICE
+    operator parameter_vector_type() const {
+        bound_vector<algebra_type> vec =
+            matrix::zero<bound_vector<algebra_type>>();
+        for (unsigned int c = 0u; c < e_bound_size; ++c) {
+            getter::element(vec, c, 0u) = (*this)[c];
+        }
+        return parameter_vector_type{vec};
+    }
+
+    /// @returns the bound track parameter @param c
+    DETRAY_HOST_DEVICE
+    scalar_type operator[](const std::size_t c) const {
+        assert(c < e_bound_size);
+        return m_coll->columns()(c, m_idx);
+    }
+
+    /// @returns the barcode of the associated surface
+    DETRAY_HOST_DEVICE
+    geometry::barcode surface_link() const {
+        return m_coll->surface_links()[m_idx];
+    }
+
+    /// Set the barcode of the associated surface
+    DETRAY_HOST_DEVICE
+    void set_surface_link(const geometry::barcode link) requires(is_mutable) {
+        m_coll->surface_links()[m_idx] = link;
+    }
+
+    /// Set the track parameter vector
+    DETRAY_HOST_DEVICE
+    void set_parameter_vector(const parameter_vector_type& v) requires(
+        is_mutable) {
+        for (unsigned int c = 0u; c < e_bound_size; ++c) {
+            at(c) = v[c];
+        }
+    }
+
+    /// @returns the bound local position
+    DETRAY_HOST_DEVICE
+    point2_type bound_local() const {
+        return {(*this)[e_bound_loc0], (*this)[e_bound_loc1]};
+    }
+
+    /// Set the bound local position
+    DETRAY_HOST_DEVICE
+    void set_bound_local(const point2_type& pos) requires(is_mutable) {
+        at(e_bound_loc0) = pos[0];
+        at(e_bound_loc1) = pos[1];
+    }
+
+    /// @returns the global phi angle
+    DETRAY_HOST_DEVICE
+    scalar_type phi() const { return (*this)[e_bound_phi]; }
+
+    /// Set the global phi angle
+    DETRAY_HOST_DEVICE
+    void set_phi(const scalar_type phi) requires(is_mutable) {
+        assert(math::fabs(phi) <= constant<scalar_type>::pi);
+        at(e_bound_phi) = phi;
+    }
+
+    /// @returns the global theta angle
+    DETRAY_HOST_DEVICE
+    scalar_type theta() const { return (*this)[e_bound_theta]; }
+
+    /// Set the global theta angle
+    DETRAY_HOST_DEVICE
+    void set_theta(const scalar_type theta) requires(is_mutable) {
+        assert(0.f < theta);
+        assert(theta <= constant<scalar_type>::pi);
+        at(e_bound_theta) = theta;
+    }
+
+    /// @returns the global track direction
+    DETRAY_HOST_DEVICE
+    vector3_type dir() const {
+        const scalar_type phi{this->phi()};
+        const scalar_type theta{this->theta()};
+        const scalar_type sinTheta{math::sin(theta)};
+
+        return {math::cos(phi) * sinTheta, math::sin(phi) * sinTheta,
+                math::cos(theta)};
+    }
+
+    /// @returns the time
+    DETRAY_HOST_DEVICE
+    scalar_type time() const { return (*this)[e_bound_time]; }
+
+    /// Set the time
+    DETRAY_HOST_DEVICE
+    void set_time(const scalar_type t) requires(is_mutable) {
+        assert(math::isfinite(t));
+        at(e_bound_time) = t;
+    }
+
+    /// @returns the q/p value
+    DETRAY_HOST_DEVICE
+    scalar_type qop() const { return (*this)[e_bound_qoverp]; }
+
+    /// Set the q/p value
+    DETRAY_HOST_DEVICE
+    void set_qop(const scalar_type qop) requires(is_mutable) {
+        assert(math::isfinite(qop));
+        at(e_bound_qoverp) = qop;
+    }
+
+    /// @returns the covariance element (i, j) without unpacking
+    DETRAY_HOST_DEVICE
+    scalar_type covariance_element(const unsigned int i,
+                                   const unsigned int j) const {
+        return m_coll->columns()(cov_column(i, j), m_idx);
+    }
+
+    /// @returns the full track parameter covariance
+    DETRAY_HOST_DEVICE
+    covariance_type covariance() const {
+        covariance_type cov = matrix::zero<covariance_type>();
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                const scalar_type val{covariance_element(i, j)};
+                getter::element(cov, i, j) = val;
+                getter::element(cov, j, i) = val;
+            }
+        }
+        return cov;
+    }
+
+    /// Set the track parameter covariance (only the upper triangle is kept)
+    DETRAY_HOST_DEVICE
+    void set_covariance(const covariance_type& cov) requires(is_mutable) {
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                at(cov_column(i, j)) = getter::element(cov, i, j);
+            }
+        }
+    }
+
+    private:
+    template <typename>
+    friend class bound_track_proxy;
+
+    /// @returns the column of the covariance element (i, j)
+    DETRAY_HOST_DEVICE
+    static constexpr unsigned int cov_column(const unsigned int i,
+                                             const unsigned int j) {
+        return e_bound_size +
+               detail::packed_covariance<algebra_type>::index(i, j);
+    }
+
+    DETRAY_HOST_DEVICE
+    scalar_type& at(const std::size_t c) requires(is_mutable) {
+        return m_coll->columns()(c, m_idx);
+    }
+
+    collection_t* m_coll{nullptr};
+    dindex m_idx{dindex_invalid};
+};
+
+/// @brief Collection of bound track parameters in SoA layout
+///
+/// Every parameter and every element of the upper triangle of the
+/// covariance is a column of its own. The surface links are kept in an
+/// extra column.
+///
+/// @tparam algebra_t the algebra type of the track parameters
+/// @tparam container_t the types of underlying containers to be used.
+template <concepts::algebra algebra_t,
+          typename container_t = host_container_types>
+class bound_track_collection {
+
+    public:
+    /// Parameters and packed covariance
+    static constexpr std::size_t n_scalar_columns{
+        e_bound_size + detail::packed_covariance<algebra_t>::size};
+
+    private:
+    using columns_type = detail::soa_columns<dscalar<algebra_t>,
+                                             n_scalar_columns, container_t>;
+
+    public:
+    /// @name Type definitions for the struct
+    /// @{
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using size_type = dindex;
+    using value_type = bound_track_parameters<algebra_t>;
+    using reference = bound_track_proxy<bound_track_collection>;
+    using const_reference = bound_track_proxy<const bound_track_collection>;
+
+    using view_type = dmulti_view<typename columns_type::view_type,
+                                  dvector_view<geometry::barcode>>;
+    using const_view_type =
+        dmulti_view<typename columns_type::const_view_type,
+                    dvector_view<const geometry::barcode>>;
+    using buffer_type = dmulti_buffer<typename columns_type::buffer_type,
+                                      dvector_buffer<geometry::barcode>>;
+    /// @}
+
+    /// Default constructor
+    constexpr bound_track_collection() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit bound_track_collection(vecmem::memory_resource* resource)
+        : m_columns(resource), m_surface_links(resource) {}
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit bound_track_collection(vecmem::memory_resource& resource)
+        : bound_track_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view coll_view_t>
+    DETRAY_HOST_DEVICE explicit bound_track_collection(coll_view_t& view)
+        : m_columns(detail::get<0>(view.m_view)),
+          m_surface_links(detail::get<1>(view.m_view)) {}
+
+    /// @returns the number of tracks
+    DETRAY_HOST_DEVICE
+    constexpr size_type size() const noexcept {
+        return static_cast<size_type>(m_surface_links.size());
+    }
+
+    /// @returns true if the collection holds no tracks
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const noexcept { return size() == 0u; }
+
+    /// Reserve space for @param n tracks
+    DETRAY_HOST
+    void reserve(const std::size_t n) {
+        m_columns.reserve(n);
+        m_surface_links.reserve(n);
+    }
+
+    /// Resize to @param n tracks
+    DETRAY_HOST
+    void resize(const std::size_t n) {
+        m_columns.resize(n);
+        m_surface_links.resize(n);
+    }
+
+    /// Remove all tracks
+    DETRAY_HOST
+    void clear() {
+        m_columns.clear();
+        m_surface_links.clear();
+    }
+
+    /// Append the track @param track
+    template <typename cov_storage_t>
+    DETRAY_HOST void push_back(
+        const bound_track_parameters<algebra_t, cov_storage_t>& track) {
+        resize(size() + 1u);
+        (*this)[size() - 1u] = track;
+    }
+
+    /// @returns the track @param i - const
+    DETRAY_HOST_DEVICE
+    const_reference operator[](const std::size_t i) const {
+        return {*this, static_cast<dindex>(i)};
+    }
+
+    /// @returns the track @param i - non-const
+    DETRAY_HOST_DEVICE
+    reference operator[](const std::size_t i) {
+        return {*this, static_cast<dindex>(i)};
+    }
+
+    /// @returns the columns of the track parameters, followed by the packed
+    /// covariance (@see detail::packed_covariance::index ) - const
+    DETRAY_HOST_DEVICE
+    constexpr const columns_type& columns() const { return m_columns; }
+
+    /// @returns the columns of the track parameters - non-const
+    DETRAY_HOST_DEVICE
+    constexpr columns_type& columns() { return m_columns; }
+
+    /// @returns the surface links - const
+    DETRAY_HOST_DEVICE
+    constexpr const vector_type<geometry::barcode>& surface_links() const {
+        return m_surface_links;
+    }
+
+    /// @returns the surface links - non-const
+    DETRAY_HOST_DEVICE
+    constexpr vector_type<geometry::barcode>& surface_links() {
+        return m_surface_links;
+    }
+
+    /// @return the view on the collection - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type {
+        return view_type{m_columns.get_data(),
+                         detray::get_data(m_surface_links)};
+    }
+
+    /// @return the view on the collection - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{m_columns.get_data(),
+                               detray::get_data(m_surface_links)};
+    }
+
+    private:
+    columns_type m_columns{};
+    vector_type<geometry::barcode> m_surface_links{};
+};
+
+}  // namespace detray
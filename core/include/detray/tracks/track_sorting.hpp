@@ -0,0 +1,146 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Binning of the track directions for the track sorting
+template <concepts::scalar scalar_t>
+struct track_sorting_config {
+    /// Number of bins in eta
+    std::uint16_t n_eta_bins{32u};
+    /// Number of bins in phi
+    std::uint16_t n_phi_bins{32u};
+    /// Eta range: Tracks outside the range go to the first or last eta bin
+    scalar_t eta_min{-4.f};
+    scalar_t eta_max{4.f};
+};
+
+namespace detail {
+
+/// @returns the sort key of a track: (start volume, eta bin, phi bin)
+template <typename detector_t, typename track_t, concepts::scalar scalar_t>
+DETRAY_HOST inline std::uint64_t track_sort_key(
+    const detector_t &det, const track_t &track,
+    const track_sorting_config<scalar_t> &cfg) {
+
+    assert(cfg.n_eta_bins > 0u);
+    assert(cfg.n_phi_bins > 0u);
+    assert(cfg.eta_min < cfg.eta_max);
+
+    // Starting volume from the detector volume finder
+    const auto vol_idx{static_cast<std::uint64_t>(
+        det.volume(track.pos()).index())};
+
+    const auto dir = track.dir();
+
+    // Pseudorapidity and azimuth of the track direction
+    constexpr scalar_t max_cos{1.f - 1e-6f};
+    const scalar_t cos_theta{
+        math::max(-max_cos, math::min(max_cos, dir[2] / vector::norm(dir)))};
+    const scalar_t eta{0.5f * math::log((1.f + cos_theta) / (1.f - cos_theta))};
+    const scalar_t phi{vector::phi(dir)};
+
+    auto to_bin = [](const scalar_t v, const scalar_t min, const scalar_t max,
+                     const std::uint16_t n_bins) {
+        const scalar_t rel{(v - min) / (max - min)};
+        const auto bin{static_cast<std::int64_t>(
+            math::floor(rel * static_cast<scalar_t>(n_bins)))};
+        return static_cast<std::uint64_t>(
+            std::clamp(bin, std::int64_t{0},
+                       static_cast<std::int64_t>(n_bins) - 1));
+    };
+
+    const std::uint64_t eta_bin{
+        to_bin(eta, cfg.eta_min, cfg.eta_max, cfg.n_eta_bins)};
+    const std::uint64_t phi_bin{to_bin(phi, -constant<scalar_t>::pi,
+                                       constant<scalar_t>::pi, cfg.n_phi_bins)};
+
+    return (vol_idx << 32u) | (eta_bin << 16u) | phi_bin;
+}
+
+}  // namespace detail
+
+/// @brief Sort tracks by their starting volume and (eta, phi) bin.
+///
+/// Launching the device propagation on sorted tracks lets neighbouring
+/// threads traverse the same volumes and acceleration structure bins, which
+/// improves the coalescing of the detector data loads. The sort is stable, so
+/// tracks in the same bin keep their relative order.
+///
+/// @param det the detector: Its volume finder is used to determine the
+///            starting volume of every track
+/// @param tracks the track collection, which is sorted in place
+/// @param cfg eta and phi binning
+///
+/// @returns the permutation that was applied: Entry @c i holds the original
+/// index of the track that is now at position @c i
+template <typename detector_t, typename track_container_t,
+          concepts::scalar scalar_t = dscalar<typename detector_t::algebra_type>>
+DETRAY_HOST inline std::vector<dindex> sort_tracks(
+    const detector_t &det, track_container_t &tracks,
+    const track_sorting_config<scalar_t> &cfg = {}) {
+
+    const std::size_t n_tracks{tracks.size()};
+
+    std::vector<std::uint64_t> keys(n_tracks);
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        keys[i] = detail::track_sort_key(det, tracks[i], cfg);
+    }
+
+    std::vector<dindex> permutation(n_tracks);
+    std::iota(permutation.begin(), permutation.end(), dindex{0u});
+    std::ranges::stable_sort(permutation, [&keys](dindex a, dindex b) {
+        return keys[a] < keys[b];
+    });
+
+    // Apply the permutation
+    std::vector<typename track_container_t::value_type> sorted{};
+    sorted.reserve(n_tracks);
+    for (const dindex i : permutation) {
+        sorted.push_back(tracks[i]);
+    }
+    std::ranges::copy(sorted, tracks.begin());
+
+    return permutation;
+}
+
+/// @brief Restore the original order of per-track results.
+///
+/// @param results results (e.g. final track states) in sorted track order
+/// @param permutation the permutation that was returned by @c sort_tracks
+template <typename result_container_t>
+DETRAY_HOST inline void restore_track_order(
+    result_container_t &results, const std::vector<dindex> &permutation) {
+
+    assert(results.size() == permutation.size());
+
+    std::vector<typename result_container_t::value_type> original(
+        results.begin(), results.end());
+    for (std::size_t i = 0u; i < permutation.size(); ++i) {
+        original[permutation[i]] = std::move(results[i]);
+    }
+    std::ranges::move(original, results.begin());
+}
+
+}  // namespace detray
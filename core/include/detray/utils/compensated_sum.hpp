@@ -0,0 +1,38 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+namespace detray::detail {
+
+/// @brief Compensated (Kahan) summation step
+///
+/// Adds @param x to @param sum and keeps the rounding error of the addition
+/// in @param comp, which is subtracted again in the next call. That way,
+/// long sums of small increments (e.g. the steps along a track) do not drift
+/// in single precision. Works for scalars and for vectors of the algebra
+/// plugins alike.
+///
+/// @note Don't compile with value-unsafe optimizations (e.g. -ffast-math),
+/// since they may remove the compensation term.
+///
+/// @returns the new sum
+template <typename value_t>
+DETRAY_HOST_DEVICE constexpr value_t compensated_add(const value_t &sum,
+                                                     value_t &comp,
+                                                     const value_t &x) {
+    const value_t y = x - comp;
+    const value_t t = sum + y;
+    comp = (t - sum) - y;
+
+    return t;
+}
+
+}  // namespace detray::detail
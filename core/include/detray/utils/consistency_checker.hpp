@@ -15,10 +15,15 @@
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <exception>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace detray::detail {
 
@@ -284,83 +289,167 @@ inline void check_empty(const detector_t &det, const bool verbose) {
     }
 }
 
-/// @brief Checks the internal consistency of a detector
+/// @brief Checks a single volume of a detector
+///
+/// @param det the detector
+/// @param idx the index of the volume in the detector volume container
+/// @param names the volume names for the error messages
 template <typename detector_t>
-inline bool check_consistency(const detector_t &det, const bool verbose = false,
-                              const typename detector_t::name_map &names = {}) {
-    check_empty(det, verbose);
+inline void check_volume(const detector_t &det, const dindex idx,
+                         const typename detector_t::name_map &names) {
+
+    const auto &vol_desc = det.volumes()[idx];
+    const auto vol = tracking_volume{det, vol_desc};
 
     std::stringstream err_stream{};
-    // Check the volumes
-    for (const auto &[idx, vol_desc] :
-         detray::views::enumerate(det.volumes())) {
-        const auto vol = tracking_volume{det, vol_desc};
-        err_stream << "VOLUME \"" << print_volume_name(vol, names) << "\":\n";
+    err_stream << "VOLUME \"" << print_volume_name(vol, names) << "\":\n";
 
-        // Check that nothing is obviously broken
-        if (!vol.self_check(err_stream)) {
-            throw std::invalid_argument(err_stream.str());
-        }
+    // Check that nothing is obviously broken
+    if (!vol.self_check(err_stream)) {
+        throw std::invalid_argument(err_stream.str());
+    }
 
-        // Check consistency in the context of the owning detector
-        if (vol.index() != idx) {
-            err_stream << "ERROR: Incorrect volume index! Found volume:\n"
-                       << vol << "\nat index " << idx;
-            throw std::invalid_argument(err_stream.str());
-        }
+    // Check consistency in the context of the owning detector
+    if (vol.index() != idx) {
+        err_stream << "ERROR: Incorrect volume index! Found volume:\n"
+                   << vol << "\nat index " << idx;
+        throw std::invalid_argument(err_stream.str());
+    }
 
-        // Go through the acceleration data structures and check the surfaces
-        vol.template visit_surfaces<detail::surface_checker>(det, vol.index(),
-                                                             names);
+    // Go through the acceleration data structures and check the surfaces
+    vol.template visit_surfaces<detail::surface_checker>(det, vol.index(),
+                                                         names);
 
-        // Check the volume material, if present
-        if (vol.has_material()) {
-            vol.template visit_material<detail::material_checker>(
-                vol_desc.material().id());
-        }
+    // Check the volume material, if present
+    if (vol.has_material()) {
+        vol.template visit_material<detail::material_checker>(
+            vol_desc.material().id());
     }
+}
 
-    // Check the surfaces in the detector's surface lookup
-    for (const auto &[idx, sf_desc] :
-         detray::views::enumerate(det.surfaces())) {
-        const auto sf = geometry::surface{det, sf_desc};
-        const auto vol = tracking_volume{det, sf.volume()};
-        err_stream << "VOLUME \"" << print_volume_name(vol, names) << "\":\n";
+/// @brief Checks a single surface of the detector surface lookup
+///
+/// @param det the detector
+/// @param idx the index of the surface in the detector surface lookup
+/// @param names the volume names for the error messages
+template <typename detector_t>
+inline void check_surface(const detector_t &det, const dindex idx,
+                          const typename detector_t::name_map &names) {
 
-        // Check that nothing is obviously broken
-        if (!sf.self_check(err_stream)) {
-            err_stream << "\nat surface no. " << std::to_string(idx);
-            throw std::invalid_argument(err_stream.str());
-        }
+    const auto &sf_desc = det.surface(idx);
+    const auto sf = geometry::surface{det, sf_desc};
+    const auto vol = tracking_volume{det, sf.volume()};
 
-        // Check consistency in the context of the owning detector
-        if (sf.index() != idx) {
-            err_stream << "ERROR: Incorrect surface index! Found surface:\n"
-                       << sf << "\nat index " << idx;
-            throw std::invalid_argument(err_stream.str());
-        }
+    std::stringstream err_stream{};
+    err_stream << "VOLUME \"" << print_volume_name(vol, names) << "\":\n";
 
-        // Check that the surface can be found in its volume's acceleration
-        // data structures (if there are no grids, must at least be in the
-        // brute force method)
-        bool is_registered = false;
+    // Check that nothing is obviously broken
+    if (!sf.self_check(err_stream)) {
+        err_stream << "\nat surface no. " << std::to_string(idx);
+        throw std::invalid_argument(err_stream.str());
+    }
 
-        vol.template visit_surfaces<detail::surface_checker>(
-            sf_desc, is_registered, det);
+    // Check consistency in the context of the owning detector
+    if (sf.index() != idx) {
+        err_stream << "ERROR: Incorrect surface index! Found surface:\n"
+                   << sf << "\nat index " << idx;
+        throw std::invalid_argument(err_stream.str());
+    }
 
-        if (!is_registered) {
-            err_stream << "ERROR: Found surface that is not part of its "
-                       << "volume's navigation acceleration data structures:\n"
-                       << "Surface: " << sf;
-            throw std::invalid_argument(err_stream.str());
+    // Check that the surface can be found in its volume's acceleration
+    // data structures (if there are no grids, must at least be in the
+    // brute force method)
+    bool is_registered = false;
+
+    vol.template visit_surfaces<detail::surface_checker>(sf_desc,
+                                                         is_registered, det);
+
+    if (!is_registered) {
+        err_stream << "ERROR: Found surface that is not part of its "
+                   << "volume's navigation acceleration data structures:\n"
+                   << "Surface: " << sf;
+        throw std::invalid_argument(err_stream.str());
+    }
+
+    // Check the surface material, if present
+    if (sf.has_material()) {
+        sf.template visit_material<detail::material_checker>(
+            sf_desc.material().id());
+    }
+}
+
+/// @brief Run the check @param check on the items [0, @param n_items ) with
+/// up to @param n_threads threads (zero: hardware concurrency)
+///
+/// Every thread checks a contiguous range of items. If checks fail, the
+/// exception of the failing item with the lowest index is rethrown after all
+/// threads finished.
+template <typename check_t>
+inline void check_in_parallel(const std::size_t n_items, std::size_t n_threads,
+                              const check_t &check) {
+
+    // Minimal number of items that justifies an additional thread
+    constexpr std::size_t min_chunk_size{256u};
+
+    if (n_threads == 0u) {
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    n_threads =
+        std::clamp(n_items / min_chunk_size, std::size_t{1u}, n_threads);
+
+    std::vector<std::exception_ptr> errors(n_threads);
+    auto check_range = [&](const std::size_t w) {
+        const std::size_t end{(w + 1u) * n_items / n_threads};
+        try {
+            for (std::size_t i = w * n_items / n_threads; i < end; ++i) {
+                check(static_cast<dindex>(i));
+            }
+        } catch (...) {
+            errors[w] = std::current_exception();
         }
+    };
 
-        // Check the surface material, if present
-        if (sf.has_material()) {
-            sf.template visit_material<detail::material_checker>(
-                sf_desc.material().id());
+    // The calling thread checks as well
+    std::vector<std::thread> workers{};
+    for (std::size_t w = 1u; w < n_threads; ++w) {
+        workers.emplace_back(check_range, w);
+    }
+    check_range(0u);
+    for (std::thread &w : workers) {
+        w.join();
+    }
+
+    for (const std::exception_ptr &err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
         }
     }
+}
+
+/// @brief Checks the internal consistency of a detector
+///
+/// @param det the detector to be checked
+/// @param verbose report empty data collections
+/// @param names the volume names for the error messages
+/// @param n_threads number of threads that check the volumes and surfaces
+///                  (zero: hardware concurrency)
+///
+/// @note throws an exception if an inconsistency is found
+template <typename detector_t>
+inline bool check_consistency(const detector_t &det, const bool verbose = false,
+                              const typename detector_t::name_map &names = {},
+                              const std::size_t n_threads = 1u) {
+    check_empty(det, verbose);
+
+    // Check the volumes
+    check_in_parallel(det.volumes().size(), n_threads, [&](const dindex i) {
+        check_volume(det, i, names);
+    });
+
+    // Check the surfaces in the detector's surface lookup
+    check_in_parallel(det.surfaces().size(), n_threads, [&](const dindex i) {
+        check_surface(det, i, names);
+    });
 
     return true;
 }
@@ -0,0 +1,249 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/indexing.hpp"
+
+// System include(s)
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace detray::detail {
+
+/// @brief Computes a 64 bit FNV-1a hash over the content of detector data.
+///
+/// The data is added value by value instead of byte by byte, so that padding
+/// bytes and the memory layout of the containers do not enter the hash. Every
+/// value is widened to 64 bits and added in little endian byte order, which
+/// makes the result independent of the platform.
+class detector_hasher {
+
+    public:
+    /// FNV-1a offset basis
+    static constexpr std::uint64_t offset_basis{14695981039346656037ull};
+    /// FNV-1a prime
+    static constexpr std::uint64_t prime{1099511628211ull};
+
+    /// @returns the current hash value
+    DETRAY_HOST
+    constexpr std::uint64_t value() const { return m_hash; }
+
+    /// Add the characters of the string @param str to the hash
+    DETRAY_HOST
+    constexpr void add_bytes(const std::string_view str) {
+        for (const char c : str) {
+            add_byte(static_cast<unsigned char>(c));
+        }
+    }
+
+    /// Add a single 64 bit word @param w to the hash
+    DETRAY_HOST
+    constexpr void add_word(std::uint64_t w) {
+        for (std::size_t i = 0u; i < sizeof(std::uint64_t); ++i) {
+            add_byte(static_cast<unsigned char>(w & 0xffu));
+            w >>= 8u;
+        }
+    }
+
+    /// Add the detector data @param t to the hash
+    template <typename T>
+    DETRAY_HOST constexpr void add(const T& t) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // Fold -0 into 0
+            const double v{t == T{0} ? 0. : static_cast<double>(t)};
+            add_word(std::bit_cast<std::uint64_t>(v));
+        } else if constexpr (std::is_integral_v<T>) {
+            add_word(static_cast<std::uint64_t>(t));
+        } else if constexpr (std::is_enum_v<T>) {
+            add(static_cast<std::underlying_type_t<T>>(t));
+        } else if constexpr (requires { t.barcode().value(); }) {
+            // Surface descriptors
+            add(t.barcode().value());
+            add(t.mask());
+            add(t.material());
+        } else if constexpr (requires {
+                                 t.get_material();
+                                 t.thickness();
+                             }) {
+            // Material slabs and rods
+            add(t.get_material());
+            add(t.thickness());
+        } else if constexpr (requires { t.X0(); }) {
+            add(t.X0());
+            add(t.L0());
+            add(t.Ar());
+            add(t.Z());
+            add(t.mass_density());
+        } else if constexpr (requires {
+                                 t.values();
+                                 t.volume_link();
+                             }) {
+            // Masks
+            add(t.values());
+            add(t.volume_link());
+        } else if constexpr (requires { t.bounds().values(); }) {
+            // Bounding volumes
+            add(t.bounds());
+        } else if constexpr (requires {
+                                 t.box;
+                                 t.first;
+                                 t.n_surfaces;
+                             }) {
+            // Bounding volume hierarchy nodes
+            add(t.box);
+            add(t.first);
+            add(t.n_surfaces);
+        } else if constexpr (requires {
+                                 t.translation();
+                                 t.x();
+                             }) {
+            // Transforms
+            add(t.translation());
+            add(t.x());
+            add(t.y());
+            add(t.z());
+        } else if constexpr (requires {
+                                 t.accel_link();
+                                 t.sf_link();
+                             }) {
+            // Volume descriptors
+            add(t.id());
+            add(t.index());
+            add(t.transform());
+            add(t.material());
+            add(t.sf_link());
+            add(t.accel_link());
+        } else if constexpr (requires {
+                                 t.id();
+                                 t.index();
+                             }) {
+            // Typed indices
+            add(t.id());
+            add(t.index());
+        } else if constexpr (requires {
+                                 t.axes();
+                                 t.nbins();
+                                 t.bin(dindex{});
+                             }) {
+            add_grid(t);
+        } else if constexpr (std::ranges::range<const T>) {
+            std::uint64_t n{0u};
+            for (const auto& v : t) {
+                add(v);
+                ++n;
+            }
+            add(n);
+        } else if constexpr (requires { t.all(); }) {
+            // Acceleration structures that are not plain ranges
+            if constexpr (requires { t.nodes(); }) {
+                add(t.nodes());
+            }
+            add(t.all());
+        } else if constexpr (requires {
+                                 t.size();
+                                 t[0u];
+                             }) {
+            using size_type = decltype(t.size());
+            for (size_type i = 0u; i < t.size(); ++i) {
+                add(t[i]);
+            }
+            add(t.size());
+        } else {
+            static_assert(std::is_void_v<T>,
+                          "Cannot hash this type of detector data");
+        }
+    }
+
+    /// Add all collections of the multi store @param store to the hash
+    template <typename store_t>
+    DETRAY_HOST constexpr void add_store(const store_t& store) {
+        using ids = typename store_t::value_types;
+
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (add(store.template get<ids::to_id(I)>()), ...);
+        }
+        (std::make_index_sequence<store_t::n_collections()>{});
+    }
+
+    private:
+    /// Add a single byte @param b to the hash
+    DETRAY_HOST
+    constexpr void add_byte(const unsigned char b) {
+        m_hash ^= b;
+        m_hash *= prime;
+    }
+
+    /// Add the axes and the bin content of the grid @param gr to the hash
+    template <typename grid_t>
+    DETRAY_HOST constexpr void add_grid(const grid_t& gr) {
+        // Empty grid without axes
+        if (gr.axes().empty()) {
+            add(0u);
+            return;
+        }
+
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (add_axis(gr.template get_axis<I>()), ...);
+        }
+        (std::make_index_sequence<grid_t::dim>{});
+
+        for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+            add(gr.bin(gbin));
+        }
+    }
+
+    /// Add the axis @param ax to the hash
+    template <typename axis_t>
+    DETRAY_HOST constexpr void add_axis(const axis_t& ax) {
+        add(ax.label());
+        add(ax.bounds());
+        add(ax.binning());
+        add(ax.nbins());
+        add(ax.bin_edges());
+    }
+
+    std::uint64_t m_hash{offset_basis};
+};
+
+/// @returns a hash over the content of the detector @param det, which is
+/// stable across processes and platforms.
+///
+/// The hash covers the volumes, surfaces, transforms, masks, material and
+/// acceleration structures, so it can serve as a key for data that is derived
+/// from a detector. Detectors that are built with the same configuration get
+/// the same hash.
+///
+/// @note The hash includes the links between the detector objects, so it
+/// changes if the same geometry is stored in a different order (e.g. when
+/// the masks of a detector that was read from file are not shared between
+/// surfaces).
+template <typename detector_t>
+DETRAY_HOST std::uint64_t hash_detector(const detector_t& det) {
+
+    detector_hasher hasher{};
+
+    hasher.add(det.volumes());
+    hasher.add(det.surfaces());
+    hasher.add(det.transform_store().get({}));
+    hasher.add_store(det.mask_store());
+    hasher.add_store(det.material_store());
+    hasher.add_store(det.accelerator_store());
+    hasher.add(det.volume_search_grid());
+
+    return hasher.value();
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,67 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray::detail {
+
+/// @brief Approximate @c atan2 in single precision
+///
+/// Evaluates a polynomial approximation of the arctangent on [0, 1] and maps
+/// it to the full circle. The maximal absolute error is about 2e-6 rad, for
+/// any precision of the inputs (the calculation is always done in float).
+///
+/// @note Meant for stages that can tolerate a slightly coarser local position
+/// (e.g. the phi coordinate on cylinders and discs), not for fitting.
+///
+/// @returns the angle of (@param x, @param y) in [-pi, pi]
+template <typename scalar_t>
+requires std::is_arithmetic_v<scalar_t> DETRAY_HOST_DEVICE inline scalar_t
+fast_atan2(const scalar_t y, const scalar_t x) {
+
+    const float fx{static_cast<float>(x)};
+    const float fy{static_cast<float>(y)};
+    const float ax{math::fabs(fx)};
+    const float ay{math::fabs(fy)};
+
+    // Reduce to the first octant
+    const float mx{math::max(ax, ay)};
+    const float a{mx > 0.f ? math::min(ax, ay) / mx : 0.f};
+    const float a2{a * a};
+
+    // Polynomial approximation of atan(a) for a in [0, 1]
+    float r{
+        a * (0.99997726f +
+             a2 * (-0.33262347f +
+                   a2 * (0.19354346f +
+                         a2 * (-0.11643287f +
+                               a2 * (0.05265332f + a2 * -0.01172120f)))))};
+
+    // Map back to the full circle
+    r = (ay > ax) ? constant<float>::pi_2 - r : r;
+    r = (fx < 0.f) ? constant<float>::pi - r : r;
+
+    return static_cast<scalar_t>(math::copysign(r, fy));
+}
+
+/// @returns the approximate phi angle of the vector @param v
+/// (see @c fast_atan2 )
+template <concepts::vector3D vector3_t>
+DETRAY_HOST_DEVICE inline auto fast_phi(const vector3_t &v) {
+    return fast_atan2(v[1], v[0]);
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,151 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <bit>
+#include <cstdint>
+
+namespace detray {
+
+/// @brief IEEE 754 half precision storage type.
+///
+/// Only used to compress large data (e.g. magnetic field maps) in memory: The
+/// value is converted to single precision on read and all arithmetic happens
+/// in single precision. The conversion from single precision rounds to the
+/// nearest representable value (ties to even). Values beyond the half
+/// precision range (+-65504) become infinite.
+class float16 {
+
+    public:
+    /// Default constructor: zero
+    constexpr float16() = default;
+
+    /// Construct from a single precision value @param f
+    DETRAY_HOST_DEVICE
+    constexpr float16(const float f) : m_bits{from_float(f)} {}
+
+    /// @returns a half precision value from its bit representation @param b
+    DETRAY_HOST_DEVICE
+    static constexpr float16 from_bits(const std::uint16_t b) {
+        float16 h{};
+        h.m_bits = b;
+        return h;
+    }
+
+    /// @returns the bit representation
+    DETRAY_HOST_DEVICE
+    constexpr std::uint16_t bits() const { return m_bits; }
+
+    /// @returns the value in single precision
+    DETRAY_HOST_DEVICE
+    constexpr operator float() const { return to_float(m_bits); }
+
+    /// Arithmetic in single precision, rounded back to half precision
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr float16 &operator+=(const float f) {
+        return *this = float16{static_cast<float>(*this) + f};
+    }
+    DETRAY_HOST_DEVICE
+    constexpr float16 &operator-=(const float f) {
+        return *this = float16{static_cast<float>(*this) - f};
+    }
+    DETRAY_HOST_DEVICE
+    constexpr float16 &operator*=(const float f) {
+        return *this = float16{static_cast<float>(*this) * f};
+    }
+    DETRAY_HOST_DEVICE
+    constexpr float16 &operator/=(const float f) {
+        return *this = float16{static_cast<float>(*this) / f};
+    }
+    /// @}
+
+    private:
+    /// @returns the half precision bit pattern of the float @param f
+    DETRAY_HOST_DEVICE
+    static constexpr std::uint16_t from_float(const float f) {
+        const auto b{std::bit_cast<std::uint32_t>(f)};
+
+        const auto sign{static_cast<std::uint16_t>((b >> 16u) & 0x8000u)};
+        const std::uint32_t abs{b & 0x7fffffffu};
+
+        // NaN (keep it quiet) and infinity
+        if (abs > 0x7f800000u) {
+            return static_cast<std::uint16_t>(sign | 0x7e00u);
+        }
+        if (abs >= 0x47800000u) {
+            return static_cast<std::uint16_t>(sign | 0x7c00u);
+        }
+
+        const auto exp{static_cast<std::int32_t>(abs >> 23u) - 112};
+        std::uint32_t mant{abs & 0x7fffffu};
+
+        // Subnormal half precision values, or zero
+        if (exp <= 0) {
+            if (exp < -10) {
+                return sign;
+            }
+            mant |= 0x800000u;
+            const auto shift{static_cast<std::uint32_t>(14 - exp)};
+            std::uint32_t h{mant >> shift};
+            const std::uint32_t rem{mant & ((1u << shift) - 1u)};
+            const std::uint32_t halfway{1u << (shift - 1u)};
+            if (rem > halfway || (rem == halfway && (h & 1u))) {
+                ++h;
+            }
+            return static_cast<std::uint16_t>(sign | h);
+        }
+
+        // Normal values: A carry of the rounding into the exponent is correct
+        std::uint32_t h{(static_cast<std::uint32_t>(exp) << 10u) |
+                        (mant >> 13u)};
+        const std::uint32_t rem{mant & 0x1fffu};
+        if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) {
+            ++h;
+        }
+        return static_cast<std::uint16_t>(sign | h);
+    }
+
+    /// @returns the float value of the half precision bit pattern @param h
+    DETRAY_HOST_DEVICE
+    static constexpr float to_float(const std::uint16_t h) {
+        const std::uint32_t sign{static_cast<std::uint32_t>(h & 0x8000u)
+                                 << 16u};
+        const std::uint32_t exp{(h >> 10u) & 0x1fu};
+        std::uint32_t mant{h & 0x3ffu};
+
+        // Zero and subnormal values
+        if (exp == 0u) {
+            if (mant == 0u) {
+                return std::bit_cast<float>(sign);
+            }
+            std::uint32_t shift{0u};
+            while (!(mant & 0x400u)) {
+                mant <<= 1u;
+                ++shift;
+            }
+            return std::bit_cast<float>(sign | ((113u - shift) << 23u) |
+                                        ((mant & 0x3ffu) << 13u));
+        }
+        // Infinity and NaN
+        if (exp == 0x1fu) {
+            return std::bit_cast<float>(sign | 0x7f800000u | (mant << 13u));
+        }
+
+        return std::bit_cast<float>(sign | ((exp + 112u) << 23u) |
+                                    (mant << 13u));
+    }
+
+    std::uint16_t m_bits{0u};
+};
+
+}  // namespace detray
@@ -138,6 +138,38 @@ struct single_axis {
         return static_cast<dindex>(b);
     }
 
+    /// Given a batch of values on the axis, find the correct bins.
+    ///
+    /// @note This includes bin index wrapping for circular axis.
+    ///
+    /// @param values the values for the bin search
+    /// @param bins output: the bin indices
+    /// @param n the number of values in the batch
+    DETRAY_HOST_DEVICE
+    void bin(const scalar_type *values, dindex *bins,
+             const std::size_t n) const {
+        // Process the batch in chunks that fit on the stack
+        constexpr std::size_t chunk_size{64u};
+        int ibins[chunk_size];
+
+        for (std::size_t offset = 0u; offset < n; offset += chunk_size) {
+            const std::size_t n_chunk{
+                n - offset < chunk_size ? n - offset : chunk_size};
+
+            m_binning.bin(values + offset, ibins, n_chunk);
+
+            for (std::size_t i = 0u; i < n_chunk; ++i) {
+                int b{m_bounds.map(ibins[i], m_binning.nbins())};
+
+                if constexpr (bounds_type::type == axis::bounds::e_circular) {
+                    b = m_bounds.wrap(b, m_binning.nbins());
+                }
+
+                bins[offset + i] = static_cast<dindex>(b);
+            }
+        }
+    }
+
     /// Given a value on the axis and a neighborhood, find the correct bin range
     ///
     /// @note (!) The circular axis index wrap-around happens in a separate
@@ -221,10 +253,12 @@ class multi_axis {
     /// @}
 
     private:
-    /// Owning and non-owning range of edge offsets
-    using edge_offset_range_t = std::conditional_t<
-        is_owning, vector_type<dindex_range>,
-        detray::ranges::subrange<const vector_type<dindex_range>>>;
+    /// Owning range of edge offsets, or a copy of the edge offsets of the
+    /// axes in the non-owning case (the axes do not have to look them up in
+    /// the global offset container on every access)
+    using edge_offset_range_t =
+        std::conditional_t<is_owning, vector_type<dindex_range>,
+                           darray<dindex_range, dim>>;
     /// Owning and non-owning range of bin edges
     using edge_range_t = std::conditional_t<is_owning, vector_type<scalar_type>,
                                             const vector_type<scalar_type> *>;
@@ -274,8 +308,22 @@ class multi_axis {
         multi_axis(const vector_type<dindex_range> &edge_offsets,
                    const vector_type<scalar_type> &edges,
                    const unsigned int offset = 0)
-        : m_edge_offsets(edge_offsets, dindex_range{offset, offset + dim}),
-          m_edges(&edges) {}
+        : m_edges(&edges) {
+        for (dindex i = 0u; i < dim; ++i) {
+            m_edge_offsets[i] = edge_offsets[offset + i];
+        }
+    }
+
+    /// Construct from the edge offsets of the axes and a bin edge container
+    /// that is not owned by this class
+    ///
+    /// @param edge_offsets offsets into the global edge container per axis
+    /// @param edges the global edge container
+    template <bool owner = is_owning>
+    requires(!owner) DETRAY_HOST_DEVICE
+        multi_axis(const darray<dindex_range, dim> &edge_offsets,
+                   const vector_type<scalar_type> &edges)
+        : m_edge_offsets(edge_offsets), m_edges(&edges) {}
 
     /// Construct containers from vecmem based view type
     ///
@@ -291,6 +339,17 @@ class multi_axis {
         return m_edge_offsets;
     }
 
+    /// @returns true if there is no data for the axes (e.g. default
+    /// constructed axes)
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const {
+        if constexpr (is_owning) {
+            return m_edge_offsets.size() < dim;
+        } else {
+            return m_edges == nullptr;
+        }
+    }
+
     /// @returns access to the underlying bin edge storage - const
     DETRAY_HOST_DEVICE
     constexpr auto bin_edges() const -> const vector_type<scalar_type> & {
@@ -392,6 +451,32 @@ class multi_axis {
         return bin_ranges;
     }
 
+    /// @brief Get a bin range on every axis with a separate neighborhood per
+    /// axis (e.g. a search window that only extends in track direction).
+    ///
+    /// @param p the point in the local coordinate system that is spanned
+    ///          by the axes.
+    /// @param nhoods the search window definition for every axis, in the
+    ///               order of the local coordinates.
+    ///
+    /// @returns a multi bin range that contains the resulting bin ranges for
+    ///          every axis in the corresponding entry (e.g. rng_x in entry 0)
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE multi_bin_range<dim> bin_ranges(
+        const point_type &p,
+        const darray<darray<neighbor_t, 2>, dim> &nhoods) const {
+        // Empty bin ranges to be filled
+        multi_bin_range<dim> bin_ranges{};
+        // Run the range resolution for every axis in this multi-axis type
+        (get_axis_bin_ranges(
+             get_axis<axis_ts>(), p,
+             nhoods[axis_reg::to_index(axis_ts::bounds_type::label)],
+             bin_ranges),
+         ...);
+
+        return bin_ranges;
+    }
+
     /// @returns a vecmem view on the axes data. Only allowed if it owns data.
     template <bool owner = is_owning>
     requires owner DETRAY_HOST auto get_data() -> view_type {
@@ -80,6 +80,24 @@ struct regular {
         return static_cast<int>((v - span()[0]) / bin_width() + 1.f) - 1;
     }
 
+    /// Access function to the bins of a batch of values
+    ///
+    /// The span and bin width are loaded once for the whole batch, so that
+    /// the loop can be vectorized.
+    ///
+    /// @param values the values for the bin search
+    /// @param bins output: the corresponding bin indices
+    /// @param n the number of values in the batch
+    DETRAY_HOST_DEVICE
+    void bin(const scalar_type *values, int *bins, const std::size_t n) const {
+        const scalar_type min{span()[0]};
+        const scalar_type width{bin_width()};
+
+        for (std::size_t i = 0u; i < n; ++i) {
+            bins[i] = static_cast<int>((values[i] - min) / width + 1.f) - 1;
+        }
+    }
+
     /// Access function to a range with binned neighborhood
     ///
     /// @note This is an inclusive range
@@ -229,13 +247,21 @@ struct irregular {
     /// @returns the corresponding bin index
     DETRAY_HOST_DEVICE
     int bin(const scalar_type v) const {
-        auto bins_begin =
-            m_bin_edges->begin() + static_cast<index_type>(m_offset);
-        auto bins_end = bins_begin + static_cast<index_type>(m_n_bins);
+        return lower_edge_index(m_bin_edges->data() + m_offset, v);
+    }
 
-        return static_cast<int>(detray::lower_bound(bins_begin, bins_end, v) -
-                                bins_begin) -
-               1;
+    /// Access function to the bins of a batch of values
+    ///
+    /// @param values the values for the bin search
+    /// @param bins output: the corresponding bin indices
+    /// @param n the number of values in the batch
+    DETRAY_HOST_DEVICE
+    void bin(const scalar_type *values, int *bins, const std::size_t n) const {
+        const scalar_type *edges{m_bin_edges->data() + m_offset};
+
+        for (std::size_t i = 0u; i < n; ++i) {
+            bins[i] = lower_edge_index(edges, values[i]);
+        }
     }
 
     /// Access function to a range with binned neighborhood
@@ -340,6 +366,30 @@ struct irregular {
         }
         return true;
     }
+
+    private:
+    /// Branchless binary search for the bin of @param v with the bin edges
+    /// @param edges: Equivalent to the position of the lower bound of the
+    /// value in the edges, minus one.
+    ///
+    /// The number of iterations only depends on the number of bins, which
+    /// avoids branch mispredictions and thread divergence on device.
+    DETRAY_HOST_DEVICE
+    int lower_edge_index(const scalar_type *edges, const scalar_type v) const {
+        if (m_n_bins == 0u) {
+            return -1;
+        }
+
+        dindex base{0u};
+        dindex len{m_n_bins};
+        while (len > 1u) {
+            const dindex half{len / 2u};
+            base = (edges[base + half] < v) ? base + half : base;
+            len -= half;
+        }
+
+        return static_cast<int>(base + (edges[base] < v ? 1u : 0u)) - 1;
+    }
 };
 
 }  // namespace detray::axis
@@ -12,9 +12,15 @@
 #include "detray/core/detail/container_views.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
 #include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s)
+#include <cassert>
+#include <vector>
+
 namespace detray::detail {
 
 /// @brief bin data state of a grid
@@ -137,20 +143,20 @@ struct dynamic_bin_container {
     using vector_t = typename containers::template vector_type<T>;
     using bin_data_t = typename bin_t::data;
 
+    using storage_t = typename bin_t::storage_type;
+
     vector_t<bin_data_t> bins{};
-    vector_t<typename bin_t::entry_type> entries{};
+    vector_t<storage_t> entries{};
 
     // Vecmem based view type
-    using view_type = dmulti_view<dvector_view<bin_data_t>,
-                                  dvector_view<typename bin_t::entry_type>>;
-    using const_view_type =
-        dmulti_view<dvector_view<const bin_data_t>,
-                    dvector_view<const typename bin_t::entry_type>>;
+    using view_type =
+        dmulti_view<dvector_view<bin_data_t>, dvector_view<storage_t>>;
+    using const_view_type = dmulti_view<dvector_view<const bin_data_t>,
+                                        dvector_view<const storage_t>>;
 
     // Vecmem based buffer type
     using buffer_type =
-        dmulti_buffer<dvector_buffer<bin_data_t>,
-                      dvector_buffer<typename bin_t::entry_type>>;
+        dmulti_buffer<dvector_buffer<bin_data_t>, dvector_buffer<storage_t>>;
 
     constexpr dynamic_bin_container() = default;
     DETRAY_HOST
@@ -218,14 +224,15 @@ struct dynamic_bin_container {
 ///
 /// Can be data-owning or not. Does not contain the data of the axes,
 /// as that is managed by the multi-axis type directly.
-template <bool is_owning, typename entry_t, typename containers>
-class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
-    : public detray::ranges::view_interface<bin_storage<
-          is_owning, detray::bins::dynamic_array<entry_t>, containers>> {
+template <bool is_owning, concepts::dynamic_bin bin_t, typename containers>
+class bin_storage<is_owning, bin_t, containers>
+    : public detray::ranges::view_interface<
+          bin_storage<is_owning, bin_t, containers>> {
 
     template <typename T>
     using vector_t = typename containers::template vector_type<T>;
-    using bin_t = detray::bins::dynamic_array<entry_t>;
+    /// Type of the elements in the global entry storage
+    using entry_t = typename bin_t::storage_type;
     using bin_data_t = typename bin_t::data;
     using bin_range_t =
         std::conditional_t<is_owning, vector_t<bin_data_t>,
@@ -305,7 +312,7 @@ class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
         /// @{
         DETRAY_HOST_DEVICE
         constexpr auto operator*() const {
-            return detray::bins::dynamic_array{m_entry_data, *m_itr};
+            return bin_t{m_entry_data, *m_itr};
         }
         /// @}
 
@@ -365,7 +372,7 @@ class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
     };
 
     public:
-    /// Bin type: dynamic_array
+    /// Bin type: dynamic_array or compressed_array
     using bin_type = bin_t;
     /// Backend storage type for the grid
     using bin_container_type = dynamic_bin_container<bin_t, containers>;
@@ -424,6 +431,31 @@ class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
     const bin_range_t& bin_data() const { return m_bin_data; }
     const entry_range_t& entry_data() const { return m_entry_data; }
 
+    /// Set the capacities of all bins and size the entry storage exactly
+    ///
+    /// @note This resets the content of all bins.
+    ///
+    /// @param capacities the capacity of every bin, in global bin order
+    template <bool owner = is_owning>
+    requires owner DETRAY_HOST void set_capacities(
+        const std::vector<dindex>& capacities) {
+        assert(capacities.size() == m_bin_data.size());
+
+        dindex total_cap{0u};
+        for (std::size_t i = 0u; i < capacities.size(); ++i) {
+            bin_data_t& data = m_bin_data[i];
+
+            data = bin_data_t{};
+            data.offset = total_cap;
+            data.capacity = capacities[i];
+
+            total_cap += capacities[i];
+        }
+
+        m_entry_data.clear();
+        m_entry_data.resize(total_cap, detail::invalid_value<entry_t>());
+    }
+
     /// begin and end of the bin range
     /// @{
     DETRAY_HOST_DEVICE
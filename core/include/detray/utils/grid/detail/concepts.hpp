@@ -67,6 +67,27 @@ concept axis = requires(const A ax) {
     ->std::same_as<typename A::scalar_type>;
 };
 
+/// Bin with a dynamic capacity that views its content in a global storage
+template <typename B>
+concept dynamic_bin = requires(B b) {
+
+    typename B::data;
+    typename B::entry_type;
+    typename B::storage_type;
+
+    { b.capacity() }
+    ->std::same_as<dindex>;
+};
+
+/// Bin whose entries can be merged with those of another bin (set union)
+template <typename B>
+concept mergeable_bin = requires(B b, const B cb) {
+
+    typename B::entry_type;
+
+    b.merge(cb);
+};
+
 template <typename G>
 concept grid = viewable<G>&& bufferable<G>&& requires(const G g) {
 
@@ -16,6 +16,11 @@
 
 // System include(s)
 #include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 
 namespace detray::bins {
 
@@ -215,6 +220,8 @@ class dynamic_array
     };
 
     using entry_type = entry_t;
+    /// Type of the elements in the global bin storage
+    using storage_type = entry_t;
     using entry_ptr_t = const entry_type*;
     using data_ptr_t = const data*;
 
@@ -381,6 +388,565 @@ dynamic_array(entry_t* bin_storage, data_t& bin_data) -> dynamic_array<entry_t>;
 template <typename entry_t, typename data_t>
 dynamic_array(const entry_t* bin_storage, const data_t& bin_data)
     -> dynamic_array<entry_t>;
+
+/// @brief Bin that views a delta encoded collection of indices it does not
+/// own.
+///
+/// The entries of the bin are kept in ascending order without duplicates.
+/// The smallest entry is stored as the base index of the bin and every entry
+/// is encoded as a 16-bit difference to its predecessor in the global bin
+/// storage. The entries are decoded on the fly during the iteration, which
+/// is why the bin is only forward iterable and returns the entries by value.
+///
+/// @note A new entry has to lie within 2^16 - 1 of its neighbours in the bin,
+/// which is the case e.g. for the surfaces of a single volume.
+template <typename index_t = dindex>
+class compressed_array
+    : public detray::ranges::view_interface<compressed_array<index_t>> {
+
+    public:
+    struct data {
+        dindex offset{0u};
+        dindex size{0u};
+        dindex capacity{0u};
+        /// Smallest entry in the bin
+        index_t base{0u};
+
+        constexpr bool operator==(const data& rhs) const = default;
+
+        DETRAY_HOST_DEVICE
+        constexpr void update_offset(std::size_t shift) {
+            offset += static_cast<dindex>(shift);
+        }
+    };
+
+    using entry_type = index_t;
+    /// Type of the elements in the global bin storage
+    using storage_type = std::uint16_t;
+    using storage_ptr_t = const storage_type*;
+    using data_ptr_t = const data*;
+
+    /// Decodes the bin entries during the iteration
+    struct iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = index_t;
+        using pointer = const index_t*;
+        using reference = index_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        /// Default constructor required by LegacyIterator trait
+        constexpr iterator() = default;
+
+        DETRAY_HOST_DEVICE
+        constexpr iterator(storage_ptr_t itr, index_t base)
+            : m_itr{itr}, m_value{base} {}
+
+        /// @returns the decoded entry
+        DETRAY_HOST_DEVICE
+        constexpr index_t operator*() const {
+            return static_cast<index_t>(m_value + *m_itr);
+        }
+
+        DETRAY_HOST_DEVICE constexpr iterator& operator++() {
+            m_value = static_cast<index_t>(m_value + *m_itr);
+            ++m_itr;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE constexpr iterator operator++(int) {
+            auto tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        DETRAY_HOST_DEVICE friend constexpr bool operator==(
+            const iterator& lhs, const iterator& rhs) {
+            return lhs.m_itr == rhs.m_itr;
+        }
+
+        private:
+        /// Current position in the encoded storage
+        storage_ptr_t m_itr{nullptr};
+        /// Value of the previous entry (base index for the first entry)
+        index_t m_value{0u};
+    };
+
+    /// Default constructor initializer the bin with an invalid value
+    DETRAY_HOST_DEVICE constexpr compressed_array() { init(); };
+
+    /// Construct from an externally owned container of bin content
+    /// @param bin_storage and access to an offset, size, capacity and base in
+    /// @param bin_data
+    DETRAY_HOST_DEVICE
+    compressed_array(storage_type* bin_storage, data& bin_data)
+        : m_data{&bin_data}, m_capacity{bin_data.capacity} {
+        // Prevent null-dereference warning
+        if (bin_storage) {
+            m_global_storage = bin_storage + bin_data.offset;
+        }
+    }
+
+    /// Construct from an externally owned container of bin content
+    /// @param bin_storage and access to an offset, size, capacity and base in
+    /// @param bin_data - const
+    DETRAY_HOST_DEVICE
+    compressed_array(const storage_type* bin_storage, const data& bin_data)
+        : m_data{&bin_data}, m_capacity{bin_data.capacity} {
+        // Prevent null-dereference warning
+        if (bin_storage) {
+            m_global_storage = bin_storage + bin_data.offset;
+        }
+    }
+
+    /// @returns view iterator over bin content in start or end position
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr iterator begin() const {
+        return {m_global_storage, m_data ? m_data->base : index_t{0u}};
+    }
+    DETRAY_HOST_DEVICE
+    constexpr iterator end() const {
+        return {m_global_storage + size(), index_t{0u}};
+    }
+    /// @}
+
+    /// @returns the number of entries in this bin - const
+    DETRAY_HOST_DEVICE
+    constexpr dindex size() const { return m_data ? m_data->size : 0u; }
+
+    /// The storage capacity of this bin
+    DETRAY_HOST_DEVICE
+    constexpr dindex capacity() const noexcept { return m_capacity; }
+
+    /// @returns the entry at position @param i (needs to decode the bin)
+    DETRAY_HOST_DEVICE
+    constexpr index_t operator[](const dindex i) const {
+        assert(i < size());
+        index_t value{m_data->base};
+        for (dindex j = 0u; j <= i; ++j) {
+            value = static_cast<index_t>(value + m_global_storage[j]);
+        }
+        return value;
+    }
+
+    /// Add a new entry to the bin, if it is not contained yet
+    /// @note This does not check the state of the containter it points to!!!
+    DETRAY_HOST_DEVICE constexpr void push_back(const index_t entry) {
+        assert(m_capacity > 0);
+        assert(m_global_storage);
+
+        if (m_data->size >= m_capacity) {
+            assert(false);
+            return;
+        }
+
+        auto* storage = const_cast<storage_type*>(m_global_storage);
+        auto* bin_data = const_cast<data*>(m_data);
+
+        if (bin_data->size == 0u) {
+            bin_data->base = entry;
+            storage[0] = 0u;
+            bin_data->size = 1u;
+            return;
+        }
+
+        // Find the position of the new entry
+        index_t prev{bin_data->base};
+        index_t value{bin_data->base};
+        dindex pos{0u};
+        for (; pos < bin_data->size; ++pos) {
+            value = static_cast<index_t>(value + storage[pos]);
+            if (value >= entry) {
+                break;
+            }
+            prev = value;
+        }
+
+        // Deduplicate
+        if (pos < bin_data->size && value == entry) {
+            return;
+        }
+
+        // Shift the tail and re-encode the neighbouring entries
+        for (dindex i = bin_data->size; i > pos; --i) {
+            storage[i] = storage[i - 1u];
+        }
+        if (pos == 0u) {
+            storage[0] = 0u;
+            storage[1] = encode(bin_data->base - entry);
+            bin_data->base = entry;
+        } else {
+            storage[pos] = encode(entry - prev);
+            if (pos < bin_data->size) {
+                storage[pos + 1u] = encode(value - entry);
+            }
+        }
+        ++(bin_data->size);
+    }
+
+    /// @note The bin capacity has to be set correctly before calling this
+    /// method
+    /// @returns Access to an initialized bin in the backend storage
+    DETRAY_HOST_DEVICE
+    constexpr auto init(entry_type entry = detail::invalid_value<entry_type>())
+        -> compressed_array& {
+        if (capacity() == 0u) {
+            return *this;
+        }
+
+        const_cast<data*>(m_data)->size = 0u;
+        if (entry != detail::invalid_value<entry_type>()) {
+            push_back(entry);
+        }
+
+        return *this;
+    }
+
+    /// Initilialize from an entire bin content @param content.
+    ///
+    /// @returns Access to the initialized bin
+    template <typename storage_t>
+    DETRAY_HOST_DEVICE constexpr auto init(const storage_t& content)
+        -> compressed_array& {
+
+        const_cast<data*>(m_data)->size = 0u;
+        for (const auto& entry : content) {
+            if (entry != detail::invalid_value<entry_type>()) {
+                push_back(entry);
+            }
+        }
+        return *this;
+    }
+
+    /// Equality operator
+    ///
+    /// @param rhs the bin to be compared with
+    ///
+    /// @returns true if the decoded content is identical
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const compressed_array& rhs) const {
+        // Check if the bin points to the same data
+        if (m_data == rhs.m_data) {
+            return true;
+        }
+        if (size() != rhs.size() ||
+            (size() > 0u && m_data->base != rhs.m_data->base)) {
+            return false;
+        }
+        for (dindex i{0u}; i < size(); ++i) {
+            if (m_global_storage[i] != rhs.m_global_storage[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private:
+    /// @returns the difference of two neighbouring entries @param delta
+    /// that can be stored in the bin
+    DETRAY_HOST_DEVICE
+    static constexpr storage_type encode(const index_t delta) {
+        assert(delta <= std::numeric_limits<storage_type>::max());
+        return static_cast<storage_type>(delta);
+    }
+
+    /// Pointer to the global bin storage that is not owned by this class
+    /// Includes the offset when part of a larger collection
+    storage_ptr_t m_global_storage{nullptr};
+    /// Access to bin data in the global storage
+    data_ptr_t m_data{nullptr};
+    /// Current bin capacity
+    dindex m_capacity{0u};
+};
+
+template <typename storage_t, typename data_t>
+compressed_array(storage_t* bin_storage, data_t& bin_data)
+    -> compressed_array<decltype(data_t::base)>;
+
+template <typename storage_t, typename data_t>
+compressed_array(const storage_t* bin_storage, const data_t& bin_data)
+    -> compressed_array<decltype(data_t::base)>;
 /// @}
 
+/// @brief Bin that holds its entries as a bitmask over a range of indices.
+///
+/// Bit i is set, if the bin contains the entry @c base + i . For the small,
+/// dense index ranges of the surfaces in a single volume, the bin has a
+/// fixed size, its entries are sorted and free of duplicates, and the union
+/// of several bins (e.g. over a search window) is a bitwise OR.
+///
+/// @note All entries of a bin have to lie within 64 * N_WORDS of each other,
+/// which is the case e.g. for volumes with up to 64 * N_WORDS surfaces.
+template <typename index_t = dindex, std::size_t N_WORDS = 1u>
+class bitset
+    : public detray::ranges::view_interface<bitset<index_t, N_WORDS>> {
+
+    public:
+    using entry_type = index_t;
+    using word_type = std::uint64_t;
+
+    /// Number of bits in a word and in the bin
+    static constexpr std::size_t word_bits{64u};
+    static constexpr std::size_t n_bits{word_bits * N_WORDS};
+
+    /// Decodes the set bits during the iteration
+    struct iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = index_t;
+        using pointer = const index_t*;
+        using reference = index_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        /// Default constructor required by LegacyIterator trait
+        constexpr iterator() = default;
+
+        DETRAY_HOST_DEVICE
+        constexpr iterator(const bitset* bin, std::size_t pos)
+            : m_bin{bin}, m_pos{pos} {}
+
+        /// @returns the decoded entry
+        DETRAY_HOST_DEVICE
+        constexpr index_t operator*() const {
+            return static_cast<index_t>(m_bin->m_base + m_pos);
+        }
+
+        DETRAY_HOST_DEVICE constexpr iterator& operator++() {
+            m_pos = m_bin->next_bit(m_pos + 1u);
+            return *this;
+        }
+        DETRAY_HOST_DEVICE constexpr iterator operator++(int) {
+            auto tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        DETRAY_HOST_DEVICE friend constexpr bool operator==(
+            const iterator& lhs, const iterator& rhs) {
+            return lhs.m_pos == rhs.m_pos;
+        }
+
+        private:
+        /// The bin that is iterated
+        const bitset* m_bin{nullptr};
+        /// Position of the current set bit (n_bits for the end)
+        std::size_t m_pos{n_bits};
+    };
+
+    /// Default constructor initializer the bin with an invalid value
+    DETRAY_HOST_DEVICE constexpr bitset() { init(); };
+
+    /// @returns view iterator over bin content in start or end position
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr iterator begin() const { return {this, next_bit(0u)}; }
+    DETRAY_HOST_DEVICE
+    constexpr iterator end() const { return {this, n_bits}; }
+    /// @}
+
+    /// @returns the number of entries in this bin - const
+    DETRAY_HOST_DEVICE
+    constexpr dindex size() const {
+        dindex n{0u};
+        for (const word_type w : m_words) {
+            n += static_cast<dindex>(std::popcount(w));
+        }
+        return n;
+    }
+
+    /// The storage capacity of this bin
+    DETRAY_HOST_DEVICE
+    constexpr dindex capacity() const noexcept {
+        return static_cast<dindex>(n_bits);
+    }
+
+    /// @returns the smallest index the bin can hold
+    DETRAY_HOST_DEVICE
+    constexpr index_t base() const { return m_base; }
+
+    /// @returns the bitmask
+    DETRAY_HOST_DEVICE
+    constexpr const darray<word_type, N_WORDS>& words() const {
+        return m_words;
+    }
+
+    /// @returns true if @param entry can be added without the entries of the
+    /// bin spanning more indices than the bin capacity
+    DETRAY_HOST_DEVICE
+    constexpr bool fits(const index_t entry) const {
+        if (is_empty()) {
+            return true;
+        }
+        const auto last{static_cast<index_t>(m_base + last_bit())};
+        const index_t lowest{entry < m_base ? entry : m_base};
+        const index_t highest{entry > last ? entry : last};
+
+        return static_cast<std::size_t>(highest - lowest) < n_bits;
+    }
+
+    /// Add a new entry to the bin, if it is not contained yet
+    ///
+    /// @note the entries must not span more indices than the bin capacity
+    /// (@see fits ). The bin fillers check this on the host.
+    DETRAY_HOST_DEVICE constexpr void push_back(const index_t entry) {
+        if (is_empty()) {
+            m_base = entry;
+        } else if (entry < m_base) {
+            shift_up(static_cast<std::size_t>(m_base - entry));
+            m_base = entry;
+        }
+
+        const auto pos{static_cast<std::size_t>(entry - m_base)};
+        assert(pos < n_bits);
+        if (pos < n_bits) {
+            m_words[pos / word_bits] |= word_type{1u} << (pos % word_bits);
+        }
+    }
+
+    /// Add all entries of the bin @param other (set union)
+    DETRAY_HOST_DEVICE constexpr void merge(const bitset& other) {
+        if (other.is_empty()) {
+            return;
+        }
+        if (is_empty()) {
+            *this = other;
+            return;
+        }
+
+        if (other.m_base < m_base) {
+            shift_up(static_cast<std::size_t>(m_base - other.m_base));
+            m_base = other.m_base;
+        }
+        const auto shift{static_cast<std::size_t>(other.m_base - m_base)};
+
+        for (std::size_t i = 0u; i < N_WORDS; ++i) {
+            m_words[i] |= shifted_word(other.m_words, i, shift);
+        }
+    }
+
+    /// @returns Access to an initialized bin with a single @param entry
+    DETRAY_HOST_DEVICE
+    constexpr auto init(entry_type entry = detail::invalid_value<entry_type>())
+        -> bitset& {
+        m_base = 0u;
+        for (word_type& w : m_words) {
+            w = 0u;
+        }
+        if (entry != detail::invalid_value<entry_type>()) {
+            push_back(entry);
+        }
+
+        return *this;
+    }
+
+    /// Initilialize from an entire bin content @param content.
+    ///
+    /// @returns Access to the initialized bin
+    template <typename storage_t>
+    DETRAY_HOST_DEVICE constexpr auto init(const storage_t& content)
+        -> bitset& {
+        init();
+        for (const auto& entry : content) {
+            if (entry != detail::invalid_value<entry_type>()) {
+                push_back(entry);
+            }
+        }
+        return *this;
+    }
+
+    /// Equality operator
+    ///
+    /// @param rhs the bin to be compared with
+    ///
+    /// @returns true if the entries are identical
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const bitset& rhs) const {
+        if (m_words != rhs.m_words) {
+            return false;
+        }
+        return is_empty() || m_base == rhs.m_base;
+    }
+
+    private:
+    /// @returns true if no bit is set
+    DETRAY_HOST_DEVICE
+    constexpr bool is_empty() const {
+        for (const word_type w : m_words) {
+            if (w != 0u) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @returns the position of the first set bit at or after @param pos
+    /// (n_bits if there is none)
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t next_bit(const std::size_t pos) const {
+        std::size_t i{pos / word_bits};
+        if (i >= N_WORDS) {
+            return n_bits;
+        }
+
+        // Mask the bits below the start position
+        word_type w{m_words[i] & (~word_type{0u} << (pos % word_bits))};
+        while (w == 0u) {
+            if (++i == N_WORDS) {
+                return n_bits;
+            }
+            w = m_words[i];
+        }
+
+        return i * word_bits + static_cast<std::size_t>(std::countr_zero(w));
+    }
+
+    /// @returns the position of the last set bit (the bin must not be empty)
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t last_bit() const {
+        std::size_t i{N_WORDS};
+        while (i-- > 0u) {
+            if (m_words[i] != 0u) {
+                return i * word_bits + word_bits - 1u -
+                       static_cast<std::size_t>(std::countl_zero(m_words[i]));
+            }
+        }
+        return 0u;
+    }
+
+    /// @returns the word @param i of the bitmask @param words after it was
+    /// shifted towards larger entries by @param shift bits
+    DETRAY_HOST_DEVICE
+    static constexpr word_type shifted_word(
+        const darray<word_type, N_WORDS>& words, const std::size_t i,
+        const std::size_t shift) {
+        const std::size_t n_words{shift / word_bits};
+        const std::size_t n_rest{shift % word_bits};
+
+        if (i < n_words) {
+            return 0u;
+        }
+        word_type w{words[i - n_words] << n_rest};
+        if (n_rest > 0u && i > n_words) {
+            w |= words[i - n_words - 1u] >> (word_bits - n_rest);
+        }
+        return w;
+    }
+
+    /// Move all entries up by @param shift bits, to make room for a smaller
+    /// base index
+    DETRAY_HOST_DEVICE
+    constexpr void shift_up(const std::size_t shift) {
+        // The entries have to stay within the bin capacity
+        assert(shift < n_bits && next_bit(n_bits - shift) == n_bits);
+
+        const darray<word_type, N_WORDS> words{m_words};
+        for (std::size_t i = 0u; i < N_WORDS; ++i) {
+            m_words[i] = shifted_word(words, i, shift);
+        }
+    }
+
+    /// Smallest index the bin can hold (entry of the first bit)
+    index_t m_base{0u};
+    /// Bitmask of the entries
+    darray<word_type, N_WORDS> m_words{};
+};
+
 }  // namespace detray::bins
@@ -0,0 +1,211 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/indexing.hpp"
+
+namespace detray {
+
+namespace detail {
+
+/// Tiled serialization in the plane of the first two axes
+///
+/// The plane of @param n0 x @param n1 bins is split into square tiles of
+/// @tparam kTILE bins per side, which are laid out row-major. The bins of a
+/// tile are contiguous in memory and row-major themselves. The tiles at the
+/// upper edges of the plane are truncated, so that the layout stays dense.
+template <dindex kTILE>
+struct tiled_plane {
+
+    static_assert(kTILE > 0u, "Tile size has to be larger than zero");
+
+    /// @returns the serial index of the bin ( @param b0, @param b1 )
+    DETRAY_HOST_DEVICE
+    static constexpr dindex serialize(const dindex b0, const dindex b1,
+                                      const dindex n0, const dindex n1) {
+        const dindex t0{b0 / kTILE};
+        const dindex t1{b1 / kTILE};
+
+        // Extent of the (possibly truncated) tile
+        const dindex w{extent(t0, n0)};
+        const dindex h{extent(t1, n1)};
+
+        return t1 * kTILE * n0 + t0 * kTILE * h + (b1 - t1 * kTILE) * w +
+               (b0 - t0 * kTILE);
+    }
+
+    /// @returns the bin indices on the two axes from the serial index
+    /// @param gbin
+    DETRAY_HOST_DEVICE
+    static constexpr darray<dindex, 2> deserialize(dindex gbin,
+                                                   const dindex n0,
+                                                   const dindex n1) {
+        // Row of tiles
+        const dindex t1{gbin / (kTILE * n0)};
+        gbin -= t1 * kTILE * n0;
+
+        // Tile in the row
+        const dindex h{extent(t1, n1)};
+        const dindex t0{gbin / (kTILE * h)};
+        gbin -= t0 * kTILE * h;
+
+        // Bin in the tile
+        const dindex w{extent(t0, n0)};
+
+        return {t0 * kTILE + gbin % w, t1 * kTILE + gbin / w};
+    }
+
+    private:
+    /// @returns the number of bins of tile @param t of an axis with @param n
+    /// bins
+    DETRAY_HOST_DEVICE
+    static constexpr dindex extent(const dindex t, const dindex n) {
+        const dindex rest{n - t * kTILE};
+        return rest < kTILE ? rest : kTILE;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Transforms a local axis bin index to a global grid bin index and vice
+/// versa, keeping neighbourhoods of bins close in memory.
+///
+/// The bins are grouped into square tiles in the plane of the first two
+/// axes, so that a neighbourhood search (e.g. a search window of two bins
+/// around the bin of a track) touches less cache lines than with a row-major
+/// layout. The layout is dense: Every global bin index in [0, nbins) belongs
+/// to exactly one bin, so the grid bin storage does not change.
+///
+/// @note the bin indices are expected to start at zero.
+template <std::size_t kDIM>
+struct tiled_serializer {};
+
+/// @brief Tiled serializer specialization for a single axis
+template <>
+struct tiled_serializer<1> {
+
+    /// @returns the axis local bin, which is also the global bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        multi_axis_t & /*axes*/,
+        typename multi_axis_t::loc_bin_index mbin) const -> dindex {
+        return mbin[0];
+    }
+
+    /// @returns the global bin, which is also the axis local bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t & /*axes*/,
+                                       dindex gbin) const ->
+        typename multi_axis_t::loc_bin_index {
+        return {gbin};
+    }
+};
+
+/// @brief Tiled serializer specialization for a 2D multi-axis
+template <>
+struct tiled_serializer<2> {
+
+    /// Number of bins per side of a tile
+    static constexpr dindex tile_size{4u};
+
+    using plane_type = detail::tiled_plane<tile_size>;
+
+    /// @brief Create a serial bin from a multi-bin - 2D
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param mbin contains a bin index for every axis in the multi-axis.
+    ///
+    /// @returns a dindex for the bin data storage
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        multi_axis_t &axes, typename multi_axis_t::loc_bin_index mbin) const
+        -> dindex {
+        return plane_type::serialize(mbin[0], mbin[1],
+                                     axes.template get_axis<0>().nbins(),
+                                     axes.template get_axis<1>().nbins());
+    }
+
+    /// @brief Create a bin tuple from a serialized bin - 2D
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param gbin the global (serial) bin
+    ///
+    /// @return a 2-dimensional multi-bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes, dindex gbin) const ->
+        typename multi_axis_t::loc_bin_index {
+        const auto bins = plane_type::deserialize(
+            gbin, axes.template get_axis<0>().nbins(),
+            axes.template get_axis<1>().nbins());
+
+        return {bins[0], bins[1]};
+    }
+};
+
+/// @brief Tiled serializer specialization for a 3D multi-axis
+///
+/// The planes of the first two axes are tiled and stacked along the third
+/// axis.
+template <>
+struct tiled_serializer<3> {
+
+    /// Number of bins per side of a tile
+    static constexpr dindex tile_size{4u};
+
+    using plane_type = detail::tiled_plane<tile_size>;
+
+    /// @brief Create a serial bin from a multi-bin - 3D
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param mbin contains a bin index for every axis in the multi-axis.
+    ///
+    /// @returns a dindex for the bin data storage
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        multi_axis_t &axes, typename multi_axis_t::loc_bin_index mbin) const
+        -> dindex {
+        const dindex nbins_axis0 = axes.template get_axis<0>().nbins();
+        const dindex nbins_axis1 = axes.template get_axis<1>().nbins();
+
+        return mbin[2] * (nbins_axis0 * nbins_axis1) +
+               plane_type::serialize(mbin[0], mbin[1], nbins_axis0,
+                                     nbins_axis1);
+    }
+
+    /// @brief Create a bin tuple from a serialized bin - 3D
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param gbin the global (serial) bin
+    ///
+    /// @return a 3-dimensional multi-bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes, dindex gbin) const ->
+        typename multi_axis_t::loc_bin_index {
+        const dindex nbins_axis0 = axes.template get_axis<0>().nbins();
+        const dindex nbins_axis1 = axes.template get_axis<1>().nbins();
+        const dindex nbins_plane{nbins_axis0 * nbins_axis1};
+
+        const auto bins = plane_type::deserialize(
+            gbin % nbins_plane, nbins_axis0, nbins_axis1);
+
+        return {bins[0], bins[1], gbin / nbins_plane};
+    }
+};
+
+}  // namespace detray
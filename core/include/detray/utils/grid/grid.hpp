@@ -14,8 +14,10 @@
 #include "detray/utils/grid/detail/axis_helpers.hpp"
 #include "detray/utils/grid/detail/bin_storage.hpp"
 #include "detray/utils/grid/detail/bin_view.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
 #include "detray/utils/grid/populators.hpp"
 #include "detray/utils/grid/serializers.hpp"
+#include "detray/utils/grid/sorted_bins.hpp"
 #include "detray/utils/ranges.hpp"
 
 // VecMem include(s).
@@ -24,6 +26,7 @@
 // System include(s).
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace detray {
 
@@ -282,9 +285,353 @@ class grid_impl {
         const auto loc_pos = project(trf, track.pos(), track.dir());
 
         // Grid lookup
+        if constexpr (requires { cfg.directed_search_window; }) {
+            if (cfg.directed_search_window) {
+                return search(
+                    loc_pos,
+                    directed_search_window(
+                        trf, track.pos(), track.dir(),
+                        static_cast<scalar_type>(cfg.search_window_depth +
+                                                 cfg.max_mask_tolerance),
+                        static_cast<scalar_type>(cfg.overstep_tolerance),
+                        cfg.search_window));
+            }
+        }
+        if constexpr (requires { cfg.adaptive_search_window; }) {
+            if (cfg.adaptive_search_window) {
+                return search(
+                    loc_pos,
+                    adaptive_search_window(
+                        trf, track.pos(), track.dir(),
+                        static_cast<scalar_type>(cfg.search_window_depth +
+                                                 cfg.max_mask_tolerance),
+                        cfg.search_window));
+            }
+        }
+        if constexpr (requires { cfg.search_envelope; }) {
+            if (cfg.search_envelope > 0.f) {
+                return search(loc_pos,
+                              envelope_search_window(
+                                  trf, track.pos(), track.dir(),
+                                  static_cast<scalar_type>(cfg.search_envelope),
+                                  cfg.search_window));
+            }
+        }
         return search(loc_pos, cfg.search_window);
     }
 
+    /// Interface for the navigator: Same search window as @c search , but the
+    /// values are written to the caller-provided buffer @param result (e.g.
+    /// @c search_buffer ), instead of being returned as a range view
+    ///
+    /// If the bin entries are sorted (@see fill_by_pos_counted ), only the
+    /// entries with a sort key that the track can reach within the maximal
+    /// search path of the configuration are written
+    template <typename detector_t, typename track_t, typename config_t,
+              typename buffer_t>
+    DETRAY_HOST_DEVICE void search_into(
+        const detector_t &det, const typename detector_t::volume_type &volume,
+        const track_t &track, const config_t &cfg,
+        const typename detector_t::geometry_context &ctx,
+        buffer_t &result) const {
+
+        const auto &trf = det.transform_store().at(volume.transform(), ctx);
+
+        if constexpr (requires { cfg.sorted_bin_key; }) {
+            if (cfg.sorted_bin_key != bin_sort_key::e_none) {
+                search_into(trf, track, cfg, result,
+                            sorted_entries(det, trf, track, cfg, ctx));
+                return;
+            }
+        }
+        search_into(trf, track, cfg, result, detail::all_bin_entries{});
+    }
+
+    /// Search window of the navigator interface, given the volume placement
+    /// @param trf . The entries of every bin are written to @param result by
+    /// @param fill_bin
+    template <concepts::transform3D transform3_t, typename track_t,
+              typename config_t, typename buffer_t, typename filter_t>
+    DETRAY_HOST_DEVICE void search_into(const transform3_t &trf,
+                                        const track_t &track,
+                                        const config_t &cfg, buffer_t &result,
+                                        const filter_t &fill_bin) const {
+
+        // Track position in grid coordinates
+        const auto loc_pos = project(trf, track.pos(), track.dir());
+
+        // Grid lookup
+        if constexpr (requires { cfg.directed_search_window; }) {
+            if (cfg.directed_search_window) {
+                search_into(
+                    loc_pos,
+                    directed_search_window(
+                        trf, track.pos(), track.dir(),
+                        static_cast<scalar_type>(cfg.search_window_depth +
+                                                 cfg.max_mask_tolerance),
+                        static_cast<scalar_type>(cfg.overstep_tolerance),
+                        cfg.search_window),
+                    result, fill_bin);
+                return;
+            }
+        }
+        if constexpr (requires { cfg.adaptive_search_window; }) {
+            if (cfg.adaptive_search_window) {
+                search_into(
+                    loc_pos,
+                    adaptive_search_window(
+                        trf, track.pos(), track.dir(),
+                        static_cast<scalar_type>(cfg.search_window_depth +
+                                                 cfg.max_mask_tolerance),
+                        cfg.search_window),
+                    result, fill_bin);
+                return;
+            }
+        }
+        if constexpr (requires { cfg.search_envelope; }) {
+            if (cfg.search_envelope > 0.f) {
+                search_into(loc_pos,
+                            envelope_search_window(
+                                trf, track.pos(), track.dir(),
+                                static_cast<scalar_type>(cfg.search_envelope),
+                                cfg.search_window),
+                            result, fill_bin);
+                return;
+            }
+        }
+        search_into(loc_pos, cfg.search_window, result, fill_bin);
+    }
+
+    /// @brief Filter for bin entries that are sorted along the sort key of
+    /// the navigation configuration @param cfg
+    ///
+    /// Along a path of length s, the radius and the z-coordinate of the track
+    /// change by at most s. The surfaces that the track can reach within the
+    /// maximal search path therefore have a key close to the key of the track
+    /// position. The interval is widened by the search window depth and the
+    /// mask tolerance, since the surfaces are sorted by their centers (the
+    /// key should therefore be the coordinate normal to the grid, e.g. the
+    /// radius for cylinder grids), and by the overstep tolerance. If the track
+    /// moves towards larger keys, the smaller keys cannot be reached anymore
+    /// (for the z-coordinate, this is also true in the reverse case).
+    ///
+    /// @param det the detector, which holds the surface placements
+    /// @param trf the placement transform of the grid
+    /// @param track the track state
+    /// @param ctx the geometry context
+    ///
+    /// @returns a bin filter for @c search_into
+    template <typename detector_t, concepts::transform3D transform3_t,
+              typename track_t, typename config_t>
+    DETRAY_HOST_DEVICE auto sorted_entries(
+        const detector_t &det, const transform3_t &trf, const track_t &track,
+        const config_t &cfg,
+        const typename detector_t::geometry_context &ctx) const {
+
+        const bin_sort_key key{cfg.sorted_bin_key};
+
+        // Key of the track position and its rate of change along the track
+        const auto loc_pos = trf.point_to_local(track.pos());
+        const auto loc_dir = trf.vector_to_local(track.dir());
+        const scalar_type track_key{detail::bin_sort_value(key, loc_pos)};
+
+        scalar_type key_rate{loc_dir[2]};
+        if (key == bin_sort_key::e_radius) {
+            key_rate = (track_key > 0.f) ? (loc_pos[0] * loc_dir[0] +
+                                            loc_pos[1] * loc_dir[1]) /
+                                               track_key
+                                         : 1.f;
+        }
+
+        const scalar_type margin{static_cast<scalar_type>(
+            cfg.search_window_depth + cfg.max_mask_tolerance +
+            math::fabs(cfg.overstep_tolerance))};
+        const auto max_path{static_cast<scalar_type>(cfg.max_search_path)};
+
+        scalar_type min_key{track_key - max_path - margin};
+        scalar_type max_key{track_key + max_path + margin};
+        if (key_rate >= 0.f) {
+            min_key = track_key - margin;
+        } else if (key == bin_sort_key::e_z) {
+            max_key = track_key + margin;
+        }
+
+        // Sort key of a bin entry (a surface or a surface index)
+        auto get_key = [&det, &trf, &ctx, key](const value_type &entry) {
+            const auto sf = [&det, &entry]() {
+                if constexpr (std::is_integral_v<value_type>) {
+                    return det.surface(entry);
+                } else {
+                    return entry;
+                }
+            }();
+            const auto &sf_trf = det.transform_store().at(sf.transform(), ctx);
+
+            return static_cast<scalar_type>(detail::bin_sort_value(
+                key, trf.point_to_local(sf_trf.translation())));
+        };
+
+        return detail::sorted_bin_entries<decltype(get_key), scalar_type>{
+            get_key, min_key, max_key};
+    }
+
+    /// @brief Search window that is adapted to the incidence angle of a track
+    ///
+    /// Moves the track position along the track direction, until it has
+    /// covered the distance @param tol normal to the grid surface. The
+    /// search window then contains all bins that the track passes in the
+    /// process, i.e. it widens with the incidence angle of the track.
+    ///
+    /// @param trf the placement transform of the grid
+    /// @param p   the track position in global coordinates
+    /// @param d   the track direction at position p
+    /// @param max_window the largest permitted search window
+    ///
+    /// @returns the number of neighbouring bins to search, which is the same
+    /// for all axes and never exceeds the @param max_window.
+    template <concepts::transform3D transform3_t, concepts::point3D point3_t,
+              concepts::vector3D vector3_t>
+    DETRAY_HOST_DEVICE darray<dindex, 2> adaptive_search_window(
+        const transform3_t &trf, const point3_t &p, const vector3_t &d,
+        const scalar_type tol, const darray<dindex, 2> &max_window) const {
+
+        using frame_t = local_frame_type;
+
+        // No surface normal available (e.g. for 3D grids)
+        if constexpr (!requires {
+                          frame_t::normal(
+                              trf, frame_t::global_to_local_3D(trf, p, d));
+                      }) {
+            return max_window;
+        } else {
+            // Limit the path length for tracks parallel to the grid surface
+            constexpr scalar_type min_cos{1e-3f};
+
+            const auto n{
+                frame_t::normal(trf, frame_t::global_to_local_3D(trf, p, d))};
+            const scalar_type cos_inc{math::fabs(vector::dot(n, d))};
+            const scalar_type s{tol / (cos_inc > min_cos ? cos_inc : min_cos)};
+
+            const point_type loc_p{project(trf, p, d)};
+
+            dindex n_nbors{0u};
+            for (const scalar_type sign : {-1.f, 1.f}) {
+                const point_type loc_end{project(trf, p + (sign * s) * d, d)};
+                const dindex dist{bin_distance(
+                    loc_p, loc_end, std::make_index_sequence<dim>{})};
+                n_nbors = dist > n_nbors ? dist : n_nbors;
+            }
+
+            return {n_nbors < max_window[0] ? n_nbors : max_window[0],
+                    n_nbors < max_window[1] ? n_nbors : max_window[1]};
+        }
+    }
+
+    /// @brief Search window that is widened by the bins around the track
+    /// position
+    ///
+    /// Moves the track position by @param half_width along the global axes
+    /// in both directions. The bins that are passed along the three axes are
+    /// added up, so that, to first order, the window covers all bins within
+    /// the distance half_width of the track position.
+    ///
+    /// @param trf the placement transform of the grid
+    /// @param p   the track position in global coordinates
+    /// @param d   the track direction at position p
+    /// @param window the search window around the track position
+    ///
+    /// @returns the number of neighbouring bins to search per axis
+    template <concepts::transform3D transform3_t, concepts::point3D point3_t,
+              concepts::vector3D vector3_t>
+    DETRAY_HOST_DEVICE darray<dindex, 2> envelope_search_window(
+        const transform3_t &trf, const point3_t &p, const vector3_t &d,
+        const scalar_type half_width, const darray<dindex, 2> &window) const {
+
+        const point_type loc_p{project(trf, p, d)};
+
+        dindex n_nbors{0u};
+        for (unsigned int k = 0u; k < 3u; ++k) {
+            const vector3_t e{k == 0u ? 1.f : 0.f, k == 1u ? 1.f : 0.f,
+                              k == 2u ? 1.f : 0.f};
+
+            dindex n_axis{0u};
+            for (const scalar_type sign : {-1.f, 1.f}) {
+                const point_type loc_end{
+                    project(trf, p + (sign * half_width) * e, d)};
+                const dindex dist{bin_distance(
+                    loc_p, loc_end, std::make_index_sequence<dim>{})};
+                n_axis = dist > n_axis ? dist : n_axis;
+            }
+            n_nbors += n_axis;
+        }
+
+        return {window[0] + n_nbors, window[1] + n_nbors};
+    }
+
+    /// @brief Search window that only contains the bins the track can reach
+    ///
+    /// Like the @c adaptive_search_window , but the track position is moved
+    /// forward along the track direction until it has covered the distance
+    /// @param tol normal to the grid surface, and backward only as far as the
+    /// navigator still accepts candidates (@param overstep_tol ). Every axis
+    /// then gets its own window, which only extends towards the bins that the
+    /// track passes in the process, so that the bins behind the track, or
+    /// beside it, are not searched.
+    ///
+    /// @param trf the placement transform of the grid
+    /// @param p   the track position in global coordinates
+    /// @param d   the track direction at position p
+    /// @param overstep_tol the (negative) path length behind the track
+    /// @param max_window the largest permitted search window
+    ///
+    /// @returns the number of lower and upper neighbouring bins to search for
+    /// every axis, which never exceeds the @param max_window.
+    template <concepts::transform3D transform3_t, concepts::point3D point3_t,
+              concepts::vector3D vector3_t>
+    DETRAY_HOST_DEVICE darray<darray<dindex, 2>, dim> directed_search_window(
+        const transform3_t &trf, const point3_t &p, const vector3_t &d,
+        const scalar_type tol, const scalar_type overstep_tol,
+        const darray<dindex, 2> &max_window) const {
+
+        using frame_t = local_frame_type;
+
+        darray<darray<dindex, 2>, dim> window{};
+
+        // No surface normal available (e.g. for 3D grids)
+        if constexpr (!requires {
+                          frame_t::normal(
+                              trf, frame_t::global_to_local_3D(trf, p, d));
+                      }) {
+            for (auto &axis_window : window) {
+                axis_window = max_window;
+            }
+        } else {
+            // Limit the path length for tracks parallel to the grid surface
+            constexpr scalar_type min_cos{1e-3f};
+
+            const auto n{
+                frame_t::normal(trf, frame_t::global_to_local_3D(trf, p, d))};
+            const scalar_type cos_inc{math::fabs(vector::dot(n, d))};
+            const scalar_type s{tol / (cos_inc > min_cos ? cos_inc : min_cos)};
+            const scalar_type s_back{math::max(overstep_tol, -s)};
+
+            const point_type loc_p{project(trf, p, d)};
+
+            for (const scalar_type s_end : {s_back, s}) {
+                const point_type loc_end{project(trf, p + s_end * d, d)};
+                update_window(window, loc_p, loc_end,
+                              std::make_index_sequence<dim>{});
+            }
+
+            for (auto &axis_window : window) {
+                axis_window[0] = math::min(axis_window[0], max_window[0]);
+                axis_window[1] = math::min(axis_window[1], max_window[1]);
+            }
+        }
+
+        return window;
+    }
+
     /// Find the value of a single bin - const
     ///
     /// @param p is point in the local (bound) frame
@@ -323,6 +670,211 @@ class grid_impl {
         return detray::views::join(std::move(search_area));
     }
 
+    /// @brief Return the values of search window with a separate neighborhood
+    /// on every axis
+    ///
+    /// @param p is point in the local frame
+    /// @param win_size size of the binned/scalar search window for every axis
+    ///                 (e.g. from the @c directed_search_window )
+    ///
+    /// @return the sequence of values
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE auto search(
+        const point_type &p,
+        const darray<darray<neighbor_t, 2>, dim> &win_size) const {
+
+        // Return iterable over bins in the search window
+        auto search_window = axes().bin_ranges(p, win_size);
+        auto search_area = axis::detail::bin_view(*this, search_window);
+
+        // Join the respective bins to a single iteration
+        return detray::views::join(std::move(search_area));
+    }
+
+    /// @brief Write the values of a neighborhood to a flat buffer
+    ///
+    /// Visits the bins of the search window in plain loops and writes their
+    /// values to the caller-provided buffer @param result , which has to
+    /// provide @c push_back (e.g. @c search_buffer ). Avoids the iterator
+    /// overhead of the joined bin views that are returned by @c search .
+    ///
+    /// @param p is point in the local frame
+    /// @param win_size size of the binned/scalar search window
+    /// @param fill_bin writes the values of a single bin to the buffer
+    template <typename neighbor_t, typename buffer_t,
+              typename filter_t = detail::all_bin_entries>
+    DETRAY_HOST_DEVICE void search_into(const point_type &p,
+                                        const darray<neighbor_t, 2> &win_size,
+                                        buffer_t &result,
+                                        const filter_t &fill_bin = {}) const {
+        fill_search_window(axes().bin_ranges(p, win_size), result, fill_bin);
+    }
+
+    /// @brief Write the values of a search window with a separate
+    /// neighborhood on every axis to a flat buffer
+    ///
+    /// @param p is point in the local frame
+    /// @param win_size size of the binned/scalar search window for every axis
+    /// @param result the buffer the values are written to
+    /// @param fill_bin writes the values of a single bin to the buffer
+    template <typename neighbor_t, typename buffer_t,
+              typename filter_t = detail::all_bin_entries>
+    DETRAY_HOST_DEVICE void search_into(
+        const point_type &p, const darray<darray<neighbor_t, 2>, dim> &win_size,
+        buffer_t &result, const filter_t &fill_bin = {}) const {
+        fill_search_window(axes().bin_ranges(p, win_size), result, fill_bin);
+    }
+
+    /// @brief Union of the bins in a search window
+    ///
+    /// Only available for bins that can be merged (e.g. @c bins::bitset ),
+    /// for which the entries of the union are free of duplicates.
+    ///
+    /// @param p is point in the local frame
+    /// @param win_size size of the binned/scalar search window (same for all
+    ///                 axes or per axis)
+    ///
+    /// @returns a single bin that holds the entries of all bins
+    template <typename window_t>
+    requires concepts::mergeable_bin<bin_type> DETRAY_HOST_DEVICE bin_type
+    search_union(const point_type &p, const window_t &win_size) const {
+        return merge_window(axes().bin_ranges(p, win_size));
+    }
+
+    /// @returns the union of the bins in the search @param window
+    DETRAY_HOST_DEVICE bin_type merge_window(
+        const axis::multi_bin_range<dim> &window) const
+        requires concepts::mergeable_bin<bin_type> {
+        bin_type bin_union{};
+        loc_bin_index lbin{};
+        fill_window<0u>(window, lbin, bin_union,
+                        [](const bin_type &b, bin_type &u) { u.merge(b); });
+
+        return bin_union;
+    }
+
+    /// Write the values of the bins in the search @param window to
+    /// @param result . Mergeable bins are merged first, so that every value
+    /// is written only once
+    template <typename buffer_t, typename filter_t>
+    DETRAY_HOST_DEVICE void fill_search_window(
+        const axis::multi_bin_range<dim> &window, buffer_t &result,
+        const filter_t &fill_bin) const {
+        if constexpr (concepts::mergeable_bin<bin_type> &&
+                      std::is_same_v<filter_t, detail::all_bin_entries>) {
+            fill_bin(merge_window(window), result);
+        } else {
+            loc_bin_index lbin{};
+            fill_window<0u>(window, lbin, result, fill_bin);
+        }
+    }
+
+    /// Loop over the bin range of the axis @tparam I in the search
+    /// @param window and recurse into the next axis. In the innermost loop,
+    /// the values of the bin @param lbin are written to @param result by
+    /// @param fill_bin
+    template <unsigned int I, typename buffer_t,
+              typename filter_t = detail::all_bin_entries>
+    DETRAY_HOST_DEVICE void fill_window(
+        const axis::multi_bin_range<dim> &window, loc_bin_index &lbin,
+        buffer_t &result, const filter_t &fill_bin = {}) const {
+        if constexpr (I == dim) {
+            fill_bin(bin(lbin), result);
+        } else {
+            const auto ax = get_axis<I>();
+            const auto &range = window.indices[I];
+
+            for (int i = range[0]; i < range[1]; ++i) {
+                // Circular axes: Map the bin index into the axis range
+                using axis_t = std::remove_cvref_t<decltype(ax)>;
+                if constexpr (axis_t::bounds_type::type ==
+                              axis::bounds::e_circular) {
+                    lbin[I] = static_cast<dindex>(
+                        axis::circular<>{}.wrap(i, ax.nbins()));
+                } else {
+                    lbin[I] = static_cast<dindex>(i);
+                }
+                fill_window<I + 1u>(window, lbin, result, fill_bin);
+            }
+        }
+    }
+
+    /// Widen the per-axis search @param window , so that it reaches from the
+    /// bin of the local point @param a to the bin of @param b
+    template <std::size_t... I>
+    DETRAY_HOST_DEVICE void update_window(
+        darray<darray<dindex, 2>, dim> &window, const point_type &a,
+        const point_type &b, std::index_sequence<I...>) const {
+        (update_axis_window(window[I],
+                            axis_signed_bin_distance(
+                                m_axes.template get_axis<I>(), a[I], b[I])),
+         ...);
+    }
+
+    /// Widen the search window of a single axis @param axis_window by the
+    /// signed distance in bins @param dist
+    DETRAY_HOST_DEVICE static void update_axis_window(
+        darray<dindex, 2> &axis_window, const int dist) {
+        const auto n{static_cast<dindex>(dist < 0 ? -dist : dist)};
+        dindex &w{dist < 0 ? axis_window[0] : axis_window[1]};
+        w = n > w ? n : w;
+    }
+
+    /// @returns the signed distance in bins from the value @param a to the
+    /// value @param b on the axis @param ax
+    template <typename axis_t>
+    DETRAY_HOST_DEVICE static int axis_signed_bin_distance(
+        const axis_t &ax, const scalar_type a, const scalar_type b) {
+        const int dist{static_cast<int>(ax.bin(b)) -
+                       static_cast<int>(ax.bin(a))};
+
+        // Take the shorter way around on circular axes
+        if constexpr (axis_t::bounds_type::type == axis::bounds::e_circular) {
+            const auto nbins{static_cast<int>(ax.nbins())};
+            if (2 * dist > nbins) {
+                return dist - nbins;
+            }
+            if (2 * dist < -nbins) {
+                return dist + nbins;
+            }
+        }
+        return dist;
+    }
+
+    /// @returns the largest distance in bins between the local points
+    /// @param a and @param b on any of the grid axes
+    template <std::size_t... I>
+    DETRAY_HOST_DEVICE dindex bin_distance(const point_type &a,
+                                           const point_type &b,
+                                           std::index_sequence<I...>) const {
+        const darray<dindex, dim> dists{
+            axis_bin_distance(m_axes.template get_axis<I>(), a[I], b[I])...};
+
+        dindex dist{0u};
+        for (const dindex d : dists) {
+            dist = d > dist ? d : dist;
+        }
+        return dist;
+    }
+
+    /// @returns the distance in bins between the values @param a and @param b
+    /// on the axis @param ax
+    template <typename axis_t>
+    DETRAY_HOST_DEVICE static dindex axis_bin_distance(const axis_t &ax,
+                                                       const scalar_type a,
+                                                       const scalar_type b) {
+        const dindex i{ax.bin(a)};
+        const dindex j{ax.bin(b)};
+        const dindex dist{i > j ? i - j : j - i};
+
+        // Take the shorter way around on circular axes
+        if constexpr (axis_t::bounds_type::type == axis::bounds::e_circular) {
+            return dist > ax.nbins() - dist ? ax.nbins() - dist : dist;
+        } else {
+            return dist;
+        }
+    }
+
     /// Poupulate a bin with a single one of its corresponding values @param v
     /// @{
     /// @param mbin the multi bin index to be populated
@@ -398,6 +950,6 @@ template <concepts::algebra algebra_t, typename axes_t, typename bin_t,
           typename containers = host_container_types, bool ownership = true>
 using grid =
     grid_impl<coordinate_axes<axes_t, algebra_t, ownership, containers>, bin_t,
-              simple_serializer>;
+              serializer_t>;
 
 }  // namespace detray
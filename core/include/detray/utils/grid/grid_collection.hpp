@@ -16,13 +16,40 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s).
+#include <bit>
+#include <cassert>
 #include <cstddef>
 #include <type_traits>
 
 namespace detray {
 
+namespace detail {
+
+/// @brief Everything that is needed to address a grid in a grid collection
+///
+/// The offset of the grid into the bin storage and the edge offsets of its
+/// axes are packed into one struct. It is aligned to its size (rounded up to
+/// a power of two), so that it can be fetched with a single aligned load.
+template <std::size_t DIM>
+struct alignas(std::bit_ceil(sizeof(dindex) * (1u + 2u * DIM))) grid_header {
+    /// Offset of the grid into the global bin storage
+    dindex bin_offset{0u};
+    /// Offset into the global bin edge storage and no. bins for every axis
+    darray<dindex_range, DIM> edge_offsets{};
+
+    /// Equality operator
+    constexpr bool operator==(const grid_header &rhs) const = default;
+};
+
+}  // namespace detail
+
 /// @brief A collection of grids that can be moved to device.
 ///
+/// Every grid is addressed by a @c detail::grid_header , which holds its
+/// offset into the shared bin storage and the edge offsets of its axes. The
+/// grid instances are assembled on the fly from the header and the shared
+/// bin and bin edge storage.
+///
 /// @tparam grid_t The type of grid in this collection. Must be non-owning, so
 ///                that the grid collection can manage the underlying memory.
 template <concepts::grid grid_t, typename = void>
@@ -45,6 +72,8 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     public:
     using value_type = grid_type;
     using size_type = dindex;
+    /// Bin offset and axes of a single grid
+    using header_type = detail::grid_header<grid_type::dim>;
 
     /// Backend storage type for the grid
     using bin_container_type = typename grid_type::bin_container_type;
@@ -112,24 +141,20 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
 
     public:
     /// Vecmem based grid collection view type
-    using view_type =
-        dmulti_view<dvector_view<size_type>,
-                    detail::get_view_t<bin_container_type>,
-                    detail::get_view_t<edge_offset_container_type>,
-                    detail::get_view_t<edges_container_type>>;
+    using view_type = dmulti_view<dvector_view<header_type>,
+                                  detail::get_view_t<bin_container_type>,
+                                  detail::get_view_t<edges_container_type>>;
 
     /// Vecmem based grid collection view type
     using const_view_type =
-        dmulti_view<dvector_view<const size_type>,
+        dmulti_view<dvector_view<const header_type>,
                     detail::get_view_t<const bin_container_type>,
-                    detail::get_view_t<const edge_offset_container_type>,
                     detail::get_view_t<const edges_container_type>>;
 
     /// Vecmem based buffer type
     using buffer_type =
-        dmulti_buffer<dvector_buffer<size_type>,
+        dmulti_buffer<dvector_buffer<header_type>,
                       detail::get_buffer_t<bin_container_type>,
-                      detail::get_buffer_t<edge_offset_container_type>,
                       detail::get_buffer_t<edges_container_type>>;
 
     /// Make grid collection default constructible: Empty
@@ -138,43 +163,51 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     /// Create empty grid collection from specific vecmem memory resource
     DETRAY_HOST
     explicit grid_collection(vecmem::memory_resource *resource)
-        : m_bin_offsets(resource),
-          m_bins(resource),
-          m_bin_edge_offsets(resource),
-          m_bin_edges(resource) {}
+        : m_headers(resource), m_bins(resource), m_bin_edges(resource) {}
 
-    /// Create grid colection from existing data - move
-    DETRAY_HOST_DEVICE
-    grid_collection(vector_type<size_type> &&offs, bin_container_type &&bins,
-                    edge_offset_container_type &&edge_offs,
+    /// Create grid colection from existing data: The bin offsets @param offs
+    /// and the edge offsets @param edge_offs of the axes are packed into the
+    /// grid headers, which use the same memory resource as @param offs
+    DETRAY_HOST
+    grid_collection(const vector_type<size_type> &offs,
+                    bin_container_type &&bins,
+                    const edge_offset_container_type &edge_offs,
                     edges_container_type &&edges)
-        : m_bin_offsets(std::move(offs)),
+        : m_headers(offs.get_allocator()),
           m_bins(std::move(bins)),
-          m_bin_edge_offsets(std::move(edge_offs)),
-          m_bin_edges(std::move(edges)) {}
+          m_bin_edges(std::move(edges)) {
+        assert(edge_offs.size() == grid_type::dim * offs.size());
+
+        m_headers.reserve(offs.size());
+        for (std::size_t i = 0u; i < offs.size(); ++i) {
+            header_type header{};
+            header.bin_offset = offs[i];
+            for (std::size_t j = 0u; j < grid_type::dim; ++j) {
+                header.edge_offsets[j] = edge_offs[grid_type::dim * i + j];
+            }
+            m_headers.push_back(header);
+        }
+    }
 
     /// Device-side construction from a vecmem based view type
     template <concepts::device_view coll_view_t>
     DETRAY_HOST_DEVICE explicit grid_collection(coll_view_t &view)
-        : m_bin_offsets(detail::get<0>(view.m_view)),
+        : m_headers(detail::get<0>(view.m_view)),
           m_bins(detail::get<1>(view.m_view)),
-          m_bin_edge_offsets(detail::get<2>(view.m_view)),
-          m_bin_edges(detail::get<3>(view.m_view)) {}
+          m_bin_edges(detail::get<2>(view.m_view)) {}
 
     /// Move constructor
     DETRAY_HOST_DEVICE grid_collection(grid_collection &&other) noexcept
-        : m_bin_offsets(std::move(other.m_bin_offsets)),
+        : m_headers(std::move(other.m_headers)),
           m_bins(std::move(other.m_bins)),
-          m_bin_edge_offsets(std::move(other.m_bin_edge_offsets)),
           m_bin_edges(std::move(other.m_bin_edges)) {}
 
     /// Move assignment
     DETRAY_HOST_DEVICE grid_collection &operator=(
         grid_collection &&other) noexcept {
         if (this != &other) {
-            m_bin_offsets = std::move(other.m_bin_offsets);
+            m_headers = std::move(other.m_headers);
             m_bins = std::move(other.m_bins);
-            m_bin_edge_offsets = std::move(other.m_bin_edge_offsets);
             m_bin_edges = std::move(other.m_bin_edges);
         }
         return *this;
@@ -183,7 +216,7 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     /// @returns the number of grids in the collection - const
     DETRAY_HOST_DEVICE
     constexpr auto size() const noexcept -> dindex {
-        return static_cast<dindex>(m_bin_offsets.size());
+        return static_cast<dindex>(m_headers.size());
     }
 
     /// @returns an iterator that points to the first grid
@@ -197,7 +230,7 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     /// @returns the number of grids in the collection - const
     DETRAY_HOST_DEVICE
     constexpr auto empty() const noexcept -> bool {
-        return m_bin_offsets.empty();
+        return m_headers.empty();
     }
 
     /// @brief Resize the underlying containers
@@ -212,12 +245,21 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     constexpr void reserve(std::size_t) noexcept { /*Not defined*/
     }
 
+    /// Reserve memory for @param n_grids grids with a total of @param n_bins
+    /// bins
+    DETRAY_HOST void reserve(const std::size_t n_grids,
+                             const std::size_t n_bins) {
+        m_headers.reserve(n_grids);
+        if constexpr (requires { m_bins.reserve(n_bins); }) {
+            m_bins.reserve(n_bins);
+        }
+    }
+
     /// Removes all data from the grid collection containers
     DETRAY_HOST_DEVICE
     constexpr void clear() noexcept {
-        m_bin_offsets.clear();
+        m_headers.clear();
         m_bins.clear();
-        m_bin_edge_offsets.clear();
         m_bin_edges.clear();
     }
 
@@ -228,10 +270,10 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
         /*Not defined*/
     }
 
-    /// @returns the offsets for the grids in the bin storage - const
+    /// @returns the headers (bin offset and axes) of the grids - const
     DETRAY_HOST_DEVICE
-    constexpr auto offsets() const -> const vector_type<size_type> & {
-        return m_bin_offsets;
+    constexpr auto headers() const -> const vector_type<header_type> & {
+        return m_headers;
     }
 
     /// @returns the underlying bin content storage - const
@@ -240,11 +282,9 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
         return m_bins;
     }
 
-    /// @returns the underlying axis boundary storage - const
-    DETRAY_HOST_DEVICE
-    constexpr auto axes_storage() const -> const edge_offset_container_type & {
-        return m_bin_edge_offsets;
-    }
+    /// @returns the underlying bin content storage - non-const
+    DETRAY_HOST
+    constexpr auto bin_storage() -> bin_container_type & { return m_bins; }
 
     /// @returns the underlying bin edges storage - const
     DETRAY_HOST_DEVICE
@@ -255,26 +295,23 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     /// Create grid from container pointers - const
     DETRAY_HOST_DEVICE
     auto operator[](const size_type i) const -> grid_type {
-        const size_type axes_offset{grid_type::dim * i};
-        return grid_type(
-            &m_bins, multi_axis_t(m_bin_edge_offsets, m_bin_edges, axes_offset),
-            m_bin_offsets[i]);
+        const header_type header{m_headers[i]};
+        return grid_type(&m_bins,
+                         multi_axis_t(header.edge_offsets, m_bin_edges),
+                         header.bin_offset);
     }
 
     /// @returns a vecmem view on the grid collection data - non-const
     DETRAY_HOST auto get_data() -> view_type {
-        return view_type{detray::get_data(m_bin_offsets),
-                         detray::get_data(m_bins),
-                         detray::get_data(m_bin_edge_offsets),
+        return view_type{detray::get_data(m_headers), detray::get_data(m_bins),
                          detray::get_data(m_bin_edges)};
     }
 
     /// @returns a vecmem view on the grid collection data - const
     DETRAY_HOST
     auto get_data() const -> const_view_type {
-        return const_view_type{detray::get_data(m_bin_offsets),
+        return const_view_type{detray::get_data(m_headers),
                                detray::get_data(m_bins),
-                               detray::get_data(m_bin_edge_offsets),
                                detray::get_data(m_bin_edges)};
     }
 
@@ -283,28 +320,26 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
     DETRAY_HOST constexpr auto push_back(
         const typename grid_type::template type<true> &gr) noexcept(false)
         -> void {
+        header_type header{};
+
         // Current offset into the global bin storage for the new grid
-        m_bin_offsets.push_back(static_cast<size_type>(m_bins.size()));
+        header.bin_offset = static_cast<size_type>(m_bins.size());
 
         // Add the bins of the new grid to the collection
         insert_bin_data(m_bins, gr.bins());
 
-        // Add the bin edge offsets of the new grid to the collection
-        // (how to lookup the axis bin edges)
+        // Add the bin edge offsets of the new grid to the header (how to
+        // lookup the axis bin edges), shifted by the current offset into
+        // the global bin edges storage
         const auto &bin_edge_offsets = gr.axes().bin_edge_offsets();
-        m_bin_edge_offsets.insert(m_bin_edge_offsets.end(),
-                                  bin_edge_offsets.begin(),
-                                  bin_edge_offsets.end());
-
-        // Current offset into the global bin edges storage
-        auto bin_edges_offset{static_cast<dindex>(m_bin_edges.size())};
-
-        // Update the bin edges index offset for the axes in the grid collection
-        const auto start_idx{m_bin_edge_offsets.size() - grid_type::dim};
-        for (std::size_t i = start_idx; i < m_bin_edge_offsets.size(); ++i) {
-            auto &bin_entry_range = m_bin_edge_offsets.at(i);
-            bin_entry_range[0] += bin_edges_offset;
+        assert(bin_edge_offsets.size() == grid_type::dim);
+
+        const auto bin_edges_offset{static_cast<dindex>(m_bin_edges.size())};
+        for (std::size_t i = 0u; i < grid_type::dim; ++i) {
+            header.edge_offsets[i] = bin_edge_offsets[i];
+            header.edge_offsets[i][0] += bin_edges_offset;
         }
+        m_headers.push_back(header);
 
         // Add the bin edges of the new grid to the collection
         const auto &bin_edges = gr.axes().bin_edges();
@@ -329,12 +364,11 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
         bin_data.append(grid_bins);
     }
 
-    /// Offsets for the respective grids into the bin storage
-    vector_type<size_type> m_bin_offsets{};
+    /// Bin offset and the offsets/no. bins for the bin edges of the axes of
+    /// every grid
+    vector_type<header_type> m_headers{};
     /// Contains the bin content for all grids
     bin_container_type m_bins{};
-    /// Contains the offsets/no. bins for the bin edges of all axes of all grids
-    edge_offset_container_type m_bin_edge_offsets{};
     /// Contains the bin edges for all grids
     edges_container_type m_bin_edges{};
 };
@@ -9,3 +9,4 @@
 
 // Project include(s).
 #include "detray/utils/grid/detail/simple_serializer.hpp"
+#include "detray/utils/grid/detail/tiled_serializer.hpp"
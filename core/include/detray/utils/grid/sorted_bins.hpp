@@ -0,0 +1,83 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <cstdint>
+
+namespace detray {
+
+/// Coordinate along which the entries of the grid bins are sorted
+///
+/// The coordinate is taken from the surface position in the local frame of
+/// the volume the grid belongs to.
+enum class bin_sort_key : std::uint_least8_t {
+    e_none = 0u,    ///< bin entries are not sorted
+    e_radius = 1u,  ///< sorted by the transverse radius
+    e_z = 2u,       ///< sorted by the z-coordinate
+};
+
+namespace detail {
+
+/// @returns the value of the sort @param key for the point @param p, given in
+/// the local cartesian frame of the volume
+template <concepts::point3D point3_t>
+DETRAY_HOST_DEVICE constexpr auto bin_sort_value(const bin_sort_key key,
+                                                 const point3_t &p) {
+    return (key == bin_sort_key::e_radius) ? vector::perp(p) : p[2];
+}
+
+/// Writes every entry of a bin to the search result
+struct all_bin_entries {
+    template <typename bin_t, typename buffer_t>
+    DETRAY_HOST_DEVICE void operator()(const bin_t &bin,
+                                       buffer_t &result) const {
+        for (const auto &value : bin) {
+            result.push_back(value);
+        }
+    }
+};
+
+/// Writes the entries of a bin, which are sorted in ascending order of the
+/// key that is given by @tparam key_getter_t , to the search result, as long
+/// as their key lies in the interval [@c min , @c max ]
+///
+/// Stops at the first entry beyond the interval, so that the remaining
+/// entries of the bin are not visited.
+template <typename key_getter_t, typename scalar_t>
+struct sorted_bin_entries {
+    /// Calculates the sort key of a bin entry
+    key_getter_t get_key;
+    /// Interval of keys that can be reached by the track
+    /// @{
+    scalar_t min;
+    scalar_t max;
+    /// @}
+
+    template <typename bin_t, typename buffer_t>
+    DETRAY_HOST_DEVICE void operator()(const bin_t &bin,
+                                       buffer_t &result) const {
+        for (const auto &value : bin) {
+            const scalar_t key{get_key(value)};
+            if (key > max) {
+                break;
+            }
+            if (key >= min) {
+                result.push_back(value);
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+}  // namespace detray
@@ -0,0 +1,196 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Memory held by the containers of a detector, per data type
+///
+/// The sizes are taken from the detector views, i.e. they correspond to the
+/// data that is copied to device memory by @c get_buffer . The size of an
+/// element includes the padding of its type. Unused capacity of the host
+/// containers is not counted.
+struct memory_report {
+
+    /// Memory of a single data collection
+    struct record {
+        /// Detector container, e.g. "masks"
+        std::string container{};
+        /// Type of data in the collection
+        std::string type{};
+        /// Number of elements in all vectors of the collection
+        std::size_t n_elements{0u};
+        /// Size of an element in bytes (zero for composite collections, e.g.
+        /// grids, that hold different types of elements)
+        std::size_t element_size{0u};
+        /// Alignment of an element (zero for composite collections)
+        std::size_t element_alignment{0u};
+        /// Total size in bytes
+        std::size_t n_bytes{0u};
+    };
+
+    std::vector<record> records{};
+
+    /// @returns the total memory in bytes
+    DETRAY_HOST
+    std::size_t n_bytes() const {
+        std::size_t n{0u};
+        for (const record& rec : records) {
+            n += rec.n_bytes;
+        }
+        return n;
+    }
+
+    /// @returns the memory in bytes per detector container
+    DETRAY_HOST
+    std::map<std::string, std::size_t> bytes_per_container() const {
+        std::map<std::string, std::size_t> bytes{};
+        for (const record& rec : records) {
+            bytes[rec.container] += rec.n_bytes;
+        }
+        return bytes;
+    }
+
+    /// Print the report
+    DETRAY_HOST
+    friend std::ostream& operator<<(std::ostream& out,
+                                    const memory_report& report) {
+
+        out << "\nDetector memory [elements | element size | bytes]\n"
+            << "----------------------------\n";
+        for (const record& rec : report.records) {
+            out << "  " << std::setw(14) << std::left << rec.container << " "
+                << std::setw(40) << rec.type << " " << rec.n_elements << " | "
+                << rec.element_size << " | " << rec.n_bytes << "\n";
+        }
+        out << "  Total [bytes]         : " << report.n_bytes() << "\n";
+
+        return out;
+    }
+};
+
+namespace detail {
+
+/// @returns the number of elements and bytes in the vectors of a view
+/// @{
+template <typename T>
+DETRAY_HOST std::pair<std::size_t, std::size_t> view_memory(
+    const dvector_view<T>& v) {
+    return {v.size(), v.size() * sizeof(T)};
+}
+
+template <typename... view_ts>
+DETRAY_HOST std::pair<std::size_t, std::size_t> view_memory(
+    const dmulti_view<view_ts...>& v) {
+    std::pair<std::size_t, std::size_t> mem{0u, 0u};
+
+    [&mem, &v]<std::size_t... I>(std::index_sequence<I...>) {
+        ((mem.first += view_memory(detray::detail::get<I>(v.m_view)).first,
+          mem.second += view_memory(detray::detail::get<I>(v.m_view)).second),
+         ...);
+    }
+    (std::make_index_sequence<sizeof...(view_ts)>{});
+
+    return mem;
+}
+/// @}
+
+/// @returns a short name of the data type @tparam T that is stored in a
+/// detector collection: The shape for masks, the local frame and bin entries
+/// for grids
+template <typename T>
+DETRAY_HOST std::string memory_type_name() {
+    if constexpr (requires { typename T::shape; }) {
+        return types::get_name<typename T::shape>();
+    } else if constexpr (requires {
+                             typename T::value_type::local_frame_type;
+                             typename T::value_type::value_type;
+                         }) {
+        using grid_t = typename T::value_type;
+        return types::get_name<T>() + "<" +
+               types::get_name<typename grid_t::local_frame_type>() + ", " +
+               types::get_name<typename grid_t::value_type>() + ">";
+    } else {
+        return types::get_name<T>();
+    }
+}
+
+/// Add the memory of the collection @param coll to @param report
+template <typename collection_t>
+DETRAY_HOST void add_memory_record(const std::string& container,
+                                   const collection_t& coll,
+                                   memory_report& report) {
+
+    const auto [n_elements, n_bytes] = view_memory(detray::get_data(coll));
+
+    // Plain vectors: Report the element type
+    if constexpr (requires { typename collection_t::allocator_type; }) {
+        using value_t = typename collection_t::value_type;
+
+        report.records.push_back({container, memory_type_name<value_t>(),
+                                  n_elements, sizeof(value_t),
+                                  alignof(value_t), n_bytes});
+    } else {
+        report.records.push_back({container,
+                                  memory_type_name<collection_t>(),
+                                  n_elements, 0u, 0u, n_bytes});
+    }
+}
+
+/// Add the memory of every collection in the multi store @param store to
+/// @param report
+template <typename store_t>
+DETRAY_HOST void add_memory_records(const std::string& container,
+                                    const store_t& store,
+                                    memory_report& report) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (add_memory_record(
+             container,
+             store.template get<store_t::value_types::to_id(I)>(), report),
+         ...);
+    }
+    (std::make_index_sequence<store_t::n_collections()>{});
+}
+
+}  // namespace detail
+
+/// @returns the memory held by the detector @param det, broken down by the
+/// detector containers and the data types in the multi stores
+template <typename detector_t>
+DETRAY_HOST memory_report get_memory_report(const detector_t& det) {
+
+    memory_report report{};
+
+    detail::add_memory_record("volumes", det.volumes(), report);
+    detail::add_memory_record("surfaces", det.surfaces(), report);
+    detail::add_memory_record("transforms", det.transform_store(), report);
+    detail::add_memory_records("masks", det.mask_store(), report);
+    detail::add_memory_records("material", det.material_store(), report);
+    detail::add_memory_records("accelerators", det.accelerator_store(),
+                               report);
+    detail::add_memory_record("volume finder", det.volume_search_grid(),
+                              report);
+
+    return report;
+}
+
+}  // namespace detray
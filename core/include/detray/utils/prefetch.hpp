@@ -0,0 +1,31 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+namespace detray::detail {
+
+/// @brief Hint that the data at @param ptr will be read soon.
+///
+/// On host, this issues a software prefetch into all cache levels, on CUDA
+/// devices a prefetch into the L2 cache. The prefetch does not fault on
+/// invalid addresses and is a no-op for other compilers/backends.
+template <typename T>
+DETRAY_HOST_DEVICE inline void prefetch([[maybe_unused]] const T *ptr) {
+#if defined(__CUDA_ARCH__)
+    asm volatile("prefetch.global.L2 [%0];" ::"l"(ptr));
+#elif defined(__GNUC__) || defined(__clang__)
+#if !defined(__SYCL_DEVICE_ONLY__)
+    __builtin_prefetch(static_cast<const void *>(ptr), 0, 3);
+#endif
+#endif
+}
+
+}  // namespace detray::detail
@@ -16,6 +16,7 @@
 
 // System include(s)
 #include <limits>
+#include <type_traits>
 
 namespace detray::detail {
 
@@ -173,6 +174,117 @@ requires(!std::is_arithmetic_v<scalar_t>) class quadratic_equation<scalar_t> {
     darray<scalar_t, 2> m_values{scalar_t(0.f), scalar_t(0.f)};
 };
 
+/// Class to solve a quadratic equation of type a * x^2 + b * x + c = 0
+/// without branches
+///
+/// Both roots and the single root of the degenerate cases are always computed
+/// and the results are selected by the masks of the discriminant sign and the
+/// degenerate cases. This way, the solver works the same for scalar and SoA
+/// (e.g. @c vc_soa ) types, and the cylinder intersections of several
+/// candidates can be vectorized. The roots are computed with the numerically
+/// stable formulation q = -(b + sgn(b) sqrt(D)) / 2, x1 = q / a, x2 = c / q,
+/// which avoids the cancellation between b and the root of the discriminant.
+///
+/// @note The denominators of the masked out cases are replaced, so that no
+/// lane divides by zero.
+/// @note The solutions are sorted. If there is only one solution, the larger
+/// value is invalid, if there is no solution, both are.
+template <concepts::scalar scalar_t>
+class branchless_quadratic_equation {
+    public:
+    /// Number of solutions: int for scalar types, otherwise a vector type, so
+    /// that the masks can be applied to it
+    using count_type =
+        std::conditional_t<std::is_arithmetic_v<scalar_t>, int, scalar_t>;
+
+    branchless_quadratic_equation() = delete;
+
+    /// Solve the quadratic equation with the coefficients @param a, @param b
+    /// and @param c
+    ///
+    /// @param tolerance threshhold to compare the discrimant against to decide
+    ///                  if we have two separate solutions.
+    DETRAY_HOST_DEVICE
+    constexpr branchless_quadratic_equation(
+        const scalar_t &a, const scalar_t &b, const scalar_t &c,
+        const scalar_t &tolerance = default_tolerance()) {
+
+        const scalar_t zero(0.f);
+        const scalar_t one(1.f);
+
+        const auto is_quadratic = (math::fabs(a) > tolerance);
+        const auto is_linear = !is_quadratic && (math::fabs(b) > tolerance);
+
+        const scalar_t discriminant{b * b - (4.f * a) * c};
+        const auto two_sol = is_quadratic && (discriminant > tolerance);
+        const auto one_sol =
+            (is_quadratic && !two_sol && (discriminant >= 0.f)) || is_linear;
+
+        // Guard the denominators of the lanes that are not used
+        const scalar_t safe_a{select(is_quadratic, a, one)};
+        const scalar_t safe_b{select(is_linear, b, one)};
+
+        const scalar_t q{
+            -0.5f *
+            (b + math::copysign(
+                     math::sqrt(select(two_sol, discriminant, zero)), b))};
+        const scalar_t safe_q{select(two_sol, q, one)};
+
+        const scalar_t first{q / safe_a};
+        const scalar_t second{c / safe_q};
+        const auto is_sorted = (first < second);
+
+        const scalar_t single{
+            select(is_linear, -c / safe_b, -0.5f * b / safe_a)};
+        const scalar_t invalid{detail::invalid_value<scalar_t>()};
+
+        m_values[0] = select(two_sol, select(is_sorted, first, second),
+                             select(one_sol, single, invalid));
+        m_values[1] =
+            select(two_sol, select(is_sorted, second, first), invalid);
+        m_solutions = select(two_sol, count_type(2),
+                             select(one_sol, count_type(1), count_type(0)));
+    }
+
+    /// Getters for the solution(s)
+    /// @{
+    constexpr const count_type &solutions() const { return m_solutions; }
+    constexpr const scalar_t &smaller() const { return m_values[0]; }
+    constexpr const scalar_t &larger() const { return m_values[1]; }
+    /// @}
+
+    private:
+    /// @returns the default tolerance of the discriminant
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t default_tolerance() {
+        if constexpr (std::is_arithmetic_v<scalar_t>) {
+            return std::numeric_limits<scalar_t>::epsilon();
+        } else {
+            return scalar_t(1e-6f);
+        }
+    }
+
+    /// @returns @param a where @param mask is set, otherwise @param b
+    template <typename value_t, typename mask_t>
+    DETRAY_HOST_DEVICE static constexpr value_t select(const mask_t &mask,
+                                                       const value_t &a,
+                                                       const value_t &b) {
+        if constexpr (std::is_arithmetic_v<value_t>) {
+            // Both values are computed already: compiles to a select
+            return mask ? a : b;
+        } else {
+            value_t result{b};
+            result(mask) = a;
+            return result;
+        }
+    }
+
+    /// Number of solutions of the equation
+    count_type m_solutions = count_type(0);
+    /// The solutions
+    darray<scalar_t, 2> m_values{scalar_t(0.f), scalar_t(0.f)};
+};
+
 template <typename S>
 quadratic_equation(const S a, const S &b, const S &c, const S &tolerance)
     -> quadratic_equation<S>;
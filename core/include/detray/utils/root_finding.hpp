@@ -17,6 +17,8 @@
 
 // System include(s).
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
@@ -254,6 +256,125 @@ DETRAY_HOST_DEVICE inline std::pair<scalar_t, scalar_t> newton_raphson_safe(
     return std::make_pair(s, math::fabs(s - s_prev));
 }
 
+/// @brief Histogram of the number of Newton iterations per root search
+///
+/// The bins count the searches that converged on the fast path after the
+/// respective number of iterations. The last bin counts the searches that
+/// had to fall back to @c newton_raphson_safe .
+///
+/// @note Meant for benchmarking, filling the histogram is not thread-safe
+struct iteration_histogram {
+
+    /// Number of bins, including the fallback bin
+    static constexpr std::size_t n_bins{16u};
+
+    /// Count a search that converged after @param n_iterations
+    DETRAY_HOST_DEVICE
+    constexpr void fill(const std::size_t n_iterations) {
+        ++counts[n_iterations < n_bins - 1u ? n_iterations : n_bins - 2u];
+    }
+
+    /// Count a search that fell back to the safeguarded root finding
+    DETRAY_HOST_DEVICE
+    constexpr void fill_fallback() { ++counts[n_bins - 1u]; }
+
+    /// @returns the number of searches that fell back
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_fallbacks() const { return counts[n_bins - 1u]; }
+
+    /// @returns the total number of searches
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_entries() const {
+        std::size_t n{0u};
+        for (const std::size_t c : counts) {
+            n += c;
+        }
+        return n;
+    }
+
+    darray<std::size_t, n_bins> counts{};
+};
+
+/// @brief Find a root using the pure Newton-Raphson method on a small budget
+///
+/// Meant to polish a good (e.g. analytic) initial guess. Does not bracket the
+/// root and gives up, instead of taking bisection steps.
+///
+/// @param [in] evaluate_func evaluate the function and its derivative
+/// @param [in] s initial guess for the root
+/// @param [in] max_n_tries maximal number of Newton iterations
+/// @param [in] max_path don't consider root if it is too far away
+/// @param [out] n_tries number of iterations that were run
+///
+/// @return pathlength to root and the last step size, invalid if the
+/// iteration did not converge within the budget
+template <concepts::scalar scalar_t, typename function_t>
+DETRAY_HOST_DEVICE inline std::pair<scalar_t, scalar_t> newton_raphson_fast(
+    function_t &evaluate_func, scalar_t s,
+    const scalar_t convergence_tolerance, const std::size_t max_n_tries,
+    const scalar_t max_path, std::size_t &n_tries) {
+
+    constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+
+    n_tries = 0u;
+    while (n_tries < max_n_tries) {
+        const auto [f_s, df_s] = evaluate_func(s);
+
+        if (math::fabs(df_s) == 0.f || !std::isfinite(f_s)) {
+            break;
+        }
+
+        // x_n+1 = x_n - f(s) / f'(s)
+        const scalar_t ds{f_s / df_s};
+        s -= ds;
+        ++n_tries;
+
+        if (!std::isfinite(s) || math::fabs(s) > max_path) {
+            break;
+        }
+        if (math::fabs(ds) <= convergence_tolerance) {
+            return std::make_pair(s, math::fabs(ds));
+        }
+    }
+
+    return std::make_pair(inv, inv);
+}
+
+/// @brief Find a root starting from a good initial guess
+///
+/// Runs the pure Newton-Raphson method for at most @param max_n_fast_tries
+/// iterations and falls back to @c newton_raphson_safe if it does not
+/// converge.
+///
+/// @param hist optional histogram of the number of iterations
+///
+/// @return pathlength to root and the last step size
+template <concepts::scalar scalar_t, typename function_t>
+DETRAY_HOST_DEVICE inline std::pair<scalar_t, scalar_t> newton_raphson_seeded(
+    function_t &evaluate_func, const scalar_t s,
+    const scalar_t convergence_tolerance, const std::size_t max_n_fast_tries,
+    const std::size_t max_n_tries, const scalar_t max_path,
+    iteration_histogram *hist = nullptr) {
+
+    std::size_t n_tries{0u};
+    const auto res = newton_raphson_fast(evaluate_func, s,
+                                         convergence_tolerance,
+                                         max_n_fast_tries, max_path, n_tries);
+
+    if (!detail::is_invalid_value(res.first)) {
+        if (hist) {
+            hist->fill(n_tries);
+        }
+        return res;
+    }
+
+    if (hist) {
+        hist->fill_fallback();
+    }
+    return newton_raphson_safe(evaluate_func, s, convergence_tolerance,
+                               max_n_tries, max_path);
+}
+
 /// @brief Fill an intersection with the result of the root finding
 ///
 /// @param [in] traj the test trajectory that intersects the surface
@@ -14,6 +14,9 @@
 
 // System include(s).
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 
 namespace detray::detail {
@@ -37,6 +40,40 @@ DETRAY_HOST_DEVICE inline void insertion_sort(vector_t<TYPE> &vec) {
     detray::detail::insertion_sort(vec.begin(), vec.end());
 }
 
+/// Insertion sort that moves out-of-order elements by shifting their
+/// predecessors: Needs only a single comparison per element if the range is
+/// already sorted, which makes it the method of choice to repair the order of
+/// an almost sorted range.
+template <std::random_access_iterator RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void repair_sort(RandomIt first, RandomIt last,
+                                           Comp &&comp = Comp()) {
+    if (last - first < 2) {
+        return;
+    }
+
+    for (RandomIt it = first + 1; it != last; ++it) {
+        // Element is already in order: nothing to do
+        if (!comp(*it, *(it - 1))) {
+            continue;
+        }
+
+        auto value = *it;
+        RandomIt hole = it;
+        do {
+            *hole = *(hole - 1);
+            --hole;
+        } while (hole != first && comp(value, *(hole - 1)));
+
+        *hole = value;
+    }
+}
+
+// Function to sort the array
+template <template <typename...> class vector_t, typename TYPE>
+DETRAY_HOST_DEVICE inline void repair_sort(vector_t<TYPE> &vec) {
+    detray::detail::repair_sort(vec.begin(), vec.end());
+}
+
 template <std::random_access_iterator RandomIt, class Comp = std::less<void>>
 DETRAY_HOST_DEVICE inline void selection_sort(RandomIt first, RandomIt last,
                                               Comp &&comp = Comp()) {
@@ -63,4 +100,114 @@ DETRAY_HOST_DEVICE inline void selection_sort(vector_t<TYPE> &vec) {
     detray::detail::selection_sort(vec.begin(), vec.end());
 }
 
+/// Largest number of elements for which a sorting network is generated
+inline constexpr std::size_t max_sorting_network_size{32u};
+
+/// @brief Batcher's odd-even merge sort network for @tparam N elements.
+///
+/// The comparators are generated at compile time for the next power of two
+/// and all comparators that touch an index beyond N are dropped (these would
+/// only compare against padding elements at the end of the range).
+template <std::size_t N>
+struct sorting_network {
+
+    static_assert(N <= max_sorting_network_size,
+                  "Sorting network is too large");
+
+    /// A comparator, which moves the smaller element to index @c lo
+    struct comparator {
+        std::size_t lo{0u};
+        std::size_t hi{0u};
+    };
+
+    /// @returns the number of elements of the padded network
+    static constexpr std::size_t padded_size() {
+        std::size_t p{1u};
+        while (p < N) {
+            p *= 2u;
+        }
+        return p;
+    }
+
+    /// Call @param fn for every comparator of the network in order
+    template <typename function_t>
+    static constexpr void for_each_comparator(function_t &&fn) {
+        constexpr std::size_t n_pad{padded_size()};
+
+        for (std::size_t p = 1u; p < n_pad; p *= 2u) {
+            for (std::size_t k = p; k >= 1u; k /= 2u) {
+                for (std::size_t j = k % p; j + k < n_pad; j += 2u * k) {
+                    for (std::size_t i = 0u; i < k; ++i) {
+                        const std::size_t lo{i + j};
+                        const std::size_t hi{i + j + k};
+                        if (hi < N && lo / (2u * p) == hi / (2u * p)) {
+                            fn(lo, hi);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// @returns the number of comparators
+    static constexpr std::size_t size() {
+        std::size_t n{0u};
+        for_each_comparator([&n](std::size_t, std::size_t) { ++n; });
+        return n;
+    }
+
+    /// @returns the comparators in the order in which they are applied
+    static constexpr auto comparators() {
+        std::array<comparator, size()> comps{};
+        std::size_t n{0u};
+        for_each_comparator([&comps, &n](std::size_t lo, std::size_t hi) {
+            comps[n++] = comparator{lo, hi};
+        });
+        return comps;
+    }
+};
+
+/// Sort the range [first, last) of at most @tparam N elements with a sorting
+/// network.
+///
+/// The sequence of comparisons only depends on N, which makes it branch-free
+/// apart from the check against the length of the range (uniform over the
+/// data) and avoids the divergence of insertion sort on device.
+///
+/// @note the sort is not stable
+template <std::size_t N, std::random_access_iterator RandomIt,
+          class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void network_sort(RandomIt first, RandomIt last,
+                                            Comp &&comp = Comp()) {
+    assert(last - first >= 0);
+    const auto n{static_cast<std::size_t>(last - first)};
+    assert(n <= N);
+
+    if constexpr (N > 1u) {
+        constexpr auto comparators{sorting_network<N>::comparators()};
+
+        for (const auto &c : comparators) {
+            // Comparators behind the end of the range see only padding
+            if (c.hi >= n) {
+                continue;
+            }
+
+            auto &lhs = *(first + static_cast<std::ptrdiff_t>(c.lo));
+            auto &rhs = *(first + static_cast<std::ptrdiff_t>(c.hi));
+
+            const bool do_swap{comp(rhs, lhs)};
+            const auto lo_value = do_swap ? rhs : lhs;
+            const auto hi_value = do_swap ? lhs : rhs;
+            lhs = lo_value;
+            rhs = hi_value;
+        }
+    }
+}
+
+// Function to sort the array
+template <typename TYPE, std::size_t N>
+DETRAY_HOST_DEVICE inline void network_sort(std::array<TYPE, N> &arr) {
+    detray::detail::network_sort<N>(arr.begin(), arr.end());
+}
+
 }  // namespace detray::detail
@@ -143,6 +143,45 @@ std::string demangle_type_name() {
     return std::string{function.substr(start, size)};
 }
 
+/// @returns the name of the enumerator @tparam V without its scope, or an
+/// empty string if @tparam V does not correspond to a named enumerator.
+/// For enumerators that share a value, the first declared name is returned.
+template <auto V>
+requires std::is_enum_v<decltype(V)> std::string get_enum_name() {
+#if defined(__clang__)
+    constexpr std::string_view prefix{"[V = "};
+    constexpr std::string_view suffix{"]"};
+    constexpr std::string_view function{__PRETTY_FUNCTION__};
+#elif defined(__GNUC__)
+    constexpr std::string_view prefix{"with auto V = "};
+    constexpr std::string_view suffix{"; "};
+    constexpr std::string_view function{__PRETTY_FUNCTION__};
+#else
+    // Enumerator names are not available
+    constexpr std::string_view function{""};
+    constexpr std::string_view prefix{""};
+    constexpr std::string_view suffix{""};
+#endif
+
+    const std::size_t start{function.find(prefix)};
+    if (function.empty() || start == std::string_view::npos) {
+        return "";
+    }
+    std::string_view name{function.substr(start + prefix.size())};
+    name = name.substr(0u, name.find(suffix));
+
+    // Values without a name are printed as a cast, e.g. '(ns::id)5'
+    if (name.empty() || name.front() == '(' ||
+        name.find(')') != std::string_view::npos) {
+        return "";
+    }
+
+    // Strip the enum scope
+    const std::size_t pos{name.rfind(':')};
+    return std::string{pos == std::string_view::npos ? name
+                                                     : name.substr(pos + 1u)};
+}
+
 /// @returns the name of a type as string
 /// @tparam T the type
 template <typename T>
@@ -0,0 +1,356 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/memory_report.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Which of the mask, material and acceleration data structure types
+/// in the detector metadata are actually used by a detector instance.
+///
+/// Every type in the metadata adds a case to the type dispatch over the
+/// detector stores (e.g. in the navigation kernels), whether it is filled or
+/// not. The report can be used to generate a reduced metadata, which only
+/// contains the types that occur in a given detector
+/// (@see write_reduced_metadata ).
+struct type_usage_report {
+
+    /// Usage of a single type in one of the detector stores
+    struct record {
+        /// Detector container, i.e. "masks", "material" or "accelerators"
+        std::string container{};
+        /// Type of data in the collection
+        std::string type{};
+        /// Position of the collection in the store
+        std::size_t index{0u};
+        /// Name of the type ID in the metadata (empty if unnamed)
+        std::string id_name{};
+        /// Number of elements in the collection
+        std::size_t n_elements{0u};
+        /// Number of surfaces or volumes that link to the collection
+        std::size_t n_links{0u};
+        /// The type has to remain in the metadata, even if it is not used
+        /// (e.g. the default accelerator or the material slabs that are
+        /// required by the detector builders)
+        bool required{false};
+
+        /// @returns true if the type is linked or required
+        DETRAY_HOST bool is_used() const { return required || n_links > 0u; }
+
+        /// @returns the ID name, or a generic name if the ID is unnamed
+        DETRAY_HOST std::string enumerator() const {
+            return id_name.empty() ? "e_type" + std::to_string(index)
+                                   : id_name;
+        }
+    };
+
+    std::vector<record> records{};
+
+    /// @returns the records of a detector container @param container
+    DETRAY_HOST
+    std::vector<record> get_records(const std::string& container) const {
+        std::vector<record> recs{};
+        for (const record& rec : records) {
+            if (rec.container == container) {
+                recs.push_back(rec);
+            }
+        }
+        return recs;
+    }
+
+    /// @returns the records of all types that can be removed
+    DETRAY_HOST
+    std::vector<record> unused() const {
+        std::vector<record> recs{};
+        for (const record& rec : records) {
+            if (!rec.is_used()) {
+                recs.push_back(rec);
+            }
+        }
+        return recs;
+    }
+
+    /// Print the report
+    DETRAY_HOST
+    friend std::ostream& operator<<(std::ostream& out,
+                                    const type_usage_report& report) {
+
+        out << "\nDetector type usage [id | elements | links]\n"
+            << "----------------------------\n";
+        for (const record& rec : report.records) {
+            out << "  " << std::setw(14) << std::left << rec.container << " "
+                << std::setw(40) << rec.type << " " << std::setw(28)
+                << rec.id_name << " " << rec.index << " | " << rec.n_elements
+                << " | " << rec.n_links
+                << (rec.is_used() ? (rec.n_links == 0u ? " (required)" : "")
+                                  : " (unused)")
+                << "\n";
+        }
+        out << "  Unused types          : " << report.unused().size() << "\n";
+
+        return out;
+    }
+};
+
+namespace detail {
+
+/// @returns the name of the enumerator for the collection @tparam I in the
+/// store @tparam store_t
+template <typename store_t, std::size_t I>
+DETRAY_HOST std::string store_id_name() {
+    return types::get_enum_name<store_t::value_types::to_id(I)>();
+}
+
+/// @returns the short name of the data in the collection @tparam coll_t
+template <typename coll_t>
+DETRAY_HOST std::string usage_type_name() {
+    if constexpr (requires { typename coll_t::allocator_type; }) {
+        return memory_type_name<typename coll_t::value_type>();
+    } else {
+        return memory_type_name<coll_t>();
+    }
+}
+
+/// Add a record for every collection in the multi store @param store to
+/// @param report , with the number of links to each collection given by
+/// @param n_links
+template <typename store_t>
+DETRAY_HOST void add_usage_records(const std::string& container,
+                                   const store_t& store,
+                                   const std::vector<std::size_t>& n_links,
+                                   type_usage_report& report) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (report.records.push_back(
+             {container,
+              usage_type_name<std::remove_cvref_t<decltype(
+                  store.template get<store_t::value_types::to_id(I)>())>>(),
+              I, store_id_name<store_t, I>(),
+              store.template size<store_t::value_types::to_id(I)>(),
+              n_links[I], false}),
+         ...);
+    }
+    (std::make_index_sequence<store_t::n_collections()>{});
+}
+
+/// Count a link @param link to a store with @param n_links.size() collections
+template <typename link_t>
+DETRAY_HOST void count_link(const link_t& link,
+                            std::vector<std::size_t>& n_links) {
+    const auto i{static_cast<std::size_t>(link.id())};
+    // Skips invalid links and the 'none' IDs
+    if (!link.is_invalid_id() && i < n_links.size()) {
+        ++n_links[i];
+    }
+}
+
+/// Mark the record of the type @param id in @param container as required
+template <typename id_t>
+DETRAY_HOST void set_required(const std::string& container, const id_t id,
+                              type_usage_report& report) {
+    for (auto& rec : report.records) {
+        if (rec.container == container &&
+            rec.index == static_cast<std::size_t>(id)) {
+            rec.required = true;
+        }
+    }
+}
+
+}  // namespace detail
+
+/// @returns which of the types in the metadata of the detector @param det are
+/// used by the detector surfaces and volumes
+template <typename detector_t>
+DETRAY_HOST type_usage_report get_type_usage(const detector_t& det) {
+
+    using mask_store_t = typename detector_t::mask_container;
+    using material_store_t = typename detector_t::material_container;
+    using accel_store_t = typename detector_t::accelerator_container;
+
+    std::vector<std::size_t> mask_links(mask_store_t::n_collections(), 0u);
+    std::vector<std::size_t> material_links(material_store_t::n_collections(),
+                                            0u);
+    std::vector<std::size_t> accel_links(accel_store_t::n_collections(), 0u);
+
+    for (const auto& sf : det.surfaces()) {
+        detail::count_link(sf.mask(), mask_links);
+        detail::count_link(sf.material(), material_links);
+    }
+    for (const auto& vol : det.volumes()) {
+        for (std::size_t i = 0u; i < vol.accel_link().size(); ++i) {
+            detail::count_link(vol.accel_link()[i], accel_links);
+        }
+        detail::count_link(vol.material(), material_links);
+    }
+
+    type_usage_report report{};
+
+    detail::add_usage_records("masks", det.mask_store(), mask_links, report);
+    detail::add_usage_records("material", det.material_store(),
+                              material_links, report);
+    detail::add_usage_records("accelerators", det.accelerator_store(),
+                              accel_links, report);
+
+    // Needed by the volume builders and the homogeneous material builders
+    detail::set_required("accelerators", detector_t::accel::id::e_default,
+                         report);
+    if constexpr (requires { detector_t::materials::id::e_slab; }) {
+        detail::set_required("material", detector_t::materials::id::e_slab,
+                             report);
+    }
+
+    return report;
+}
+
+namespace detail {
+
+/// Write the ID enum @param enum_name for the types in @param recs that are
+/// used, followed by the enumerators in @param extra
+DETRAY_HOST inline void write_id_enum(
+    std::ostream& out, const std::string& enum_name,
+    const std::vector<type_usage_report::record>& recs,
+    const std::vector<std::pair<std::string, std::string>>& extra = {}) {
+
+    out << "    enum class " << enum_name << " : std::uint_least8_t {\n";
+    std::size_t id{0u};
+    for (const auto& rec : recs) {
+        if (rec.is_used()) {
+            out << "        " << rec.enumerator() << " = " << id++ << "u,\n";
+        }
+    }
+    for (const auto& [name, value] : extra) {
+        out << "        " << name << " = " << value << ",\n";
+    }
+    out << "    };\n\n";
+}
+
+/// Write the indices of the types in @param recs that are used
+DETRAY_HOST inline void write_used_indices(
+    std::ostream& out, const std::vector<type_usage_report::record>& recs) {
+    for (const auto& rec : recs) {
+        if (rec.is_used()) {
+            out << ", " << rec.index << "u";
+        }
+    }
+}
+
+/// @returns the number of types in @param recs that are used
+DETRAY_HOST inline std::size_t n_used(
+    const std::vector<type_usage_report::record>& recs) {
+    std::size_t n{0u};
+    for (const auto& rec : recs) {
+        n += rec.is_used() ? 1u : 0u;
+    }
+    return n;
+}
+
+}  // namespace detail
+
+/// @brief Generate the header of a reduced detector metadata
+///
+/// Writes the definition of a metadata type @param name to @param out , that
+/// derives from the metadata @param base_name (e.g. "toy_metadata") and only
+/// keeps the types that are used according to @param report . The mask,
+/// material and accelerator IDs are renumbered, while the names of the
+/// remaining IDs are kept, so that the builders and the IO can still find
+/// them. The stores of the reduced metadata are built from the stores of the
+/// base metadata (@see detray/core/detail/pruned_metadata.hpp ), the header
+/// of which has to be included before the generated header.
+///
+/// @note IDs that are aliases of other IDs in the base metadata are not
+/// carried over, only the first declared name of every ID is known.
+DETRAY_HOST inline void write_reduced_metadata(std::ostream& out,
+                                               const type_usage_report& report,
+                                               const std::string& base_name,
+                                               const std::string& name) {
+
+    const auto mask_recs = report.get_records("masks");
+    const auto material_recs = report.get_records("material");
+    const auto accel_recs = report.get_records("accelerators");
+
+    // Name of the default accelerator
+    std::string default_accel{};
+    for (const auto& rec : accel_recs) {
+        if (rec.required && default_accel.empty()) {
+            default_accel = rec.enumerator();
+        }
+    }
+
+    out << "// Generated by detray::write_reduced_metadata from '" << base_name
+        << "'\n\n"
+        << "#pragma once\n\n"
+        << "#include \"detray/core/detail/pruned_metadata.hpp\"\n\n"
+        << "namespace detray {\n\n"
+        << "template <concepts::algebra algebra_t>\n"
+        << "struct " << name << " : public " << base_name << "<algebra_t> {\n\n"
+        << "    using base_type = " << base_name << "<algebra_t>;\n\n";
+
+    // Masks
+    detail::write_id_enum(out, "mask_ids", mask_recs);
+    out << "    template <template <typename...> class vector_t = dvector>\n"
+        << "    using mask_store = detail::pruned_store_t<\n"
+        << "        typename base_type::template mask_store<vector_t>, "
+           "mask_ids";
+    detail::write_used_indices(out, mask_recs);
+    out << ">;\n\n";
+
+    // Material
+    detail::write_id_enum(
+        out, "material_ids", material_recs,
+        {{"e_none", std::to_string(detail::n_used(material_recs)) + "u"}});
+    out << "    template <typename container_t = host_container_types>\n"
+        << "    using material_store = detail::pruned_store_t<\n"
+        << "        typename base_type::template material_store<container_t>, "
+           "material_ids";
+    detail::write_used_indices(out, material_recs);
+    out << ">;\n\n";
+
+    // Surface descriptor
+    out << "    using mask_link =\n"
+        << "        detail::relink_t<typename base_type::mask_link, "
+           "mask_ids>;\n"
+        << "    using material_link =\n"
+        << "        detail::relink_t<typename base_type::material_link, "
+           "material_ids>;\n"
+        << "    using surface_type =\n"
+        << "        surface_descriptor<mask_link, material_link,\n"
+        << "                           typename base_type::transform_link,\n"
+        << "                           typename base_type::nav_link>;\n\n";
+
+    // Accelerators
+    detail::write_id_enum(out, "accel_ids", accel_recs,
+                          {{"e_default", default_accel}});
+    out << "    using object_link_type =\n"
+        << "        dmulti_index<dtyped_index<accel_ids, dindex>,\n"
+        << "                     base_type::geo_objects::e_size>;\n\n"
+        << "    template <typename container_t = host_container_types>\n"
+        << "    using accelerator_store = detail::pruned_store_t<\n"
+        << "        detail::rebind_surface_t<\n"
+        << "            typename base_type::template "
+           "accelerator_store<container_t>,\n"
+        << "            typename base_type::surface_type, surface_type>,\n"
+        << "        accel_ids";
+    detail::write_used_indices(out, accel_recs);
+    out << ">;\n"
+        << "};\n\n"
+        << "}  // namespace detray\n";
+}
+
+}  // namespace detray
@@ -9,7 +9,11 @@
 
 // Project include(s)
 #include "detray/definitions/algebra.hpp"
+#include "detray/detectors/multires_bfield.hpp"
+#include "detray/detectors/rz_bfield.hpp"
 #include "detray/io/covfie/read_bfield.hpp"
+#include "detray/propagator/detail/field_traits.hpp"
+#include "detray/utils/float16.hpp"
 
 // Covfie include(s)
 #include <covfie/core/backend/primitive/constant.hpp>
@@ -20,6 +24,11 @@
 #include <covfie/core/field.hpp>
 #include <covfie/core/vector.hpp>
 
+// System include(s)
+#include <cstdint>
+#include <cstdlib>
+#include <future>
+
 namespace detray::bfield {
 
 /// Constant bfield (host and device)
@@ -47,6 +56,23 @@ using inhom_bknd_nn_t = covfie::backend::affine<
 template <typename T>
 using inhom_field_t = covfie::field<inhom_bknd_t<T>>;
 
+/// Inhomogeneous field with half precision storage (host)
+///
+/// Halves the memory footprint and bandwidth of the field map. The stepper
+/// converts the interpolated field values to single precision.
+using inhom_bknd_fp16_t = inhom_bknd_t<float16>;
+
+using inhom_field_fp16_t = covfie::field<inhom_bknd_fp16_t>;
+
+/// Phi-symmetric field, stored as a 2D map in (r, z) (host and device)
+template <typename T>
+using rz_field_t = rz_field<T>;
+
+/// Multi-resolution field, stored as a coarse 3D map with refined cells where
+/// the field gradients are large (host and device)
+template <typename T>
+using multires_field_t = multires_field<T>;
+
 /// @returns a constant covfie field constructed from the field vector @param B
 template <typename T, concepts::vector3D vector3_t>
 inline const_field_t<T> create_const_field(const vector3_t &B) {
@@ -62,4 +88,63 @@ inline inhom_field_t<T> create_inhom_field() {
                                            : std::getenv("DETRAY_BFIELD_FILE"));
 }
 
+/// @returns a future of the inhomogeneous covfie field, which is read from
+/// the file given by the environment variable DETRAY_BFIELD_FILE in a
+/// separate thread
+template <typename T>
+inline std::future<inhom_field_t<T>> create_inhom_field_async() {
+    return io::read_bfield_async<inhom_field_t<T>>(
+        !std::getenv("DETRAY_BFIELD_FILE") ? ""
+                                           : std::getenv("DETRAY_BFIELD_FILE"));
+}
+
+/// @returns an inhomogeneous covfie field with half precision storage,
+/// converted from the single precision field map given by the environment
+/// variable DETRAY_BFIELD_FILE
+inline inhom_field_fp16_t create_inhom_field_fp16() {
+    return inhom_field_fp16_t{create_inhom_field<float>()};
+}
+
+/// @returns a phi-symmetric field map, which is read from the file given by
+/// the environment variable DETRAY_RZ_BFIELD_FILE
+template <typename T>
+inline rz_field_t<T> create_rz_field() {
+    return io::read_bfield<rz_field_t<T>>(
+        !std::getenv("DETRAY_RZ_BFIELD_FILE")
+            ? ""
+            : std::getenv("DETRAY_RZ_BFIELD_FILE"));
+}
+
+/// @returns a phi-symmetric field map, sampled from the inhomogeneous field
+/// @param field in the plane phi = 0 on the grid @param r_axis x @param z_axis
+template <typename T>
+inline rz_field_t<T> create_rz_field(
+    const inhom_field_t<T> &field, const rz_axis<T> &r_axis,
+    const rz_axis<T> &z_axis, vecmem::memory_resource *mr = nullptr) {
+    return rz_field_t<T>{typename inhom_field_t<T>::view_t{field}, r_axis,
+                         z_axis, mr};
+}
+
+/// @returns a multi-resolution field map, sampled from the inhomogeneous
+/// field @param field on the coarse grid @param grid . Cells, in which the
+/// coarse interpolation deviates by more than @param tolerance from
+/// @param field , are refined by @param refinement in each dimension
+template <typename T>
+inline multires_field_t<T> create_multires_field(
+    const inhom_field_t<T> &field, const field_grid3D<T> &grid,
+    const std::uint32_t refinement, const T tolerance,
+    vecmem::memory_resource *mr = nullptr) {
+    return multires_field_t<T>{typename inhom_field_t<T>::view_t{field}, grid,
+                               refinement, tolerance, mr};
+}
+
 }  // namespace detray::bfield
+
+namespace detray::detail {
+
+/// The covfie constant backend returns the same field vector everywhere
+template <typename T>
+struct is_constant_field<covfie::field_view<bfield::const_bknd_t<T>>>
+    : public std::true_type {};
+
+}  // namespace detray::detail
@@ -0,0 +1,66 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/detectors/default_metadata.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+#include "detray/navigation/accelerators/surface_grid.hpp"
+
+// System include(s)
+#include <cstdint>
+
+namespace detray {
+
+/// Assembles the detector type of the default metadata, with a bounding
+/// volume hierarchy as additional acceleration data structure, e.g. for
+/// irregularly placed modules (@see bvh_builder )
+template <concepts::algebra algebra_t>
+struct bvh_metadata : public default_metadata<algebra_t> {
+
+    using base_type = default_metadata<algebra_t>;
+    using algebra_type = algebra_t;
+    using surface_type = typename base_type::surface_type;
+    using geo_objects = typename base_type::geo_objects;
+
+    /// Acceleration data structures
+    enum class accel_ids : std::uint_least8_t {
+        e_brute_force = 0,     // test all surfaces in a volume (brute force)
+        e_disc_grid = 1,       // e.g. endcap layers
+        e_cylinder2_grid = 2,  // e.g. barrel layers
+        e_irr_disc_grid = 3,
+        e_irr_cylinder2_grid = 4,
+        e_bvh = 5,  // e.g. irregularly placed modules
+        e_default = e_brute_force,
+    };
+
+    /// How a volume links to the accelration data structures
+    using object_link_type =
+        dmulti_index<dtyped_index<accel_ids, dindex>, geo_objects::e_size>;
+
+    /// How to store the acceleration data structures
+    template <typename container_t = host_container_types>
+    using accelerator_store = multi_store<
+        accel_ids, empty_context, dtuple,
+        brute_force_collection<surface_type, container_t>,
+        grid_collection<typename base_type::template disc_sf_grid<
+            surface_type, container_t>>,
+        grid_collection<typename base_type::template cylinder2D_sf_grid<
+            surface_type, container_t>>,
+        grid_collection<typename base_type::template irr_disc_sf_grid<
+            surface_type, container_t>>,
+        grid_collection<typename base_type::template irr_cylinder2D_sf_grid<
+            surface_type, container_t>>,
+        bvh_collection<algebra_type, surface_type, container_t>>;
+};
+
+}  // namespace detray
@@ -0,0 +1,464 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Covfie include(s)
+#include <covfie/core/utility/binary_io.hpp>
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace detray::bfield {
+
+/// Regular 3D grid of a field map: @c n_points grid points per dimension
+/// from @c min to @c max (both included)
+template <typename T>
+struct field_grid3D {
+    darray<T, 3> min{};
+    darray<T, 3> max{};
+    darray<std::uint32_t, 3> n_points{2u, 2u, 2u};
+};
+
+/// @brief Non-owning view of a multi-resolution field map.
+///
+/// The field is stored on a coarse global grid. Cells of the coarse grid in
+/// which the field varies too much to be interpolated from the cell corners
+/// are refined: The region index of the cell points to a block of fine grid
+/// points that spans the cell. On lookup, the coarse cell of the position is
+/// found and the field is interpolated trilinearly in either the coarse grid
+/// or the fine block of the cell. Positions outside of the map are clamped to
+/// its boundary.
+template <typename T>
+struct multires_field_view {
+
+    using output_t = darray<T, 3>;
+
+    /// Region index of cells that are not refined
+    static constexpr std::uint32_t coarse_region{
+        std::numeric_limits<std::uint32_t>::max()};
+
+    /// @returns the interpolated field value at ( @param x, @param y, @param z)
+    DETRAY_HOST_DEVICE
+    output_t at(const T x, const T y, const T z) const {
+
+        const darray<T, 3> pos{x, y, z};
+
+        // Coarse cell and local coordinates in the cell
+        darray<std::uint32_t, 3> cell;
+        darray<T, 3> weights;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            const auto max_u{static_cast<T>(m_sizes[i] - 1u)};
+            T u{(pos[i] - m_min[i]) * m_inv_step[i]};
+            u = u < T{0} ? T{0} : (u > max_u ? max_u : u);
+
+            cell[i] = static_cast<std::uint32_t>(u);
+            cell[i] = cell[i] + 1u < m_sizes[i] ? cell[i] : cell[i] - 1u;
+            weights[i] = u - static_cast<T>(cell[i]);
+        }
+
+        const std::uint32_t region{
+            m_regions[(static_cast<std::size_t>(cell[0]) * (m_sizes[1] - 1u) +
+                       cell[1]) *
+                          (m_sizes[2] - 1u) +
+                      cell[2]]};
+
+        if (region == coarse_region) {
+            return interpolate(m_coarse, m_sizes, cell, weights);
+        }
+
+        // Position in the fine block of the cell
+        const std::uint32_t n_fine{m_refinement + 1u};
+        const darray<std::uint32_t, 3> fine_sizes{n_fine, n_fine, n_fine};
+        const auto max_f{static_cast<T>(m_refinement)};
+
+        darray<std::uint32_t, 3> fine_cell;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            const T f{weights[i] * max_f};
+
+            fine_cell[i] = static_cast<std::uint32_t>(f);
+            fine_cell[i] = fine_cell[i] < m_refinement ? fine_cell[i]
+                                                       : m_refinement - 1u;
+            weights[i] = f - static_cast<T>(fine_cell[i]);
+        }
+
+        const std::size_t block_size{3u * static_cast<std::size_t>(n_fine) *
+                                     n_fine * n_fine};
+
+        return interpolate(m_fine + region * block_size, fine_sizes, fine_cell,
+                           weights);
+    }
+
+    /// Lower edges of the coarse grid
+    darray<T, 3> m_min{};
+    /// Inverse grid spacing of the coarse grid
+    darray<T, 3> m_inv_step{};
+    /// Number of coarse grid points per dimension
+    darray<std::uint32_t, 3> m_sizes{};
+    /// Number of fine cells per dimension in a refined coarse cell
+    std::uint32_t m_refinement{1u};
+    /// The field values on the coarse grid, three components per grid point
+    const T *m_coarse{nullptr};
+    /// Region index (fine block) per coarse cell
+    const std::uint32_t *m_regions{nullptr};
+    /// The field values of the fine blocks, three components per grid point
+    const T *m_fine{nullptr};
+
+    private:
+    /// Trilinear interpolation in the cell @param lower of the grid points
+    /// @param data (row major layout: The last dimension varies fastest)
+    DETRAY_HOST_DEVICE
+    static output_t interpolate(const T *data,
+                                const darray<std::uint32_t, 3> &sizes,
+                                const darray<std::uint32_t, 3> &lower,
+                                const darray<T, 3> &weights) {
+        output_t result{T{0}, T{0}, T{0}};
+        for (unsigned int n = 0u; n < 8u; ++n) {
+            const bool bx{(n & 1u) != 0u};
+            const bool by{(n & 2u) != 0u};
+            const bool bz{(n & 4u) != 0u};
+
+            const std::size_t idx{
+                (static_cast<std::size_t>(lower[0] + (bx ? 1u : 0u)) *
+                     sizes[1] +
+                 lower[1] + (by ? 1u : 0u)) *
+                    sizes[2] +
+                lower[2] + (bz ? 1u : 0u)};
+            const T w{(bx ? weights[0] : T{1} - weights[0]) *
+                      (by ? weights[1] : T{1} - weights[1]) *
+                      (bz ? weights[2] : T{1} - weights[2])};
+
+            for (std::size_t q = 0u; q < 3u; ++q) {
+                result[q] += w * data[3u * idx + q];
+            }
+        }
+
+        return result;
+    }
+};
+
+/// @brief Multi-resolution field map (host and device).
+///
+/// Samples a reference field on a coarse global grid and refines the coarse
+/// cells, in which the trilinear interpolation deviates from the reference
+/// field by more than a given tolerance (e.g. at the solenoid ends or close
+/// to toroid coils). The fine blocks are only stored for the refined cells,
+/// which keeps the interpolation accurate where it is needed, while the
+/// total memory footprint stays close to that of the coarse grid.
+///
+/// The field values can be allocated in any memory resource, e.g. managed
+/// memory, for which the view can be passed to device code directly.
+///
+/// The binary file layout follows the covfie field files, so that the map can
+/// be read with @c io::read_bfield :
+/// covfie magic header | multi-res. header, value width | coarse grid |
+/// refinement, number of fine blocks | coarse values | regions | fine values
+///
+/// @note Can throw exceptions during construction.
+template <typename T>
+class multires_field final {
+
+    public:
+    using view_t = multires_field_view<T>;
+    using grid_t = field_grid3D<T>;
+
+    /// Magic bytes of the multi-resolution field map in the binary file
+    static constexpr std::uint32_t io_magic_header{0xDE7A0301};
+
+    /// Sample the field view @param field on the coarse grid @param grid and
+    /// refine every coarse cell by @param refinement in each dimension, in
+    /// which the interpolation deviates from @param field by more than
+    /// @param tolerance in any field component
+    template <typename field_view_t>
+    multires_field(const field_view_t &field, const grid_t &grid,
+                   const std::uint32_t refinement, const T tolerance,
+                   vecmem::memory_resource *mr = nullptr)
+        : m_grid{grid},
+          m_refinement{refinement},
+          m_coarse{make_values<T>(mr)},
+          m_regions{make_values<std::uint32_t>(mr)},
+          m_fine{make_values<T>(mr)} {
+
+        check_grid();
+        if (m_refinement < 2u) {
+            throw std::invalid_argument(
+                "Refinement of the multi-resolution field map must be at "
+                "least two");
+        }
+
+        const auto &n = m_grid.n_points;
+
+        // Sample the coarse grid
+        m_coarse.resize(3u * n_points());
+        for (std::uint32_t i = 0u; i < n[0]; ++i) {
+            for (std::uint32_t j = 0u; j < n[1]; ++j) {
+                for (std::uint32_t k = 0u; k < n[2]; ++k) {
+                    const std::size_t idx{
+                        (static_cast<std::size_t>(i) * n[1] + j) * n[2] + k};
+                    sample(field, {i, j, k}, {0u, 0u, 0u}, 1u,
+                           m_coarse.data() + 3u * idx);
+                }
+            }
+        }
+
+        // Sample the fine blocks and keep the ones that are needed
+        const std::uint32_t n_fine{m_refinement + 1u};
+        const std::size_t block_size{3u * static_cast<std::size_t>(n_fine) *
+                                     n_fine * n_fine};
+        dvector<T> block(block_size);
+
+        // Compare to the interpolation on the coarse grid only
+        m_regions.resize(n_cells(), view_t::coarse_region);
+        const view_t coarse_view{view()};
+
+        dvector<std::uint32_t> regions(n_cells(), view_t::coarse_region);
+        std::uint32_t n_blocks{0u};
+        for (std::uint32_t i = 0u; i + 1u < n[0]; ++i) {
+            for (std::uint32_t j = 0u; j + 1u < n[1]; ++j) {
+                for (std::uint32_t k = 0u; k + 1u < n[2]; ++k) {
+                    const std::size_t cell_idx{
+                        (static_cast<std::size_t>(i) * (n[1] - 1u) + j) *
+                            (n[2] - 1u) +
+                        k};
+
+                    bool refine{false};
+                    for (std::uint32_t a = 0u; a < n_fine; ++a) {
+                        for (std::uint32_t b = 0u; b < n_fine; ++b) {
+                            for (std::uint32_t c = 0u; c < n_fine; ++c) {
+                                T *value{block.data() +
+                                         3u * ((static_cast<std::size_t>(a) *
+                                                    n_fine +
+                                                b) *
+                                                   n_fine +
+                                               c)};
+                                const auto p = sample(field, {i, j, k},
+                                                      {a, b, c}, m_refinement,
+                                                      value);
+                                const auto interp =
+                                    coarse_view.at(p[0], p[1], p[2]);
+                                for (std::size_t q = 0u; q < 3u; ++q) {
+                                    const T diff{interp[q] - value[q]};
+                                    refine = refine || diff > tolerance ||
+                                             -diff > tolerance;
+                                }
+                            }
+                        }
+                    }
+
+                    if (refine) {
+                        regions[cell_idx] = n_blocks++;
+                        m_fine.insert(m_fine.end(), block.begin(),
+                                      block.end());
+                    }
+                }
+            }
+        }
+        m_regions.assign(regions.begin(), regions.end());
+    }
+
+    /// Construct a field map from the binary input stream @param fs
+    explicit multires_field(std::istream &fs,
+                            vecmem::memory_resource *mr = nullptr)
+        : m_coarse{make_values<T>(mr)},
+          m_regions{make_values<std::uint32_t>(mr)},
+          m_fine{make_values<T>(mr)} {
+
+        using covfie::utility::read_binary;
+
+        if (read_binary<std::uint32_t>(fs) != covfie::utility::MAGIC_HEADER ||
+            read_binary<std::uint32_t>(fs) != io_magic_header) {
+            throw std::invalid_argument("Not a multi-resolution field map");
+        }
+        if (read_binary<std::uint32_t>(fs) != sizeof(T)) {
+            throw std::invalid_argument(
+                "Floating point width of the multi-resolution field map does "
+                "not match");
+        }
+        m_grid.min = read_binary<darray<T, 3>>(fs);
+        m_grid.max = read_binary<darray<T, 3>>(fs);
+        m_grid.n_points = read_binary<darray<std::uint32_t, 3>>(fs);
+        check_grid();
+
+        m_refinement = read_binary<std::uint32_t>(fs);
+        const auto n_blocks{read_binary<std::uint32_t>(fs)};
+
+        const std::uint32_t n_fine{m_refinement + 1u};
+        m_coarse.resize(3u * n_points());
+        m_regions.resize(n_cells());
+        m_fine.resize(3u * static_cast<std::size_t>(n_blocks) * n_fine *
+                      n_fine * n_fine);
+
+        read_values(fs, m_coarse);
+        read_values(fs, m_regions);
+        read_values(fs, m_fine);
+        if (!fs) {
+            throw std::invalid_argument(
+                "Unexpected end of multi-resolution field map");
+        }
+        for (const std::uint32_t region : m_regions) {
+            if (region != view_t::coarse_region && region >= n_blocks) {
+                throw std::invalid_argument(
+                    "Invalid region index in multi-resolution field map: " +
+                    std::to_string(region));
+            }
+        }
+    }
+
+    /// @returns the coarse grid of the map
+    const grid_t &grid() const { return m_grid; }
+
+    /// @returns the number of fine cells per dimension in a refined cell
+    std::uint32_t refinement() const { return m_refinement; }
+
+    /// @returns the number of coarse grid points
+    std::size_t n_points() const {
+        return static_cast<std::size_t>(m_grid.n_points[0]) *
+               m_grid.n_points[1] * m_grid.n_points[2];
+    }
+
+    /// @returns the number of coarse cells
+    std::size_t n_cells() const {
+        return static_cast<std::size_t>(m_grid.n_points[0] - 1u) *
+               (m_grid.n_points[1] - 1u) * (m_grid.n_points[2] - 1u);
+    }
+
+    /// @returns the number of refined coarse cells
+    std::size_t n_refined() const {
+        const std::size_t n_fine{m_refinement + 1u};
+        return m_fine.size() / (3u * n_fine * n_fine * n_fine);
+    }
+
+    /// @returns the size of the field values and region index in bytes
+    std::size_t size() const {
+        return (m_coarse.size() + m_fine.size()) * sizeof(T) +
+               m_regions.size() * sizeof(std::uint32_t);
+    }
+
+    /// @returns a non-owning view of the field
+    view_t view() const {
+        view_t v{};
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            v.m_min[i] = m_grid.min[i];
+            v.m_inv_step[i] = static_cast<T>(m_grid.n_points[i] - 1u) /
+                              (m_grid.max[i] - m_grid.min[i]);
+        }
+        v.m_sizes = m_grid.n_points;
+        v.m_refinement = m_refinement;
+        v.m_coarse = m_coarse.data();
+        v.m_regions = m_regions.data();
+        v.m_fine = m_fine.data();
+
+        return v;
+    }
+
+    /// Write the field map to the binary output stream @param fs
+    void dump(std::ostream &fs) const {
+        write(fs, covfie::utility::MAGIC_HEADER);
+        write(fs, io_magic_header);
+        write(fs, static_cast<std::uint32_t>(sizeof(T)));
+        write(fs, m_grid.min);
+        write(fs, m_grid.max);
+        write(fs, m_grid.n_points);
+        write(fs, m_refinement);
+        write(fs, static_cast<std::uint32_t>(n_refined()));
+        write_values(fs, m_coarse);
+        write_values(fs, m_regions);
+        write_values(fs, m_fine);
+    }
+
+    private:
+    /// @returns an empty value vector in the memory resource @param mr
+    template <typename V>
+    static dvector<V> make_values(vecmem::memory_resource *mr) {
+        return mr == nullptr ? dvector<V>{} : dvector<V>{mr};
+    }
+
+    /// Sample @param field at the fine grid point @param fine of the coarse
+    /// cell @param cell with @param n_sub fine cells per dimension and write
+    /// the field components to @param value
+    ///
+    /// @returns the position of the grid point
+    template <typename field_view_t>
+    darray<T, 3> sample(const field_view_t &field,
+                        const darray<std::uint32_t, 3> &cell,
+                        const darray<std::uint32_t, 3> &fine,
+                        const std::uint32_t n_sub, T *value) const {
+        darray<T, 3> p;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            const T step{(m_grid.max[i] - m_grid.min[i]) /
+                         static_cast<T>(m_grid.n_points[i] - 1u)};
+            p[i] = m_grid.min[i] +
+                   (static_cast<T>(cell[i]) +
+                    static_cast<T>(fine[i]) / static_cast<T>(n_sub)) *
+                       step;
+        }
+
+        const auto b = field.at(p[0], p[1], p[2]);
+        for (std::size_t q = 0u; q < 3u; ++q) {
+            value[q] = static_cast<T>(b[q]);
+        }
+
+        return p;
+    }
+
+    /// Throw, if the coarse grid cannot be interpolated
+    void check_grid() const {
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            if (m_grid.n_points[i] < 2u ||
+                !(m_grid.min[i] < m_grid.max[i])) {
+                throw std::invalid_argument(
+                    "Invalid multi-resolution field map grid: " +
+                    std::to_string(m_grid.n_points[i]) + " points in [" +
+                    std::to_string(m_grid.min[i]) + ", " +
+                    std::to_string(m_grid.max[i]) + "]");
+            }
+        }
+    }
+
+    template <typename V>
+    static void write(std::ostream &fs, const V &value) {
+        fs.write(reinterpret_cast<const char *>(&value), sizeof(V));
+    }
+
+    template <typename V>
+    static void write_values(std::ostream &fs, const dvector<V> &values) {
+        fs.write(reinterpret_cast<const char *>(values.data()),
+                 static_cast<std::streamsize>(values.size() * sizeof(V)));
+    }
+
+    template <typename V>
+    static void read_values(std::istream &fs, dvector<V> &values) {
+        fs.read(reinterpret_cast<char *>(values.data()),
+                static_cast<std::streamsize>(values.size() * sizeof(V)));
+    }
+
+    /// The coarse grid
+    grid_t m_grid{};
+    /// Number of fine cells per dimension in a refined coarse cell
+    std::uint32_t m_refinement{1u};
+    /// The field values on the coarse grid, three components per grid point
+    dvector<T> m_coarse;
+    /// Region index (fine block) per coarse cell
+    dvector<std::uint32_t> m_regions;
+    /// The field values of the fine blocks, three components per grid point
+    dvector<T> m_fine;
+};
+
+}  // namespace detray::bfield
@@ -0,0 +1,361 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+
+// Covfie include(s)
+#include <covfie/core/utility/binary_io.hpp>
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace detray::bfield {
+
+/// Regular axis of an r-z field map: @c n_points grid points from @c min to
+/// @c max (both included)
+template <typename T>
+struct rz_axis {
+    T min{0};
+    T max{0};
+    std::uint32_t n_points{2u};
+};
+
+/// @brief Non-owning view of a phi-symmetric field map in (r, z).
+///
+/// The field is stored as (B_r, B_z) on a regular 2D grid. On lookup, the
+/// position is transformed to (r, z), the neighbouring grid points are
+/// interpolated bilinearly and the radial component is rotated back into the
+/// direction of the position in the transverse plane. Positions outside of
+/// the map are clamped to its boundary.
+template <typename T>
+struct rz_field_view {
+
+    using output_t = darray<T, 3>;
+
+    /// @returns the interpolated field value at ( @param x, @param y, @param z)
+    DETRAY_HOST_DEVICE
+    output_t at(const T x, const T y, const T z) const {
+
+        const T r{math::sqrt(x * x + y * y)};
+        const darray<T, 2> pos{r, z};
+
+        // Local grid coordinates, indices and interpolation weights
+        darray<std::uint32_t, 2> lower;
+        darray<std::uint32_t, 2> upper;
+        darray<T, 2> weights;
+        for (std::size_t i = 0u; i < 2u; ++i) {
+            const auto max_u{static_cast<T>(m_sizes[i] - 1u)};
+            T u{(pos[i] - m_min[i]) * m_inv_step[i]};
+            u = u < T{0} ? T{0} : (u > max_u ? max_u : u);
+
+            lower[i] = static_cast<std::uint32_t>(u);
+            upper[i] = lower[i] + 1u < m_sizes[i] ? lower[i] + 1u : lower[i];
+            weights[i] = u - static_cast<T>(lower[i]);
+        }
+
+        // Row major layout: z varies fastest
+        T b_r{0};
+        T b_z{0};
+        for (unsigned int n = 0u; n < 4u; ++n) {
+            const bool br{(n & 1u) != 0u};
+            const bool bz{(n & 2u) != 0u};
+
+            const std::size_t idx{
+                static_cast<std::size_t>(br ? upper[0] : lower[0]) *
+                    m_sizes[1] +
+                (bz ? upper[1] : lower[1])};
+            const T w{(br ? weights[0] : T{1} - weights[0]) *
+                      (bz ? weights[1] : T{1} - weights[1])};
+
+            b_r += w * m_data[2u * idx];
+            b_z += w * m_data[2u * idx + 1u];
+        }
+
+        // No radial direction on the z-axis
+        if (r == T{0}) {
+            return {T{0}, T{0}, b_z};
+        }
+        const T b_r_over_r{b_r / r};
+
+        return {b_r_over_r * x, b_r_over_r * y, b_z};
+    }
+
+    /// Evaluate the field for a batch of positions in SoA layout
+    /// ( @param x, @param y, @param z ) and write the field components to
+    /// @param bx, @param by and @param bz (@see batched_field )
+    ///
+    /// The batch is processed in chunks: The positions of a chunk are first
+    /// transformed into the grid, which the compiler can vectorize, and the
+    /// grid points are then gathered and interpolated in a second pass.
+    template <typename pos_cont_t, typename field_cont_t>
+    DETRAY_HOST_DEVICE void at_batch(const pos_cont_t &x, const pos_cont_t &y,
+                                     const pos_cont_t &z, field_cont_t &bx,
+                                     field_cont_t &by,
+                                     field_cont_t &bz) const {
+
+        constexpr std::size_t chunk_size{16u};
+
+        const std::size_t n{x.size()};
+        for (std::size_t first = 0u; first < n; first += chunk_size) {
+            const std::size_t n_chunk{
+                n - first < chunk_size ? n - first : chunk_size};
+
+            // Grid point, offset to the next grid point and weight per dim.
+            darray<T, chunk_size> r;
+            darray<darray<std::uint32_t, chunk_size>, 2> lower;
+            darray<darray<std::uint32_t, chunk_size>, 2> step;
+            darray<darray<T, chunk_size>, 2> weights;
+
+            for (std::size_t l = 0u; l < n_chunk; ++l) {
+                const T xl{x[first + l]};
+                const T yl{y[first + l]};
+                r[l] = math::sqrt(xl * xl + yl * yl);
+            }
+            for (std::size_t i = 0u; i < 2u; ++i) {
+                const auto max_u{static_cast<T>(m_sizes[i] - 1u)};
+                for (std::size_t l = 0u; l < n_chunk; ++l) {
+                    const T pos{i == 0u ? r[l] : static_cast<T>(z[first + l])};
+                    T u{(pos - m_min[i]) * m_inv_step[i]};
+                    u = u < T{0} ? T{0} : (u > max_u ? max_u : u);
+
+                    lower[i][l] = static_cast<std::uint32_t>(u);
+                    step[i][l] = lower[i][l] + 1u < m_sizes[i] ? 1u : 0u;
+                    weights[i][l] = u - static_cast<T>(lower[i][l]);
+                }
+            }
+
+            for (std::size_t l = 0u; l < n_chunk; ++l) {
+                const T *p00{m_data +
+                             2u * (static_cast<std::size_t>(lower[0][l]) *
+                                       m_sizes[1] +
+                                   lower[1][l])};
+                const T *p01{p00 + 2u * step[1][l]};
+                const T *p10{p00 + 2u * step[0][l] * m_sizes[1]};
+                const T *p11{p10 + 2u * step[1][l]};
+
+                const T wr{weights[0][l]};
+                const T wz{weights[1][l]};
+                const T b_r{(T{1} - wr) * ((T{1} - wz) * p00[0] + wz * p01[0]) +
+                            wr * ((T{1} - wz) * p10[0] + wz * p11[0])};
+                const T b_z{(T{1} - wr) * ((T{1} - wz) * p00[1] + wz * p01[1]) +
+                            wr * ((T{1} - wz) * p10[1] + wz * p11[1])};
+
+                // No radial direction on the z-axis
+                const T b_r_over_r{r[l] == T{0} ? T{0} : b_r / r[l]};
+
+                bx[first + l] = b_r_over_r * x[first + l];
+                by[first + l] = b_r_over_r * y[first + l];
+                bz[first + l] = b_z;
+            }
+        }
+    }
+
+    /// Lower edges of the map in r and z
+    darray<T, 2> m_min{};
+    /// Inverse grid spacing in r and z
+    darray<T, 2> m_inv_step{};
+    /// Number of grid points in r and z
+    darray<std::uint32_t, 2> m_sizes{};
+    /// The field values, (B_r, B_z) per grid point
+    const T *m_data{nullptr};
+};
+
+/// @brief Phi-symmetric field map in (r, z) (host and device).
+///
+/// Stores only the radial and longitudinal field components on a 2D grid, so
+/// that a solenoid field needs orders of magnitude less memory than the 3D
+/// Cartesian map of @c bfield::inhom_bknd_t . The field values can be
+/// allocated in any memory resource, e.g. managed memory, for which the view
+/// can be passed to device code directly.
+///
+/// The binary file layout follows the covfie field files, so that the map can
+/// be read with @c io::read_bfield :
+/// covfie magic header | r-z header, value width | r axis | z axis | values
+///
+/// @note Can throw exceptions during construction.
+template <typename T>
+class rz_field final {
+
+    public:
+    using view_t = rz_field_view<T>;
+    using axis_t = rz_axis<T>;
+
+    /// Magic bytes of the r-z field map in the binary file
+    static constexpr std::uint32_t io_magic_header{0xDE7A0201};
+
+    /// Construct a field map with all values zero from the axes @param r_axis
+    /// and @param z_axis
+    rz_field(const axis_t &r_axis, const axis_t &z_axis,
+             vecmem::memory_resource *mr = nullptr)
+        : m_r_axis{r_axis}, m_z_axis{z_axis}, m_values{make_values(mr)} {
+        check_axes();
+        m_values.resize(2u * n_points(), T{0});
+    }
+
+    /// Construct a field map from the binary input stream @param fs
+    explicit rz_field(std::istream &fs, vecmem::memory_resource *mr = nullptr)
+        : m_values{make_values(mr)} {
+
+        if (covfie::utility::read_binary<std::uint32_t>(fs) !=
+                covfie::utility::MAGIC_HEADER ||
+            covfie::utility::read_binary<std::uint32_t>(fs) !=
+                io_magic_header) {
+            throw std::invalid_argument("Not an r-z field map");
+        }
+        if (covfie::utility::read_binary<std::uint32_t>(fs) != sizeof(T)) {
+            throw std::invalid_argument(
+                "Floating point width of the r-z field map does not match");
+        }
+        read_axis(fs, m_r_axis);
+        read_axis(fs, m_z_axis);
+        check_axes();
+
+        m_values.resize(2u * n_points());
+        fs.read(reinterpret_cast<char *>(m_values.data()),
+                static_cast<std::streamsize>(m_values.size() * sizeof(T)));
+        if (!fs) {
+            throw std::invalid_argument("Unexpected end of r-z field map");
+        }
+    }
+
+    /// Sample the field view @param field in the plane phi = 0 at the grid
+    /// points given by @param r_axis and @param z_axis
+    template <typename field_view_t>
+    rz_field(const field_view_t &field, const axis_t &r_axis,
+             const axis_t &z_axis, vecmem::memory_resource *mr = nullptr)
+        : rz_field(r_axis, z_axis, mr) {
+
+        for (std::uint32_t i = 0u; i < m_r_axis.n_points; ++i) {
+            for (std::uint32_t j = 0u; j < m_z_axis.n_points; ++j) {
+                const auto b = field.at(grid_point(m_r_axis, i), T{0},
+                                        grid_point(m_z_axis, j));
+                set(i, j, static_cast<T>(b[0]), static_cast<T>(b[2]));
+            }
+        }
+    }
+
+    /// Set the field components @param b_r and @param b_z at the grid point
+    /// ( @param i_r, @param i_z )
+    void set(const std::uint32_t i_r, const std::uint32_t i_z, const T b_r,
+             const T b_z) {
+        const std::size_t idx{static_cast<std::size_t>(i_r) *
+                                  m_z_axis.n_points +
+                              i_z};
+        m_values.at(2u * idx) = b_r;
+        m_values.at(2u * idx + 1u) = b_z;
+    }
+
+    /// @returns the axes of the map
+    /// @{
+    const axis_t &r_axis() const { return m_r_axis; }
+    const axis_t &z_axis() const { return m_z_axis; }
+    /// @}
+
+    /// @returns the number of grid points
+    std::size_t n_points() const {
+        return static_cast<std::size_t>(m_r_axis.n_points) *
+               m_z_axis.n_points;
+    }
+
+    /// @returns the size of the field values in bytes
+    std::size_t size() const { return m_values.size() * sizeof(T); }
+
+    /// @returns a non-owning view of the field
+    view_t view() const {
+        view_t v{};
+        v.m_min = {m_r_axis.min, m_z_axis.min};
+        v.m_inv_step = {inv_step(m_r_axis), inv_step(m_z_axis)};
+        v.m_sizes = {m_r_axis.n_points, m_z_axis.n_points};
+        v.m_data = m_values.data();
+
+        return v;
+    }
+
+    /// Write the field map to the binary output stream @param fs
+    void dump(std::ostream &fs) const {
+        write(fs, covfie::utility::MAGIC_HEADER);
+        write(fs, io_magic_header);
+        write(fs, static_cast<std::uint32_t>(sizeof(T)));
+        write_axis(fs, m_r_axis);
+        write_axis(fs, m_z_axis);
+        fs.write(reinterpret_cast<const char *>(m_values.data()),
+                 static_cast<std::streamsize>(m_values.size() * sizeof(T)));
+    }
+
+    private:
+    /// @returns an empty value vector in the memory resource @param mr
+    static dvector<T> make_values(vecmem::memory_resource *mr) {
+        return mr == nullptr ? dvector<T>{} : dvector<T>{mr};
+    }
+
+    /// @returns the position of the grid point @param i on @param axis
+    static T grid_point(const axis_t &axis, const std::uint32_t i) {
+        return axis.min + static_cast<T>(i) * (axis.max - axis.min) /
+                              static_cast<T>(axis.n_points - 1u);
+    }
+
+    /// @returns the inverse grid spacing of @param axis
+    static T inv_step(const axis_t &axis) {
+        return static_cast<T>(axis.n_points - 1u) / (axis.max - axis.min);
+    }
+
+    /// Throw, if the axes cannot be interpolated
+    void check_axes() const {
+        for (const axis_t *axis : {&m_r_axis, &m_z_axis}) {
+            if (axis->n_points < 2u || !(axis->min < axis->max)) {
+                throw std::invalid_argument(
+                    "Invalid r-z field map axis: " +
+                    std::to_string(axis->n_points) + " points in [" +
+                    std::to_string(axis->min) + ", " +
+                    std::to_string(axis->max) + "]");
+            }
+        }
+        if (m_r_axis.min < T{0}) {
+            throw std::invalid_argument(
+                "Negative radius in r-z field map axis");
+        }
+    }
+
+    template <typename V>
+    static void write(std::ostream &fs, const V &value) {
+        fs.write(reinterpret_cast<const char *>(&value), sizeof(V));
+    }
+
+    static void read_axis(std::istream &fs, axis_t &axis) {
+        axis.min = covfie::utility::read_binary<T>(fs);
+        axis.max = covfie::utility::read_binary<T>(fs);
+        axis.n_points = covfie::utility::read_binary<std::uint32_t>(fs);
+    }
+
+    static void write_axis(std::ostream &fs, const axis_t &axis) {
+        write(fs, axis.min);
+        write(fs, axis.max);
+        write(fs, axis.n_points);
+    }
+
+    /// The axes in r and z
+    axis_t m_r_axis{};
+    axis_t m_z_axis{};
+    /// The field values, (B_r, B_z) per grid point
+    dvector<T> m_values;
+};
+
+}  // namespace detray::bfield
@@ -48,4 +48,15 @@ concept writer_backend = requires(const W wb, D det,
     ->std::same_as<typename W::payload_type>;
 };
 
+/// Concept for detray io writer backends that can convert a detector volume
+/// by volume
+template <typename D, typename W>
+concept volume_writer_backend = writer_backend<D, W> &&
+    requires(const W wb, D det, typename D::name_map names,
+             typename D::volume_type vol_desc) {
+
+    { W::volume_to_payload(det, names, vol_desc) }
+    ->std::same_as<typename W::payload_type>;
+};
+
 }  // namespace detray::io::concepts
@@ -44,16 +44,18 @@ inline typed_link_payload<type_id> to_payload(const type_id id,
 }
 
 /// Convert the common header information using the detector name
-/// @param det_name and the file tag @param tag that describes the data file
-/// content
+/// @param det_name, the file tag @param tag that describes the data file
+/// content and the detector content hash @param det_hash
 inline common_header_payload to_payload(const std::string_view det_name,
-                                        const std::string_view tag) {
+                                        const std::string_view tag,
+                                        const std::string_view det_hash = {}) {
     common_header_payload header_data;
 
     header_data.version = io::detail::get_detray_version();
     header_data.detector = det_name;
     header_data.tag = tag;
     header_data.date = io::detail::get_current_date();
+    header_data.hash = det_hash;
 
     return header_data;
 }
@@ -14,12 +14,14 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/io/backend/detail/basic_converter.hpp"
 #include "detray/io/backend/detail/type_info.hpp"
+#include "detray/io/binary/binary_io.hpp"
 #include "detray/io/frontend/payloads.hpp"
 #include "detray/utils/ranges.hpp"
 #include "detray/utils/type_list.hpp"
 
 // System include(s)
 #include <algorithm>
+#include <cstring>
 #include <queue>
 #include <stdexcept>
 #include <string>
@@ -28,6 +30,17 @@
 
 namespace detray::io::detail {
 
+/// Grid payload that holds the bins in their memory layout, instead of
+/// entry by entry (e.g. from a binary grid file)
+template <typename grid_data_t>
+concept raw_grid_payload = requires(const grid_data_t &g) {
+    g.link_id;
+    g.bin_size;
+    g.bin_signature;
+    g.n_bins;
+    g.bin_data;
+};
+
 /// @brief Grid reader backend utility
 ///
 /// @tparam value_t bin entry type
@@ -54,11 +67,12 @@ class grid_reader {
 
     public:
     /// Convert the detector grids @param grids_data from their IO payload
-    template <typename detector_t, typename content_t, typename grid_id_t>
+    /// (@c detector_grids_payload or a payload with raw bin data)
+    template <typename detector_t, typename grids_payload_t>
     static void from_payload(
         detector_builder<typename detector_t::metadata, volume_builder>
             &det_builder,
-        const detector_grids_payload<content_t, grid_id_t> &grids_data) {
+        const grids_payload_t &grids_data) {
 
         // Convert the grids volume by volume
         for (const auto &[_, grid_data_coll] : grids_data.grids) {
@@ -74,8 +88,14 @@ class grid_reader {
                 }
 
                 // Don't start at zero, since that is the brute force method
+                auto link_id{static_cast<dindex>(i + 1u)};
+                if constexpr (raw_grid_payload<
+                                  std::remove_cvref_t<decltype(grid_data)>>) {
+                    link_id = static_cast<dindex>(grid_data.link_id);
+                }
+
                 from_payload<detector_t>(bounds, binnings,
-                                         std::make_pair(i + 1, grid_data),
+                                         std::make_pair(link_id, grid_data),
                                          det_builder);
             }
         }
@@ -202,10 +222,10 @@ class grid_reader {
     /// @param grid_data grid IO payload (read from file)
     /// @param det_builder gather the grid data and build the final volume
     template <typename detector_t, typename bounds_ts, typename binning_ts,
-              typename content_t>
+              typename grid_data_t>
         requires(types::size<bounds_ts> == dim) &&
         (types::size<binning_ts> == dim) static void from_payload(
-            const std::pair<dindex, grid_payload<content_t>> &grid_data,
+            const std::pair<dindex, grid_data_t> &grid_data,
             detector_builder<typename detector_t::metadata, volume_builder>
                 &det_builder) {
 
@@ -281,11 +301,12 @@ class grid_reader {
     }
 
     /// @brief End of recursion: build the grid from the @param grid_data
-    template <typename detector_t, typename local_frame_t, typename content_t,
-              typename... bounds_ts, typename... binning_ts>
+    template <typename detector_t, typename local_frame_t,
+              typename grid_data_t, typename... bounds_ts,
+              typename... binning_ts>
         requires(sizeof...(bounds_ts) == dim) &&
         (sizeof...(binning_ts) == dim) static void from_payload(
-            const std::pair<dindex, grid_payload<content_t>> &grid_idx_and_data,
+            const std::pair<dindex, grid_data_t> &grid_idx_and_data,
             detector_builder<typename detector_t::metadata, volume_builder>
                 &det_builder,
             types::list<bounds_ts...>, types::list<binning_ts...>) {
@@ -351,9 +372,19 @@ class grid_reader {
             std::vector<std::pair<typename grid_t::loc_bin_index, dindex>>
                 capacities{};
 
-            // If the grid has dynamic bin capacities, find them
-            if constexpr (std::is_same_v<typename grid_t::bin_type,
-                                         bins::dynamic_array<value_t>>) {
+            if constexpr (raw_grid_payload<grid_data_t>) {
+                // The raw bin data can only be copied for static capacities
+                if constexpr (concepts::dynamic_bin<
+                                  typename grid_t::bin_type> ||
+                              !std::is_trivially_copyable_v<
+                                  typename grid_t::bin_type>) {
+                    err_stream << "Raw bin data requires a grid type with "
+                               << "static bin capacity";
+                    throw std::invalid_argument(err_stream.str());
+                }
+            } else if constexpr (concepts::dynamic_bin<
+                                     typename grid_t::bin_type>) {
+                // If the grid has dynamic bin capacities, find them
                 axis::multi_bin<dim> mbin;
                 for (const auto &bin_data : grid_data.bins) {
                     assert(
@@ -376,36 +407,53 @@ class grid_reader {
             auto &grid = vgr_builder->get();
             const std::size_t n_bins{grid.nbins()};
 
-            value_t entry{};
-            axis::multi_bin<dim> mbin;
-            for (const auto &bin_data : grid_data.bins) {
-
-                // The local bin indices for the bin to be filled
-                for (const auto &[i, bin_idx] :
-                     detray::views::enumerate(bin_data.loc_index)) {
-                    mbin[i] = bin_idx;
-                }
-
-                const auto gbin = grid.serializer()(grid.axes(), mbin);
-                if (gbin >= n_bins) {
-                    err_stream << "Bin index " << mbin << " out of bounds";
+            if constexpr (raw_grid_payload<grid_data_t>) {
+                // The raw bins hold the volume local surface indices
+                if (grid_data.bin_size != sizeof(bin_t) ||
+                    grid_data.bin_signature !=
+                        binary_type_signature<bin_t>() ||
+                    grid_data.n_bins != n_bins) {
+                    err_stream << "Raw bin data does not match the grid type";
                     throw std::invalid_argument(err_stream.str());
                 }
+                // Copy all bins at once
+                if (n_bins > 0u) {
+                    std::memcpy(static_cast<void *>(&(*grid.bins().begin())),
+                                grid_data.bin_data, n_bins * sizeof(bin_t));
+                }
+            } else {
+                value_t entry{};
+                axis::multi_bin<dim> mbin;
+                for (const auto &bin_data : grid_data.bins) {
 
-                // For now assume surfaces ids as the only grid input
-                for (const auto c : bin_data.content) {
-                    if (detray::detail::is_invalid_value(
-                            static_cast<dindex>(c))) {
-                        std::cout << "WARNING: Encountered invalid surface "
-                                  << "index in grid (" << err_stream.str()
-                                  << ")" << std::endl;
-                        continue;
+                    // The local bin indices for the bin to be filled
+                    for (const auto &[i, bin_idx] :
+                         detray::views::enumerate(bin_data.loc_index)) {
+                        mbin[i] = bin_idx;
+                    }
+
+                    const auto gbin = grid.serializer()(grid.axes(), mbin);
+                    if (gbin >= n_bins) {
+                        err_stream << "Bin index " << mbin << " out of bounds";
+                        throw std::invalid_argument(err_stream.str());
+                    }
+
+                    // For now assume surfaces ids as the only grid input
+                    for (const auto c : bin_data.content) {
+                        if (detray::detail::is_invalid_value(
+                                static_cast<dindex>(c))) {
+                            std::cout << "WARNING: Encountered invalid surface "
+                                      << "index in grid (" << err_stream.str()
+                                      << ")" << std::endl;
+                            continue;
+                        }
+                        entry.set_volume(volume_idx);
+                        entry.set_index(static_cast<dindex>(c));
+                        vgr_builder->get().template populate<attach<>>(mbin,
+                                                                       entry);
                     }
-                    entry.set_volume(volume_idx);
-                    entry.set_index(static_cast<dindex>(c));
-                    vgr_builder->get().template populate<attach<>>(mbin, entry);
                 }
-            }
+    }
         } else {
             types::print<types::list<grid_t>>();
             err_stream
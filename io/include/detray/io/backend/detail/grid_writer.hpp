@@ -33,12 +33,13 @@ class grid_writer {
     template <typename grid_store_t>
     static grid_header_payload header_to_payload(
         const std::string_view writer_tag, const grid_store_t& store,
-        const std::string_view det_name) {
+        const std::string_view det_name,
+        const std::string_view det_hash = {}) {
 
         grid_header_payload header_data;
 
         header_data.common =
-            detail::basic_converter::to_payload(det_name, writer_tag);
+            detail::basic_converter::to_payload(det_name, writer_tag, det_hash);
 
         header_data.sub_header.emplace();
         auto& grid_sub_header = header_data.sub_header.value();
@@ -14,6 +14,7 @@
 #include "detray/io/backend/detail/basic_converter.hpp"
 #include "detray/io/backend/detail/type_info.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/io/utils/io_metadata.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // System include(s)
@@ -43,7 +44,8 @@ class geometry_writer {
         const detector_t& det, const std::string_view det_name) {
         geo_header_payload header_data;
 
-        header_data.common = detail::basic_converter::to_payload(det_name, tag);
+        header_data.common = detail::basic_converter::to_payload(
+            det_name, tag, io::detail::get_detector_hash(det));
 
         header_data.sub_header.emplace();
         auto& geo_sub_header = header_data.sub_header.value();
@@ -73,6 +75,22 @@ class geometry_writer {
         return det_data;
     }
 
+    /// Convert the volume @param vol_desc of the detector @param det into a
+    /// detector payload that only holds this volume
+    template <typename detector_t>
+    static payload_type volume_to_payload(
+        const detector_t& det, const typename detector_t::name_map& names,
+        const typename detector_t::volume_type& vol_desc) {
+        payload_type det_data;
+
+        const auto map_itr = names.find(vol_desc.index() + 1u);
+        det_data.volumes.push_back(to_payload(
+            vol_desc, det,
+            map_itr == names.end() ? "" : std::string_view{map_itr->second}));
+
+        return det_data;
+    }
+
     /// Convert a surface transform @param trf into its io payload
     template <typename detector_t>
     static transform_payload to_payload(
@@ -101,8 +119,11 @@ class geometry_writer {
         mask_data.volume_link =
             detail::basic_converter::to_payload(m.volume_link());
 
+        // Only the boundary values (without values derived from them)
         mask_data.boundaries.resize(mask_t::boundaries::e_size);
-        std::ranges::copy(m.values(), std::begin(mask_data.boundaries));
+        std::ranges::copy_n(std::cbegin(m.values()),
+                            mask_t::boundaries::e_size,
+                            std::begin(mask_data.boundaries));
 
         return mask_data;
     }
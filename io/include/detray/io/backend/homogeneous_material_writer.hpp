@@ -15,6 +15,7 @@
 #include "detray/io/backend/detail/basic_converter.hpp"
 #include "detray/io/backend/detail/type_info.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/io/utils/io_metadata.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/utils/type_list.hpp"
@@ -43,7 +44,8 @@ class homogeneous_material_writer {
 
         homogeneous_material_header_payload header_data;
 
-        header_data.common = detail::basic_converter::to_payload(det_name, tag);
+        header_data.common = detail::basic_converter::to_payload(
+            det_name, tag, io::detail::get_detector_hash(det));
 
         const auto& materials = det.material_store();
 
@@ -77,6 +79,18 @@ class homogeneous_material_writer {
         return dm_data;
     }
 
+    /// Convert the material description of the volume @param vol_desc of the
+    /// detector @param det into an io payload that only holds this volume
+    template <class detector_t>
+    static payload_type volume_to_payload(
+        const detector_t& det, const typename detector_t::name_map&,
+        const typename detector_t::volume_type& vol_desc) {
+        payload_type dm_data;
+        dm_data.volumes.push_back(to_payload(vol_desc, det));
+
+        return dm_data;
+    }
+
     /// Convert the material description of a volume @param vol_desc into its
     /// io payload
     template <class detector_t>
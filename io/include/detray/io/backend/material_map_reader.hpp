@@ -69,6 +69,11 @@ class material_map_reader {
                 throw std::invalid_argument(err_stream.str());
             }
 
+            // The material of this volume was not requested
+            if (!det_builder.is_material_volume(static_cast<dindex>(vol_idx))) {
+                continue;
+            }
+
             // Decorate the current volume builder with material maps
             auto vm_builder =
                 det_builder
@@ -12,6 +12,7 @@
 #include "detray/io/backend/detail/type_info.hpp"
 #include "detray/io/backend/homogeneous_material_writer.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/io/utils/io_metadata.hpp"
 #include "detray/materials/material_slab.hpp"
 
 // System include(s)
@@ -44,8 +45,9 @@ class material_map_writer : public detail::grid_writer {
     static auto header_to_payload(const detector_t& det,
                                   const std::string_view det_name) {
 
-        return grid_writer_t::header_to_payload(tag, det.material_store(),
-                                                det_name);
+        return grid_writer_t::header_to_payload(
+            tag, det.material_store(), det_name,
+            io::detail::get_detector_hash(det));
     }
 
     /// Convert the material description of a detector @param det into its io
@@ -53,44 +55,65 @@ class material_map_writer : public detail::grid_writer {
     template <class detector_t>
     static payload_type to_payload(const detector_t& det,
                                    const typename detector_t::name_map&) {
+        payload_type grids_data;
 
-        using material_t = material_slab<typename detector_t::scalar_type>;
+        for (const auto& vol_desc : det.volumes()) {
+            add_volume_maps(det, vol_desc, grids_data);
+        }
+
+        return grids_data;
+    }
 
+    /// Convert the material maps of the volume @param vol_desc of the
+    /// detector @param det into an io payload that only holds this volume
+    template <class detector_t>
+    static payload_type volume_to_payload(
+        const detector_t& det, const typename detector_t::name_map&,
+        const typename detector_t::volume_type& vol_desc) {
         payload_type grids_data;
+        add_volume_maps(det, vol_desc, grids_data);
 
-        for (const auto& vol_desc : det.volumes()) {
+        return grids_data;
+    }
 
-            // Volume local surface indices
-            dindex offset{dindex_invalid};
-
-            /// Check if a surface has a metrial map
-            auto vol = tracking_volume{det, vol_desc};
-            for (const auto& sf_desc : vol.surfaces()) {
-
-                if (sf_desc.index() < offset) {
-                    offset = sf_desc.index();
-                }
-
-                const auto& mat_link = sf_desc.material();
-                // Don't look at empty links
-                if (mat_link.is_invalid() ||
-                    mat_link.id() == detector_t::materials::id::e_none) {
-                    continue;
-                }
-
-                // How to convert a material slab in the grid
-                auto mat_converter = [&sf_desc](const material_t& mat) {
-                    return mat_writer_t::to_payload(mat, sf_desc.index());
-                };
-
-                // Generate the payload
-                grid_writer_t::to_payload(
-                    det.material_store(), mat_link, vol_desc.index(),
-                    sf_desc.index() - offset, grids_data, mat_converter);
+    private:
+    /// Add the material maps of the volume @param vol_desc to
+    /// @param grids_data
+    template <class detector_t>
+    static void add_volume_maps(
+        const detector_t& det, const typename detector_t::volume_type& vol_desc,
+        payload_type& grids_data) {
+
+        using material_t = material_slab<typename detector_t::scalar_type>;
+
+        // Volume local surface indices
+        dindex offset{dindex_invalid};
+
+        /// Check if a surface has a metrial map
+        auto vol = tracking_volume{det, vol_desc};
+        for (const auto& sf_desc : vol.surfaces()) {
+
+            if (sf_desc.index() < offset) {
+                offset = sf_desc.index();
             }
-        }
 
-        return grids_data;
+            const auto& mat_link = sf_desc.material();
+            // Don't look at empty links
+            if (mat_link.is_invalid() ||
+                mat_link.id() == detector_t::materials::id::e_none) {
+                continue;
+            }
+
+            // How to convert a material slab in the grid
+            auto mat_converter = [&sf_desc](const material_t& mat) {
+                return mat_writer_t::to_payload(mat, sf_desc.index());
+            };
+
+            // Generate the payload
+            grid_writer_t::to_payload(
+                det.material_store(), mat_link, vol_desc.index(),
+                sf_desc.index() - offset, grids_data, mat_converter);
+        }
     }
 };
 
@@ -11,6 +11,7 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/io/backend/detail/grid_writer.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/io/utils/io_metadata.hpp"
 
 // System include(s)
 #include <string_view>
@@ -40,8 +41,9 @@ class surface_grid_writer : public detail::grid_writer {
     static auto header_to_payload(const detector_t& det,
                                   const std::string_view det_name) {
 
-        return grid_writer_t::header_to_payload(tag, det.accelerator_store(),
-                                                det_name);
+        return grid_writer_t::header_to_payload(
+            tag, det.accelerator_store(), det_name,
+            io::detail::get_detector_hash(det));
     }
 
     /// Convert the grid collections of a detector @param det into their io
@@ -49,39 +51,59 @@ class surface_grid_writer : public detail::grid_writer {
     template <typename detector_t>
     static payload_type to_payload(const detector_t& det,
                                    const typename detector_t::name_map&) {
-
-        using surface_desc_t = typename detector_t::surface_type;
-
         payload_type grids_data;
 
         for (const auto& vol_desc : det.volumes()) {
-            // Links to all acceleration data structures in the volume
-            const auto& multi_link = vol_desc.accel_link();
-
-            // How to convert the surface descriptors in the grid
-            auto sf_converter = [&vol_desc = std::as_const(vol_desc)](
-                                    const surface_desc_t& sf_desc) {
-                return vol_desc.to_local_sf_index(sf_desc.index());
-            };
-
-            // Start a 1, because the first acceleration structure is always
-            // the brute force method
-            for (dindex i = 1u; i < multi_link.size(); ++i) {
-                const auto& acc_link = multi_link[i];
-                // Don't look at empty links
-                if (acc_link.is_invalid()) {
-                    continue;
-                }
-
-                // Generate the payload
-                grid_writer_t::to_payload(det.accelerator_store(), acc_link,
-                                          vol_desc.index(), vol_desc.index(),
-                                          grids_data, sf_converter);
-            }
+            add_volume_grids(det, vol_desc, grids_data);
         }
 
         return grids_data;
     }
+
+    /// Convert the grids of the volume @param vol_desc of the detector
+    /// @param det into an io payload that only holds this volume
+    template <typename detector_t>
+    static payload_type volume_to_payload(
+        const detector_t& det, const typename detector_t::name_map&,
+        const typename detector_t::volume_type& vol_desc) {
+        payload_type grids_data;
+        add_volume_grids(det, vol_desc, grids_data);
+
+        return grids_data;
+    }
+
+    private:
+    /// Add the grids of the volume @param vol_desc to @param grids_data
+    template <typename detector_t>
+    static void add_volume_grids(
+        const detector_t& det, const typename detector_t::volume_type& vol_desc,
+        payload_type& grids_data) {
+
+        using surface_desc_t = typename detector_t::surface_type;
+
+        // Links to all acceleration data structures in the volume
+        const auto& multi_link = vol_desc.accel_link();
+
+        // How to convert the surface descriptors in the grid
+        auto sf_converter = [&vol_desc](const surface_desc_t& sf_desc) {
+            return vol_desc.to_local_sf_index(sf_desc.index());
+        };
+
+        // Start a 1, because the first acceleration structure is always
+        // the brute force method
+        for (dindex i = 1u; i < multi_link.size(); ++i) {
+            const auto& acc_link = multi_link[i];
+            // Don't look at empty links
+            if (acc_link.is_invalid()) {
+                continue;
+            }
+
+            // Generate the payload
+            grid_writer_t::to_payload(det.accelerator_store(), acc_link,
+                                      vol_desc.index(), vol_desc.index(),
+                                      grids_data, sf_converter);
+        }
+    }
 };
 
 }  // namespace detray::io
@@ -0,0 +1,62 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/frontend/writer_interface.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// System include(s)
+#include <cassert>
+#include <filesystem>
+#include <ios>
+#include <string>
+
+namespace detray::io {
+
+/// @brief Writes the complete detector data into a single flat binary file.
+///
+/// The file can be memory mapped by @c mapped_detector (@see
+/// detray::io::detail::binary_magic for the layout).
+template <class detector_t>
+class binary_detector_writer final : public writer_interface<detector_t> {
+
+    public:
+    /// File gets created with the binary file extension
+    binary_detector_writer() : writer_interface<detector_t>(".bin") {}
+
+    /// Writes the detector to file with a given name
+    std::string write(
+        const detector_t& det, const typename detector_t::name_map& names,
+        const std::ios_base::openmode mode = std::ios::out | std::ios::binary,
+        const std::filesystem::path& file_path = {"./"}) override {
+        // Assert binary output stream
+        assert(((mode == (std::ios_base::out | std::ios_base::binary)) ||
+                (mode == (std::ios_base::out | std::ios_base::trunc |
+                          std::ios_base::binary))) &&
+               "Illegal file mode for binary writer");
+
+        // By convention the name of the detector is the first element
+        std::string det_name = "";
+        if (!names.empty()) {
+            det_name = names.at(0);
+        }
+
+        // Create a new file
+        std::string file_stem{det_name + "_detector"};
+        io::file_handle file{file_path / file_stem, this->file_extension(),
+                             mode};
+
+        detail::write_binary_detector(*file, det.get_data(), names);
+
+        return file_stem + this->file_extension();
+    }
+};
+
+}  // namespace detray::io
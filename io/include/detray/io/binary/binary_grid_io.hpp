@@ -0,0 +1,181 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/frontend/definitions.hpp"
+#include "detray/io/frontend/payloads.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace detray::io::detail {
+
+/// @brief Flat binary layout of the surface grids of a detector
+///
+/// The bins of every grid are written as they are laid out in memory, so
+/// that they can be copied into the bin storage of the new grid at once:
+///
+/// header: magic bytes | version | number of grids
+/// grid:   owner volume | grid type | grid index | link id | dimension |
+///         (bounds | binning | number of bins | number of edges | edges)... |
+///         bin size | bin signature | number of bins | padding | bins
+///
+/// The surface descriptors in the bins hold the surface index local to the
+/// owner volume (like in the json format). Only grids with static bin
+/// capacity can be written.
+/// @{
+/// Magic bytes at the start of a binary grid file ("DGRD")
+inline constexpr std::uint32_t binary_grid_magic{0x44524744u};
+/// Version of the layout
+inline constexpr std::uint32_t binary_grid_version{2u};
+/// @}
+
+/// @brief Payload for a grid in a binary grid file.
+///
+/// The bin data is not copied, but points into the file data in memory.
+struct binary_grid_payload {
+    /// Volume index the grid belongs to
+    single_link_payload owner_link{};
+    /// Type and index of the grid
+    typed_link_payload<io::accel_id> grid_link{};
+    /// Position of the grid in the volume accelerator link
+    std::size_t link_id{0u};
+
+    std::vector<axis_payload> axes{};
+
+    /// Size of a single bin in bytes
+    std::size_t bin_size{0u};
+    /// Layout signature of the bin type (@see binary_type_signature )
+    std::uint64_t bin_signature{0u};
+    /// Number of bins
+    std::size_t n_bins{0u};
+    /// The raw bin data
+    const std::byte *bin_data{nullptr};
+};
+
+/// @brief Payload for the grids in a binary grid file (per volume)
+struct binary_grids_payload {
+    std::map<std::size_t, std::vector<binary_grid_payload>> grids = {};
+};
+
+/// Write the header of a binary grid file for @param n_grids to @param out
+inline void write_binary_grid_header(std::ostream &out,
+                                     const std::size_t n_grids) {
+    write_binary(out, binary_grid_magic);
+    write_binary(out, binary_grid_version);
+    write_binary(out, static_cast<std::uint64_t>(n_grids));
+}
+
+/// Write a grid to @param out
+///
+/// @param owner_idx index of the volume the grid belongs to
+/// @param grid_link the IO type and index of the grid
+/// @param link_id position of the grid in the volume accelerator link
+/// @param axes_data the axes of the grid
+/// @param bins the bin data with volume local surface indices
+template <typename bin_t, typename axes_data_t>
+inline void write_binary_grid(
+    std::ostream &out, const std::size_t owner_idx,
+    const typed_link_payload<io::accel_id> &grid_link,
+    const std::size_t link_id, const axes_data_t &axes_data,
+    const std::vector<bin_t> &bins) {
+    static_assert(std::is_trivially_copyable_v<bin_t>,
+                  "Binary grid format requires static bin capacity");
+
+    write_binary(out, static_cast<std::uint64_t>(owner_idx));
+    write_binary(out, static_cast<std::uint32_t>(grid_link.type));
+    write_binary(out, static_cast<std::uint64_t>(grid_link.index));
+    write_binary(out, static_cast<std::uint64_t>(link_id));
+    write_binary(out, static_cast<std::uint64_t>(axes_data.size()));
+
+    for (const axis_payload &axis_data : axes_data) {
+        write_binary(out, static_cast<std::uint32_t>(axis_data.bounds));
+        write_binary(out, static_cast<std::uint32_t>(axis_data.binning));
+        write_binary(out, static_cast<std::uint64_t>(axis_data.bins));
+        write_binary(out, static_cast<std::uint64_t>(axis_data.edges.size()));
+        for (const real_io edge : axis_data.edges) {
+            write_binary(out, static_cast<double>(edge));
+        }
+    }
+
+    write_binary_view(out, dvector_view<const bin_t>{
+                               static_cast<unsigned int>(bins.size()),
+                               bins.data()});
+}
+
+/// Read the grids from a binary grid file in memory, which is accessed
+/// through @param cur
+///
+/// @returns the grid payloads that point into the file data
+inline binary_grids_payload read_binary_grids(binary_cursor &cur) {
+
+    if (cur.read<std::uint32_t>() != binary_grid_magic) {
+        throw std::runtime_error("Not a binary grid file: " + cur.file_name());
+    }
+    if (const auto version{cur.read<std::uint32_t>()};
+        version != binary_grid_version) {
+        throw std::runtime_error(
+            "Unsupported binary grid file version " + std::to_string(version) +
+            " (expected " + std::to_string(binary_grid_version) +
+            "): " + cur.file_name());
+    }
+
+    binary_grids_payload grids_data{};
+
+    const auto n_grids{cur.read<std::uint64_t>()};
+    for (std::uint64_t i = 0u; i < n_grids; ++i) {
+        binary_grid_payload grid_data{};
+
+        const auto owner_idx{
+            static_cast<std::size_t>(cur.read<std::uint64_t>())};
+        grid_data.owner_link.link = owner_idx;
+        grid_data.grid_link.type =
+            static_cast<io::accel_id>(cur.read<std::uint32_t>());
+        grid_data.grid_link.index =
+            static_cast<std::size_t>(cur.read<std::uint64_t>());
+        grid_data.link_id = static_cast<std::size_t>(cur.read<std::uint64_t>());
+
+        const auto dim{cur.read<std::uint64_t>()};
+        grid_data.axes.resize(dim);
+        for (axis_payload &axis_data : grid_data.axes) {
+            axis_data.bounds =
+                static_cast<axis::bounds>(cur.read<std::uint32_t>());
+            axis_data.binning =
+                static_cast<axis::binning>(cur.read<std::uint32_t>());
+            axis_data.bins =
+                static_cast<std::size_t>(cur.read<std::uint64_t>());
+
+            axis_data.edges.resize(cur.read<std::uint64_t>());
+            for (real_io &edge : axis_data.edges) {
+                edge = static_cast<real_io>(cur.read<double>());
+            }
+        }
+
+        grid_data.bin_size =
+            static_cast<std::size_t>(cur.read<std::uint64_t>());
+        grid_data.bin_signature = cur.read<std::uint64_t>();
+        grid_data.n_bins = static_cast<std::size_t>(cur.read<std::uint64_t>());
+        cur.align();
+        grid_data.bin_data = cur.advance(grid_data.bin_size * grid_data.n_bins);
+
+        grids_data.grids[owner_idx].push_back(std::move(grid_data));
+    }
+
+    return grids_data;
+}
+
+}  // namespace detray::io::detail
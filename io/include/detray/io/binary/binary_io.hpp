@@ -0,0 +1,272 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/utils/detector_hash.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace detray::io::detail {
+
+/// @brief Flat binary layout of a detector
+///
+/// The binary file contains the raw data of all vectors in the detector view
+/// in the order of the view hierarchy, so that it can be memory mapped and
+/// the detector views can be set directly onto the mapped memory:
+///
+/// header: magic bytes | version | number of vectors
+/// names:  number of names | (index | length | characters)...
+/// data:   (element size | element signature | number of elements | padding |
+///          elements)...
+///
+/// The elements of every vector start at a multiple of @c binary_alignment
+/// from the start of the file. The elements are written bitwise, like they are
+/// copied to device memory. The element signature identifies the element type
+/// and its layout (@see binary_type_signature ), so that a file is only mapped
+/// onto the types it was written from.
+/// @{
+/// Magic bytes at the start of a binary detector file ("DTRY")
+inline constexpr std::uint32_t binary_magic{0x59525444u};
+/// Version of the layout: Needs to be increased whenever the layout, or the
+/// data layout of the detector types changes
+inline constexpr std::uint32_t binary_version{3u};
+/// Alignment of the vector data in the file
+inline constexpr std::size_t binary_alignment{64u};
+/// @}
+
+/// @returns the number of vectors in a view type
+/// @{
+template <typename view_t>
+struct binary_vector_count;
+
+template <typename T>
+struct binary_vector_count<dvector_view<T>>
+    : public std::integral_constant<std::size_t, 1u> {};
+
+template <typename... view_ts>
+struct binary_vector_count<dmulti_view<view_ts...>>
+    : public std::integral_constant<
+          std::size_t,
+          (binary_vector_count<std::remove_cv_t<view_ts>>::value + ... + 0u)> {
+};
+/// @}
+
+/// @returns the layout signature of the element type @tparam T
+///
+/// FNV-1a hash of the type name, which names the member types (e.g. the
+/// algebra plugin and the scalar type), together with the size and alignment
+/// of the type.
+///
+/// @note The type name is spelled by the compiler, so files are only
+/// exchanged between builds with the same compiler family.
+template <typename T>
+inline std::uint64_t binary_type_signature() {
+    detray::detail::detector_hasher hasher{};
+    hasher.add_bytes(types::demangle_type_name<std::remove_cv_t<T>>());
+    hasher.add_word(sizeof(T));
+    hasher.add_word(alignof(T));
+
+    return hasher.value();
+}
+
+/// Write the bytes of a trivial value @param v to @param out
+template <typename T>
+inline void write_binary(std::ostream &out, const T &v) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<const char *>(&v), sizeof(T));
+}
+
+/// Pad the output stream @param out to the next aligned position
+inline void write_binary_padding(std::ostream &out) {
+    static constexpr std::array<char, binary_alignment> zeros{};
+
+    const auto pos{static_cast<std::size_t>(out.tellp())};
+    const std::size_t n_pad{(binary_alignment - pos % binary_alignment) %
+                            binary_alignment};
+    out.write(zeros.data(), static_cast<std::streamsize>(n_pad));
+}
+
+/// Write the data of a vector view @param v to @param out
+template <typename T>
+inline void write_binary_view(std::ostream &out, const dvector_view<T> &v) {
+    write_binary(out, static_cast<std::uint64_t>(sizeof(T)));
+    write_binary(out, binary_type_signature<T>());
+    write_binary(out, static_cast<std::uint64_t>(v.size()));
+    write_binary_padding(out);
+    out.write(reinterpret_cast<const char *>(v.ptr()),
+              static_cast<std::streamsize>(v.size() * sizeof(T)));
+}
+
+/// Write the data of a composite view @param v to @param out
+template <typename... view_ts>
+inline void write_binary_view(std::ostream &out,
+                              const dmulti_view<view_ts...> &v) {
+    [&out, &v]<std::size_t... I>(std::index_sequence<I...>) {
+        (write_binary_view(out, detray::detail::get<I>(v.m_view)), ...);
+    }
+    (std::make_index_sequence<sizeof...(view_ts)>{});
+}
+
+/// Write the file header, the name map @param names and the detector data
+/// @param det_view to @param out
+template <typename view_t>
+inline void write_binary_detector(std::ostream &out, const view_t &det_view,
+                                  const std::map<dindex, std::string> &names) {
+
+    write_binary(out, binary_magic);
+    write_binary(out, binary_version);
+    write_binary(out, static_cast<std::uint64_t>(
+                          binary_vector_count<view_t>::value));
+
+    write_binary(out, static_cast<std::uint64_t>(names.size()));
+    for (const auto &[idx, name] : names) {
+        write_binary(out, static_cast<std::uint64_t>(idx));
+        write_binary(out, static_cast<std::uint64_t>(name.size()));
+        out.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+
+    write_binary_view(out, det_view);
+}
+
+/// @brief Reads from a binary detector file in memory
+class binary_cursor {
+
+    public:
+    /// Read @param size bytes starting at @param data from the file
+    /// @param file_name
+    binary_cursor(std::byte *data, const std::size_t size,
+                  const std::string &file_name)
+        : m_data{data}, m_size{size}, m_file_name{file_name} {}
+
+    /// @returns the next value of type @tparam T
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T v{};
+        std::memcpy(&v, advance(sizeof(T)), sizeof(T));
+        return v;
+    }
+
+    /// @returns pointer to the next @param n_bytes and advances past them
+    std::byte *advance(const std::size_t n_bytes) {
+        if (m_offset + n_bytes > m_size) {
+            throw std::runtime_error(
+                "Unexpected end of binary detector file: " + m_file_name);
+        }
+        std::byte *ptr{m_data + m_offset};
+        m_offset += n_bytes;
+        return ptr;
+    }
+
+    /// Skip the padding up to the next aligned position
+    void align() {
+        advance((binary_alignment - m_offset % binary_alignment) %
+                binary_alignment);
+    }
+
+    /// @returns the name of the file
+    const std::string &file_name() const { return m_file_name; }
+
+    private:
+    std::byte *m_data{nullptr};
+    std::size_t m_size{0u};
+    std::size_t m_offset{0u};
+    std::string m_file_name{};
+};
+
+/// @brief Set the views of a detector onto a binary detector file in memory
+/// @{
+template <typename view_t>
+struct binary_view_mapper;
+
+template <typename T>
+struct binary_view_mapper<dvector_view<T>> {
+    static dvector_view<T> map(binary_cursor &cur) {
+        using size_type = typename dvector_view<T>::size_type;
+
+        const auto elem_size{cur.read<std::uint64_t>()};
+        const auto signature{cur.read<std::uint64_t>()};
+        const auto n_elements{cur.read<std::uint64_t>()};
+        if (elem_size != sizeof(T) ||
+            signature != binary_type_signature<T>()) {
+            throw std::runtime_error(
+                "Binary detector file does not match the detector type: " +
+                cur.file_name());
+        }
+        cur.align();
+
+        std::byte *ptr{cur.advance(n_elements * sizeof(T))};
+
+        return dvector_view<T>{static_cast<size_type>(n_elements),
+                               reinterpret_cast<T *>(ptr)};
+    }
+};
+
+template <typename... view_ts>
+struct binary_view_mapper<dmulti_view<view_ts...>> {
+    static dmulti_view<view_ts...> map(binary_cursor &cur) {
+        // The braced initialization evaluates the views in order
+        return dmulti_view<view_ts...>{
+            binary_view_mapper<view_ts>::map(cur)...};
+    }
+};
+/// @}
+
+/// Read the file header and the name map @param names and set the detector
+/// view onto the file data in memory, which is accessed through @param cur
+///
+/// @returns the detector view
+template <typename view_t>
+inline view_t map_binary_detector(binary_cursor &cur,
+                                  std::map<dindex, std::string> &names) {
+
+    if (cur.read<std::uint32_t>() != binary_magic) {
+        throw std::runtime_error("Not a binary detector file: " +
+                                 cur.file_name());
+    }
+    if (const auto version{cur.read<std::uint32_t>()};
+        version != binary_version) {
+        throw std::runtime_error(
+            "Unsupported binary detector file version " +
+            std::to_string(version) + " (expected " +
+            std::to_string(binary_version) + "): " + cur.file_name());
+    }
+    if (cur.read<std::uint64_t>() != binary_vector_count<view_t>::value) {
+        throw std::runtime_error(
+            "Binary detector file does not match the detector type: " +
+            cur.file_name());
+    }
+
+    const auto n_names{cur.read<std::uint64_t>()};
+    for (std::uint64_t i = 0u; i < n_names; ++i) {
+        const auto idx{static_cast<dindex>(cur.read<std::uint64_t>())};
+        const auto length{cur.read<std::uint64_t>()};
+        const auto *chars{reinterpret_cast<const char *>(cur.advance(length))};
+
+        names[idx] = std::string(chars, length);
+    }
+
+    return binary_view_mapper<view_t>::map(cur);
+}
+
+}  // namespace detray::io::detail
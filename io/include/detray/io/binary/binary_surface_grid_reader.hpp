@@ -0,0 +1,84 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/builders/grid_builder.hpp"
+#include "detray/io/backend/detail/grid_reader.hpp"
+#include "detray/io/binary/binary_grid_io.hpp"
+#include "detray/io/frontend/reader_interface.hpp"
+#include "detray/io/utils/mapped_file.hpp"
+
+// System include(s)
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace detray::io {
+
+/// @brief Reads the surface grids of a detector from a flat binary file.
+///
+/// The file is memory mapped and the bins of every grid are copied into the
+/// bin storage of the new grid at once, instead of being filled entry by
+/// entry (@see detray::io::detail::binary_grid_magic for the layout).
+///
+/// @tparam CAP the bin capacity of the grids, must match the file
+/// @tparam DIM the dimension of the grids
+template <class detector_t, std::size_t CAP = 9u, std::size_t DIM = 2u>
+class binary_surface_grid_reader final : public reader_interface<detector_t> {
+
+    using grid_reader_t =
+        detail::grid_reader<typename detector_t::surface_type, grid_builder,
+                            std::integral_constant<std::size_t, CAP>,
+                            std::integral_constant<std::size_t, DIM>>;
+
+    public:
+    /// Tag the reader as "surface_grids"
+    static constexpr std::string_view tag = "surface_grids";
+
+    /// Set binary file extension
+    binary_surface_grid_reader() : reader_interface<detector_t>(".bin") {}
+
+    /// Maps the binary file and reads the grid headers
+    void parse(const std::string& file_name) override {
+        m_file = std::make_unique<mapped_file>(file_name, true);
+
+        detail::binary_cursor cur{m_file->data(), m_file->size(), file_name};
+        m_payload = detail::read_binary_grids(cur);
+    }
+
+    /// Reads the surface grids from file with a given name
+    void read(detector_builder<typename detector_t::metadata, volume_builder>&
+                  det_builder,
+              typename detector_t::name_map&,
+              const std::string& file_name) override {
+
+        // The file might have been parsed already
+        if (!m_payload.has_value()) {
+            parse(file_name);
+        }
+
+        grid_reader_t::template from_payload<detector_t>(det_builder,
+                                                         *m_payload);
+
+        // The bin data has been copied into the grids
+        m_payload.reset();
+        m_file.reset();
+    }
+
+    private:
+    /// The file mapping, which the payload points into
+    std::unique_ptr<mapped_file> m_file{};
+    /// The grid payloads
+    std::optional<detail::binary_grids_payload> m_payload{};
+};
+
+}  // namespace detray::io
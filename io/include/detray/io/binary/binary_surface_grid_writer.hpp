@@ -0,0 +1,151 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/backend/detail/basic_converter.hpp"
+#include "detray/io/backend/detail/grid_writer.hpp"
+#include "detray/io/backend/detail/type_info.hpp"
+#include "detray/io/binary/binary_grid_io.hpp"
+#include "detray/io/frontend/writer_interface.hpp"
+#include "detray/io/utils/file_handle.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+
+// System include(s)
+#include <cassert>
+#include <filesystem>
+#include <ios>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace detray::io {
+
+/// @brief Writes the surface grids of a detector into a flat binary file.
+///
+/// Replaces the json surface grid file, while the other detector components
+/// are written as json (@see detray::io::detail::binary_grid_magic for the
+/// layout).
+template <class detector_t>
+class binary_surface_grid_writer final : public writer_interface<detector_t>,
+                                         public detail::grid_writer {
+
+    public:
+    /// File gets created with the binary file extension
+    binary_surface_grid_writer() : writer_interface<detector_t>(".bin") {}
+
+    /// Writes the surface grids to file with a given name
+    std::string write(
+        const detector_t& det, const typename detector_t::name_map& names,
+        const std::ios_base::openmode mode = std::ios::out | std::ios::binary,
+        const std::filesystem::path& file_path = {"./"}) override {
+        // Assert binary output stream
+        assert(((mode == (std::ios_base::out | std::ios_base::binary)) ||
+                (mode == (std::ios_base::out | std::ios_base::trunc |
+                          std::ios_base::binary))) &&
+               "Illegal file mode for binary writer");
+
+        // By convention the name of the detector is the first element
+        std::string det_name = "";
+        if (!names.empty()) {
+            det_name = names.at(0);
+        }
+
+        // Create a new file
+        std::string file_stem{det_name + "_surface_grids"};
+        io::file_handle file{file_path / file_stem, this->file_extension(),
+                             mode};
+
+        // Count the grids for the header, then write them
+        std::size_t n_grids{0u};
+        visit_grids(det, nullptr, n_grids);
+        detail::write_binary_grid_header(*file, n_grids);
+
+        std::size_t n_written{0u};
+        visit_grids(det, &(*file), n_written);
+        assert(n_written == n_grids);
+
+        return file_stem + this->file_extension();
+    }
+
+    private:
+    /// Call the grid writer on every surface grid in @param det
+    static void visit_grids(const detector_t& det, std::ostream* out,
+                            std::size_t& n_grids) {
+        for (const auto& vol_desc : det.volumes()) {
+            const auto& multi_link = vol_desc.accel_link();
+
+            // Start a 1, because the first acceleration structure is always
+            // the brute force method
+            for (dindex i = 1u; i < multi_link.size(); ++i) {
+                const auto& acc_link = multi_link[i];
+                if (acc_link.is_invalid()) {
+                    continue;
+                }
+                det.accelerator_store().template visit<write_grid>(
+                    acc_link, vol_desc, i, out, n_grids);
+            }
+        }
+    }
+
+    /// Write a grid from a grid collection (only count, if no output stream)
+    struct write_grid {
+
+        template <typename grid_group_t, typename index_t,
+                  typename volume_desc_t>
+        inline void operator()(
+            [[maybe_unused]] const grid_group_t& coll,
+            [[maybe_unused]] const index_t& index,
+            [[maybe_unused]] const volume_desc_t& vol_desc,
+            [[maybe_unused]] const dindex link_id,
+            [[maybe_unused]] std::ostream* out,
+            [[maybe_unused]] std::size_t& n_grids) const {
+
+            using grid_t = typename grid_group_t::value_type;
+
+            if constexpr (detray::concepts::grid<grid_t>) {
+                using bin_t = typename grid_t::bin_type;
+
+                ++n_grids;
+                if (out == nullptr) {
+                    return;
+                }
+
+                if constexpr (std::is_trivially_copyable_v<bin_t>) {
+                    const auto gr = coll[index];
+
+                    // Convert the surface indices to volume local indices
+                    std::vector<bin_t> bins(gr.bins().begin(),
+                                            gr.bins().end());
+                    for (bin_t& bin : bins) {
+                        for (auto& sf_desc : bin) {
+                            sf_desc.set_index(
+                                vol_desc.to_local_sf_index(sf_desc.index()));
+                        }
+                    }
+
+                    const darray<axis_payload, grid_t::dim> axes_data =
+                        grid_writer::to_payload(gr.axes());
+
+                    detail::write_binary_grid(
+                        *out, vol_desc.index(),
+                        detail::basic_converter::to_payload(
+                            io::detail::get_id<grid_t>(), index),
+                        link_id, axes_data, bins);
+                } else {
+                    throw std::invalid_argument(
+                        "Binary grid format requires static bin capacity");
+                }
+            }
+        }
+    };
+};
+
+}  // namespace detray::io
@@ -0,0 +1,79 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/utils/mapped_file.hpp"
+
+// System include(s)
+#include <string>
+
+namespace detray::io {
+
+/// @brief Detector that is memory mapped from a binary detector file (host).
+///
+/// The detector containers are set directly onto the mapped file, without
+/// reading or converting the data. The memory is mapped copy-on-write: Pages
+/// that are never written to are shared between all processes that map the
+/// same file.
+///
+/// @tparam metadata_t the detector metadata, must match the type of the
+///                    detector that was written
+///
+/// @note Can throw exceptions during construction.
+template <typename metadata_t>
+class mapped_detector final {
+
+    public:
+    /// The mapped detector uses non-owning containers
+    using detector_type = detector<metadata_t, device_container_types>;
+    using view_type = typename detector_type::view_type;
+    using name_map = typename detector_type::name_map;
+
+    /// Map the binary detector file @param file_name
+    explicit mapped_detector(const std::string& file_name)
+        : m_file{file_name, true},
+          m_view{map(file_name)},
+          m_detector{m_view} {}
+
+    /// @returns access to the detector
+    detector_type& get() { return m_detector; }
+
+    /// @returns access to the detector - const
+    const detector_type& get() const { return m_detector; }
+
+    /// @returns the view of the mapped detector data
+    view_type get_data() const { return m_view; }
+
+    /// @returns the detector and volume names
+    const name_map& names() const { return m_names; }
+
+    /// @returns the size of the mapping in bytes
+    std::size_t size() const { return m_file.size(); }
+
+    private:
+    /// Set the detector view onto the mapped file @param file_name
+    view_type map(const std::string& file_name) {
+        detail::binary_cursor cur{m_file.data(), m_file.size(), file_name};
+        return detail::map_binary_detector<view_type>(cur, m_names);
+    }
+
+    /// The file mapping
+    mapped_file m_file;
+    /// Detector and volume names
+    name_map m_names{};
+    /// The detector data in the mapped memory
+    view_type m_view;
+    /// The detector
+    detector_type m_detector;
+};
+
+}  // namespace detray::io
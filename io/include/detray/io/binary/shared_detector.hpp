@@ -0,0 +1,128 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/utils/shared_memory.hpp"
+
+// System include(s)
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace detray::io {
+
+/// @brief Read-only detector in a POSIX shared memory segment (host).
+///
+/// The detector data is copied once into a named shared memory segment in
+/// the binary detector layout (@see detray::io::detail::binary_magic ), in
+/// which all vectors are addressed relative to the start of the segment.
+/// Other processes attach to the segment and set the detector containers
+/// directly onto it, so that all processes on a node share one copy of the
+/// detector and skip the detector construction.
+///
+/// The segment is mapped read-only: Writing to the detector faults. The
+/// creating handle owns the segment name, which is removed when it goes out
+/// of scope (attached processes keep their mapping).
+///
+/// @tparam metadata_t the detector metadata, must be the same in all
+///                    processes
+///
+/// @note Can throw exceptions during construction.
+template <typename metadata_t>
+class shared_detector final {
+
+    public:
+    /// The shared detector uses non-owning containers
+    using detector_type = detector<metadata_t, device_container_types>;
+    using view_type = typename detector_type::view_type;
+    using name_map = typename detector_type::name_map;
+
+    /// Copy the detector @param det with the names @param names into the new
+    /// shared memory segment @param segment_name
+    template <typename detector_t>
+    static shared_detector create(const std::string& segment_name,
+                                  const detector_t& det,
+                                  const typename detector_t::name_map& names) {
+        static_assert(
+            std::is_same_v<typename detector_t::metadata, metadata_t>,
+            "Detector metadata does not match");
+
+        std::ostringstream buffer{std::ios::out | std::ios::binary};
+        detail::write_binary_detector(buffer, det.get_data(), names);
+        const std::string data{std::move(buffer).str()};
+
+        auto segment = shared_memory::create(segment_name, data.size());
+        std::memcpy(segment.data(), data.data(), data.size());
+        segment.seal();
+
+        return shared_detector{std::move(segment)};
+    }
+
+    /// Attach to the existing shared memory segment @param segment_name
+    static shared_detector attach(const std::string& segment_name) {
+        return shared_detector{shared_memory::attach(segment_name)};
+    }
+
+    /// Move only (the views point into the mapping, which does not move)
+    /// @{
+    shared_detector(const shared_detector&) = delete;
+    shared_detector& operator=(const shared_detector&) = delete;
+    shared_detector(shared_detector&&) = default;
+    shared_detector& operator=(shared_detector&&) = default;
+    /// @}
+
+    /// @returns access to the detector - const
+    const detector_type& get() const { return m_detector; }
+
+    /// @returns the view of the shared detector data
+    view_type get_data() const { return m_view; }
+
+    /// @returns the detector and volume names
+    const name_map& names() const { return m_names; }
+
+    /// @returns the name of the shared memory segment
+    const std::string& segment_name() const { return m_segment.name(); }
+
+    /// @returns true if this handle created the segment
+    bool is_owner() const { return m_segment.is_owner(); }
+
+    /// @returns the size of the segment in bytes
+    std::size_t size() const { return m_segment.size(); }
+
+    private:
+    /// Set the detector onto the mapped @param segment
+    explicit shared_detector(shared_memory&& segment)
+        : m_segment{std::move(segment)},
+          m_view{map()},
+          m_detector{m_view} {}
+
+    /// Set the detector view onto the segment data
+    view_type map() {
+        // The containers are non-const, but the mapping is read-only
+        detail::binary_cursor cur{m_segment.data(), m_segment.size(),
+                                  m_segment.name()};
+        return detail::map_binary_detector<view_type>(cur, m_names);
+    }
+
+    /// The shared memory segment
+    shared_memory m_segment;
+    /// Detector and volume names
+    name_map m_names{};
+    /// The detector data in the segment
+    view_type m_view;
+    /// The detector
+    detector_type m_detector;
+};
+
+}  // namespace detray::io
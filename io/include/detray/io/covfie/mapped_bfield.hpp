@@ -0,0 +1,215 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/io/covfie/read_bfield.hpp"
+#include "detray/io/utils/mapped_file.hpp"
+
+// Covfie include(s)
+#include <covfie/core/backend/primitive/array.hpp>
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/linear.hpp>
+#include <covfie/core/backend/transformer/strided.hpp>
+#include <covfie/core/utility/binary_io.hpp>
+#include <covfie/core/vector.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace detray::io {
+
+/// @brief Non-owning view of a memory mapped covfie field map.
+///
+/// Evaluates the field like the @c bfield::inhom_bknd_t covfie backend: The
+/// position is transformed into the index space of the map, followed by a
+/// trilinear interpolation of the neighbouring grid points. Positions outside
+/// of the map are clamped to its boundary.
+struct mapped_bfield_view {
+
+    using output_t = darray<float, 3>;
+
+    /// @returns the interpolated field value at ( @param x, @param y, @param z)
+    DETRAY_HOST
+    output_t at(const float x, const float y, const float z) const {
+
+        // Local grid coordinates, indices and interpolation weights
+        darray<std::size_t, 3> lower;
+        darray<std::size_t, 3> upper;
+        darray<float, 3> weights;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            const float u{m_transform[4u * i] * x +
+                          m_transform[4u * i + 1u] * y +
+                          m_transform[4u * i + 2u] * z +
+                          m_transform[4u * i + 3u]};
+            const auto max_u{static_cast<float>(m_sizes[i] - 1u)};
+            const float c{std::clamp(u, 0.f, max_u)};
+
+            lower[i] = static_cast<std::size_t>(std::floor(c));
+            upper[i] = std::min(lower[i] + 1u, m_sizes[i] - 1u);
+            weights[i] = c - static_cast<float>(lower[i]);
+        }
+
+        // Row major layout: The last dimension varies fastest
+        output_t result{0.f, 0.f, 0.f};
+        for (unsigned int n = 0u; n < 8u; ++n) {
+            const bool bx{(n & 1u) != 0u};
+            const bool by{(n & 2u) != 0u};
+            const bool bz{(n & 4u) != 0u};
+
+            const std::size_t idx{
+                ((bx ? upper[0] : lower[0]) * m_sizes[1] +
+                 (by ? upper[1] : lower[1])) *
+                    m_sizes[2] +
+                (bz ? upper[2] : lower[2])};
+            const float w{(bx ? weights[0] : 1.f - weights[0]) *
+                          (by ? weights[1] : 1.f - weights[1]) *
+                          (bz ? weights[2] : 1.f - weights[2])};
+
+            for (std::size_t q = 0u; q < 3u; ++q) {
+                result[q] += w * m_data[3u * idx + q];
+            }
+        }
+
+        return result;
+    }
+
+    /// Affine transformation into the index space (row major 3x4 matrix)
+    darray<float, 12> m_transform{};
+    /// Number of grid points per dimension
+    darray<std::size_t, 3> m_sizes{};
+    /// The field values, three components per grid point
+    const float *m_data{nullptr};
+};
+
+/// @brief Memory mapped covfie field map (host).
+///
+/// Maps a covfie binary file of an inhomogeneous field (@see
+/// bfield::inhom_bknd_t with single precision values) read-only into memory,
+/// instead of deserializing it into an owning covfie field. The field values
+/// are not copied: Processes that map the same file share a single copy in
+/// the page cache and the startup does not have to parse the file.
+///
+/// @note Can throw exceptions during construction.
+class mapped_bfield final {
+
+    public:
+    using view_t = mapped_bfield_view;
+
+    /// Map the covfie file @param file_name
+    explicit mapped_bfield(const std::string &file_name)
+        : m_file{check_file(file_name)} {
+        parse(file_name);
+    }
+
+    /// @returns a non-owning view of the field
+    view_t view() const { return m_view; }
+
+    /// @returns the size of the mapping in bytes
+    std::size_t size() const { return m_file.size(); }
+
+    private:
+    /// @returns @param file_name, throws if it is not a covfie file
+    static const std::string &check_file(const std::string &file_name) {
+        if (!check_covfie_file(file_name)) {
+            throw std::runtime_error("Not a valid covfie file: " + file_name);
+        }
+        return file_name;
+    }
+
+    /// Find the transformation, the grid sizes and the field values in the
+    /// covfie binary layout of @c bfield::inhom_bknd_t :
+    /// field header | affine: header, 3x4 matrix | linear: header |
+    /// strided: header, 3 sizes | array: header, size, values | footers
+    ///
+    /// Every header is compared to the magic bytes that the covfie version
+    /// detray is built against writes for the respective backend, so that
+    /// files of a different backend chain or format version are rejected.
+    void parse(const std::string &file_name) {
+
+        using array_t =
+            covfie::backend::array<covfie::vector::vector_d<float, 3>>;
+        using strided_t =
+            covfie::backend::strided<covfie::vector::vector_d<std::size_t, 3>,
+                                     array_t>;
+        using linear_t = covfie::backend::linear<strided_t>;
+        using affine_t = covfie::backend::affine<linear_t>;
+
+        const std::byte *bytes{m_file.data()};
+        const std::size_t n_bytes{m_file.size()};
+        std::size_t offset{0u};
+
+        auto read = [&]<typename T>(T &value) {
+            if (offset + sizeof(T) > n_bytes) {
+                throw std::runtime_error("Unexpected end of covfie file: " +
+                                         file_name);
+            }
+            std::memcpy(&value, bytes + offset, sizeof(T));
+            offset += sizeof(T);
+        };
+
+        auto check_header = [&](const std::uint32_t expected,
+                                const std::string &name) {
+            std::uint32_t hdr{0u};
+            read(hdr);
+            if (hdr != expected) {
+                throw std::runtime_error("Unsupported covfie " + name +
+                                         " format in file: " + file_name);
+            }
+        };
+
+        check_header(covfie::utility::MAGIC_HEADER, "field");
+        check_header(affine_t::IO_MAGIC_HEADER, "affine backend");
+        read(m_view.m_transform);
+        check_header(linear_t::IO_MAGIC_HEADER, "linear backend");
+        check_header(strided_t::IO_MAGIC_HEADER, "strided backend");
+        read(m_view.m_sizes);
+        check_header(array_t::IO_MAGIC_HEADER, "array backend");
+
+        const std::size_t n_points{m_view.m_sizes[0] * m_view.m_sizes[1] *
+                                   m_view.m_sizes[2]};
+        if (n_points == 0u) {
+            throw std::runtime_error("Empty covfie field map: " + file_name);
+        }
+
+        std::size_t n_values{0u};
+        read(n_values);
+        if (n_values != n_points ||
+            offset + 3u * n_points * sizeof(float) > n_bytes) {
+            throw std::runtime_error(
+                "Not a covfie file of an inhomogeneous field: " + file_name);
+        }
+        if (offset % alignof(float) != 0u) {
+            throw std::runtime_error("Misaligned field values in file: " +
+                                     file_name);
+        }
+
+        m_view.m_data = reinterpret_cast<const float *>(bytes + offset);
+    }
+
+    /// The read-only file mapping
+    mapped_file m_file;
+
+    /// View into the mapped memory
+    view_t m_view{};
+};
+
+/// @brief function that maps a covfie field file into memory
+inline mapped_bfield map_bfield(const std::string &file_name) {
+    return mapped_bfield{file_name};
+}
+
+}  // namespace detray::io
@@ -14,6 +14,8 @@
 #include <covfie/core/utility/binary_io.hpp>
 
 // System include(s)
+#include <functional>
+#include <future>
 #include <ios>
 #include <iostream>
 #include <stdexcept>
@@ -49,4 +51,24 @@ inline bfield_t read_bfield(const std::string& file_name) {
     return bfield_t(*file);
 }
 
+/// @brief Read a covfie field from the file @param file_name in a separate
+/// thread.
+///
+/// Allows to overlap the field reading with other work at startup, e.g.
+/// reading the detector (@see io::read_detector_async ).
+///
+/// @param on_read callable that is run on the field in the reading thread,
+///                e.g. to copy the field to device memory. By default, the
+///                field is returned
+///
+/// @returns a future of the result of @param on_read
+template <typename bfield_t, typename callable_t = std::identity>
+inline auto read_bfield_async(const std::string& file_name,
+                              callable_t on_read = {}) {
+    return std::async(std::launch::async,
+                      [file_name, on_read = std::move(on_read)]() mutable {
+                          return on_read(read_bfield<bfield_t>(file_name));
+                      });
+}
+
 }  // namespace detray::io
@@ -0,0 +1,294 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/csv/columnar.hpp"
+#include "detray/io/csv/dfe.hpp"
+
+// System include(s)
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detray::io::csv {
+
+/// Output formats of the @c async_writer
+enum class output_format {
+    e_csv = 0,
+    e_binary = 1,
+};
+
+/// @brief Writes named tuple records to file in a background thread
+///
+/// The records are collected in blocks by the producers (every producer
+/// thread holds its own @c buffer ) and the full blocks are formatted and
+/// written to disk by a dedicated thread, so that the producers do not wait
+/// for the output. The blocks of a buffer are written in the order they were
+/// filled, while the blocks of different buffers can interleave in the file.
+/// The number of blocks in flight is limited, so that the memory consumption
+/// stays bounded if the disk is slower than the producers.
+///
+/// @note Errors of the background thread are rethrown by @c flush
+template <typename NamedTuple>
+class async_writer {
+
+    public:
+    using record_type = NamedTuple;
+    using block_type = std::vector<record_type>;
+
+    /// @brief Collects the records of a single producer thread
+    class buffer {
+
+        public:
+        buffer() = delete;
+        buffer(const buffer &) = delete;
+        buffer &operator=(const buffer &) = delete;
+
+        buffer(buffer &&other) noexcept
+            : m_writer{std::exchange(other.m_writer, nullptr)},
+              m_block{std::move(other.m_block)} {}
+
+        buffer &operator=(buffer &&other) noexcept {
+            if (this != &other) {
+                release();
+                m_writer = std::exchange(other.m_writer, nullptr);
+                m_block = std::move(other.m_block);
+            }
+            return *this;
+        }
+
+        /// Hand the remaining records to the writer
+        ~buffer() { release(); }
+
+        /// Add the record @param rec to the current block
+        void append(const record_type &rec) {
+            m_block.push_back(rec);
+            if (m_block.size() >= m_writer->m_block_size) {
+                flush();
+            }
+        }
+
+        /// Hand the current block to the writer
+        void flush() {
+            if (!m_block.empty()) {
+                m_writer->submit(std::move(m_block));
+                m_block = m_writer->acquire();
+            }
+        }
+
+        private:
+        friend class async_writer;
+
+        explicit buffer(async_writer *writer)
+            : m_writer{writer}, m_block{writer->acquire()} {}
+
+        /// Submit the remaining records without throwing
+        void release() noexcept {
+            if (m_writer != nullptr && !m_block.empty()) {
+                try {
+                    m_writer->submit(std::move(m_block));
+                } catch (...) {
+                    m_writer->set_error(std::current_exception());
+                }
+            }
+            m_writer = nullptr;
+        }
+
+        async_writer *m_writer{nullptr};
+        block_type m_block{};
+    };
+
+    async_writer() = delete;
+    async_writer(const async_writer &) = delete;
+    async_writer(async_writer &&) = delete;
+    async_writer &operator=(const async_writer &) = delete;
+    async_writer &operator=(async_writer &&) = delete;
+
+    /// Open the file @param path (replaces an existing file)
+    ///
+    /// @param format the output format
+    /// @param block_size number of records per block
+    /// @param max_blocks maximal number of blocks waiting to be written
+    /// @param precision number of digits of floating point values (csv)
+    explicit async_writer(
+        const std::string &path, const output_format format = {},
+        const std::size_t block_size = 4096u,
+        const std::size_t max_blocks = 16u,
+        const int precision = std::numeric_limits<double>::max_digits10)
+        : m_block_size{block_size > 0u ? block_size : 1u},
+          m_max_blocks{max_blocks > 0u ? max_blocks : 1u} {
+
+        if (format == output_format::e_binary) {
+            m_columnar_writer.emplace(path);
+        } else {
+            m_csv_writer.emplace(path, precision);
+        }
+
+        m_thread = std::thread([this]() { run(); });
+    }
+
+    /// Write the outstanding blocks and close the file
+    ~async_writer() { close(); }
+
+    /// @returns a new buffer for a producer thread
+    buffer make_buffer() { return buffer{this}; }
+
+    /// @returns the number of records per block
+    std::size_t block_size() const { return m_block_size; }
+
+    /// Hand a block of records @param block to the background thread
+    ///
+    /// Blocks if too many blocks are waiting to be written.
+    void submit(block_type &&block) {
+        if (block.empty()) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_space.wait(lock, [this]() { return m_queue.size() < m_max_blocks; });
+
+        m_queue.push_back(std::move(block));
+        ++m_n_pending;
+        m_work.notify_one();
+    }
+
+    /// Wait until all submitted blocks are written
+    ///
+    /// @throws the error that occurred in the background thread
+    void flush() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_n_pending == 0u; });
+
+        if (m_error) {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+
+    /// Write the outstanding blocks, stop the thread and close the file
+    void close() noexcept {
+        if (!m_thread.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_work.notify_one();
+        m_thread.join();
+
+        m_csv_writer.reset();
+        m_columnar_writer.reset();
+    }
+
+    private:
+    /// @returns an empty block, reusing the memory of written blocks
+    block_type acquire() {
+        block_type block{};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_free.empty()) {
+                block = std::move(m_free.back());
+                m_free.pop_back();
+            }
+        }
+        block.reserve(m_block_size);
+
+        return block;
+    }
+
+    /// Record the error @param err (the first error is kept)
+    void set_error(std::exception_ptr err) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error) {
+            m_error = std::move(err);
+        }
+    }
+
+    /// Write the blocks in the queue until the writer is closed
+    void run() {
+        while (true) {
+            block_type block{};
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_work.wait(lock,
+                            [this]() { return !m_queue.empty() || m_stop; });
+                if (m_queue.empty()) {
+                    return;
+                }
+                block = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            m_space.notify_one();
+
+            // Skip the output after the first error
+            bool failed{false};
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                failed = static_cast<bool>(m_error);
+            }
+            if (!failed) {
+                try {
+                    write(block);
+                } catch (...) {
+                    set_error(std::current_exception());
+                }
+            }
+
+            block.clear();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_free.push_back(std::move(block));
+                --m_n_pending;
+            }
+            m_done.notify_all();
+        }
+    }
+
+    /// Write the records of the @param block to the file
+    void write(const block_type &block) {
+        if (m_columnar_writer) {
+            m_columnar_writer->append(block);
+        } else {
+            for (const record_type &rec : block) {
+                m_csv_writer->append(rec);
+            }
+        }
+    }
+
+    /// Configuration
+    std::size_t m_block_size;
+    std::size_t m_max_blocks;
+
+    /// The file writers (only one of them is used)
+    std::optional<dfe::NamedTupleCsvWriter<record_type>> m_csv_writer{};
+    std::optional<columnar_writer<record_type>> m_columnar_writer{};
+
+    /// Synchronization with the background thread
+    std::mutex m_mutex{};
+    std::condition_variable m_work{};
+    std::condition_variable m_space{};
+    std::condition_variable m_done{};
+    std::deque<block_type> m_queue{};
+    std::vector<block_type> m_free{};
+    std::size_t m_n_pending{0u};
+    std::exception_ptr m_error{};
+    bool m_stop{false};
+
+    std::thread m_thread{};
+};
+
+}  // namespace detray::io::csv
@@ -0,0 +1,229 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray::io::csv {
+
+/// @brief Binary columnar layout of named tuple records
+///
+/// Alternative to the csv files for large outputs: The records are written in
+/// blocks and every block holds the values of one column contiguously:
+///
+/// header: magic bytes | version | number of columns
+/// names:  (element size | name length | characters)...
+/// blocks: (number of rows | column 0 values | column 1 values | ...)...
+///
+/// All columns of the named tuple need to be arithmetic types.
+/// @{
+/// Magic bytes at the start of a columnar file ("DTCL")
+inline constexpr std::uint32_t columnar_magic{0x4c435444u};
+/// Version of the layout
+inline constexpr std::uint32_t columnar_version{1u};
+/// @}
+
+/// @brief Writes named tuple records to a binary columnar file
+template <typename NamedTuple>
+class columnar_writer {
+
+    using tuple_t = typename NamedTuple::Tuple;
+
+    static constexpr std::size_t n_columns{std::tuple_size_v<tuple_t>};
+
+    public:
+    columnar_writer() = delete;
+    columnar_writer(const columnar_writer &) = delete;
+    columnar_writer(columnar_writer &&) = default;
+    columnar_writer &operator=(const columnar_writer &) = delete;
+    columnar_writer &operator=(columnar_writer &&) = default;
+
+    /// Open the file @param path and write the header (replaces the file)
+    explicit columnar_writer(const std::string &path)
+        : m_file(path, std::ios_base::binary | std::ios_base::out |
+                           std::ios_base::trunc) {
+        if (!m_file.is_open() || m_file.fail()) {
+            throw std::runtime_error("Could not open file '" + path + "'");
+        }
+
+        write_value(columnar_magic);
+        write_value(columnar_version);
+        write_value(static_cast<std::uint64_t>(n_columns));
+
+        const auto names = NamedTuple::names();
+        [this, &names]<std::size_t... I>(std::index_sequence<I...>) {
+            (write_column_name<I>(names[I]), ...);
+        }
+        (std::make_index_sequence<n_columns>{});
+
+        check();
+    }
+
+    /// Append the @param records to the file as one block
+    void append(const std::vector<NamedTuple> &records) {
+        if (records.empty()) {
+            return;
+        }
+
+        write_value(static_cast<std::uint64_t>(records.size()));
+
+        [this, &records]<std::size_t... I>(std::index_sequence<I...>) {
+            (write_column<I>(records), ...);
+        }
+        (std::make_index_sequence<n_columns>{});
+
+        check();
+    }
+
+    private:
+    template <std::size_t I>
+    using column_t = std::tuple_element_t<I, tuple_t>;
+
+    /// Write the bytes of a trivial value @param v
+    template <typename T>
+    void write_value(const T &v) {
+        m_file.write(reinterpret_cast<const char *>(&v), sizeof(T));
+    }
+
+    /// Write the element size and the @param name of column @tparam I
+    template <std::size_t I>
+    void write_column_name(const std::string &name) {
+        static_assert(std::is_arithmetic_v<column_t<I>>,
+                      "Columnar output needs arithmetic column types");
+
+        write_value(static_cast<std::uint64_t>(sizeof(column_t<I>)));
+        write_value(static_cast<std::uint64_t>(name.size()));
+        m_file.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+
+    /// Write the values of column @tparam I of all @param records
+    template <std::size_t I>
+    void write_column(const std::vector<NamedTuple> &records) {
+        using T = column_t<I>;
+
+        m_staging.resize(records.size() * sizeof(T));
+        for (std::size_t i = 0u; i < records.size(); ++i) {
+            const T v{records[i].template get<I>()};
+            std::memcpy(m_staging.data() + i * sizeof(T), &v, sizeof(T));
+        }
+        m_file.write(m_staging.data(),
+                     static_cast<std::streamsize>(m_staging.size()));
+    }
+
+    void check() const {
+        if (!m_file.good()) {
+            throw std::runtime_error("Could not write data to file");
+        }
+    }
+
+    std::ofstream m_file;
+    /// Contiguous values of the current column
+    std::vector<char> m_staging{};
+};
+
+/// Read all records from the binary columnar file @param path
+///
+/// @throws std::runtime_error if the file does not match the record type
+/// @returns the records in the order they were written
+template <typename NamedTuple>
+inline std::vector<NamedTuple> read_columnar(const std::string &path) {
+
+    using tuple_t = typename NamedTuple::Tuple;
+    constexpr std::size_t n_columns{std::tuple_size_v<tuple_t>};
+
+    std::ifstream file(path, std::ios_base::binary | std::ios_base::in);
+    if (!file.is_open() || file.fail()) {
+        throw std::runtime_error("Could not open file '" + path + "'");
+    }
+
+    auto read_value = [&file, &path]<typename T>(T &v) {
+        file.read(reinterpret_cast<char *>(&v), sizeof(T));
+        if (!file.good()) {
+            throw std::runtime_error("Unexpected end of columnar file '" +
+                                     path + "'");
+        }
+    };
+
+    std::uint32_t magic{0u};
+    std::uint32_t version{0u};
+    std::uint64_t n_cols{0u};
+    read_value(magic);
+    read_value(version);
+    read_value(n_cols);
+    if (magic != columnar_magic || version != columnar_version ||
+        n_cols != n_columns) {
+        throw std::runtime_error("Not a matching columnar file: '" + path +
+                                 "'");
+    }
+
+    // Check the column layout
+    const auto names = NamedTuple::names();
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        auto check_column = [&]<std::size_t J>() {
+            std::uint64_t elem_size{0u};
+            std::uint64_t name_size{0u};
+            read_value(elem_size);
+            read_value(name_size);
+
+            std::string name(name_size, '\0');
+            file.read(name.data(), static_cast<std::streamsize>(name_size));
+
+            if (elem_size != sizeof(std::tuple_element_t<J, tuple_t>) ||
+                name != names[J]) {
+                throw std::runtime_error("Column '" + name +
+                                         "' does not match in file '" + path +
+                                         "'");
+            }
+        };
+        (check_column.template operator()<I>(), ...);
+    }
+    (std::make_index_sequence<n_columns>{});
+
+    std::vector<NamedTuple> records;
+    std::vector<char> staging;
+
+    std::uint64_t n_rows{0u};
+    while (file.read(reinterpret_cast<char *>(&n_rows), sizeof(n_rows))) {
+
+        const std::size_t offset{records.size()};
+        records.resize(offset + n_rows);
+
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            auto read_column = [&]<std::size_t J>() {
+                using T = std::tuple_element_t<J, tuple_t>;
+
+                staging.resize(n_rows * sizeof(T));
+                file.read(staging.data(),
+                          static_cast<std::streamsize>(staging.size()));
+                if (!file.good()) {
+                    throw std::runtime_error(
+                        "Unexpected end of columnar file '" + path + "'");
+                }
+                for (std::size_t i = 0u; i < n_rows; ++i) {
+                    std::memcpy(&(records[offset + i].template get<J>()),
+                                staging.data() + i * sizeof(T), sizeof(T));
+                }
+            };
+            (read_column.template operator()<I>(), ...);
+        }
+        (std::make_index_sequence<n_columns>{});
+    }
+
+    return records;
+}
+
+}  // namespace detray::io::csv
@@ -7,6 +7,7 @@
 #include <array>
 #include <cassert>
 #include <fstream>
+#include <limits>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -118,6 +119,8 @@ class DsvWriter {
     private:
     std::ofstream m_file;
     std::size_t m_num_columns;
+    // Reused for every line to avoid a stream allocation per record
+    std::stringstream m_line;
 
     template <typename T>
     unsigned write(T&& x, std::ostream& os);
@@ -257,7 +260,9 @@ inline DsvWriter<Delimiter>::DsvWriter(const std::vector<std::string>& columns,
 template <char Delimiter>
 template <typename Arg0, typename... Args>
 inline void DsvWriter<Delimiter>::append(Arg0&& arg0, Args&&... args) {
-    std::stringstream line;
+    std::stringstream& line = m_line;
+    line.str(std::string{});
+    line.clear();
     unsigned written_columns[] = {
         write(std::forward<Arg0>(arg0), line),
         (line << Delimiter, write(std::forward<Args>(args), line))...,
@@ -103,6 +103,33 @@ inline auto read_intersection2D(const std::string &file_name) {
     return intersections_per_track;
 }
 
+/// @returns the csv data of the intersection @param inters of the track
+/// with index @param track_idx
+template <typename intersection_t>
+inline auto make_intersection2D(const unsigned int track_idx,
+                                const intersection_t &inters) {
+
+    io::csv::intersection2D inters_data{};
+
+    inters_data.track_id = track_idx;
+    inters_data.identifier = inters.sf_desc.barcode().value();
+    inters_data.type = static_cast<unsigned int>(inters.sf_desc.barcode().id());
+    inters_data.transform_index = inters.sf_desc.transform();
+    inters_data.mask_id = static_cast<unsigned int>(inters.sf_desc.mask().id());
+    inters_data.mask_index = inters.sf_desc.mask().index();
+    inters_data.material_id =
+        static_cast<unsigned int>(inters.sf_desc.material().id());
+    inters_data.material_index = inters.sf_desc.material().index();
+    inters_data.l0 = inters.local[0];
+    inters_data.l1 = inters.local[1];
+    inters_data.path = inters.path;
+    inters_data.volume_link = inters.volume_link;
+    inters_data.direction = static_cast<int>(inters.direction);
+    inters_data.status = static_cast<int>(inters.status);
+
+    return inters_data;
+}
+
 /// Write intersections to csv file
 template <typename intersection_t>
 inline void write_intersection2D(
@@ -131,27 +158,9 @@ inline void write_intersection2D(
         }
 
         for (const auto &inters : intersections) {
-            io::csv::intersection2D inters_data{};
-
-            inters_data.track_id = track_idx;
-            inters_data.identifier = inters.sf_desc.barcode().value();
-            inters_data.type =
-                static_cast<unsigned int>(inters.sf_desc.barcode().id());
-            inters_data.transform_index = inters.sf_desc.transform();
-            inters_data.mask_id =
-                static_cast<unsigned int>(inters.sf_desc.mask().id());
-            inters_data.mask_index = inters.sf_desc.mask().index();
-            inters_data.material_id =
-                static_cast<unsigned int>(inters.sf_desc.material().id());
-            inters_data.material_index = inters.sf_desc.material().index();
-            inters_data.l0 = inters.local[0];
-            inters_data.l1 = inters.local[1];
-            inters_data.path = inters.path;
-            inters_data.volume_link = inters.volume_link;
-            inters_data.direction = static_cast<int>(inters.direction);
-            inters_data.status = static_cast<int>(inters.status);
-
-            inters_writer.append(inters_data);
+            inters_writer.append(
+                make_intersection2D(static_cast<unsigned int>(track_idx),
+                                    inters));
         }
     }
 }
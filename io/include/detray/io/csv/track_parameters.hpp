@@ -101,6 +101,31 @@ inline auto read_free_track_params(const std::string &file_name) {
     return track_params_per_track;
 }
 
+/// @returns the csv data of the free track parameters @param track_param
+/// with charge @param charge of the track with index @param track_idx
+template <detray::concepts::scalar scalar_t, typename track_t>
+inline auto make_free_track_params(const unsigned int track_idx,
+                                   const scalar_t charge,
+                                   const track_t &track_param) {
+
+    const auto &glob_pos = track_param.pos();
+    // Momentum may not be retrievable for straight-line tracks
+    const auto &p{charge != 0.f ? track_param.mom(charge) : track_param.dir()};
+
+    io::csv::free_track_parameters track_param_data{};
+    track_param_data.track_id = track_idx;
+    track_param_data.x = glob_pos[0];
+    track_param_data.y = glob_pos[1];
+    track_param_data.z = glob_pos[2];
+    track_param_data.t = track_param.time();
+    track_param_data.px = p[0];
+    track_param_data.py = p[1];
+    track_param_data.pz = p[2];
+    track_param_data.q = charge;
+
+    return track_param_data;
+}
+
 /// Write free track parameters to csv file
 template <detray::concepts::scalar scalar_t, typename track_t>
 inline void write_free_track_params(
@@ -130,24 +155,8 @@ inline void write_free_track_params(
         }
 
         for (const auto &[charge, track_param] : track_params) {
-
-            const auto &glob_pos = track_param.pos();
-            // Momentum may not be retrievable for straight-line tracks
-            const auto &p{charge != 0.f ? track_param.mom(charge)
-                                        : track_param.dir()};
-
-            io::csv::free_track_parameters track_param_data{};
-            track_param_data.track_id = track_idx;
-            track_param_data.x = glob_pos[0];
-            track_param_data.y = glob_pos[1];
-            track_param_data.z = glob_pos[2];
-            track_param_data.t = track_param.time();
-            track_param_data.px = p[0];
-            track_param_data.py = p[1];
-            track_param_data.pz = p[2];
-            track_param_data.q = charge;
-
-            track_param_writer.append(track_param_data);
+            track_param_writer.append(make_free_track_params(
+                static_cast<unsigned int>(track_idx), charge, track_param));
         }
     }
 }
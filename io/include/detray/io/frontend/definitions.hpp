@@ -14,7 +14,7 @@ using real_io = double;
 /// The following enums are defined per detector in the detector metadata
 namespace io {
 
-enum class format { json = 0u };
+enum class format { json = 0u, binary = 1u };
 
 /// Enumerate the shape primitives globally
 enum class shape_id : unsigned int {
@@ -0,0 +1,86 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/utils/io_metadata.hpp"
+#include "detray/utils/detector_hash.hpp"
+#include "detray/utils/type_list.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace detray::io::detail {
+
+/// @returns a hash over the content of the detector files @param file_names,
+/// the detector type @tparam detector_t and the detray version, which
+/// identifies a detector that was checked before
+template <typename detector_t>
+inline std::uint64_t hash_detector_files(
+    const std::vector<std::string>& file_names) {
+
+    detray::detail::detector_hasher hasher{};
+
+    hasher.add_bytes(get_detray_version());
+    hasher.add_bytes(types::get_name<typename detector_t::metadata>(true));
+
+    std::string buffer(1u << 16u, '\0');
+    for (const std::string& file_name : file_names) {
+        hasher.add_bytes(file_name);
+
+        std::ifstream file{file_name, std::ios::binary};
+        while (file) {
+            file.read(buffer.data(),
+                      static_cast<std::streamsize>(buffer.size()));
+            const auto n_read{static_cast<std::size_t>(file.gcount())};
+            hasher.add_bytes(std::string_view{buffer.data(), n_read});
+        }
+    }
+
+    return hasher.value();
+}
+
+/// @returns the name of the file that records a successful detector check,
+/// which lies next to the first detector file in @param file_names
+inline std::string check_cache_file(
+    const std::vector<std::string>& file_names) {
+    return file_names.empty() ? std::string{}
+                              : file_names.front() + ".checked";
+}
+
+/// @returns true if the detector with the file hash @param hash was already
+/// checked successfully
+inline bool is_checked(const std::vector<std::string>& file_names,
+                       const std::uint64_t hash) {
+
+    std::ifstream cache{check_cache_file(file_names)};
+
+    std::uint64_t cached_hash{0u};
+    return (cache >> cached_hash) && cached_hash == hash;
+}
+
+/// Record that the detector with the file hash @param hash was checked
+/// successfully
+inline void mark_checked(const std::vector<std::string>& file_names,
+                         const std::uint64_t hash) {
+
+    const std::string cache_name{check_cache_file(file_names)};
+    std::ofstream cache{cache_name, std::ios::trunc};
+    if (!(cache << hash << std::endl)) {
+        std::cout << "WARNING: Could not write the detector check cache "
+                  << cache_name << std::endl;
+    }
+}
+
+}  // namespace detray::io::detail
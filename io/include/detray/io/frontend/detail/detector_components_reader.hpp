@@ -14,22 +14,39 @@
 
 // System include(s)
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <exception>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace detray::io::detail {
 
+/// Time spent on reading a detector component
+struct component_timing {
+    /// Parsing the file
+    std::chrono::duration<double, std::milli> parse{0.};
+    /// Adding the data to the detector builder
+    std::chrono::duration<double, std::milli> build{0.};
+};
+
 /// @brief A reader for multiple detector components.
 ///
 /// The class aggregates a number of different readers and calls them once the
-/// detector data should be read in from file.
+/// detector data should be read in from file. The files are parsed
+/// concurrently, while the data is added to the detector builder one
+/// component after the other.
 template <class detector_t>
 class detector_components_reader final {
 
     using reader_ptr_t = std::unique_ptr<reader_interface<detector_t>>;
+    using clock_t = std::chrono::steady_clock;
 
     public:
     /// Default constructor
@@ -56,31 +73,96 @@ class detector_components_reader final {
     /// Set the name of the detector to be read
     void set_detector_name(std::string name) { m_det_name = std::move(name); }
 
+    /// @returns the time spent on every component in the last @c read call
+    const auto& timing() const { return m_timing; }
+
     /// Reads the full detector into @param det by calling the readers, while
     /// using the name map @param volume_names for to write the volume names.
+    /// Up to @param n_threads files are parsed concurrently (if zero, the
+    /// number of hardware threads is used).
     void read(detector_builder<typename detector_t::metadata, volume_builder>&
                   det_builder,
-              typename detector_t::name_map& volume_names) {
+              typename detector_t::name_map& volume_names,
+              const std::size_t n_threads = 1u) {
 
         // We have to at least read a geometry
         assert(size() != 0u &&
                "No readers registered! Need at least a geometry reader");
 
+        m_timing.clear();
+
         // Set the detector name in the name map
         volume_names.emplace(0u, m_det_name);
 
+        // Parse all files independently
+        parse(n_threads);
+
         // Call the read method on all readers
         for (const auto& [name, reader] : m_readers) {
+            const auto start{clock_t::now()};
             reader->read(det_builder, volume_names, name);
+            m_timing[name].build = clock_t::now() - start;
         }
     }
 
     private:
+    /// Parse the files of all readers with up to @param n_threads threads
+    void parse(std::size_t n_threads) {
+
+        std::vector<std::pair<std::string, reader_interface<detector_t>*>>
+            tasks{};
+        tasks.reserve(m_readers.size());
+        for (const auto& [name, reader] : m_readers) {
+            tasks.emplace_back(name, reader.get());
+        }
+
+        std::vector<component_timing> timing(tasks.size());
+        std::vector<std::exception_ptr> errors(tasks.size());
+        std::atomic<std::size_t> next_task{0u};
+
+        auto work = [&tasks, &timing, &errors, &next_task]() {
+            for (std::size_t i = next_task++; i < tasks.size();
+                 i = next_task++) {
+                try {
+                    const auto start{clock_t::now()};
+                    tasks[i].second->parse(tasks[i].first);
+                    timing[i].parse = clock_t::now() - start;
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        if (n_threads == 0u) {
+            n_threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        n_threads = std::min(n_threads, tasks.size());
+
+        // The calling thread parses as well
+        std::vector<std::thread> workers{};
+        for (std::size_t i = 1u; i < n_threads; ++i) {
+            workers.emplace_back(work);
+        }
+        work();
+        for (std::thread& w : workers) {
+            w.join();
+        }
+
+        for (std::size_t i = 0u; i < tasks.size(); ++i) {
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+            m_timing[tasks[i].first] = timing[i];
+        }
+    }
+
     /// Name of the detector
     std::string m_det_name;
     /// The readers registered for the detector: geometry (mandatory!) plus
     /// e.g. material, grids...)
     std::map<std::string, reader_ptr_t> m_readers;
+    /// Time spent on every component (file name)
+    std::map<std::string, component_timing> m_timing;
 };
 
 }  // namespace detray::io::detail
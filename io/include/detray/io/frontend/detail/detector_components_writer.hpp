@@ -12,10 +12,14 @@
 
 // System include(s)
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <filesystem>
 #include <ios>
 #include <memory>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -47,21 +51,62 @@ class detector_components_writer final {
     /// Attach an existing writer via @param w_ptr to the writers
     void add(writer_ptr_t&& w_ptr) { m_writers.push_back(std::move(w_ptr)); }
 
+    /// Compress the files of all writers with @param c
+    void set_compression(const io::compression c) {
+        std::ranges::for_each(m_writers, [c](writer_ptr_t& writer) {
+            writer->set_compression(c);
+        });
+    }
+
     /// Writes the full detector data of @param det to file by calling the
-    /// writers, while using the name map @param names for the detector
+    /// writers, while using the name map @param names for the detector.
+    /// Up to @param n_threads files are written concurrently (if zero, the
+    /// number of hardware threads is used).
     void write(const detector_t& det,
                const typename detector_t::name_map& names,
                const std::ios_base::openmode mode,
-               const std::filesystem::path& file_path) {
+               const std::filesystem::path& file_path,
+               std::size_t n_threads = 1u) {
         // We have to at least write a geometry
         assert(m_writers.size() != 0u &&
                "No writers registered! Need at least a geometry writer");
 
+        std::vector<std::exception_ptr> errors(m_writers.size());
+        std::atomic<std::size_t> next_task{0u};
+
         // Call the write method on all optional writers
-        std::ranges::for_each(
-            m_writers, [&det, &names, mode, &file_path](writer_ptr_t& writer) {
-                writer->write(det, names, mode, file_path);
-            });
+        auto work = [this, &det, &names, mode, &file_path, &errors,
+                     &next_task]() {
+            for (std::size_t i = next_task++; i < m_writers.size();
+                 i = next_task++) {
+                try {
+                    m_writers[i]->write(det, names, mode, file_path);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        if (n_threads == 0u) {
+            n_threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        n_threads = std::min(n_threads, m_writers.size());
+
+        // The calling thread writes as well
+        std::vector<std::thread> workers{};
+        for (std::size_t i = 1u; i < n_threads; ++i) {
+            workers.emplace_back(work);
+        }
+        work();
+        for (std::thread& w : workers) {
+            w.join();
+        }
+
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
     }
 
     private:
@@ -0,0 +1,244 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/core/concepts.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/io/backend/geometry_reader.hpp"
+#include "detray/io/backend/geometry_writer.hpp"
+#include "detray/io/backend/homogeneous_material_reader.hpp"
+#include "detray/io/backend/homogeneous_material_writer.hpp"
+#include "detray/io/backend/material_map_reader.hpp"
+#include "detray/io/backend/material_map_writer.hpp"
+#include "detray/io/backend/surface_grid_reader.hpp"
+#include "detray/io/backend/surface_grid_writer.hpp"
+#include "detray/io/frontend/payloads.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+namespace detail {
+
+/// Map from the volume indices of the original detector to the volume
+/// indices of the extracted detector
+using volume_index_map = std::map<std::size_t, std::size_t>;
+
+/// Keep only the grids of the selected volumes in @param grids_data and set
+/// them to the new volume indices in @param vol_map
+///
+/// @param remap_owner whether the grid owner link is a volume index
+template <typename grids_payload_t>
+inline grids_payload_t extract_grids(grids_payload_t&& grids_data,
+                                     const volume_index_map& vol_map,
+                                     const bool remap_owner) {
+    grids_payload_t sub_grids_data{};
+
+    for (auto& [vol_idx, grid_data_coll] : grids_data.grids) {
+        const auto search = vol_map.find(vol_idx);
+        if (search == vol_map.end()) {
+            continue;
+        }
+        if (remap_owner) {
+            for (auto& grid_data : grid_data_coll) {
+                grid_data.owner_link.link = search->second;
+            }
+        }
+        sub_grids_data.grids[search->second] = std::move(grid_data_coll);
+    }
+
+    return sub_grids_data;
+}
+
+}  // namespace detail
+
+/// @brief Extract a sub-detector from the volumes @param volumes of @param det
+///
+/// The geometry, material and surface grids of the selected volumes are
+/// converted to their io payloads, re-indexed and built into a new, compact
+/// detector. Portals that link to a volume which was not selected are turned
+/// into exits to the world (invalid volume link).
+///
+/// @tparam CAP surface grid bin capacity (zero: dynamic capacity)
+/// @tparam DIM dimension of the surface grids, usually 2D
+///
+/// @param resc the memory resource for the extracted detector
+/// @param det the full detector
+/// @param names the detector and volume names of @param det
+/// @param volumes indices of the volumes in @param det to be extracted
+///
+/// @returns a pair of the extracted detector and its name map
+template <class detector_t, std::size_t CAP = 0u, std::size_t DIM = 2u>
+auto extract_detector(vecmem::memory_resource& resc, const detector_t& det,
+                      const typename detector_t::name_map& names,
+                      std::vector<dindex> volumes) {
+
+    using metadata_t = typename detector_t::metadata;
+
+    std::ranges::sort(volumes);
+    const auto [first, last] = std::ranges::unique(volumes);
+    volumes.erase(first, last);
+
+    if (volumes.empty()) {
+        throw std::invalid_argument(
+            "Detector extraction: No volumes selected");
+    }
+    if (volumes.back() >= det.volumes().size()) {
+        throw std::invalid_argument(
+            "Detector extraction: Volume index " +
+            std::to_string(volumes.back()) + " out of range");
+    }
+
+    // The new volume indices follow the order of the old ones
+    detail::volume_index_map vol_map{};
+    for (std::size_t i = 0u; i < volumes.size(); ++i) {
+        vol_map[volumes[i]] = i;
+    }
+
+    detector_builder<metadata_t, volume_builder> det_builder{};
+    typename detector_t::name_map sub_names{};
+    if (names.contains(0u)) {
+        sub_names[0u] = names.at(0u);
+    }
+
+    // Geometry
+    detector_payload geo_data = geometry_writer::to_payload(det, names);
+    detector_payload sub_geo_data{};
+    sub_geo_data.volumes.reserve(volumes.size());
+
+    for (const dindex vol_idx : volumes) {
+        volume_payload& vol_data = geo_data.volumes.at(vol_idx);
+        vol_data.index.link = vol_map.at(vol_idx);
+
+        for (surface_payload& sf_data : vol_data.surfaces) {
+            std::size_t& vol_link = sf_data.mask.volume_link.link;
+
+            // Leave the sub-detector, where the neighbour was not selected
+            if (const auto search = vol_map.find(vol_link);
+                search != vol_map.end()) {
+                vol_link = search->second;
+            } else {
+                vol_link = detray::detail::invalid_value<std::size_t>();
+            }
+        }
+        sub_geo_data.volumes.push_back(std::move(vol_data));
+    }
+    geometry_reader::from_payload<detector_t>(det_builder, sub_names,
+                                              sub_geo_data);
+
+    // Homogeneous material
+    if constexpr (detray::concepts::has_homogeneous_material<detector_t>) {
+        auto mat_data = homogeneous_material_writer::to_payload(det, names);
+        detector_homogeneous_material_payload sub_mat_data{};
+
+        for (material_volume_payload& mv_data : mat_data.volumes) {
+            const auto search = vol_map.find(mv_data.volume_link.link);
+            if (search == vol_map.end()) {
+                continue;
+            }
+            mv_data.volume_link.link = search->second;
+            sub_mat_data.volumes.push_back(std::move(mv_data));
+        }
+        homogeneous_material_reader::from_payload<detector_t>(
+            det_builder, sub_names, sub_mat_data);
+    }
+
+    // Material maps (the owner link is the volume local surface index)
+    if constexpr (detray::concepts::has_material_maps<detector_t>) {
+        using map_reader_t =
+            material_map_reader<std::integral_constant<std::size_t, DIM>>;
+
+        map_reader_t::template from_payload<detector_t>(
+            det_builder, sub_names,
+            detail::extract_grids(material_map_writer::to_payload(det, names),
+                                  vol_map, false));
+    }
+
+    // Surface grids (the owner link is the volume index)
+    if constexpr (detray::concepts::has_surface_grids<detector_t>) {
+        using grid_reader_t =
+            surface_grid_reader<typename detector_t::surface_type,
+                                std::integral_constant<std::size_t, CAP>,
+                                std::integral_constant<std::size_t, DIM>>;
+
+        grid_reader_t::template from_payload<detector_t>(
+            det_builder, sub_names,
+            detail::extract_grids(surface_grid_writer::to_payload(det, names),
+                                  vol_map, true));
+    }
+
+    return std::make_pair(det_builder.build(resc), std::move(sub_names));
+}
+
+/// @brief Select the volumes of a detector in a region of interest
+///
+/// Selects every volume of @param det that contains a sensitive surface with
+/// its center in the given eta-phi window. Volumes without sensitive surfaces
+/// (e.g. gap volumes and the beampipe) are always selected, so that the
+/// extracted sub-detector stays connected.
+///
+/// @returns the indices of the selected volumes
+template <class detector_t>
+std::vector<dindex> roi_volumes(
+    const detector_t& det, const typename detector_t::scalar_type eta_min,
+    const typename detector_t::scalar_type eta_max,
+    const typename detector_t::scalar_type phi_min = -constant<
+        typename detector_t::scalar_type>::pi,
+    const typename detector_t::scalar_type phi_max =
+        constant<typename detector_t::scalar_type>::pi) {
+
+    const typename detector_t::geometry_context gctx{};
+
+    std::vector<bool> has_sensitives(det.volumes().size(), false);
+    std::vector<bool> is_selected(det.volumes().size(), false);
+
+    for (const auto& sf_desc : det.surfaces()) {
+        const geometry::surface sf{det, sf_desc};
+        if (!sf.is_sensitive()) {
+            continue;
+        }
+
+        const dindex vol_idx{sf.volume()};
+        has_sensitives[vol_idx] = true;
+
+        const auto center = sf.center(gctx);
+        const auto eta{vector::eta(center)};
+        const auto phi{vector::phi(center)};
+        if (eta_min <= eta && eta <= eta_max && phi_min <= phi &&
+            phi <= phi_max) {
+            is_selected[vol_idx] = true;
+        }
+    }
+
+    std::vector<dindex> volumes{};
+    for (dindex i = 0u; i < det.volumes().size(); ++i) {
+        if (is_selected[i] || !has_sensitives[i]) {
+            volumes.push_back(i);
+        }
+    }
+
+    return volumes;
+}
+
+}  // namespace detray::io
@@ -9,13 +9,22 @@
 
 // Project include(s)
 #include "detray/builders/detector_builder.hpp"
+#include "detray/io/binary/mapped_detector.hpp"
+#include "detray/io/binary/shared_detector.hpp"
+#include "detray/io/frontend/detail/check_cache.hpp"
 #include "detray/io/frontend/detail/detector_components_reader.hpp"
 #include "detray/io/frontend/detector_reader_config.hpp"
+#include "detray/io/frontend/impl/binary_readers.hpp"
 #include "detray/io/frontend/impl/json_readers.hpp"
 #include "detray/utils/consistency_checker.hpp"
+#include "detray/utils/type_usage.hpp"
 
 // System include(s)
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <future>
+#include <iostream>
 #include <ios>
 #include <memory>
 #include <stdexcept>
@@ -25,21 +34,62 @@
 
 namespace detray::io {
 
+namespace detail {
+
+/// Run the consistency check on @param det , which was read from the files
+/// in the reader config @param cfg , unless the same files were checked
+/// before and the config allows to use the result of that check
+///
+/// @note throws an exception in case of inconsistencies
+template <typename detector_t>
+void check_detector(const detector_t& det,
+                    const typename detector_t::name_map& names,
+                    const detector_reader_config& cfg,
+                    const std::vector<std::string>& file_names) {
+
+    std::uint64_t hash{0u};
+    if (cfg.use_check_cache()) {
+        hash = hash_detector_files<detector_t>(file_names);
+        if (is_checked(file_names, hash)) {
+            std::cout << "Detector check: OK (cached)" << std::endl;
+            return;
+        }
+    }
+
+    detray::detail::check_consistency(det, cfg.verbose_check(), names,
+                                      cfg.n_threads());
+    std::cout << "Detector check: OK" << std::endl;
+
+    if (cfg.use_check_cache()) {
+        mark_checked(file_names, hash);
+    }
+}
+
+}  // namespace detail
+
 /// @brief Read detector components from a list of files
 ///
 /// @param file_names list of files to be read
 /// @param det_builder detector builder to be filled
 /// @param name_map detector and volume name map
+/// @param n_threads number of threads that parse the files (zero: hardware
+///                  threads)
+/// @param report_timing print the time spent on every file
+/// @param stream_json stream the json grid files volume by volume
 template <class detector_t, std::size_t CAP = 0u, std::size_t DIM = 2u>
 void read_components_from_file(const std::vector<std::string>& file_names,
                                detector_builder<typename detector_t::metadata,
                                                 volume_builder>& det_builder,
-                               typename detector_t::name_map& name_map) {
+                               typename detector_t::name_map& name_map,
+                               const std::size_t n_threads = 1u,
+                               const bool report_timing = false,
+                               const bool stream_json = false) {
     // Hold all required readers (one for every component)
     detail::detector_components_reader<detector_t> readers;
 
-    // Register the readers for the files in json format
-    detail::add_json_readers<CAP, DIM>(readers, file_names);
+    // Register the readers for the files in json and binary format
+    detail::add_json_readers<CAP, DIM>(readers, file_names, stream_json);
+    detail::add_binary_readers<CAP, DIM>(readers, file_names);
 
     // Make sure that all files will be read
     if (readers.size() != file_names.size()) {
@@ -52,7 +102,15 @@ void read_components_from_file(const std::vector<std::string>& file_names,
     }
 
     // Read the data into the detector builder
-    readers.read(det_builder, name_map);
+    readers.read(det_builder, name_map, n_threads);
+
+    if (report_timing) {
+        std::cout << "Detector reading time [ms] (parse | build):" << std::endl;
+        for (const auto& [file_name, t] : readers.timing()) {
+            std::cout << "\t" << t.parse.count() << " | " << t.build.count()
+                      << "\t" << file_name << std::endl;
+        }
+    }
 }
 
 /// @brief Reader function for detray detectors.
@@ -77,22 +135,133 @@ auto read_detector(vecmem::memory_resource& resc,
 
     detector_builder<typename detector_t::metadata, volume_builder_t>
         det_builder;
+    det_builder.build_source_index(cfg.build_source_index());
+    det_builder.material_volumes(cfg.material_volumes());
+    det_builder.time_builders(cfg.report_timing());
 
     // Register readers for the respective detector component and file format
     // and read the data into the detector_builder
-    read_components_from_file<detector_t, CAP, DIM>(cfg.files(), det_builder,
-                                                    names);
+    read_components_from_file<detector_t, CAP, DIM>(
+        cfg.files(), det_builder, names, cfg.n_threads(), cfg.report_timing(),
+        cfg.stream_json());
 
     // Build and return the detector
-    auto det = det_builder.build(resc);
+    build_report report{};
+    auto det = det_builder.build(resc, cfg.report_timing() ? &report : nullptr);
+    if (cfg.report_timing()) {
+        std::cout << report << std::endl;
+    }
+    if (cfg.report_type_usage()) {
+        std::cout << get_type_usage(det) << std::endl;
+    }
 
     if (cfg.do_check()) {
-        // This will throw an exception in case of inconsistencies
-        detray::detail::check_consistency(det, cfg.verbose_check(), names);
-        std::cout << "Detector check: OK" << std::endl;
+        detail::check_detector(det, names, cfg, cfg.files());
     }
 
     return std::make_pair(std::move(det), std::move(names));
 }
 
+/// @brief Memory mapping function for detray detectors.
+///
+/// Maps a binary detector file, which was written with the
+/// @c io::format::binary format, and sets the detector containers directly
+/// onto the file data.
+///
+/// @tparam detector_t the type of detector that was written
+///
+/// @param file_name the binary detector file
+/// @param cfg the detector reader configuration (only the consistency check
+///            options and the number of threads are used)
+///
+/// @returns the mapped detector, which also holds the volume names
+template <class detector_t>
+auto map_detector(const std::string& file_name,
+                  const detector_reader_config& cfg = {}) noexcept(false) {
+
+    io::mapped_detector<typename detector_t::metadata> det{file_name};
+
+    if (cfg.do_check()) {
+        detail::check_detector(det.get(), det.names(), cfg, {file_name});
+    }
+
+    return det;
+}
+
+/// @brief Attach to a detray detector in shared memory.
+///
+/// Sets the detector containers onto the named shared memory segment, which
+/// was filled by another process with @c io::share_detector . The detector
+/// is read-only.
+///
+/// @tparam detector_t the type of detector that was shared
+///
+/// @param segment_name the name of the shared memory segment
+/// @param cfg the detector reader configuration (only the consistency check
+///            options and the number of threads are used, there is no check
+///            cache for shared memory)
+///
+/// @returns the shared detector, which also holds the volume names
+template <class detector_t>
+auto attach_detector(const std::string& segment_name,
+                     const detector_reader_config& cfg = {}) noexcept(false) {
+
+    auto det = io::shared_detector<typename detector_t::metadata>::attach(
+        segment_name);
+
+    if (cfg.do_check()) {
+        detray::detail::check_consistency(det.get(), cfg.verbose_check(),
+                                          det.names(), cfg.n_threads());
+        std::cout << "Detector check: OK" << std::endl;
+    }
+
+    return det;
+}
+
+namespace detail {
+
+/// Default continuation of an asynchronous detector read: Hand out the
+/// detector and its names
+struct forward_detector {
+    template <typename detector_t, typename name_map_t>
+    auto operator()(detector_t&& det, name_map_t&& names) const {
+        return std::make_pair(std::forward<detector_t>(det),
+                              std::forward<name_map_t>(names));
+    }
+};
+
+}  // namespace detail
+
+/// @brief Read a detray detector in a separate thread.
+///
+/// Allows to overlap the detector reading with other work at startup, e.g.
+/// reading the magnetic field map (@see io::read_bfield_async ).
+///
+/// @tparam detector_t the type of detector to be built
+/// @tparam CAP surface grid bin capacity
+/// @tparam DIM dimension of the surface grids, usually 2D
+///
+/// @param resc the memory resource to be used for the detector container
+///             allocs (must outlive the read and be thread safe)
+/// @param cfg the detector reader configuration (copied)
+/// @param on_read callable that is run on the detector and its names in the
+///                reading thread, e.g. to copy the detector to device memory.
+///                By default, the detector and names are returned as a pair
+///
+/// @returns a future of the result of @param on_read
+template <class detector_t, std::size_t CAP = 0u, std::size_t DIM = 2u,
+          typename callable_t = detail::forward_detector>
+auto read_detector_async(vecmem::memory_resource& resc,
+                         const detector_reader_config& cfg,
+                         callable_t on_read = {}) {
+
+    return std::async(
+        std::launch::async,
+        [&resc, cfg, on_read = std::move(on_read)]() mutable {
+            auto [det, names] = read_detector<detector_t, CAP, DIM>(resc, cfg);
+
+            return on_read(std::move(det), std::move(names));
+        });
+}
+
 }  // namespace detray::io
@@ -7,9 +7,14 @@
 
 #pragma once
 
+// Project include(s)
+#include "detray/definitions/indexing.hpp"
+
 // System include(s)
+#include <cstddef>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace detray::io {
@@ -22,12 +27,37 @@ struct detector_reader_config {
     bool m_do_check{true};
     /// Verbosity of the detector consistency check
     bool m_verbose{false};
+    /// Skip the consistency check if the same files were checked before
+    bool m_use_check_cache{false};
+    /// Sort the surfaces by source link for a fast search
+    bool m_build_source_index{false};
+    /// Number of threads to parse the files and to check the detector with
+    /// (zero: hardware threads)
+    std::size_t m_n_threads{1u};
+    /// Print the time spent on every file and on building the detector
+    bool m_report_timing{false};
+    /// Print which mask, material and accelerator types the detector uses
+    bool m_report_type_usage{false};
+    /// Only build the material maps of these volumes (empty: all volumes)
+    std::vector<dindex> m_material_volumes{};
+    /// Stream the json grid and material map files volume by volume, instead
+    /// of parsing them completely (less memory, but no concurrent parsing)
+    bool m_stream_json{false};
 
     /// Getters
     /// @{
     const std::vector<std::string>& files() const { return m_files; }
     bool do_check() const { return m_do_check; }
     bool verbose_check() const { return m_verbose; }
+    bool use_check_cache() const { return m_use_check_cache; }
+    bool build_source_index() const { return m_build_source_index; }
+    std::size_t n_threads() const { return m_n_threads; }
+    bool report_timing() const { return m_report_timing; }
+    bool report_type_usage() const { return m_report_type_usage; }
+    const std::vector<dindex>& material_volumes() const {
+        return m_material_volumes;
+    }
+    bool stream_json() const { return m_stream_json; }
     /// @}
 
     /// Setters
@@ -47,6 +77,34 @@ struct detector_reader_config {
         m_verbose = verbose;
         return *this;
     }
+    detector_reader_config& use_check_cache(const bool use_cache) {
+        m_use_check_cache = use_cache;
+        return *this;
+    }
+    detector_reader_config& build_source_index(const bool do_build) {
+        m_build_source_index = do_build;
+        return *this;
+    }
+    detector_reader_config& n_threads(const std::size_t n) {
+        m_n_threads = n;
+        return *this;
+    }
+    detector_reader_config& report_timing(const bool report) {
+        m_report_timing = report;
+        return *this;
+    }
+    detector_reader_config& report_type_usage(const bool report) {
+        m_report_type_usage = report;
+        return *this;
+    }
+    detector_reader_config& material_volumes(std::vector<dindex> vol_indices) {
+        m_material_volumes = std::move(vol_indices);
+        return *this;
+    }
+    detector_reader_config& stream_json(const bool stream) {
+        m_stream_json = stream;
+        return *this;
+    }
     /// @}
 
     /// Print the detector reader configuration
@@ -59,6 +117,19 @@ struct detector_reader_config {
         for (const auto& file_name : cfg.files()) {
             out << "    -> " << file_name << "\n";
         }
+        out << "  Parsing threads:      : "
+            << (cfg.n_threads() == 0u ? std::string{"auto"}
+                                      : std::to_string(cfg.n_threads()))
+            << "\n"
+            << "  Stream json grids:    : " << std::boolalpha
+            << cfg.stream_json() << std::noboolalpha << "\n";
+        if (!cfg.material_volumes().empty()) {
+            out << "  Material volumes:     : ";
+            for (const dindex vol_idx : cfg.material_volumes()) {
+                out << vol_idx << " ";
+            }
+            out << "\n";
+        }
 
         return out;
     }
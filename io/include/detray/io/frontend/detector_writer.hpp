@@ -8,6 +8,8 @@
 #pragma once
 
 // Project include(s)
+#include "detray/io/binary/binary_detector_writer.hpp"
+#include "detray/io/binary/shared_detector.hpp"
 #include "detray/io/frontend/detail/detector_components_writer.hpp"
 #include "detray/io/frontend/detector_writer_config.hpp"
 #include "detray/io/frontend/impl/json_writers.hpp"
@@ -16,6 +18,7 @@
 // System include(s)
 #include <filesystem>
 #include <ios>
+#include <string>
 
 namespace detray::io {
 
@@ -44,14 +47,35 @@ void write_detector(detector_t& det, const typename detector_t::name_map& names,
     io::detail::detector_components_writer<detector_t> writer{};
     if (cfg.format() == io::format::json) {
         detail::add_json_writers(writer, cfg);
+    } else if (cfg.format() == io::format::binary) {
+        // The binary file always contains the complete detector
+        writer.template add<binary_detector_writer<detector_t>>();
     }
+    writer.set_compression(cfg.compression());
 
     if (cfg.compactify_json()) {
         std::cout << "WARNING: Compactifying json files is not yet implemented"
                   << std::endl;
     }
 
-    writer.write(det, names, mode, file_path);
+    writer.write(det, names, mode, file_path, cfg.n_threads());
+}
+
+/// @brief Share a detray detector with other processes.
+///
+/// Copies @param det with the names @param names into the new POSIX shared
+/// memory segment @param segment_name (must start with '/'), from which
+/// other processes on the same node can attach to it read-only with
+/// @c io::attach_detector .
+///
+/// @returns the shared detector, which removes the segment name when it goes
+/// out of scope
+template <class detector_t>
+auto share_detector(const detector_t& det,
+                    const typename detector_t::name_map& names,
+                    const std::string& segment_name) noexcept(false) {
+    return io::shared_detector<typename detector_t::metadata>::create(
+        segment_name, det, names);
 }
 
 }  // namespace detray::io
@@ -9,8 +9,10 @@
 
 // Project include(s)
 #include "detray/io/frontend/definitions.hpp"
+#include "detray/io/utils/compression.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <ostream>
 #include <string>
 
@@ -30,6 +32,15 @@ struct detector_writer_config {
     bool m_write_material = true;
     /// Whether to write the accelerator grids to file
     bool m_write_grids = true;
+    /// Write the surface grids to a binary file (only for json format)
+    bool m_binary_grids = false;
+    /// Compress the output files
+    detray::io::compression m_compression = detray::io::compression::none;
+    /// Write the json files volume by volume (less memory)
+    bool m_stream_json = false;
+    /// Number of threads that write the component files concurrently
+    /// (zero: hardware threads)
+    std::size_t m_n_threads = 1u;
 
     /// Getters
     /// @{
@@ -39,6 +50,10 @@ struct detector_writer_config {
     bool compactify_json() const { return m_compact_io; }
     bool write_material() const { return m_write_material; }
     bool write_grids() const { return m_write_grids; }
+    bool binary_grids() const { return m_binary_grids; }
+    detray::io::compression compression() const { return m_compression; }
+    bool stream_json() const { return m_stream_json; }
+    std::size_t n_threads() const { return m_n_threads; }
     /// @}
 
     /// Setters
@@ -67,6 +82,22 @@ struct detector_writer_config {
         m_write_grids = flag;
         return *this;
     }
+    detector_writer_config& binary_grids(bool flag) {
+        m_binary_grids = flag;
+        return *this;
+    }
+    detector_writer_config& compression(detray::io::compression c) {
+        m_compression = c;
+        return *this;
+    }
+    detector_writer_config& stream_json(bool flag) {
+        m_stream_json = flag;
+        return *this;
+    }
+    detector_writer_config& n_threads(std::size_t n) {
+        m_n_threads = n;
+        return *this;
+    }
     /// @}
 
     /// Print the detector writer configuration
@@ -77,11 +108,21 @@ struct detector_writer_config {
             << "  Path                  : " << cfg.path() << "\n"
             << "  Write grids           : " << std::boolalpha
             << cfg.write_grids() << "\n"
-            << "  Write material        : " << cfg.write_material() << "\n";
+            << "  Write material        : " << cfg.write_material() << "\n"
+            << "  Compression           : "
+            << (cfg.compression() == detray::io::compression::zstd ? "zstd"
+                                                                   : "none")
+            << "\n"
+            << "  Writing threads       : "
+            << (cfg.n_threads() == 0u ? std::string{"auto"}
+                                      : std::to_string(cfg.n_threads()))
+            << "\n";
 
         if (cfg.format() == detray::io::format::json) {
             out << "  Compactify json       : " << cfg.compactify_json()
-                << "\n";
+                << "\n"
+                << "  Binary grids          : " << cfg.binary_grids() << "\n"
+                << "  Stream json           : " << cfg.stream_json() << "\n";
         }
         // Reset state
         out << std::noboolalpha;
@@ -0,0 +1,83 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/concepts.hpp"
+#include "detray/io/binary/binary_grid_io.hpp"
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/binary/binary_surface_grid_reader.hpp"
+#include "detray/io/frontend/detail/detector_components_reader.hpp"
+#include "detray/io/utils/compression.hpp"
+#include "detray/io/utils/file_handle.hpp"
+#include "detray/io/utils/io_metadata.hpp"
+
+// System include(s)
+#include <cstdint>
+#include <filesystem>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace detray::io::detail {
+
+/// @returns the magic bytes at the start of the binary file @param file_name
+inline std::uint32_t peek_binary_magic(const std::string& file_name) {
+
+    io::file_handle file{file_name, std::ios_base::in | std::ios_base::binary};
+
+    std::uint32_t magic{0u};
+    (*file).read(reinterpret_cast<char*>(&magic), sizeof(magic));
+
+    return magic;
+}
+
+/// From the list of files that are given @param files, infer the readers for
+/// the binary detector components by peeking at the magic bytes
+///
+/// @tparam CAP surface grid bin capacity
+/// @tparam DIM dimension of the surface grids, usually 2D
+/// @tparam detector_t type of the detector instance: Must match the data that
+///                    is read from file!
+template <std::size_t CAP, std::size_t DIM, class detector_t>
+inline void add_binary_readers(
+    io::detail::detector_components_reader<detector_t>& reader,
+    const std::vector<std::string>& files) noexcept(false) {
+
+    for (const std::filesystem::path file_name : files) {
+
+        // Only add readers for binary files
+        if (file_name.empty() || io::format_extension(file_name) != ".bin") {
+            continue;
+        }
+
+        const std::uint32_t magic{peek_binary_magic(file_name)};
+
+        if (magic == binary_grid_magic) {
+            if constexpr (detray::concepts::has_surface_grids<detector_t>) {
+                using binary_grid_reader =
+                    binary_surface_grid_reader<detector_t, CAP, DIM>;
+
+                reader.template add<binary_grid_reader>(file_name);
+            } else {
+                print_type_warning<detector_t>("surface_grids");
+            }
+        } else if (magic == binary_magic) {
+            throw std::invalid_argument(
+                "Complete binary detector files cannot be combined with other "
+                "files, use io::map_detector: " +
+                file_name.string());
+        } else {
+            throw std::invalid_argument("Unknown binary file format: " +
+                                        file_name.string());
+        }
+    }
+}
+
+}  // namespace detray::io::detail
@@ -16,6 +16,8 @@
 #include "detray/io/frontend/detail/detector_components_reader.hpp"
 #include "detray/io/frontend/payloads.hpp"
 #include "detray/io/json/json_converter.hpp"
+#include "detray/io/json/json_grid_stream_reader.hpp"
+#include "detray/io/utils/compression.hpp"
 #include "detray/io/utils/io_metadata.hpp"
 
 // System include(s)
@@ -58,10 +60,14 @@ inline common_header_payload deserialize_json_header(
 /// @tparam DIM dimension of the surface grids, usually 2D
 /// @tparam detector_t type of the detector instance: Must match the data that
 ///                    is read from file!
+///
+/// @param stream_grids stream the surface grid and material map files volume
+///                     by volume, instead of parsing them completely
 template <std::size_t CAP, std::size_t DIM, class detector_t>
 inline void add_json_readers(
     io::detail::detector_components_reader<detector_t>& reader,
-    const std::vector<std::string>& files) noexcept(false) {
+    const std::vector<std::string>& files,
+    const bool stream_grids = false) noexcept(false) {
 
     for (const std::filesystem::path file_name : files) {
 
@@ -72,7 +78,7 @@ inline void add_json_readers(
         }
 
         // Only add readers for json files
-        if (file_name.extension() != ".json") {
+        if (io::format_extension(file_name) != ".json") {
             continue;
         }
 
@@ -99,23 +105,39 @@ inline void add_json_readers(
             }
         } else if (header.tag == "material_maps") {
             if constexpr (detray::concepts::has_material_maps<detector_t>) {
-                using json_material_map_reader = json_converter<
-                    detector_t, material_map_reader<
-                                    std::integral_constant<std::size_t, DIM>>>;
-
-                reader.template add<json_material_map_reader>(file_name);
+                using map_reader_t = material_map_reader<
+                    std::integral_constant<std::size_t, DIM>>;
+                using json_material_map_reader =
+                    json_converter<detector_t, map_reader_t>;
+                using json_material_map_stream_reader =
+                    json_grid_stream_reader<detector_t, map_reader_t>;
+
+                if (stream_grids) {
+                    reader.template add<json_material_map_stream_reader>(
+                        file_name);
+                } else {
+                    reader.template add<json_material_map_reader>(file_name);
+                }
             } else {
                 print_type_warning<detector_t>(header.tag);
             }
         } else if (header.tag == "surface_grids") {
             if constexpr (detray::concepts::has_surface_grids<detector_t>) {
-                using json_surface_grid_reader = json_converter<
-                    detector_t, surface_grid_reader<
-                                    typename detector_t::surface_type,
-                                    std::integral_constant<std::size_t, CAP>,
-                                    std::integral_constant<std::size_t, DIM>>>;
-
-                reader.template add<json_surface_grid_reader>(file_name);
+                using grid_reader_t = surface_grid_reader<
+                    typename detector_t::surface_type,
+                    std::integral_constant<std::size_t, CAP>,
+                    std::integral_constant<std::size_t, DIM>>;
+                using json_surface_grid_reader =
+                    json_converter<detector_t, grid_reader_t>;
+                using json_surface_grid_stream_reader =
+                    json_grid_stream_reader<detector_t, grid_reader_t>;
+
+                if (stream_grids) {
+                    reader.template add<json_surface_grid_stream_reader>(
+                        file_name);
+                } else {
+                    reader.template add<json_surface_grid_reader>(file_name);
+                }
             } else {
                 print_type_warning<detector_t>(header.tag);
             }
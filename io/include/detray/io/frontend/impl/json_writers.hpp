@@ -13,9 +13,11 @@
 #include "detray/io/backend/homogeneous_material_writer.hpp"
 #include "detray/io/backend/material_map_writer.hpp"
 #include "detray/io/backend/surface_grid_writer.hpp"
+#include "detray/io/binary/binary_surface_grid_writer.hpp"
 #include "detray/io/frontend/detail/detector_components_writer.hpp"
 #include "detray/io/frontend/detector_writer_config.hpp"
 #include "detray/io/json/json_converter.hpp"
+#include "detray/io/json/json_stream_writer.hpp"
 
 namespace detray::io {
 
@@ -23,40 +25,43 @@ struct detector_writer_config;
 
 namespace detail {
 
+/// Add the json writer for the backend @tparam backend_t , which writes the
+/// file volume by volume, if requested in the config @param cfg
+template <class backend_t, class detector_t>
+void add_json_writer(detector_components_writer<detector_t>& writers,
+                     const detray::io::detector_writer_config& cfg) {
+    if (cfg.stream_json()) {
+        writers.template add<json_stream_writer<detector_t, backend_t>>();
+    } else {
+        writers.template add<json_converter<detector_t, backend_t>>();
+    }
+}
+
 /// Infer the writers that are needed from the detector type @tparam detector_t
 template <class detector_t>
 void add_json_writers(detector_components_writer<detector_t>& writers,
                       const detray::io::detector_writer_config& cfg) {
 
     // Always needed
-    using json_geometry_writer = json_converter<detector_t, geometry_writer>;
-
-    writers.template add<json_geometry_writer>();
+    add_json_writer<geometry_writer>(writers, cfg);
 
     // Find other writers, depending on the detector type
     if (cfg.write_material()) {
         // Simple material
         if constexpr (detray::concepts::has_homogeneous_material<detector_t>) {
-            using json_homogeneous_material_writer =
-                json_converter<detector_t, homogeneous_material_writer>;
-
-            writers.template add<json_homogeneous_material_writer>();
+            add_json_writer<homogeneous_material_writer>(writers, cfg);
         }
         // Material maps
         if constexpr (detray::concepts::has_material_maps<detector_t>) {
-            using json_material_map_writer =
-                json_converter<detector_t, material_map_writer>;
-
-            writers.template add<json_material_map_writer>();
+            add_json_writer<material_map_writer>(writers, cfg);
         }
     }
     // Navigation acceleration structures
     if constexpr (detray::concepts::has_surface_grids<detector_t>) {
-        using json_surface_grid_writer =
-            json_converter<detector_t, surface_grid_writer>;
-
-        if (cfg.write_grids()) {
-            writers.template add<json_surface_grid_writer>();
+        if (cfg.write_grids() && cfg.binary_grids()) {
+            writers.template add<binary_surface_grid_writer<detector_t>>();
+        } else if (cfg.write_grids()) {
+            add_json_writer<surface_grid_writer>(writers, cfg);
         }
     }
 }
@@ -34,6 +34,8 @@ namespace detray::io {
 /// @brief a payload for common information
 struct common_header_payload {
     std::string version{}, detector{}, tag{}, date{};
+    /// Content hash of the detector the file was written from (optional)
+    std::string hash{};
 };
 
 /// @brief a payload for common and extra information
@@ -35,6 +35,11 @@ class reader_interface {
     /// @returns the file extension
     const std::string& file_extension() const { return m_file_extension; }
 
+    /// Parses the file ahead of the call to @c read , so that the expensive
+    /// file parsing can be done concurrently for different readers. By
+    /// default, all work happens in @c read
+    virtual void parse(const std::string&) {}
+
     /// Reads the respective detector component from file. Since the detector
     /// does not keep the volume names, the name map is also passed and
     /// filled.
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/builders/detector_builder.hpp"
+#include "detray/io/utils/compression.hpp"
 
 // System include(s)
 #include <filesystem>
@@ -32,8 +33,13 @@ class writer_interface {
     /// Default destructor
     virtual ~writer_interface() = default;
 
-    /// @returns the file extension
-    const std::string& file_extension() const { return m_file_extension; }
+    /// @returns the file extension, including the compression extension
+    std::string file_extension() const {
+        return m_file_extension + std::string{io::extension(m_compression)};
+    }
+
+    /// Compress the written files with @param c
+    void set_compression(const io::compression c) { m_compression = c; }
 
     /// Writes the respective detector component to file. Since the detector
     /// does not provide the volume names, the name map is also passed.
@@ -46,6 +52,8 @@ class writer_interface {
     private:
     /// Extension that matches the file format of the respective writer
     std::string m_file_extension;
+    /// Compression of the written files
+    io::compression m_compression{io::compression::none};
 };
 
 }  // namespace detray::io
@@ -18,6 +18,9 @@ inline void to_json(nlohmann::ordered_json& j, const common_header_payload& h) {
     j["detector"] = h.detector;
     j["date"] = h.date;
     j["tag"] = h.tag;
+    if (!h.hash.empty()) {
+        j["hash"] = h.hash;
+    }
 }
 
 inline void from_json(const nlohmann::ordered_json& j,
@@ -26,6 +29,9 @@ inline void from_json(const nlohmann::ordered_json& j,
     h.detector = j["detector"];
     h.date = j["date"];
     h.tag = j["tag"];
+    if (j.contains("hash")) {
+        h.hash = j["hash"];
+    }
 }
 
 inline void to_json(nlohmann::ordered_json& j, const header_payload<bool>& h) {
@@ -19,7 +19,9 @@
 // System include(s)
 #include <ios>
 #include <iostream>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace detray::io {
 
@@ -46,11 +48,8 @@ requires concepts::reader_backend<detector_t, backend_t> class json_converter<
     /// Set json file extension
     json_converter() : reader_interface<detector_t>(".json") {}
 
-    /// Writes the geometry to file with a given name
-    void read(detector_builder<typename detector_t::metadata, volume_builder>&
-                  det_builder,
-              typename detector_t::name_map& name_map,
-              const std::string& file_name) override {
+    /// Reads the json file and converts it into the io payloads
+    void parse(const std::string& file_name) override {
 
         // Read json from file
         io::file_handle file{file_name,
@@ -60,10 +59,31 @@ requires concepts::reader_backend<detector_t, backend_t> class json_converter<
         nlohmann::json in_json;
         *file >> in_json;
 
+        m_payload =
+            in_json["data"].template get<typename io_backend::payload_type>();
+    }
+
+    /// Reads the geometry from file with a given name
+    void read(detector_builder<typename detector_t::metadata, volume_builder>&
+                  det_builder,
+              typename detector_t::name_map& name_map,
+              const std::string& file_name) override {
+
+        // The file might have been parsed already
+        if (!m_payload.has_value()) {
+            parse(file_name);
+        }
+
         // Add the data from the payload to the detray detector builder
-        io_backend::template from_payload<detector_t>(det_builder, name_map,
-                                                      in_json["data"]);
+        io_backend::template from_payload<detector_t>(
+            det_builder, name_map, std::move(*m_payload));
+
+        m_payload.reset();
     }
+
+    private:
+    /// Payload data, from the last file that was parsed
+    std::optional<typename io_backend::payload_type> m_payload{};
 };
 
 /// @brief Class that adds json functionality to backend writer types.
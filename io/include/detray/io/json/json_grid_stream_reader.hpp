@@ -0,0 +1,94 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/io/backend/concepts.hpp"
+#include "detray/io/frontend/reader_interface.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_io.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <ios>
+#include <string>
+#include <utility>
+
+namespace detray::io {
+
+/// @brief Streaming json reader for grid payloads (surface grids and
+/// material maps).
+///
+/// Instead of parsing the whole file into a json document and then into the
+/// detector payload, the grids are converted volume by volume while the file
+/// is being parsed: Once the json object of a volume is complete, its grids
+/// are handed to the backend reader and the json data is discarded. At most
+/// the grids of one volume are held in memory at a time.
+///
+/// @note All work happens in @c read , so the file is not parsed
+/// concurrently with the other detector components.
+template <class detector_t, class backend_t>
+requires concepts::reader_backend<detector_t, backend_t> class
+    json_grid_stream_reader final : public reader_interface<detector_t> {
+
+    using io_backend = backend_t;
+    using payload_type = typename io_backend::payload_type;
+    using grid_payload_type =
+        typename decltype(payload_type::grids)::mapped_type::value_type;
+
+    /// Nesting depth of the volume objects in the grid file:
+    /// {"data": {"grids": [{"volume_link": ..., "grid_data": [...]}, ...]}}
+    static constexpr int volume_depth{3};
+
+    public:
+    /// Set json file extension
+    json_grid_stream_reader() : reader_interface<detector_t>(".json") {}
+
+    /// Reads the grids from file with a given name, volume by volume
+    void read(detector_builder<typename detector_t::metadata, volume_builder>&
+                  det_builder,
+              typename detector_t::name_map& name_map,
+              const std::string& file_name) override {
+
+        io::file_handle file{file_name,
+                             std::ios_base::in | std::ios_base::binary};
+
+        auto convert_volume = [&det_builder, &name_map](
+                                  int depth,
+                                  nlohmann::json::parse_event_t event,
+                                  nlohmann::json& parsed) {
+            if (event != nlohmann::json::parse_event_t::object_end ||
+                depth != volume_depth || !parsed.contains("grid_data")) {
+                return true;
+            }
+
+            const std::size_t vol_idx = parsed["volume_link"];
+
+            payload_type grids_data{};
+            auto& grid_data_coll = grids_data.grids[vol_idx];
+            for (const auto& jgrid : parsed["grid_data"]) {
+                grid_data_coll.push_back(
+                    jgrid.template get<grid_payload_type>());
+            }
+            // Release the json data of the volume before building
+            parsed = nullptr;
+
+            io_backend::template from_payload<detector_t>(
+                det_builder, name_map, std::move(grids_data));
+
+            // Discard the volume from the json document
+            return false;
+        };
+
+        nlohmann::json::parse(*file, convert_volume);
+    }
+};
+
+}  // namespace detray::io
@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/backend/concepts.hpp"
+#include "detray/io/frontend/writer_interface.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_io.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// System include(s)
+#include <cassert>
+#include <filesystem>
+#include <ios>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace detray::io {
+
+/// @brief Streaming json writer for backend writer types.
+///
+/// Instead of converting the whole detector component into its payload and
+/// into a json document before writing, the component is converted volume by
+/// volume and every volume entry is written to file as soon as it is
+/// converted. At most the data of one volume is held in memory at a time.
+///
+/// The file has the same layout as the files of the @c json_converter , e.g.
+/// {"header": {...}, "data": {"volumes": [...]}}, so that it can be read by
+/// the regular json readers.
+///
+/// @note The resulting writer types will fulfill @c writer_interface
+template <class detector_t, class backend_t>
+requires concepts::volume_writer_backend<detector_t, backend_t> class
+    json_stream_writer final : public writer_interface<detector_t> {
+
+    using io_backend = backend_t;
+
+    public:
+    /// File gets created with the json file extension
+    json_stream_writer() : writer_interface<detector_t>(".json") {}
+
+    /// Writes the detector component to file, volume by volume
+    std::string write(
+        const detector_t& det, const typename detector_t::name_map& names,
+        const std::ios_base::openmode mode = std::ios::out | std::ios::binary,
+        const std::filesystem::path& file_path = {"./"}) override {
+        // Assert output stream
+        assert(((mode == std::ios_base::out) ||
+                (mode == (std::ios_base::out | std::ios_base::binary)) ||
+                (mode == (std::ios_base::out | std::ios_base::trunc)) ||
+                (mode == (std::ios_base::out | std::ios_base::trunc |
+                          std::ios_base::binary))) &&
+               "Illegal file mode for json writer");
+
+        // By convention the name of the detector is the first element
+        std::string det_name = "";
+        if (!names.empty()) {
+            det_name = names.at(0);
+        }
+
+        // Create a new file
+        std::string file_stem{det_name + "_" + std::string(io_backend::tag)};
+        io::file_handle file{file_path / file_stem, this->file_extension(),
+                             mode};
+        std::ostream& out = *file;
+
+        // Write some general information
+        const nlohmann::ordered_json header =
+            io_backend::header_to_payload(det, det_name);
+        out << "{\n    \"header\": " << header.dump() << ",\n    \"data\": {";
+
+        // Write the entries of the volumes into the data array of the
+        // component (e.g. "volumes" or "grids")
+        std::string array_key{};
+        bool first_entry{true};
+        for (const auto& vol_desc : det.volumes()) {
+            const nlohmann::ordered_json vol_json =
+                io_backend::volume_to_payload(det, names, vol_desc);
+
+            for (const auto& item : vol_json.items()) {
+                if (array_key.empty()) {
+                    array_key = item.key();
+                    out << "\n        \"" << array_key << "\": [";
+                } else if (item.key() != array_key) {
+                    throw std::logic_error(
+                        "Json stream writer: Volume data is not a single "
+                        "array (" +
+                        item.key() + "): " + file_stem);
+                }
+
+                for (const auto& entry : item.value()) {
+                    out << (first_entry ? "\n            " : ",\n            ")
+                        << entry.dump();
+                    first_entry = false;
+                }
+            }
+        }
+        if (!array_key.empty()) {
+            out << "\n        ]";
+        }
+        out << "\n    }\n}" << std::endl;
+
+        return file_stem + this->file_extension();
+    }
+};
+
+}  // namespace detray::io
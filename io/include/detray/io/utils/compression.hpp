@@ -0,0 +1,177 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// Zstandard include(s)
+#if defined(DETRAY_IO_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace detray::io {
+
+/// Compression of the detector files, which is negotiated through the file
+/// extension (e.g. "toy_detector_geometry.json.zst")
+enum class compression : std::uint_least8_t { none = 0u, zstd = 1u };
+
+/// Extension of zstd compressed files
+inline constexpr std::string_view zstd_extension{".zst"};
+
+/// @returns the file extension that marks the compression @param c
+constexpr std::string_view extension(const compression c) {
+    return c == compression::zstd ? zstd_extension : std::string_view{};
+}
+
+/// @returns whether detray was built with support for the compression @param c
+constexpr bool is_supported([[maybe_unused]] const compression c) {
+#if defined(DETRAY_IO_ZSTD)
+    return true;
+#else
+    return c == compression::none;
+#endif
+}
+
+/// @returns the compression of the file @param file_path from its extension
+inline compression get_compression(const std::filesystem::path& file_path) {
+    return file_path.extension() == zstd_extension ? compression::zstd
+                                                   : compression::none;
+}
+
+/// @returns the extension of the uncompressed file format of the file
+/// @param file_path (e.g. ".json" for "toy_detector_geometry.json.zst")
+inline std::string format_extension(const std::filesystem::path& file_path) {
+    if (get_compression(file_path) != compression::none) {
+        return file_path.stem().extension().string();
+    }
+    return file_path.extension().string();
+}
+
+namespace detail {
+
+/// Throw, if detray was not built with support for the compression @param c
+inline void check_compression(const compression c,
+                              const std::string& file_name) {
+    if (!is_supported(c)) {
+        throw std::runtime_error(
+            "Compressed file, but detray was built without zstd support "
+            "(DETRAY_IO_ZSTD): " +
+            file_name);
+    }
+}
+
+}  // namespace detail
+
+/// Compress the data @param data of the file @param file_name with the
+/// compression @param c
+///
+/// @param level the compression level (zstd: 1 - 19)
+///
+/// @returns the compressed data
+inline std::string compress([[maybe_unused]] std::string_view data,
+                            const compression c,
+                            const std::string& file_name = "",
+                            [[maybe_unused]] const int level = 3) {
+    detail::check_compression(c, file_name);
+
+#if defined(DETRAY_IO_ZSTD)
+    if (c == compression::zstd) {
+        std::string out(ZSTD_compressBound(data.size()), '\0');
+
+        const std::size_t n_bytes{ZSTD_compress(out.data(), out.size(),
+                                                data.data(), data.size(),
+                                                level)};
+        if (ZSTD_isError(n_bytes)) {
+            throw std::runtime_error("Could not compress file data (" +
+                                     std::string{ZSTD_getErrorName(n_bytes)} +
+                                     "): " + file_name);
+        }
+        out.resize(n_bytes);
+
+        return out;
+    }
+#endif
+
+    return std::string{data};
+}
+
+/// Decompress the data @param data of the file @param file_name with the
+/// compression @param c
+///
+/// @returns the decompressed data
+inline std::string decompress(std::string_view data, const compression c,
+                              const std::string& file_name = "") {
+    detail::check_compression(c, file_name);
+
+#if defined(DETRAY_IO_ZSTD)
+    if (c == compression::zstd) {
+        auto error = [&file_name](const std::size_t ret) {
+            return std::runtime_error("Could not decompress file data (" +
+                                      std::string{ZSTD_getErrorName(ret)} +
+                                      "): " + file_name);
+        };
+
+        // Decompress in one go, if the frame records the size of the data
+        const auto content_size{
+            ZSTD_getFrameContentSize(data.data(), data.size())};
+        if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+            throw std::runtime_error("Not a zstd compressed file: " +
+                                     file_name);
+        }
+        if (content_size != ZSTD_CONTENTSIZE_UNKNOWN) {
+            std::string out(static_cast<std::size_t>(content_size), '\0');
+
+            const std::size_t ret{ZSTD_decompress(out.data(), out.size(),
+                                                  data.data(), data.size())};
+            if (ZSTD_isError(ret)) {
+                throw error(ret);
+            }
+            out.resize(ret);
+
+            return out;
+        }
+
+        // Otherwise, stream the data
+        ZSTD_DCtx* dctx{ZSTD_createDCtx()};
+        std::string out;
+        std::string chunk(ZSTD_DStreamOutSize(), '\0');
+        ZSTD_inBuffer in_buffer{data.data(), data.size(), 0u};
+
+        std::size_t ret{0u};
+        bool chunk_full{false};
+        while (in_buffer.pos < in_buffer.size || chunk_full) {
+            ZSTD_outBuffer out_buffer{chunk.data(), chunk.size(), 0u};
+
+            ret = ZSTD_decompressStream(dctx, &out_buffer, &in_buffer);
+            if (ZSTD_isError(ret)) {
+                ZSTD_freeDCtx(dctx);
+                throw error(ret);
+            }
+            out.append(chunk.data(), out_buffer.pos);
+            chunk_full = (out_buffer.pos == out_buffer.size);
+        }
+        ZSTD_freeDCtx(dctx);
+
+        if (ret != 0u) {
+            throw std::runtime_error("Truncated zstd compressed file: " +
+                                     file_name);
+        }
+
+        return out;
+    }
+#endif
+
+    return std::string{data};
+}
+
+}  // namespace detray::io
@@ -7,6 +7,9 @@
 
 #pragma once
 
+// Project include(s)
+#include "detray/io/utils/compression.hpp"
+
 // System include(s).
 #include <filesystem>
 #include <string>
@@ -28,6 +31,12 @@ inline std::string alt_file_name(const std::string& name) {
     std::string stem = path.stem();
     std::string extension = path.extension();
 
+    // Keep the extension of compressed files whole (e.g. ".json.zst")
+    if (io::get_compression(path) != io::compression::none) {
+        extension = io::format_extension(path) + extension;
+        stem = path.stem().stem();
+    }
+
     /// @returns alternate file stem upon collision
     auto get_alternate_file_stem = [](std::string& file_stem,
                                       const std::size_t n) {
@@ -8,16 +8,20 @@
 #pragma once
 
 // Project include(s)
+#include "detray/io/utils/compression.hpp"
 #include "detray/io/utils/create_path.hpp"
 
 // System include(s)
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <ios>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 
@@ -33,6 +37,9 @@ namespace detray::io {
 /// - Checks whether a file was opened correctly
 /// - Closes the stream when the handle goes out of scope and checks whether
 ///   anything went wrong during the IO operations
+/// - Transparently (de)compresses files with a compression extension (e.g.
+///   ".json.zst"): The file content is held in a memory buffer, which is
+///   decompressed on opening and compressed when the handle goes out of scope
 ///
 /// @note Not thread safe.
 /// @note Can throw exceptions during construction.
@@ -62,13 +69,12 @@ class file_handle final {
         if (mode == std::ios_base::out ||
             (mode == (std::ios_base::out | std::ios_base::binary))) {
             // Default name for output
-            file_name = name.empty() ? "./detray_" + std::to_string(n_files)
+            file_name = name.empty() ? "./detray_" + std::to_string(n_files.load())
                                      : file_name;
 
             // Does the file stem need to be adjusted (in case the file exists)?
             std::string new_name = io::alt_file_name(file_name + extension);
-            auto new_path = std::filesystem::path{new_name};
-            file_name = new_path.parent_path() / new_path.stem();
+            file_name = new_name.substr(0u, new_name.size() - extension.size());
 
             // Pure input mode: Check if file name makes sense and file exists
         } else if ((mode == std::ios_base::in) ||
@@ -89,12 +95,11 @@ class file_handle final {
 
         // Count the new file
         const std::string file_path{file_name + extension};
-        ++n_files;
-        ++n_open_files;
-        if (n_files >= std::numeric_limits<std::uint_least16_t>::max()) {
+        if (++n_files >= std::numeric_limits<std::uint_least16_t>::max()) {
+            ++n_open_files;
             throw std::runtime_error(
                 "Could not open file: Too many files written: " + file_path);
-        } else if (n_open_files >= 1000u) {
+        } else if (++n_open_files >= 1000u) {
             throw std::runtime_error(
                 "Could not open file: Too many files currently open: " +
                 file_path);
@@ -106,10 +111,42 @@ class file_handle final {
         if (!m_stream.is_open()) {
             throw std::runtime_error("Could not open file: " + file_path);
         }
+
+        // Compressed file: Read and decompress the content in one go
+        m_compression = io::get_compression(file_path);
+        if (m_compression != compression::none) {
+            detail::check_compression(m_compression, file_path);
+
+            if ((mode & std::ios_base::in) && (mode & std::ios_base::out)) {
+                throw std::invalid_argument(
+                    "Compressed files cannot be opened for reading and "
+                    "writing: " +
+                    file_path);
+            }
+            if (mode & std::ios_base::in) {
+                const std::string data{std::istreambuf_iterator<char>(m_stream),
+                                       std::istreambuf_iterator<char>()};
+                m_buffer.str(io::decompress(data, m_compression, file_path));
+            } else {
+                m_compress_on_close = true;
+            }
+            m_file_path = file_path;
+        }
     }
 
     /// Destructor closes the file
     ~file_handle() {
+        if (m_compress_on_close) {
+            try {
+                const std::string data{
+                    io::compress(m_buffer.view(), m_compression, m_file_path)};
+                m_stream.write(data.data(),
+                               static_cast<std::streamsize>(data.size()));
+            } catch (std::exception& err) {
+                std::cout << "ERROR: Could not compress file:\n"
+                          << err.what() << std::endl;
+            }
+        }
         if (m_stream.bad()) {
             std::cout << "ERROR: Could not read from/write to file";
         }
@@ -122,16 +159,27 @@ class file_handle final {
         --n_open_files;
     }
 
-    /// @returns the output stream
-    std::fstream& operator*() { return m_stream; }
+    /// @returns the output stream (the memory buffer for compressed files)
+    std::iostream& operator*() {
+        if (m_compression != compression::none) {
+            return m_buffer;
+        }
+        return m_stream;
+    }
 
     private:
     /// Output file handle
     std::fstream m_stream;
 
+    /// Uncompressed content of a compressed file
+    std::stringstream m_buffer;
+    compression m_compression{compression::none};
+    bool m_compress_on_close{false};
+    std::string m_file_path{};
+
     /// How many files have been created? Maximum: 65'536
-    inline static std::size_t n_files{0u};
-    inline static std::size_t n_open_files{0u};
+    inline static std::atomic<std::size_t> n_files{0u};
+    inline static std::atomic<std::size_t> n_open_files{0u};
 };
 
 }  // namespace detray::io
@@ -0,0 +1,179 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+// POSIX include(s)
+#include <sys/mman.h>
+
+namespace detray::io {
+
+/// @brief Host memory resource that backs large allocations by huge pages.
+///
+/// Detector stores (surfaces, transforms, masks, grids, material maps) of
+/// large detectors span hundreds of MB and are accessed randomly during the
+/// navigation, which causes many TLB misses with the default 4 kB pages.
+/// Allocations of at least @c config::min_size bytes are therefore mapped
+/// directly and either advised to use transparent huge pages, or placed on
+/// explicitly reserved huge pages (hugetlbfs). If no explicit huge pages are
+/// available, the allocation falls back to transparent huge pages. Smaller
+/// allocations are passed on to the upstream resource.
+///
+/// The resource can be passed to the detector builder and reader, e.g.
+/// @code
+/// io::huge_page_resource mr{};
+/// auto [det, names] = io::read_detector<detector_t>(mr, reader_cfg);
+/// @endcode
+///
+/// @note The resource is thread-safe, if the upstream resource is.
+class huge_page_resource final : public vecmem::memory_resource {
+
+    public:
+    /// How to obtain the huge pages
+    enum class mode : std::uint_least8_t {
+        /// Advise the kernel to back the mapping with transparent huge pages
+        e_transparent = 0u,
+        /// Map explicitly reserved huge pages (MAP_HUGETLB), or fall back to
+        /// transparent huge pages
+        e_explicit = 1u,
+    };
+
+    struct config {
+        /// How to obtain the huge pages
+        mode page_mode{mode::e_transparent};
+        /// Size of a huge page (2 MB on x86_64)
+        std::size_t page_size{2u * 1024u * 1024u};
+        /// Minimal size of an allocation to be placed on huge pages
+        std::size_t min_size{1024u * 1024u};
+    };
+
+    /// Construct with the configuration @param cfg and the resource for the
+    /// small allocations @param upstream (null: new/delete resource)
+    explicit huge_page_resource(const config &cfg = {},
+                                vecmem::memory_resource *upstream = nullptr)
+        : m_cfg{cfg},
+          m_upstream{upstream != nullptr ? upstream
+                                         : std::pmr::new_delete_resource()} {}
+
+    /// @returns the configuration
+    const config &get_config() const { return m_cfg; }
+
+    /// @returns the number of bytes that are currently mapped for huge pages
+    std::size_t mapped_bytes() const { return m_mapped_bytes.load(); }
+
+    /// @returns the number of explicit huge page mappings that had to fall
+    /// back to transparent huge pages
+    std::size_t n_fallbacks() const { return m_n_fallbacks.load(); }
+
+    private:
+    /// @returns true if an allocation of @param bytes is mapped
+    bool is_mapped(const std::size_t bytes) const {
+        return bytes >= m_cfg.min_size;
+    }
+
+    /// @returns @param bytes rounded up to full huge pages
+    std::size_t mapping_size(const std::size_t bytes) const {
+        const std::size_t n_pages{(bytes + m_cfg.page_size - 1u) /
+                                  m_cfg.page_size};
+        return n_pages * m_cfg.page_size;
+    }
+
+    /// Map anonymous memory of @param size bytes and advise the kernel to use
+    /// transparent huge pages
+    static void *map_transparent(const std::size_t size) {
+        void *addr{::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+        if (addr == MAP_FAILED) {
+            return nullptr;
+        }
+#if defined(MADV_HUGEPAGE)
+        // Only a hint: Without THP support, regular pages are used
+        ::madvise(addr, size, MADV_HUGEPAGE);
+#endif
+        return addr;
+    }
+
+    /// Map @param size bytes of explicitly reserved huge pages
+    static void *map_explicit([[maybe_unused]] const std::size_t size) {
+#if defined(MAP_HUGETLB)
+        void *addr{::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0)};
+        return addr == MAP_FAILED ? nullptr : addr;
+#else
+        return nullptr;
+#endif
+    }
+
+    void *do_allocate(const std::size_t bytes,
+                      const std::size_t alignment) override {
+        if (!is_mapped(bytes)) {
+            return m_upstream->allocate(bytes, alignment);
+        }
+
+        // The mappings are aligned to pages
+        if (alignment > m_cfg.page_size) {
+            throw std::bad_alloc();
+        }
+
+        const std::size_t size{mapping_size(bytes)};
+
+        void *addr{nullptr};
+        if (m_cfg.page_mode == mode::e_explicit) {
+            addr = map_explicit(size);
+            if (addr == nullptr) {
+                ++m_n_fallbacks;
+            }
+        }
+        if (addr == nullptr) {
+            addr = map_transparent(size);
+        }
+        if (addr == nullptr) {
+            throw std::bad_alloc();
+        }
+
+        m_mapped_bytes += size;
+
+        return addr;
+    }
+
+    void do_deallocate(void *ptr, const std::size_t bytes,
+                       const std::size_t alignment) override {
+        if (!is_mapped(bytes)) {
+            m_upstream->deallocate(ptr, bytes, alignment);
+            return;
+        }
+
+        const std::size_t size{mapping_size(bytes)};
+        ::munmap(ptr, size);
+        m_mapped_bytes -= size;
+    }
+
+    bool do_is_equal(
+        const vecmem::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+    /// Configuration
+    config m_cfg;
+    /// Resource for the small allocations
+    vecmem::memory_resource *m_upstream;
+    /// Statistics
+    std::atomic<std::size_t> m_mapped_bytes{0u};
+    std::atomic<std::size_t> m_n_fallbacks{0u};
+};
+
+}  // namespace detray::io
@@ -8,10 +8,12 @@
 #pragma once
 
 // Project include(s)
+#include "detray/utils/detector_hash.hpp"
 #include "detray/utils/type_list.hpp"
 #include "detray/version.hpp"  // generated by cmake
 
 // System include(s).
+#include <cstdint>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
@@ -47,6 +49,16 @@ inline std::string get_detray_version() {
     return "detray - " + std::string(detray::version);
 }
 
+/// @returns the content hash of the detector @param det as a hex string, which
+/// identifies the detector that a file was written from
+template <typename detector_t>
+inline std::string get_detector_hash(const detector_t& det) {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0')
+       << detray::detail::hash_detector(det);
+    return ss.str();
+}
+
 static constexpr std::string_view minimal_io_version = "detray - 0.52.0";
 
 }  // namespace detray::io::detail
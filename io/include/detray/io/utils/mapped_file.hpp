@@ -0,0 +1,169 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/utils/compression.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// POSIX include(s)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace detray::io {
+
+/// @brief Read-only memory mapping of a file
+///
+/// The file is mapped into memory in its entirety and unmapped when the
+/// handle goes out of scope. Processes that map the same file share its pages
+/// in the page cache.
+///
+/// In copy-on-write mode, the mapped memory can be written to, but the
+/// changes are private to the process and never reach the file.
+///
+/// Compressed files (e.g. ".bin.zst") are decompressed into anonymous memory
+/// instead, which is not shared between processes.
+///
+/// @note Can throw exceptions during construction.
+class mapped_file final {
+
+    public:
+    /// No empty mappings
+    mapped_file() = delete;
+
+    /// Map the file @param file_name, @param copy_on_write allows writes to
+    /// the mapped memory that are not carried through to the file
+    explicit mapped_file(const std::string& file_name,
+                         const bool copy_on_write = false) {
+
+        if (file_name.empty()) {
+            throw std::invalid_argument("File name empty");
+        }
+        if (!std::filesystem::exists(std::filesystem::path{file_name})) {
+            throw std::invalid_argument(
+                "Could not map file: File does not exist: " + file_name);
+        }
+
+        if (const compression c{io::get_compression(file_name)};
+            c != compression::none) {
+            map_decompressed(file_name, c, copy_on_write);
+            return;
+        }
+
+        const int fd{::open(file_name.c_str(), O_RDONLY)};
+        if (fd < 0) {
+            throw std::runtime_error("Could not open file: " + file_name);
+        }
+
+        struct stat file_stat {};
+        if (::fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+            ::close(fd);
+            throw std::runtime_error("Could not map empty file: " + file_name);
+        }
+        m_size = static_cast<std::size_t>(file_stat.st_size);
+
+        const int prot{copy_on_write ? (PROT_READ | PROT_WRITE) : PROT_READ};
+        const int flags{copy_on_write ? MAP_PRIVATE : MAP_SHARED};
+        void* addr{::mmap(nullptr, m_size, prot, flags, fd, 0)};
+
+        // The mapping stays valid after the file is closed
+        ::close(fd);
+
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("Could not map file: " + file_name);
+        }
+        m_addr = addr;
+    }
+
+    /// Move only
+    /// @{
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : m_addr{std::exchange(other.m_addr, nullptr)},
+          m_size{std::exchange(other.m_size, 0u)} {}
+
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            m_addr = std::exchange(other.m_addr, nullptr);
+            m_size = std::exchange(other.m_size, 0u);
+        }
+        return *this;
+    }
+    /// @}
+
+    /// Destructor unmaps the file
+    ~mapped_file() { unmap(); }
+
+    /// @returns the start of the mapped memory
+    std::byte* data() { return static_cast<std::byte*>(m_addr); }
+
+    /// @returns the start of the mapped memory - const
+    const std::byte* data() const {
+        return static_cast<const std::byte*>(m_addr);
+    }
+
+    /// @returns the size of the mapping in bytes
+    std::size_t size() const { return m_size; }
+
+    private:
+    /// Decompress the file @param file_name with the compression @param c
+    /// into anonymous memory
+    void map_decompressed(const std::string& file_name, const compression c,
+                          const bool copy_on_write) {
+        std::ifstream file{file_name,
+                           std::ios_base::in | std::ios_base::binary};
+        const std::string raw{std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>()};
+        const std::string data{io::decompress(raw, c, file_name)};
+
+        if (data.empty()) {
+            throw std::runtime_error("Could not map empty file: " + file_name);
+        }
+        m_size = data.size();
+
+        void* addr{::mmap(nullptr, m_size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("Could not map file: " + file_name);
+        }
+        std::memcpy(addr, data.data(), m_size);
+
+        if (!copy_on_write) {
+            ::mprotect(addr, m_size, PROT_READ);
+        }
+        m_addr = addr;
+    }
+
+    /// Release the mapping
+    void unmap() {
+        if (m_addr != nullptr) {
+            ::munmap(m_addr, m_size);
+            m_addr = nullptr;
+        }
+    }
+
+    /// Start and size of the mapping
+    void* m_addr{nullptr};
+    std::size_t m_size{0u};
+};
+
+}  // namespace detray::io
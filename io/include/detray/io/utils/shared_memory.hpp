@@ -0,0 +1,191 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// POSIX include(s)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace detray::io {
+
+/// @brief Mapping of a named POSIX shared memory segment
+///
+/// A segment is created once with a given size and can then be attached to
+/// read-only by other processes, which share its physical pages. The creator
+/// owns the name: It is removed when the owning handle goes out of scope.
+/// Processes that are attached at that time keep their mapping.
+///
+/// @note Can throw exceptions during construction.
+class shared_memory final {
+
+    public:
+    /// No empty mappings
+    shared_memory() = delete;
+
+    /// Create a new segment @param name (must start with '/') with
+    /// @param size bytes and map it writable
+    static shared_memory create(const std::string& name,
+                                const std::size_t size) {
+        check_name(name);
+        if (size == 0u) {
+            throw std::invalid_argument(
+                "Cannot create empty shared memory segment: " + name);
+        }
+
+        const int fd{::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR,
+                                S_IRUSR | S_IWUSR)};
+        if (fd < 0) {
+            throw std::runtime_error(
+                "Could not create shared memory segment (already exists?): " +
+                name);
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw std::runtime_error(
+                "Could not resize shared memory segment: " + name);
+        }
+
+        void* addr{::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                          fd, 0)};
+        ::close(fd);
+
+        if (addr == MAP_FAILED) {
+            ::shm_unlink(name.c_str());
+            throw std::runtime_error("Could not map shared memory segment: " +
+                                     name);
+        }
+
+        return shared_memory{name, addr, size, true};
+    }
+
+    /// Attach read-only to the existing segment @param name
+    static shared_memory attach(const std::string& name) {
+        check_name(name);
+
+        const int fd{::shm_open(name.c_str(), O_RDONLY, 0)};
+        if (fd < 0) {
+            throw std::runtime_error(
+                "Could not open shared memory segment: " + name);
+        }
+
+        struct stat seg_stat {};
+        if (::fstat(fd, &seg_stat) != 0 || seg_stat.st_size <= 0) {
+            ::close(fd);
+            throw std::runtime_error("Shared memory segment is empty: " +
+                                     name);
+        }
+        const auto size{static_cast<std::size_t>(seg_stat.st_size)};
+
+        void* addr{::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)};
+        ::close(fd);
+
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("Could not map shared memory segment: " +
+                                     name);
+        }
+
+        return shared_memory{name, addr, size, false};
+    }
+
+    /// Move only
+    /// @{
+    shared_memory(const shared_memory&) = delete;
+    shared_memory& operator=(const shared_memory&) = delete;
+
+    shared_memory(shared_memory&& other) noexcept
+        : m_name{std::move(other.m_name)},
+          m_addr{std::exchange(other.m_addr, nullptr)},
+          m_size{std::exchange(other.m_size, 0u)},
+          m_is_owner{std::exchange(other.m_is_owner, false)} {}
+
+    shared_memory& operator=(shared_memory&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_name = std::move(other.m_name);
+            m_addr = std::exchange(other.m_addr, nullptr);
+            m_size = std::exchange(other.m_size, 0u);
+            m_is_owner = std::exchange(other.m_is_owner, false);
+        }
+        return *this;
+    }
+    /// @}
+
+    /// Destructor unmaps the segment and removes its name, if owning
+    ~shared_memory() { release(); }
+
+    /// Make the mapping read-only (e.g. after the creator filled it)
+    void seal() {
+        if (::mprotect(m_addr, m_size, PROT_READ) != 0) {
+            throw std::runtime_error(
+                "Could not make shared memory segment read-only: " + m_name);
+        }
+    }
+
+    /// @returns the name of the segment
+    const std::string& name() const { return m_name; }
+
+    /// @returns true if this handle created the segment
+    bool is_owner() const { return m_is_owner; }
+
+    /// @returns the start of the mapped memory
+    std::byte* data() { return static_cast<std::byte*>(m_addr); }
+
+    /// @returns the start of the mapped memory - const
+    const std::byte* data() const {
+        return static_cast<const std::byte*>(m_addr);
+    }
+
+    /// @returns the size of the mapping in bytes
+    std::size_t size() const { return m_size; }
+
+    private:
+    shared_memory(std::string name, void* addr, const std::size_t size,
+                  const bool is_owner)
+        : m_name{std::move(name)},
+          m_addr{addr},
+          m_size{size},
+          m_is_owner{is_owner} {}
+
+    /// POSIX requires the names of portable segments to start with '/'
+    static void check_name(const std::string& name) {
+        if (name.size() < 2u || name.front() != '/') {
+            throw std::invalid_argument(
+                "Shared memory segment name must start with '/': " + name);
+        }
+    }
+
+    /// Release the mapping and the name
+    void release() {
+        if (m_addr != nullptr) {
+            ::munmap(m_addr, m_size);
+            m_addr = nullptr;
+        }
+        if (m_is_owner) {
+            ::shm_unlink(m_name.c_str());
+            m_is_owner = false;
+        }
+    }
+
+    /// Name, start and size of the mapping
+    std::string m_name{};
+    void* m_addr{nullptr};
+    std::size_t m_size{0u};
+    /// Whether to remove the name on destruction
+    bool m_is_owner{false};
+};
+
+}  // namespace detray::io
@@ -11,10 +11,18 @@
 #include "detray/geometry/tracking_volume.hpp"
 #include "detray/plugins/svgtools/conversion/volume.hpp"
 #include "detray/plugins/svgtools/styling/styling.hpp"
+#include "detray/plugins/svgtools/utils/parallel.hpp"
+#include "detray/plugins/svgtools/utils/view_window.hpp"
 
 // Actsvg include(s)
 #include "actsvg/proto/detector.hpp"
 
+// System include(s)
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
 namespace detray::svgtools::conversion {
 
 /// @brief Generates the proto detector object
@@ -25,6 +33,12 @@ namespace detray::svgtools::conversion {
 /// @param hide_portals whether to display portals.
 /// @param hide_passives whether to display passive surfaces.
 /// @param hide_grids whether to display the volume surface grids.
+/// @param window only volumes and surfaces in this region of the view are
+/// converted.
+/// @param max_sensitives only the envelope of volumes with more sensitive
+/// surfaces in the window is converted.
+/// @param n_threads number of threads that convert the volumes (zero:
+/// hardware concurrency).
 ///
 /// @returns An actsvg proto detector representing
 template <typename detector_t, typename view_t>
@@ -33,17 +47,40 @@ auto detector(const typename detector_t::geometry_context& context,
               const styling::detector_style& style =
                   styling::tableau_colorblind::detector_style,
               bool hide_portals = false, bool hide_passives = false,
-              bool hide_grids = false) {
+              bool hide_grids = false, const view_window& window = {},
+              const std::size_t max_sensitives =
+                  std::numeric_limits<std::size_t>::max(),
+              const std::size_t n_threads = 1u) {
 
     using point3_container_t = std::vector<typename detector_t::point3_type>;
-    actsvg::proto::detector<point3_container_t> p_detector;
+    using p_volume_t = actsvg::proto::volume<point3_container_t>;
+
+    // Every volume is converted into its own slot
+    std::vector<std::optional<p_volume_t>> p_volumes(
+        detector.volumes().size());
+
+    svgtools::utils::convert_in_parallel(
+        p_volumes.size(), n_threads, [&](const std::size_t i) {
+            const tracking_volume vol{detector, static_cast<dindex>(i)};
 
-    for (const auto& vol_desc : detector.volumes()) {
-        auto [p_volume, gr_type] = svgtools::conversion::volume(
-            context, detector, tracking_volume{detector, vol_desc}, view,
-            style._volume_style, hide_portals, hide_passives, hide_grids);
+            if (!svgtools::utils::is_visible(context, detector, vol, view,
+                                             window)) {
+                return;
+            }
 
-        p_detector._volumes.push_back(p_volume);
+            auto [p_volume, gr_type] = svgtools::conversion::volume(
+                context, detector, vol, view, style._volume_style,
+                hide_portals, hide_passives, hide_grids, true, {2u, 2u},
+                window, max_sensitives);
+
+            p_volumes[i] = std::move(p_volume);
+        });
+
+    actsvg::proto::detector<point3_container_t> p_detector;
+    for (auto& p_volume : p_volumes) {
+        if (p_volume.has_value()) {
+            p_detector._volumes.push_back(std::move(*p_volume));
+        }
     }
 
     return p_detector;
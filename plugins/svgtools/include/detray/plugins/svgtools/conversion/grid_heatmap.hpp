@@ -0,0 +1,201 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+
+// Plugin include(s)
+#include "detray/plugins/svgtools/conversion/surface_grid.hpp"
+#include "detray/plugins/svgtools/meta/proto/heatmap.hpp"
+#include "detray/plugins/svgtools/styling/styling.hpp"
+
+// Actsvg include(s)
+#include "actsvg/core.hpp"
+#include "actsvg/proto/grid.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace detray::svgtools::conversion {
+
+namespace detail {
+
+/// A functor that returns the global bin index of every bin of a 2D grid, in
+/// the order in which actsvg loops over the bins (@see bin_association_getter)
+struct global_bin_getter {
+
+    template <typename group_t, typename index_t>
+    DETRAY_HOST std::vector<dindex> operator()(
+        [[maybe_unused]] const group_t& group,
+        [[maybe_unused]] const index_t index) const {
+
+        using accel_t = typename group_t::value_type;
+
+        std::vector<dindex> global_bins{};
+
+        if constexpr (concepts::grid<accel_t>) {
+            if constexpr (accel_t::dim == 2u) {
+                using algebra_t =
+                    typename accel_t::local_frame_type::algebra_type;
+                using scalar_t = dscalar<algebra_t>;
+                using point2_t = typename accel_t::point_type;
+
+                const accel_t grid = group[index];
+                global_bins.reserve(grid.nbins());
+
+                auto edges0 = grid.template get_axis<0>().bin_edges();
+                auto edges1 = grid.template get_axis<1>().bin_edges();
+
+                // In the svg convention the phi axis has to be the second
+                // axis to loop over
+                constexpr bool is_cyl{
+                    std::is_same_v<typename accel_t::local_frame_type,
+                                   detray::cylindrical2D<algebra_t>> ||
+                    std::is_same_v<
+                        typename accel_t::local_frame_type,
+                        detray::concentric_cylindrical2D<algebra_t>>};
+                if constexpr (is_cyl) {
+                    edges0.swap(edges1);
+                }
+
+                for (std::size_t i = 1u; i < edges0.size(); ++i) {
+                    scalar_t p0 = 0.5f * (edges0[i] + edges0[i - 1]);
+
+                    for (std::size_t j = 1u; j < edges1.size(); ++j) {
+                        scalar_t p1 = 0.5f * (edges1[j] + edges1[j - 1]);
+
+                        point2_t bin_center{p0, p1};
+                        if constexpr (is_cyl) {
+                            bin_center = {p1, p0};
+                        }
+                        global_bins.push_back(
+                            grid.serialize(grid.axes().bins(bin_center)));
+                    }
+                }
+            }
+        }
+
+        return global_bins;
+    }
+};
+
+/// @returns the outline of the bin [@param e0_low, @param e0_high] x
+/// [@param e1_low, @param e1_high] of an actsvg grid of type @param type
+inline std::vector<actsvg::point2> bin_outline(
+    const actsvg::proto::grid::type type, const actsvg::scalar e0_low,
+    const actsvg::scalar e0_high, const actsvg::scalar e1_low,
+    const actsvg::scalar e1_high) {
+
+    // Rectangular bins in the view
+    if (type != actsvg::proto::grid::e_r_phi) {
+        return {{e0_low, e1_low},
+                {e0_high, e1_low},
+                {e0_high, e1_high},
+                {e0_low, e1_high}};
+    }
+
+    // Sector of a ring: Approximate the arcs by line segments
+    constexpr std::size_t n_segments{8u};
+    const actsvg::scalar delta_phi{(e1_high - e1_low) /
+                                   static_cast<actsvg::scalar>(n_segments)};
+
+    std::vector<actsvg::point2> outline{};
+    outline.reserve(2u * (n_segments + 1u));
+    for (std::size_t i = 0u; i <= n_segments; ++i) {
+        const actsvg::scalar phi{e1_low +
+                                 static_cast<actsvg::scalar>(i) * delta_phi};
+        outline.push_back({e0_high * math::cos(phi), e0_high * math::sin(phi)});
+    }
+    for (std::size_t i = 0u; i <= n_segments; ++i) {
+        const actsvg::scalar phi{e1_high -
+                                 static_cast<actsvg::scalar>(i) * delta_phi};
+        outline.push_back({e0_low * math::cos(phi), e0_low * math::sin(phi)});
+    }
+
+    return outline;
+}
+
+}  // namespace detail
+
+/// @brief Converts per-bin values of the surface grid of a detray volume to a
+/// proto heatmap.
+///
+/// Barrel grids can be displayed in the z-phi and z-rphi views, disc and
+/// rectangular grids in the x-y view.
+///
+/// @param detector the detector
+/// @param index the index of the grid's volume
+/// @param values one value per global bin index of the grid
+/// @param view the view
+/// @param style the style settings of the bin outlines
+///
+/// @returns a proto heatmap, if the grid can be displayed in the view
+template <typename detector_t, typename value_t, typename view_t>
+auto grid_heatmap(const detector_t& detector, const dindex index,
+                  const std::vector<value_t>& values, const view_t& view,
+                  const styling::grid_style& style =
+                      styling::tableau_colorblind::grid_style) {
+
+    using geo_object_ids = typename detector_t::geo_obj_ids;
+
+    auto [p_grid, gr_type] =
+        svgtools::conversion::surface_grid(detector, index, view, style);
+
+    if (!p_grid.has_value() || p_grid->_edges_0.size() < 2u ||
+        p_grid->_edges_1.size() < 2u) {
+        return std::optional<svgtools::meta::proto::heatmap>{};
+    }
+
+    // The bin order of barrel grids only matches the z-phi projection
+    if (gr_type == detail::grid_type::e_barrel &&
+        p_grid->_type != actsvg::proto::grid::e_z_phi) {
+        return std::optional<svgtools::meta::proto::heatmap>{};
+    }
+
+    const auto& vol_desc = detector.volume(index);
+    const std::vector<dindex> global_bins =
+        detector.accelerator_store().template visit<detail::global_bin_getter>(
+            vol_desc.template accel_link<geo_object_ids::e_sensitive>());
+
+    svgtools::meta::proto::heatmap p_heatmap;
+    p_heatmap._name = "grid_heatmap_" + std::to_string(index);
+    p_heatmap._stroke._sc = style._stroke_color;
+    p_heatmap._stroke._width = style._stroke_width;
+
+    const auto& edges0 = p_grid->_edges_0;
+    const auto& edges1 = p_grid->_edges_1;
+
+    std::size_t svg_bin{0u};
+    for (std::size_t i = 1u; i < edges0.size(); ++i) {
+        for (std::size_t j = 1u; j < edges1.size(); ++j, ++svg_bin) {
+            if (svg_bin >= global_bins.size()) {
+                break;
+            }
+            const dindex gbin{global_bins[svg_bin]};
+
+            p_heatmap._bins.push_back(
+                detail::bin_outline(p_grid->_type, edges0[i - 1], edges0[i],
+                                    edges1[j - 1], edges1[j]));
+            p_heatmap._values.push_back(
+                gbin < values.size()
+                    ? static_cast<actsvg::scalar>(values[gbin])
+                    : 0.f);
+        }
+    }
+
+    return std::optional<svgtools::meta::proto::heatmap>{p_heatmap};
+}
+
+}  // namespace detray::svgtools::conversion
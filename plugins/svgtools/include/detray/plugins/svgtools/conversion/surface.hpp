@@ -36,8 +36,11 @@ inline void set_measures(
     auto cast_scalar = [](const typename mask_t::scalar_type& v) {
         return static_cast<actsvg::scalar>(v);
     };
-    std::ranges::transform(m.values(), std::back_inserter(p_surface._measures),
-                           cast_scalar);
+    // Only the boundary values (without values derived from them)
+    std::ranges::transform(
+        std::cbegin(m.values()),
+        std::cbegin(m.values()) + mask_t::boundaries::e_size,
+        std::back_inserter(p_surface._measures), cast_scalar);
 }
 
 /// @brief Sets the vertices of the proto surface to be the same as the mask.
@@ -16,6 +16,9 @@
 #include "detray/plugins/svgtools/styling/styling.hpp"
 
 // System include(s)
+#include <ranges>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace detray::svgtools::conversion {
@@ -36,6 +39,30 @@ inline auto trajectory(const std::vector<point3_t>& points,
     return p_trajectory;
 }
 
+/// @param steps the steps that were recorded along a track (e.g. by a step
+///              tracer in a device propagation), which provide a position
+/// @param style the style settings
+///
+/// @returns The proto trajectory through the positions of the steps
+template <std::ranges::input_range step_range_t>
+requires concepts::point3D<std::remove_cvref_t<
+    decltype(std::declval<std::ranges::range_value_t<step_range_t>>().pos)>>
+inline auto trajectory(const step_range_t& steps,
+                       const styling::trajectory_style& style =
+                           styling::svg_default::trajectory_style) {
+
+    using point3_t = std::remove_cvref_t<
+        decltype(std::declval<std::ranges::range_value_t<step_range_t>>()
+                     .pos)>;
+
+    std::vector<point3_t> points;
+    for (const auto& step : steps) {
+        points.push_back(step.pos);
+    }
+
+    return trajectory(points, style);
+}
+
 /// @param traj the trajectory
 /// @param path_legth the length of the path
 /// @param step_size the step size, ie., ds
@@ -16,6 +16,7 @@
 #include "detray/plugins/svgtools/conversion/surface.hpp"
 #include "detray/plugins/svgtools/conversion/surface_grid.hpp"
 #include "detray/plugins/svgtools/styling/styling.hpp"
+#include "detray/plugins/svgtools/utils/view_window.hpp"
 
 // Actsvg include(s)
 #include "actsvg/display/geometry.hpp"
@@ -23,6 +24,7 @@
 #include "actsvg/proto/volume.hpp"
 
 // System include(s)
+#include <limits>
 #include <map>
 #include <string>
 #include <tuple>
@@ -40,6 +42,10 @@ namespace detray::svgtools::conversion {
 /// @param hide_passives whether to display the contained passive surfaces.
 /// @param hide_grids whether to display the contained surface grid.
 /// @param search_window neighborhood search window for the grid.
+/// @param window only surfaces that overlap this region of the view are
+/// converted.
+/// @param max_sensitives if more sensitive surfaces of the volume are in the
+/// window, only the volume envelope (portals and passives) is converted.
 ///
 /// @returns An actsvg proto volume representing the volume.
 template <typename detector_t, typename view_t>
@@ -51,7 +57,10 @@ auto volume(const typename detector_t::geometry_context& context,
                 styling::tableau_colorblind::volume_style,
             bool hide_portals = false, bool hide_passives = false,
             bool hide_grids = false, bool hide_material = true,
-            const std::array<dindex, 2>& search_window = {2u, 2u}) {
+            const std::array<dindex, 2>& search_window = {2u, 2u},
+            const view_window& window = {},
+            const std::size_t max_sensitives =
+                std::numeric_limits<std::size_t>::max()) {
 
     using point3_container_t = std::vector<typename detector_t::point3_type>;
 
@@ -65,10 +74,25 @@ auto volume(const typename detector_t::geometry_context& context,
     auto [p_grid, grid_type] = svgtools::conversion::surface_grid(
         detector, p_volume._index, view, style._grid_style);
 
+    // Surfaces that are (at least partially) inside the view window
+    std::vector<detray::geometry::surface<detector_t>> visible_sfs{};
+    std::size_t n_sensitives{0u};
+    std::size_t n_visible_sensitives{0u};
     for (const auto& desc : d_volume.surfaces()) {
-
         const auto sf = detray::geometry::surface<detector_t>{detector, desc};
 
+        n_sensitives += sf.is_sensitive() ? 1u : 0u;
+        if (svgtools::utils::is_visible(context, sf, view, window)) {
+            visible_sfs.push_back(sf);
+            n_visible_sensitives += sf.is_sensitive() ? 1u : 0u;
+        }
+    }
+
+    // Coarse level of detail: Draw the envelope instead of the modules
+    const bool hide_sensitives{n_visible_sensitives > max_sensitives};
+
+    for (const auto& sf : visible_sfs) {
+
         if (sf.is_portal()) {
             if (!hide_portals) {
                 auto p_portal = svgtools::conversion::portal(
@@ -77,7 +101,8 @@ auto volume(const typename detector_t::geometry_context& context,
 
                 p_volume._portals.push_back(p_portal);
             }
-        } else if (!(sf.is_passive() && hide_passives)) {
+        } else if (!(sf.is_passive() && hide_passives) &&
+                   !(sf.is_sensitive() && hide_sensitives)) {
 
             const auto& sf_style = sf.is_sensitive()
                                        ? style._sensitive_surface_style
@@ -102,8 +127,12 @@ auto volume(const typename detector_t::geometry_context& context,
     // Add the proto grid to the proto volume and find bin associations
     if (!hide_grids && p_grid.has_value()) {
         p_volume._surface_grid = *p_grid;
-        p_volume._grid_associations = {
-            get_bin_association(detector, d_volume, search_window)};
+
+        // The associations refer to the full list of sensitive surfaces
+        if (!hide_sensitives && n_visible_sensitives == n_sensitives) {
+            p_volume._grid_associations = {
+                get_bin_association(detector, d_volume, search_window)};
+        }
     }
 
     p_volume._surfaces = {std::move(p_sensitves)};
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2023-2024 CERN for the benefit of the ACTS project
+ * (c) 2023-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 #include "detray/geometry/surface.hpp"
 #include "detray/plugins/svgtools/conversion/detector.hpp"
 #include "detray/plugins/svgtools/conversion/grid.hpp"
+#include "detray/plugins/svgtools/conversion/grid_heatmap.hpp"
 #include "detray/plugins/svgtools/conversion/information_section.hpp"
 #include "detray/plugins/svgtools/conversion/intersection.hpp"
 #include "detray/plugins/svgtools/conversion/landmark.hpp"
@@ -20,11 +21,14 @@
 #include "detray/plugins/svgtools/conversion/trajectory.hpp"
 #include "detray/plugins/svgtools/conversion/volume.hpp"
 #include "detray/plugins/svgtools/meta/display/geometry.hpp"
+#include "detray/plugins/svgtools/meta/display/heatmap.hpp"
 #include "detray/plugins/svgtools/meta/display/information.hpp"
 #include "detray/plugins/svgtools/meta/display/tracking.hpp"
 #include "detray/plugins/svgtools/meta/proto/eta_lines.hpp"
 #include "detray/plugins/svgtools/styling/styling.hpp"
 #include "detray/plugins/svgtools/utils/groups.hpp"
+#include "detray/plugins/svgtools/utils/parallel.hpp"
+#include "detray/plugins/svgtools/utils/view_window.hpp"
 #include "detray/utils/ranges.hpp"
 
 // Actsvg include(s)
@@ -32,8 +36,12 @@
 
 // System include(s)
 #include <array>
+#include <cstddef>
+#include <limits>
 #include <optional>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 namespace detray::svgtools {
@@ -92,6 +100,18 @@ class illustrator {
     void search_window(std::array<dindex, 2> window) {
         _search_window = window;
     }
+    /// Only draw the objects in the region @param region of the view
+    /// @param view (xy- and zr-view)
+    template <typename view_t>
+    requires utils::is_cullable_v<view_t> void window(
+        const view_t& /*view*/, const view_window& region) {
+        _windows[window_index<view_t>()] = region;
+    }
+    /// Level of detail: Only draw the envelope of volumes that have more than
+    /// @param n sensitive surfaces in the view window
+    void max_sensitives(std::size_t n) { _max_sensitives = n; }
+    /// Number of threads to convert the volumes with (zero: hardware threads)
+    void n_threads(std::size_t n) { _n_threads = n; }
     /// @returns the detector name
     const std::string& det_name() const { return _detector.name(_name_map); }
 
@@ -177,7 +197,15 @@ class illustrator {
         auto material =
             svgtools::utils::group(det_name() + "_material_" + svg_id(view));
 
-        for (const auto [i, index] : detray::views::enumerate(indices)) {
+        bool has_gradient_box{false};
+        for (const auto index : indices) {
+            // Skip surfaces outside of the view window
+            const detray::geometry::surface<detector_t> sf{_detector, index};
+            if (!svgtools::utils::is_visible(gctx, sf, view,
+                                             get_window(view))) {
+                continue;
+            }
+
             auto [sf_svg, mat_svg] = draw_surface(index, view, gctx);
 
             ret.add_object(sf_svg);
@@ -185,8 +213,9 @@ class illustrator {
             // Material is optional
             if (mat_svg.is_defined()) {
                 // Only add one gradient box
-                if (i == 0) {
+                if (!has_gradient_box) {
                     material.add_object(mat_svg);
+                    has_gradient_box = true;
                 } else {
                     material.add_object(mat_svg._sub_objects[0]);
                 }
@@ -287,57 +316,16 @@ class illustrator {
         const dindex index, const view_t& view,
         const typename detector_t::geometry_context& gctx = {}) const {
 
-        const auto d_volume = tracking_volume{_detector, index};
-
-        auto [p_volume, gr_type] = svgtools::conversion::volume(
-            gctx, _detector, d_volume, view,
-            _style._detector_style._volume_style, _hide_portals, _hide_passives,
-            _hide_grids, _hide_material, _search_window);
-
-        // Draw the basic volume
-        p_volume._name = d_volume.name(_name_map);
-        std::string id = p_volume._name + "_" + svg_id(view);
-        auto vol_svg = svgtools::utils::group(id);
-
-        [[maybe_unused]] auto display_mode =
-            _hide_grids ? actsvg::display::e_module_info
-                        : actsvg::display::e_grid_info;
-
-        actsvg::svg::object sheet;
-
-        // zr and xy - views of volume including the portals
-        if constexpr (!std::is_same_v<view_t, actsvg::views::z_phi>) {
-
-            vol_svg.add_object(actsvg::display::volume(id, p_volume, view));
-
-            if (!_hide_grids) {
-                auto grid_svg =
-                    actsvg::display::grid(id + "_grid", p_volume._surface_grid);
-                vol_svg.add_object(grid_svg);
-            }
-
-            // Display the surfaces connected to the grid: in zphi-view for
-            // barrel, and xy-view for endcaps
-        } else if (gr_type == conversion::detail::grid_type::e_barrel) {
-            p_volume._name = det_name() + "_" + p_volume._name;
-            sheet = actsvg::display::barrel_sheet(
-                p_volume._name + "_sheet_zphi", p_volume, {800, 800},
-                display_mode);
-        }
-        if constexpr (std::is_same_v<view_t, actsvg::views::x_y>) {
-            if (gr_type == conversion::detail::grid_type::e_endcap) {
-                p_volume._name = det_name() + "_" + p_volume._name;
-                sheet = actsvg::display::endcap_sheet(
-                    p_volume._name + "_sheet_xy", p_volume, {800, 800},
-                    display_mode);
-            }
-        }
+        auto [p_volume, gr_type] = convert_volume(index, view, gctx);
 
-        return std::tuple{vol_svg, sheet};
+        return display_volume(std::move(p_volume), gr_type, view);
     }
 
     /// @brief Converts multiple detray volumes of the detector to an svg.
     ///
+    /// The volumes are converted on several threads (@see n_threads ) and
+    /// volumes outside of the view window are skipped.
+    ///
     /// @param indices the collection of volume indices in the detector to
     /// convert.
     /// @param view the display view.
@@ -349,15 +337,25 @@ class illustrator {
         const range_t& indices, const view_t& view,
         const typename detector_t::geometry_context& gctx = {}) const {
 
+        auto p_volumes = convert_volumes(
+            std::vector<dindex>(std::ranges::begin(indices),
+                                std::ranges::end(indices)),
+            view, gctx);
+
         // Overlay the volume svgs
         auto vol_group =
             svgtools::utils::group(det_name() + "_volumes_" + svg_id(view));
         // The surface[grid] sheets per volume
         std::vector<actsvg::svg::object> sheets;
 
-        for (const auto index : indices) {
+        for (auto& p_volume : p_volumes) {
+            if (!p_volume.has_value()) {
+                continue;
+            }
 
-            auto [vol_svg, sheet] = draw_volume(index, view, gctx);
+            auto [vol_svg, sheet] =
+                display_volume(std::move(std::get<0>(*p_volume)),
+                               std::get<1>(*p_volume), view);
 
             // The general volume display
             if constexpr (!std::is_same_v<view_t, actsvg::views::z_phi>) {
@@ -382,7 +380,8 @@ class illustrator {
 
         auto p_detector = svgtools::conversion::detector(
             gctx, _detector, view, _style._detector_style, _hide_portals,
-            _hide_passives, _hide_grids);
+            _hide_passives, _hide_grids, get_window(view), _max_sensitives,
+            _n_threads);
 
         std::string id = det_name() + "_" + svg_id(view);
 
@@ -391,22 +390,101 @@ class illustrator {
 
         if constexpr (std::is_same_v<view_t, actsvg::views::z_r>) {
             if (!_hide_eta_lines) {
+                det_svg.add_object(draw_eta_lines());
+            }
+        }
+
+        return det_svg;
+    }
+
+    /// @brief Converts detray volumes of the detector to svgs and writes
+    /// them to @param writer one after the other.
+    ///
+    /// Only one batch of volumes (one volume per conversion thread) is kept in
+    /// memory at a time. The surface[grid] sheets are not written.
+    ///
+    /// @param writer the svg writer (@see svgtools::svg_stream_writer ).
+    /// @param indices the collection of volume indices in the detector to
+    /// convert.
+    /// @param view the display view.
+    /// @param gctx the geometry context.
+    ///
+    /// @returns the number of volumes that were written.
+    template <typename writer_t, detray::ranges::range range_t,
+              typename view_t>
+    inline std::size_t stream_volumes(
+        writer_t& writer, const range_t& indices, const view_t& view,
+        const typename detector_t::geometry_context& gctx = {}) const {
 
-                auto p_eta_lines = svgtools::meta::proto::eta_lines{};
+        // The volumes are only displayed as surface sheets in zphi-view
+        if constexpr (std::is_same_v<view_t, actsvg::views::z_phi>) {
+            return 0u;
+        } else {
+            const std::vector<dindex> vol_indices(std::ranges::begin(indices),
+                                                  std::ranges::end(indices));
+
+            const std::size_t batch_size{
+                _n_threads == 0u
+                    ? std::max(1u, std::thread::hardware_concurrency())
+                    : _n_threads};
+
+            std::size_t n_written{0u};
+            for (std::size_t first = 0u; first < vol_indices.size();
+                 first += batch_size) {
+
+                const auto last = vol_indices.begin() +
+                                  static_cast<std::ptrdiff_t>(std::min(
+                                      first + batch_size, vol_indices.size()));
+
+                auto p_volumes = convert_volumes(
+                    std::vector<dindex>(
+                        vol_indices.begin() +
+                            static_cast<std::ptrdiff_t>(first),
+                        last),
+                    view, gctx);
+
+                for (auto& p_volume : p_volumes) {
+                    if (!p_volume.has_value()) {
+                        continue;
+                    }
+                    auto [vol_svg, sheet] =
+                        display_volume(std::move(std::get<0>(*p_volume)),
+                                       std::get<1>(*p_volume), view);
+
+                    writer.write(vol_svg);
+                    ++n_written;
+                }
+            }
 
-                svgtools::styling::apply_style(p_eta_lines,
-                                               _style._eta_lines_style);
+            return n_written;
+        }
+    }
 
-                // Hardcoded until we find a way to scale axes automatically
-                p_eta_lines._r = 1100.f;
-                p_eta_lines._z = 3100.f;
+    /// @brief Converts a detray detector to svgs and writes them to
+    /// @param writer one volume after the other (@see stream_volumes ).
+    ///
+    /// @param writer the svg writer (@see svgtools::svg_stream_writer ).
+    /// @param view the display view.
+    /// @param gctx the geometry context.
+    ///
+    /// @returns the number of volumes that were written.
+    template <typename writer_t, typename view_t>
+    inline std::size_t stream_detector(
+        writer_t& writer, const view_t& view,
+        const typename detector_t::geometry_context& gctx = {}) const {
 
-                det_svg.add_object(svgtools::meta::display::eta_lines(
-                    "eta_lines_", p_eta_lines));
+        const auto n_volumes{static_cast<dindex>(_detector.volumes().size())};
+
+        const std::size_t n_written{stream_volumes(
+            writer, detray::views::iota(dindex{0u}, n_volumes), view, gctx)};
+
+        if constexpr (std::is_same_v<view_t, actsvg::views::z_r>) {
+            if (!_hide_eta_lines) {
+                writer.write(draw_eta_lines());
             }
         }
 
-        return det_svg;
+        return n_written;
     }
 
     /// @brief Converts a point to an svg.
@@ -426,6 +504,32 @@ class illustrator {
                                                  p_landmark, view);
     }
 
+    /// @brief Converts per-bin values of the surface grid of a volume to an
+    /// svg heatmap (e.g. the counts of a navigation heatmap).
+    ///
+    /// @param prefix the id of the svg object.
+    /// @param index the index of the volume in the detector.
+    /// @param values one value per global bin index of the grid.
+    /// @param view the display view.
+    ///
+    /// @return actsvg::svg::object of the heatmap, empty if the grid cannot
+    /// be displayed in the view.
+    template <typename view_t, typename value_t>
+    inline auto draw_grid_heatmap(const std::string& prefix, const dindex index,
+                                  const std::vector<value_t>& values,
+                                  const view_t& view) const {
+        const auto p_heatmap = svgtools::conversion::grid_heatmap(
+            _detector, index, values, view,
+            _style._detector_style._volume_style._grid_style);
+
+        if (!p_heatmap.has_value()) {
+            return actsvg::svg::object{};
+        }
+
+        return svgtools::meta::display::heatmap(prefix + "_grid_heatmap",
+                                                *p_heatmap);
+    }
+
     /// @brief Converts a collection of intersections to an svg.
     ///
     /// @param prefix the id of the svg object.
@@ -543,12 +647,132 @@ class illustrator {
     }
 
     private:
+    /// @returns the svg of the eta lines for the zr-view
+    inline auto draw_eta_lines() const {
+
+        auto p_eta_lines = svgtools::meta::proto::eta_lines{};
+
+        svgtools::styling::apply_style(p_eta_lines, _style._eta_lines_style);
+
+        // Hardcoded until we find a way to scale axes automatically
+        p_eta_lines._r = 1100.f;
+        p_eta_lines._z = 3100.f;
+
+        return svgtools::meta::display::eta_lines("eta_lines_", p_eta_lines);
+    }
+
+    /// @returns the proto volumes of the volumes @param indices that are in
+    /// the view window, converted on several threads (empty if the volume is
+    /// outside the window)
+    template <typename view_t>
+    inline auto convert_volumes(
+        const std::vector<dindex>& indices, const view_t& view,
+        const typename detector_t::geometry_context& gctx) const {
+
+        using p_volume_t = decltype(convert_volume(dindex{}, view, gctx));
+
+        // Convert the volumes into their own slots
+        std::vector<std::optional<p_volume_t>> p_volumes(indices.size());
+        svgtools::utils::convert_in_parallel(
+            indices.size(), _n_threads, [&](const std::size_t i) {
+                const tracking_volume vol{_detector, indices[i]};
+                if (svgtools::utils::is_visible(gctx, _detector, vol, view,
+                                                get_window(view))) {
+                    p_volumes[i] = convert_volume(indices[i], view, gctx);
+                }
+            });
+
+        return p_volumes;
+    }
+
+    /// @returns the proto volume and grid type of the volume @param index
+    template <typename view_t>
+    inline auto convert_volume(
+        const dindex index, const view_t& view,
+        const typename detector_t::geometry_context& gctx) const {
+
+        const auto d_volume = tracking_volume{_detector, index};
+
+        auto [p_volume, gr_type] = svgtools::conversion::volume(
+            gctx, _detector, d_volume, view,
+            _style._detector_style._volume_style, _hide_portals, _hide_passives,
+            _hide_grids, _hide_material, _search_window, get_window(view),
+            _max_sensitives);
+
+        p_volume._name = d_volume.name(_name_map);
+
+        return std::tuple{std::move(p_volume), gr_type};
+    }
+
+    /// @returns the svg of the proto volume @param p_volume and its surface
+    /// sheet for a grid of type @param gr_type
+    template <typename p_volume_t, typename grid_type_t, typename view_t>
+    inline auto display_volume(p_volume_t p_volume, const grid_type_t gr_type,
+                               const view_t& view) const {
+
+        // Draw the basic volume
+        std::string id = p_volume._name + "_" + svg_id(view);
+        auto vol_svg = svgtools::utils::group(id);
+
+        [[maybe_unused]] auto display_mode =
+            _hide_grids ? actsvg::display::e_module_info
+                        : actsvg::display::e_grid_info;
+
+        actsvg::svg::object sheet;
+
+        // zr and xy - views of volume including the portals
+        if constexpr (!std::is_same_v<view_t, actsvg::views::z_phi>) {
+
+            vol_svg.add_object(actsvg::display::volume(id, p_volume, view));
+
+            if (!_hide_grids) {
+                auto grid_svg =
+                    actsvg::display::grid(id + "_grid", p_volume._surface_grid);
+                vol_svg.add_object(grid_svg);
+            }
+
+            // Display the surfaces connected to the grid: in zphi-view for
+            // barrel, and xy-view for endcaps
+        } else if (gr_type == conversion::detail::grid_type::e_barrel) {
+            p_volume._name = det_name() + "_" + p_volume._name;
+            sheet = actsvg::display::barrel_sheet(
+                p_volume._name + "_sheet_zphi", p_volume, {800, 800},
+                display_mode);
+        }
+        if constexpr (std::is_same_v<view_t, actsvg::views::x_y>) {
+            if (gr_type == conversion::detail::grid_type::e_endcap) {
+                p_volume._name = det_name() + "_" + p_volume._name;
+                sheet = actsvg::display::endcap_sheet(
+                    p_volume._name + "_sheet_xy", p_volume, {800, 800},
+                    display_mode);
+            }
+        }
+
+        return std::tuple{vol_svg, sheet};
+    }
+
     /// @returns the string id of a view
     template <typename view_t>
     std::string svg_id(const view_t& view) const {
         return view._axis_names[0] + view._axis_names[1];
     }
 
+    /// @returns the position of the window of a view in the window array
+    template <typename view_t>
+    static constexpr std::size_t window_index() {
+        return std::is_same_v<view_t, actsvg::views::x_y> ? 0u : 1u;
+    }
+
+    /// @returns the view window of the view @param view
+    template <typename view_t>
+    view_window get_window(const view_t& /*view*/) const {
+        if constexpr (utils::is_cullable_v<view_t>) {
+            return _windows[window_index<view_t>()];
+        } else {
+            return {};
+        }
+    }
+
     const actsvg::point2 _info_screen_offset{-300, 300};
     const detector_t& _detector;
     const typename detector_t::name_map& _name_map;
@@ -559,6 +783,9 @@ class illustrator {
     bool _hide_portals = false;
     bool _hide_passives = false;
     std::array<dindex, 2> _search_window = {2u, 2u};
+    std::array<view_window, 2> _windows = {};
+    std::size_t _max_sensitives = std::numeric_limits<std::size_t>::max();
+    std::size_t _n_threads = 1u;
     styling::style _style = styling::tableau_colorblind::style;
 };
 
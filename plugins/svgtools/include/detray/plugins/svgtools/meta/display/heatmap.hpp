@@ -0,0 +1,62 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/plugins/svgtools/meta/proto/heatmap.hpp"
+
+// Actsvg include(s)
+#include "actsvg/core.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace detray::svgtools::meta::display {
+
+/// @brief Converts a proto heatmap to a SVG object.
+///
+/// The bins are filled with a color between the low and high color of the
+/// heatmap, linear in the bin value relative to the largest value.
+inline auto heatmap(const std::string& id,
+                    const svgtools::meta::proto::heatmap& hm) {
+    actsvg::svg::object ret;
+    ret._tag = "g";
+    ret._id = id;
+
+    actsvg::scalar max_value{0.f};
+    for (const actsvg::scalar v : hm._values) {
+        max_value = std::max(max_value, v);
+    }
+
+    const std::size_t n_bins{std::min(hm._bins.size(), hm._values.size())};
+    for (std::size_t i = 0u; i < n_bins; ++i) {
+        const actsvg::scalar t{
+            max_value > 0.f ? std::clamp(hm._values[i] / max_value, 0.f, 1.f)
+                            : 0.f};
+
+        actsvg::style::fill bin_fill;
+        for (std::size_t c = 0u; c < 3u; ++c) {
+            const auto low = static_cast<actsvg::scalar>(hm._low_color._rgb[c]);
+            const auto high =
+                static_cast<actsvg::scalar>(hm._high_color._rgb[c]);
+            bin_fill._fc._rgb[c] =
+                static_cast<int>(std::round(low + t * (high - low)));
+        }
+        bin_fill._fc._opacity = 0.8f;
+
+        ret.add_object(actsvg::draw::polygon(id + "_bin_" + std::to_string(i),
+                                             hm._bins[i], bin_fill,
+                                             hm._stroke));
+    }
+
+    return ret;
+}
+
+}  // namespace detray::svgtools::meta::display
@@ -0,0 +1,35 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Actsvg include(s)
+#include "actsvg/core.hpp"
+
+// System include(s)
+#include <string>
+#include <vector>
+
+namespace detray::svgtools::meta::proto {
+
+/// @brief A proto heatmap class as a simple translation layer from a value
+/// per bin of a 2D grid.
+struct heatmap {
+    /// Outline of every bin in view coordinates
+    std::vector<std::vector<actsvg::point2>> _bins{};
+    /// Value per bin (same order as the outlines)
+    std::vector<actsvg::scalar> _values{};
+    std::string _name{"unknown heatmap"};
+    /// Fill colors of the smallest and largest value
+    /// @{
+    actsvg::style::color _low_color{{255, 255, 255}};
+    actsvg::style::color _high_color{{214, 39, 40}};
+    /// @}
+    actsvg::style::stroke _stroke{};
+};
+
+}  // namespace detray::svgtools::meta::proto
@@ -0,0 +1,65 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace detray::svgtools::utils {
+
+/// @brief Run the conversion @param convert on the items [0, @param n_items )
+/// with up to @param n_threads threads (zero: hardware concurrency)
+///
+/// Every thread converts a contiguous range of items, so the conversion
+/// should only write to data that belongs to its item. If conversions fail,
+/// the exception of the failing item with the lowest index is rethrown after
+/// all threads finished.
+template <typename convert_t>
+inline void convert_in_parallel(const std::size_t n_items,
+                                std::size_t n_threads,
+                                const convert_t& convert) {
+
+    if (n_threads == 0u) {
+        n_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    n_threads = std::clamp(n_items, std::size_t{1u}, n_threads);
+
+    std::vector<std::exception_ptr> errors(n_threads);
+    auto convert_range = [&](const std::size_t w) {
+        const std::size_t end{(w + 1u) * n_items / n_threads};
+        try {
+            for (std::size_t i = w * n_items / n_threads; i < end; ++i) {
+                convert(i);
+            }
+        } catch (...) {
+            errors[w] = std::current_exception();
+        }
+    };
+
+    // The calling thread converts as well
+    std::vector<std::thread> workers{};
+    for (std::size_t w = 1u; w < n_threads; ++w) {
+        workers.emplace_back(convert_range, w);
+    }
+    convert_range(0u);
+    for (std::thread& w : workers) {
+        w.join();
+    }
+
+    for (const std::exception_ptr& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
+}  // namespace detray::svgtools::utils
@@ -0,0 +1,225 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/utils/bounding_volume.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Actsvg include(s)
+#include "actsvg/core.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace detray::svgtools {
+
+/// @brief Rectangular region of a display view that should be drawn.
+///
+/// The ranges are given in the coordinates of the view (e.g. x and y for the
+/// xy-view, z and r for the zr-view). Objects that lie completely outside of
+/// the window are not converted. Only the xy- and zr-views are culled, all
+/// other views are always drawn in full.
+struct view_window {
+    static constexpr actsvg::scalar inf{
+        std::numeric_limits<actsvg::scalar>::infinity()};
+
+    /// Range on the horizontal axis of the view
+    std::array<actsvg::scalar, 2> _x_range{-inf, inf};
+    /// Range on the vertical axis of the view
+    std::array<actsvg::scalar, 2> _y_range{-inf, inf};
+
+    /// @returns true if the window covers the entire view
+    constexpr bool is_unbounded() const {
+        return _x_range[0] == -inf && _x_range[1] == inf &&
+               _y_range[0] == -inf && _y_range[1] == inf;
+    }
+
+    /// @returns true if the rectangle spanned by @param x_range and
+    /// @param y_range overlaps with the window
+    constexpr bool overlaps(
+        const std::array<actsvg::scalar, 2>& x_range,
+        const std::array<actsvg::scalar, 2>& y_range) const {
+        return x_range[0] <= _x_range[1] && x_range[1] >= _x_range[0] &&
+               y_range[0] <= _y_range[1] && y_range[1] >= _y_range[0];
+    }
+};
+
+namespace utils {
+
+namespace detail {
+
+/// Build the global bounding box around a surface
+struct global_box_getter {
+
+    template <typename mask_group_t, typename index_t,
+              concepts::transform3D transform3_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t& mask_group,
+                                       const index_t& index,
+                                       const transform3_t& trf) const {
+        using mask_t = typename mask_group_t::value_type;
+        using box_t =
+            axis_aligned_bounding_volume<cuboid3D,
+                                         typename mask_t::algebra_type>;
+
+        // Local minimum bounding box
+        const box_t box{
+            mask_group.at(index), 0u,
+            std::numeric_limits<typename mask_t::scalar_type>::epsilon()};
+
+        // Bounding box in global coordinates (might no longer be minimum)
+        const auto glob_box = box.transform(trf);
+
+        std::array<actsvg::scalar, 6> bounds;
+        for (std::size_t i = 0u; i < bounds.size(); ++i) {
+            bounds[i] = static_cast<actsvg::scalar>(glob_box[i]);
+        }
+        return bounds;
+    }
+};
+
+/// @returns the distance of the origin to the interval [@param min,
+/// @param max ]
+constexpr actsvg::scalar distance_to_origin(
+    const actsvg::scalar min, const actsvg::scalar max) {
+    return (min > 0.f) ? min : ((max < 0.f) ? -max : 0.f);
+}
+
+}  // namespace detail
+
+/// @returns whether the view @tparam view_t can be culled
+template <typename view_t>
+inline constexpr bool is_cullable_v =
+    std::is_same_v<view_t, actsvg::views::x_y> ||
+    std::is_same_v<view_t, actsvg::views::z_r>;
+
+/// @returns the extent of the global box @param bounds (min x, y, z and
+/// max x, y, z) in the coordinates of the view @param view
+template <typename view_t>
+inline auto project(const std::array<actsvg::scalar, 6>& bounds,
+                    const view_t& /*view*/) {
+
+    using box = cuboid3D;
+
+    std::array<actsvg::scalar, 2> x_range{};
+    std::array<actsvg::scalar, 2> y_range{};
+
+    if constexpr (std::is_same_v<view_t, actsvg::views::x_y>) {
+        x_range = {bounds[box::e_min_x], bounds[box::e_max_x]};
+        y_range = {bounds[box::e_min_y], bounds[box::e_max_y]};
+    } else if constexpr (std::is_same_v<view_t, actsvg::views::z_r>) {
+        x_range = {bounds[box::e_min_z], bounds[box::e_max_z]};
+
+        // Closest and farthest point of the box to the z-axis
+        const actsvg::scalar max_x{math::max(math::fabs(bounds[box::e_min_x]),
+                                             math::fabs(bounds[box::e_max_x]))};
+        const actsvg::scalar max_y{math::max(math::fabs(bounds[box::e_min_y]),
+                                             math::fabs(bounds[box::e_max_y]))};
+        const actsvg::scalar min_x{detail::distance_to_origin(
+            bounds[box::e_min_x], bounds[box::e_max_x])};
+        const actsvg::scalar min_y{detail::distance_to_origin(
+            bounds[box::e_min_y], bounds[box::e_max_y])};
+
+        y_range = {math::sqrt(min_x * min_x + min_y * min_y),
+                   math::sqrt(max_x * max_x + max_y * max_y)};
+    }
+
+    return std::tuple{x_range, y_range};
+}
+
+/// @returns true if the surface @param sf could be visible in the window
+/// @param window of the view @param view
+template <typename detector_t, typename view_t>
+inline bool is_visible(const typename detector_t::geometry_context& context,
+                       const detray::geometry::surface<detector_t>& sf,
+                       const view_t& view, const view_window& window) {
+
+    if constexpr (!is_cullable_v<view_t>) {
+        return true;
+    } else {
+        if (window.is_unbounded()) {
+            return true;
+        }
+
+        const auto bounds = sf.template visit_mask<detail::global_box_getter>(
+            sf.transform(context));
+
+        // Unbounded surfaces are always visible
+        constexpr auto inv{detray::detail::invalid_value<actsvg::scalar>()};
+        if (std::ranges::any_of(bounds, [](const actsvg::scalar b) {
+                return math::fabs(b) >= inv;
+            })) {
+            return true;
+        }
+
+        const auto [x_range, y_range] = project(bounds, view);
+
+        return window.overlaps(x_range, y_range);
+    }
+}
+
+/// @returns true if any part of the volume @param vol could be visible in the
+/// window @param window of the view @param view
+///
+/// @note Uses the box around all portals of the volume, since the bounding
+/// boxes of the single portals do not necessarily enclose the volume.
+template <typename detector_t, typename view_t>
+inline bool is_visible(const typename detector_t::geometry_context& context,
+                       const detector_t& detector,
+                       const detray::tracking_volume<detector_t>& vol,
+                       const view_t& view, const view_window& window) {
+
+    if constexpr (!is_cullable_v<view_t>) {
+        return true;
+    } else {
+        if (window.is_unbounded()) {
+            return true;
+        }
+
+        constexpr auto inv{detray::detail::invalid_value<actsvg::scalar>()};
+        std::array<actsvg::scalar, 6> hull{inv, inv, inv, -inv, -inv, -inv};
+
+        for (const auto& pt_desc : vol.portals()) {
+            const auto pt =
+                detray::geometry::surface<detector_t>{detector, pt_desc};
+            const auto bounds =
+                pt.template visit_mask<detail::global_box_getter>(
+                    pt.transform(context));
+
+            for (std::size_t i = 0u; i < 3u; ++i) {
+                hull[i] = math::min(hull[i], bounds[i]);
+                hull[i + 3u] = math::max(hull[i + 3u], bounds[i + 3u]);
+            }
+        }
+
+        // No portals or unbounded portals
+        if (std::ranges::any_of(hull, [](const actsvg::scalar b) {
+                return math::fabs(b) >= inv;
+            })) {
+            return true;
+        }
+
+        const auto [x_range, y_range] = project(hull, view);
+
+        return window.overlaps(x_range, y_range);
+    }
+}
+
+}  // namespace utils
+
+}  // namespace detray::svgtools
@@ -14,8 +14,17 @@
 #include "actsvg/core.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
 #include <ios>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace detray::svgtools {
@@ -51,4 +60,171 @@ inline void write_svg(const std::string& path,
     write_svg(path, arg, replace);
 }
 
+/// @brief Writes svg objects to a single file, one object at a time.
+///
+/// In contrast to @c write_svg, the objects do not have to be collected in
+/// memory before the file is written: Every object is serialized as soon as
+/// it is passed to the writer and can then be discarded by the caller (e.g.
+/// a single volume or trajectory). The view box of the file is the union of
+/// the view boxes of all objects and is filled in when the file is closed.
+///
+/// @note To avoid conflict, the ids of the svg objects must be unique.
+class svg_stream_writer {
+
+    /// Space that is reserved for the size attributes in the svg header
+    static constexpr std::size_t header_size{160u};
+
+    public:
+    /// Open the file @param path and write the svg header
+    explicit svg_stream_writer(const std::string& path, bool replace = true)
+        : m_file{path, ".svg",
+                 replace ? std::ios::out | std::ios::trunc : std::ios::out} {
+
+        *m_file << "<svg version=\"1.1\" "
+                   "xmlns=\"http://www.w3.org/2000/svg\" "
+                   "xmlns:xlink=\"http://www.w3.org/1999/xlink\"";
+        m_header_pos = (*m_file).tellp();
+        *m_file << std::string(header_size, ' ') << ">\n";
+    }
+
+    /// Not copyable
+    svg_stream_writer(const svg_stream_writer&) = delete;
+    svg_stream_writer& operator=(const svg_stream_writer&) = delete;
+
+    /// Finish the file, if it was not closed before
+    ~svg_stream_writer() {
+        try {
+            close();
+        } catch (const std::exception& err) {
+            std::cout << "ERROR: Could not finish svg file:\n"
+                      << err.what() << std::endl;
+        }
+    }
+
+    /// @returns the number of objects that have been written
+    std::size_t n_objects() const { return m_n_objects; }
+
+    /// Serialize the svg object @param obj and append it to the file
+    void write(const actsvg::svg::object& obj) {
+        if (m_is_closed) {
+            throw std::runtime_error("Cannot write to a closed svg file");
+        }
+
+        // Let actsvg serialize the object, including its definitions
+        actsvg::svg::file single_file;
+        single_file.add_object(obj);
+
+        std::stringstream ss;
+        ss << single_file;
+        const std::string svg_str{ss.str()};
+
+        // Strip the svg header and tail of the single object file
+        const std::size_t head_begin{svg_str.find("<svg")};
+        const std::size_t head_end{svg_str.find('>', head_begin)};
+        const std::size_t tail_begin{svg_str.rfind("</svg>")};
+        if (head_begin == std::string::npos ||
+            head_end == std::string::npos ||
+            tail_begin == std::string::npos || tail_begin < head_end) {
+            throw std::runtime_error("Could not serialize svg object " +
+                                     obj._id);
+        }
+
+        add_view_box(std::string_view{svg_str}.substr(
+            head_begin, head_end - head_begin));
+
+        *m_file << std::string_view{svg_str}.substr(
+            head_end + 1u, tail_begin - head_end - 1u);
+
+        ++m_n_objects;
+    }
+
+    /// Serialize all svg objects in @param svgs and append them to the file
+    template <typename container_t>
+    void write(const container_t& svgs) {
+        for (const actsvg::svg::object& obj : svgs) {
+            write(obj);
+        }
+    }
+
+    /// Serialize all svg objects in @param svgs and append them to the file
+    void write(const std::initializer_list<actsvg::svg::object>& svgs) {
+        for (const actsvg::svg::object& obj : svgs) {
+            write(obj);
+        }
+    }
+
+    /// Write the svg tail and the view box of all objects
+    void close() {
+        if (m_is_closed) {
+            return;
+        }
+        m_is_closed = true;
+
+        *m_file << "</svg>\n";
+
+        if (m_has_view_box) {
+            const double width{m_view_box[2] - m_view_box[0]};
+            const double height{m_view_box[3] - m_view_box[1]};
+
+            std::stringstream attr;
+            attr << " width=\"" << width << "\" height=\"" << height
+                 << "\" viewBox=\"" << m_view_box[0] << " " << m_view_box[1]
+                 << " " << width << " " << height << "\"";
+
+            const std::string attr_str{attr.str()};
+            if (attr_str.size() > header_size) {
+                throw std::runtime_error("svg view box does not fit header");
+            }
+            (*m_file).seekp(m_header_pos);
+            *m_file << attr_str;
+        }
+        (*m_file).flush();
+    }
+
+    private:
+    /// Add the view box of the svg header @param head to the view box of
+    /// the file
+    void add_view_box(const std::string_view head) {
+        constexpr std::string_view key{"viewBox=\""};
+
+        const std::size_t begin{head.find(key)};
+        if (begin == std::string_view::npos) {
+            return;
+        }
+        const std::size_t end{head.find('"', begin + key.size())};
+
+        std::stringstream values{std::string{
+            head.substr(begin + key.size(), end - begin - key.size())}};
+        std::array<double, 4> box{};
+        if (!(values >> box[0] >> box[1] >> box[2] >> box[3])) {
+            return;
+        }
+
+        // Convert to min and max corner
+        box[2] += box[0];
+        box[3] += box[1];
+
+        if (!m_has_view_box) {
+            m_view_box = box;
+            m_has_view_box = true;
+        } else {
+            m_view_box[0] = std::min(m_view_box[0], box[0]);
+            m_view_box[1] = std::min(m_view_box[1], box[1]);
+            m_view_box[2] = std::max(m_view_box[2], box[2]);
+            m_view_box[3] = std::max(m_view_box[3], box[3]);
+        }
+    }
+
+    /// Output file
+    detray::io::file_handle m_file;
+    /// Position of the reserved space for the size attributes
+    std::streampos m_header_pos{};
+    /// Union of the object view boxes (min x, min y, max x, max y)
+    std::array<double, 4> m_view_box{};
+    bool m_has_view_box{false};
+    /// Number of objects that were written
+    std::size_t m_n_objects{0u};
+    bool m_is_closed{false};
+};
+
 }  // namespace detray::svgtools
@@ -0,0 +1,153 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/definitions/algebra.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/utils/type_list.hpp"
+
+// Detray detector include(s)
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/default_metadata.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+
+// Covfie include(s)
+#include <covfie/core/field_view.hpp>
+
+// System include(s)
+#include <type_traits>
+
+/// Propagators that are compiled once into the @c detray::precompiled
+/// libraries, instead of in every translation unit that runs a propagation.
+///
+/// Only the declaration of @c precompiled::propagate is visible to the
+/// client code, so that the navigation, stepping and actor code is not
+/// instantiated (and inlined) in the client binary. Calling the function for
+/// a propagator type that is not in @c precompiled::propagator_types results
+/// in a linker error.
+namespace detray::precompiled {
+
+// Algebra of the library (selected by the algebra plugin target)
+#if DETRAY_ALGEBRA_ARRAY
+using algebra = detray::array<DETRAY_CUSTOM_SCALARTYPE>;
+#elif DETRAY_ALGEBRA_EIGEN
+using algebra = detray::eigen<DETRAY_CUSTOM_SCALARTYPE>;
+#elif DETRAY_ALGEBRA_SMATRIX
+using algebra = detray::smatrix<DETRAY_CUSTOM_SCALARTYPE>;
+#elif DETRAY_ALGEBRA_VC_AOS
+using algebra = detray::vc_aos<DETRAY_CUSTOM_SCALARTYPE>;
+#endif
+
+using scalar = dscalar<algebra>;
+
+/// Detector types
+/// @{
+using default_detector = detector<default_metadata<algebra>>;
+using toy_detector = detector<toy_metadata<algebra>>;
+/// @}
+
+/// Magnetic field views
+/// @{
+using const_field_view = covfie::field_view<bfield::const_bknd_t<scalar>>;
+using inhom_field_view = covfie::field_view<bfield::inhom_bknd_t<scalar>>;
+/// @}
+
+/// Steppers
+/// @{
+using line_stepper_type = line_stepper<algebra>;
+template <typename field_view_t>
+using rk_stepper_type = rk_stepper<field_view_t, algebra>;
+/// @}
+
+/// Actor chains
+/// @{
+using empty_chain = actor_chain<>;
+using default_chain = actor_chain<parameter_transporter<algebra>,
+                                  pointwise_material_interactor<algebra>,
+                                  parameter_resetter<algebra>>;
+/// @}
+
+/// Propagator for the detector @tparam detector_t
+template <typename detector_t, typename stepper_t, typename actor_chain_t>
+using propagator_type =
+    propagator<stepper_t, navigator<detector_t>, actor_chain_t>;
+
+/// All propagator types that are compiled into the library
+using propagator_types = types::list<
+    // Straight line propagation
+    propagator_type<default_detector, line_stepper_type, empty_chain>,
+    propagator_type<toy_detector, line_stepper_type, empty_chain>,
+    propagator_type<default_detector, line_stepper_type, default_chain>,
+    propagator_type<toy_detector, line_stepper_type, default_chain>,
+    // Homogeneous field
+    propagator_type<default_detector, rk_stepper_type<const_field_view>,
+                    empty_chain>,
+    propagator_type<toy_detector, rk_stepper_type<const_field_view>,
+                    empty_chain>,
+    propagator_type<default_detector, rk_stepper_type<const_field_view>,
+                    default_chain>,
+    propagator_type<toy_detector, rk_stepper_type<const_field_view>,
+                    default_chain>,
+    // Inhomogeneous field
+    propagator_type<default_detector, rk_stepper_type<inhom_field_view>,
+                    empty_chain>,
+    propagator_type<toy_detector, rk_stepper_type<inhom_field_view>,
+                    empty_chain>,
+    propagator_type<default_detector, rk_stepper_type<inhom_field_view>,
+                    default_chain>,
+    propagator_type<toy_detector, rk_stepper_type<inhom_field_view>,
+                    default_chain>>;
+
+namespace detail {
+
+template <typename T, typename = void>
+struct contains {};
+
+template <typename T, typename... Ts>
+struct contains<T, types::list<Ts...>>
+    : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+
+}  // namespace detail
+
+/// Check whether the propagator @tparam propagator_t is compiled into the
+/// library
+template <typename propagator_t>
+inline constexpr bool is_precompiled_v =
+    detail::contains<propagator_t, propagator_types>::value;
+
+/// Run the propagation of @param propagation with the precompiled propagator
+/// @param prop (@see propagator::propagate )
+///
+/// @param actor_state_refs tuple of references to the actor states
+///
+/// @returns propagation success.
+template <typename propagator_t>
+requires is_precompiled_v<propagator_t> bool propagate(
+    const propagator_t &prop, typename propagator_t::state &propagation,
+    typename propagator_t::actor_chain_type::state_ref_tuple actor_state_refs);
+
+/// Overload for the empty actor chain
+template <typename propagator_t>
+requires(is_precompiled_v<propagator_t> &&
+         std::is_same_v<typename propagator_t::actor_chain_type,
+                        empty_chain>) bool propagate(const propagator_t &prop,
+                                                     typename propagator_t::
+                                                         state &propagation) {
+    return propagate(prop, propagation, empty_chain::state_ref_tuple{});
+}
+
+}  // namespace detray::precompiled
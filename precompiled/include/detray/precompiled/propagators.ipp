@@ -0,0 +1,35 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/precompiled/propagators.hpp"
+
+// Only included by the library sources, which instantiate the propagation
+// for every type in @c detray::precompiled::propagator_types
+
+namespace detray::precompiled {
+
+template <typename propagator_t>
+requires is_precompiled_v<propagator_t> bool propagate(
+    const propagator_t &prop, typename propagator_t::state &propagation,
+    typename propagator_t::actor_chain_type::state_ref_tuple actor_state_refs) {
+    return prop.propagate(propagation, actor_state_refs);
+}
+
+}  // namespace detray::precompiled
+
+/// Explicit instantiation of the propagation for the detector @param DET with
+/// the stepper @param STEPPER and the actor chain @param CHAIN
+#define DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(DET, STEPPER, CHAIN)        \
+    template bool detray::precompiled::propagate<                             \
+        detray::precompiled::propagator_type<DET, STEPPER, CHAIN>>(           \
+        const detray::precompiled::propagator_type<DET, STEPPER, CHAIN>&,     \
+        typename detray::precompiled::propagator_type<DET, STEPPER,           \
+                                                      CHAIN>::state&,         \
+        typename CHAIN::state_ref_tuple);
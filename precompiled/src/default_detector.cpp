@@ -0,0 +1,33 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/precompiled/propagators.ipp"
+
+using namespace detray::precompiled;
+
+// Straight line propagation
+DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(default_detector, line_stepper_type,
+                                          empty_chain)
+DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(default_detector, line_stepper_type,
+                                          default_chain)
+
+// Homogeneous field
+DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(default_detector,
+                                          rk_stepper_type<const_field_view>,
+                                          empty_chain)
+DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(default_detector,
+                                          rk_stepper_type<const_field_view>,
+                                          default_chain)
+
+// Inhomogeneous field
+DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(default_detector,
+                                          rk_stepper_type<inhom_field_view>,
+                                          empty_chain)
+DETRAY_INSTANTIATE_PRECOMPILED_PROPAGATOR(default_detector,
+                                          rk_stepper_type<inhom_field_view>,
+                                          default_chain)
@@ -0,0 +1,262 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray IO include(s)
+#include "detray/io/backend/geometry_writer.hpp"
+#include "detray/io/backend/homogeneous_material_writer.hpp"
+#include "detray/io/backend/material_map_writer.hpp"
+#include "detray/io/backend/surface_grid_writer.hpp"
+#include "detray/io/binary/binary_detector_writer.hpp"
+#include "detray/io/binary/binary_surface_grid_writer.hpp"
+#include "detray/io/covfie/mapped_bfield.hpp"
+#include "detray/io/covfie/read_bfield.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/json/json_converter.hpp"
+#include "detray/io/utils/create_path.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+using detector_t = detector<test::toy_metadata>;
+
+namespace {
+
+/// Sizes of the toy detectors in the benchmark cases: Number of barrel and
+/// endcap layers (the benchmark range selects the size)
+constexpr std::array<std::array<unsigned int, 2>, 4> toy_sizes{
+    {{1u, 0u}, {2u, 2u}, {3u, 5u}, {4u, 7u}}};
+
+/// The file mode that is used by the benchmarks
+constexpr std::ios_base::openmode out_mode{
+    std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+
+/// Writers of the detector components in json format
+/// @{
+using json_geometry_writer =
+    io::json_converter<detector_t, io::geometry_writer>;
+using json_material_writer =
+    io::json_converter<detector_t, io::homogeneous_material_writer>;
+using json_material_map_writer =
+    io::json_converter<detector_t, io::material_map_writer>;
+using json_grid_writer =
+    io::json_converter<detector_t, io::surface_grid_writer>;
+/// @}
+
+/// Writers of the detector components in binary format
+/// @{
+using binary_grid_writer = io::binary_surface_grid_writer<detector_t>;
+using binary_detector_writer = io::binary_detector_writer<detector_t>;
+/// @}
+
+/// @returns the directory the benchmark files are written to
+inline std::filesystem::path output_dir() {
+    return io::create_path(
+        (std::filesystem::temp_directory_path() / "detray_io_benchmarks")
+            .string());
+}
+
+/// @returns the toy detector for the benchmark case @param state
+inline auto build_detector(vecmem::memory_resource &mr,
+                           const benchmark::State &state,
+                           const bool use_material_maps) {
+
+    const auto &sizes = toy_sizes.at(static_cast<std::size_t>(state.range(0)));
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_brl_layers(sizes[0])
+        .n_edc_layers(sizes[1])
+        .use_material_maps(use_material_maps)
+        .do_check(false);
+
+    return build_toy_detector<test_algebra>(mr, toy_cfg);
+}
+
+/// Report the file size and the throughput in bytes and surfaces per second
+inline void set_throughput(benchmark::State &state,
+                           const std::uintmax_t n_bytes,
+                           const std::size_t n_surfaces) {
+
+    const auto n_iter{static_cast<std::int64_t>(state.iterations())};
+
+    state.SetBytesProcessed(n_iter * static_cast<std::int64_t>(n_bytes));
+    state.SetItemsProcessed(n_iter * static_cast<std::int64_t>(n_surfaces));
+
+    state.counters["FileSize"] = benchmark::Counter(
+        static_cast<double>(n_bytes), benchmark::Counter::kDefaults,
+        benchmark::Counter::OneK::kIs1024);
+    state.counters["Surfaces"] = static_cast<double>(n_surfaces);
+}
+
+}  // namespace
+
+/// Benchmarks writing a single detector component with @tparam writer_t
+template <typename writer_t, bool use_material_maps = false>
+void BM_WRITE_COMPONENT(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_detector(host_mr, state, use_material_maps);
+    const std::filesystem::path path{output_dir()};
+
+    writer_t writer{};
+    std::string file_name{};
+    for (auto _ : state) {
+        file_name = writer.write(det, names, out_mode, path);
+    }
+
+    set_throughput(state, std::filesystem::file_size(path / file_name),
+                   det.surfaces().size());
+}
+
+/// Benchmarks reading a single detector component that was written with
+/// @tparam writer_t : The geometry has to be read along, but only the time
+/// spent on the component file (parsing and adding the data to the detector
+/// builder) is measured
+template <typename writer_t, bool use_material_maps = false>
+void BM_READ_COMPONENT(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_detector(host_mr, state, use_material_maps);
+    const std::filesystem::path path{output_dir()};
+
+    // Write the files of the geometry and the component
+    const std::string file_name{
+        (path / writer_t{}.write(det, names, out_mode, path)).string()};
+
+    std::vector<std::string> files{file_name};
+    if constexpr (!std::is_same_v<writer_t, json_geometry_writer>) {
+        files.push_back(
+            (path / json_geometry_writer{}.write(det, names, out_mode, path))
+                .string());
+    }
+
+    for (auto _ : state) {
+        io::detail::detector_components_reader<detector_t> readers{};
+        io::detail::add_json_readers<0u, 2u>(readers, files);
+        io::detail::add_binary_readers<0u, 2u>(readers, files);
+
+        detector_builder<typename detector_t::metadata, volume_builder>
+            det_builder{};
+        typename detector_t::name_map names_in{};
+
+        readers.read(det_builder, names_in);
+
+        const auto &t = readers.timing().at(file_name);
+        state.SetIterationTime(
+            std::chrono::duration<double>(t.parse + t.build).count());
+    }
+
+    set_throughput(state, std::filesystem::file_size(file_name),
+                   det.surfaces().size());
+}
+
+/// Benchmarks memory mapping a complete binary detector file
+void BM_MAP_BINARY_DETECTOR(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_detector(host_mr, state, false);
+    const std::filesystem::path path{output_dir()};
+
+    const std::string file_name{
+        (path / binary_detector_writer{}.write(det, names, out_mode, path))
+            .string()};
+
+    const auto reader_cfg = io::detector_reader_config{}.do_check(false);
+
+    for (auto _ : state) {
+        auto mapped_det = io::map_detector<detector_t>(file_name, reader_cfg);
+        benchmark::DoNotOptimize(mapped_det);
+    }
+
+    set_throughput(state, std::filesystem::file_size(file_name),
+                   det.surfaces().size());
+}
+
+/// Benchmarks reading the covfie field map in the file given by the
+/// environment variable DETRAY_BFIELD_FILE
+template <bool do_map>
+void BM_READ_BFIELD(benchmark::State &state) {
+
+    if (!std::getenv("DETRAY_BFIELD_FILE")) {
+        state.SkipWithError("DETRAY_BFIELD_FILE is not set");
+        return;
+    }
+    const std::string file_name{std::getenv("DETRAY_BFIELD_FILE")};
+
+    for (auto _ : state) {
+        if constexpr (do_map) {
+            auto field = io::map_bfield(file_name);
+            benchmark::DoNotOptimize(field);
+        } else {
+            auto field =
+                io::read_bfield<bfield::inhom_field_t<scalar>>(file_name);
+            benchmark::DoNotOptimize(field);
+        }
+    }
+
+    const auto n_bytes{std::filesystem::file_size(file_name)};
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(n_bytes));
+    state.counters["FileSize"] = benchmark::Counter(
+        static_cast<double>(n_bytes), benchmark::Counter::kDefaults,
+        benchmark::Counter::OneK::kIs1024);
+}
+
+/// Register a component benchmark for all toy detector sizes
+#define DETRAY_IO_BENCHMARK(BM, ...)                                          \
+    BENCHMARK_TEMPLATE(BM, __VA_ARGS__)                                       \
+        ->DenseRange(0, static_cast<int>(toy_sizes.size()) - 1)               \
+        ->Unit(benchmark::kMillisecond)
+
+// Json format
+DETRAY_IO_BENCHMARK(BM_WRITE_COMPONENT, json_geometry_writer);
+DETRAY_IO_BENCHMARK(BM_WRITE_COMPONENT, json_material_writer);
+DETRAY_IO_BENCHMARK(BM_WRITE_COMPONENT, json_material_map_writer, true);
+DETRAY_IO_BENCHMARK(BM_WRITE_COMPONENT, json_grid_writer);
+
+DETRAY_IO_BENCHMARK(BM_READ_COMPONENT, json_geometry_writer)->UseManualTime();
+DETRAY_IO_BENCHMARK(BM_READ_COMPONENT, json_material_writer)->UseManualTime();
+DETRAY_IO_BENCHMARK(BM_READ_COMPONENT, json_material_map_writer, true)
+    ->UseManualTime();
+DETRAY_IO_BENCHMARK(BM_READ_COMPONENT, json_grid_writer)->UseManualTime();
+
+// Binary format
+DETRAY_IO_BENCHMARK(BM_WRITE_COMPONENT, binary_grid_writer);
+DETRAY_IO_BENCHMARK(BM_WRITE_COMPONENT, binary_detector_writer);
+
+DETRAY_IO_BENCHMARK(BM_READ_COMPONENT, binary_grid_writer)->UseManualTime();
+
+BENCHMARK(BM_MAP_BINARY_DETECTOR)
+    ->DenseRange(0, static_cast<int>(toy_sizes.size()) - 1)
+    ->Unit(benchmark::kMicrosecond);
+
+// Magnetic field
+BENCHMARK_TEMPLATE(BM_READ_BFIELD, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_READ_BFIELD, true)->Unit(benchmark::kMicrosecond);
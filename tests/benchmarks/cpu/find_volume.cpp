@@ -5,6 +5,9 @@
  * Mozilla Public License Version 2.0
  */
 
+// Detray core include(s).
+#include "detray/builders/volume_finder_builder.hpp"
+
 // Detray test include(s).
 #include "detray/test/utils/detectors/build_toy_detector.hpp"
 #include "detray/test/utils/types.hpp"
@@ -84,3 +87,59 @@ BENCHMARK(BM_FIND_VOLUMES)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+// Benchmarks the cost of searching a volume by position with the
+// hierarchical volume finder
+void BM_FIND_VOLUMES_HIERARCHICAL(benchmark::State &state) {
+
+    // Detector configuration
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    auto [d, names] = build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    const auto vol_finder = build_volume_finder(d, {50u, 1u, 100u}, host_mr);
+
+    static const unsigned int itest = 10000u;
+
+    // Rough step size from the extent of the toy detector
+    constexpr scalar r_max{200.f};
+    constexpr scalar z_max{2000.f};
+    constexpr scalar step0{r_max / itest};
+    constexpr scalar step1{2.f * z_max / itest};
+
+    std::size_t successful{0u};
+    std::size_t unsuccessful{0u};
+
+    for (auto _ : state) {
+        for (unsigned int i1 = 0u; i1 < itest; ++i1) {
+            for (unsigned int i0 = 0u; i0 < itest; ++i0) {
+                test::vector3 rz{static_cast<scalar>(i0) * step0, 0.f,
+                                 -z_max + static_cast<scalar>(i1) * step1};
+                const dindex vol_idx{vol_finder.search(rz)};
+
+                benchmark::DoNotOptimize(successful);
+                benchmark::DoNotOptimize(unsuccessful);
+                if (vol_idx == dindex_invalid) {
+                    ++unsuccessful;
+                } else {
+                    ++successful;
+                }
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "Max. candidates: " << vol_finder.max_candidates()
+              << std::endl;
+    std::cout << "Successful     : " << successful << std::endl;
+    std::cout << "Unsuccessful   : " << unsuccessful << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_FIND_VOLUMES_HIERARCHICAL)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
@@ -12,6 +12,7 @@
 #include "detray/definitions/containers.hpp"
 #include "detray/definitions/indexing.hpp"
 #include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/accelerators/search_buffer.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // Detray test include(s).
@@ -59,11 +60,12 @@ auto make_random_points() {
 }
 
 /// Make a regular grid for the tests.
-template <typename bin_t>
+template <typename bin_t,
+          template <std::size_t> class serializer_t = simple_serializer>
 auto make_regular_grid(vecmem::memory_resource &mr) {
 
     // Data-owning grids with bin capacity 1
-    auto gr_factory = grid_factory<bin_t, simple_serializer, test_algebra>{mr};
+    auto gr_factory = grid_factory<bin_t, serializer_t, test_algebra>{mr};
 
     // Spans of the axes
     std::vector<scalar> spans = {0.f, 25.f, 0.f, 60.f};
@@ -288,7 +290,88 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
 #endif  // DETRAY_BENCHMARK_PRINTOUTS
 }
 
+void BM_GRID_REGULAR_NEIGHBOR_CAP4_TILED(benchmark::State &state) {
+
+    // Set up the tested grid object: Tiled bin layout
+    vecmem::host_memory_resource host_mr;
+    auto g2r =
+        make_regular_grid<bins::static_array<dindex, 4>, tiled_serializer>(
+            host_mr);
+    populate_grid<complete<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_CAP4_TILED:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
 // This runs a reference test with a irregular grid structure
+// Same as BM_GRID_REGULAR_NEIGHBOR_CAP1, but fill a flat buffer
+void BM_GRID_REGULAR_NEIGHBOR_CAP1_BUFFER(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::single<dindex>>(host_mr);
+    populate_grid<replace<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            search_buffer<> buffer;
+            g2r.search_into(p, window, buffer);
+            for (dindex entry : buffer) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+}
+
+// Same as BM_GRID_REGULAR_NEIGHBOR_CAP4, but fill a flat buffer
+void BM_GRID_REGULAR_NEIGHBOR_CAP4_BUFFER(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>>(host_mr);
+    populate_grid<complete<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            search_buffer<128u> buffer;
+            g2r.search_into(p, window, buffer);
+            for (dindex entry : buffer) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+}
+
 void BM_GRID_IRREGULAR_BIN_CAP1(benchmark::State &state) {
 
     // Set up the tested grid object.
@@ -383,6 +466,27 @@ BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4)
     ->MeasureProcessCPUTime()
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4_TILED)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP1_BUFFER)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4_BUFFER)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_GRID_IRREGULAR_BIN_CAP1)
 #ifdef DETRAY_BENCHMARK_MULTITHREAD
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
@@ -14,22 +14,31 @@
 // Detray core include(s).
 #include "detray/definitions/containers.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
 #include "detray/geometry/detail/surface_descriptor.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes.hpp"
+#include "detray/navigation/accelerators/packed_brute_force_finder.hpp"
+#include "detray/navigation/intersection/fast_ray_intersector.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/tracks/ray.hpp"
+#include "detray/utils/quadratic_equation.hpp"
 
 // Detray test include(s).
 #include "detray/test/utils/planes_along_direction.hpp"
 #include "detray/test/utils/simulation/event_generator/track_generators.hpp"
 #include "detray/test/utils/types.hpp"
 
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // Google Benchmark include(s)
 #include <benchmark/benchmark.h>
 
 // System include(s)
 #include <algorithm>
+#include <utility>
 
 using namespace detray;
 
@@ -58,6 +67,7 @@ enum class mask_ids : unsigned int {
     e_rectangle2 = 0,
     e_cylinder2 = 1,
     e_conc_cylinder3 = 2,
+    e_drift_cell = 3,
 };
 
 enum class material_ids : unsigned int {
@@ -118,6 +128,39 @@ dvector<dscalar<algebra_v>> get_dists<algebra_v>(std::size_t n) {
     return dists;
 }
 
+/// Generate a layer of @param n wires with the cell size @param cell around
+/// the z-axis
+///
+/// @returns the surface descriptors and the placements of the wires
+auto get_wire_layer(std::size_t n, dscalar<algebra_s> cell) {
+
+    using scalar_t = dscalar<algebra_s>;
+    using vector3_t = dvector3D<algebra_s>;
+
+    // Wires are placed side by side
+    const scalar_t delta{2.f * constant<scalar_t>::pi /
+                         static_cast<scalar_t>(n)};
+    const scalar_t radius{2.f * cell / delta};
+
+    mask_link_t mask_link{mask_ids::e_drift_cell, 0u};
+    material_link_t material_link{material_ids::e_slab, 0u};
+
+    dvector<surface_desc_t> wire_descs{};
+    dvector<dtransform3D<algebra_s>> transforms{};
+    for (std::size_t i = 0u; i < n; ++i) {
+        const scalar_t phi{static_cast<scalar_t>(i) * delta};
+        const vector3_t center{radius * math::cos(phi),
+                               radius * math::sin(phi), 0.f};
+
+        wire_descs.emplace_back(static_cast<dindex>(i), mask_link,
+                                material_link, 0u, surface_id::e_sensitive);
+        const vector3_t x_axis{-math::sin(phi), math::cos(phi), 0.f};
+        transforms.emplace_back(center, vector3_t{0.f, 0.f, 1.f}, x_axis);
+    }
+
+    return std::make_pair(std::move(wire_descs), std::move(transforms));
+}
+
 }  // namespace
 
 /// This benchmark runs intersection with the planar intersector
@@ -236,6 +279,178 @@ BENCHMARK(BM_INTERSECT_PLANES_SOA)
 #endif
     ->Unit(benchmark::kMillisecond);
 
+/// This benchmark runs the neighborhood search of the packed brute force
+/// finder, which tests blocks of AoS planes with the SoA planar intersector
+void BM_INTERSECT_PLANES_PACKED(benchmark::State& state) {
+
+    using mask_t = mask<rectangle2D, algebra_s, std::uint_least16_t>;
+
+    auto dists = get_dists<algebra_s>(n_surfaces);
+    auto [plane_descs, tranforms] = test::planes_along_direction<algebra_s>(
+        dists, dvector3D<algebra_s>{1.f, 1.f, 1.f});
+
+    using sf_desc_t = typename decltype(plane_descs)::value_type;
+    using finder_t =
+        packed_brute_force_collection<algebra_v, rectangle2D, sf_desc_t>;
+
+    constexpr mask_t rect{0u, 100.f, 200.f};
+    std::vector<mask_t> masks(plane_descs.size(), rect);
+
+    vecmem::host_memory_resource host_mr;
+    finder_t packed_finder{&host_mr};
+    packed_finder.push_back(dvector<sf_desc_t>{}, plane_descs, masks,
+                            tranforms);
+    const auto finder = packed_finder[0];
+
+    const auto rays = generate_rays();
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::size_t hit{0u};
+#endif
+
+    for (auto _ : state) {
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+        hit = 0u;
+#endif
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto& ray : rays) {
+
+            for (const auto& sf : finder.search(ray, 0.f, -1.f)) {
+                benchmark::DoNotOptimize(sf);
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+                ++hit;
+#endif
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << mask_t::shape::name << " packed: hit/miss ... " << hit
+              << " / " << rays.size() * masks.size() - hit
+              << " (total: " << rays.size() * masks.size() << ")"
+              << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_INTERSECT_PLANES_PACKED)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+/// This benchmark runs intersection with the line intersector for a layer of
+/// wire cells
+void BM_INTERSECT_WIRES_AOS(benchmark::State& state) {
+
+    using mask_t = mask<line_square, algebra_s, std::uint_least16_t>;
+
+    auto [wire_descs, tranforms] = get_wire_layer(n_surfaces, 10.f);
+
+    constexpr mask_t cell{0u, 10.f, 1000.f};
+
+    const auto rays = generate_rays();
+    const auto li = ray_intersector<line_square, algebra_s>{};
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::size_t hit{0u};
+    std::size_t miss{0u};
+#endif
+
+    for (auto _ : state) {
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+        hit = 0u;
+        miss = 0u;
+#endif
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto& ray : rays) {
+
+            for (std::size_t i = 0u; i < wire_descs.size(); ++i) {
+                auto is = li(ray, wire_descs[i], cell, tranforms[i]);
+
+                benchmark::DoNotOptimize(is);
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+                if (is.status) {
+                    ++hit;
+                } else {
+                    ++miss;
+                }
+#endif
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << mask_t::shape::name << " AoS: hit/miss ... " << hit << " / "
+              << miss << " (total: " << rays.size() * wire_descs.size() << ")"
+              << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_INTERSECT_WIRES_AOS)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+/// This benchmark runs the neighborhood search of the packed brute force
+/// finder for a layer of wire cells, which uses the SoA line intersector
+void BM_INTERSECT_WIRES_PACKED(benchmark::State& state) {
+
+    using mask_t = mask<line_square, algebra_s, std::uint_least16_t>;
+    using finder_t =
+        packed_brute_force_collection<algebra_v, line_square, surface_desc_t>;
+
+    auto [wire_descs, tranforms] = get_wire_layer(n_surfaces, 10.f);
+
+    constexpr mask_t cell{0u, 10.f, 1000.f};
+    std::vector<mask_t> masks(wire_descs.size(), cell);
+
+    vecmem::host_memory_resource host_mr;
+    finder_t packed_finder{&host_mr};
+    packed_finder.push_back(dvector<surface_desc_t>{}, wire_descs, masks,
+                            tranforms);
+    const auto finder = packed_finder[0];
+
+    const auto rays = generate_rays();
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::size_t hit{0u};
+#endif
+
+    for (auto _ : state) {
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+        hit = 0u;
+#endif
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto& ray : rays) {
+
+            for (const auto& sf : finder.search(ray, 0.f, -1.f)) {
+                benchmark::DoNotOptimize(sf);
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+                ++hit;
+#endif
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << mask_t::shape::name << " packed: hit/miss ... " << hit
+              << " / " << rays.size() * masks.size() - hit
+              << " (total: " << rays.size() * masks.size() << ")"
+              << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_INTERSECT_WIRES_PACKED)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
 /// This benchmark runs intersection with the cylinder intersector
 void BM_INTERSECT_CYLINDERS_AOS(benchmark::State& state) {
 
@@ -302,6 +517,73 @@ BENCHMARK(BM_INTERSECT_CYLINDERS_AOS)
 #endif
     ->Unit(benchmark::kMillisecond);
 
+/// This benchmark runs intersection with the cylinder intersector that uses
+/// an approximate local phi
+void BM_INTERSECT_CYLINDERS_FAST_AOS(benchmark::State& state) {
+
+    using transform3_t = dtransform3D<algebra_s>;
+    using scalar_t = dscalar<algebra_s>;
+
+    using mask_t = mask<cylinder2D, algebra_s, std::uint_least16_t>;
+
+    std::vector<mask_t> masks;
+    for (const scalar_t r : get_dists<algebra_s>(n_surfaces)) {
+        masks.emplace_back(0u, r, -100.f, 100.f);
+    }
+
+    transform3_t trf{};
+
+    mask_link_t mask_link{mask_ids::e_conc_cylinder3, 0u};
+    material_link_t material_link{material_ids::e_slab, 0u};
+    surface_desc_t cyl_desc(0u, mask_link, material_link, 0u,
+                            surface_id::e_sensitive);
+
+    // Iterate through uniformly distributed momentum directions
+    const auto rays = generate_rays();
+    const auto cci = fast_ray_intersector<cylinder2D, algebra_s>{};
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::size_t hit{0u};
+    std::size_t miss{0u};
+#endif
+    for (auto _ : state) {
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+        hit = 0u;
+        miss = 0u;
+#endif
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto& ray : rays) {
+
+            for (const auto& cylinder : masks) {
+                auto is = cci(ray, cyl_desc, cylinder, trf);
+
+                static_assert(is.size() == 2u, "Wrong number of solutions");
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+                for (const auto& i : is) {
+                    if (i.status) {
+                        ++hit;
+                    } else {
+                        ++miss;
+                    }
+                }
+#endif
+                benchmark::DoNotOptimize(is);
+            }
+        }
+    }
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << mask_t::shape::name << " AoS (fast): hit/miss ... " << hit << " / "
+              << miss << " (total: " << rays.size() * masks.size() << ")"
+              << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_INTERSECT_CYLINDERS_FAST_AOS)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
 /// This benchmark runs intersection with the cylinder intersector
 void BM_INTERSECT_CYLINDERS_SOA(benchmark::State& state) {
 
@@ -484,3 +766,63 @@ BENCHMARK(BM_INTERSECT_CONCENTRIC_CYLINDERS_SOA)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+namespace {
+
+/// Generate the coefficients of the quadratic equations of the ray-cylinder
+/// intersections around the z-axis (one equation per ray and radius)
+template <concepts::algebra algebra_t>
+dvector<darray<dscalar<algebra_t>, 3>> get_quadratic_coefficients() {
+
+    using scalar_t = dscalar<algebra_t>;
+
+    dvector<darray<scalar_t, 3>> coeffs;
+    for (const auto& ray : generate_rays()) {
+        for (const scalar_t r : get_dists<algebra_t>(n_surfaces)) {
+            // Projection into the plane transverse to the cylinder axis
+            const auto& ro = ray.pos();
+            const auto& rd = ray.dir();
+            const scalar_t a{rd[0] * rd[0] + rd[1] * rd[1]};
+            const scalar_t b{2.f * (ro[0] * rd[0] + ro[1] * rd[1])};
+            const scalar_t c{ro[0] * ro[0] + ro[1] * ro[1] - r * r};
+
+            coeffs.push_back({a, b, c});
+        }
+    }
+
+    return coeffs;
+}
+
+}  // namespace
+
+/// This benchmark compares the quadratic equation solvers of the cylinder
+/// intersections
+template <concepts::algebra algebra_t, typename solver_t>
+void BM_SOLVE_QUADRATIC(benchmark::State& state) {
+
+    const auto coeffs = get_quadratic_coefficients<algebra_t>();
+
+    for (auto _ : state) {
+        for (const auto& [a, b, c] : coeffs) {
+            const solver_t qe{a, b, c};
+
+            auto smaller = qe.smaller();
+            auto larger = qe.larger();
+            benchmark::DoNotOptimize(smaller);
+            benchmark::DoNotOptimize(larger);
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_SOLVE_QUADRATIC, algebra_s,
+                   detail::quadratic_equation<dscalar<algebra_s>>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SOLVE_QUADRATIC, algebra_s,
+                   detail::branchless_quadratic_equation<dscalar<algebra_s>>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SOLVE_QUADRATIC, algebra_v,
+                   detail::quadratic_equation<dscalar<algebra_v>>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SOLVE_QUADRATIC, algebra_v,
+                   detail::branchless_quadratic_equation<dscalar<algebra_v>>)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,138 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/tracks/detail/transform_track_parameters.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/types.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+
+namespace {
+
+constexpr unsigned int n_tracks{10000u};
+
+/// @returns a set of bound track parameters with distinct covariances
+std::vector<bound_track_parameters<test_algebra>> make_tracks() {
+    std::vector<bound_track_parameters<test_algebra>> tracks(n_tracks);
+
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        const auto s{static_cast<scalar>(i % 100u) / 100.f};
+
+        bound_parameters_vector<test_algebra> bound_vec{};
+        bound_vec.set_bound_local({s - 0.5f, 0.3f - 0.2f * s});
+        bound_vec.set_phi(-3.f + 6.f * s);
+        bound_vec.set_theta(0.2f + 2.7f * s);
+        bound_vec.set_qop(-1.f / (1.f + 10.f * s));
+        bound_vec.set_time(0.1f * s);
+
+        auto cov = matrix::identity<bound_matrix<test_algebra>>();
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            getter::element(cov, j, j) = 0.01f * (1.f + s + scalar(j));
+        }
+
+        tracks[i].set_parameter_vector(bound_vec);
+        tracks[i].set_covariance(cov);
+    }
+
+    return tracks;
+}
+
+/// @returns the transport jacobian of a straight line step of length @param s
+free_matrix<test_algebra> straight_line_transport(const scalar s) {
+    auto jac = matrix::identity<free_matrix<test_algebra>>();
+    getter::element(jac, e_free_pos0, e_free_dir0) = s;
+    getter::element(jac, e_free_pos1, e_free_dir1) = s;
+    getter::element(jac, e_free_pos2, e_free_dir2) = s;
+
+    return jac;
+}
+
+/// Transport the covariances of @param tracks from the surface with the
+/// placement @param trf and mask @param msk to the free frame, along a
+/// straight line step and back to the bound frame of the same surface
+template <typename frame_t, typename mask_t>
+void transport_covariances(
+    benchmark::State &state, const transform3 &trf, const mask_t &msk,
+    const std::vector<bound_track_parameters<test_algebra>> &tracks) {
+
+    using engine_t = detail::jacobian_engine<frame_t>;
+
+    const free_matrix<test_algebra> transport{straight_line_transport(1.f)};
+
+    for (auto _ : state) {
+        for (const auto &track : tracks) {
+            const auto bound_to_free =
+                engine_t::bound_to_free_jacobian(trf, msk, track);
+            const free_track_parameters<test_algebra> free_params =
+                detail::bound_to_free_vector(trf, msk, track);
+            const auto free_to_bound =
+                engine_t::free_to_bound_jacobian(trf, free_params);
+
+            const auto full_jac = free_to_bound * transport * bound_to_free;
+            auto cov =
+                full_jac * track.covariance() * matrix::transpose(full_jac);
+
+            benchmark::DoNotOptimize(cov);
+        }
+    }
+}
+
+}  // namespace
+
+// This runs a benchmark on the covariance transport of a planar surface
+void BM_JACOBIAN_TRANSPORT_RECTANGLE(benchmark::State &state) {
+
+    using mask_type = mask<rectangle2D, test_algebra>;
+    const mask_type msk{0u, 100.f, 100.f};
+    const transform3 trf{vector3{1.f, 2.f, 3.f}};
+
+    transport_covariances<typename mask_type::local_frame>(state, trf, msk,
+                                                           make_tracks());
+}
+
+// This runs a benchmark on the covariance transport of a wire surface
+void BM_JACOBIAN_TRANSPORT_LINE(benchmark::State &state) {
+
+    using mask_type = mask<line_circular, test_algebra>;
+    const mask_type msk{0u, 10.f, 100.f};
+    const transform3 trf{vector3{1.f, 2.f, 3.f}};
+
+    transport_covariances<typename mask_type::local_frame>(state, trf, msk,
+                                                           make_tracks());
+}
+
+BENCHMARK(BM_JACOBIAN_TRANSPORT_RECTANGLE)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_JACOBIAN_TRANSPORT_LINE)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
@@ -19,6 +19,11 @@
 // Detray test include(s).
 #include "detray/test/utils/types.hpp"
 
+#if DETRAY_ALGEBRA_VC_SOA
+// Algebra include(s).
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+#endif
+
 // Google benchmark include(s).
 #include <benchmark/benchmark.h>
 
@@ -459,7 +464,7 @@ BENCHMARK(BM_MASK_CONCENTRIC_CYLINDER_2D)
 void BM_MASK_ANNULUS_2D(benchmark::State &state) {
 
     using mask_type = mask<annulus2D, test_algebra>;
-    constexpr mask_type ann{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f, 0.5f, 0.f};
+    const mask_type ann{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f, 0.5f, 0.f};
 
     constexpr scalar world{10.f};
 
@@ -608,3 +613,121 @@ BENCHMARK(BM_MASK_LINE_SQUARE)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+#if DETRAY_ALGEBRA_VC_SOA
+
+/// Linear algebra implementation using SoA memory layout
+using algebra_v = detray::vc_soa<test::scalar>;
+using scalar_v = dscalar<algebra_v>;
+using point3_v = dpoint3D<algebra_v>;
+
+// Number of local points that are checked per mask call
+static constexpr unsigned int simd_size{
+    static_cast<unsigned int>(scalar_v::size())};
+
+static const dtransform3D<algebra_v> trf_v{};
+
+/// Check the points of the benchmark grid against the (scalar) mask @param m
+/// in batches of SIMD width, with a different tolerance per lane
+template <typename mask_t>
+void run_soa_mask_benchmark(benchmark::State &state, const mask_t &m) {
+
+    // Only needed for the local frame conversion of the SoA points
+    using soa_mask_t = mask<typename mask_t::shape, algebra_v>;
+
+    constexpr scalar world{10.f};
+
+    constexpr scalar sx{world / steps_x3};
+    constexpr scalar sy{world / steps_y3};
+    constexpr scalar sz{world / steps_z3};
+
+    // Consecutive x positions in the lanes, tolerance grows with the lane
+    const scalar_v lane_x{scalar_v::IndexesFromZero() * scalar_v(sx)};
+    const scalar_v tol_v{scalar_v::IndexesFromZero() * scalar_v(1e-3f)};
+
+    unsigned long inside = 0u;
+    unsigned long outside = 0u;
+
+    for (auto _ : state) {
+        for (unsigned int ix = 0u; ix < steps_x3; ix += simd_size) {
+            const scalar_v x{
+                lane_x +
+                scalar_v(-0.5f * world + static_cast<scalar>(ix) * sx)};
+            for (unsigned int iy = 0u; iy < steps_y3; ++iy) {
+                scalar y{-0.5f * world + static_cast<scalar>(iy) * sy};
+                for (unsigned int iz = 0u; iz < steps_z3; ++iz) {
+                    scalar z{-0.5f * world + static_cast<scalar>(iz) * sz};
+
+                    benchmark::DoNotOptimize(inside);
+                    benchmark::DoNotOptimize(outside);
+                    const point3_v loc_p{soa_mask_t::to_local_frame(
+                        trf_v, point3_v{x, scalar_v(y), scalar_v(z)})};
+
+                    const auto n_inside{static_cast<unsigned long>(
+                        m.is_inside(loc_p, tol_v).count())};
+                    inside += n_inside;
+                    outside += simd_size - n_inside;
+                }
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << mask_t::shape::name << " SoA : Inside/outside ..." << inside
+              << " / " << outside << " = "
+              << static_cast<scalar>(inside) / static_cast<scalar>(outside)
+              << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+// This runs a benchmark on a rectangle2D mask with SoA points
+void BM_MASK_RECTANGLE_2D_SOA(benchmark::State &state) {
+    constexpr mask<rectangle2D, test_algebra> r(0u, 3.f, 4.f);
+    run_soa_mask_benchmark(state, r);
+}
+
+BENCHMARK(BM_MASK_RECTANGLE_2D_SOA)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+// This runs a benchmark on a trapezoid2D mask with SoA points
+void BM_MASK_TRAPEZOID_2D_SOA(benchmark::State &state) {
+    constexpr mask<trapezoid2D, test_algebra> t{0u, 2.f, 3.f, 4.f,
+                                                1.f / (2.f * 4.f)};
+    run_soa_mask_benchmark(state, t);
+}
+
+BENCHMARK(BM_MASK_TRAPEZOID_2D_SOA)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+// This runs a benchmark on a ring2D mask with SoA points
+void BM_MASK_RING_2D_SOA(benchmark::State &state) {
+    constexpr mask<ring2D, test_algebra> r{0u, 2.f, 5.f};
+    run_soa_mask_benchmark(state, r);
+}
+
+BENCHMARK(BM_MASK_RING_2D_SOA)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+// This runs a benchmark on an annulus2D mask with SoA points
+void BM_MASK_ANNULUS_2D_SOA(benchmark::State &state) {
+    const mask<annulus2D, test_algebra> ann{0u,       2.5f, 5.f,  -0.64299f,
+                                            4.13173f, 1.f,  0.5f, 0.f};
+    run_soa_mask_benchmark(state, ann);
+}
+
+BENCHMARK(BM_MASK_ANNULUS_2D_SOA)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
+#endif  // DETRAY_ALGEBRA_VC_SOA
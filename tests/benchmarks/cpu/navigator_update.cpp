@@ -0,0 +1,283 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/detectors/build_wire_chamber.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+namespace {
+
+using track_t = free_track_parameters<test_algebra>;
+
+/// Which volumes to take the navigation states from
+enum class volume_kind {
+    e_all = 0,
+    e_brute_force = 1,
+    e_grid = 2,
+};
+
+/// Records copies of the navigation state in the middle of the volumes
+template <typename navigation_state_t>
+struct snapshot_recorder : actor {
+
+    struct state {
+        /// Track and navigation state half way to the next candidate
+        std::vector<std::pair<track_t, navigation_state_t>> snapshots{};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &rec_state, propagator_state_t &prop_state) const {
+        const auto &navigation = prop_state._navigation;
+
+        if (!navigation.is_on_surface() || navigation.is_complete() ||
+            !navigation.is_alive()) {
+            return;
+        }
+
+        // Move the track half way towards the next candidate
+        track_t track = prop_state._stepping();
+        track.set_pos(track.pos() + 0.5f * navigation() * track.dir());
+
+        rec_state.snapshots.emplace_back(track, navigation);
+    }
+};
+
+/// @returns whether the volume with index @param vol_idx in @param det is of
+/// the volume kind @param kind
+template <typename detector_t>
+bool is_volume_kind(const detector_t &det, const dindex vol_idx,
+                    const volume_kind kind) {
+    if (kind == volume_kind::e_all) {
+        return true;
+    }
+
+    const auto &sf_link =
+        det.volume(vol_idx)
+            .template accel_link<detector_t::geo_obj_ids::e_sensitive>();
+    const bool has_grid{!sf_link.is_invalid() &&
+                        sf_link.id() != detector_t::accel::id::e_brute_force};
+
+    return (kind == volume_kind::e_grid) == has_grid;
+}
+
+/// Collect mid-volume navigation states by propagating straight tracks
+/// through the detector @param det
+template <typename detector_t>
+auto record_snapshots(const detector_t &det, const volume_kind kind) {
+
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using recorder_t = snapshot_recorder<typename navigator_t::state>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain<recorder_t>>;
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    const typename detector_t::geometry_context gctx{};
+    typename recorder_t::state rec_state{};
+
+    auto trk_generator = uniform_track_generator<track_t>{};
+    trk_generator.config().theta_steps(30u).phi_steps(30u).p_tot(
+        10.f * unit<scalar>::GeV);
+
+    for (const auto track : trk_generator) {
+        typename propagator_t::state propagation(track, det, gctx);
+        prop.propagate(propagation, detray::tie(rec_state));
+    }
+
+    // Only keep the states in the requested volumes
+    auto &snapshots = rec_state.snapshots;
+    std::erase_if(snapshots, [&det, kind](const auto &snapshot) {
+        return !is_volume_kind(det, snapshot.second.volume(), kind);
+    });
+
+    return snapshots;
+}
+
+/// Time the navigation update with trust level @param trust_level on
+/// navigation states in the middle of the volumes in @param det
+template <typename detector_t>
+void run_update_benchmark(benchmark::State &state, const detector_t &det,
+                          const navigation::trust_level trust_level,
+                          const volume_kind kind) {
+
+    using navigator_t = navigator<detector_t>;
+
+    auto snapshots = record_snapshots(det, kind);
+    if (snapshots.empty()) {
+        state.SkipWithError("No navigation states in the requested volumes");
+        return;
+    }
+
+    const navigator_t nav{};
+    navigation::config cfg{};
+
+    // Restore full trust with the current track positions before timing
+    for (auto &[track, navigation] : snapshots) {
+        navigation.set_fair_trust();
+        nav.update(track, navigation, cfg);
+    }
+
+    std::size_t n_updates{0u};
+    std::size_t n_surfaces{0u};
+    std::size_t n_cached{0u};
+    for (const auto &[track, navigation] : snapshots) {
+        n_surfaces +=
+            tracking_volume{det, navigation.volume()}.surfaces().size();
+        n_cached += navigation.n_cached();
+    }
+
+    for (auto _ : state) {
+        for (auto &[track, navigation] : snapshots) {
+            switch (trust_level) {
+                case navigation::trust_level::e_no_trust:
+                    navigation.set_no_trust();
+                    break;
+                case navigation::trust_level::e_fair:
+                    navigation.set_fair_trust();
+                    break;
+                default:
+                    navigation.set_high_trust();
+                    break;
+            }
+            benchmark::DoNotOptimize(nav.update(track, navigation, cfg));
+        }
+        benchmark::ClobberMemory();
+        n_updates += snapshots.size();
+    }
+
+    const auto n_states{static_cast<double>(snapshots.size())};
+    state.counters["Updates"] = benchmark::Counter(
+        static_cast<double>(n_updates), benchmark::Counter::kIsRate);
+    state.counters["SurfacesPerVolume"] =
+        static_cast<double>(n_surfaces) / n_states;
+    state.counters["CachedCandidates"] =
+        static_cast<double>(n_cached) / n_states;
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "Navigation states: " << snapshots.size() << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+}  // anonymous namespace
+
+// Navigation update in the toy detector (barrel and endcap grids, brute
+// force in the gap and beampipe volumes)
+void BM_NAVIGATOR_UPDATE_TOY(benchmark::State &state,
+                             const navigation::trust_level trust_level,
+                             const volume_kind kind) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    run_update_benchmark(state, det, trust_level, kind);
+}
+
+// Navigation update in the wire chamber (many wires in cylinder grids)
+void BM_NAVIGATOR_UPDATE_WIRE_CHAMBER(
+    benchmark::State &state, const navigation::trust_level trust_level) {
+
+    vecmem::host_memory_resource host_mr;
+    wire_chamber_config<scalar> wire_chamber_cfg{};
+    wire_chamber_cfg.half_z(500.f * unit<scalar>::mm);
+    const auto [det, names] =
+        build_wire_chamber<test_algebra>(host_mr, wire_chamber_cfg);
+
+    run_update_benchmark(state, det, trust_level, volume_kind::e_grid);
+}
+
+// Navigation update in a telescope detector (a single brute force volume)
+void BM_NAVIGATOR_UPDATE_TELESCOPE(benchmark::State &state,
+                                   const navigation::trust_level trust_level) {
+
+    vecmem::host_memory_resource host_mr;
+    // Build along the x-axis, which is covered by the generated tracks
+    detail::ray<test_algebra> pilot_traj{
+        {0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{
+        200.f * unit<scalar>::mm, 200.f * unit<scalar>::mm};
+    tel_cfg.n_surfaces(20u).pilot_track(pilot_traj);
+    const auto [det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    run_update_benchmark(state, det, trust_level, volume_kind::e_brute_force);
+}
+
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TOY, NO_TRUST_GRID,
+                  navigation::trust_level::e_no_trust, volume_kind::e_grid)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TOY, FAIR_TRUST_GRID,
+                  navigation::trust_level::e_fair, volume_kind::e_grid)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TOY, HIGH_TRUST_GRID,
+                  navigation::trust_level::e_high, volume_kind::e_grid)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TOY, NO_TRUST_BRUTE_FORCE,
+                  navigation::trust_level::e_no_trust,
+                  volume_kind::e_brute_force)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TOY, FAIR_TRUST_BRUTE_FORCE,
+                  navigation::trust_level::e_fair, volume_kind::e_brute_force)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TOY, HIGH_TRUST_BRUTE_FORCE,
+                  navigation::trust_level::e_high, volume_kind::e_brute_force)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_WIRE_CHAMBER, NO_TRUST,
+                  navigation::trust_level::e_no_trust)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_WIRE_CHAMBER, FAIR_TRUST,
+                  navigation::trust_level::e_fair)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_WIRE_CHAMBER, HIGH_TRUST,
+                  navigation::trust_level::e_high)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TELESCOPE, NO_TRUST,
+                  navigation::trust_level::e_no_trust)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TELESCOPE, FAIR_TRUST,
+                  navigation::trust_level::e_fair)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NAVIGATOR_UPDATE_TELESCOPE, HIGH_TRUST,
+                  navigation::trust_level::e_high)
+    ->Unit(benchmark::kMicrosecond);
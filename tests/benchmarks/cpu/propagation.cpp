@@ -13,6 +13,7 @@
 #include "detray/tracks/tracks.hpp"
 
 // Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
 #include "detray/benchmarks/cpu/propagation_benchmark.hpp"
 
 // Detray test include(s).
@@ -146,6 +147,8 @@ int main(int argc, char** argv) {
         "WIRE_CHAMBER", bench_cfg, prop_cfg, wire_chamber, bfield, &empty_state,
         track_samples, n_tracks);
 
+    detray::benchmarks::add_benchmark_context<test_algebra>("CPU", "", "");
+
     // Run benchmarks
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,319 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actors.hpp"
+#include "detray/propagator/dormand_prince_stepper.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_reader.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
+#include "detray/benchmarks/cpu/propagation_benchmark.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/detectors/build_wire_chamber.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s)
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+using free_track_parameters_t = free_track_parameters<test_algebra>;
+using track_samples_t = std::vector<dvector<free_track_parameters_t>>;
+
+/// The actor chains that are benchmarked
+/// @{
+using empty_chain_t = actor_chain<>;
+using transporter_chain_t = actor_chain<parameter_transporter<test_algebra>>;
+using default_chain_t =
+    actor_chain<parameter_transporter<test_algebra>,
+                pointwise_material_interactor<test_algebra>,
+                parameter_resetter<test_algebra>>;
+/// @}
+
+/// Actor states, which need to outlive the benchmark registration
+struct actor_states {
+    dtuple<> empty{};
+    pointwise_material_interactor<test_algebra>::state interactor{};
+    default_chain_t::state_tuple full{detail::make_tuple<dtuple>(interactor)};
+};
+
+/// @returns the value of the environment variable @param name, if it is set
+std::optional<std::string> get_env(const char *name) {
+    const char *value{std::getenv(name)};
+    if (value == nullptr || std::string{value}.empty()) {
+        return std::nullopt;
+    }
+    return std::string{value};
+}
+
+/// Register the benchmarks for all actor chains for the detector @param det
+/// in the magnetic field @param bfield
+template <template <typename, concepts::algebra, typename...>
+          class stepper_tmpl,
+          typename detector_t, typename bfield_t>
+void register_actor_chains(const std::string &name,
+                           detray::benchmarks::benchmark_base::configuration
+                               &bench_cfg,
+                           propagation::config prop_cfg, const detector_t &det,
+                           bfield_t &bfield, actor_states &states,
+                           track_samples_t &track_samples,
+                           const std::vector<int> &n_tracks) {
+
+    using stepper_t = stepper_tmpl<typename bfield_t::view_t, test_algebra>;
+
+    prop_cfg.stepping.do_covariance_transport = false;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::host_propagation_bm, stepper_t, empty_chain_t>(
+        name + "_EMPTY_CHAIN", bench_cfg, prop_cfg, det, bfield,
+        &states.empty, track_samples, n_tracks);
+
+    prop_cfg.stepping.do_covariance_transport = true;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::host_propagation_bm, stepper_t,
+        transporter_chain_t>(name + "_TRANSPORTER", bench_cfg, prop_cfg, det,
+                             bfield, &states.empty, track_samples, n_tracks);
+
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::host_propagation_bm, stepper_t, default_chain_t>(
+        name + "_DEFAULT_CHAIN", bench_cfg, prop_cfg, det, bfield,
+        &states.full, track_samples, n_tracks);
+}
+
+/// Register the benchmarks for the detector @param det in the constant field
+/// @param const_bfield and, if available, in the inhomogeneous field
+/// @param inhom_bfield. In the inhomogeneous field, the Runge-Kutta stepper
+/// is compared to the Dormand-Prince stepper.
+template <typename detector_t, typename const_field_t, typename inhom_field_t>
+void register_fields(const std::string &name,
+                     detray::benchmarks::benchmark_base::configuration
+                         &bench_cfg,
+                     const propagation::config &prop_cfg,
+                     const detector_t &det, const_field_t &const_bfield,
+                     std::optional<inhom_field_t> &inhom_bfield,
+                     actor_states &states, track_samples_t &track_samples,
+                     const std::vector<int> &n_tracks) {
+
+    register_actor_chains<rk_stepper>(name + "_CONST_FIELD", bench_cfg,
+                                      prop_cfg, det, const_bfield, states,
+                                      track_samples, n_tracks);
+
+    if (inhom_bfield.has_value()) {
+        register_actor_chains<rk_stepper>(name + "_INHOM_FIELD", bench_cfg,
+                                          prop_cfg, det, *inhom_bfield, states,
+                                          track_samples, n_tracks);
+
+        register_actor_chains<dormand_prince_stepper>(
+            name + "_INHOM_FIELD_DP", bench_cfg, prop_cfg, det, *inhom_bfield,
+            states, track_samples, n_tracks);
+    }
+}
+
+}  // anonymous namespace
+
+/// Standard propagation benchmark suite: Propagates the same track samples
+/// through the toy detector, the wire chamber, a telescope detector and,
+/// optionally, a detector that is read from file, using a constant and,
+/// optionally, an inhomogeneous magnetic field with different actor chains.
+///
+/// The optional inputs are given by the environment variables:
+/// - DETRAY_BFIELD_FILE: covfie field map for the inhomogeneous field
+/// - DETRAY_BENCHMARK_GEOMETRY_FILE: json geometry file of the detector
+/// - DETRAY_BENCHMARK_GRID_FILE: json surface grid file of the detector
+/// - DETRAY_BENCHMARK_MATERIAL_FILE: json material file of the detector
+int main(int argc, char **argv) {
+
+    using vector3 = dvector3D<test_algebra>;
+
+    using uniform_gen_t =
+        detail::random_numbers<scalar, std::uniform_real_distribution<scalar>>;
+    using track_generator_t =
+        random_track_generator<free_track_parameters_t, uniform_gen_t>;
+
+    using inhom_field_t = bfield::inhom_field_t<scalar>;
+
+    using file_detector_t = detector<test::default_metadata>;
+
+    vecmem::host_memory_resource host_mr;
+
+    //
+    // Configuration
+    //
+
+    // Google benchmark specific options
+    ::benchmark::Initialize(&argc, argv);
+
+    // Configure toy detector
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u);
+
+    std::cout << toy_cfg << std::endl;
+
+    // Configure wire chamber
+    wire_chamber_config<scalar> wire_chamber_cfg{};
+    wire_chamber_cfg.half_z(500.f * unit<scalar>::mm);
+
+    std::cout << wire_chamber_cfg << std::endl;
+
+    // Configure telescope detector: Build along the z-axis
+    detail::ray<test_algebra> pilot_traj{
+        {0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, -1.f};
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{
+        200.f * unit<scalar>::mm, 200.f * unit<scalar>::mm};
+    tel_cfg.n_surfaces(20u)
+        .length(1000.f * unit<scalar>::mm)
+        .pilot_track(pilot_traj);
+
+    // Configure propagation
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.search_window = {3u, 3u};
+
+    std::cout << prop_cfg << std::endl;
+
+    // Benchmark config
+    detray::benchmarks::benchmark_base::configuration bench_cfg{};
+
+    std::vector<int> n_tracks{32 * 32, 128 * 128};
+
+    auto trk_cfg =
+        detray::benchmarks::get_default_trk_gen_config<track_generator_t>(
+            n_tracks);
+    trk_cfg.seed(detail::random_numbers<scalar>::default_seed());
+
+    // Tracks in the acceptance of the telescope
+    auto tel_trk_cfg = trk_cfg;
+    tel_trk_cfg.theta_range(0.f, 0.1f);
+
+    // Add additional tracks for warmup
+    bench_cfg.n_warmup(static_cast<int>(
+        std::ceil(0.1f * static_cast<float>(trk_cfg.n_tracks()))));
+    bench_cfg.do_warmup(true);
+
+    //
+    // Prepare data
+    //
+    auto track_samples =
+        detray::benchmarks::generate_track_samples<track_generator_t>(
+            &host_mr, n_tracks, trk_cfg);
+    auto tel_track_samples =
+        detray::benchmarks::generate_track_samples<track_generator_t>(
+            &host_mr, n_tracks, tel_trk_cfg);
+
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+    const auto [wire_chamber, wire_chamber_names] =
+        build_wire_chamber<test_algebra>(host_mr, wire_chamber_cfg);
+    // Wire chamber with one wire per grid bin
+    auto wire_bins_cfg = wire_chamber_cfg;
+    wire_bins_cfg.wires_per_bin(1u);
+    const auto [wire_bins_chamber, wire_bins_names] =
+        build_wire_chamber<test_algebra>(host_mr, wire_bins_cfg);
+    const auto [tel_det, tel_names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    // Detector from file
+    std::optional<file_detector_t> file_det{};
+    std::string file_det_name{};
+    if (const auto geo_file = get_env("DETRAY_BENCHMARK_GEOMETRY_FILE")) {
+        detray::io::detector_reader_config reader_cfg{};
+        reader_cfg.add_file(*geo_file);
+        if (const auto grid_file = get_env("DETRAY_BENCHMARK_GRID_FILE")) {
+            reader_cfg.add_file(*grid_file);
+        }
+        if (const auto mat_file = get_env("DETRAY_BENCHMARK_MATERIAL_FILE")) {
+            reader_cfg.add_file(*mat_file);
+        }
+
+        auto [det, names] =
+            detray::io::read_detector<file_detector_t>(host_mr, reader_cfg);
+        file_det_name = det.name(names);
+        file_det.emplace(std::move(det));
+    } else {
+        std::cout << "No detector file given: Skipping file detector "
+                     "benchmarks (set DETRAY_BENCHMARK_GEOMETRY_FILE)\n"
+                  << std::endl;
+    }
+
+    // Magnetic fields
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    auto const_bfield = bfield::create_const_field<scalar>(B);
+
+    std::optional<inhom_field_t> inhom_bfield{};
+    if (get_env("DETRAY_BFIELD_FILE")) {
+        inhom_bfield.emplace(bfield::create_inhom_field<scalar>());
+    } else {
+        std::cout << "No field map given: Skipping inhomogeneous field "
+                     "benchmarks (set DETRAY_BFIELD_FILE)\n"
+                  << std::endl;
+    }
+
+    actor_states states{};
+
+    //
+    // Register benchmarks
+    //
+    std::cout << "Propagation Benchmark Suite\n"
+              << "---------------------------\n\n";
+
+    register_fields("TOY_DETECTOR", bench_cfg, prop_cfg, toy_det,
+                    const_bfield, inhom_bfield, states, track_samples,
+                    n_tracks);
+
+    register_fields("WIRE_CHAMBER", bench_cfg, prop_cfg, wire_chamber,
+                    const_bfield, inhom_bfield, states, track_samples,
+                    n_tracks);
+
+    // Search window that covers the drift radius of the wires
+    auto wire_bins_prop_cfg = prop_cfg;
+    wire_bins_prop_cfg.navigation.search_window = wire_chamber_search_window(
+        wire_bins_cfg,
+        static_cast<scalar>(prop_cfg.navigation.max_mask_tolerance));
+
+    register_fields("WIRE_CHAMBER_WIRE_BINS", bench_cfg, wire_bins_prop_cfg,
+                    wire_bins_chamber, const_bfield, inhom_bfield, states,
+                    track_samples, n_tracks);
+
+    register_fields("TELESCOPE", bench_cfg, prop_cfg, tel_det, const_bfield,
+                    inhom_bfield, states, tel_track_samples, n_tracks);
+
+    if (file_det.has_value()) {
+        register_fields(file_det_name, bench_cfg, prop_cfg, *file_det,
+                        const_bfield, inhom_bfield, states, track_samples,
+                        n_tracks);
+    }
+
+    detray::benchmarks::add_benchmark_context<test_algebra>(
+        "CPU", "", inhom_bfield.has_value() ? "const. and inhom. field"
+                                            : "const. field");
+
+    // Run benchmarks
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+}
@@ -0,0 +1,127 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/compact_transform3.hpp"
+#include "detray/geometry/quaternion_transform3.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/types.hpp"
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+namespace {
+
+/// Number of transforms: Large enough to not fit into the L2 cache with the
+/// algebra transform
+constexpr std::size_t n_transforms{1u << 16u};
+
+/// @returns @param n transforms of type @tparam transform_t, rotated around
+/// the z-axis and placed on a cylinder (like the modules of a barrel layer)
+template <typename transform_t>
+dvector<transform_t> get_transforms(const std::size_t n) {
+
+    dvector<transform_t> transforms;
+    transforms.reserve(n);
+
+    for (std::size_t i = 0u; i < n; ++i) {
+        const scalar phi{2.f * constant<scalar>::pi * static_cast<scalar>(i) /
+                         static_cast<scalar>(n)};
+        const scalar z{static_cast<scalar>(i % 100u) - 50.f};
+
+        const point3 t{30.f * math::cos(phi), 30.f * math::sin(phi), z};
+        const vector3 z_axis{
+            vector::normalize(vector3{math::cos(phi), math::sin(phi), 0.1f})};
+        const vector3 x_axis{-math::sin(phi), math::cos(phi), 0.f};
+
+        transforms.push_back(transform_t{test::transform3{t, z_axis, x_axis}});
+    }
+
+    return transforms;
+}
+
+/// Transform a global position and direction to the local frame of every
+/// surface, as is done when intersecting the surfaces of a volume
+template <typename transform_t>
+void BM_TRANSFORM_TO_LOCAL(benchmark::State &state) {
+
+    const auto transforms = get_transforms<transform_t>(n_transforms);
+
+    const point3 glob_p{1.f, 2.f, 3.f};
+    const vector3 glob_v{vector::normalize(vector3{1.f, 1.f, 1.f})};
+
+    for (auto _ : state) {
+        for (const auto &trf : transforms) {
+            point3 loc_p = trf.point_to_local(glob_p);
+            vector3 loc_v = trf.vector_to_local(glob_v);
+
+            benchmark::DoNotOptimize(loc_p);
+            benchmark::DoNotOptimize(loc_v);
+        }
+    }
+
+    state.counters["bytes_per_transform"] =
+        static_cast<double>(sizeof(transform_t));
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_transforms));
+}
+
+/// Transform a local position back to the global frame
+template <typename transform_t>
+void BM_TRANSFORM_TO_GLOBAL(benchmark::State &state) {
+
+    const auto transforms = get_transforms<transform_t>(n_transforms);
+
+    const point3 loc_p{1.f, 2.f, 0.f};
+
+    for (auto _ : state) {
+        for (const auto &trf : transforms) {
+            point3 glob_p = trf.point_to_global(loc_p);
+
+            benchmark::DoNotOptimize(glob_p);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(n_transforms));
+}
+
+}  // namespace
+
+// Algebra transform: 4x4 matrix and its inverse
+BENCHMARK_TEMPLATE(BM_TRANSFORM_TO_LOCAL, test::transform3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_TRANSFORM_TO_GLOBAL, test::transform3)
+    ->Unit(benchmark::kMicrosecond);
+
+// Compact transform: 3x4 inverse and the translation
+BENCHMARK_TEMPLATE(BM_TRANSFORM_TO_LOCAL, compact_transform3<test_algebra>)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_TRANSFORM_TO_GLOBAL, compact_transform3<test_algebra>)
+    ->Unit(benchmark::kMicrosecond);
+
+// Quaternion transform: Quaternion and translation
+BENCHMARK_TEMPLATE(BM_TRANSFORM_TO_LOCAL, quaternion_transform3<test_algebra>)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_TRANSFORM_TO_GLOBAL, quaternion_transform3<test_algebra>)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,165 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/tuple_container.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/detectors/itk_metadata.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using test_algebra = test::algebra;
+
+namespace {
+
+/// Number of random type ids that are visited per benchmark iteration
+constexpr std::size_t n_ids{100000u};
+
+/// Cheap functor, so that the dispatch dominates the visit
+struct collection_size {
+    template <typename collection_t>
+    DETRAY_HOST_DEVICE std::size_t operator()(
+        const collection_t &collection) const {
+        return collection.size();
+    }
+};
+
+/// Visit the collections of a store of type @tparam store_t in random order
+/// with the dispatch strategy @tparam dispatch
+template <typename store_t, detail::visit_dispatch dispatch>
+void run_dispatch_benchmark(benchmark::State &state) {
+
+    using id_t = typename store_t::value_types::id;
+
+    vecmem::host_memory_resource host_mr;
+    store_t store(host_mr);
+
+    // Uniformly distributed ids, so that the branches cannot be predicted
+    std::mt19937_64 gen(42u);
+    std::uniform_int_distribution<std::size_t> dist(
+        0u, store_t::n_collections() - 1u);
+
+    std::vector<id_t> ids(n_ids);
+    for (auto &id : ids) {
+        id = static_cast<id_t>(dist(gen));
+    }
+
+    std::size_t n_visits{0u};
+    for (auto _ : state) {
+        std::size_t n{0u};
+        for (const id_t id : ids) {
+            n += store.template visit<collection_size, dispatch>(id);
+        }
+        benchmark::DoNotOptimize(n);
+        n_visits += n_ids;
+    }
+
+    state.counters["Visits"] = benchmark::Counter(
+        static_cast<double>(n_visits), benchmark::Counter::kIsRate);
+    state.counters["Types"] = static_cast<double>(store_t::n_collections());
+}
+
+/// Run the benchmark with a dispatch strategy that is given at runtime
+template <typename store_t>
+void run_dispatch_benchmark(benchmark::State &state,
+                            const detail::visit_dispatch dispatch) {
+    switch (dispatch) {
+        case detail::visit_dispatch::e_linear:
+            run_dispatch_benchmark<store_t, detail::visit_dispatch::e_linear>(
+                state);
+            break;
+        case detail::visit_dispatch::e_switch:
+            run_dispatch_benchmark<store_t, detail::visit_dispatch::e_switch>(
+                state);
+            break;
+        case detail::visit_dispatch::e_binary:
+            run_dispatch_benchmark<store_t, detail::visit_dispatch::e_binary>(
+                state);
+            break;
+    }
+}
+
+}  // anonymous namespace
+
+// Mask dispatch for the toy detector types
+void BM_MASK_DISPATCH_TOY(benchmark::State &state,
+                          const detail::visit_dispatch dispatch) {
+    using store_t = typename detector<
+        test::toy_metadata, host_container_types>::mask_container;
+    run_dispatch_benchmark<store_t>(state, dispatch);
+}
+
+// Material dispatch for the toy detector types
+void BM_MATERIAL_DISPATCH_TOY(benchmark::State &state,
+                              const detail::visit_dispatch dispatch) {
+    using store_t = typename detector<
+        test::toy_metadata, host_container_types>::material_container;
+    run_dispatch_benchmark<store_t>(state, dispatch);
+}
+
+// Mask dispatch for the ITk detector types
+void BM_MASK_DISPATCH_ITK(benchmark::State &state,
+                          const detail::visit_dispatch dispatch) {
+    using store_t = typename detector<itk_metadata<test_algebra>,
+                                      host_container_types>::mask_container;
+    run_dispatch_benchmark<store_t>(state, dispatch);
+}
+
+// Material dispatch for the ITk detector types
+void BM_MATERIAL_DISPATCH_ITK(benchmark::State &state,
+                              const detail::visit_dispatch dispatch) {
+    using store_t =
+        typename detector<itk_metadata<test_algebra>,
+                          host_container_types>::material_container;
+    run_dispatch_benchmark<store_t>(state, dispatch);
+}
+
+// Mask dispatch for all detray types (long type list)
+void BM_MASK_DISPATCH_DEFAULT(benchmark::State &state,
+                              const detail::visit_dispatch dispatch) {
+    using store_t = typename detector<
+        test::default_metadata, host_container_types>::mask_container;
+    run_dispatch_benchmark<store_t>(state, dispatch);
+}
+
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_TOY, LINEAR,
+                  detail::visit_dispatch::e_linear);
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_TOY, SWITCH,
+                  detail::visit_dispatch::e_switch);
+BENCHMARK_CAPTURE(BM_MATERIAL_DISPATCH_TOY, LINEAR,
+                  detail::visit_dispatch::e_linear);
+BENCHMARK_CAPTURE(BM_MATERIAL_DISPATCH_TOY, SWITCH,
+                  detail::visit_dispatch::e_switch);
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_ITK, LINEAR,
+                  detail::visit_dispatch::e_linear);
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_ITK, SWITCH,
+                  detail::visit_dispatch::e_switch);
+BENCHMARK_CAPTURE(BM_MATERIAL_DISPATCH_ITK, LINEAR,
+                  detail::visit_dispatch::e_linear);
+BENCHMARK_CAPTURE(BM_MATERIAL_DISPATCH_ITK, SWITCH,
+                  detail::visit_dispatch::e_switch);
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_DEFAULT, LINEAR,
+                  detail::visit_dispatch::e_linear);
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_DEFAULT, SWITCH,
+                  detail::visit_dispatch::e_switch);
+BENCHMARK_CAPTURE(BM_MASK_DISPATCH_DEFAULT, BINARY,
+                  detail::visit_dispatch::e_binary);
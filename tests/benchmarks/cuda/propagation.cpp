@@ -13,6 +13,7 @@
 #include "detray/tracks/tracks.hpp"
 
 // Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
 #include "detray/benchmarks/device/cuda/propagation_benchmark.hpp"
 
 // Detray test include(s).
@@ -28,6 +29,8 @@
 // System include(s)
 #include <iostream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 using namespace detray;
 
@@ -105,6 +108,10 @@ int main(int argc, char** argv) {
 
     auto bfield = bfield::create_const_field<scalar>(B);
 
+    using toy_det_t = std::remove_cvref_t<decltype(toy_det)>;
+    using wire_chamber_t = std::remove_cvref_t<decltype(wire_chamber)>;
+    using bfield_t = decltype(bfield);
+
     dtuple<> empty_state{};
 
     pointwise_material_interactor<test_algebra>::state interactor_state{};
@@ -152,6 +159,132 @@ int main(int argc, char** argv) {
         "WIRE_CHAMBER", bench_cfg, prop_cfg, wire_chamber, bfield, &empty_state,
         track_samples, n_tracks, &dev_mr);
 
+    // Persistent threads with a global work queue
+    prop_cfg.stepping.do_covariance_transport = true;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t,
+            detray::benchmarks::default_chain>,
+        toy_det_t, bfield_t, detray::benchmarks::propagation_opt::e_persistent>(
+        "TOY_DETECTOR_W_COV_TRANSPORT_PERSISTENT", bench_cfg, prop_cfg, toy_det,
+        bfield, &actor_states, track_samples, n_tracks, &dev_mr);
+
+    prop_cfg.stepping.do_covariance_transport = false;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t, detray::benchmarks::empty_chain>,
+        toy_det_t, bfield_t, detray::benchmarks::propagation_opt::e_persistent>(
+        "TOY_DETECTOR_PERSISTENT", bench_cfg, prop_cfg, toy_det, bfield,
+        &empty_state, track_samples, n_tracks, &dev_mr);
+
+    prop_cfg.stepping.do_covariance_transport = true;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::default_metadata, field_bknd_t,
+            detray::benchmarks::default_chain>,
+        wire_chamber_t, bfield_t,
+        detray::benchmarks::propagation_opt::e_persistent>(
+        "WIRE_CHAMBER_W_COV_TRANSPORT_PERSISTENT", bench_cfg, prop_cfg,
+        wire_chamber, bfield, &actor_states, track_samples, n_tracks, &dev_mr);
+
+    prop_cfg.stepping.do_covariance_transport = false;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::default_metadata, field_bknd_t,
+            detray::benchmarks::empty_chain>,
+        wire_chamber_t, bfield_t,
+        detray::benchmarks::propagation_opt::e_persistent>(
+        "WIRE_CHAMBER_PERSISTENT", bench_cfg, prop_cfg, wire_chamber, bfield,
+        &empty_state, track_samples, n_tracks, &dev_mr);
+
+    // Groups of lanes share the candidate intersection of a track
+    prop_cfg.stepping.do_covariance_transport = true;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t,
+            detray::benchmarks::default_chain>,
+        toy_det_t, bfield_t,
+        detray::benchmarks::propagation_opt::e_cooperative>(
+        "TOY_DETECTOR_W_COV_TRANSPORT_COOPERATIVE", bench_cfg, prop_cfg,
+        toy_det, bfield, &actor_states, track_samples, n_tracks, &dev_mr);
+
+    prop_cfg.stepping.do_covariance_transport = false;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t, detray::benchmarks::empty_chain>,
+        toy_det_t, bfield_t,
+        detray::benchmarks::propagation_opt::e_cooperative>(
+        "TOY_DETECTOR_COOPERATIVE", bench_cfg, prop_cfg, toy_det, bfield,
+        &empty_state, track_samples, n_tracks, &dev_mr);
+
+    prop_cfg.stepping.do_covariance_transport = false;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::default_metadata, field_bknd_t,
+            detray::benchmarks::empty_chain>,
+        wire_chamber_t, bfield_t,
+        detray::benchmarks::propagation_opt::e_cooperative>(
+        "WIRE_CHAMBER_COOPERATIVE", bench_cfg, prop_cfg, wire_chamber, bfield,
+        &empty_state, track_samples, n_tracks, &dev_mr);
+
+    // Replay a CUDA graph for small events, where the launch latency
+    // dominates (the graph includes the track upload)
+    const std::vector<int> n_small_tracks{n_tracks.begin(),
+                                          n_tracks.begin() + 3};
+    std::vector<dvector<free_track_parameters_t>> small_samples{
+        track_samples.begin(), track_samples.begin() + 3};
+
+    prop_cfg.stepping.do_covariance_transport = true;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t,
+            detray::benchmarks::default_chain>,
+        toy_det_t, bfield_t, detray::benchmarks::propagation_opt::e_graph>(
+        "TOY_DETECTOR_W_COV_TRANSPORT_GRAPH", bench_cfg, prop_cfg, toy_det,
+        bfield, &actor_states, small_samples, n_small_tracks, &dev_mr);
+
+    prop_cfg.stepping.do_covariance_transport = false;
+    detray::benchmarks::register_benchmark<
+        detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t, detray::benchmarks::empty_chain>,
+        toy_det_t, bfield_t, detray::benchmarks::propagation_opt::e_graph>(
+        "TOY_DETECTOR_GRAPH", bench_cfg, prop_cfg, toy_det, bfield,
+        &empty_state, small_samples, n_small_tracks, &dev_mr);
+
+    // Scan the launch configuration on the largest track sample
+    const std::vector<int> block_sizes{32, 64, 128, 192, 256};
+    std::vector<dvector<free_track_parameters_t>> sweep_samples{
+        track_samples.back()};
+
+    prop_cfg.stepping.do_covariance_transport = true;
+    detray::benchmarks::register_block_size_sweep<
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t,
+            detray::benchmarks::default_chain>>(
+        "TOY_DETECTOR_W_COV_TRANSPORT_BLOCK_SWEEP", bench_cfg, prop_cfg,
+        toy_det, bfield, &actor_states, sweep_samples, {n_tracks.back()},
+        &dev_mr, block_sizes);
+
+    detray::benchmarks::register_block_size_sweep<
+        detray::benchmarks::cuda_propagator_type<
+            test::toy_metadata, field_bknd_t,
+            detray::benchmarks::default_chain>,
+        toy_det_t, bfield_t, detray::benchmarks::propagation_opt::e_persistent>(
+        "TOY_DETECTOR_W_COV_TRANSPORT_PERSISTENT_BLOCK_SWEEP", bench_cfg,
+        prop_cfg, toy_det, bfield, &actor_states, sweep_samples,
+        {n_tracks.back()}, &dev_mr, block_sizes);
+
+    detray::benchmarks::add_benchmark_context<test_algebra>("CUDA", "", "");
+
     // Run benchmarks
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
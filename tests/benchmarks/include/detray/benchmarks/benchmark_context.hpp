@@ -0,0 +1,96 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/utils/type_list.hpp"
+#include "detray/version.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <fstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace detray::benchmarks {
+
+/// Version of the custom context that the detray benchmarks add to the
+/// google benchmark output. Increase when keys are renamed or removed.
+inline constexpr const char *context_schema_version{"1"};
+
+/// @returns the model name of the host cpu, "unknown" if not available
+inline std::string cpu_model_name() {
+
+    std::ifstream cpu_info("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpu_info, line)) {
+        if (line.starts_with("model name")) {
+            const std::size_t pos{line.find(':')};
+            if (pos != std::string::npos && pos + 2u <= line.size()) {
+                return line.substr(pos + 2u);
+            }
+        }
+    }
+
+    return "unknown";
+}
+
+/// Add the detray context to the benchmark output, so that the results of
+/// different runs can be compared (@see compare_benchmarks.py)
+///
+/// @tparam algebra_t the algebra plugin the benchmark was built with
+///
+/// @param backend the hardware backend type (e.g. "CPU" or "CUDA")
+/// @param backend_name the name of the processor: the cpu model name is used
+///                     for an empty name or "unknown"
+/// @param setup describes the detector setup (e.g. "no grids, no mat.")
+/// @param max_threads maximal number of host threads used by the benchmark
+template <concepts::algebra algebra_t>
+inline void add_benchmark_context(
+    const std::string &backend, std::string backend_name,
+    const std::string &setup,
+    const unsigned int max_threads = std::thread::hardware_concurrency()) {
+
+    const std::string cpu_model{cpu_model_name()};
+    if (backend_name.empty() || backend_name == "unknown") {
+        backend_name = backend == "CPU" ? cpu_model : "unknown";
+    }
+
+    // These fields are needed by the plotting scripts, even if undefined
+    ::benchmark::AddCustomContext("Backend", backend);
+    ::benchmark::AddCustomContext("Backend Name", backend_name);
+    ::benchmark::AddCustomContext("Algebra-plugin",
+                                  detray::types::get_name<algebra_t>());
+    ::benchmark::AddCustomContext("Detector Setup", setup);
+
+    // Additional information for the comparison of runs
+    ::benchmark::AddCustomContext("Schema Version", context_schema_version);
+    ::benchmark::AddCustomContext("Detray Version", DETRAY_VERSION);
+    ::benchmark::AddCustomContext(
+        "Scalar Type",
+        std::is_same_v<dscalar<algebra_t>, double> ? "double" : "float");
+    ::benchmark::AddCustomContext("Host CPU", cpu_model);
+    ::benchmark::AddCustomContext("Max no. Threads",
+                                  std::to_string(max_threads));
+#ifdef _OPENMP
+    ::benchmark::AddCustomContext("OpenMP", "ON");
+#else
+    ::benchmark::AddCustomContext("OpenMP", "OFF");
+#endif
+#ifdef NDEBUG
+    ::benchmark::AddCustomContext("Build Type", "Release");
+#else
+    ::benchmark::AddCustomContext("Build Type", "Debug");
+#endif
+}
+
+}  // namespace detray::benchmarks
@@ -0,0 +1,98 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/containers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+namespace detray::benchmarks {
+
+/// @brief Local copy of the data that is accessed in every navigation step.
+///
+/// Copies the surface descriptors and the acceleration structures (e.g. the
+/// surface grids) of a detector, while the volumes, transforms, masks,
+/// material and the volume finder stay shared with the original detector.
+/// When constructed on a thread that is pinned to a NUMA node, the copies
+/// are local to that node (first-touch), at a fraction of the memory of a
+/// full detector copy.
+///
+/// The replica is accessed through a detector with device containers, which
+/// is set up from the combined views. The original detector has to outlive
+/// the replica.
+template <typename detector_t>
+class hot_detector_replica {
+
+    using surface_buffer_t =
+        typename detector_t::surface_lookup_store::buffer_type;
+    using accelerator_buffer_t =
+        typename detector_t::accelerator_container::buffer_type;
+
+    public:
+    /// The detector type that gives access to the replica
+    using detector_type =
+        detector<typename detector_t::metadata, device_container_types>;
+
+    /// Copy the hot data of @param det into memory from @param mr
+    hot_detector_replica(detector_t &det, vecmem::memory_resource &mr,
+                         vecmem::copy &cpy)
+        : hot_detector_replica(det.get_data(), mr, cpy) {}
+
+    /// Not copyable: The detector refers to the buffers of this object
+    hot_detector_replica(const hot_detector_replica &) = delete;
+    hot_detector_replica &operator=(const hot_detector_replica &) = delete;
+
+    /// The buffer memory does not move along with the buffers
+    hot_detector_replica(hot_detector_replica &&) noexcept = default;
+    hot_detector_replica &operator=(hot_detector_replica &&) noexcept =
+        default;
+
+    ~hot_detector_replica() = default;
+
+    /// @returns the detector that uses the local copies of the hot data
+    const detector_type &get() const { return m_detector; }
+
+    private:
+    /// Copy the hot data in the view @param det_view
+    hot_detector_replica(typename detector_t::view_type det_view,
+                         vecmem::memory_resource &mr, vecmem::copy &cpy)
+        : m_surfaces{detray::get_buffer(detail::get<1>(det_view.m_view), mr,
+                                        cpy)},
+          m_accelerators{detray::get_buffer(detail::get<5>(det_view.m_view),
+                                            mr, cpy)},
+          m_detector{make_detector(det_view)} {}
+
+    /// @returns the detector on the shared data and the local copies
+    detector_type make_detector(typename detector_t::view_type &det_view) {
+        auto surfaces_view = detray::get_data(m_surfaces);
+        auto accelerators_view = detray::get_data(m_accelerators);
+
+        typename detector_t::view_type replica_view{
+            detail::get<0>(det_view.m_view), surfaces_view,
+            detail::get<2>(det_view.m_view), detail::get<3>(det_view.m_view),
+            detail::get<4>(det_view.m_view), accelerators_view,
+            detail::get<6>(det_view.m_view)};
+
+        return detector_type{replica_view};
+    }
+
+    /// Local copy of the surface descriptors
+    surface_buffer_t m_surfaces;
+    /// Local copy of the acceleration structures
+    accelerator_buffer_t m_accelerators;
+    /// Detector on the shared data and the local copies
+    detector_type m_detector;
+};
+
+}  // namespace detray::benchmarks
@@ -0,0 +1,288 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_base.hpp"
+#include "detray/benchmarks/cpu/thread_placement.hpp"
+#include "detray/benchmarks/propagation_benchmark_config.hpp"
+#include "detray/benchmarks/propagation_benchmark_utils.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+#ifdef _OPENMP
+// openMP include
+#include <omp.h>
+#endif
+
+// System include(s)
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::benchmarks {
+
+/// Host propagation benchmark with explicit thread placement
+///
+/// Every thread propagates a contiguous range of the track sample (static
+/// partition) with the detector and track copies of the NUMA node it runs on.
+/// Reports the throughput per node in addition to the total throughput.
+template <typename propagator_t, typename bfield_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+struct host_numa_propagation_bm : public benchmark_base {
+    /// Detector dependent types
+    using detector_t = typename propagator_t::detector_type;
+    using algebra_t = typename detector_t::algebra_type;
+    using track_t = free_track_parameters<algebra_t>;
+
+    /// Local configuration type
+    using configuration = propagation_benchmark_config;
+
+    /// The benchmark configuration
+    configuration m_cfg{};
+    /// The host topology
+    numa_topology m_topology{};
+    /// How to pin the threads
+    thread_placement m_placement{thread_placement::e_none};
+
+    /// Construct from an externally provided configuration @param cfg
+    host_numa_propagation_bm(const configuration &cfg,
+                             const numa_topology &topo,
+                             const thread_placement placement)
+        : m_cfg{cfg}, m_topology{topo}, m_placement{placement} {}
+
+    /// @return the benchmark configuration
+    configuration &config() { return m_cfg; }
+
+    /// Prepare data and run benchmark loop
+    ///
+    /// @param tracks one copy of the track sample per node (or a single one)
+    /// @param dets one copy of the detector per node (or a single one)
+    inline void operator()(
+        ::benchmark::State &state,
+        const std::vector<const dvector<track_t> *> tracks,
+        const std::vector<const detector_t *> dets, const bfield_t *bfield,
+        const typename propagator_t::actor_chain_type::state_tuple
+            *input_actor_states,
+        [[maybe_unused]] const int n_threads) const {
+        using actor_chain_t = typename propagator_t::actor_chain_type;
+        using actor_states_t = typename actor_chain_t::state_tuple;
+
+        assert(!tracks.empty());
+        assert(!dets.empty());
+        assert(bfield != nullptr);
+        assert(input_actor_states != nullptr);
+
+        const int n_samples{m_cfg.benchmark().n_samples()};
+        const int n_warmup{m_cfg.benchmark().n_warmup()};
+        const std::size_t n_nodes{m_topology.n_nodes()};
+
+        assert(static_cast<std::size_t>(n_samples) <= tracks[0]->size());
+
+        // Create propagator
+        propagator_t p{m_cfg.propagation()};
+
+        // Call the host propagation
+        auto run_propagation = [&p, bfield, input_actor_states](
+                                   const track_t &track,
+                                   const detector_t &det) {
+            // Fresh copy of actor states
+            actor_states_t actor_states(*input_actor_states);
+            // Tuple of references to pass to the propagator
+            typename actor_chain_t::state_ref_tuple actor_state_refs =
+                actor_chain_t::setup_actor_states(actor_states);
+
+            typename propagator_t::state p_state(track, *bfield, det);
+            // Particle hypothesis
+            auto &ptc = p_state._stepping.particle_hypothesis();
+            p_state.set_particle(update_particle_hypothesis(ptc, track));
+
+            // Run propagation
+            if constexpr (kOPT ==
+                          detray::benchmarks::propagation_opt::e_unsync) {
+                ::benchmark::DoNotOptimize(
+                    p.propagate(p_state, actor_state_refs));
+            } else if constexpr (kOPT ==
+                                 detray::benchmarks::propagation_opt::e_sync) {
+                ::benchmark::DoNotOptimize(
+                    p.propagate_sync(p_state, actor_state_refs));
+            }
+            assert(p.is_complete(p_state));
+        };
+
+        // Propagate every stride-th track in the range of one thread
+        // @returns the node index and the number of propagated tracks
+        auto run_thread = [&](const int thread_idx, const int n_thrds,
+                              const int stride) {
+            const auto t{static_cast<std::size_t>(thread_idx)};
+            int cpu{m_topology.cpu(m_placement, t)};
+            // Re-pin in every parallel region: Does not rely on the thread
+            // pool keeping the same threads between regions
+            if (cpu < 0 || !pin_current_thread(cpu)) {
+                // Unpinned threads may migrate: Best guess for the node
+                cpu = current_cpu();
+            }
+            const std::size_t node{m_topology.node_index(cpu)};
+
+            const auto &trks = *tracks[node % tracks.size()];
+            const auto &det = *dets[node % dets.size()];
+
+            // Static partition of the track sample
+            const auto n{static_cast<std::size_t>(n_samples)};
+            const auto n_t{static_cast<std::size_t>(n_thrds)};
+            const auto s{static_cast<std::size_t>(stride)};
+            const std::size_t begin{n * t / n_t};
+            const std::size_t end{n * (t + 1u) / n_t};
+            for (std::size_t i = begin; i < end; i += s) {
+                // The track gets copied into the stepper state, so that the
+                // original track sample vector remains unchanged
+                run_propagation(trks[i], det);
+            }
+
+            return std::pair{node, (end - begin + s - 1u) / s};
+        };
+
+        // Warm-up
+        if (m_cfg.benchmark().do_warmup()) {
+            assert(n_warmup > 0);
+            int stride{n_samples / n_warmup};
+            stride = (stride == 0) ? 10 : stride;
+            assert(stride > 0);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(n_threads)
+            run_thread(omp_get_thread_num(), omp_get_num_threads(), stride);
+#else
+            run_thread(0, 1, stride);
+#endif
+        } else {
+            std::cout << "WARNING: Running host benchmarks without warmup"
+                      << std::endl;
+        }
+
+        // Run the benchmark
+        std::size_t total_tracks = 0u;
+        std::vector<std::size_t> node_tracks(n_nodes, 0u);
+        for (auto _ : state) {
+#ifdef _OPENMP
+#pragma omp parallel num_threads(n_threads)
+            {
+                const auto [node, n_trks] = run_thread(
+                    omp_get_thread_num(), omp_get_num_threads(), 1);
+#pragma omp atomic
+                node_tracks[node] += n_trks;
+            }
+#else
+            const auto [node, n_trks] = run_thread(0, 1, 1);
+            node_tracks[node] += n_trks;
+#endif
+            total_tracks += static_cast<std::size_t>(n_samples);
+        }
+
+        // Report throughput, in total and per node
+        state.counters["TracksPropagated"] = benchmark::Counter(
+            static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+        for (std::size_t i = 0u; i < n_nodes; ++i) {
+            const std::string node_id{
+                std::to_string(m_topology.nodes()[i].id)};
+            state.counters["TracksPropagated_Node" + node_id] =
+                benchmark::Counter(static_cast<double>(node_tracks[i]),
+                                   benchmark::Counter::kIsRate);
+        }
+#ifdef _OPENMP
+        state.counters["HostThreads"] = static_cast<double>(n_threads);
+#else
+        state.counters["HostThreads"] = 1.;
+#endif
+        state.counters["DetectorCopies"] = static_cast<double>(dets.size());
+    }
+};
+
+/// Register a propagation benchmark with explicit thread placement for every
+/// number of threads in @param n_host_threads
+///
+/// @param name name for the benchmark
+/// @param bench_cfg basic benchmark configuration
+/// @param prop_cfg propagation configuration
+/// @param topo the host topology
+/// @param placement how to pin the threads to the cpus
+/// @param dets one detector per node, or a single detector
+/// @param bfield the covfie field
+/// @param actor_states tuple that contains all actor states
+/// @param track_samples the pre-computed track samples: one set per node, or
+///                      a single set
+/// @param n_samples the number of track to run per sample
+/// @param n_host_threads the number of threads per sample
+template <typename propagator_t, typename bfield_bknd_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+inline void register_numa_benchmark(
+    const std::string &name, benchmark_base::configuration &bench_cfg,
+    const propagation::config &prop_cfg, const numa_topology &topo,
+    const thread_placement placement,
+    const std::vector<const typename propagator_t::detector_type *> &dets,
+    bfield_bknd_t &bfield,
+    typename propagator_t::actor_chain_type::state_tuple *actor_states,
+    const std::vector<const std::vector<dvector<free_track_parameters<
+        typename propagator_t::detector_type::algebra_type>>> *>
+        &track_samples,
+    const std::vector<int> &n_samples, const std::vector<int> &n_host_threads) {
+
+    using detector_t = typename propagator_t::detector_type;
+    using track_t = free_track_parameters<typename detector_t::algebra_type>;
+    using propagation_benchmark_t =
+        host_numa_propagation_bm<propagator_t, bfield_bknd_t, kOPT>;
+
+    assert(!dets.empty());
+    assert(!track_samples.empty());
+
+    const std::size_t bench_range{
+        math::max(n_samples.size(), n_host_threads.size())};
+    for (std::size_t i = 0u; i < bench_range; ++i) {
+
+        const std::size_t sample_idx{track_samples[0]->size() == 1u ? 0u : i};
+        std::vector<const dvector<track_t> *> tracks{};
+        for (const auto *node_samples : track_samples) {
+            tracks.push_back(&(*node_samples)[sample_idx]);
+        }
+        const int host_threads{n_host_threads.size() == 1u ? n_host_threads[0]
+                                                           : n_host_threads[i]};
+        const int n{n_samples.size() == 1u ? n_samples[0] : n_samples[i]};
+        assert(static_cast<std::size_t>(n) <= tracks[0]->size());
+
+        bench_cfg.n_samples(n);
+
+        typename propagation_benchmark_t::configuration prop_bm_cfg{bench_cfg};
+        prop_bm_cfg.propagation() = prop_cfg;
+
+        // Configure the benchmark
+        propagation_benchmark_t prop_benchmark{prop_bm_cfg, topo, placement};
+
+        std::string bench_name = prop_benchmark.config().name() + "_" + name +
+                                 "_" + std::to_string(n) + "_TRACKS";
+
+        std::cout << bench_name << "\n" << bench_cfg;
+
+        ::benchmark::RegisterBenchmark(bench_name.c_str(), prop_benchmark,
+                                       tracks, dets, &bfield, actor_states,
+                                       host_threads)
+            ->UseRealTime();
+    }
+}
+
+}  // namespace detray::benchmarks
@@ -161,6 +161,12 @@ struct host_propagation_bm : public benchmark_base {
         // Report throughput
         state.counters["TracksPropagated"] = benchmark::Counter(
             static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+        // Number of host threads of this benchmark case
+#ifdef _OPENMP
+        state.counters["HostThreads"] = static_cast<double>(n_threads);
+#else
+        state.counters["HostThreads"] = 1.;
+#endif
     }
 };
 
@@ -0,0 +1,247 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#if defined(__linux__)
+// Linux include(s)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// System include(s)
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detray::benchmarks {
+
+/// How the host threads are placed on the cpus of the NUMA nodes
+enum class thread_placement {
+    /// Leave the placement to the OS
+    e_none = 0,
+    /// Fill the cpus of one node before moving to the next
+    e_compact = 1,
+    /// Distribute consecutive threads round-robin over the nodes
+    e_scatter = 2,
+};
+
+/// @returns the thread placement for the name @param name
+inline thread_placement thread_placement_from_string(
+    const std::string_view name) {
+    if (name == "none") {
+        return thread_placement::e_none;
+    }
+    if (name == "compact") {
+        return thread_placement::e_compact;
+    }
+    if (name == "scatter") {
+        return thread_placement::e_scatter;
+    }
+    throw std::invalid_argument("Unknown thread placement: " +
+                                std::string{name} +
+                                " (use 'none', 'compact' or 'scatter')");
+}
+
+/// A NUMA node and the cpus that belong to it
+struct numa_node {
+    unsigned int id{0u};
+    std::vector<int> cpus{};
+};
+
+/// @returns the cpus in a linux cpu list string, e.g. "0-3,8,10-11"
+inline std::vector<int> parse_cpu_list(const std::string &cpu_list) {
+    std::vector<int> cpus{};
+
+    std::stringstream ss{cpu_list};
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const std::size_t dash{range.find('-')};
+        const int first{std::stoi(range.substr(0u, dash))};
+        const int last{dash == std::string::npos
+                           ? first
+                           : std::stoi(range.substr(dash + 1u))};
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+
+    return cpus;
+}
+
+/// Host topology as seen by the benchmark: NUMA nodes and their cpus
+class numa_topology {
+    public:
+    /// Read the topology from sysfs. Falls back to a single node that holds
+    /// all hardware threads, if the information is not available
+    numa_topology() {
+        namespace fs = std::filesystem;
+
+        const fs::path node_dir{"/sys/devices/system/node"};
+        std::error_code ec;
+        if (fs::is_directory(node_dir, ec)) {
+            for (const auto &entry : fs::directory_iterator(node_dir, ec)) {
+                const std::string name{entry.path().filename().string()};
+                if (!name.starts_with("node") ||
+                    name.find_first_not_of("0123456789", 4u) !=
+                        std::string::npos) {
+                    continue;
+                }
+
+                std::ifstream cpu_file(entry.path() / "cpulist");
+                std::string cpu_list;
+                std::getline(cpu_file, cpu_list);
+
+                numa_node node{static_cast<unsigned int>(
+                                   std::stoul(name.substr(4u))),
+                               parse_cpu_list(cpu_list)};
+                // Memory-only nodes cannot run threads
+                if (!node.cpus.empty()) {
+                    m_nodes.push_back(std::move(node));
+                }
+            }
+        }
+
+        if (m_nodes.empty()) {
+            numa_node node{};
+            const unsigned int n_cpus{
+                std::max(std::thread::hardware_concurrency(), 1u)};
+            for (unsigned int cpu = 0u; cpu < n_cpus; ++cpu) {
+                node.cpus.push_back(static_cast<int>(cpu));
+            }
+            m_nodes.push_back(std::move(node));
+        }
+
+        std::ranges::sort(m_nodes,
+                          [](const numa_node &a, const numa_node &b) {
+                              return a.id < b.id;
+                          });
+    }
+
+    /// @returns the number of nodes that have cpus
+    std::size_t n_nodes() const { return m_nodes.size(); }
+
+    /// @returns the nodes
+    const std::vector<numa_node> &nodes() const { return m_nodes; }
+
+    /// @returns the position of the node in the node list that the cpu
+    /// @param cpu belongs to (first node, if unknown)
+    std::size_t node_index(const int cpu) const {
+        for (std::size_t i = 0u; i < m_nodes.size(); ++i) {
+            if (std::ranges::find(m_nodes[i].cpus, cpu) !=
+                m_nodes[i].cpus.end()) {
+                return i;
+            }
+        }
+        return 0u;
+    }
+
+    /// @returns the cpu for the thread with index @param thread_idx with
+    /// the placement @param placement (-1 for 'e_none')
+    int cpu(const thread_placement placement,
+            const std::size_t thread_idx) const {
+
+        switch (placement) {
+            case thread_placement::e_compact: {
+                std::size_t n_cpus{0u};
+                for (const numa_node &node : m_nodes) {
+                    n_cpus += node.cpus.size();
+                }
+                // Oversubscription wraps around
+                std::size_t idx{thread_idx % n_cpus};
+                for (const numa_node &node : m_nodes) {
+                    if (idx < node.cpus.size()) {
+                        return node.cpus[idx];
+                    }
+                    idx -= node.cpus.size();
+                }
+                return -1;
+            }
+            case thread_placement::e_scatter: {
+                const numa_node &node = m_nodes[thread_idx % m_nodes.size()];
+                const std::size_t idx{thread_idx / m_nodes.size()};
+                return node.cpus[idx % node.cpus.size()];
+            }
+            default:
+                return -1;
+        }
+    }
+
+    private:
+    std::vector<numa_node> m_nodes{};
+};
+
+/// Pin the calling thread to the cpu @param cpu
+///
+/// @returns whether the thread was pinned
+inline bool pin_current_thread(const int cpu) {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t),
+                                  &cpu_set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/// @returns the cpu the calling thread currently runs on (-1 if unknown)
+inline int current_cpu() {
+#if defined(__linux__)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+/// Construct one object per NUMA node, e.g. a detector
+///
+/// Each object is constructed by @param make_object on a thread that is
+/// pinned to the first cpu of the respective node. Under the default
+/// first-touch policy of the OS, the memory that is written during
+/// construction is therefore local to that node.
+///
+/// @returns a vector with one object per node (same order as the nodes)
+template <typename object_t, typename factory_t>
+inline std::vector<object_t> make_numa_replicas(const numa_topology &topo,
+                                                factory_t &&make_object) {
+    std::vector<object_t> replicas{};
+    replicas.reserve(topo.n_nodes());
+
+    for (const numa_node &node : topo.nodes()) {
+        // Construct sequentially, so the factory needs not be thread-safe
+        std::thread worker([&replicas, &make_object, &node]() {
+            if (!pin_current_thread(node.cpus.front())) {
+                std::cout << "WARNING: Could not pin thread to node "
+                          << node.id << std::endl;
+            }
+            replicas.push_back(make_object());
+        });
+        worker.join();
+    }
+
+    return replicas;
+}
+
+}  // namespace detray::benchmarks
@@ -0,0 +1,335 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_base.hpp"
+#include "detray/benchmarks/device/cuda/propagation_benchmark.hpp"
+#include "detray/benchmarks/propagation_benchmark_config.hpp"
+#include "detray/benchmarks/propagation_benchmark_utils.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+#ifdef _OPENMP
+// openMP include
+#include <omp.h>
+#endif
+
+// System include(s)
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace detray::benchmarks {
+
+/// Dispatch policy of the hybrid propagation scheduler
+struct hybrid_dispatch_config {
+    /// Events with fewer tracks are always propagated on the host
+    unsigned int min_device_tracks{5000u};
+    /// Events with at least this many tracks always wait for the device
+    unsigned int max_host_tracks{100'000u};
+    /// Maximal number of events that are on the device at the same time
+    unsigned int max_device_events{1u};
+    /// Number of threads per block of the propagation kernel
+    int block_size{256};
+};
+
+/// Number of events that were propagated on the host and on the device
+struct dispatch_counts {
+    std::size_t n_host_events{0u};
+    std::size_t n_device_events{0u};
+};
+
+/// @brief Host scheduler that propagates events on the CPU or the GPU.
+///
+/// The events are distributed over the host threads in dynamic order. Every
+/// thread decides per event where to propagate it: Small events stay on the
+/// thread, where they finish before the transfers and the kernel launch of a
+/// device propagation would. Larger events are sent to the device, as long as
+/// fewer than the configured number of events are already running there.
+/// Otherwise, they are propagated on the host as well, unless they are too
+/// large, in which case the thread waits for the device to become available.
+///
+/// Both paths use the same tracks, propagation configuration and actor state
+/// blueprint.
+///
+/// @note The propagation kernel synchronizes the device: Concurrent device
+/// events are only overlapped with each other's transfers.
+template <typename propagator_t>
+class hybrid_propagation_scheduler {
+
+    using detector_t = typename propagator_t::detector_type;
+    using field_view_t =
+        typename propagator_t::stepper_type::magnetic_field_type;
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+    using actor_states_t = typename actor_chain_t::state_tuple;
+
+    public:
+    using algebra_type = typename detector_t::algebra_type;
+    using track_type = free_track_parameters<algebra_type>;
+
+    /// Construct the scheduler
+    ///
+    /// @param cfg the dispatch policy
+    /// @param prop_cfg the propagation configuration
+    /// @param det the host detector
+    /// @param det_view the view on the detector copy on device
+    /// @param field_view the magnetic field view
+    /// @param host_actor_states the actor state blueprint on host
+    /// @param device_actor_states the actor state blueprint on device
+    /// @param dev_mr the device memory resource for the tracks
+    hybrid_propagation_scheduler(
+        const hybrid_dispatch_config &cfg,
+        const propagation::config &prop_cfg, const detector_t &det,
+        typename detector_t::view_type det_view, field_view_t field_view,
+        const actor_states_t *host_actor_states,
+        actor_states_t *device_actor_states, vecmem::memory_resource &dev_mr)
+        : m_cfg{cfg},
+          m_prop_cfg{prop_cfg},
+          m_det{&det},
+          m_det_view{det_view},
+          m_field_view{field_view},
+          m_host_actor_states{host_actor_states},
+          m_device_actor_states{device_actor_states},
+          m_dev_mr{&dev_mr} {
+
+        assert(m_host_actor_states != nullptr);
+        assert(m_device_actor_states != nullptr);
+        assert(m_cfg.max_device_events > 0u);
+    }
+
+    /// @returns the dispatch policy
+    const hybrid_dispatch_config &config() const { return m_cfg; }
+
+    /// Propagate all tracks in @param events on @param n_threads host threads
+    ///
+    /// @returns the number of events that were propagated on host and device
+    dispatch_counts run(std::vector<dvector<track_type>> &events,
+                        [[maybe_unused]] const int n_threads) {
+
+        const int n_events{static_cast<int>(events.size())};
+        std::size_t n_host{0u};
+        std::size_t n_device{0u};
+
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1) \
+    reduction(+ : n_host, n_device)
+        for (int i = 0; i < n_events; ++i) {
+            auto &tracks = events[static_cast<std::size_t>(i)];
+
+            if (acquire_device(tracks.size())) {
+                propagate_on_device(tracks);
+                m_n_device_events.fetch_sub(1u);
+                ++n_device;
+            } else {
+                propagate_on_host(tracks);
+                ++n_host;
+            }
+        }
+
+        return {n_host, n_device};
+    }
+
+    private:
+    /// Reserve a place on the device for an event with @param n_tracks
+    ///
+    /// @returns false if the event should be propagated on the host
+    bool acquire_device(const std::size_t n_tracks) {
+        if (n_tracks < m_cfg.min_device_tracks) {
+            return false;
+        }
+        const bool must_wait{n_tracks >= m_cfg.max_host_tracks};
+
+        unsigned int n_busy{m_n_device_events.load()};
+        while (true) {
+            if (n_busy < m_cfg.max_device_events) {
+                if (m_n_device_events.compare_exchange_weak(n_busy,
+                                                            n_busy + 1u)) {
+                    return true;
+                }
+            } else if (!must_wait) {
+                return false;
+            } else {
+                std::this_thread::yield();
+                n_busy = m_n_device_events.load();
+            }
+        }
+    }
+
+    /// Propagate the event @param tracks sequentially on the calling thread
+    void propagate_on_host(const dvector<track_type> &tracks) const {
+
+        propagator_t p{m_prop_cfg};
+
+        for (const auto &track : tracks) {
+            // Fresh copy of actor states
+            actor_states_t actor_states(*m_host_actor_states);
+            typename actor_chain_t::state_ref_tuple actor_state_refs =
+                actor_chain_t::setup_actor_states(actor_states);
+
+            typename propagator_t::state p_state(track, m_field_view, *m_det);
+            // Particle hypothesis
+            auto &ptc = p_state._stepping.particle_hypothesis();
+            p_state.set_particle(update_particle_hypothesis(ptc, track));
+
+            ::benchmark::DoNotOptimize(p.propagate(p_state, actor_state_refs));
+        }
+    }
+
+    /// Copy the event @param tracks to device and propagate it there
+    void propagate_on_device(dvector<track_type> &tracks) const {
+
+        vecmem::cuda::copy cuda_cpy;
+        auto track_buffer =
+            detray::get_buffer(vecmem::get_data(tracks), *m_dev_mr, cuda_cpy);
+
+        run_propagation_kernel<propagator_t>(
+            m_prop_cfg, m_det_view, m_field_view, m_device_actor_states,
+            track_buffer, static_cast<int>(tracks.size()), m_cfg.block_size);
+    }
+
+    /// The dispatch policy
+    hybrid_dispatch_config m_cfg;
+    /// The propagation configuration of both paths
+    propagation::config m_prop_cfg;
+    /// The host detector
+    const detector_t *m_det{nullptr};
+    /// View on the device copy of the detector
+    typename detector_t::view_type m_det_view;
+    /// The magnetic field
+    field_view_t m_field_view;
+    /// Actor state blueprints
+    /// @{
+    const actor_states_t *m_host_actor_states{nullptr};
+    actor_states_t *m_device_actor_states{nullptr};
+    /// @}
+    /// Memory resource for the device track buffers
+    vecmem::memory_resource *m_dev_mr{nullptr};
+    /// Number of events that are currently on the device
+    std::atomic<unsigned int> m_n_device_events{0u};
+};
+
+/// Hybrid host/device propagation benchmark: Propagates a sequence of events
+/// of different sizes per iteration with the hybrid scheduler
+template <typename propagator_t, typename bfield_bknd_t>
+struct hybrid_propagation_bm : public benchmark_base {
+    /// Detector dependent types
+    using algebra_t = typename propagator_t::detector_type::algebra_type;
+
+    /// Local configuration type
+    using configuration = propagation_benchmark_config;
+
+    /// The benchmark configuration
+    configuration m_cfg{};
+    /// The dispatch policy
+    hybrid_dispatch_config m_dispatch_cfg{};
+
+    /// Default construction
+    hybrid_propagation_bm() = default;
+
+    /// Construct from an externally provided configuration @param cfg and
+    /// dispatch policy @param dispatch_cfg
+    hybrid_propagation_bm(const configuration &cfg,
+                          const hybrid_dispatch_config &dispatch_cfg)
+        : m_cfg{cfg}, m_dispatch_cfg{dispatch_cfg} {}
+
+    /// @return the benchmark configuration
+    configuration &config() { return m_cfg; }
+
+    /// Prepare data and run benchmark loop
+    inline void operator()(
+        ::benchmark::State &state, vecmem::memory_resource *dev_mr,
+        std::vector<dvector<free_track_parameters<algebra_t>>> *events,
+        const typename propagator_t::detector_type *det,
+        const bfield_bknd_t *bfield,
+        typename propagator_t::actor_chain_type::state_tuple
+            *input_actor_states,
+        const int n_threads) const {
+
+        assert(dev_mr != nullptr);
+        assert(events != nullptr);
+        assert(det != nullptr);
+        assert(bfield != nullptr);
+        assert(input_actor_states != nullptr);
+
+        // Copy the detector and the actor state blueprint to device
+        vecmem::cuda::copy cuda_cpy;
+        auto det_buffer = detray::get_buffer(*det, *dev_mr, cuda_cpy);
+        auto *device_actor_state_ptr =
+            setup_actor_states<propagator_t>(input_actor_states);
+
+        hybrid_propagation_scheduler<propagator_t> scheduler{
+            m_dispatch_cfg,
+            m_cfg.propagation(),
+            *det,
+            detray::get_data(det_buffer),
+            *bfield,
+            input_actor_states,
+            device_actor_state_ptr,
+            *dev_mr};
+
+        std::size_t n_event_tracks{0u};
+        for (const auto &tracks : *events) {
+            n_event_tracks += tracks.size();
+        }
+
+        // One pass over all events as warmup
+        if (m_cfg.benchmark().do_warmup()) {
+            scheduler.run(*events, n_threads);
+        } else {
+            std::cout << "WARNING: Running hybrid benchmarks without warmup "
+                         "is not recommended"
+                      << std::endl;
+        }
+
+        std::size_t total_tracks{0u};
+        dispatch_counts total_counts{};
+        for (auto _ : state) {
+            const dispatch_counts counts{scheduler.run(*events, n_threads)};
+
+            total_counts.n_host_events += counts.n_host_events;
+            total_counts.n_device_events += counts.n_device_events;
+            total_tracks += n_event_tracks;
+        }
+
+        // Report throughput
+        state.counters["TracksPropagated"] = benchmark::Counter(
+            static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+
+        // Where the events were propagated
+        state.counters["HostEvents"] =
+            benchmark::Counter(static_cast<double>(total_counts.n_host_events),
+                               benchmark::Counter::kAvgIterations);
+        state.counters["DeviceEvents"] = benchmark::Counter(
+            static_cast<double>(total_counts.n_device_events),
+            benchmark::Counter::kAvgIterations);
+
+        // Dispatch policy
+        state.counters["HostThreads"] = static_cast<double>(n_threads);
+        state.counters["MinDeviceTracks"] =
+            static_cast<double>(m_dispatch_cfg.min_device_tracks);
+        state.counters["BlockSize"] =
+            static_cast<double>(m_dispatch_cfg.block_size);
+
+        release_actor_states<propagator_t>(device_actor_state_ptr);
+    }
+};
+
+}  // namespace detray::benchmarks
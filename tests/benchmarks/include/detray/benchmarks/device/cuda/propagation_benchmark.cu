@@ -8,8 +8,72 @@
 #include "detray/benchmarks/device/cuda/propagation_benchmark.hpp"
 #include "detray/definitions/detail/cuda_definitions.hpp"
 
+// System include(s)
+#include <algorithm>
+#include <stdexcept>
+
 namespace detray::benchmarks {
 
+/// Device propagator type of the benchmark
+template <typename propagator_t>
+using device_propagator_t = propagator<
+    typename propagator_t::stepper_type,
+    navigator<detector<typename propagator_t::detector_type::metadata,
+                       device_container_types>>,
+    typename propagator_t::actor_chain_type>;
+
+/// Number of lanes that propagate the same track in the cooperative kernel
+constexpr unsigned int cooperative_group_size{4u};
+
+/// Device propagator type of the benchmark, of which the navigator shares the
+/// candidate intersection between the lanes of a group
+template <typename propagator_t>
+using device_cooperative_propagator_t = propagator<
+    typename propagator_t::stepper_type,
+    navigator<detector<typename propagator_t::detector_type::metadata,
+                       device_container_types>,
+              navigation::default_cache_size, navigation::void_inspector,
+              intersection2D<
+                  typename propagator_t::detector_type::surface_type,
+                  typename propagator_t::detector_type::algebra_type, false>,
+              ray_intersector,
+              detail::cuda_lane_group<cooperative_group_size>>,
+    typename propagator_t::actor_chain_type>;
+
+/// Propagate a single track
+template <typename propagator_t, detray::benchmarks::propagation_opt kOPT,
+          typename detector_device_t>
+__device__ inline void propagate_track(
+    const propagator_t &p, const detector_device_t &det,
+    const typename propagator_t::stepper_type::magnetic_field_type &field_view,
+    const typename propagator_t::actor_chain_type::state_tuple
+        *device_actor_state_ptr,
+    const typename propagator_t::free_track_parameters_type &track) {
+
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    // Create the actor states on a fresh copy
+    typename actor_chain_t::state_tuple actor_states = *device_actor_state_ptr;
+    auto actor_state_refs = actor_chain_t::setup_actor_states(actor_states);
+
+    // Create the propagator state
+
+    // The track gets copied into the stepper state, so that the
+    // original track sample vector remains unchanged
+    typename propagator_t::state p_state(track, field_view, det);
+
+    // Particle hypothesis
+    auto &ptc = p_state._stepping.particle_hypothesis();
+    p_state.set_particle(update_particle_hypothesis(ptc, track));
+
+    // Run propagation
+    if constexpr (kOPT == detray::benchmarks::propagation_opt::e_unsync) {
+        p.propagate(p_state, actor_state_refs);
+    } else {
+        p.propagate_sync(p_state, actor_state_refs);
+    }
+}
+
 template <typename propagator_t, detray::benchmarks::propagation_opt kOPT>
 __global__ void __launch_bounds__(256, 4) propagator_benchmark_kernel(
     propagation::config cfg,
@@ -21,14 +85,9 @@ __global__ void __launch_bounds__(256, 4) propagator_benchmark_kernel(
         free_track_parameters<typename propagator_t::algebra_type>>
         tracks_view) {
 
-    using detector_device_t =
-        detector<typename propagator_t::detector_type::metadata,
-                 device_container_types>;
+    using propagator_device_t = device_propagator_t<propagator_t>;
+    using detector_device_t = typename propagator_device_t::detector_type;
     using algebra_t = typename detector_device_t::algebra_type;
-    using actor_chain_t = typename propagator_t::actor_chain_type;
-    using propagator_device_t =
-        propagator<typename propagator_t::stepper_type,
-                   navigator<detector_device_t>, actor_chain_t>;
 
     const detector_device_t det(det_view);
     const vecmem::device_vector<free_track_parameters<algebra_t>> tracks(
@@ -42,26 +101,91 @@ __global__ void __launch_bounds__(256, 4) propagator_benchmark_kernel(
     // Create propagator
     propagator_device_t p{cfg};
 
-    // Create the actor states on a fresh copy
-    typename actor_chain_t::state_tuple actor_states = *device_actor_state_ptr;
-    auto actor_state_refs = actor_chain_t::setup_actor_states(actor_states);
+    propagate_track<propagator_device_t, kOPT>(
+        p, det, field_view, device_actor_state_ptr, tracks.at(gid));
+}
 
-    // Create the propagator state
+/// Cooperative propagation kernel: A group of neighbouring lanes propagates
+/// the same track. The lanes run the same propagation on identical copies of
+/// the track state, but split the intersection of the candidates in the
+/// navigator initialization between them.
+///
+/// @note the block size needs to be a multiple of the warp size
+template <typename propagator_t>
+__global__ void __launch_bounds__(256, 4) propagator_cooperative_kernel(
+    propagation::config cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    typename propagator_t::stepper_type::magnetic_field_type field_view,
+    const typename propagator_t::actor_chain_type::state_tuple
+        *device_actor_state_ptr,
+    vecmem::data::vector_view<
+        free_track_parameters<typename propagator_t::algebra_type>>
+        tracks_view) {
 
-    // The track gets copied into the stepper state, so that the
-    // original track sample vector remains unchanged
-    typename propagator_device_t::state p_state(tracks.at(gid), field_view,
-                                                det);
+    using propagator_device_t = device_cooperative_propagator_t<propagator_t>;
+    using detector_device_t = typename propagator_device_t::detector_type;
+    using algebra_t = typename detector_device_t::algebra_type;
 
-    // Particle hypothesis
-    auto &ptc = p_state._stepping.particle_hypothesis();
-    p_state.set_particle(update_particle_hypothesis(ptc, tracks.at(gid)));
+    const detector_device_t det(det_view);
+    const vecmem::device_vector<free_track_parameters<algebra_t>> tracks(
+        tracks_view);
 
-    // Run propagation
-    if constexpr (kOPT == detray::benchmarks::propagation_opt::e_unsync) {
-        p.propagate(p_state, actor_state_refs);
-    } else if constexpr (kOPT == detray::benchmarks::propagation_opt::e_sync) {
-        p.propagate_sync(p_state, actor_state_refs);
+    // All lanes of a group get the same track and exit together
+    const unsigned int gid{(threadIdx.x + blockIdx.x * blockDim.x) /
+                           cooperative_group_size};
+    if (gid >= tracks.size()) {
+        return;
+    }
+
+    // Create propagator
+    propagator_device_t p{cfg};
+
+    propagate_track<propagator_device_t,
+                    detray::benchmarks::propagation_opt::e_unsync>(
+        p, det, field_view, device_actor_state_ptr, tracks.at(gid));
+}
+
+/// Persistent propagation kernel: Only as many threads are launched as can be
+/// resident on the device. Every lane pulls the next track from a global work
+/// queue as soon as its current track has terminated, so that a lane with a
+/// short track does not idle until the longest track of its warp is done.
+///
+/// @note Lanes of a warp that propagate different tracks diverge, but stay
+/// busy. They reconverge where their tracks run the same code path.
+template <typename propagator_t>
+__global__ void __launch_bounds__(256, 4) propagator_persistent_kernel(
+    propagation::config cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    typename propagator_t::stepper_type::magnetic_field_type field_view,
+    const typename propagator_t::actor_chain_type::state_tuple
+        *device_actor_state_ptr,
+    vecmem::data::vector_view<
+        free_track_parameters<typename propagator_t::algebra_type>>
+        tracks_view,
+    const unsigned int n_tracks, unsigned int *work_queue) {
+
+    using propagator_device_t = device_propagator_t<propagator_t>;
+    using detector_device_t = typename propagator_device_t::detector_type;
+    using algebra_t = typename detector_device_t::algebra_type;
+
+    const detector_device_t det(det_view);
+    const vecmem::device_vector<free_track_parameters<algebra_t>> tracks(
+        tracks_view);
+    assert(n_tracks <= tracks.size());
+
+    // Create propagator
+    propagator_device_t p{cfg};
+
+    while (true) {
+        // Every lane refills on its own
+        const unsigned int gid{atomicAdd(work_queue, 1u)};
+        if (gid >= n_tracks) {
+            return;
+        }
+
+        propagate_track<propagator_device_t,
+                        detray::benchmarks::propagation_opt::e_sync>(
+            p, det, field_view, device_actor_state_ptr, tracks.at(gid));
     }
 }
 
@@ -91,8 +215,66 @@ void release_actor_states(typename propagator_t::actor_chain_type::state_tuple
     assert(success == cudaSuccess);
 }
 
+std::size_t get_used_device_memory() {
+    std::size_t free_bytes{0u};
+    std::size_t total_bytes{0u};
+    DETRAY_CUDA_ERROR_CHECK(cudaMemGetInfo(&free_bytes, &total_bytes));
+
+    return total_bytes - free_bytes;
+}
+
 template <typename propagator_t, detray::benchmarks::propagation_opt kOPT>
-void run_propagation_kernel(
+kernel_info get_kernel_info(const int block_size) {
+
+    // The kernel that is launched for the propagation option
+    const void *kernel{nullptr};
+    if constexpr (kOPT == detray::benchmarks::propagation_opt::e_persistent) {
+        kernel = reinterpret_cast<const void *>(
+            propagator_persistent_kernel<propagator_t>);
+    } else if constexpr (kOPT ==
+                         detray::benchmarks::propagation_opt::e_graph) {
+        kernel = reinterpret_cast<const void *>(
+            propagator_benchmark_kernel<
+                propagator_t, detray::benchmarks::propagation_opt::e_unsync>);
+    } else if constexpr (kOPT ==
+                         detray::benchmarks::propagation_opt::e_cooperative) {
+        kernel = reinterpret_cast<const void *>(
+            propagator_cooperative_kernel<propagator_t>);
+    } else {
+        kernel = reinterpret_cast<const void *>(
+            propagator_benchmark_kernel<propagator_t, kOPT>);
+    }
+
+    cudaFuncAttributes attr{};
+    DETRAY_CUDA_ERROR_CHECK(cudaFuncGetAttributes(&attr, kernel));
+
+    kernel_info info{};
+    info.n_registers = attr.numRegs;
+    info.local_mem_bytes = attr.localSizeBytes;
+    info.shared_mem_bytes = attr.sharedSizeBytes;
+    info.max_threads_per_block = attr.maxThreadsPerBlock;
+
+    if (block_size <= 0 || block_size > attr.maxThreadsPerBlock) {
+        return info;
+    }
+
+    int device{0};
+    int max_threads_per_sm{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &max_threads_per_sm, cudaDevAttrMaxThreadsPerMultiProcessor, device));
+    DETRAY_CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &info.active_blocks_per_sm, kernel, block_size, 0));
+
+    info.occupancy =
+        static_cast<double>(info.active_blocks_per_sm * block_size) /
+        static_cast<double>(max_threads_per_sm);
+
+    return info;
+}
+
+template <typename propagator_t, detray::benchmarks::propagation_opt kOPT>
+float run_propagation_kernel(
     const propagation::config &cfg,
     typename propagator_t::detector_type::view_type det_view,
     typename propagator_t::stepper_type::magnetic_field_type field_view,
@@ -101,24 +283,209 @@ void run_propagation_kernel(
     vecmem::data::vector_view<
         free_track_parameters<typename propagator_t::algebra_type>>
         tracks_view,
-    const int n_samples) {
+    const int n_samples, const int block_size) {
+
+    const int thread_dim{block_size};
+
+    // Time the kernel execution only
+    cudaEvent_t start;
+    cudaEvent_t stop;
+    DETRAY_CUDA_ERROR_CHECK(cudaEventCreate(&start));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventCreate(&stop));
+
+    if constexpr (kOPT == detray::benchmarks::propagation_opt::e_persistent) {
+        // Launch only as many blocks as can be resident at the same time
+        int device{0};
+        int n_sm{0};
+        int blocks_per_sm{0};
+        DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+            &n_sm, cudaDevAttrMultiProcessorCount, device));
+        DETRAY_CUDA_ERROR_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, propagator_persistent_kernel<propagator_t>,
+            thread_dim, 0));
+
+        const int max_block_dim{(n_samples + thread_dim - 1) / thread_dim};
+        const int block_dim{
+            math::max(1, math::min(max_block_dim, n_sm * blocks_per_sm))};
+
+        // Global work queue
+        unsigned int *work_queue{nullptr};
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMalloc((void **)&work_queue, sizeof(unsigned int)));
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMemset(work_queue, 0, sizeof(unsigned int)));
+
+        DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(start));
+        propagator_persistent_kernel<propagator_t>
+            <<<block_dim, thread_dim>>>(cfg, det_view, field_view,
+                                        device_actor_state_ptr, tracks_view,
+                                        static_cast<unsigned int>(n_samples),
+                                        work_queue);
+        DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(stop));
+
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+        DETRAY_CUDA_ERROR_CHECK(cudaFree(work_queue));
+    } else if constexpr (kOPT ==
+                         detray::benchmarks::propagation_opt::e_cooperative) {
+        // One group of lanes per track
+        const int n_threads{n_samples *
+                            static_cast<int>(cooperative_group_size)};
+        const int block_dim{(n_threads + thread_dim - 1) / thread_dim};
+
+        DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(start));
+        propagator_cooperative_kernel<propagator_t>
+            <<<block_dim, thread_dim>>>(cfg, det_view, field_view,
+                                        device_actor_state_ptr, tracks_view);
+        DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(stop));
+
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+    } else {
+        int block_dim = (n_samples + thread_dim - 1) / thread_dim;
+
+        // run the test kernel
+        DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(start));
+        propagator_benchmark_kernel<propagator_t, kOPT>
+            <<<block_dim, thread_dim>>>(cfg, det_view, field_view,
+                                        device_actor_state_ptr, tracks_view);
+        DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(stop));
+
+        // cuda error check
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+    }
+
+    float kernel_ms{0.f};
+    DETRAY_CUDA_ERROR_CHECK(cudaEventElapsedTime(&kernel_ms, start, stop));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventDestroy(start));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventDestroy(stop));
+
+    return kernel_ms;
+}
+
+template <typename propagator_t>
+struct cuda_propagation_graph<propagator_t>::impl {
+    unsigned int capacity{0u};
+    cudaStream_t stream{};
+    cudaGraph_t graph{};
+    cudaGraphExec_t graph_exec{};
+    cudaEvent_t start{};
+    cudaEvent_t stop{};
+    /// Pinned staging buffers that are read by the captured copies
+    track_type *host_tracks{nullptr};
+    unsigned int *host_size{nullptr};
+    /// Device track buffer with its size in device memory
+    track_type *device_tracks{nullptr};
+    unsigned int *device_size{nullptr};
+};
+
+template <typename propagator_t>
+cuda_propagation_graph<propagator_t>::cuda_propagation_graph(
+    const propagation::config &cfg,
+    typename propagator_t::detector_type::view_type det_view,
+    typename propagator_t::stepper_type::magnetic_field_type field_view,
+    typename propagator_t::actor_chain_type::state_tuple
+        *device_actor_state_ptr,
+    const unsigned int capacity, const int block_size)
+    : m_impl{std::make_unique<impl>()} {
+
+    impl &d = *m_impl;
+    d.capacity = capacity;
+
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaStreamCreateWithFlags(&d.stream, cudaStreamNonBlocking));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventCreate(&d.start));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventCreate(&d.stop));
 
-    constexpr int thread_dim = 256;
-    int block_dim = (n_samples + thread_dim - 1) / thread_dim;
+    const std::size_t n_bytes{capacity * sizeof(track_type)};
+    DETRAY_CUDA_ERROR_CHECK(cudaMallocHost((void **)&d.host_tracks, n_bytes));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMallocHost((void **)&d.host_size, sizeof(unsigned int)));
+    DETRAY_CUDA_ERROR_CHECK(cudaMalloc((void **)&d.device_tracks, n_bytes));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMalloc((void **)&d.device_size, sizeof(unsigned int)));
+    *d.host_size = 0u;
 
-    // run the test kernel
-    propagator_benchmark_kernel<propagator_t, kOPT><<<block_dim, thread_dim>>>(
-        cfg, det_view, field_view, device_actor_state_ptr, tracks_view);
+    // Resizable view: The kernel reads the number of tracks on device
+    vecmem::data::vector_view<track_type> tracks_view(capacity, d.device_size,
+                                                      d.device_tracks);
 
-    // cuda error check
+    const auto thread_dim{static_cast<unsigned int>(block_size)};
+    const int block_dim{
+        static_cast<int>((capacity + thread_dim - 1u) / thread_dim)};
+
+    // Record the upload and the kernel launch
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaStreamBeginCapture(d.stream, cudaStreamCaptureModeThreadLocal));
+
+    DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(d.device_size, d.host_size,
+                                            sizeof(unsigned int),
+                                            cudaMemcpyHostToDevice, d.stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(d.device_tracks, d.host_tracks,
+                                            n_bytes, cudaMemcpyHostToDevice,
+                                            d.stream));
+    propagator_benchmark_kernel<propagator_t,
+                                detray::benchmarks::propagation_opt::e_unsync>
+        <<<math::max(block_dim, 1), block_size, 0, d.stream>>>(
+            cfg, det_view, field_view, device_actor_state_ptr, tracks_view);
     DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
-    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamEndCapture(d.stream, &d.graph));
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaGraphInstantiateWithFlags(&d.graph_exec, d.graph, 0));
+}
+
+template <typename propagator_t>
+cuda_propagation_graph<propagator_t>::~cuda_propagation_graph() {
+    impl &d = *m_impl;
+
+    DETRAY_CUDA_ERROR_CHECK(cudaGraphExecDestroy(d.graph_exec));
+    DETRAY_CUDA_ERROR_CHECK(cudaGraphDestroy(d.graph));
+    DETRAY_CUDA_ERROR_CHECK(cudaFree(d.device_size));
+    DETRAY_CUDA_ERROR_CHECK(cudaFree(d.device_tracks));
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeHost(d.host_size));
+    DETRAY_CUDA_ERROR_CHECK(cudaFreeHost(d.host_tracks));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventDestroy(d.stop));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventDestroy(d.start));
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamDestroy(d.stream));
+}
+
+template <typename propagator_t>
+float cuda_propagation_graph<propagator_t>::run(
+    std::span<const track_type> tracks) {
+    impl &d = *m_impl;
+
+    if (tracks.size() > d.capacity) {
+        throw std::invalid_argument(
+            "Number of tracks exceeds the capacity of the CUDA graph");
+    }
+
+    // The previous replay has finished reading the staging buffers
+    std::ranges::copy(tracks, d.host_tracks);
+    *d.host_size = static_cast<unsigned int>(tracks.size());
+
+    DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(d.start, d.stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaGraphLaunch(d.graph_exec, d.stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaEventRecord(d.stop, d.stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(d.stream));
+
+    float graph_ms{0.f};
+    DETRAY_CUDA_ERROR_CHECK(cudaEventElapsedTime(&graph_ms, d.start, d.stop));
+
+    return graph_ms;
+}
+
+template <typename propagator_t>
+unsigned int cuda_propagation_graph<propagator_t>::capacity() const {
+    return m_impl->capacity;
 }
 
 /// Macro declaring the template instantiations for the different detector types
 #define DECLARE_PROPAGATION_BENCHMARK(METADATA, CHAIN, FIELD, OPT)             \
                                                                                \
-    template void                                                              \
+    template float                                                             \
     run_propagation_kernel<cuda_propagator_type<METADATA, FIELD, CHAIN>, OPT>( \
         const propagation::config &, detector<METADATA>::view_type,            \
         covfie::field_view<FIELD>,                                             \
@@ -126,6 +493,10 @@ void run_propagation_kernel(
                              CHAIN>::actor_chain_type::state_tuple *,          \
         vecmem::data::vector_view<                                             \
             free_track_parameters<detector<METADATA>::algebra_type>>,          \
+        const int, const int);                                                 \
+                                                                               \
+    template kernel_info                                                       \
+    get_kernel_info<cuda_propagator_type<METADATA, FIELD, CHAIN>, OPT>(        \
         const int);                                                            \
                                                                                \
     template cuda_propagator_type<METADATA, FIELD,                             \
@@ -149,4 +520,40 @@ DECLARE_PROPAGATION_BENCHMARK(test::toy_metadata, empty_chain, const_field_t,
 DECLARE_PROPAGATION_BENCHMARK(test::toy_metadata, default_chain, const_field_t,
                               propagation_opt::e_unsync)
 
+DECLARE_PROPAGATION_BENCHMARK(test::default_metadata, empty_chain,
+                              const_field_t, propagation_opt::e_persistent)
+DECLARE_PROPAGATION_BENCHMARK(test::default_metadata, default_chain,
+                              const_field_t, propagation_opt::e_persistent)
+
+DECLARE_PROPAGATION_BENCHMARK(test::toy_metadata, empty_chain, const_field_t,
+                              propagation_opt::e_persistent)
+DECLARE_PROPAGATION_BENCHMARK(test::toy_metadata, default_chain, const_field_t,
+                              propagation_opt::e_persistent)
+
+DECLARE_PROPAGATION_BENCHMARK(test::default_metadata, empty_chain,
+                              const_field_t, propagation_opt::e_cooperative)
+DECLARE_PROPAGATION_BENCHMARK(test::default_metadata, default_chain,
+                              const_field_t, propagation_opt::e_cooperative)
+
+DECLARE_PROPAGATION_BENCHMARK(test::toy_metadata, empty_chain, const_field_t,
+                              propagation_opt::e_cooperative)
+DECLARE_PROPAGATION_BENCHMARK(test::toy_metadata, default_chain, const_field_t,
+                              propagation_opt::e_cooperative)
+
+/// Macro declaring the CUDA graph instantiations for the different detectors
+#define DECLARE_PROPAGATION_GRAPH(METADATA, CHAIN, FIELD)                      \
+                                                                               \
+    template class cuda_propagation_graph<                                     \
+        cuda_propagator_type<METADATA, FIELD, CHAIN>>;                         \
+                                                                               \
+    template kernel_info                                                       \
+    get_kernel_info<cuda_propagator_type<METADATA, FIELD, CHAIN>,              \
+                    propagation_opt::e_graph>(const int);
+
+DECLARE_PROPAGATION_GRAPH(test::default_metadata, empty_chain, const_field_t)
+DECLARE_PROPAGATION_GRAPH(test::default_metadata, default_chain, const_field_t)
+
+DECLARE_PROPAGATION_GRAPH(test::toy_metadata, empty_chain, const_field_t)
+DECLARE_PROPAGATION_GRAPH(test::toy_metadata, default_chain, const_field_t)
+
 }  // namespace detray::benchmarks
@@ -21,6 +21,7 @@
 
 // Detray benchmark include(s)
 #include "detray/benchmarks/benchmark_base.hpp"
+#include "detray/benchmarks/device/propagator_types.hpp"
 #include "detray/benchmarks/propagation_benchmark_config.hpp"
 #include "detray/benchmarks/propagation_benchmark_utils.hpp"
 
@@ -36,30 +37,47 @@
 // System include(s)
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iostream>
+#include <memory>
 #include <random>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace detray::benchmarks {
 
-// Define propagator type
-template <concepts::algebra algebra_t>
-using empty_chain = actor_chain<>;
-
-template <concepts::algebra algebra_t>
-using default_chain = actor_chain<parameter_transporter<algebra_t>,
-                                  pointwise_material_interactor<algebra_t>,
-                                  parameter_resetter<algebra_t>>;
-
-using const_field_t = bfield::const_bknd_t<test::scalar>;
-
 template <typename metadata_t, typename bfield_t,
           template <typename> class actor_chain_t>
 using cuda_propagator_type =
-    propagator<rk_stepper<covfie::field_view<bfield_t>,
-                          typename detector<metadata_t>::algebra_type>,
-               navigator<detector<metadata_t>>,
-               actor_chain_t<typename detector<metadata_t>::algebra_type>>;
+    device_propagator_type<metadata_t, bfield_t, actor_chain_t>;
+
+/// Static properties of the propagation kernel for a launch configuration
+struct kernel_info {
+    /// Registers per thread
+    int n_registers{0};
+    /// Local memory per thread (register spills and stack) in bytes
+    std::size_t local_mem_bytes{0u};
+    /// Static shared memory per block in bytes
+    std::size_t shared_mem_bytes{0u};
+    /// Maximal block size the kernel can be launched with
+    int max_threads_per_block{0};
+    /// Number of resident blocks per multiprocessor for the block size
+    int active_blocks_per_sm{0};
+    /// Theoretical occupancy: resident warps over maximal warps per SM
+    double occupancy{0.};
+};
+
+/// @returns the memory in bytes that is in use on the current CUDA device
+/// (by all processes)
+std::size_t get_used_device_memory();
+
+/// @returns the properties of the propagation kernel that is launched for
+/// a block size of @param block_size
+template <typename propagator_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+kernel_info get_kernel_info(const int block_size);
 
 /// Launch the propagation kernelfor benchmarking
 ///
@@ -68,18 +86,22 @@ using cuda_propagator_type =
 /// @param field_data the magentic field view (maybe an empty field)
 /// @param tracks_data the track collection view
 /// @param navigation_cache_view the navigation cache vecemem view
+/// @param n_samples the number of tracks to propagate
+/// @param block_size the number of threads per block
 /// @param opt which propagation to run (sync vs. unsync)
+///
+/// @returns the kernel execution time in milliseconds
 template <typename propagator_t,
           detray::benchmarks::propagation_opt kOPT =
               detray::benchmarks::propagation_opt::e_unsync>
-void run_propagation_kernel(
+float run_propagation_kernel(
     const propagation::config &,
     typename propagator_t::detector_type::view_type,
     typename propagator_t::stepper_type::magnetic_field_type,
     typename propagator_t::actor_chain_type::state_tuple *,
     vecmem::data::vector_view<
         free_track_parameters<typename propagator_t::algebra_type>>,
-    const int);
+    const int, const int);
 
 /// Allocate actor state blueprint on device
 /// @note This only works if each actor state in the tuple is essentially POD
@@ -92,6 +114,63 @@ template <typename propagator_t>
 void release_actor_states(
     typename propagator_t::actor_chain_type::state_tuple *);
 
+/// Replays the upload of the tracks and the propagation kernel as a CUDA graph
+///
+/// The graph is captured once for a fixed track capacity, so that the launch
+/// overhead is paid only once for a sequence of (small) events. For every
+/// replay, the tracks of the event are staged in pinned host memory that is
+/// read by the captured copy. The number of tracks is uploaded with them and
+/// the kernel reads it from device memory, so that only the valid tracks are
+/// propagated without changing the graph.
+///
+/// @note The whole capacity is copied on every replay: The capacity should be
+/// chosen close to the typical event size.
+template <typename propagator_t>
+class cuda_propagation_graph {
+
+    public:
+    using algebra_type = typename propagator_t::algebra_type;
+    using track_type = free_track_parameters<algebra_type>;
+
+    /// Capture the graph
+    ///
+    /// @param cfg the propagation configuration
+    /// @param det_view the detector vecmem view
+    /// @param field_view the magentic field view
+    /// @param device_actor_state_ptr the actor state blueprint on device
+    /// @param capacity the maximal number of tracks per event
+    /// @param block_size the number of threads per block
+    cuda_propagation_graph(
+        const propagation::config &cfg,
+        typename propagator_t::detector_type::view_type det_view,
+        typename propagator_t::stepper_type::magnetic_field_type field_view,
+        typename propagator_t::actor_chain_type::state_tuple
+            *device_actor_state_ptr,
+        unsigned int capacity, int block_size = 256);
+
+    /// Release the graph and its buffers
+    ~cuda_propagation_graph();
+
+    /// Not copyable: The graph refers to the staging buffers of this instance
+    /// @{
+    cuda_propagation_graph(const cuda_propagation_graph &) = delete;
+    cuda_propagation_graph &operator=(const cuda_propagation_graph &) = delete;
+    /// @}
+
+    /// Propagate the tracks @param tracks by replaying the graph
+    ///
+    /// @returns the device execution time of the graph in milliseconds
+    float run(std::span<const track_type> tracks);
+
+    /// @returns the maximal number of tracks per event
+    unsigned int capacity() const;
+
+    private:
+    /// CUDA resources, only visible in the CUDA translation unit
+    struct impl;
+    std::unique_ptr<impl> m_impl;
+};
+
 /// Device Propagation becnhmark
 template <typename propagator_t, typename bfield_bknd_t,
           detray::benchmarks::propagation_opt kOPT =
@@ -137,13 +216,51 @@ struct cuda_propagation_bm : public benchmark_base {
 
         const int n_samples{m_cfg.benchmark().n_samples()};
         const int n_warmup{m_cfg.benchmark().n_warmup()};
+        const int block_size{m_cfg.block_size()};
 
         assert(static_cast<std::size_t>(n_samples) <= tracks->size());
 
+        // Check the launch configuration
+        const kernel_info k_info{
+            get_kernel_info<propagator_t, kOPT>(block_size)};
+        if (block_size <= 0 || block_size > k_info.max_threads_per_block) {
+            state.SkipWithError("Block size exceeds the kernel limit");
+            return;
+        }
+        if (kOPT == detray::benchmarks::propagation_opt::e_persistent &&
+            block_size % 32 != 0) {
+            state.SkipWithError("Block size must be a multiple of the warp "
+                                "size for persistent threads");
+            return;
+        }
+        if (kOPT == detray::benchmarks::propagation_opt::e_cooperative &&
+            block_size % 32 != 0) {
+            state.SkipWithError("Block size must be a multiple of the warp "
+                                "size for cooperative lane groups");
+            return;
+        }
+
         // Copy the track collection to device
         auto track_buffer =
             detray::get_buffer(vecmem::get_data(*tracks), *dev_mr, cuda_cpy);
 
+        // Time the host-device transfers of the track collection (the
+        // copies are synchronous)
+        constexpr int n_copies{10};
+        dvector<free_track_parameters<algebra_t>> host_tracks(*tracks);
+        double h2d_time{0.};
+        double d2h_time{0.};
+        for (int i = 0; i < n_copies; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            cuda_cpy(vecmem::get_data(*tracks), track_buffer)->wait();
+            auto mid = std::chrono::steady_clock::now();
+            cuda_cpy(track_buffer, host_tracks)->wait();
+            auto stop = std::chrono::steady_clock::now();
+
+            h2d_time += std::chrono::duration<double>(mid - start).count();
+            d2h_time += std::chrono::duration<double>(stop - mid).count();
+        }
+
         // Copy the detector to device and get its view
         auto det_buffer = detray::get_buffer(*det, *dev_mr, cuda_cpy);
         auto det_view = detray::get_data(det_buffer);
@@ -152,29 +269,100 @@ struct cuda_propagation_bm : public benchmark_base {
         auto *device_actor_state_ptr =
             setup_actor_states<propagator_t>(input_actor_states);
 
-        // Do a small warm up run
-        if (m_cfg.benchmark().do_warmup()) {
-            auto warmup_track_buffer = detray::get_buffer(
-                vecmem::get_data(*tracks), *dev_mr, cuda_cpy);
-
-            run_propagation_kernel<propagator_t, kOPT>(
-                m_cfg.propagation(), det_view, *bfield, device_actor_state_ptr,
-                warmup_track_buffer, math::min(n_warmup, n_samples));
+        // The graph includes the upload of the tracks on every replay
+        if constexpr (kOPT == detray::benchmarks::propagation_opt::e_graph) {
+            run_graph(state, *tracks, det_view, *bfield,
+                      device_actor_state_ptr, k_info);
         } else {
-            std::cout << "WARNING: Running CUDA benchmarks without warmup is "
-                         "not recommended"
-                      << std::endl;
+            // Do a small warm up run
+            if (m_cfg.benchmark().do_warmup()) {
+                auto warmup_track_buffer = detray::get_buffer(
+                    vecmem::get_data(*tracks), *dev_mr, cuda_cpy);
+
+                run_propagation_kernel<propagator_t, kOPT>(
+                    m_cfg.propagation(), det_view, *bfield,
+                    device_actor_state_ptr, warmup_track_buffer,
+                    math::min(n_warmup, n_samples), block_size);
+            } else {
+                std::cout << "WARNING: Running CUDA benchmarks without warmup "
+                             "is not recommended"
+                          << std::endl;
+            }
+
+            // Calculate the propagation rate
+            // @see
+            // https://github.com/google/benchmark/blob/main/docs/user_guide.md#custom-counters
+            std::size_t total_tracks = 0u;
+            double kernel_time{0.};
+            for (auto _ : state) {
+                // Launch the propagator test for GPU device
+                const float kernel_ms{
+                    run_propagation_kernel<propagator_t, kOPT>(
+                        m_cfg.propagation(), det_view, *bfield,
+                        device_actor_state_ptr, track_buffer, n_samples,
+                        block_size)};
+                kernel_time += 1e-3 * static_cast<double>(kernel_ms);
+
+                total_tracks += static_cast<std::size_t>(n_samples);
+            }
+
+            // Report throughput
+            state.counters["TracksPropagated"] =
+                benchmark::Counter(static_cast<double>(total_tracks),
+                                   benchmark::Counter::kIsRate);
+
+            // Kernel execution and transfer times in seconds
+            state.counters["KernelTime"] = benchmark::Counter(
+                kernel_time, benchmark::Counter::kAvgIterations);
+            state.counters["H2DCopyTime"] = h2d_time / n_copies;
+            state.counters["D2HCopyTime"] = d2h_time / n_copies;
+
+            // Launch configuration and kernel properties
+            state.counters["BlockSize"] = static_cast<double>(block_size);
+            state.counters["Registers"] =
+                static_cast<double>(k_info.n_registers);
+            state.counters["LocalMemBytes"] =
+                static_cast<double>(k_info.local_mem_bytes);
+            state.counters["SharedMemBytes"] =
+                static_cast<double>(k_info.shared_mem_bytes);
+            state.counters["ActiveBlocksPerSM"] =
+                static_cast<double>(k_info.active_blocks_per_sm);
+            state.counters["Occupancy"] = k_info.occupancy;
+        }
+
+        release_actor_states<propagator_t>(device_actor_state_ptr);
+    }
+
+    private:
+    /// Benchmark loop that replays a CUDA graph per iteration
+    inline void run_graph(
+        ::benchmark::State &state,
+        const dvector<free_track_parameters<algebra_t>> &tracks,
+        typename propagator_t::detector_type::view_type det_view,
+        typename propagator_t::stepper_type::magnetic_field_type field_view,
+        typename propagator_t::actor_chain_type::state_tuple
+            *device_actor_state_ptr,
+        const kernel_info &k_info) const {
+
+        const int n_samples{m_cfg.benchmark().n_samples()};
+        const int block_size{m_cfg.block_size()};
+
+        const std::span<const free_track_parameters<algebra_t>> event_tracks{
+            tracks.data(), static_cast<std::size_t>(n_samples)};
+
+        // Capture once: The launch overhead is not part of the benchmark
+        cuda_propagation_graph<propagator_t> graph{
+            m_cfg.propagation(), det_view, field_view, device_actor_state_ptr,
+            static_cast<unsigned int>(n_samples), block_size};
+
+        if (m_cfg.benchmark().do_warmup()) {
+            graph.run(event_tracks);
         }
 
-        // Calculate the propagation rate
-        // @see
-        // https://github.com/google/benchmark/blob/main/docs/user_guide.md#custom-counters
         std::size_t total_tracks = 0u;
+        double graph_time{0.};
         for (auto _ : state) {
-            // Launch the propagator test for GPU device
-            run_propagation_kernel<propagator_t, kOPT>(
-                m_cfg.propagation(), det_view, *bfield, device_actor_state_ptr,
-                track_buffer, n_samples);
+            graph_time += 1e-3 * static_cast<double>(graph.run(event_tracks));
 
             total_tracks += static_cast<std::size_t>(n_samples);
         }
@@ -183,8 +371,80 @@ struct cuda_propagation_bm : public benchmark_base {
         state.counters["TracksPropagated"] = benchmark::Counter(
             static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
 
-        release_actor_states<propagator_t>(device_actor_state_ptr);
+        // Device time of the graph (track upload and kernel) in seconds
+        state.counters["GraphTime"] = benchmark::Counter(
+            graph_time, benchmark::Counter::kAvgIterations);
+
+        // Launch configuration and kernel properties
+        state.counters["BlockSize"] = static_cast<double>(block_size);
+        state.counters["Registers"] = static_cast<double>(k_info.n_registers);
+        state.counters["Occupancy"] = k_info.occupancy;
     }
 };
 
+/// Register the CUDA propagation benchmark for every number of tracks in
+/// @param n_samples and every block size in @param block_sizes
+///
+/// @param name name for the benchmark
+/// @param bench_cfg basic benchmark configuration
+/// @param prop_cfg propagation configuration
+/// @param det the detector
+/// @param bfield the covfie field
+/// @param actor_states tuple that contains all actor states (same order as in
+///                     actor_chain_t)
+/// @param track_samples the pre-computed test tracks (one per sample size)
+/// @param n_samples the number of track to run
+/// @param dev_mr the device memory resource
+/// @param block_sizes the numbers of threads per block (only added to the
+///                    benchmark name, if more than one is given)
+template <typename propagator_t, typename detector_t, typename bfield_bknd_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+inline void register_block_size_sweep(
+    const std::string &name, benchmark_base::configuration &bench_cfg,
+    const propagation::config &prop_cfg, const detector_t &det,
+    bfield_bknd_t &bfield,
+    typename propagator_t::actor_chain_type::state_tuple *actor_states,
+    std::vector<
+        dvector<free_track_parameters<typename detector_t::algebra_type>>>
+        &track_samples,
+    const std::vector<int> &n_samples, vecmem::memory_resource *dev_mr,
+    const std::vector<int> &block_sizes) {
+
+    using propagation_benchmark_t =
+        cuda_propagation_bm<propagator_t, bfield_bknd_t, kOPT>;
+
+    assert(track_samples.size() == n_samples.size());
+
+    for (std::size_t i = 0u; i < n_samples.size(); ++i) {
+        for (const int block_size : block_sizes) {
+
+            bench_cfg.n_samples(n_samples[i]);
+
+            typename propagation_benchmark_t::configuration prop_bm_cfg{
+                bench_cfg};
+            prop_bm_cfg.propagation() = prop_cfg;
+            prop_bm_cfg.block_size(block_size);
+
+            // Configure the benchmark
+            propagation_benchmark_t prop_benchmark{prop_bm_cfg};
+
+            // Keep the '<#tracks>_TRACKS' suffix for the plotting scripts
+            std::string bench_name = prop_benchmark.config().name() + "_" +
+                                     name + "_";
+            if (block_sizes.size() > 1u) {
+                bench_name += std::to_string(block_size) + "_THREADS_";
+            }
+            bench_name += std::to_string(n_samples[i]) + "_TRACKS";
+
+            std::cout << bench_name << "\n" << bench_cfg;
+
+            ::benchmark::RegisterBenchmark(bench_name.c_str(), prop_benchmark,
+                                           dev_mr, &track_samples[i], &det,
+                                           &bfield, actor_states)
+                ->UseRealTime();
+        }
+    }
+}
+
 }  // namespace detray::benchmarks
@@ -0,0 +1,43 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actors.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/types.hpp"
+
+namespace detray::benchmarks {
+
+// Define propagator type
+template <concepts::algebra algebra_t>
+using empty_chain = actor_chain<>;
+
+template <concepts::algebra algebra_t>
+using default_chain = actor_chain<parameter_transporter<algebra_t>,
+                                  pointwise_material_interactor<algebra_t>,
+                                  parameter_resetter<algebra_t>>;
+
+using const_field_t = bfield::const_bknd_t<test::scalar>;
+
+/// Propagator type of the device benchmarks (the same for all backends)
+template <typename metadata_t, typename bfield_t,
+          template <typename> class actor_chain_t>
+using device_propagator_type =
+    propagator<rk_stepper<covfie::field_view<bfield_t>,
+                          typename detector<metadata_t>::algebra_type>,
+               navigator<detector<metadata_t>>,
+               actor_chain_t<typename detector<metadata_t>::algebra_type>>;
+
+}  // namespace detray::benchmarks
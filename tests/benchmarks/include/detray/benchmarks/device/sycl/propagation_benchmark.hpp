@@ -0,0 +1,291 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_base.hpp"
+#include "detray/benchmarks/device/propagator_types.hpp"
+#include "detray/benchmarks/propagation_benchmark_config.hpp"
+#include "detray/benchmarks/propagation_benchmark_utils.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/memory/sycl/device_memory_resource.hpp>
+#include <vecmem/utils/sycl/copy.hpp>
+#include <vecmem/utils/sycl/queue_wrapper.hpp>
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace detray::benchmarks {
+
+template <typename metadata_t, typename bfield_t,
+          template <typename> class actor_chain_t>
+using sycl_propagator_type =
+    device_propagator_type<metadata_t, bfield_t, actor_chain_t>;
+
+/// @returns the maximal work-group size of the device of @param queue
+int max_work_group_size(vecmem::sycl::queue_wrapper &queue);
+
+/// Launch the propagation kernel for benchmarking
+///
+/// @param queue the SYCL queue to run on
+/// @param cfg the propagation configuration
+/// @param det_view the detector vecmem view
+/// @param field_data the magentic field view (maybe an empty field)
+/// @param tracks_data the track collection view
+/// @param n_samples the number of tracks to propagate
+/// @param work_group_size the number of work-items per work-group
+///
+/// @returns the kernel execution time in milliseconds (including the
+/// submission of the kernel)
+template <typename propagator_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+float run_propagation_kernel(
+    vecmem::sycl::queue_wrapper &, const propagation::config &,
+    typename propagator_t::detector_type::view_type,
+    typename propagator_t::stepper_type::magnetic_field_type,
+    typename propagator_t::actor_chain_type::state_tuple *,
+    vecmem::data::vector_view<
+        free_track_parameters<typename propagator_t::algebra_type>>,
+    const int, const int);
+
+/// Allocate actor state blueprint on device
+/// @note This only works if each actor state in the tuple is essentially POD
+template <typename propagator_t>
+typename propagator_t::actor_chain_type::state_tuple *setup_actor_states(
+    vecmem::sycl::queue_wrapper &,
+    typename propagator_t::actor_chain_type::state_tuple *);
+
+/// Release actor state blueprint
+template <typename propagator_t>
+void release_actor_states(
+    vecmem::sycl::queue_wrapper &,
+    typename propagator_t::actor_chain_type::state_tuple *);
+
+/// SYCL device propagation benchmark
+template <typename propagator_t, typename bfield_bknd_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+struct sycl_propagation_bm : public benchmark_base {
+    /// Detector dependent types
+    using algebra_t = typename propagator_t::detector_type::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using vector3_t = dvector3D<algebra_t>;
+
+    /// Local configuration type
+    using configuration = propagation_benchmark_config;
+
+    /// The benchmark configuration
+    configuration m_cfg{};
+    /// The queue to run on (the queue of the device memory resource)
+    vecmem::sycl::queue_wrapper m_queue;
+
+    /// Construct from an externally provided configuration @param cfg and
+    /// the queue @param queue
+    sycl_propagation_bm(const configuration &cfg,
+                        const vecmem::sycl::queue_wrapper &queue)
+        : m_cfg{cfg}, m_queue{queue} {}
+
+    /// @return the benchmark configuration
+    configuration &config() { return m_cfg; }
+
+    /// Prepare data and run benchmark loop
+    inline void operator()(::benchmark::State &state,
+                           vecmem::memory_resource *dev_mr,
+                           dvector<free_track_parameters<algebra_t>> *tracks,
+                           const typename propagator_t::detector_type *det,
+                           const bfield_bknd_t *bfield,
+                           typename propagator_t::actor_chain_type::state_tuple
+                               *input_actor_states) const {
+
+        static_assert(kOPT == detray::benchmarks::propagation_opt::e_unsync ||
+                          kOPT == detray::benchmarks::propagation_opt::e_sync,
+                      "Propagation option not available in SYCL");
+
+        assert(dev_mr != nullptr);
+        assert(tracks != nullptr);
+        assert(det != nullptr);
+        assert(bfield != nullptr);
+        assert(input_actor_states != nullptr);
+
+        // The queue is not modified, but the vecmem interface is non-const
+        vecmem::sycl::queue_wrapper queue{m_queue};
+
+        // Helper object for performing memory copies (to SYCL devices)
+        vecmem::sycl::copy sycl_cpy{queue};
+
+        const int n_samples{m_cfg.benchmark().n_samples()};
+        const int n_warmup{m_cfg.benchmark().n_warmup()};
+        const int work_group_size{m_cfg.block_size()};
+
+        assert(static_cast<std::size_t>(n_samples) <= tracks->size());
+
+        // Check the launch configuration
+        if (work_group_size <= 0 ||
+            work_group_size > max_work_group_size(queue)) {
+            state.SkipWithError("Work-group size exceeds the device limit");
+            return;
+        }
+
+        // Copy the track collection to device
+        auto track_buffer =
+            detray::get_buffer(vecmem::get_data(*tracks), *dev_mr, sycl_cpy);
+
+        // Time the host-device transfers of the track collection (the
+        // copies are synchronous)
+        constexpr int n_copies{10};
+        dvector<free_track_parameters<algebra_t>> host_tracks(*tracks);
+        double h2d_time{0.};
+        double d2h_time{0.};
+        for (int i = 0; i < n_copies; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            sycl_cpy(vecmem::get_data(*tracks), track_buffer)->wait();
+            auto mid = std::chrono::steady_clock::now();
+            sycl_cpy(track_buffer, host_tracks)->wait();
+            auto stop = std::chrono::steady_clock::now();
+
+            h2d_time += std::chrono::duration<double>(mid - start).count();
+            d2h_time += std::chrono::duration<double>(stop - mid).count();
+        }
+
+        // Copy the detector to device and get its view
+        auto det_buffer = detray::get_buffer(*det, *dev_mr, sycl_cpy);
+        auto det_view = detray::get_data(det_buffer);
+
+        // Copy blueprint actor states to device
+        auto *device_actor_state_ptr =
+            setup_actor_states<propagator_t>(queue, input_actor_states);
+
+        // Do a small warm up run
+        if (m_cfg.benchmark().do_warmup()) {
+            auto warmup_track_buffer = detray::get_buffer(
+                vecmem::get_data(*tracks), *dev_mr, sycl_cpy);
+
+            run_propagation_kernel<propagator_t, kOPT>(
+                queue, m_cfg.propagation(), det_view, *bfield,
+                device_actor_state_ptr, warmup_track_buffer,
+                math::min(n_warmup, n_samples), work_group_size);
+        } else {
+            std::cout << "WARNING: Running SYCL benchmarks without warmup is "
+                         "not recommended"
+                      << std::endl;
+        }
+
+        // Calculate the propagation rate
+        std::size_t total_tracks = 0u;
+        double kernel_time{0.};
+        for (auto _ : state) {
+            // Launch the propagator test for the device
+            const float kernel_ms{run_propagation_kernel<propagator_t, kOPT>(
+                queue, m_cfg.propagation(), det_view, *bfield,
+                device_actor_state_ptr, track_buffer, n_samples,
+                work_group_size)};
+            kernel_time += 1e-3 * static_cast<double>(kernel_ms);
+
+            total_tracks += static_cast<std::size_t>(n_samples);
+        }
+
+        // Report throughput
+        state.counters["TracksPropagated"] = benchmark::Counter(
+            static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+
+        // Kernel execution and transfer times in seconds
+        state.counters["KernelTime"] = benchmark::Counter(
+            kernel_time, benchmark::Counter::kAvgIterations);
+        state.counters["H2DCopyTime"] = h2d_time / n_copies;
+        state.counters["D2HCopyTime"] = d2h_time / n_copies;
+
+        // Launch configuration
+        state.counters["BlockSize"] = static_cast<double>(work_group_size);
+
+        release_actor_states<propagator_t>(queue, device_actor_state_ptr);
+    }
+};
+
+/// Register the SYCL propagation benchmark for every number of tracks in
+/// @param n_samples and every work-group size in @param work_group_sizes
+///
+/// @param name name for the benchmark
+/// @param bench_cfg basic benchmark configuration
+/// @param prop_cfg propagation configuration
+/// @param det the detector
+/// @param bfield the covfie field
+/// @param actor_states tuple that contains all actor states (same order as in
+///                     actor_chain_t)
+/// @param track_samples the pre-computed test tracks (one per sample size)
+/// @param n_samples the number of track to run
+/// @param dev_mr the device memory resource
+/// @param queue the queue of the device memory resource
+/// @param work_group_sizes the numbers of work-items per work-group (only
+///                         added to the benchmark name, if more than one is
+///                         given)
+template <typename propagator_t, typename detector_t, typename bfield_bknd_t,
+          detray::benchmarks::propagation_opt kOPT =
+              detray::benchmarks::propagation_opt::e_unsync>
+inline void register_work_group_size_sweep(
+    const std::string &name, benchmark_base::configuration &bench_cfg,
+    const propagation::config &prop_cfg, const detector_t &det,
+    bfield_bknd_t &bfield,
+    typename propagator_t::actor_chain_type::state_tuple *actor_states,
+    std::vector<
+        dvector<free_track_parameters<typename detector_t::algebra_type>>>
+        &track_samples,
+    const std::vector<int> &n_samples, vecmem::memory_resource *dev_mr,
+    const vecmem::sycl::queue_wrapper &queue,
+    const std::vector<int> &work_group_sizes) {
+
+    using propagation_benchmark_t =
+        sycl_propagation_bm<propagator_t, bfield_bknd_t, kOPT>;
+
+    assert(track_samples.size() == n_samples.size());
+
+    for (std::size_t i = 0u; i < n_samples.size(); ++i) {
+        for (const int work_group_size : work_group_sizes) {
+
+            bench_cfg.n_samples(n_samples[i]);
+
+            typename propagation_benchmark_t::configuration prop_bm_cfg{
+                bench_cfg};
+            prop_bm_cfg.propagation() = prop_cfg;
+            prop_bm_cfg.block_size(work_group_size);
+
+            // Configure the benchmark
+            propagation_benchmark_t prop_benchmark{prop_bm_cfg, queue};
+
+            // Keep the '<#tracks>_TRACKS' suffix for the plotting scripts
+            std::string bench_name = prop_benchmark.config().name() + "_" +
+                                     name + "_";
+            if (work_group_sizes.size() > 1u) {
+                bench_name += std::to_string(work_group_size) + "_THREADS_";
+            }
+            bench_name += std::to_string(n_samples[i]) + "_TRACKS";
+
+            std::cout << bench_name << "\n" << bench_cfg;
+
+            ::benchmark::RegisterBenchmark(bench_name.c_str(), prop_benchmark,
+                                           dev_mr, &track_samples[i], &det,
+                                           &bfield, actor_states)
+                ->UseRealTime();
+        }
+    }
+}
+
+}  // namespace detray::benchmarks
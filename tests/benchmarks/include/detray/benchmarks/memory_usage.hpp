@@ -0,0 +1,97 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <sys/resource.h>
+
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace detray::benchmarks {
+
+namespace detail {
+
+/// @returns the value of the entry @param key in /proc/self/status in bytes,
+/// zero if it is not available
+inline std::size_t read_proc_status(const std::string_view key) {
+
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(key) && line.size() > key.size() &&
+            line[key.size()] == ':') {
+            // The values are given in kB
+            std::istringstream values(line.substr(key.size() + 1u));
+            std::size_t kb{0u};
+            values >> kb;
+            return 1024u * kb;
+        }
+    }
+
+    return 0u;
+}
+
+}  // namespace detail
+
+/// @returns the current resident set size (RSS) of the process in bytes
+inline std::size_t resident_memory() {
+    return detail::read_proc_status("VmRSS");
+}
+
+/// @returns the peak resident set size of the process in bytes (high water
+/// mark since the process start or the last @c reset_peak_resident_memory )
+inline std::size_t peak_resident_memory() {
+    if (const std::size_t hwm{detail::read_proc_status("VmHWM")}; hwm > 0u) {
+        return hwm;
+    }
+    // Fallback: Not resettable, given in kB on Linux
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0u;
+    }
+    return 1024u * static_cast<std::size_t>(usage.ru_maxrss);
+}
+
+/// Reset the peak resident set size to the current resident set size, so
+/// that the peak of a single benchmark case can be measured
+///
+/// @returns false if the peak could not be reset (not Linux)
+inline bool reset_peak_resident_memory() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    // "5" resets the peak RSS, @see man proc(5)
+    clear_refs << "5";
+    clear_refs.flush();
+
+    return clear_refs.good();
+}
+
+/// Add the memory counters of the host process to the benchmark @param state
+///
+/// @param peak the peak resident memory that was measured for the case
+/// @param increase the resident memory that the tested data holds
+inline void add_host_memory_counters(::benchmark::State &state,
+                                     const std::size_t peak,
+                                     const std::size_t increase) {
+    state.counters["PeakRSS"] =
+        ::benchmark::Counter(static_cast<double>(peak),
+                             ::benchmark::Counter::kDefaults,
+                             ::benchmark::Counter::OneK::kIs1024);
+    state.counters["RSSIncrease"] =
+        ::benchmark::Counter(static_cast<double>(increase),
+                             ::benchmark::Counter::kDefaults,
+                             ::benchmark::Counter::OneK::kIs1024);
+}
+
+}  // namespace detray::benchmarks
@@ -25,6 +25,8 @@ struct propagation_benchmark_config {
     benchmark_base::configuration m_benchmark{};
     /// Propagation configuration
     propagation::config m_propagation{};
+    /// Device only: Number of threads per block
+    int m_block_size{256};
 
     /// Default construciton
     propagation_benchmark_config() = default;
@@ -43,6 +45,7 @@ struct propagation_benchmark_config {
         return m_benchmark;
     }
     benchmark_base::configuration& benchmark() { return m_benchmark; }
+    int block_size() const { return m_block_size; }
     /// @}
 
     /// Setters
@@ -51,6 +54,10 @@ struct propagation_benchmark_config {
         m_name = n;
         return *this;
     }
+    propagation_benchmark_config& block_size(const int n) {
+        m_block_size = n;
+        return *this;
+    }
     /// @}
 };
 
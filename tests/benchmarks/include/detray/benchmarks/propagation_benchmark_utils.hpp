@@ -32,6 +32,16 @@ namespace detray::benchmarks {
 enum class propagation_opt {
     e_unsync = 0,
     e_sync = 1,
+    /// Device only: Persistent threads that pull tracks from a work queue and
+    /// run @c propagate_sync
+    e_persistent = 2,
+    /// Device only: Replay a CUDA graph of the track upload and the
+    /// propagation kernel (runs @c propagate)
+    e_graph = 3,
+    /// Device only: A group of lanes propagates every track and shares the
+    /// candidate intersection of the navigator initialization (runs
+    /// @c propagate)
+    e_cooperative = 4,
 };
 
 /// @returns the default track generation configuration for detray benchmarks
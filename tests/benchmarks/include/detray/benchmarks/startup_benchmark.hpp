@@ -0,0 +1,124 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/memory_usage.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace detray::benchmarks {
+
+/// @brief Benchmark of the time and host memory that is needed to set up
+/// the data for a propagation (e.g. reading the detector files).
+///
+/// Every iteration runs the setup function from scratch. The release of the
+/// data at the end of an iteration is not timed. Reports the peak resident
+/// memory during the setup and the resident memory that the data holds.
+/// If a device memory probe is given, the device memory that the data holds
+/// is reported as well.
+struct startup_bm {
+
+    /// Run the benchmark loop on the setup function @param setup, which
+    /// returns the data that was set up
+    ///
+    /// @param device_memory returns the used device memory in bytes (optional)
+    template <typename setup_t, typename device_memory_t = std::nullptr_t>
+    inline void operator()(
+        ::benchmark::State &state, const setup_t &setup,
+        const device_memory_t &device_memory = nullptr) const {
+
+        constexpr bool has_device{
+            !std::is_null_pointer_v<device_memory_t>};
+
+        std::size_t peak{0u};
+        std::size_t increase{0u};
+        std::size_t device_increase{0u};
+        std::size_t device_before{0u};
+
+        if (!reset_peak_resident_memory()) {
+            std::cout << "WARNING: Could not reset the peak RSS, the "
+                         "reported value is the peak of the process"
+                      << std::endl;
+        }
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            reset_peak_resident_memory();
+            const std::size_t rss_before{resident_memory()};
+            if constexpr (has_device) {
+                device_before = device_memory();
+            }
+            state.ResumeTiming();
+
+            auto data = setup();
+            ::benchmark::DoNotOptimize(data);
+
+            state.PauseTiming();
+            const std::size_t rss_after{resident_memory()};
+            if (rss_after > rss_before) {
+                increase = std::max(increase, rss_after - rss_before);
+            }
+            peak = std::max(peak, peak_resident_memory());
+            if constexpr (has_device) {
+                const std::size_t device_after{device_memory()};
+                if (device_after > device_before) {
+                    device_increase = std::max(device_increase,
+                                               device_after - device_before);
+                }
+            }
+            // Release the data before the timing is resumed
+            {
+                [[maybe_unused]] auto released = std::move(data);
+            }
+            state.ResumeTiming();
+        }
+
+        add_host_memory_counters(state, peak, increase);
+        if constexpr (has_device) {
+            state.counters["DeviceMemory"] =
+                ::benchmark::Counter(static_cast<double>(device_increase),
+                                     ::benchmark::Counter::kDefaults,
+                                     ::benchmark::Counter::OneK::kIs1024);
+        }
+    }
+};
+
+/// Register a startup benchmark case
+///
+/// @param name name for the benchmark
+/// @param setup the setup function to be benchmarked
+/// @param n_iterations number of times the setup is run (e.g. the number of
+///                     times the files are read)
+/// @param device_memory returns the used device memory in bytes (optional)
+template <typename setup_t, typename device_memory_t = std::nullptr_t>
+inline auto *register_startup_benchmark(
+    const std::string &name, setup_t setup, const int n_iterations = 5,
+    device_memory_t device_memory = nullptr) {
+    return ::benchmark::RegisterBenchmark(
+               name.c_str(),
+               [setup = std::move(setup),
+                device_memory = std::move(device_memory)](
+                   ::benchmark::State &state) {
+                   startup_bm{}(state, setup, device_memory);
+               })
+        ->Iterations(n_iterations)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime();
+}
+
+}  // namespace detray::benchmarks
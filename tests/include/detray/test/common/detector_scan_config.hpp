@@ -48,6 +48,9 @@ struct detector_scan_config : public test::fixture_base<>::configuration {
     trk_gen_config_t m_trk_gen_cfg{};
     /// Write intersection points for plotting
     bool m_write_inters{false};
+    /// Only rescan the traces that cross volumes, which changed since the
+    /// scan data files were written
+    bool m_incremental{false};
     /// Visualization style to be applied to the svgs
     detray::svgtools::styling::style m_style =
         detray::svgtools::styling::tableau_colorblind::style;
@@ -64,6 +67,7 @@ struct detector_scan_config : public test::fixture_base<>::configuration {
         return m_white_board;
     }
     bool write_intersections() const { return m_write_inters; }
+    bool incremental() const { return m_incremental; }
     trk_gen_config_t &track_generator() { return m_trk_gen_cfg; }
     const trk_gen_config_t &track_generator() const { return m_trk_gen_cfg; }
     const auto &svg_style() const { return m_style; }
@@ -109,6 +113,10 @@ struct detector_scan_config : public test::fixture_base<>::configuration {
         m_write_inters = do_write;
         return *this;
     }
+    detector_scan_config &incremental(const bool do_incremental) {
+        m_incremental = do_incremental;
+        return *this;
+    }
     /// @}
 };
 
@@ -24,9 +24,11 @@
 #include "detray/test/validation/detector_scanner.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace detray::test {
 
@@ -133,6 +135,7 @@ class detector_scan : public test::fixture_base<> {
                 std::cout << "WARNING: Skipped faulty trace no. " << j
                           << std::endl;
                 detector_scan_traces.erase(detector_scan_traces.begin() + i);
+                remove_rescanned_index(j);
             } else {
                 ++n_tracks;
             }
@@ -167,6 +170,14 @@ class detector_scan : public test::fixture_base<> {
 
         auto trk_state_generator = track_generator_t(m_cfg.track_generator());
         const std::size_t n_helices{trk_state_generator.size()};
+
+        // The scan data was provided externally (e.g. by a device scan)
+        if (m_cfg.whiteboard()->exists(m_cfg.name())) {
+            std::cout << "INFO: Using trace data from whiteboard..."
+                      << std::endl;
+            return n_helices;
+        }
+
         intersection_traces.reserve(n_helices);
 
         std::string momentum_str{""};
@@ -188,9 +199,15 @@ class detector_scan : public test::fixture_base<> {
         std::string intersection_file_name{m_cfg.intersection_file() + "_" +
                                            momentum_str + ".csv"};
 
+        const std::string hash_file_name{m_cfg.intersection_file() + "_" +
+                                         momentum_str + "_volume_hashes.csv"};
+
         const bool data_files_exist{io::file_exists(intersection_file_name) &&
                                     io::file_exists(track_param_file_name)};
 
+        // Indices of the traces that were rescanned in incremental mode
+        std::vector<std::size_t> rescanned{};
+
         if (data_files_exist) {
 
             std::cout << "INFO: Reading data from file..." << std::endl;
@@ -198,6 +215,11 @@ class detector_scan : public test::fixture_base<> {
             // Fill the intersection traces from file
             detector_scanner::read(intersection_file_name,
                                    track_param_file_name, intersection_traces);
+
+            if (m_cfg.incremental()) {
+                rescanned =
+                    rescan_changed_volumes(intersection_traces, hash_file_name);
+            }
         } else {
 
             std::cout << "INFO: Generating trace data..." << std::endl;
@@ -225,11 +247,16 @@ class detector_scan : public test::fixture_base<> {
         // Save the results
 
         // Csv output
-        if (!data_files_exist && m_cfg.write_intersections()) {
+        const bool data_changed{!data_files_exist || !rescanned.empty()};
+        if (data_changed && m_cfg.write_intersections()) {
             detector_scanner::write_tracks(track_param_file_name,
                                            intersection_traces);
             detector_scanner::write_intersections(intersection_file_name,
                                                   intersection_traces);
+            // State of the geometry the written traces belong to
+            detector_scanner::write_volume_hashes(
+                hash_file_name,
+                detector_scanner::volume_hashes(m_det, m_gctx));
 
             std::cout << "  ->Wrote  " << intersection_traces.size()
                       << " intersection traces to file" << std::endl;
@@ -241,9 +268,83 @@ class detector_scan : public test::fixture_base<> {
         // Move the data to the whiteboard
         m_cfg.whiteboard()->add(m_cfg.name(), std::move(intersection_traces));
 
+        // Let the navigation validation skip the unchanged traces
+        if (data_files_exist && m_cfg.incremental()) {
+            m_cfg.whiteboard()->add(m_cfg.name() + "_rescanned",
+                                    std::move(rescanned));
+        }
+
         return n_helices;
     }
 
+    /// Rescan the traces in @param intersection_traces that cross a volume,
+    /// which changed since the volume hashes in @param hash_file_name were
+    /// written. Without a hash file, all traces are rescanned.
+    ///
+    /// @returns the indices of the rescanned traces
+    std::vector<std::size_t> rescan_changed_volumes(
+        std::vector<intersection_trace_t> &intersection_traces,
+        const std::string &hash_file_name) {
+
+        std::vector<std::size_t> old_hashes{};
+        if (io::file_exists(hash_file_name)) {
+            old_hashes = detector_scanner::read_volume_hashes(hash_file_name);
+        }
+        const auto changed = detector_scanner::changed_volumes(
+            m_det, old_hashes, detector_scanner::volume_hashes(m_det, m_gctx));
+
+        std::vector<std::size_t> rescanned{};
+        for (std::size_t i = 0u; i < intersection_traces.size(); ++i) {
+
+            auto &trace = intersection_traces[i];
+            const bool crosses_changed{
+                std::ranges::any_of(trace, [&changed](const auto &record) {
+                    return changed.contains(record.vol_idx);
+                })};
+
+            if (!crosses_changed) {
+                continue;
+            }
+
+            // Repeat the scan with the initial track parameters of the trace
+            const auto &start = trace.front();
+            const scalar_t q{start.charge};
+            const auto &trk = start.track_param;
+
+            trajectory_type test_traj = get_parametrized_trajectory(trk);
+            const scalar p{q == 0.f ? 1.f * unit<scalar>::GeV : trk.p(q)};
+            trace = detector_scanner::run<scan_type>(
+                m_gctx, m_det, test_traj, m_cfg.mask_tolerance(), p);
+
+            rescanned.push_back(i);
+        }
+
+        std::cout << "  ->" << changed.size() << " of "
+                  << m_det.volumes().size() << " volumes changed: Rescanned "
+                  << rescanned.size() << " of " << intersection_traces.size()
+                  << " traces" << std::endl;
+
+        return rescanned;
+    }
+
+    /// Update the indices of the rescanned traces after trace @param j was
+    /// removed from the scan data
+    void remove_rescanned_index(const std::size_t j) {
+        const std::string rescanned_name{m_cfg.name() + "_rescanned"};
+        if (!m_cfg.whiteboard()->exists(rescanned_name)) {
+            return;
+        }
+
+        auto &rescanned =
+            m_cfg.whiteboard()->template get<std::vector<std::size_t>>(
+                rescanned_name);
+
+        std::erase(rescanned, j);
+        for (std::size_t &idx : rescanned) {
+            idx -= (idx > j) ? 1u : 0u;
+        }
+    }
+
     /// @returns either the helix or ray corresponding to the input track
     /// parameters @param track
     trajectory_type get_parametrized_trajectory(
@@ -23,9 +23,16 @@
 #include "detray/test/validation/material_validation_utils.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
 #include <ios>
 #include <iostream>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace detray::test {
 
@@ -51,6 +58,14 @@ class material_scan : public test::fixture_base<> {
         /// Save results for later use in downstream tests
         std::shared_ptr<test::whiteboard> m_white_board;
         trk_gen_config_t m_trk_gen_cfg{};
+        /// Number of threads the rays are distributed over
+        std::size_t m_n_threads{1u};
+        /// Number of consecutive rays whose mapping hits are summed together
+        std::size_t m_chunk_size{256u};
+        /// Number of jobs the ray chunks are distributed over
+        std::size_t m_n_jobs{1u};
+        /// Index of this job (only the chunks of this job are scanned)
+        std::size_t m_job_index{0u};
 
         /// Getters
         /// @{
@@ -63,6 +78,10 @@ class material_scan : public test::fixture_base<> {
         std::shared_ptr<test::whiteboard> whiteboard() const {
             return m_white_board;
         }
+        std::size_t n_threads() const { return m_n_threads; }
+        std::size_t chunk_size() const { return m_chunk_size; }
+        std::size_t n_jobs() const { return m_n_jobs; }
+        std::size_t job_index() const { return m_job_index; }
         /// @}
 
         /// Setters
@@ -79,6 +98,23 @@ class material_scan : public test::fixture_base<> {
             m_white_board = std::move(w_board);
             return *this;
         }
+        config &n_threads(const std::size_t n) {
+            m_n_threads = n;
+            return *this;
+        }
+        config &chunk_size(const std::size_t n) {
+            m_chunk_size = n;
+            return *this;
+        }
+        config &job(const std::size_t idx, const std::size_t n) {
+            if (idx >= n) {
+                throw std::invalid_argument(
+                    "Material scan: Job index out of range");
+            }
+            m_job_index = idx;
+            m_n_jobs = n;
+            return *this;
+        }
         /// @}
     };
 
@@ -98,120 +134,130 @@ class material_scan : public test::fixture_base<> {
     void TestBody() override {
 
         using material_record_t = material_validator::material_record<scalar_t>;
-
-        std::size_t n_tracks{0u};
-        auto ray_generator = track_generator_t(m_cfg.track_generator());
+        using accumulator_t =
+            material_validator::material_map_accumulator<scalar_t>;
+
+        const std::size_t n_rays{
+            track_generator_t(m_cfg.track_generator()).size()};
+        const std::size_t n_threads{
+            std::max(std::size_t{1u}, m_cfg.n_threads())};
+        const std::size_t chunk_size{
+            std::max(std::size_t{1u}, m_cfg.chunk_size())};
+        const std::size_t n_chunks{(n_rays + chunk_size - 1u) / chunk_size};
+        const std::size_t n_jobs{std::max(std::size_t{1u}, m_cfg.n_jobs())};
+        const std::size_t job_index{m_cfg.job_index()};
 
         std::cout << "INFO: Running material scan on: " << m_det.name(m_names)
-                  << "\n(" << ray_generator.size() << " rays) ...\n"
+                  << "\n(" << n_rays << " rays, " << n_threads
+                  << " thread(s), job " << job_index + 1u << "/" << n_jobs
+                  << ") ...\n"
                   << std::endl;
 
-        // Trace material per ray
-        dvector<free_track_parameters<algebra_t>> tracks{};
-        tracks.reserve(ray_generator.size());
-
-        dvector<material_record_t> mat_records{};
-        mat_records.reserve(ray_generator.size());
-
-        for (const auto ray : ray_generator) {
-
-            // Record all intersections and surfaces along the ray
-            const auto intersection_record =
-                detector_scanner::run<detray::ray_scan>(m_gctx, m_det, ray);
-
-            if (intersection_record.empty()) {
-                std::cout << "ERROR: Intersection trace empty for ray "
-                          << n_tracks << "/" << ray_generator.size() << ": "
-                          << ray << std::endl;
-                break;
-            }
-
-            // Record track parameters
-            tracks.push_back({ray.pos(), 0.f, ray.dir(), 0.f});
-
-            // New material record
-            material_record_t mat_record{};
-            mat_record.eta = vector::eta(ray.dir());
-            mat_record.phi = vector::phi(ray.dir());
+        // Results per ray, so that the order does not depend on the threads
+        dvector<free_track_parameters<algebra_t>> tracks(n_rays);
+        dvector<material_record_t> mat_records(n_rays);
+        std::vector<char> is_valid(n_rays, false);
 
-            // Record material for this ray
-            for (const auto &[i, record] :
-                 detray::views::enumerate(intersection_record)) {
-
-                // Check whether this record has a successor
-                if (i < intersection_record.size() - 1) {
-
-                    const auto &current_intr = record.intersection;
-                    const auto &next_intr =
-                        intersection_record[i + 1].intersection;
-
-                    const bool is_same_intrs{next_intr == current_intr};
-                    const bool current_is_pt{current_intr.sf_desc.is_portal()};
-                    const bool next_is_pt{next_intr.sf_desc.is_portal()};
+        // The generator is not shared between the threads
+        std::vector<ray_t> rays{};
+        rays.reserve(n_rays);
+        for (const auto ray : track_generator_t(m_cfg.track_generator())) {
+            rays.push_back(ray);
+        }
 
-                    const bool is_dummy_record{i == 0};
+        // Chunks of other jobs are skipped
+        std::vector<std::size_t> job_chunks{};
+        for (std::size_t c = job_index; c < n_chunks; c += n_jobs) {
+            job_chunks.push_back(c);
+        }
 
-                    // Prevent double counting of material on adjacent portals
-                    // (the navigator automatically skips the exit portal)
-                    if ((is_same_intrs && next_is_pt && current_is_pt) ||
-                        is_dummy_record) {
-                        continue;
+        // The mapping hits are accumulated per chunk of consecutive rays and
+        // the chunks are merged in order, so that the floating point sums do
+        // not depend on the number of threads. A chunk is merged as soon as
+        // all chunks before it are merged. No chunk is started further ahead
+        // of the merge than there are slots for partial results.
+        const std::size_t n_slots{2u * n_threads};
+        std::vector<accumulator_t> slots(n_slots);
+        std::vector<char> is_done(n_slots, false);
+        accumulator_t mat_mapping{};
+
+        std::mutex merge_mutex{};
+        std::condition_variable merge_cv{};
+        std::size_t next_claim{0u};
+        std::size_t next_merge{0u};
+
+        auto scan_chunks = [&]() {
+            while (true) {
+                std::size_t k{0u};
+                {
+                    std::unique_lock lock(merge_mutex);
+                    merge_cv.wait(lock, [&]() {
+                        return next_claim >= job_chunks.size() ||
+                               next_claim < next_merge + n_slots;
+                    });
+                    if (next_claim >= job_chunks.size()) {
+                        return;
                     }
+                    k = next_claim++;
                 }
 
-                // Don't count the last portal, because navigation terminates
-                // before the material is counted
-                if (detail::is_invalid_value(record.intersection.volume_link)) {
-                    continue;
-                }
-
-                const auto sf =
-                    geometry::surface{m_det, record.intersection.sf_desc};
-
-                if (!sf.has_material()) {
-                    continue;
+                accumulator_t acc{};
+                const std::size_t first{job_chunks[k] * chunk_size};
+                const std::size_t last{std::min(first + chunk_size, n_rays)};
+                for (std::size_t i = first; i < last; ++i) {
+                    const ray_t &ray = rays[i];
+                    is_valid[i] =
+                        scan_ray(ray, i, n_rays, mat_records[i], acc);
+                    tracks[i] = {ray.pos(), 0.f, ray.dir(), 0.f};
                 }
 
-                const auto &p = record.intersection.local;
-                const auto mat_params = sf.template visit_material<
-                    material_validator::get_material_params>(
-                    point2_t{p[0], p[1]}, cos_angle(m_gctx, sf, ray.dir(), p));
-
-                const scalar_t seg{mat_params.path};
-                const scalar_t t{mat_params.thickness};
-                const scalar_t mx0{mat_params.mat_X0};
-                const scalar_t ml0{mat_params.mat_L0};
-
-                if (mx0 > 0.f) {
-                    mat_record.sX0 += seg / mx0;
-                    mat_record.tX0 += t / mx0;
-                } else {
-                    std::cout << "WARNING: Encountered invalid X_0: " << mx0
-                              << "\nOn surface: " << sf << std::endl;
-                }
-                if (ml0 > 0.f) {
-                    mat_record.sL0 += seg / ml0;
-                    mat_record.tL0 += t / ml0;
-                } else {
-                    std::cout << "WARNING: Encountered invalid L_0: " << ml0
-                              << "\nOn surface: " << sf << std::endl;
+                {
+                    const std::scoped_lock lock(merge_mutex);
+                    slots[k % n_slots] = std::move(acc);
+                    is_done[k % n_slots] = true;
+
+                    while (next_merge < job_chunks.size() &&
+                           is_done[next_merge % n_slots]) {
+                        accumulator_t &slot = slots[next_merge % n_slots];
+                        mat_mapping.merge(slot);
+                        slot = accumulator_t{};
+                        is_done[next_merge % n_slots] = false;
+                        ++next_merge;
+                    }
                 }
+                merge_cv.notify_all();
             }
-
-            if (mat_record.sX0 == 0.f || mat_record.sL0 == 0.f ||
-                mat_record.tX0 == 0.f || mat_record.tL0 == 0.f) {
-                std::cout << "WARNING: No material recorded for ray "
-                          << n_tracks << "/" << ray_generator.size() << ": "
-                          << ray << std::endl;
+        };
+
+        if (n_threads == 1u) {
+            scan_chunks();
+        } else {
+            std::vector<std::thread> workers;
+            workers.reserve(n_threads);
+            for (std::size_t t = 0u; t < n_threads; ++t) {
+                workers.emplace_back(scan_chunks);
             }
+            for (auto &w : workers) {
+                w.join();
+            }
+        }
+        assert(next_merge == job_chunks.size());
 
-            mat_records.push_back(mat_record);
-
-            ++n_tracks;
+        std::size_t n_tracks{0u};
+        for (std::size_t i = 0u; i < n_rays; ++i) {
+            if (is_valid[i]) {
+                tracks[n_tracks] = tracks[i];
+                mat_records[n_tracks] = mat_records[i];
+                ++n_tracks;
+            }
         }
+        tracks.resize(n_tracks);
+        mat_records.resize(n_tracks);
 
         std::cout << "-----------------------------------\n"
                   << "Tested " << n_tracks << " tracks\n"
+                  << "Material hits: " << mat_mapping.n_hits() << " in "
+                  << mat_mapping.size() << " bins\n"
                   << "-----------------------------------\n"
                   << std::endl;
 
@@ -219,13 +265,138 @@ class material_scan : public test::fixture_base<> {
         std::string coll_name{m_det.name(m_names) + "_material_scan"};
         material_validator::write_material(coll_name + ".csv", mat_records);
 
+        // Write the partial mapping result of this job, which can be merged
+        // with the results of the other jobs
+        std::string mapping_name{m_det.name(m_names) + "_material_mapping"};
+        if (n_jobs > 1u) {
+            mapping_name += "_job" + std::to_string(job_index);
+        }
+        material_validator::write_material_mapping(mapping_name + ".csv",
+                                                   mat_mapping);
+
         // Pin data to whiteboard
         m_cfg.whiteboard()->add(coll_name, std::move(mat_records));
         m_cfg.whiteboard()->add(m_det.name(m_names) + "_material_scan_tracks",
                                 std::move(tracks));
+        m_cfg.whiteboard()->add(m_det.name(m_names) + "_material_mapping",
+                                std::move(mat_mapping));
     }
 
     private:
+    /// Record the material along a single ray
+    ///
+    /// @param ray the ray to be scanned
+    /// @param i the index of the ray (for messages)
+    /// @param n_rays the total number of rays (for messages)
+    /// @param mat_record the accumulated material of the ray
+    /// @param mapping accumulates the material hits per surface bin
+    ///
+    /// @returns false if the ray did not intersect anything
+    template <typename accumulator_t>
+    bool scan_ray(const ray_t &ray, const std::size_t i,
+                  const std::size_t n_rays,
+                  material_validator::material_record<scalar_t> &mat_record,
+                  accumulator_t &mapping) const {
+
+        // Record all intersections and surfaces along the ray
+        const auto intersection_record =
+            detector_scanner::run<detray::ray_scan>(m_gctx, m_det, ray);
+
+        if (intersection_record.empty()) {
+            const std::scoped_lock lock(m_out_mutex);
+            std::cout << "ERROR: Intersection trace empty for ray " << i << "/"
+                      << n_rays << ": " << ray << std::endl;
+            return false;
+        }
+
+        mat_record.eta = vector::eta(ray.dir());
+        mat_record.phi = vector::phi(ray.dir());
+
+        // Record material for this ray
+        for (const auto &[j, record] :
+             detray::views::enumerate(intersection_record)) {
+
+            // Check whether this record has a successor
+            if (j < intersection_record.size() - 1) {
+
+                const auto &current_intr = record.intersection;
+                const auto &next_intr = intersection_record[j + 1].intersection;
+
+                const bool is_same_intrs{next_intr == current_intr};
+                const bool current_is_pt{current_intr.sf_desc.is_portal()};
+                const bool next_is_pt{next_intr.sf_desc.is_portal()};
+
+                const bool is_dummy_record{j == 0};
+
+                // Prevent double counting of material on adjacent portals
+                // (the navigator automatically skips the exit portal)
+                if ((is_same_intrs && next_is_pt && current_is_pt) ||
+                    is_dummy_record) {
+                    continue;
+                }
+            }
+
+            // Don't count the last portal, because navigation terminates
+            // before the material is counted
+            if (detail::is_invalid_value(record.intersection.volume_link)) {
+                continue;
+            }
+
+            const auto sf =
+                geometry::surface{m_det, record.intersection.sf_desc};
+
+            if (!sf.has_material()) {
+                continue;
+            }
+
+            const auto &p = record.intersection.local;
+            const point2_t loc{p[0], p[1]};
+            const auto mat_params =
+                sf.template visit_material<
+                    material_validator::get_material_params>(
+                    loc, cos_angle(m_gctx, sf, ray.dir(), p));
+
+            const scalar_t seg{mat_params.path};
+            const scalar_t t{mat_params.thickness};
+            const scalar_t mx0{mat_params.mat_X0};
+            const scalar_t ml0{mat_params.mat_L0};
+
+            if (mx0 > 0.f) {
+                mat_record.sX0 += seg / mx0;
+                mat_record.tX0 += t / mx0;
+            } else {
+                const std::scoped_lock lock(m_out_mutex);
+                std::cout << "WARNING: Encountered invalid X_0: " << mx0
+                          << "\nOn surface: " << sf << std::endl;
+            }
+            if (ml0 > 0.f) {
+                mat_record.sL0 += seg / ml0;
+                mat_record.tL0 += t / ml0;
+            } else {
+                const std::scoped_lock lock(m_out_mutex);
+                std::cout << "WARNING: Encountered invalid L_0: " << ml0
+                          << "\nOn surface: " << sf << std::endl;
+            }
+
+            if (mx0 > 0.f && ml0 > 0.f && t > 0.f) {
+                mapping.add(
+                    sf.index(),
+                    sf.template visit_material<
+                        material_validator::get_material_bin>(loc),
+                    mat_params);
+            }
+        }
+
+        if (mat_record.sX0 == 0.f || mat_record.sL0 == 0.f ||
+            mat_record.tX0 == 0.f || mat_record.tL0 == 0.f) {
+            const std::scoped_lock lock(m_out_mutex);
+            std::cout << "WARNING: No material recorded for ray " << i << "/"
+                      << n_rays << ": " << ray << std::endl;
+        }
+
+        return true;
+    }
+
     /// The configuration of this test
     config m_cfg;
     /// The geometry context to scan
@@ -234,6 +405,8 @@ class material_scan : public test::fixture_base<> {
     const detector_t &m_det;
     /// Volume names
     const typename detector_t::name_map &m_names;
+    /// Serialize the messages of the scan threads
+    mutable std::mutex m_out_mutex{};
 };
 
 }  // namespace detray::test
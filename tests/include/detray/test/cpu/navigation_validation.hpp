@@ -24,6 +24,8 @@
 // System include(s)
 #include <iostream>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace detray::test {
 
@@ -116,6 +118,24 @@ class navigation_validation : public test::fixture_base<> {
                 truth_data_name);
         ASSERT_EQ(m_cfg.n_tracks(), truth_traces.size());
 
+        // In incremental mode, only the rescanned traces need to be checked:
+        // The other traces do not cross any volume that changed since the
+        // last validation
+        const std::string rescanned_name{truth_data_name + "_rescanned"};
+        const bool is_incremental{m_cfg.whiteboard()->exists(rescanned_name)};
+        std::unordered_set<std::size_t> rescanned{};
+        if (is_incremental) {
+            const auto &indices =
+                m_cfg.whiteboard()->template get<std::vector<std::size_t>>(
+                    rescanned_name);
+            rescanned.insert(indices.begin(), indices.end());
+
+            std::cout << "INFO: Skipping "
+                      << truth_traces.size() - rescanned.size()
+                      << " traces that are unaffected by the detector changes"
+                      << std::endl;
+        }
+
         std::cout << "\nINFO: Running navigation validation on: " << det_name
                   << "...\n"
                   << std::endl;
@@ -135,11 +155,17 @@ class navigation_validation : public test::fixture_base<> {
 
         scalar_t min_pT{std::numeric_limits<scalar_t>::max()};
         scalar_t max_pT{-std::numeric_limits<scalar_t>::max()};
-        for (auto &truth_trace : truth_traces) {
+        for (std::size_t trk_idx = 0u; trk_idx < truth_traces.size();
+             ++trk_idx) {
 
             if (n_tracks >= m_cfg.n_tracks()) {
                 break;
             }
+            if (is_incremental && !rescanned.contains(trk_idx)) {
+                continue;
+            }
+
+            auto &truth_trace = truth_traces[trk_idx];
 
             // Follow the test trajectory with a track and check, if we find
             // the same volumes and distances along the way
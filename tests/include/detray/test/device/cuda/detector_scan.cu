@@ -0,0 +1,224 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include "detector_scan.hpp"
+#include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/intersector.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+namespace detray::cuda {
+
+namespace {
+
+/// Intersections of a single surface (at most two per surface)
+template <typename intersection_t>
+struct surface_candidates {
+
+    using value_type = intersection_t;
+
+    static constexpr unsigned int capacity{4u};
+
+    DETRAY_HOST_DEVICE intersection_t *begin() { return m_data; }
+    DETRAY_HOST_DEVICE intersection_t *end() { return m_data + m_size; }
+
+    DETRAY_HOST_DEVICE void clear() { m_size = 0u; }
+
+    /// Insert @param sfi before @param pos (drops the last intersection
+    /// if the container is full)
+    DETRAY_HOST_DEVICE void insert(intersection_t *pos,
+                                   const intersection_t &sfi) {
+        if (m_size == capacity) {
+            return;
+        }
+        for (intersection_t *itr = end(); itr != pos; --itr) {
+            *itr = *(itr - 1);
+        }
+        *pos = sfi;
+        ++m_size;
+    }
+
+    intersection_t m_data[capacity];
+    unsigned int m_size{0u};
+};
+
+}  // anonymous namespace
+
+template <typename detector_t, typename trajectory_t>
+__global__ void detector_scan_kernel(
+    typename detector_t::view_type det_data,
+    vecmem::data::vector_view<const trajectory_t> traj_view,
+    vecmem::data::vector_view<const typename detector_t::scalar_type>
+        momenta_view,
+    const darray<typename detector_t::scalar_type, 2> mask_tolerance,
+    vecmem::data::jagged_vector_view<intersection_record<detector_t>>
+        traces_view,
+    vecmem::data::vector_view<unsigned int> overflow_view) {
+
+    using detector_device_t =
+        detector<typename detector_t::metadata, device_container_types>;
+    using algebra_t = typename detector_device_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using sf_desc_t = typename detector_device_t::surface_type;
+    using nav_link_t = typename sf_desc_t::navigation_link;
+
+    using record_t = intersection_record<detector_t>;
+    using intersection_t = typename record_t::intersection_type;
+    using intersection_kernel_t = intersection_initialize<intersector>;
+
+    static_assert(std::is_same_v<typename detector_t::view_type,
+                                 typename detector_device_t::view_type>,
+                  "Host and device detector view types do not match");
+
+    detector_device_t det(det_data);
+
+    vecmem::device_vector<const trajectory_t> trajectories(traj_view);
+    vecmem::device_vector<const scalar_t> momenta(momenta_view);
+    vecmem::jagged_device_vector<record_t> traces(traces_view);
+    vecmem::device_vector<unsigned int> overflow(overflow_view);
+
+    int trk_id = threadIdx.x + blockIdx.x * blockDim.x;
+    if (trk_id >= trajectories.size()) {
+        return;
+    }
+
+    const auto &traj = trajectories[trk_id];
+    const scalar_t p{momenta[trk_id]};
+    const scalar_t q{p * traj.qop()};
+
+    auto trace = traces.at(trk_id);
+    const auto &trf_store = det.transform_store();
+    typename detector_device_t::geometry_context ctx{};
+
+    // Placeholder for the initial track position
+    trace.push_back(record_t{});
+
+    // Loop over all surfaces in the detector
+    surface_candidates<intersection_t> intersections{};
+    for (const sf_desc_t &sf_desc : det.surfaces()) {
+        const auto sf = geometry::surface{det, sf_desc};
+
+        intersections.clear();
+        sf.template visit_mask<intersection_kernel_t>(
+            intersections, traj, sf_desc, trf_store, ctx,
+            sf.is_portal() ? darray<scalar_t, 2>{0.f, 0.f} : mask_tolerance);
+
+        // Candidate is invalid if it lies in the opposite direction
+        for (auto &sfi : intersections) {
+            if (!sfi.direction) {
+                continue;
+            }
+            if (trace.size() == trace.capacity()) {
+                overflow[trk_id] = 1u;
+                return;
+            }
+            sfi.sf_desc = sf_desc;
+            trace.push_back(
+                {q,
+                 {traj.pos(sfi.path), 0.f, p * traj.dir(sfi.path), q},
+                 sf.volume(),
+                 sfi});
+        }
+    }
+
+    // Need to have at least an exit portal
+    if (trace.size() == 1u) {
+        trace.clear();
+        return;
+    }
+
+    // Sort by distance to the origin of the trajectory (stable, like on host)
+    for (unsigned int i = 2u; i < trace.size(); ++i) {
+        const record_t rec = trace[i];
+        unsigned int j{i};
+        while (j > 1u && rec.intersection < trace[j - 1u].intersection) {
+            trace[j] = trace[j - 1u];
+            --j;
+        }
+        trace[j] = rec;
+    }
+
+    // Make sure the intersection record terminates at world portals
+    for (unsigned int i = 1u; i < trace.size(); ++i) {
+        if (detail::is_invalid_value(trace[i].intersection.volume_link)) {
+            trace.resize(i + 1u);
+            break;
+        }
+    }
+
+    // Save initial track position as dummy intersection record
+    const auto &first_record = trace[1u];
+    intersection_t start_intersection{};
+    start_intersection.sf_desc = first_record.intersection.sf_desc;
+    start_intersection.sf_desc.set_id(surface_id::e_passive);
+    start_intersection.sf_desc.set_index(dindex_invalid);
+    start_intersection.sf_desc.material().set_id(
+        detector_device_t::materials::id::e_none);
+    start_intersection.path = 0.f;
+    start_intersection.local = {0.f, 0.f, 0.f};
+    start_intersection.volume_link =
+        static_cast<nav_link_t>(first_record.vol_idx);
+
+    trace[0u] = record_t{q,
+                         {traj.pos(), 0.f, p * traj.dir(), q},
+                         first_record.vol_idx,
+                         start_intersection};
+}
+
+/// Launch the device kernel
+template <typename detector_t, typename trajectory_t>
+void detector_scan_device(
+    typename detector_t::view_type det_view,
+    vecmem::data::vector_view<const trajectory_t> traj_view,
+    vecmem::data::vector_view<const typename detector_t::scalar_type>
+        momenta_view,
+    const darray<typename detector_t::scalar_type, 2> mask_tolerance,
+    vecmem::data::jagged_vector_view<intersection_record<detector_t>>
+        traces_view,
+    vecmem::data::vector_view<unsigned int> overflow_view) {
+
+    constexpr int thread_dim = 2 * WARP_SIZE;
+    int block_dim = traj_view.size() / thread_dim + 1;
+
+    // run the test kernel
+    detector_scan_kernel<detector_t, trajectory_t>
+        <<<block_dim, thread_dim>>>(det_view, traj_view, momenta_view,
+                                    mask_tolerance, traces_view,
+                                    overflow_view);
+
+    // cuda error check
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+}
+
+/// Macro declaring the template instantiations for the different detector types
+#define DECLARE_DETECTOR_SCAN(METADATA, TRAJECTORY)                            \
+                                                                               \
+    template void detector_scan_device<detector<METADATA>, TRAJECTORY>(        \
+        typename detector<METADATA>::view_type,                                \
+        vecmem::data::vector_view<const TRAJECTORY>,                           \
+        vecmem::data::vector_view<                                             \
+            const typename detector<METADATA>::scalar_type>,                   \
+        const darray<typename detector<METADATA>::scalar_type, 2>,             \
+        vecmem::data::jagged_vector_view<                                      \
+            intersection_record<detector<METADATA>>>,                          \
+        vecmem::data::vector_view<unsigned int>);
+
+DECLARE_DETECTOR_SCAN(test::default_metadata, detail::ray<test::algebra>)
+DECLARE_DETECTOR_SCAN(test::default_metadata, detail::helix<test::algebra>)
+DECLARE_DETECTOR_SCAN(test::toy_metadata, detail::ray<test::algebra>)
+DECLARE_DETECTOR_SCAN(test::toy_metadata, detail::helix<test::algebra>)
+DECLARE_DETECTOR_SCAN(test::default_telescope_metadata,
+                      detail::ray<test::algebra>)
+DECLARE_DETECTOR_SCAN(test::default_telescope_metadata,
+                      detail::helix<test::algebra>)
+
+}  // namespace detray::cuda
@@ -0,0 +1,203 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/tracks/trajectories.hpp"
+
+// Detray test include(s)
+#include "detray/test/common/detector_scan_config.hpp"
+#include "detray/test/validation/detector_scanner.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/jagged_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
+
+// System include
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace detray::cuda {
+
+/// Launch the detector scan kernel
+///
+/// @param[in] det_view the detector vecmem view
+/// @param[in] traj_view the test trajectories
+/// @param[in] momenta_view the momentum per test trajectory
+/// @param[in] mask_tolerance the mask tolerance for non-portal surfaces
+/// @param[out] traces_view the intersection trace of every trajectory
+/// @param[out] overflow_view set to one if a trace exceeded its capacity
+template <typename detector_t, typename trajectory_t>
+void detector_scan_device(
+    typename detector_t::view_type det_view,
+    vecmem::data::vector_view<const trajectory_t> traj_view,
+    vecmem::data::vector_view<const typename detector_t::scalar_type>
+        momenta_view,
+    const darray<typename detector_t::scalar_type, 2> mask_tolerance,
+    vecmem::data::jagged_vector_view<intersection_record<detector_t>>
+        traces_view,
+    vecmem::data::vector_view<unsigned int> overflow_view);
+
+/// Run the ray/helix scan on device
+///
+/// Every device thread intersects one trajectory with all surfaces of the
+/// detector and sorts the resulting trace. The traces are the same as the
+/// ones produced by @c detector_scanner::run on host.
+struct run_detector_scan {
+
+    static constexpr std::string_view name = "cuda";
+
+    /// @param host_mr host memory resource for the result
+    /// @param dev_mr device memory resource
+    /// @param det the detector to be scanned
+    /// @param trajectories the test trajectories
+    /// @param momenta the momentum per test trajectory
+    /// @param mask_tolerance the mask tolerance for non-portal surfaces
+    /// @param capacity the maximal number of records per trace
+    ///
+    /// @throws std::runtime_error if a trace exceeded the capacity
+    ///
+    /// @returns the intersection traces of all trajectories
+    template <typename detector_t, typename trajectory_t>
+    auto operator()(
+        vecmem::memory_resource *host_mr, vecmem::memory_resource *dev_mr,
+        const detector_t &det, const vecmem::vector<trajectory_t> &trajectories,
+        const vecmem::vector<typename detector_t::scalar_type> &momenta,
+        const darray<typename detector_t::scalar_type, 2> mask_tolerance,
+        const std::size_t capacity) const {
+
+        using scalar_t = typename detector_t::scalar_type;
+        using record_t = intersection_record<detector_t>;
+
+        assert(trajectories.size() == momenta.size());
+
+        // Helper object for performing memory copies (to CUDA devices)
+        vecmem::cuda::copy cuda_cpy;
+
+        // Copy the detector to device and get its view
+        auto det_buffer = detray::get_buffer(det, *dev_mr, cuda_cpy);
+        auto det_view = detray::get_data(det_buffer);
+
+        // Move the trajectories to device
+        auto traj_buffer =
+            cuda_cpy.to(vecmem::get_data(trajectories), *dev_mr,
+                        vecmem::copy::type::host_to_device);
+        auto momenta_buffer = cuda_cpy.to(vecmem::get_data(momenta), *dev_mr,
+                                          vecmem::copy::type::host_to_device);
+
+        // Buffer for the intersection traces
+        std::vector<std::size_t> capacities(trajectories.size(), capacity);
+        vecmem::data::jagged_vector_buffer<record_t> traces_buffer(
+            capacities, *dev_mr, host_mr, vecmem::data::buffer_type::resizable);
+        cuda_cpy.setup(traces_buffer)->wait();
+
+        vecmem::data::vector_buffer<unsigned int> overflow_buffer(
+            static_cast<unsigned int>(trajectories.size()), *dev_mr);
+        cuda_cpy.setup(overflow_buffer)->wait();
+        cuda_cpy.memset(overflow_buffer, 0)->wait();
+
+        vecmem::data::vector_view<const trajectory_t> traj_view =
+            vecmem::get_data(traj_buffer);
+        vecmem::data::vector_view<const scalar_t> momenta_view =
+            vecmem::get_data(momenta_buffer);
+        auto traces_view = vecmem::get_data(traces_buffer);
+        auto overflow_view = vecmem::get_data(overflow_buffer);
+
+        // Run the scan on device
+        detector_scan_device<detector_t, trajectory_t>(
+            det_view, traj_view, momenta_view, mask_tolerance, traces_view,
+            overflow_view);
+
+        // Get the results back to the host
+        vecmem::jagged_vector<record_t> traces(host_mr);
+        cuda_cpy(traces_buffer, traces)->wait();
+
+        vecmem::vector<unsigned int> overflow(host_mr);
+        cuda_cpy(overflow_buffer, overflow)->wait();
+
+        for (std::size_t i = 0u; i < overflow.size(); ++i) {
+            if (overflow[i] != 0u || traces[i].empty()) {
+                throw std::runtime_error(
+                    "Device detector scan: Trace no. " + std::to_string(i) +
+                    (traces[i].empty() ? " is empty"
+                                       : " exceeds the capacity of " +
+                                             std::to_string(capacity)));
+            }
+        }
+
+        // Convert to the host trace type
+        std::vector<std::vector<record_t>> intersection_traces;
+        intersection_traces.reserve(traces.size());
+        for (const auto &trace : traces) {
+            intersection_traces.emplace_back(trace.begin(), trace.end());
+        }
+
+        return intersection_traces;
+    }
+};
+
+/// Run the scan of a detector scan test on device and pin the traces to the
+/// whiteboard of the test, which then only runs the checks on them
+///
+/// @param host_mr host memory resource
+/// @param dev_mr device memory resource
+/// @param det the detector to be scanned
+/// @param cfg the configuration of the @c test::detector_scan
+/// @param capacity the maximal number of records per trace
+template <typename trajectory_t, typename detector_t,
+          typename track_generator_t>
+inline void fill_scan_data_device(
+    vecmem::memory_resource *host_mr, vecmem::memory_resource *dev_mr,
+    const detector_t &det, test::detector_scan_config<track_generator_t> &cfg,
+    const std::size_t capacity = 1000u) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+
+    constexpr bool k_use_rays{
+        std::is_same_v<detail::ray<algebra_t>, trajectory_t>};
+
+    // Same trajectories as the host scan (@see test::detector_scan )
+    vecmem::vector<trajectory_t> trajectories(host_mr);
+    vecmem::vector<scalar_t> momenta(host_mr);
+
+    for (const auto trk : track_generator_t(cfg.track_generator())) {
+        if constexpr (k_use_rays) {
+            trajectories.push_back(trajectory_t(trk));
+        } else {
+            trajectories.push_back(trajectory_t(trk, cfg.B_vector()));
+        }
+
+        // The track generator can randomize the sign of the charge
+        const scalar_t qabs{math::fabs(cfg.track_generator().charge())};
+        const scalar_t q{math::copysign(qabs, trk.qop())};
+        momenta.push_back(q == 0.f ? 1.f * unit<scalar_t>::GeV : trk.p(q));
+    }
+
+    std::cout << "INFO: Generating trace data on device ("
+              << trajectories.size() << " trajectories)..." << std::endl;
+
+    auto intersection_traces = run_detector_scan{}(
+        host_mr, dev_mr, det, trajectories, momenta, cfg.mask_tolerance(),
+        capacity);
+
+    cfg.whiteboard()->add(cfg.name(), std::move(intersection_traces));
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,157 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_view.hpp>
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+#include <vecmem/containers/jagged_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// CUDA include(s)
+#include <cub/device/device_scan.cuh>
+
+// System include(s)
+#include <cstddef>
+#include <vector>
+
+namespace detray::cuda {
+
+namespace detail {
+
+/// Write the number of used entries of every row of @param data into
+/// @param sizes, followed by a zero (becomes the total after the scan)
+template <typename T>
+__global__ void jagged_row_sizes_kernel(
+    vecmem::data::jagged_vector_view<const T> data, unsigned int *sizes) {
+
+    const unsigned int n_rows{static_cast<unsigned int>(data.size())};
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid > n_rows) {
+        return;
+    }
+    if (gid == n_rows) {
+        sizes[gid] = 0u;
+        return;
+    }
+
+    const vecmem::jagged_device_vector<const T> rows(data);
+    sizes[gid] = rows.at(gid).size();
+}
+
+/// Copy the used entries of every row of @param data to its offset in the
+/// contiguous buffer @param flat
+template <typename T>
+__global__ void jagged_gather_kernel(
+    vecmem::data::jagged_vector_view<const T> data,
+    const unsigned int *offsets, T *flat) {
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= data.size()) {
+        return;
+    }
+
+    const vecmem::jagged_device_vector<const T> rows(data);
+    const auto row = rows.at(gid);
+    for (unsigned int i = 0u; i < row.size(); ++i) {
+        flat[offsets[gid] + i] = row[i];
+    }
+}
+
+}  // namespace detail
+
+/// Copy only the used entries of a resizable jagged device buffer to the host
+///
+/// An exclusive prefix sum over the row sizes gives the offset of every row
+/// in a contiguous device buffer, into which the used entries are gathered.
+/// Only the offsets and this buffer are copied back, instead of the full
+/// capacity of every row.
+///
+/// @param data view of the jagged device buffer
+/// @param dev_mr device memory resource for the temporary buffers
+/// @param host_mr memory resource of the returned jagged vector
+/// @param stream the stream to run on (waits for previous work on it)
+///
+/// @note This header can only be included in CUDA translation units
+///
+/// @returns the used entries of every row on the host
+template <typename T>
+inline vecmem::jagged_vector<T> copy_compacted(
+    const vecmem::data::jagged_vector_view<const T> &data,
+    vecmem::memory_resource &dev_mr, vecmem::memory_resource &host_mr,
+    cudaStream_t stream = nullptr) {
+
+    vecmem::jagged_vector<T> result(&host_mr);
+
+    const unsigned int n_rows{static_cast<unsigned int>(data.size())};
+    if (n_rows == 0u) {
+        return result;
+    }
+
+    // Row sizes and offsets: The last offset is the total number of entries
+    vecmem::data::vector_buffer<unsigned int> sizes(n_rows + 1u, dev_mr);
+    vecmem::data::vector_buffer<unsigned int> offsets(n_rows + 1u, dev_mr);
+
+    constexpr unsigned int thread_dim{2u * WARP_SIZE};
+    const unsigned int block_dim{(n_rows + thread_dim) / thread_dim};
+
+    detail::jagged_row_sizes_kernel<T>
+        <<<block_dim, thread_dim, 0, stream>>>(data, sizes.ptr());
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Exclusive prefix sum of the row sizes
+    std::size_t temp_bytes{0u};
+    DETRAY_CUDA_ERROR_CHECK(cub::DeviceScan::ExclusiveSum(
+        nullptr, temp_bytes, sizes.ptr(), offsets.ptr(), n_rows + 1u, stream));
+    vecmem::data::vector_buffer<unsigned char> temp_storage(
+        static_cast<unsigned int>(temp_bytes), dev_mr);
+    DETRAY_CUDA_ERROR_CHECK(cub::DeviceScan::ExclusiveSum(
+        temp_storage.ptr(), temp_bytes, sizes.ptr(), offsets.ptr(),
+        n_rows + 1u, stream));
+
+    // The offsets are needed on the host to size the copy and to split the
+    // contiguous buffer into rows again
+    std::vector<unsigned int> host_offsets(n_rows + 1u);
+    DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+        host_offsets.data(), offsets.ptr(),
+        (n_rows + 1u) * sizeof(unsigned int), cudaMemcpyDeviceToHost, stream));
+    DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+
+    const unsigned int n_entries{host_offsets.back()};
+    vecmem::vector<T> host_flat(n_entries, &host_mr);
+
+    if (n_entries > 0u) {
+        vecmem::data::vector_buffer<T> flat(n_entries, dev_mr);
+
+        detail::jagged_gather_kernel<T>
+            <<<(n_rows + thread_dim - 1u) / thread_dim, thread_dim, 0,
+               stream>>>(data, offsets.ptr(), flat.ptr());
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+            host_flat.data(), flat.ptr(), n_entries * sizeof(T),
+            cudaMemcpyDeviceToHost, stream));
+        DETRAY_CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+    }
+
+    // Split into rows (allocated with the memory resource of the result)
+    result.reserve(n_rows);
+    for (unsigned int i = 0u; i < n_rows; ++i) {
+        result.emplace_back(host_flat.begin() + host_offsets[i],
+                            host_flat.begin() + host_offsets[i + 1u]);
+    }
+
+    return result;
+}
+
+}  // namespace detray::cuda
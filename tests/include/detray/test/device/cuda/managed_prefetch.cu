@@ -0,0 +1,51 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+
+// Detray test include(s)
+#include "detray/test/device/cuda/managed_prefetch.hpp"
+
+namespace detray::cuda {
+
+void prefetch_managed(const void *ptr, const std::size_t n_bytes,
+                      const int device, const managed_access access,
+                      vecmem::cuda::stream_wrapper *stream) {
+
+    if (ptr == nullptr || n_bytes == 0u) {
+        return;
+    }
+
+    // Only managed memory can be advised and prefetched
+    cudaPointerAttributes attributes{};
+    DETRAY_CUDA_ERROR_CHECK(cudaPointerGetAttributes(&attributes, ptr));
+    if (attributes.type != cudaMemoryTypeManaged) {
+        return;
+    }
+
+    const cudaMemoryAdvise advice{access == managed_access::e_read_mostly
+                                      ? cudaMemAdviseSetReadMostly
+                                      : cudaMemAdviseSetPreferredLocation};
+    DETRAY_CUDA_ERROR_CHECK(cudaMemAdvise(ptr, n_bytes, advice, device));
+
+    // Prefetching needs concurrent managed access (not e.g. on Windows)
+    int concurrent_access{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceGetAttribute(
+        &concurrent_access, cudaDevAttrConcurrentManagedAccess, device));
+    if (concurrent_access == 0) {
+        return;
+    }
+
+    cudaStream_t cuda_stream{
+        stream ? static_cast<cudaStream_t>(stream->stream()) : nullptr};
+
+    DETRAY_CUDA_ERROR_CHECK(
+        cudaMemPrefetchAsync(ptr, n_bytes, device, cuda_stream));
+}
+
+}  // namespace detray::cuda
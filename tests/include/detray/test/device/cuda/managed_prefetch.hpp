@@ -0,0 +1,121 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+
+// Vecmem include(s)
+#include <vecmem/utils/cuda/stream_wrapper.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <utility>
+
+namespace detray::cuda {
+
+/// How the data of a managed memory range is going to be accessed
+enum class managed_access {
+    /// Mostly read by all devices (e.g. the detector): Every device that
+    /// reads it gets its own read-only copy of the pages
+    e_read_mostly = 0,
+    /// Read and written mostly by one device (e.g. the track states): The
+    /// pages stay on that device and are not migrated on host access
+    e_preferred_location = 1,
+};
+
+/// Set the access advice for the address range [@param ptr,
+/// @param ptr + @param n_bytes) and prefetch it to @param device
+///
+/// Does nothing if the range is not in managed memory.
+///
+/// @note The prefetch is enqueued on @param stream (the default stream if
+/// none is given) and does not wait for the migration to finish.
+void prefetch_managed(const void *ptr, std::size_t n_bytes, int device,
+                      managed_access access,
+                      vecmem::cuda::stream_wrapper *stream = nullptr);
+
+/// Prefetch all members of an aggregate view @param view to @param device
+template <typename... view_ts>
+inline void prefetch(const dmulti_view<view_ts...> &view, int device,
+                     managed_access access,
+                     vecmem::cuda::stream_wrapper *stream = nullptr);
+
+/// Prefetch the managed memory of a vector view @param view to @param device
+template <typename T>
+inline void prefetch(const dvector_view<T> &view, const int device,
+                     const managed_access access,
+                     vecmem::cuda::stream_wrapper *stream = nullptr) {
+    if (view.capacity() == 0u) {
+        return;
+    }
+    prefetch_managed(view.ptr(), view.capacity() * sizeof(T), device, access,
+                     stream);
+    if (view.size_ptr() != nullptr) {
+        prefetch_managed(view.size_ptr(), sizeof(*view.size_ptr()), device,
+                         access, stream);
+    }
+}
+
+/// Prefetch the managed memory of a jagged vector view @param view to
+/// @param device
+///
+/// @note The inner views are read on the host, so they have to be
+/// host-accessible (as is the case for managed memory)
+template <typename T>
+inline void prefetch(const djagged_vector_view<T> &view, const int device,
+                     const managed_access access,
+                     vecmem::cuda::stream_wrapper *stream = nullptr) {
+    if (view.capacity() == 0u) {
+        return;
+    }
+    for (std::size_t i = 0u; i < view.capacity(); ++i) {
+        prefetch(view.host_ptr()[i], device, access, stream);
+    }
+    prefetch_managed(view.ptr(), view.capacity() * sizeof(dvector_view<T>),
+                     device, access, stream);
+}
+
+/// @cond
+template <typename... view_ts, std::size_t... I>
+inline void prefetch(const dmulti_view<view_ts...> &view, const int device,
+                     const managed_access access,
+                     vecmem::cuda::stream_wrapper *stream,
+                     std::index_sequence<I...>) {
+    (prefetch(detail::get<I>(view.m_view), device, access, stream), ...);
+}
+
+/// @endcond
+
+template <typename... view_ts>
+inline void prefetch(const dmulti_view<view_ts...> &view, const int device,
+                     const managed_access access,
+                     vecmem::cuda::stream_wrapper *stream) {
+    prefetch(view, device, access, stream,
+             std::make_index_sequence<sizeof...(view_ts)>{});
+}
+
+/// Prefetch the data of a detector view @param det_view to @param device
+/// and mark it as read-mostly, so that the first kernel does not stall on
+/// page faults
+template <concepts::device_view detector_view_t>
+inline void prefetch_detector(const detector_view_t &det_view,
+                              const int device,
+                              vecmem::cuda::stream_wrapper *stream = nullptr) {
+    prefetch(det_view, device, managed_access::e_read_mostly, stream);
+}
+
+/// Prefetch the track data in the view @param view to @param device and
+/// keep it there (the track states are written by the device)
+template <concepts::device_view view_t>
+inline void prefetch_tracks(const view_t &view, const int device,
+                            vecmem::cuda::stream_wrapper *stream = nullptr) {
+    prefetch(view, device, managed_access::e_preferred_location, stream);
+}
+
+}  // namespace detray::cuda
@@ -0,0 +1,34 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+
+// Detray test include(s)
+#include "detray/test/device/cuda/multi_device.hpp"
+
+namespace detray::cuda {
+
+int device_count() {
+    int n_devices{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDeviceCount(&n_devices));
+
+    return n_devices;
+}
+
+int current_device() {
+    int device{0};
+    DETRAY_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+
+    return device;
+}
+
+void set_device(const int device) {
+    DETRAY_CUDA_ERROR_CHECK(cudaSetDevice(device));
+}
+
+}  // namespace detray::cuda
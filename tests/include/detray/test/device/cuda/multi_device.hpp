@@ -0,0 +1,160 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
+#include <vecmem/utils/cuda/stream_wrapper.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace detray::cuda {
+
+/// @returns the number of visible CUDA devices
+int device_count();
+
+/// @returns the device that is current for the calling host thread
+int current_device();
+
+/// Make the device @param device current for the calling host thread
+void set_device(int device);
+
+/// @returns the indices of all visible CUDA devices
+inline std::vector<int> all_devices() {
+    std::vector<int> devices(static_cast<std::size_t>(device_count()));
+    for (std::size_t i = 0u; i < devices.size(); ++i) {
+        devices[i] = static_cast<int>(i);
+    }
+
+    return devices;
+}
+
+/// Contiguous range of a collection that is processed by one device
+struct shard_range {
+    std::size_t begin{0u};
+    std::size_t size{0u};
+};
+
+/// Split a collection of @param n_items into @param n_shards contiguous
+/// ranges of (almost) equal size, in the order of the collection
+inline std::vector<shard_range> make_shards(const std::size_t n_items,
+                                            const std::size_t n_shards) {
+    assert(n_shards > 0u);
+
+    std::vector<shard_range> shards(n_shards);
+
+    const std::size_t n_min{n_items / n_shards};
+    const std::size_t n_rest{n_items % n_shards};
+
+    std::size_t begin{0u};
+    for (std::size_t i = 0u; i < n_shards; ++i) {
+        shards[i] = {begin, n_min + (i < n_rest ? 1u : 0u)};
+        begin += shards[i].size;
+    }
+
+    return shards;
+}
+
+/// @brief Replicas of a detector on several CUDA devices.
+///
+/// Every device gets its own memory resource, stream and copy object, and a
+/// copy of the detector data in its global memory. The replicas are uploaded
+/// asynchronously and concurrently on the streams of the devices, so work
+/// that is enqueued on the same stream can use the replica right away.
+///
+/// @note The device whose work is enqueued has to be made current first
+/// (@see for_each_device).
+template <typename detector_t>
+class detector_replicas {
+
+    public:
+    using view_type = typename detector_t::view_type;
+
+    /// Data of one device
+    struct replica {
+        /// The CUDA device index
+        int device;
+        vecmem::cuda::device_memory_resource mr;
+        vecmem::cuda::stream_wrapper stream;
+        vecmem::cuda::async_copy copy;
+        typename detector_t::buffer_type buffer{};
+
+        explicit replica(const int dev)
+            : device{dev}, mr{dev}, stream{dev}, copy{stream} {}
+
+        /// @returns the view of the detector replica
+        view_type view() { return detray::get_data(buffer); }
+    };
+
+    /// Replicate the detector @param det onto the devices @param devices
+    explicit detector_replicas(
+        detector_t &det, const std::vector<int> &devices = all_devices()) {
+
+        if (devices.empty()) {
+            throw std::invalid_argument("No CUDA devices to replicate onto");
+        }
+
+        m_replicas.reserve(devices.size());
+        for (const int dev : devices) {
+            set_device(dev);
+
+            // Stable addresses: The buffers reference the memory resources
+            replica &rep =
+                *m_replicas.emplace_back(std::make_unique<replica>(dev));
+            rep.buffer =
+                detray::get_buffer(det, rep.mr, rep.copy, detray::copy::async);
+        }
+    }
+
+    /// @returns the number of replicas
+    std::size_t size() const { return m_replicas.size(); }
+
+    /// @returns the replica with index @param i
+    /// @{
+    replica &operator[](const std::size_t i) { return *m_replicas.at(i); }
+    const replica &operator[](const std::size_t i) const {
+        return *m_replicas.at(i);
+    }
+    /// @}
+
+    /// Wait until all work on the streams of all devices is done
+    void synchronize() {
+        for (auto &rep : m_replicas) {
+            rep->stream.synchronize();
+        }
+    }
+
+    private:
+    std::vector<std::unique_ptr<replica>> m_replicas{};
+};
+
+/// Call @param f for every replica in @param replicas on its device
+///
+/// The device of the replica is made current before @param f is called with
+/// the index of the replica and the replica itself. Work that @param f
+/// enqueues on the stream of the replica runs concurrently to the other
+/// devices.
+template <typename detector_t, typename function_t>
+inline void for_each_device(detector_replicas<detector_t> &replicas,
+                            function_t &&f) {
+    for (std::size_t i = 0u; i < replicas.size(); ++i) {
+        set_device(replicas[i].device);
+        f(i, replicas[i]);
+    }
+}
+
+}  // namespace detray::cuda
@@ -36,11 +36,14 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -152,6 +155,8 @@ struct toy_det_config {
     barrel_generator_config<scalar_t> m_barrel_factory_cfg{};
     /// Config for the module generation (endcaps)
     endcap_generator_config<scalar_t> m_endcap_factory_cfg{};
+    /// Factor on the number of surface grid bins per module (per axis)
+    scalar_t m_grid_bin_scale{1.f};
     /// Run detector consistency check after reading
     bool m_do_check{true};
 
@@ -208,6 +213,29 @@ struct toy_det_config {
         m_do_check = check;
         return *this;
     }
+    constexpr toy_det_config &outer_radius(const scalar_t r) {
+        assert(r > m_beampipe_volume_radius);
+        m_outer_radius = r;
+        return *this;
+    }
+    toy_det_config &barrel_layer_radii(const std::vector<scalar_t> &radii) {
+        m_barrel_layer_radii = radii;
+        return *this;
+    }
+    toy_det_config &barrel_layer_binning(
+        const std::vector<std::pair<unsigned int, unsigned int>> &binning) {
+        m_barrel_binning = binning;
+        return *this;
+    }
+    toy_det_config &endcap_layer_positions(const std::vector<scalar_t> &pos) {
+        m_endcap_layer_positions = pos;
+        return *this;
+    }
+    constexpr toy_det_config &grid_bin_scale(const scalar_t s) {
+        assert(s > 0.f);
+        m_grid_bin_scale = s;
+        return *this;
+    }
     /// @}
 
     /// Getters
@@ -267,6 +295,7 @@ struct toy_det_config {
     constexpr endcap_generator_config<scalar_t> &endcap_config() {
         return m_endcap_factory_cfg;
     }
+    constexpr scalar_t grid_bin_scale() const { return m_grid_bin_scale; }
     constexpr bool do_check() const { return m_do_check; }
     /// @}
 
@@ -277,7 +306,10 @@ struct toy_det_config {
             << "----------------------------\n"
             << "  No. barrel layers     : " << cfg.n_brl_layers() << "\n"
             << "  No. endcap layers     : " << cfg.n_edc_layers() << "\n"
-            << "  Portal envelope       : " << cfg.envelope() << " [mm]\n";
+            << "  Outer radius          : "
+            << cfg.outer_radius() / detray::unit<scalar_t>::mm << " [mm]\n"
+            << "  Portal envelope       : " << cfg.envelope() << " [mm]\n"
+            << "  Grid bin scale        : " << cfg.grid_bin_scale() << "\n";
 
         if (cfg.use_material_maps()) {
             const auto &cyl_map_bins = cfg.cyl_map_bins();
@@ -504,6 +536,17 @@ void add_cylinder_portals(volume_builder_interface<detector_t> *v_builder,
     names[vol_idx + 1u] = "gap_" + std::to_string(vol_idx);
 }
 
+/// @returns the number of grid bins for @param n_modules modules along an
+/// axis, scaled by the factor @param scale (at least one bin)
+template <concepts::scalar scalar_t>
+inline std::size_t scale_grid_bins(const std::size_t n_modules,
+                                   const scalar_t scale) {
+    const auto n_bins{static_cast<std::size_t>(
+        std::round(scale * static_cast<scalar_t>(n_modules)))};
+
+    return std::max(n_bins, std::size_t{1u});
+}
+
 /// Helper method for creating the barrel surface grids.
 ///
 /// @param det_builder detector builder the barrel section should be added to
@@ -538,7 +581,8 @@ inline void add_cylinder_grid(
     vgr_builder->set_type(detector_t::geo_obj_ids::e_sensitive);
     vgr_builder->init_grid(
         {-constant<scalar_t>::pi, constant<scalar_t>::pi, -h_z, h_z},
-        {barrel_cfg.binning().first, barrel_cfg.binning().second});
+        {scale_grid_bins(barrel_cfg.binning().first, cfg.grid_bin_scale()),
+         scale_grid_bins(barrel_cfg.binning().second, cfg.grid_bin_scale())});
 }
 
 /// Helper method for creating the endcap surface grids.
@@ -576,7 +620,8 @@ inline void add_disc_grid(
     vgr_builder->set_type(detector_t::geo_obj_ids::e_sensitive);
     vgr_builder->init_grid(
         {inner_r, outer_r, -constant<scalar_t>::pi, constant<scalar_t>::pi},
-        {endcap_cfg.binning().size(), endcap_cfg.binning().back()});
+        {scale_grid_bins(endcap_cfg.binning().size(), cfg.grid_bin_scale()),
+         scale_grid_bins(endcap_cfg.binning().back(), cfg.grid_bin_scale())});
 }
 
 /// Helper method to retrieve the volume extent from a potentially decorated
@@ -1214,6 +1259,134 @@ inline void add_beampipe_portals(
 
 }  // namespace detail
 
+/// Scale the toy detector to an arbitrary number of layers and modules, e.g.
+/// for stress tests and scaling studies.
+///
+/// The first barrel and endcap layers are the layers of the toy detector.
+/// Additional barrel layers are placed at a constant radial pitch and
+/// additional endcap layers at a constant pitch in z. The module dimensions
+/// are divided by the module granularity and the number of modules per layer
+/// is increased such that the modules still cover every layer. The endcap
+/// modules are only subdivided in phi, since the endcap generator always
+/// builds two rings.
+///
+/// @param cfg toy detector configuration that should be scaled
+/// @param n_brl number of barrel layers
+/// @param n_edc number of endcap layers on either side
+/// @param module_granularity factor by which the modules are made smaller
+///
+/// @returns the scaled configuration
+template <concepts::scalar scalar_t>
+inline toy_det_config<scalar_t> &scale_toy_detector(
+    toy_det_config<scalar_t> &cfg, const unsigned int n_brl,
+    const unsigned int n_edc,
+    const std::type_identity_t<scalar_t> module_granularity = 1.f) {
+
+    constexpr scalar_t mm{unit<scalar_t>::mm};
+    // Radial distance between additional barrel layers
+    constexpr scalar_t barrel_pitch{56.f * mm};
+    // Distance in z between additional endcap layers
+    constexpr scalar_t endcap_pitch{200.f * mm};
+    // Radial distance between the last barrel layer and the outer radius
+    constexpr scalar_t outer_gap{8.f * mm};
+    // Overcoverage of a barrel layer in phi by the modules
+    constexpr scalar_t phi_overlap{1.2f};
+
+    if (module_granularity < 1.f) {
+        throw std::invalid_argument(
+            "ERROR: The module granularity has to be at least one");
+    }
+
+    // The unscaled toy detector
+    toy_det_config<scalar_t> toy_cfg{};
+    const scalar_t g{module_granularity};
+
+    //
+    // Barrel
+    //
+    auto &barrel_cfg = cfg.barrel_config();
+    const scalar_t h_z{barrel_cfg.half_length()};
+    const scalar_t half_x{toy_cfg.barrel_config().module_bounds().at(0) / g};
+    const scalar_t half_y{toy_cfg.barrel_config().module_bounds().at(1) / g};
+    const scalar_t z_overlap{toy_cfg.barrel_config().z_overlap() / g};
+
+    barrel_cfg.module_bounds({half_x, half_y}).z_overlap(z_overlap);
+
+    // Number of modules that fit into the barrel half length
+    const auto n_z{static_cast<unsigned int>(
+        std::floor((2.f * h_z - 2.f * half_y) / (2.f * half_y - z_overlap)) +
+        1.f)};
+
+    // Keep at least the toy detector layers to retain the outer radius
+    const std::size_t n_toy_brl{toy_cfg.barrel_layer_radii().size() - 1u};
+    const std::size_t n_brl_radii{std::max(std::size_t{n_brl}, n_toy_brl) + 1u};
+
+    std::vector<scalar_t> radii{toy_cfg.barrel_layer_radii().front()};
+    std::vector<std::pair<unsigned int, unsigned int>> brl_binning{{0u, 0u}};
+    for (std::size_t i = 1u; i < n_brl_radii; ++i) {
+        unsigned int n_phi{0u};
+        if (i <= n_toy_brl) {
+            radii.push_back(toy_cfg.barrel_layer_radii()[i]);
+            n_phi = static_cast<unsigned int>(std::ceil(
+                g * static_cast<scalar_t>(
+                        toy_cfg.barrel_layer_binning()[i].first)));
+        } else {
+            radii.push_back(radii.back() + barrel_pitch);
+            n_phi = static_cast<unsigned int>(
+                std::ceil(phi_overlap * constant<scalar_t>::pi *
+                          radii.back() / half_x));
+        }
+        brl_binning.emplace_back(n_phi, n_z);
+    }
+
+    cfg.barrel_layer_radii(radii)
+        .barrel_layer_binning(brl_binning)
+        .outer_radius(radii.back() + outer_gap);
+
+    //
+    // Endcaps
+    //
+
+    // Move the endcap layers outward, if the barrel is longer
+    const scalar_t z_shift{
+        std::max(h_z - toy_cfg.barrel_config().half_length(), scalar_t{0})};
+    const std::size_t n_edc_pos{
+        std::max(std::size_t{n_edc}, toy_cfg.endcap_layer_positions().size())};
+
+    std::vector<scalar_t> positions{};
+    for (const scalar_t z : toy_cfg.endcap_layer_positions()) {
+        positions.push_back(z + z_shift);
+    }
+    while (positions.size() < n_edc_pos) {
+        positions.push_back(positions.back() + endcap_pitch);
+    }
+
+    cfg.endcap_layer_positions(positions);
+
+    // Scale the rings to the new radial extent of the endcaps
+    const scalar_t r_scale{
+        (cfg.outer_radius() - cfg.beampipe_vol_radius()) /
+        (toy_cfg.outer_radius() - toy_cfg.beampipe_vol_radius())};
+
+    const auto &toy_edc_cfg = toy_cfg.endcap_config();
+    std::vector<std::vector<scalar_t>> edc_bounds{};
+    std::vector<unsigned int> edc_binning{};
+    for (std::size_t i = 0u; i < toy_edc_cfg.module_bounds().size(); ++i) {
+        const auto &bounds = toy_edc_cfg.module_bounds()[i];
+
+        edc_bounds.push_back(
+            {bounds[trapezoid2D::e_half_length_0] * r_scale / g,
+             bounds[trapezoid2D::e_half_length_1] * r_scale / g,
+             bounds[trapezoid2D::e_half_length_2] * r_scale});
+        edc_binning.push_back(static_cast<unsigned int>(std::ceil(
+            g * r_scale * static_cast<scalar_t>(toy_edc_cfg.binning()[i]))));
+    }
+
+    cfg.endcap_config().module_bounds(edc_bounds).binning(edc_binning);
+
+    return cfg.n_brl_layers(n_brl).n_edc_layers(n_edc);
+}
+
 /// Builds a detray geometry that contains the innermost tml layers. The number
 /// of barrel and endcap layers can be chosen, but all barrel layers should be
 /// present when an endcap detector is built to have the barrel region radius
@@ -1248,9 +1421,10 @@ inline auto build_toy_detector(vecmem::memory_resource &resource,
             "ERROR: Too many barrel layers requested (max " +
             std::to_string(cfg.barrel_layer_radii().size() - 1u) + ")!");
     }
-    if (cfg.n_edc_layers() > 0 && cfg.n_brl_layers() < 4) {
+    if (cfg.n_edc_layers() > 0 &&
+        cfg.n_brl_layers() < cfg.barrel_layer_radii().size() - 1u) {
         throw std::invalid_argument(
-            "ERROR: All four barrel layers need to be present in order to add "
+            "ERROR: All barrel layers need to be present in order to add "
             "endcap layers");
     }
 
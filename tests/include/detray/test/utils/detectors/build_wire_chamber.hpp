@@ -48,6 +48,9 @@ struct wire_chamber_config {
     wire_layer_generator_config<scalar_t> m_wire_factory_cfg{};
     /// Configuration for the homogeneous material generator
     hom_material_config<scalar_t> m_material_config{};
+    /// Number of wires per phi bin of the layer grids
+    /// (0: fixed binning with 100 phi bins in every layer)
+    unsigned int m_wires_per_bin{0u};
     /// Do a full detector consistency check after building
     bool m_do_check{true};
 
@@ -81,6 +84,10 @@ struct wire_chamber_config {
         m_wire_mat = m;
         return *this;
     }
+    constexpr wire_chamber_config &wires_per_bin(const unsigned int n) {
+        m_wires_per_bin = n;
+        return *this;
+    }
     constexpr wire_chamber_config &do_check(const bool check) {
         m_do_check = check;
         return *this;
@@ -113,7 +120,33 @@ struct wire_chamber_config {
     }
     constexpr auto &material_config() { return m_material_config; }
     constexpr const auto &material_config() const { return m_material_config; }
+    constexpr unsigned int wires_per_bin() const { return m_wires_per_bin; }
     constexpr bool do_check() const { return m_do_check; }
+
+    /// @returns the inner radius of the layer @param i_lay
+    constexpr scalar_t layer_inner_radius(const unsigned int i_lay) const {
+        return m_first_layer_inner_rad +
+               static_cast<scalar_t>(i_lay) * 2.f * cell_size();
+    }
+
+    /// @returns the number of wires in the layer @param i_lay
+    /// (@see wire_layer_generator )
+    unsigned int n_wires(const unsigned int i_lay) const {
+        const scalar_t central_rad{layer_inner_radius(i_lay) + cell_size()};
+        const scalar_t delta{2.f * cell_size() / central_rad};
+
+        return static_cast<unsigned int>(
+                   math::floor(2.f * constant<scalar_t>::pi / delta)) +
+               1u;
+    }
+
+    /// @returns the number of phi bins of the grid in the layer @param i_lay
+    unsigned int n_phi_bins(const unsigned int i_lay) const {
+        if (m_wires_per_bin == 0u) {
+            return 100u;
+        }
+        return (n_wires(i_lay) + m_wires_per_bin - 1u) / m_wires_per_bin;
+    }
     /// @}
 
     private:
@@ -137,12 +170,46 @@ struct wire_chamber_config {
             << "  Stereo angle          : " << cfg.stereo_angle() << " [rad]\n"
             << "  Wire material         : " << cfg.wire_material() << "\n"
             << "  Material rad.         : " << cfg.mat_radius() << " [mm]\n";
+        if (cfg.wires_per_bin() > 0u) {
+            out << "  Wires per grid bin    : " << cfg.wires_per_bin() << "\n";
+        }
 
         return out;
     }
 
 };  // wire chamber config
 
+/// @returns the search window of the layer grids in the wire chamber
+/// @param cfg that contains all wires within the drift radius (cell size) of
+/// the track position.
+///
+/// The stereo wires are binned by their center position, so the window also
+/// covers the displacement of the wires in phi at the chamber ends.
+/// @param mask_tolerance is the max. mask tolerance of the navigation config
+template <concepts::scalar scalar_t, typename wire_shape_t>
+inline darray<dindex, 2> wire_chamber_search_window(
+    const wire_chamber_config<scalar_t, wire_shape_t> &cfg,
+    const scalar_t mask_tolerance = 0.f) {
+
+    const scalar_t stereo_shift{cfg.half_z() *
+                                math::fabs(math::tan(cfg.stereo_angle()))};
+    const scalar_t reach{cfg.cell_size() + stereo_shift + mask_tolerance};
+
+    dindex n_bins{0u};
+    for (unsigned int i_lay = 0u; i_lay < cfg.n_layers(); ++i_lay) {
+        // Largest phi distance at the inner radius of the layer
+        const scalar_t delta_phi{reach / cfg.layer_inner_radius(i_lay)};
+        const scalar_t bin_width{2.f * constant<scalar_t>::pi /
+                                 static_cast<scalar_t>(cfg.n_phi_bins(i_lay))};
+
+        const auto n{static_cast<dindex>(math::ceil(delta_phi / bin_width))};
+        n_bins = (n > n_bins) ? n : n_bins;
+    }
+
+    // Only one bin in z
+    return {n_bins, 0u};
+}
+
 template <concepts::algebra algebra_t, typename wire_shape_t>
 inline auto build_wire_chamber(
     vecmem::memory_resource &resource,
@@ -177,7 +244,7 @@ inline auto build_wire_chamber(
 
     // Binning of the grid
     axis::multi_bin_range<cyl_grid_t::dim> bin_range{};
-    // Min, max bin indices per axis
+    // Min, max bin indices per axis (the phi binning is set per layer)
     bin_range[static_cast<std::size_t>(axis::label::e_rphi)] = {0, 100};
     bin_range[static_cast<std::size_t>(axis::label::e_cyl_z)] = {0, 1};
 
@@ -186,7 +253,9 @@ inline auto build_wire_chamber(
                                         constant<scalar_t>::pi, -cfg.half_z(),
                                         cfg.half_z()};
 
-    constexpr unsigned int bin_capacity{3u};
+    // One extra slot for the bins that receive an additional wire
+    const unsigned int bin_capacity{
+        cfg.wires_per_bin() == 0u ? 3u : cfg.wires_per_bin() + 1u};
     std::vector<std::pair<loc_bin_idx_t, dindex>> capacities{};
     capacities.reserve(
         static_cast<std::size_t>(bin_range[0][1] * bin_range[1][1]));
@@ -294,6 +363,10 @@ inline auto build_wire_chamber(
         auto vgr_builder =
             det_builder.template decorate<grid_builder_t>(vm_builder);
 
+        // Adapt the phi binning to the number of wires in the layer
+        bin_range[static_cast<std::size_t>(axis::label::e_rphi)] = {
+            0, static_cast<int>(cfg.n_phi_bins(i_lay))};
+
         // Determine bin capacities
         capacities.clear();
         auto bin_indexer2D = axis::detail::get_bin_indexer(
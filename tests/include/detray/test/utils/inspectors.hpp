@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,22 +15,28 @@
 // Project include(s)
 #include "detray/definitions/algebra.hpp"
 #include "detray/definitions/math.hpp"
+#include "detray/geometry/barcode.hpp"
 #include "detray/navigation/detail/print_state.hpp"
 #include "detray/navigation/navigation_config.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/base_stepper.hpp"
 #include "detray/propagator/stepping_config.hpp"
 #include "detray/tracks/ray.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/tuple_helpers.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <iomanip>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -91,6 +97,22 @@ struct aggregate_inspector {
         }
     }
 
+    /// Forward a candidate cache overflow to the inspectors that record it
+    template <typename state_type>
+    DETRAY_HOST_DEVICE void cache_overflow(const state_type &state) {
+        std::apply(
+            [&state](auto &... insp) {
+                (
+                    [&state](auto &i) {
+                        if constexpr (requires { i.cache_overflow(state); }) {
+                            i.cache_overflow(state);
+                        }
+                    }(insp),
+                    ...);
+            },
+            _inspectors);
+    }
+
     /// @returns a specific inspector by type
     template <typename inspector_t>
     DETRAY_HOST_DEVICE constexpr decltype(auto) get() {
@@ -244,6 +266,319 @@ struct object_tracer {
     }
 };
 
+/// A navigation inspector that records the occupancy of the candidate cache
+/// per volume: The high-water mark of the number of candidates that were
+/// requested during the local navigation and how many of them had to be
+/// dropped, because the cache capacity was exceeded.
+struct cache_inspector {
+
+    using view_type = dvector_view<char>;
+    using const_view_type = dvector_view<const char>;
+
+    /// Cache statistics of a single volume
+    struct volume_record {
+        /// Number of navigation calls that were inspected in this volume
+        std::size_t n_calls{0u};
+        /// Number of candidates that did not fit into the cache
+        std::size_t n_overflows{0u};
+        /// Maximal number of candidates requested at once (incl. dropped)
+        std::size_t high_water_mark{0u};
+    };
+
+    /// Default constructor
+    cache_inspector() = default;
+
+    /// Inspector interface: count candidates that were dropped from the cache
+    template <typename state_type>
+    void cache_overflow(const state_type & /*state*/) {
+        ++m_n_dropped;
+    }
+
+    /// Inspector interface: update the statistics of the current volume
+    template <typename state_type, concepts::point3D point3_t,
+              concepts::vector3D vector3_t, typename... Args>
+    auto operator()(const state_type &state, const navigation::config &,
+                    const point3_t &, const vector3_t &,
+                    const char * /*message*/, Args &&...) {
+
+        if (detray::detail::is_invalid_value(state.volume())) {
+            m_n_dropped = 0u;
+            return;
+        }
+
+        const auto vol_idx{static_cast<std::size_t>(state.volume())};
+        if (vol_idx >= m_records.size()) {
+            m_records.resize(vol_idx + 1u);
+        }
+
+        volume_record &rec = m_records[vol_idx];
+        ++rec.n_calls;
+        rec.n_overflows += m_n_dropped;
+        rec.high_water_mark =
+            std::max(rec.high_water_mark,
+                     static_cast<std::size_t>(state.n_cached()) + m_n_dropped);
+
+        m_n_dropped = 0u;
+    }
+
+    /// Inspector interface
+    template <typename state_type>
+    auto operator()(const state_type & /*state*/,
+                    const char * /*message*/) { /* Do nothing*/
+    }
+
+    /// Add the statistics that were gathered by @param other
+    void merge(const cache_inspector &other) {
+        if (other.m_records.size() > m_records.size()) {
+            m_records.resize(other.m_records.size());
+        }
+        for (std::size_t i = 0u; i < other.m_records.size(); ++i) {
+            m_records[i].n_calls += other.m_records[i].n_calls;
+            m_records[i].n_overflows += other.m_records[i].n_overflows;
+            m_records[i].high_water_mark =
+                std::max(m_records[i].high_water_mark,
+                         other.m_records[i].high_water_mark);
+        }
+    }
+
+    /// @returns the statistics per volume index
+    const std::vector<volume_record> &records() const { return m_records; }
+
+    /// @returns the total number of dropped candidates
+    std::size_t n_overflows() const {
+        std::size_t n{0u};
+        for (const auto &rec : m_records) {
+            n += rec.n_overflows;
+        }
+        return n;
+    }
+
+    /// @returns the smallest cache capacity that holds all candidates that
+    /// were requested in any of the volumes (the navigator needs at least two)
+    std::size_t recommended_capacity() const {
+        std::size_t capacity{2u};
+        for (const auto &rec : m_records) {
+            capacity = std::max(capacity, rec.high_water_mark);
+        }
+        return capacity;
+    }
+
+    private:
+    /// Statistics per volume (indexed by volume index)
+    std::vector<volume_record> m_records{};
+    /// Overflows since the last inspector call
+    std::size_t m_n_dropped{0u};
+};
+
+/// A navigation inspector that fills a heatmap of the surface grid lookups
+/// per volume and grid bin: How often the bin was looked up during the
+/// volume initialization, how many candidates the lookup returned and how
+/// many of these were reached by the track. Over-binned grids show many bins
+/// with few lookups, under-binned grids many candidates per hit.
+///
+/// @note The sensitive surfaces that are reached in a volume are attributed
+/// to the bin of the last lookup in that volume. The lookups are repeated in
+/// the default geometry context.
+struct grid_heatmap_inspector {
+
+    using view_type = dvector_view<char>;
+    using const_view_type = dvector_view<const char>;
+
+    /// Lookup statistics of a single grid bin
+    struct bin_record {
+        /// Number of grid lookups that started in this bin
+        std::size_t n_lookups{0u};
+        /// Number of candidates returned by the lookups (incl. neighbors)
+        std::size_t n_candidates{0u};
+        /// Number of sensitive surfaces reached after the lookups
+        std::size_t n_hits{0u};
+    };
+
+    /// Default constructor
+    grid_heatmap_inspector() = default;
+
+    /// Inspector interface
+    template <typename state_type>
+    void cache_overflow(const state_type & /*state*/) { /* Do nothing*/
+    }
+
+    /// Inspector interface: record grid lookups and hits
+    template <typename state_type, concepts::point3D point3_t,
+              concepts::vector3D vector3_t, typename... Args>
+    auto operator()(const state_type &state, const navigation::config &cfg,
+                    const point3_t &pos, const vector3_t &dir,
+                    const char *message, Args &&...) {
+
+        const std::string_view msg{message};
+
+        if (detray::detail::is_invalid_value(state.volume())) {
+            reset();
+            return;
+        }
+        const auto vol_idx{static_cast<std::size_t>(state.volume())};
+
+        if (msg.starts_with("Init complete")) {
+            reset();
+            record_lookup(state, cfg, pos, dir);
+            return;
+        }
+        // The other initializations do not query the grid
+        if (msg.starts_with("Init")) {
+            reset();
+            return;
+        }
+
+        if (m_volume != vol_idx || m_bin >= m_records[vol_idx].size()) {
+            return;
+        }
+        if (state.is_on_sensitive() && state.barcode() != m_last_hit) {
+            m_last_hit = state.barcode();
+            ++m_records[vol_idx][m_bin].n_hits;
+        }
+    }
+
+    /// Inspector interface
+    template <typename state_type>
+    auto operator()(const state_type & /*state*/,
+                    const char * /*message*/) { /* Do nothing*/
+    }
+
+    /// Add the statistics that were gathered by @param other
+    void merge(const grid_heatmap_inspector &other) {
+        if (other.m_records.size() > m_records.size()) {
+            m_records.resize(other.m_records.size());
+        }
+        for (std::size_t i = 0u; i < other.m_records.size(); ++i) {
+            const auto &other_bins = other.m_records[i];
+            if (other_bins.size() > m_records[i].size()) {
+                m_records[i].resize(other_bins.size());
+            }
+            for (std::size_t b = 0u; b < other_bins.size(); ++b) {
+                m_records[i][b].n_lookups += other_bins[b].n_lookups;
+                m_records[i][b].n_candidates += other_bins[b].n_candidates;
+                m_records[i][b].n_hits += other_bins[b].n_hits;
+            }
+        }
+    }
+
+    /// @returns the statistics per volume index and global bin index (empty
+    /// for volumes without a surface grid)
+    const std::vector<std::vector<bin_record>> &records() const {
+        return m_records;
+    }
+
+    /// @returns the total statistics over all volumes and bins
+    bin_record total() const {
+        bin_record sum{};
+        for (const auto &bins : m_records) {
+            for (const auto &rec : bins) {
+                sum.n_lookups += rec.n_lookups;
+                sum.n_candidates += rec.n_candidates;
+                sum.n_hits += rec.n_hits;
+            }
+        }
+        return sum;
+    }
+
+    private:
+    /// Visitor that repeats the lookup of the navigator in a surface grid
+    struct grid_lookup {
+        template <typename group_t, typename index_t, typename detector_t,
+                  typename track_t>
+        auto operator()(const group_t &group, const index_t index,
+                        const detector_t &det,
+                        const typename detector_t::volume_type &vol_desc,
+                        const track_t &track,
+                        const navigation::config &cfg) const {
+
+            using accel_t = typename group_t::value_type;
+
+            dindex n_bins{0u};
+            dindex bin{dindex_invalid};
+            std::size_t n_candidates{0u};
+
+            if constexpr (concepts::grid<accel_t>) {
+                const typename detector_t::geometry_context ctx{};
+                const accel_t grid = group[index];
+
+                const auto &trf =
+                    det.transform_store().at(vol_desc.transform(), ctx);
+                const auto loc_pos =
+                    grid.project(trf, track.pos(), track.dir());
+
+                n_bins = grid.nbins();
+                bin = grid.serialize(grid.axes().bins(loc_pos));
+                for ([[maybe_unused]] const auto &sf_desc :
+                     grid.search(det, vol_desc, track, cfg, ctx)) {
+                    ++n_candidates;
+                }
+            }
+
+            return std::make_tuple(n_bins, bin, n_candidates);
+        }
+    };
+
+    /// Repeat the grid lookup of the volume initialization at @param pos
+    template <typename state_type, concepts::point3D point3_t,
+              concepts::vector3D vector3_t>
+    void record_lookup(const state_type &state, const navigation::config &cfg,
+                       const point3_t &pos, const vector3_t &dir) {
+
+        using detector_t = typename state_type::detector_type;
+        using algebra_t = typename detector_t::algebra_type;
+        using geo_obj_ids = typename detector_t::geo_obj_ids;
+
+        const detector_t &det = state.detector();
+        const auto &vol_desc = det.volume(state.volume());
+        const auto &link =
+            vol_desc.template accel_link<geo_obj_ids::e_sensitive>();
+        if (link.is_invalid()) {
+            return;
+        }
+
+        const detray::detail::ray<algebra_t> track{pos, 0.f, dir, 0.f};
+        const auto [n_bins, bin, n_candidates] =
+            det.accelerator_store().template visit<grid_lookup>(
+                link, det, vol_desc, track, cfg);
+
+        if (n_bins == 0u || bin >= n_bins) {
+            return;
+        }
+
+        const auto vol_idx{static_cast<std::size_t>(state.volume())};
+        if (vol_idx >= m_records.size()) {
+            m_records.resize(vol_idx + 1u);
+        }
+        if (m_records[vol_idx].size() < n_bins) {
+            m_records[vol_idx].resize(n_bins);
+        }
+
+        bin_record &rec = m_records[vol_idx][bin];
+        ++rec.n_lookups;
+        rec.n_candidates += n_candidates;
+
+        m_volume = vol_idx;
+        m_bin = bin;
+    }
+
+    /// Forget the last lookup
+    void reset() {
+        m_volume = dindex_invalid;
+        m_bin = dindex_invalid;
+        m_last_hit = {};
+    }
+
+    /// Statistics per volume and global bin index
+    std::vector<std::vector<bin_record>> m_records{};
+    /// Volume and bin of the last lookup
+    /// @{
+    std::size_t m_volume{dindex_invalid};
+    dindex m_bin{dindex_invalid};
+    /// @}
+    /// The last sensitive surface that was counted as hit
+    geometry::barcode m_last_hit{};
+};
+
 /// A navigation inspector that prints information about the current navigation
 /// state. Meant for debugging.
 struct print_inspector {
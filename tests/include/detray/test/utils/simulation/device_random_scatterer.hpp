@@ -0,0 +1,146 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/utils/geometry_utils.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/landau_distribution.hpp"
+#include "detray/test/utils/simulation/philox_engine.hpp"
+#include "detray/test/utils/simulation/random_scatterer.hpp"
+#include "detray/test/utils/simulation/scattering_helper.hpp"
+
+// System include(s).
+#include <cstdint>
+
+namespace detray {
+
+/// @brief Samples the energy loss and multiple scattering of a track at the
+/// material surfaces, on host or device
+///
+/// Same physics as the @c random_scatterer , but the random numbers are drawn
+/// from a counter-based engine in the actor state instead of a host std
+/// engine. Every track gets its own engine, which is set up from a common seed
+/// and the track index, so that the simulation of a track is reproducible
+/// independent of how the tracks are distributed over threads.
+template <concepts::algebra algebra_t>
+struct device_random_scatterer : actor {
+
+    using scalar_type = dscalar<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using engine_type = philox_engine;
+
+    struct state {
+        /// Random number engine of the track
+        engine_type generator{};
+
+        /// most probable energy loss
+        scalar_type e_loss_mpv = 0.f;
+
+        /// energy loss sigma
+        scalar_type e_loss_sigma = 0.f;
+
+        /// projected scattering angle
+        scalar_type projected_scattering_angle = 0.f;
+
+        // Simulation setup
+        bool do_energy_loss = true;
+        bool do_multiple_scattering = true;
+
+        /// Default seed
+        constexpr state() = default;
+
+        /// Constructor with the seed @param sd and the index of the track
+        /// @param track_idx , which selects the random number stream
+        DETRAY_HOST_DEVICE
+        constexpr explicit state(const std::uint64_t sd,
+                                 const std::uint64_t track_idx = 0u)
+            : generator{sd, track_idx} {}
+
+        DETRAY_HOST_DEVICE
+        constexpr void set_seed(const std::uint64_t sd,
+                                const std::uint64_t track_idx = 0u) {
+            generator.seed(sd, track_idx);
+        }
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state& simulator_state, propagator_state_t& prop_state) const {
+
+        using detector_type = typename propagator_state_t::detector_type;
+        using geo_context_type = typename detector_type::geometry_context;
+        using kernel_type = typename random_scatterer<algebra_t>::kernel;
+
+        auto& navigation = prop_state._navigation;
+
+        if (!navigation.encountered_sf_material()) {
+            return;
+        }
+
+        auto& stepping = prop_state._stepping;
+        const auto& ptc = stepping.particle_hypothesis();
+        auto& bound_params = stepping.bound_params();
+        const auto sf = navigation.get_surface();
+        const scalar_type cos_inc_angle{cos_angle(geo_context_type{}, sf,
+                                                  bound_params.dir(),
+                                                  bound_params.bound_local())};
+
+        const bool success = sf.template visit_material<kernel_type>(
+            simulator_state, ptc, bound_params, cos_inc_angle,
+            bound_params.bound_local()[0]);
+
+        if (success) {
+            auto& generator = simulator_state.generator;
+
+            // Get the new momentum
+            const scalar_type e_loss{
+                simulator_state.e_loss_mpv +
+                simulator_state.e_loss_sigma *
+                    landau_distribution<scalar_type>{}.quantile(
+                        detail::uniform_open<scalar_type>(generator))};
+
+            const scalar_type new_mom{random_scatterer<algebra_t>{}.attenuate(
+                e_loss, ptc.mass(), bound_params.p(ptc.charge()))};
+
+            // Update Qop
+            bound_params.set_qop(ptc.charge() / new_mom);
+
+            // Get the new direction from random scattering
+            const scalar_type scattering_angle{
+                constant<scalar_type>::sqrt2 *
+                simulator_state.projected_scattering_angle};
+
+            const scalar_type r_theta{
+                scattering_angle == scalar_type{0}
+                    ? 0.f
+                    : detail::normal_variate(generator, scalar_type{0.f},
+                                             scattering_angle)};
+            const scalar_type r_phi{
+                constant<scalar_type>::pi *
+                (2.f * detail::uniform_open<scalar_type>(generator) - 1.f)};
+
+            const vector3_type new_dir{scattering_helper<algebra_t>{}.deflect(
+                bound_params.dir(), r_theta, r_phi)};
+
+            // Update Phi and Theta
+            stepping.bound_params().set_phi(vector::phi(new_dir));
+            stepping.bound_params().set_theta(vector::theta(new_dir));
+
+            // Flag renavigation of the current candidate
+            prop_state._navigation.set_high_trust();
+        }
+    }
+};
+
+}  // namespace detray
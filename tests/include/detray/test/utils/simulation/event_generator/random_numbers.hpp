@@ -9,12 +9,18 @@
 
 // Project include(s)
 #include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
 
 // System include(s)
 #include <array>
+#include <cassert>
+#include <cstdint>
 #include <limits>
 #include <random>
+#include <type_traits>
 
 namespace detray::detail {
 
@@ -100,4 +106,157 @@ struct random_numbers {
     static constexpr seed_type default_seed() { return engine_t::default_seed; }
 };
 
+/// @returns the Philox4x32-10 block of random bits for the counter @param ctr
+/// and the key @param key
+/// @see J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+/// SC'11 (https://doi.org/10.1145/2063384.2063405)
+DETRAY_HOST_DEVICE constexpr darray<std::uint32_t, 4> philox4x32_10(
+    darray<std::uint32_t, 4> ctr, darray<std::uint32_t, 2> key) {
+
+    constexpr std::uint64_t m0{0xD2511F53u};
+    constexpr std::uint64_t m1{0xCD9E8D57u};
+    constexpr std::uint32_t w0{0x9E3779B9u};
+    constexpr std::uint32_t w1{0xBB67AE85u};
+
+    for (unsigned int r = 0u; r < 10u; ++r) {
+        const std::uint64_t p0{m0 * ctr[0]};
+        const std::uint64_t p1{m1 * ctr[2]};
+
+        ctr = {static_cast<std::uint32_t>(p1 >> 32u) ^ ctr[1] ^ key[0],
+               static_cast<std::uint32_t>(p1),
+               static_cast<std::uint32_t>(p0 >> 32u) ^ ctr[3] ^ key[1],
+               static_cast<std::uint32_t>(p0)};
+
+        key[0] += w0;
+        key[1] += w1;
+    }
+
+    return ctr;
+}
+
+/// @brief Counter based random number generation for the
+/// @c random_track_generator
+///
+/// The random numbers are a function of the seed, a stream index (e.g. the
+/// track index) and the number of draws in that stream (Philox4x32-10). The
+/// numbers of a stream can therefore be generated independently of all other
+/// streams, on any host thread or on device, and are still reproducible.
+template <concepts::scalar scalar_t,
+          typename distribution_t = std::uniform_real_distribution<scalar_t>>
+class counter_random_numbers {
+
+    public:
+    using distribution_type = distribution_t;
+    using seed_type = std::uint64_t;
+
+    /// Default seed
+    constexpr counter_random_numbers() = default;
+
+    /// Seed @param s and start at the beginning of the stream @param stream
+    DETRAY_HOST_DEVICE
+    explicit constexpr counter_random_numbers(const seed_type s,
+                                              const std::uint64_t stream = 0u)
+        : m_key{static_cast<std::uint32_t>(s),
+                static_cast<std::uint32_t>(s >> 32u)},
+          m_stream{stream} {}
+
+    /// @returns the index of the current stream
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t stream() const { return m_stream; }
+
+    /// Move to the beginning of the stream @param stream
+    DETRAY_HOST_DEVICE
+    constexpr void set_stream(const std::uint64_t stream) {
+        m_stream = stream;
+        m_block = 0u;
+        m_n_used = m_bits.size();
+    }
+
+    /// Generate random numbers in a given range
+    DETRAY_HOST_DEVICE constexpr scalar_t operator()(
+        const darray<scalar_t, 2> range = {
+            -std::numeric_limits<scalar_t>::max(),
+            std::numeric_limits<scalar_t>::max()}) {
+        const scalar_t min{range[0]};
+        const scalar_t max{range[1]};
+        assert(min <= max);
+
+        if constexpr (std::is_same_v<distribution_t,
+                                     std::normal_distribution<scalar_t>>) {
+            return normal(min + 0.5f * (max - min),
+                          0.5f / 3.0f * (max - min));
+        } else {
+            const scalar_t u{uniform()};
+            return (1.f - u) * min + u * max;
+        }
+    }
+
+    /// Explicit normal distribution around a @param mean and @param stddev
+    /// (Box-Muller transform)
+    DETRAY_HOST_DEVICE scalar_t normal(const scalar_t mean,
+                                       const scalar_t stddev) {
+        const scalar_t u1{uniform()};
+        const scalar_t u2{uniform()};
+
+        return mean + stddev * math::sqrt(-2.f * math::log(u1)) *
+                          math::cos(2.f * constant<scalar_t>::pi * u2);
+    }
+
+    /// 50:50 coin toss
+    DETRAY_HOST_DEVICE
+    constexpr std::uint8_t coin_toss() {
+        return static_cast<std::uint8_t>(next() & 1u);
+    }
+
+    /// Get the default seed (same as for the std engines)
+    DETRAY_HOST_DEVICE
+    static constexpr seed_type default_seed() { return 5489u; }
+
+    private:
+    /// @returns the next 32 random bits of the stream
+    DETRAY_HOST_DEVICE
+    constexpr std::uint32_t next() {
+        if (m_n_used == m_bits.size()) {
+            m_bits = philox4x32_10(
+                {static_cast<std::uint32_t>(m_block),
+                 static_cast<std::uint32_t>(m_block >> 32u),
+                 static_cast<std::uint32_t>(m_stream),
+                 static_cast<std::uint32_t>(m_stream >> 32u)},
+                m_key);
+            ++m_block;
+            m_n_used = 0u;
+        }
+        return m_bits[m_n_used++];
+    }
+
+    /// @returns a uniform random number in the open interval (0, 1)
+    DETRAY_HOST_DEVICE
+    constexpr scalar_t uniform() {
+        if constexpr (sizeof(scalar_t) <= sizeof(std::uint32_t)) {
+            // 24 bit mantissa
+            return (static_cast<scalar_t>(next() >> 8u) + 0.5f) *
+                   static_cast<scalar_t>(0x1p-24);
+        } else {
+            // 53 bit mantissa
+            const std::uint64_t hi{next() >> 5u};
+            const std::uint64_t lo{next() >> 6u};
+            return (static_cast<scalar_t>((hi << 26u) | lo) + 0.5) *
+                   static_cast<scalar_t>(0x1p-53);
+        }
+    }
+
+    /// Philox key, made from the seed
+    darray<std::uint32_t, 2> m_key{
+        static_cast<std::uint32_t>(default_seed()),
+        static_cast<std::uint32_t>(default_seed() >> 32u)};
+    /// Index of the current stream
+    std::uint64_t m_stream{0u};
+    /// Index of the next block of random bits in the stream
+    std::uint64_t m_block{0u};
+    /// Current block of random bits
+    darray<std::uint32_t, 4> m_bits{};
+    /// Number of random words already used from the current block
+    std::size_t m_n_used{4u};
+};
+
 }  // namespace detray::detail
@@ -20,9 +20,12 @@
 
 // System include(s)
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <random>
+#include <stdexcept>
 
 namespace detray {
 
@@ -39,6 +42,9 @@ namespace detray {
 /// generator, which must not be invalidated during the iteration.
 /// @note the random numbers are clamped to fit the phi/theta ranges. This can
 /// effect distribution mean etc.
+/// @note With a counter based random number generator (e.g.
+/// @c detail::counter_random_numbers ), the tracks do not depend on the order
+/// in which they are generated and can be obtained by index in parallel.
 template <typename track_t,
           typename generator_t =
               detail::random_numbers<dscalar<typename track_t::algebra_type>>>
@@ -51,6 +57,10 @@ class random_track_generator
     using point3_t = dpoint3D<algebra_t>;
     using vector3_t = dvector3D<algebra_t>;
 
+    /// Whether every track can be generated from its own random stream
+    static constexpr bool is_counter_based{
+        requires(generator_t gen) { gen.set_stream(std::size_t{}); }};
+
     public:
     using track_type = track_t;
 
@@ -105,42 +115,14 @@ class random_track_generator
                 throw std::invalid_argument("Invalid random number generator");
             }
 
-            const auto& ori = m_cfg.origin();
-            const auto& ori_stddev = m_cfg.origin_stddev();
-
-            const point3_t vtx =
-                m_cfg.do_vertex_smearing()
-                    ? point3_t{m_rnd_numbers->normal(ori[0], ori_stddev[0]),
-                               m_rnd_numbers->normal(ori[1], ori_stddev[1]),
-                               m_rnd_numbers->normal(ori[2], ori_stddev[2])}
-                    : point3_t{ori[0], ori[1], ori[2]};
-
-            scalar_t p_mag{(*m_rnd_numbers)(m_cfg.mom_range())};
-            scalar_t phi{(*m_rnd_numbers)(m_cfg.phi_range())};
-            scalar_t theta{(*m_rnd_numbers)(m_cfg.theta_range())};
-            scalar_t sin_theta{math::sin(theta)};
-
-            // Momentum direction from angles
-            vector3_t mom{math::cos(phi) * sin_theta,
-                          math::sin(phi) * sin_theta, math::cos(theta)};
-
-            if constexpr (std::is_same_v<track_t, detail::ray<algebra_t>>) {
-                mom = vector::normalize(mom);
+            if constexpr (is_counter_based) {
+                // Every track has its own stream of random numbers
+                generator_t rnd_numbers{*m_rnd_numbers};
+                rnd_numbers.set_stream(m_tracks);
+                return generate_track(rnd_numbers, m_cfg);
             } else {
-                sin_theta = (sin_theta == scalar_t{0.f})
-                                ? std::numeric_limits<scalar_t>::epsilon()
-                                : sin_theta;
-                mom = (m_cfg.is_pT() ? 1.f / sin_theta : 1.f) * p_mag *
-                      vector::normalize(mom);
+                return generate_track(*m_rnd_numbers, m_cfg);
             }
-
-            // Randomly flip the charge sign
-            darray<double, 2> signs{1., -1.};
-            const auto sign{static_cast<scalar_t>(
-                signs[m_cfg.randomize_charge() ? m_rnd_numbers->coin_toss()
-                                               : 0u])};
-
-            return track_t{vtx, m_cfg.time(), mom, sign * m_cfg.charge()};
         }
 
         /// Random number generator
@@ -153,12 +135,69 @@ class random_track_generator
         configuration m_cfg{};
     };
 
+    /// @returns a track instance with momentum and vertex drawn from the
+    /// random numbers @param rnd_numbers, according to the config @param cfg
+    DETRAY_HOST_DEVICE
+    static track_t generate_track(generator_t& rnd_numbers,
+                                  const configuration& cfg) {
+
+        const auto& ori = cfg.origin();
+        const auto& ori_stddev = cfg.origin_stddev();
+
+        const point3_t vtx =
+            cfg.do_vertex_smearing()
+                ? point3_t{rnd_numbers.normal(ori[0], ori_stddev[0]),
+                           rnd_numbers.normal(ori[1], ori_stddev[1]),
+                           rnd_numbers.normal(ori[2], ori_stddev[2])}
+                : point3_t{ori[0], ori[1], ori[2]};
+
+        scalar_t p_mag{rnd_numbers(cfg.mom_range())};
+        scalar_t phi{rnd_numbers(cfg.phi_range())};
+        scalar_t theta{rnd_numbers(cfg.theta_range())};
+        scalar_t sin_theta{math::sin(theta)};
+
+        // Momentum direction from angles
+        vector3_t mom{math::cos(phi) * sin_theta, math::sin(phi) * sin_theta,
+                      math::cos(theta)};
+
+        if constexpr (std::is_same_v<track_t, detail::ray<algebra_t>>) {
+            mom = vector::normalize(mom);
+        } else {
+            sin_theta = (sin_theta == scalar_t{0.f})
+                            ? std::numeric_limits<scalar_t>::epsilon()
+                            : sin_theta;
+            mom = (cfg.is_pT() ? 1.f / sin_theta : 1.f) * p_mag *
+                  vector::normalize(mom);
+        }
+
+        // Randomly flip the charge sign
+        darray<double, 2> signs{1., -1.};
+        const auto sign{static_cast<scalar_t>(
+            signs[cfg.randomize_charge() ? rnd_numbers.coin_toss() : 0u])};
+
+        return track_t{vtx, cfg.time(), mom, sign * cfg.charge()};
+    }
+
     std::shared_ptr<generator_t> m_gen{nullptr};
     configuration m_cfg{};
 
     public:
     using iterator_t = iterator;
 
+    /// @returns the track with index @param i for the configuration
+    /// @param cfg, which only depends on the seed and the index (needs a
+    /// counter based random number generator)
+    ///
+    /// @note Does not need a generator instance, so that e.g. a device kernel
+    /// can create its tracks in place from the configuration.
+    DETRAY_HOST_DEVICE
+    static track_t generate_track(const configuration& cfg, const std::size_t i)
+    requires is_counter_based {
+        assert(i < cfg.n_tracks());
+        generator_t rnd_numbers{cfg.seed(), i};
+        return generate_track(rnd_numbers, cfg);
+    }
+
     /// Default constructor
     constexpr random_track_generator() = default;
 
@@ -210,6 +249,14 @@ class random_track_generator
     constexpr auto size() const noexcept -> std::size_t {
         return m_cfg.n_tracks();
     }
+
+    /// @returns the track with index @param i, which only depends on the
+    /// seed and the index (needs a counter based random number generator)
+    ///
+    /// @note can be called concurrently for different tracks
+    DETRAY_HOST_DEVICE
+    track_t operator[](const std::size_t i) const
+    requires is_counter_based { return generate_track(m_cfg, i); }
 };
 
 }  // namespace detray
@@ -20,6 +20,9 @@
 
 // System include(s)
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 
@@ -35,6 +38,11 @@ namespace detray {
 /// the number of generated tracks) are configurable.
 ///
 /// @tparam track_t the type of track parametrization that should be used.
+/// @tparam generator_t source of random numbers for the charge flips
+///
+/// @note The tracks can also be obtained by index from the configuration
+/// alone (@see generate_track ), e.g. to create them directly in a device
+/// kernel.
 template <typename track_t,
           typename generator_t =
               detail::random_numbers<dscalar<typename track_t::algebra_type>>>
@@ -46,6 +54,10 @@ class uniform_track_generator
     using scalar_t = dscalar<algebra_t>;
     using vector3_t = dvector3D<algebra_t>;
 
+    /// Whether every track can be generated from its own random stream
+    static constexpr bool is_counter_based{
+        requires(generator_t gen) { gen.set_stream(std::size_t{}); }};
+
     public:
     using track_type = track_t;
 
@@ -148,35 +160,21 @@ class uniform_track_generator
                 throw std::invalid_argument("Invalid random number generator");
             }
 
-            scalar_t sin_theta{math::sin(m_theta)};
-
-            // Momentum direction from angles
-            vector3_t p{math::cos(m_phi) * sin_theta,
-                        math::sin(m_phi) * sin_theta, math::cos(m_theta)};
-
-            // Magnitude of momentum
-            if constexpr (std::is_same_v<track_t, detail::ray<algebra_t>>) {
-                p = vector::normalize(p);
-            } else {
-                sin_theta = (sin_theta == scalar_t{0.f})
-                                ? std::numeric_limits<scalar_t>::epsilon()
-                                : sin_theta;
-                p = (m_cfg.is_pT() ? 1.f / sin_theta : 1.f) * m_cfg.m_p_mag *
-                    vector::normalize(p);
+            // Randomly flip the charge sign
+            std::uint8_t flip{0u};
+            if (m_cfg.randomize_charge()) {
+                if constexpr (is_counter_based) {
+                    // Same charge as for the track obtained by index
+                    generator_t rnd_numbers{*m_rnd_numbers};
+                    rnd_numbers.set_stream(i_theta * m_cfg.phi_steps() +
+                                           i_phi - 1u);
+                    flip = rnd_numbers.coin_toss();
+                } else {
+                    flip = m_rnd_numbers->coin_toss();
+                }
             }
 
-            const auto& ori = m_cfg.origin();
-
-            // Randomly flip the charge sign
-            darray<double, 2> signs{1., -1.};
-            const auto sign{static_cast<scalar_t>(
-                signs[m_cfg.randomize_charge() ? m_rnd_numbers->coin_toss()
-                                               : 0u])};
-
-            return track_t{{ori[0], ori[1], ori[2]},
-                           m_cfg.time(),
-                           p,
-                           sign * m_cfg.charge()};
+            return build_track(m_cfg, m_phi, m_theta, flip);
         }
 
         /// Random number generator
@@ -197,14 +195,46 @@ class uniform_track_generator
         /// Iteration indices
         std::size_t i_phi{0u};
         std::size_t i_theta{0u};
+    };
 
-        private:
-        /// @returns the theta angle for a given @param eta value
-        DETRAY_HOST_DEVICE
-        scalar_t get_theta(const scalar_t eta) {
-            return 2.f * math::atan(math::exp(-eta));
+    /// @returns the theta angle for a given @param eta value
+    DETRAY_HOST_DEVICE
+    static scalar_t get_theta(const scalar_t eta) {
+        return 2.f * math::atan(math::exp(-eta));
+    }
+
+    /// @returns a track with the momentum direction given by the angles
+    /// @param phi and @param theta, with the charge sign flipped if
+    /// @param flip is set
+    DETRAY_HOST_DEVICE
+    static track_t build_track(const configuration& cfg, const scalar_t phi,
+                               const scalar_t theta, const std::uint8_t flip) {
+
+        scalar_t sin_theta{math::sin(theta)};
+
+        // Momentum direction from angles
+        vector3_t p{math::cos(phi) * sin_theta, math::sin(phi) * sin_theta,
+                    math::cos(theta)};
+
+        // Magnitude of momentum
+        if constexpr (std::is_same_v<track_t, detail::ray<algebra_t>>) {
+            p = vector::normalize(p);
+        } else {
+            sin_theta = (sin_theta == scalar_t{0.f})
+                            ? std::numeric_limits<scalar_t>::epsilon()
+                            : sin_theta;
+            p = (cfg.is_pT() ? 1.f / sin_theta : 1.f) * cfg.m_p_mag *
+                vector::normalize(p);
         }
-    };
+
+        const auto& ori = cfg.origin();
+
+        darray<double, 2> signs{1., -1.};
+        const auto sign{static_cast<scalar_t>(signs[flip])};
+
+        return track_t{
+            {ori[0], ori[1], ori[2]}, cfg.time(), p, sign * cfg.charge()};
+    }
 
     std::shared_ptr<generator_t> m_gen{
         std::make_shared<generator_t>(configuration{}.seed())};
@@ -213,6 +243,61 @@ class uniform_track_generator
     public:
     using iterator_t = iterator;
 
+    /// @returns the track with index @param i for the configuration
+    /// @param cfg, where the phi steps are the inner loop, like during the
+    /// iteration
+    ///
+    /// @note Does not need a generator instance, so that e.g. a device kernel
+    /// can create its tracks in place from the configuration. Randomized
+    /// charges need a counter based random number generator.
+    DETRAY_HOST_DEVICE
+    static track_t generate_track(const configuration& cfg,
+                                  const std::size_t i) {
+        assert(i < cfg.n_tracks());
+
+        const std::size_t i_phi{i % cfg.phi_steps()};
+        const std::size_t i_theta{i / cfg.phi_steps()};
+
+        // Same step sizes as during the iteration
+        const scalar_t phi_step_size{
+            (cfg.phi_range()[1] - cfg.phi_range()[0]) /
+            static_cast<scalar_t>(cfg.phi_steps())};
+        const scalar_t phi{cfg.phi_range()[0] +
+                           static_cast<scalar_t>(i_phi) * phi_step_size};
+
+        scalar_t theta{0.f};
+        if (cfg.uniform_eta()) {
+            const scalar_t eta_step_size{
+                (cfg.eta_range()[1] - cfg.eta_range()[0]) /
+                static_cast<scalar_t>(cfg.eta_steps() - 1u)};
+            theta = get_theta(
+                (i_theta == 0u) ? cfg.eta_range()[0]
+                                : cfg.eta_range()[0] +
+                                      static_cast<scalar_t>(i_theta) *
+                                          eta_step_size);
+        } else {
+            const scalar_t theta_step_size{
+                (cfg.theta_range()[1] - cfg.theta_range()[0]) /
+                static_cast<scalar_t>(cfg.theta_steps() - 1u)};
+            theta = (i_theta == 0u) ? cfg.theta_range()[0]
+                                    : cfg.theta_range()[0] +
+                                          static_cast<scalar_t>(i_theta) *
+                                              theta_step_size;
+        }
+
+        // Randomly flip the charge sign
+        std::uint8_t flip{0u};
+        if constexpr (is_counter_based) {
+            if (cfg.randomize_charge()) {
+                flip = generator_t{cfg.seed(), i}.coin_toss();
+            }
+        } else {
+            assert(!cfg.randomize_charge());
+        }
+
+        return build_track(cfg, phi, theta, flip);
+    }
+
     /// Default constructor
     constexpr uniform_track_generator() = default;
 
@@ -278,6 +363,12 @@ class uniform_track_generator
     constexpr auto size() const noexcept -> std::size_t {
         return m_cfg.phi_steps() * m_cfg.theta_steps();
     }
+
+    /// @returns the track with index @param i (@see generate_track )
+    DETRAY_HOST_DEVICE
+    track_t operator[](const std::size_t i) const {
+        return generate_track(m_cfg, i);
+    }
 };
 
 }  // namespace detray
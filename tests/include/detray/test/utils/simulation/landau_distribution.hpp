@@ -10,6 +10,7 @@
 // Project include(s).
 #include "detray/definitions/algebra.hpp"
 #include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/math.hpp"
 
 // System include(s).
@@ -50,10 +51,16 @@ class landau_distribution {
         return location + scale * quantile(z);
     }
 
-    private:
+    /// @returns the quantile of the standard Landau distribution for the
+    /// probability @param z , i.e. a Landau distributed random number if
+    /// @param z is uniformly distributed in (0, 1)
+    ///
+    /// @note Does not depend on a host random engine, so that it can be used
+    /// for the sampling on device (e.g. with the @c philox_engine )
+    DETRAY_HOST_DEVICE
     scalar_type quantile(const scalar_type z) const {
 
-        static const darray<double, 982> f{
+        static constexpr darray<double, 982> f{
             0.,        0.,        0.,        0.,        0.,        -2.244733,
             -2.204365, -2.168163, -2.135219, -2.104898, -2.076740, -2.050397,
             -2.025605, -2.002150, -1.979866, -1.958612, -1.938275, -1.918760,
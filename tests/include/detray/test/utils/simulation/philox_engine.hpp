@@ -0,0 +1,187 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/units.hpp"
+
+// System include(s).
+#include <cstdint>
+
+namespace detray {
+
+/// @brief Counter-based random number engine (Philox4x32-10)
+///
+/// The random numbers are a keyed bijection of a counter, see J. K. Salmon
+/// et al., "Parallel random numbers: as easy as 1, 2, 3", SC11. The engine
+/// state is only the key, the counter and the current output block (44 bytes),
+/// and it needs no global tables. Every track can therefore carry its own
+/// engine in device memory: The seed is the key and the track index selects an
+/// independent stream (the upper half of the counter).
+///
+/// @note Satisfies the requirements of a uniform random bit generator, so that
+/// it can be used with the std distributions on the host as well.
+class philox_engine {
+
+    public:
+    using result_type = std::uint32_t;
+    using block_type = darray<std::uint32_t, 4>;
+    using key_type = darray<std::uint32_t, 2>;
+
+    /// Default seed and stream
+    constexpr philox_engine() = default;
+
+    /// Construct the engine for the stream @param stream (e.g. the track
+    /// index) from the seed @param sd
+    DETRAY_HOST_DEVICE
+    constexpr explicit philox_engine(const std::uint64_t sd,
+                                     const std::uint64_t stream = 0u) {
+        seed(sd, stream);
+    }
+
+    /// @returns the smallest value the engine can produce
+    DETRAY_HOST_DEVICE
+    static constexpr result_type min() { return 0u; }
+
+    /// @returns the largest value the engine can produce
+    DETRAY_HOST_DEVICE
+    static constexpr result_type max() { return 0xffffffffu; }
+
+    /// Reset the engine to the start of the stream @param stream of the
+    /// seed @param sd
+    DETRAY_HOST_DEVICE
+    constexpr void seed(const std::uint64_t sd,
+                        const std::uint64_t stream = 0u) {
+        m_key = {low_word(sd), high_word(sd)};
+        m_counter = {0u, 0u, low_word(stream), high_word(stream)};
+        m_pos = 4u;
+    }
+
+    /// @returns the next random number
+    DETRAY_HOST_DEVICE
+    constexpr result_type operator()() {
+        if (m_pos == 4u) {
+            m_block = generate(m_counter, m_key);
+            increment();
+            m_pos = 0u;
+        }
+        return m_block[m_pos++];
+    }
+
+    /// Skip the next @param n random numbers
+    DETRAY_HOST_DEVICE
+    constexpr void discard(std::uint64_t n) {
+        // Use up the current block
+        while (n > 0u && m_pos < 4u) {
+            ++m_pos;
+            --n;
+        }
+        // Jump over whole blocks
+        const std::uint64_t n_blocks{n / 4u};
+        const std::uint64_t ctr{
+            (static_cast<std::uint64_t>(m_counter[1]) << 32u | m_counter[0]) +
+            n_blocks};
+        m_counter[0] = low_word(ctr);
+        m_counter[1] = high_word(ctr);
+
+        for (n %= 4u; n > 0u; --n) {
+            (*this)();
+        }
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const philox_engine &rhs) const = default;
+
+    /// @returns the output block for the counter @param ctr and the key
+    /// @param key (ten rounds of the Philox bijection)
+    DETRAY_HOST_DEVICE
+    static constexpr block_type generate(block_type ctr, key_type key) {
+        for (unsigned int r = 0u; r < 10u; ++r) {
+            if (r > 0u) {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            const std::uint64_t prod0{static_cast<std::uint64_t>(0xD2511F53u) *
+                                      ctr[0]};
+            const std::uint64_t prod1{static_cast<std::uint64_t>(0xCD9E8D57u) *
+                                      ctr[2]};
+
+            ctr = {high_word(prod1) ^ ctr[1] ^ key[0], low_word(prod1),
+                   high_word(prod0) ^ ctr[3] ^ key[1], low_word(prod0)};
+        }
+        return ctr;
+    }
+
+    private:
+    /// @returns the lower 32 bits of @param w
+    DETRAY_HOST_DEVICE
+    static constexpr std::uint32_t low_word(const std::uint64_t w) {
+        return static_cast<std::uint32_t>(w & 0xffffffffu);
+    }
+
+    /// @returns the upper 32 bits of @param w
+    DETRAY_HOST_DEVICE
+    static constexpr std::uint32_t high_word(const std::uint64_t w) {
+        return static_cast<std::uint32_t>(w >> 32u);
+    }
+
+    /// Advance the counter of the stream by one block
+    DETRAY_HOST_DEVICE
+    constexpr void increment() {
+        if (++m_counter[0] == 0u) {
+            ++m_counter[1];
+        }
+    }
+
+    /// Key (seed) and counter (block index and stream)
+    key_type m_key{0u, 0u};
+    block_type m_counter{0u, 0u, 0u, 0u};
+    /// Output block and position of the next number in it
+    block_type m_block{0u, 0u, 0u, 0u};
+    std::uint32_t m_pos{4u};
+};
+
+namespace detail {
+
+/// @returns a uniformly distributed random number in the open interval (0, 1)
+/// that is drawn from the engine @param engine
+template <concepts::scalar scalar_t, typename engine_t>
+DETRAY_HOST_DEVICE constexpr scalar_t uniform_open(engine_t &engine) {
+    if constexpr (sizeof(scalar_t) <= sizeof(std::uint32_t)) {
+        // 24 bits of mantissa, centered in the interval
+        const auto bits{static_cast<std::uint32_t>(engine()) >> 8u};
+        return (static_cast<scalar_t>(bits) + 0.5f) * 0x1p-24f;
+    } else {
+        // 53 bits of mantissa from two numbers
+        const auto hi{static_cast<std::uint64_t>(engine()) >> 5u};
+        const auto lo{static_cast<std::uint64_t>(engine()) >> 6u};
+        return (static_cast<scalar_t>(hi << 26u | lo) + 0.5) * 0x1p-53;
+    }
+}
+
+/// @returns a normally distributed random number with mean @param mean and
+/// standard deviation @param sigma (Box-Muller transform)
+template <concepts::scalar scalar_t, typename engine_t>
+DETRAY_HOST_DEVICE constexpr scalar_t normal_variate(engine_t &engine,
+                                                     const scalar_t mean,
+                                                     const scalar_t sigma) {
+    const scalar_t u1{uniform_open<scalar_t>(engine)};
+    const scalar_t u2{uniform_open<scalar_t>(engine)};
+
+    return mean + sigma * math::sqrt(-2.f * math::log(u1)) *
+                      math::cos(2.f * constant<scalar_t>::pi * u2);
+}
+
+}  // namespace detail
+
+}  // namespace detray
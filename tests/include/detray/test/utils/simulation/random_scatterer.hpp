@@ -67,11 +67,13 @@ struct random_scatterer : actor {
     /// Material store visitor
     struct kernel {
 
-        template <typename mat_group_t, typename index_t>
+        /// @tparam state_t the actor state that receives the sampling
+        /// parameters (host or device scatterer)
+        template <typename mat_group_t, typename index_t, typename state_t>
         DETRAY_HOST_DEVICE inline bool operator()(
             [[maybe_unused]] const mat_group_t& material_group,
             [[maybe_unused]] const index_t& mat_index,
-            [[maybe_unused]] typename random_scatterer::state& s,
+            [[maybe_unused]] state_t& s,
             [[maybe_unused]] const pdg_particle<scalar_type>& ptc,
             [[maybe_unused]] const bound_track_parameters<algebra_t>&
                 bound_params,
@@ -190,6 +192,15 @@ struct random_scatterer : actor {
         const auto e_loss =
             landau_distribution<scalar_type>{}(generator, mpv, sigma);
 
+        return attenuate(e_loss, m0, p0);
+    }
+
+    /// @brief Get the new momentum after the energy loss @param e_loss of a
+    /// particle with mass @param m0 and momentum @param p0
+    DETRAY_HOST_DEVICE inline scalar_type attenuate(
+        const scalar_type e_loss, const scalar_type m0,
+        const scalar_type p0) const {
+
         // E = sqrt(m^2 + p^2)
         const auto energy = math::sqrt(m0 * m0 + p0 * p0);
         const auto new_energy = energy - e_loss;
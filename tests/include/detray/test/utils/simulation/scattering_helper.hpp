@@ -45,12 +45,25 @@ struct scattering_helper {
         const scalar_type r_phi{std::uniform_real_distribution<scalar_type>(
             -constant<scalar_type>::pi, constant<scalar_type>::pi)(generator)};
 
+        return deflect(dir, r_theta, r_phi);
+    }
+
+    /// @brief Deflect the direction by sampled angles
+    ///
+    /// @param dir  input direction
+    /// @param theta  polar deflection angle
+    /// @param phi  azimuthal angle of the deflection around @param dir
+    /// @returns the new direction
+    DETRAY_HOST_DEVICE inline vector3_type deflect(
+        const vector3_type& dir, const scalar_type theta,
+        const scalar_type phi) const {
+
         // xaxis of curvilinear plane
         const vector3_type u =
             unit_vectors<vector3_type>().make_curvilinear_unit_u(dir);
 
-        vector3_type new_dir = axis_rotation<algebra_t>(u, r_theta)(dir);
-        return axis_rotation<algebra_t>(dir, r_phi)(new_dir);
+        vector3_type new_dir = axis_rotation<algebra_t>(u, theta)(dir);
+        return axis_rotation<algebra_t>(dir, phi)(new_dir);
     }
 };
 
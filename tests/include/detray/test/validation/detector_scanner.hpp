@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/definitions/algebra.hpp"
+#include "detray/geometry/detail/surface_kernels.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
@@ -17,14 +18,24 @@
 #include "detray/tracks/trajectories.hpp"
 
 // Detray IO include(s)
+#include "detray/io/csv/async_writer.hpp"
 #include "detray/io/csv/intersection2D.hpp"
 #include "detray/io/csv/track_parameters.hpp"
+#include "detray/io/utils/create_path.hpp"
 
 // System include(s)
 #include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 namespace detray {
 
@@ -59,6 +70,9 @@ struct brute_force_scan {
 
     template <typename D>
     using intersection_trace_type = std::vector<intersection_record<D>>;
+    template <typename D>
+    using intersection_type =
+        typename intersection_record<D>::intersection_type;
     using trajectory_type = trajectory_t;
 
     template <typename detector_t>
@@ -70,24 +84,50 @@ struct brute_force_scan {
                                1.f *
                                unit<typename detector_t::scalar_type>::GeV) {
 
+        intersection_trace_type<detector_t> intersection_trace;
+
+        std::vector<intersection_type<detector_t>> intersections{};
+        intersections.reserve(100u);
+
+        scan(ctx, detector, traj, intersection_trace, intersections,
+             mask_tolerance, p);
+
+        return intersection_trace;
+    }
+
+    /// Record the intersections along @param traj in @param intersection_trace
+    ///
+    /// The caller provides the containers, so that their memory can be reused
+    /// between trajectories.
+    ///
+    /// @param intersections buffer for the intersections of a single surface
+    template <typename detector_t>
+    inline void scan(
+        const typename detector_t::geometry_context ctx,
+        const detector_t &detector, const trajectory_t &traj,
+        intersection_trace_type<detector_t> &intersection_trace,
+        std::vector<intersection_type<detector_t>> &intersections,
+        const darray<typename detector_t::scalar_type, 2> mask_tolerance =
+            {0.f, 0.f},
+        const typename detector_t::scalar_type p =
+            1.f * unit<typename detector_t::scalar_type>::GeV) const {
+
         using algebra_t = typename detector_t::algebra_type;
         using scalar_t = dscalar<algebra_t>;
         using sf_desc_t = typename detector_t::surface_type;
         using nav_link_t = typename detector_t::surface_type::navigation_link;
 
-        using intersection_t = intersection2D<sf_desc_t, algebra_t, true>;
+        using intersection_t = intersection_type<detector_t>;
         using intersection_kernel_t = intersection_initialize<intersector>;
 
-        intersection_trace_type<detector_t> intersection_trace;
+        intersection_trace.clear();
+        intersections.clear();
 
         const auto &trf_store = detector.transform_store();
 
         assert(p > 0.f);
         const scalar_t q{p * traj.qop()};
 
-        std::vector<intersection_t> intersections{};
-        intersections.reserve(100u);
-
         // Loop over all surfaces in the detector
         for (const sf_desc_t &sf_desc : detector.surfaces()) {
             // Retrieve candidate(s) from the surface
@@ -137,8 +177,6 @@ struct brute_force_scan {
                                       {traj.pos(), 0.f, p * traj.dir(), q},
                                       first_record.vol_idx,
                                       start_intersection});
-
-        return intersection_trace;
     }
 };
 
@@ -151,18 +189,10 @@ using helix_scan = brute_force_scan<detail::helix<algebra_t>>;
 /// Run a scan on detector object by shooting test particles through it
 namespace detector_scanner {
 
-template <template <typename> class scan_type, typename detector_t,
-          typename trajectory_t, typename... Args>
-inline auto run(const typename detector_t::geometry_context gctx,
-                const detector_t &detector, const trajectory_t &traj,
-                Args &&... args) {
-
-    using algebra_t = typename detector_t::algebra_type;
-
-    auto intersection_record = scan_type<algebra_t>{}(
-        gctx, detector, traj, std::forward<Args>(args)...);
-
-    using record_t = typename decltype(intersection_record)::value_type;
+/// Sort the @param intersection_record by distance to the origin of the
+/// trajectory and remove everything beyond the world portal
+template <typename record_t>
+inline void finalize_trace(std::vector<record_t> &intersection_record) {
 
     // Sort intersections by distance to origin of the trajectory
     auto sort_path = [&](const record_t &a, const record_t &b) -> bool {
@@ -183,10 +213,203 @@ inline auto run(const typename detector_t::geometry_context gctx,
         auto n{static_cast<std::size_t>(it - intersection_record.begin())};
         intersection_record.resize(n + 1u);
     }
+}
+
+template <template <typename> class scan_type, typename detector_t,
+          typename trajectory_t, typename... Args>
+inline auto run(const typename detector_t::geometry_context gctx,
+                const detector_t &detector, const trajectory_t &traj,
+                Args &&... args) {
+
+    using algebra_t = typename detector_t::algebra_type;
+
+    auto intersection_record = scan_type<algebra_t>{}(
+        gctx, detector, traj, std::forward<Args>(args)...);
+
+    finalize_trace(intersection_record);
 
     return intersection_record;
 }
 
+/// @brief Writes intersection traces to file one trace at a time
+///
+/// Produces the same files as @c write_intersections and @c write_tracks
+/// without having to keep all traces in memory. The records are formatted and
+/// written to disk in background threads (@see io::csv::async_writer ), the
+/// binary columnar output can be read with @c io::csv::read_columnar .
+template <typename detector_t>
+class trace_writer {
+
+    using record_t = intersection_record<detector_t>;
+
+    using inters_writer_t = io::csv::async_writer<io::csv::intersection2D>;
+    using track_param_writer_t =
+        io::csv::async_writer<io::csv::free_track_parameters>;
+
+    public:
+    /// Open the files @param intersection_file_name and
+    /// @param track_param_file_name (existing files are replaced) in the
+    /// output format @param format
+    trace_writer(const std::string &intersection_file_name,
+                 const std::string &track_param_file_name,
+                 const io::csv::output_format format = {})
+        : m_inters_writer(prepare(intersection_file_name), format),
+          m_track_param_writer(prepare(track_param_file_name), format),
+          m_inters_buffer(m_inters_writer.make_buffer()),
+          m_track_param_buffer(m_track_param_writer.make_buffer()) {}
+
+    /// Append the @param trace of the track @param trk_idx to the files
+    void write(const unsigned int trk_idx, const std::vector<record_t> &trace) {
+        for (const auto &record : trace) {
+            m_inters_buffer.append(
+                io::csv::make_intersection2D(trk_idx, record.intersection));
+            m_track_param_buffer.append(io::csv::make_free_track_params(
+                trk_idx, record.charge, record.track_param));
+        }
+    }
+
+    /// Wait until all records are written to disk
+    ///
+    /// @throws std::runtime_error if the data could not be written
+    void flush() {
+        m_inters_buffer.flush();
+        m_track_param_buffer.flush();
+        m_inters_writer.flush();
+        m_track_param_writer.flush();
+    }
+
+    private:
+    /// Make sure the output directory of @param file_name exists
+    static const std::string &prepare(const std::string &file_name) {
+        io::create_path(std::filesystem::path{file_name}.parent_path());
+        return file_name;
+    }
+
+    inters_writer_t m_inters_writer;
+    track_param_writer_t m_track_param_writer;
+    typename inters_writer_t::buffer m_inters_buffer;
+    typename track_param_writer_t::buffer m_track_param_buffer;
+};
+
+/// Configuration of a streaming scan (@see run_to_file )
+struct streaming_config {
+    /// Number of threads the trajectories of a batch are distributed over
+    std::size_t n_threads{1u};
+    /// Number of trajectories that are kept in memory before they are written
+    std::size_t batch_size{1000u};
+    /// Format of the output files
+    io::csv::output_format format{io::csv::output_format::e_csv};
+};
+
+/// Summary of a streaming scan
+struct streaming_result {
+    /// Number of traces that were written
+    std::size_t n_traces{0u};
+    /// Number of intersection records that were written
+    std::size_t n_records{0u};
+};
+
+/// Scan all trajectories of @param trajectories and stream the traces to the
+/// files @param intersection_file_name and @param track_param_file_name
+///
+/// The trajectories are processed in batches: The trajectories of a batch are
+/// distributed over several threads and the resulting traces are handed to
+/// the background writers, which write them to disk while the next batch is
+/// scanned. The traces and intersection buffers
+/// are reused between the batches, so that the memory consumption does not
+/// depend on the number of trajectories. The output is the same as that of
+/// @c write_intersections and @c write_tracks for the traces of @c run .
+template <template <typename> class scan_type, typename detector_t,
+          typename trajectory_range_t>
+inline auto run_to_file(
+    const typename detector_t::geometry_context gctx,
+    const detector_t &detector, trajectory_range_t &&trajectories,
+    const std::string &intersection_file_name,
+    const std::string &track_param_file_name,
+    const streaming_config &cfg = {},
+    const darray<typename detector_t::scalar_type, 2> mask_tolerance = {0.f,
+                                                                        0.f},
+    const typename detector_t::scalar_type p =
+        1.f * unit<typename detector_t::scalar_type>::GeV) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using scan_t = scan_type<algebra_t>;
+    using trajectory_t = typename scan_t::trajectory_type;
+    using trace_t =
+        typename scan_t::template intersection_trace_type<detector_t>;
+    using intersection_t =
+        typename scan_t::template intersection_type<detector_t>;
+
+    const std::size_t n_threads{std::max(std::size_t{1u}, cfg.n_threads)};
+    const std::size_t batch_size{std::max(std::size_t{1u}, cfg.batch_size)};
+
+    trace_writer<detector_t> writer(intersection_file_name,
+                                    track_param_file_name, cfg.format);
+
+    // Buffers that are reused for every batch
+    std::vector<trajectory_t> batch;
+    batch.reserve(batch_size);
+    std::vector<trace_t> traces(batch_size);
+    std::vector<std::vector<intersection_t>> candidates(n_threads);
+    std::vector<std::exception_ptr> errors(n_threads);
+
+    auto scan_shard = [&](const std::size_t shard) {
+        try {
+            for (std::size_t i = shard; i < batch.size(); i += n_threads) {
+                scan_t{}.scan(gctx, detector, batch[i], traces[i],
+                              candidates[shard], mask_tolerance, p);
+                finalize_trace(traces[i]);
+            }
+        } catch (...) {
+            errors[shard] = std::current_exception();
+        }
+    };
+
+    streaming_result result{};
+
+    auto process_batch = [&]() {
+        if (n_threads == 1u) {
+            scan_shard(0u);
+        } else {
+            std::vector<std::thread> workers;
+            workers.reserve(n_threads);
+            for (std::size_t shard = 0u; shard < n_threads; ++shard) {
+                workers.emplace_back(scan_shard, shard);
+            }
+            for (auto &w : workers) {
+                w.join();
+            }
+        }
+        for (const auto &err : errors) {
+            if (err) {
+                std::rethrow_exception(err);
+            }
+        }
+
+        // Write the batch in order of the trajectories
+        for (std::size_t i = 0u; i < batch.size(); ++i) {
+            writer.write(static_cast<unsigned int>(result.n_traces),
+                         traces[i]);
+            result.n_records += traces[i].size();
+            ++result.n_traces;
+        }
+        batch.clear();
+    };
+
+    for (const auto &traj : trajectories) {
+        batch.push_back(trajectory_t(traj));
+        if (batch.size() == batch_size) {
+            process_batch();
+        }
+    }
+    if (!batch.empty()) {
+        process_batch();
+    }
+    writer.flush();
+
+    return result;
+}
+
 /// Write the @param intersection_traces to file
 template <typename detector_t>
 inline auto write_intersections(
@@ -297,6 +520,150 @@ inline auto read(const std::string &intersection_file_name,
     }
 }
 
+/// @returns a hash per volume of the detector @param det in the geometry
+/// context @param gctx, which covers the placements, mask boundaries and
+/// volume links of all surfaces in the volume, i.e. the data that decides
+/// which surfaces a ray or helix scan finds
+template <typename detector_t>
+inline std::vector<std::size_t> volume_hashes(
+    const detector_t &det, const typename detector_t::geometry_context gctx) {
+
+    using scalar_t = dscalar<typename detector_t::algebra_type>;
+    using sf_kernels =
+        detray::detail::surface_kernels<typename detector_t::algebra_type>;
+
+    std::vector<std::size_t> hashes(det.volumes().size(), 0u);
+
+    auto hash_combine = [](std::size_t &seed, const std::size_t h) {
+        seed ^= h + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    };
+    auto hash_vector = [&hash_combine](std::size_t &seed, const auto &v) {
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            hash_combine(seed, std::hash<scalar_t>{}(v[i]));
+        }
+    };
+
+    for (const auto &sf_desc : det.surfaces()) {
+        const geometry::surface sf{det, sf_desc};
+
+        std::size_t &seed = hashes.at(sf.volume());
+
+        hash_combine(seed, std::hash<geometry::barcode>{}(sf.barcode()));
+        hash_combine(seed, static_cast<std::size_t>(sf.shape_id()));
+        hash_combine(seed, static_cast<std::size_t>(sf.volume_link()));
+
+        const auto &trf = sf.transform(gctx);
+        hash_vector(seed, trf.translation());
+        hash_vector(seed, trf.x());
+        hash_vector(seed, trf.z());
+
+        for (const scalar_t v :
+             sf.template visit_mask<typename sf_kernels::get_mask_values>()) {
+            hash_combine(seed, std::hash<scalar_t>{}(v));
+        }
+    }
+
+    return hashes;
+}
+
+/// Write the volume hashes @param hashes to the csv file @param file_name
+inline void write_volume_hashes(const std::string &file_name,
+                                const std::vector<std::size_t> &hashes) {
+
+    io::create_path(std::filesystem::path{file_name}.parent_path());
+
+    std::ofstream file{file_name, std::ios::out | std::ios::trunc};
+    if (!file) {
+        throw std::invalid_argument("Could not open file: " + file_name);
+    }
+
+    file << "volume,hash" << std::endl;
+    for (std::size_t i = 0u; i < hashes.size(); ++i) {
+        file << i << "," << hashes[i] << std::endl;
+    }
+}
+
+/// @returns the volume hashes read from the csv file @param file_name
+inline std::vector<std::size_t> read_volume_hashes(
+    const std::string &file_name) {
+
+    std::ifstream file{file_name};
+    if (!file) {
+        throw std::invalid_argument("Could not open file: " + file_name);
+    }
+
+    std::vector<std::size_t> hashes{};
+
+    std::string line;
+    // Skip the header
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        std::size_t vol_idx{0u};
+        std::size_t hash{0u};
+        char sep{};
+
+        std::istringstream row{line};
+        if (!(row >> vol_idx >> sep >> hash) || vol_idx != hashes.size()) {
+            throw std::invalid_argument("Malformed volume hash file: " +
+                                        file_name);
+        }
+        hashes.push_back(hash);
+    }
+
+    return hashes;
+}
+
+/// @returns the indices of the volumes in @param det whose hash differs
+/// between @param old_hashes and @param new_hashes, together with their
+/// neighbours, since a change of the volume extent also changes what the
+/// scan finds in the adjacent volumes. If the number of volumes changed, all
+/// volumes are returned.
+template <typename detector_t>
+inline std::unordered_set<dindex> changed_volumes(
+    const detector_t &det, const std::vector<std::size_t> &old_hashes,
+    const std::vector<std::size_t> &new_hashes) {
+
+    std::unordered_set<dindex> changed{};
+
+    if (old_hashes.size() != new_hashes.size()) {
+        for (dindex i = 0u; i < new_hashes.size(); ++i) {
+            changed.insert(i);
+        }
+        return changed;
+    }
+
+    for (dindex i = 0u; i < new_hashes.size(); ++i) {
+        if (old_hashes[i] != new_hashes[i]) {
+            changed.insert(i);
+        }
+    }
+
+    // Add the neighbours of the changed volumes
+    std::unordered_set<dindex> neighbours{};
+    for (const auto &sf_desc : det.surfaces()) {
+        const geometry::surface sf{det, sf_desc};
+        if (!sf.is_portal()) {
+            continue;
+        }
+
+        // Also skips the invalid links of the world portals
+        const dindex vol_link{static_cast<dindex>(sf.volume_link())};
+        if (vol_link >= det.volumes().size()) {
+            continue;
+        }
+
+        if (changed.contains(sf.volume())) {
+            neighbours.insert(vol_link);
+        }
+        if (changed.contains(vol_link)) {
+            neighbours.insert(sf.volume());
+        }
+    }
+    changed.merge(neighbours);
+
+    return changed;
+}
+
 }  // namespace detector_scanner
 
 }  // namespace detray
@@ -22,7 +22,16 @@
 #include "detray/io/utils/file_handle.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace detray::material_validator {
 
@@ -102,6 +111,149 @@ struct get_material_params {
     }
 };
 
+/// @brief Functor to retrieve the global bin of the surface material for a
+/// given local position (always zero for homogeneous material)
+struct get_material_bin {
+
+    template <typename mat_group_t, typename index_t,
+              concepts::point2D point2_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        [[maybe_unused]] const mat_group_t &mat_group,
+        [[maybe_unused]] const index_t &index,
+        [[maybe_unused]] const point2_t &loc) const -> dindex {
+
+        using material_t = typename mat_group_t::value_type;
+
+        if constexpr (concepts::material_map<material_t>) {
+            const auto map = mat_group[index];
+            return map.serialize(map.axes().bins(loc));
+        } else {
+            return 0u;
+        }
+    }
+};
+
+/// @brief Material mapping hits accumulated in a single surface material bin
+template <concepts::scalar scalar_t>
+struct material_bin_record {
+    /// Number of material hits in the bin
+    std::size_t n_hits{0u};
+    /// Accumulated material thickness
+    scalar_t thickness{0.f};
+    /// Accumulated pathlength through the material
+    scalar_t path{0.f};
+    /// Accumulated radiation length per thickness
+    scalar_t tX0{0.f};
+    /// Accumulated interaction length per thickness
+    scalar_t tL0{0.f};
+    /// Sum of the squared deviations of the radiation length per thickness
+    /// from its mean (Welford's algorithm)
+    scalar_t tX0_m2{0.f};
+
+    /// Add the material parameters @param p of a single hit
+    constexpr void add(const material_params<scalar_t> &p) {
+        const scalar_t t_X0{p.thickness / p.mat_X0};
+        const scalar_t delta{t_X0 - mean_tX0()};
+
+        ++n_hits;
+        thickness += p.thickness;
+        path += p.path;
+        tX0 += t_X0;
+        tL0 += p.thickness / p.mat_L0;
+        tX0_m2 += delta * (t_X0 - mean_tX0());
+    }
+
+    /// Merge the hits of another record @param other into this one
+    constexpr void merge(const material_bin_record &other) {
+        if (other.n_hits == 0u) {
+            return;
+        }
+        // Combine the squared deviations of both records (Chan et al.)
+        const auto n_a{static_cast<scalar_t>(n_hits)};
+        const auto n_b{static_cast<scalar_t>(other.n_hits)};
+        const scalar_t delta{other.mean_tX0() - mean_tX0()};
+        tX0_m2 += other.tX0_m2 + delta * delta * n_a * n_b / (n_a + n_b);
+
+        n_hits += other.n_hits;
+        thickness += other.thickness;
+        path += other.path;
+        tX0 += other.tX0;
+        tL0 += other.tL0;
+    }
+
+    /// @returns the mean radiation length per thickness of the hits in the bin
+    constexpr scalar_t mean_tX0() const {
+        return n_hits == 0u ? 0.f : tX0 / static_cast<scalar_t>(n_hits);
+    }
+
+    /// @returns the variance of the radiation length per thickness of the
+    /// hits in the bin
+    constexpr scalar_t var_tX0() const {
+        return n_hits == 0u ? 0.f : tX0_m2 / static_cast<scalar_t>(n_hits);
+    }
+};
+
+/// @brief Per-bin reduction of the material hits of a material mapping run
+///
+/// Every chunk of tracks of a mapping run is filled into its own accumulator
+/// without synchronization, and then merged into the result. Since floating
+/// point addition is not associative, the chunks must not depend on the
+/// number of threads and have to be merged in a fixed order for the result to
+/// be bitwise reproducible (@see material_scan ).
+template <concepts::scalar scalar_t>
+class material_map_accumulator {
+
+    public:
+    /// Surface index and global material bin
+    using key_type = std::pair<dindex, dindex>;
+    using record_type = material_bin_record<scalar_t>;
+
+    /// Add a material hit with the parameters @param p in the bin @param bin
+    /// of the surface with index @param sf_idx
+    void add(const dindex sf_idx, const dindex bin,
+             const material_params<scalar_t> &p) {
+        m_bins[key_type{sf_idx, bin}].add(p);
+    }
+
+    /// Merge the bins of another accumulator @param other into this one
+    void merge(const material_map_accumulator &other) {
+        for (const auto &[key, rec] : other.m_bins) {
+            m_bins[key].merge(rec);
+        }
+    }
+
+    /// @returns the number of bins that received hits
+    std::size_t size() const { return m_bins.size(); }
+
+    /// @returns the total number of material hits
+    std::size_t n_hits() const {
+        std::size_t n{0u};
+        for (const auto &[key, rec] : m_bins) {
+            n += rec.n_hits;
+        }
+        return n;
+    }
+
+    /// Merge the accumulated hits @param rec into the bin @param bin of the
+    /// surface with index @param sf_idx
+    void merge(const dindex sf_idx, const dindex bin, const record_type &rec) {
+        m_bins[key_type{sf_idx, bin}].merge(rec);
+    }
+
+    /// @returns the accumulated hits of the bin @param bin on the surface
+    /// with index @param sf_idx (empty record if there were no hits)
+    record_type at(const dindex sf_idx, const dindex bin) const {
+        const auto itr = m_bins.find(key_type{sf_idx, bin});
+        return itr != m_bins.end() ? itr->second : record_type{};
+    }
+
+    /// @returns all accumulated bins
+    const auto &bins() const { return m_bins; }
+
+    private:
+    std::map<key_type, record_type> m_bins{};
+};
+
 /// @brief Actor that collects all material encountered by a track during
 ///        navigation
 ///
@@ -410,4 +562,107 @@ auto write_material(const std::string &mat_file_name,
     }
 }
 
+/// Write the partial material mapping result @param mapping (e.g. of a
+/// single job) to a csv file to the path @param file_name
+///
+/// The sums are written with full precision, so that merging the files gives
+/// the same result as merging the accumulators in memory.
+template <concepts::scalar scalar_t>
+auto write_material_mapping(const std::string &file_name,
+                            const material_map_accumulator<scalar_t> &mapping) {
+
+    const auto file_path = std::filesystem::path{file_name};
+    assert(file_path.extension() == ".csv");
+
+    // Make sure path to file exists
+    io::create_path(file_path.parent_path());
+
+    detray::io::file_handle outfile{
+        file_name, std::ios::out | std::ios::binary | std::ios::trunc};
+    *outfile << std::setprecision(std::numeric_limits<scalar_t>::max_digits10);
+    *outfile << "sf_index,bin,n_hits,thickness,path,tX0,tL0,tX0_m2"
+             << std::endl;
+
+    for (const auto &[key, rec] : mapping.bins()) {
+        *outfile << key.first << "," << key.second << "," << rec.n_hits << ","
+                 << rec.thickness << "," << rec.path << "," << rec.tX0 << ","
+                 << rec.tL0 << "," << rec.tX0_m2 << std::endl;
+    }
+}
+
+/// Read a partial material mapping result from the csv file
+/// @param file_name and merge it into @param mapping
+template <concepts::scalar scalar_t>
+auto read_material_mapping(const std::string &file_name,
+                           material_map_accumulator<scalar_t> &mapping) {
+
+    detray::io::file_handle infile{file_name,
+                                   std::ios::in | std::ios::binary};
+
+    std::string line;
+    // Skip the header
+    std::getline(*infile, line);
+
+    while (std::getline(*infile, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::ranges::replace(line, ',', ' ');
+        std::istringstream fields{line};
+
+        dindex sf_idx{};
+        dindex bin{};
+        material_bin_record<scalar_t> rec{};
+        if (!(fields >> sf_idx >> bin >> rec.n_hits >> rec.thickness >>
+              rec.path >> rec.tX0 >> rec.tL0 >> rec.tX0_m2)) {
+            throw std::invalid_argument("Malformed material mapping record '" +
+                                        line + "' in " + file_name);
+        }
+        mapping.merge(sf_idx, bin, rec);
+    }
+}
+
+/// Replace the material in the bins of the material maps @param grids_data
+/// (@see io::material_map_writer ) by the average material of the hits that
+/// were accumulated in @param mapping
+///
+/// The thickness, radiation length and interaction length of a bin are
+/// derived from the sums of the hits. The other material parameters are kept.
+///
+/// @returns the number of bins that were updated
+template <concepts::scalar scalar_t, typename grids_payload_t>
+std::size_t apply_material_mapping(
+    grids_payload_t &grids_data,
+    const material_map_accumulator<scalar_t> &mapping) {
+
+    std::size_t n_updated{0u};
+    for (auto &[vol_idx, grids] : grids_data.grids) {
+        for (auto &grid : grids) {
+            // The bins are written in the order of their global index
+            for (std::size_t gbin = 0u; gbin < grid.bins.size(); ++gbin) {
+                for (auto &slab : grid.bins[gbin].content) {
+
+                    const auto rec =
+                        mapping.at(static_cast<dindex>(slab.surface.link),
+                                   static_cast<dindex>(gbin));
+
+                    if (rec.n_hits == 0u || rec.tX0 <= 0.f || rec.tL0 <= 0.f) {
+                        continue;
+                    }
+
+                    const auto n{static_cast<scalar_t>(rec.n_hits)};
+                    slab.thickness = rec.thickness / n;
+                    // Radiation and interaction length
+                    slab.mat.params[0] = rec.thickness / rec.tX0;
+                    slab.mat.params[1] = rec.thickness / rec.tL0;
+
+                    ++n_updated;
+                }
+            }
+        }
+    }
+
+    return n_updated;
+}
+
 }  // namespace detray::material_validator
@@ -13,6 +13,16 @@
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/free_track_parameters.hpp"
 
+// Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
 namespace detray {
 
 namespace detail {
@@ -32,6 +42,21 @@ struct step_data {
     track_param_type track_params{};
     free_matrix_type jacobian{};
 };
+
+/// Position and direction of the track at a single step (e.g. to display
+/// the trajectory)
+template <concepts::algebra algebra_t>
+struct step_point {
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+
+    point3_type pos{0.f, 0.f, 0.f};
+    vector3_type dir{0.f, 0.f, 0.f};
+    scalar_type path_length{0.f};
+    scalar_type qop{0.f};
+    geometry::barcode barcode{};
+};
 }  // namespace detail
 
 /// Collect information at every step
@@ -112,4 +137,269 @@ struct step_tracer : actor {
     }
 };
 
+/// Keep the data of the most recent steps in a ring buffer of fixed capacity
+///
+/// Does not allocate during the propagation: The buffer is provided with its
+/// full size up front (a host vector of the requested capacity, or a device
+/// vector on a fixed size buffer) and the oldest steps are overwritten once
+/// the buffer is full. Optionally, only every k-th eligible step is recorded.
+/// Meant to stay enabled in production runs to diagnose rare navigation
+/// failures from the last steps before the failure.
+template <concepts::algebra algebra_t, template <typename...> class vector_t>
+struct step_ring_tracer : actor {
+
+    using step_data_t = detail::step_data<algebra_t>;
+
+    /// Actor state that holds the ring buffer
+    struct state {
+        friend struct step_ring_tracer;
+
+        state() = delete;
+
+        /// Allocate the buffer for @param capacity steps with a given
+        /// @param resource
+        DETRAY_HOST
+        state(vecmem::memory_resource& resource, const unsigned int capacity)
+            : m_steps(capacity, &resource) {}
+
+        /// Construct from an externally provided vector for the @param steps,
+        /// the capacity is the size of the vector
+        DETRAY_HOST_DEVICE
+        explicit state(vector_t<step_data_t>&& steps)
+            : m_steps(std::move(steps)) {}
+
+        /// @returns the maximal number of steps that are kept
+        DETRAY_HOST_DEVICE
+        unsigned int capacity() const {
+            return static_cast<unsigned int>(m_steps.size());
+        }
+
+        /// @returns the number of steps that are currently kept
+        DETRAY_HOST_DEVICE
+        unsigned int size() const {
+            return m_n_recorded < capacity() ? m_n_recorded : capacity();
+        }
+
+        /// @returns the number of steps that were recorded in total
+        DETRAY_HOST_DEVICE
+        unsigned int n_recorded() const { return m_n_recorded; }
+
+        /// @returns true if earlier steps were overwritten
+        DETRAY_HOST_DEVICE
+        bool wrapped_around() const { return m_n_recorded > capacity(); }
+
+        /// @returns the @param i -th kept step, starting from the oldest one
+        DETRAY_HOST_DEVICE
+        const step_data_t& operator[](const unsigned int i) const {
+            assert(i < size());
+            const unsigned int first{wrapped_around()
+                                         ? m_n_recorded % capacity()
+                                         : 0u};
+            return m_steps[(first + i) % capacity()];
+        }
+
+        /// @returns copy of the kept steps, ordered from the oldest step
+        DETRAY_HOST
+        std::vector<step_data_t> ordered_step_data() const {
+            std::vector<step_data_t> steps;
+            steps.reserve(size());
+            for (unsigned int i = 0u; i < size(); ++i) {
+                steps.push_back((*this)[i]);
+            }
+            return steps;
+        }
+
+        /// Collect the data at every step
+        DETRAY_HOST_DEVICE
+        void collect_every_step(bool do_collect_every_step = true) {
+            m_collect_every_step = do_collect_every_step;
+        }
+
+        /// Collect the data only when on surface
+        DETRAY_HOST_DEVICE
+        void collect_only_on_surface(bool do_collect_every_step = true) {
+            m_collect_every_step = !do_collect_every_step;
+        }
+
+        /// Only record every @param k -th of the steps that qualify
+        DETRAY_HOST_DEVICE
+        void stride(const unsigned int k) { m_stride = k > 0u ? k : 1u; }
+
+        /// Discard the recorded steps (keeps the buffer)
+        DETRAY_HOST_DEVICE
+        void reset() {
+            m_n_candidates = 0u;
+            m_n_recorded = 0u;
+        }
+
+        private:
+        /// Whether to collect the step data at every step
+        bool m_collect_every_step{true};
+        /// Record every k-th step
+        unsigned int m_stride{1u};
+        /// Number of steps that qualified for recording
+        unsigned int m_n_candidates{0u};
+        /// Number of steps that were written to the buffer
+        unsigned int m_n_recorded{0u};
+        /// The ring buffer
+        vector_t<step_data_t> m_steps;
+    };
+
+    /// Actor call
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state& tracer_state,
+                                       propagator_state_t& prop_state) const {
+        const auto& navigation = prop_state._navigation;
+        const auto& stepping = prop_state._stepping;
+
+        if (!navigation.is_on_surface() && !tracer_state.m_collect_every_step) {
+            return;
+        }
+        if (tracer_state.m_n_candidates++ % tracer_state.m_stride != 0u ||
+            tracer_state.capacity() == 0u) {
+            return;
+        }
+
+        const geometry::barcode bcd{navigation.is_on_surface()
+                                        ? navigation.barcode()
+                                        : geometry::barcode{}};
+
+        step_data_t& sd = tracer_state.m_steps[tracer_state.m_n_recorded %
+                                               tracer_state.capacity()];
+        sd.step_size = stepping.step_size();
+        sd.path_length = stepping.path_length();
+        sd.n_total_trials = stepping.n_total_trials();
+        sd.nav_dir = navigation.direction();
+        sd.barcode = bcd;
+        sd.track_params = stepping();
+        sd.jacobian = stepping.transport_jacobian();
+
+        ++tracer_state.m_n_recorded;
+    }
+};
+
+/// Record the position and direction of the track at every step into a
+/// preallocated vector
+///
+/// Does not allocate during the propagation, so that it can be used in device
+/// code: On device, the steps of a track are written into its row of a
+/// resizable jagged buffer (@see make_step_point_buffer). When the capacity
+/// of the vector is exhausted, the following steps are dropped and counted.
+template <concepts::algebra algebra_t, template <typename...> class vector_t>
+struct step_point_tracer : actor {
+
+    using step_point_t = detail::step_point<algebra_t>;
+
+    /// Actor state that collects the data
+    struct state {
+        friend struct step_point_tracer;
+
+        state() = delete;
+
+        /// Reserve a vector for @param capacity steps with a given
+        /// @param resource
+        DETRAY_HOST
+        state(vecmem::memory_resource& resource, const unsigned int capacity)
+            : m_capacity{capacity}, m_steps(&resource) {
+            m_steps.reserve(capacity);
+        }
+
+        /// Construct from an externally provided vector for the @param steps,
+        /// e.g. the row of a resizable jagged buffer (records until its
+        /// capacity is reached)
+        DETRAY_HOST_DEVICE
+        explicit state(vector_t<step_point_t>&& steps)
+            : m_capacity{static_cast<unsigned int>(steps.capacity())},
+              m_steps(std::move(steps)) {}
+
+        /// Access to the recorded steps along the track - const
+        DETRAY_HOST_DEVICE
+        const auto& get_step_data() const { return m_steps; }
+
+        /// Move the recorded steps out of the actor
+        DETRAY_HOST
+        auto&& release_step_data() && { return std::move(m_steps); }
+
+        /// @returns the maximal number of steps that can be recorded
+        DETRAY_HOST_DEVICE
+        unsigned int capacity() const { return m_capacity; }
+
+        /// @returns the number of steps that did not fit into the vector
+        DETRAY_HOST_DEVICE
+        unsigned int n_dropped() const { return m_n_dropped; }
+
+        /// @returns true if steps at the end of the track are missing
+        DETRAY_HOST_DEVICE
+        bool is_truncated() const { return m_n_dropped > 0u; }
+
+        /// Collect the data at every step
+        DETRAY_HOST_DEVICE
+        void collect_every_step(bool do_collect_every_step = true) {
+            m_collect_every_step = do_collect_every_step;
+        }
+
+        /// Collect the data only when on surface
+        DETRAY_HOST_DEVICE
+        void collect_only_on_surface(bool do_collect_every_step = true) {
+            m_collect_every_step = !do_collect_every_step;
+        }
+
+        private:
+        /// Whether to collect the step data at every step
+        bool m_collect_every_step{true};
+        /// Maximal number of steps to record
+        unsigned int m_capacity{0u};
+        /// Number of steps that exceeded the capacity
+        unsigned int m_n_dropped{0u};
+        /// The recorded steps
+        vector_t<step_point_t> m_steps;
+    };
+
+    /// Actor call
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(state& tracer_state,
+                                       propagator_state_t& prop_state) const {
+        const auto& navigation = prop_state._navigation;
+        const auto& stepping = prop_state._stepping;
+
+        if (!navigation.is_on_surface() && !tracer_state.m_collect_every_step) {
+            return;
+        }
+        if (tracer_state.m_steps.size() >= tracer_state.m_capacity) {
+            ++tracer_state.m_n_dropped;
+            return;
+        }
+
+        const geometry::barcode bcd{navigation.is_on_surface()
+                                        ? navigation.barcode()
+                                        : geometry::barcode{}};
+        const auto& track = stepping();
+
+        tracer_state.m_steps.push_back({track.pos(), track.dir(),
+                                        stepping.path_length(), track.qop(),
+                                        bcd});
+    }
+};
+
+/// Set up a resizable jagged buffer for the step point tracer, with room for
+/// @param capacity steps for each of @param n_tracks tracks
+///
+/// @param mr memory resource of the buffer (e.g. device memory)
+/// @param host_mr host accessible memory resource for the row headers (may
+///                be a null pointer, if @param mr is host accessible)
+/// @param copy copy object used to initialize the buffer
+template <concepts::algebra algebra_t>
+DETRAY_HOST inline auto make_step_point_buffer(
+    const std::size_t n_tracks, const std::size_t capacity,
+    vecmem::memory_resource& mr, vecmem::memory_resource* host_mr,
+    vecmem::copy& copy) {
+
+    vecmem::data::jagged_vector_buffer<detail::step_point<algebra_t>> buffer(
+        std::vector<std::size_t>(n_tracks, capacity), mr, host_mr,
+        vecmem::data::buffer_type::resizable);
+    copy.setup(buffer)->wait();
+
+    return buffer;
+}
+
 }  // namespace detray
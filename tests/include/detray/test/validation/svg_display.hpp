@@ -178,23 +178,26 @@ inline void svg_display(const typename detector_t::geometry_context gctx,
     const actsvg::views::x_y xy{};
     const actsvg::views::z_r zr{};
 
-    // xy - view
-    auto svg_traj = draw_intersection_and_traj_svg(
-        gctx, il, truth_trace, traj, traj_name, recorded_trace, xy);
-
-    const auto [vol_xy_svg, _] = il.draw_volumes(volumes, xy, gctx);
-    detray::svgtools::write_svg(
-        path / (outfile + "_" + vol_xy_svg._id + "_" + traj_name),
-        {xy_axis, vol_xy_svg, svg_traj});
+    // xy - view: The volumes are written one at a time
+    {
+        detray::svgtools::svg_stream_writer writer{
+            path / (outfile + "_" + il.det_name() + "_volumes_xy_" +
+                    traj_name)};
+        writer.write(xy_axis);
+        il.stream_volumes(writer, volumes, xy, gctx);
+        writer.write(draw_intersection_and_traj_svg(
+            gctx, il, truth_trace, traj, traj_name, recorded_trace, xy));
+    }
 
     // zr - view
-    svg_traj = draw_intersection_and_traj_svg(gctx, il, truth_trace, traj,
-                                              traj_name, recorded_trace, zr);
-
-    const auto vol_zr_svg = il.draw_detector(zr, gctx);
-    detray::svgtools::write_svg(
-        path / (outfile + "_" + vol_zr_svg._id + "_" + traj_name),
-        {zr_axis, vol_zr_svg, svg_traj});
+    {
+        detray::svgtools::svg_stream_writer writer{
+            path / (outfile + "_" + il.det_name() + "_zr_" + traj_name)};
+        writer.write(zr_axis);
+        il.stream_detector(writer, zr, gctx);
+        writer.write(draw_intersection_and_traj_svg(
+            gctx, il, truth_trace, traj, traj_name, recorded_trace, zr));
+    }
 
     if (verbose) {
         std::cout << "INFO: Wrote svgs for debugging in: " << path << "\n"
@@ -113,6 +113,7 @@ int main(int argc, char **argv) {
     mat_scan_cfg.whiteboard(white_board);
     mat_scan_cfg.track_generator().uniform_eta(true).eta_range(-4.f, 4.f);
     mat_scan_cfg.track_generator().phi_steps(100).eta_steps(100);
+    mat_scan_cfg.n_threads(4u);
 
     // Record the material using a ray scan
     detail::register_checks<test::material_scan>(toy_det, toy_names,
@@ -166,6 +166,116 @@ GTEST_TEST(detray_material, telescope_geometry_energy_loss) {
     // @todo: Validate the backward direction case as well?
 }
 
+// Material interaction test with the material cache and the interaction table
+// of the interactor
+GTEST_TEST(detray_material, telescope_geometry_material_cache) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Build in x-direction from given module positions
+    detail::ray<test_algebra> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    std::vector<scalar> positions = {0.f,   50.f,  100.f, 150.f, 200.f, 250.f,
+                                     300.f, 350.f, 400.f, 450.f, 500.f};
+
+    const auto mat = silicon_tml<scalar>();
+    constexpr scalar thickness{0.17f * unit<scalar>::cm};
+
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{20.f * unit<scalar>::mm,
+                                                      20.f * unit<scalar>::mm};
+    tel_cfg.positions(positions)
+        .pilot_track(traj)
+        .module_material(mat)
+        .mat_thickness(thickness);
+
+    const auto [det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using stepper_t = line_stepper<test_algebra>;
+    using pathlimit_aborter_t = pathlimit_aborter<scalar>;
+    using actor_chain_t =
+        actor_chain<pathlimit_aborter_t, parameter_transporter<test_algebra>,
+                    interactor_t, parameter_resetter<test_algebra>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.overstep_tolerance = -100.f * unit<float>::um;
+    propagator_t p{prop_cfg};
+
+    constexpr scalar iniP{1.f * unit<scalar>::GeV};
+
+    // Bound vector
+    bound_parameters_vector<test_algebra> bound_vector{};
+    bound_vector.set_theta(constant<scalar>::pi_2);
+    bound_vector.set_qop(ptc.charge() / iniP);
+
+    auto bound_cov = matrix::identity<covariance_t>();
+    getter::element(bound_cov, e_bound_qoverp, e_bound_qoverp) = 0.f;
+
+    const bound_track_parameters<test_algebra> bound_param(
+        det.surface(0u).barcode(), bound_vector, bound_cov);
+
+    // Propagate with and without the material cache or interaction table
+    auto run = [&](const scalar max_rel_qop_change,
+                   const interactor_t::interaction_table_type *table =
+                       nullptr) {
+        pathlimit_aborter_t::state aborter_state{};
+        interactor_t::state interactor_state{};
+        interactor_state.max_rel_qop_change = max_rel_qop_change;
+        interactor_state.tables = table;
+        interactor_state.n_tables = (table != nullptr) ? 1u : 0u;
+
+        auto actor_states = detray::tie(aborter_state, interactor_state);
+
+        propagator_t::state state(bound_param, det);
+        EXPECT_TRUE(p.propagate(state, actor_states));
+
+        return std::make_pair(state._stepping.bound_params(),
+                              interactor_state.cache);
+    };
+
+    const auto [ref_params, ref_cache] = run(0.f);
+    // The momentum changes by less than a percent over the telescope
+    const auto [params, cache] = run(1e-2f);
+
+    // The cache was filled only on the first plane
+    EXPECT_FALSE(ref_cache.is_valid);
+    ASSERT_TRUE(cache.is_valid);
+    EXPECT_EQ(cache.qop, bound_vector.qop());
+    EXPECT_TRUE(cache.mat == mat);
+
+    // The results agree up to the momentum change over the telescope (the
+    // variance of q/p scales with (q/p)^4)
+    const scalar ref_p{ref_params.p(ptc.charge())};
+    EXPECT_NEAR(params.p(ptc.charge()), ref_p, 1e-5f * ref_p);
+
+    const scalar ref_var_qop{getter::element(ref_params.covariance(),
+                                             e_bound_qoverp, e_bound_qoverp)};
+    const scalar var_qop{getter::element(params.covariance(), e_bound_qoverp,
+                                         e_bound_qoverp)};
+    EXPECT_NEAR(var_qop, ref_var_qop, 5e-2f * ref_var_qop);
+
+    const scalar ref_var_theta{getter::element(ref_params.covariance(),
+                                               e_bound_theta, e_bound_theta)};
+    const scalar var_theta{getter::element(params.covariance(), e_bound_theta,
+                                           e_bound_theta)};
+    EXPECT_NEAR(var_theta, ref_var_theta, 1e-2f * ref_var_theta);
+
+    // The interaction table is used instead of the cache
+    const interactor_t::interaction_table_type table{mat, ptc};
+    const auto [tab_params, tab_cache] = run(1e-2f, &table);
+
+    // The energy loss agrees within the interpolation uncertainty
+    EXPECT_FALSE(tab_cache.is_valid);
+    EXPECT_NEAR(tab_params.p(ptc.charge()), ref_p, 5e-3f * (iniP - ref_p));
+    EXPECT_NEAR(getter::element(tab_params.covariance(), e_bound_qoverp,
+                                e_bound_qoverp),
+                ref_var_qop, 1e-2f * ref_var_qop);
+    EXPECT_NEAR(getter::element(tab_params.covariance(), e_bound_theta,
+                                e_bound_theta),
+                ref_var_theta, 1e-2f * ref_var_theta);
+}
+
 // Material interaction test with telescope Geometry
 GTEST_TEST(detray_material, telescope_geometry_scattering_angle) {
     vecmem::host_memory_resource host_mr;
@@ -35,10 +35,16 @@
 
 // System include(s).
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 namespace po = boost::program_options;
 using namespace detray;
@@ -75,8 +81,8 @@ constexpr const scalar big = std::numeric_limits<scalar>::max();
 std::random_device rd;
 // For detector generation
 std::mt19937_64 mt1(rd());
-// For smearing initial parameter
-std::mt19937_64 mt2(rd());
+// For smearing initial parameter (reseeded for every track)
+thread_local std::mt19937_64 mt2{};
 
 // Momentum range
 constexpr const scalar min_mom = 0.5f * unit<scalar>::GeV;
@@ -667,7 +673,7 @@ void evaluate_jacobian_difference(
     const scalar overstep_tolerance, const scalar path_tolerance,
     const scalar rk_tolerance, const scalar rk_tolerance_dis,
     const scalar constraint_step, const std::array<scalar, 5u>& hs,
-    std::ofstream& file, scalar& ref_rel_diff, bool use_field_gradient,
+    std::ostream& file, scalar& ref_rel_diff, bool use_field_gradient,
     bool do_inspect, const bool use_precal_values = false,
     [[maybe_unused]] bound_covariance_type precal_diff_jacobi = {},
     [[maybe_unused]] std::array<unsigned int, 5u> precal_num_iterations = {},
@@ -823,7 +829,7 @@ void evaluate_covariance_transport(
     const bound_track_parameters<test_algebra>& track, const field_t& field,
     const scalar overstep_tolerance, const scalar path_tolerance,
     const scalar rk_tolerance, const scalar rk_tolerance_dis,
-    const scalar constraint_step, std::ofstream& file,
+    const scalar constraint_step, std::ostream& file,
     bool use_field_gradient) {
 
     // Copy track
@@ -1023,7 +1029,7 @@ void evaluate_jacobian_difference_helix(
     const std::array<scalar, 3u> euler_angles_F, const detector_t& det,
     const scalar detector_length,
     const bound_track_parameters<test_algebra>& track, const vector3& field,
-    const std::array<scalar, 5u> hs, std::ofstream& file,
+    const std::array<scalar, 5u> hs, std::ostream& file,
     const scalar helix_tolerance) {
 
     const auto phi0 = track.phi();
@@ -1373,6 +1379,55 @@ void setup_csv_header_covariance(std::ofstream& file) {
     file << std::endl;
 }
 
+/// Randomly drawn setup of a single track
+struct track_setup {
+    free_track_parameters<test_algebra> track;
+    /// Position of the track in the generator, starting from one
+    std::size_t track_id;
+    scalar detector_length;
+    std::array<scalar, 3u> euler_angles_I;
+    std::array<scalar, 3u> euler_angles_F;
+};
+
+/// Results of a single track, buffered until all threads are done
+struct track_output {
+
+    explicit track_output(const std::size_t n_tols)
+        : rect_files(n_tols),
+          wire_files(n_tols),
+          dqopdqop_rel_diffs_rect(n_tols),
+          dqopdqop_rel_diffs_wire(n_tols) {
+        for (auto* os :
+             {&helix_rect_file, &const_rect_file, &inhom_rect_file,
+              &inhom_rect_material_file, &helix_wire_file, &const_wire_file,
+              &inhom_wire_file, &inhom_wire_material_file,
+              &rect_cov_transport_file, &wire_cov_transport_file}) {
+            *os << std::fixed << std::showpoint << std::setprecision(32);
+        }
+        for (std::size_t i = 0u; i < n_tols; ++i) {
+            rect_files[i] << std::fixed << std::showpoint
+                          << std::setprecision(32);
+            wire_files[i] << std::fixed << std::showpoint
+                          << std::setprecision(32);
+        }
+    }
+
+    std::ostringstream helix_rect_file;
+    std::ostringstream const_rect_file;
+    std::ostringstream inhom_rect_file;
+    std::ostringstream inhom_rect_material_file;
+    std::ostringstream helix_wire_file;
+    std::ostringstream const_wire_file;
+    std::ostringstream inhom_wire_file;
+    std::ostringstream inhom_wire_material_file;
+    std::ostringstream rect_cov_transport_file;
+    std::ostringstream wire_cov_transport_file;
+    std::vector<std::ostringstream> rect_files;
+    std::vector<std::ostringstream> wire_files;
+    std::vector<std::vector<scalar>> dqopdqop_rel_diffs_rect;
+    std::vector<std::vector<scalar>> dqopdqop_rel_diffs_wire;
+};
+
 int main(int argc, char** argv) {
 
     // Options parsing
@@ -1421,6 +1476,8 @@ int main(int argc, char** argv) {
                        "Monte-Carlo seed");
     desc.add_options()("verbose-level", po::value<int>()->default_value(1),
                        "Verbose level");
+    desc.add_options()("n-threads", po::value<std::size_t>()->default_value(1u),
+                       "Number of threads to distribute the tracks over");
 
     po::variables_map vm;
     po::store(parse_command_line(argc, argv, desc,
@@ -1460,6 +1517,8 @@ int main(int argc, char** argv) {
         vm["log10-max-rk-tolerance-mm"].as<scalar>() * unit<scalar>::mm;
     const std::size_t mc_seed = vm["mc-seed"].as<std::size_t>();
     const int verbose_lvl = vm["verbose-level"].as<int>();
+    const std::size_t n_threads =
+        std::max(vm["n-threads"].as<std::size_t>(), std::size_t{1u});
 
     std::vector<scalar> log10_tols;
     scalar r = log10_min_rk_tolerance;
@@ -1618,16 +1677,56 @@ int main(int argc, char** argv) {
     using inhom_field_wire_propagator_t =
         propagator<inhom_field_stepper_t, wire_navigator_t, actor_chain_t>;
 
-    std::size_t track_count = 0u;
+    // Draw the random detector setup of every track up front, so that the
+    // results do not depend on the order in which the threads process them
+    std::vector<track_setup> setups;
+    setups.reserve(n_tracks);
 
+    std::size_t n_generated = 0u;
     for (const auto track : trk_generator_t{trk_gen_cfg}) {
-        mt2.seed(track_count);
+
+        const scalar detector_length = rand_length(mt1);
+
+        auto alphaI = rand_alpha(mt1);
+        auto alphaF = rand_alpha(mt1);
+        auto betaF = math::acos(rand_cosbeta(mt1));
+        if (rand_bool(mt1) == 0) {
+            betaF = -betaF;
+        }
+        auto gammaF = rand_gamma(mt1);
+
+        n_generated++;
+        if (n_generated <= n_skips) {
+            continue;
+        }
+
+        setups.push_back({track,
+                          n_generated,
+                          detector_length,
+                          {alphaI, 0.f, 0.f},
+                          {alphaF, betaF, gammaF}});
+    }
+
+    // Validate a single track and buffer its results in @param out
+    auto process_track = [&](const track_setup& setup, track_output& out) {
+        // The smearing of the initial parameters only depends on the track
+        mt2.seed(setup.track_id - 1u);
+
+        const auto& track = setup.track;
+        const std::size_t track_count = setup.track_id;
+        const scalar detector_length = setup.detector_length;
+
+        const std::array<scalar, 3u>& euler_angles_I = setup.euler_angles_I;
+        const std::array<scalar, 3u>& euler_angles_F = setup.euler_angles_F;
+        const scalar alphaI = euler_angles_I[0];
+        const scalar alphaF = euler_angles_F[0];
+        const scalar betaF = euler_angles_F[1];
+        const scalar gammaF = euler_angles_F[2];
 
         // Pilot track
         detail::helix<test_algebra> helix_bz(track, B_z);
 
         // Make a telescope geometry with rectagular surface
-        const scalar detector_length = rand_length(mt1);
         const scalar constraint_step_size = detector_length * 1.25f;
 
         mask<rect_type, test_algebra> rect{0u, detector_length * mask_scaler,
@@ -1651,17 +1750,6 @@ int main(int argc, char** argv) {
         rectangle_cfg.volume_material(vacuum<scalar>{});
         rectangle_cfg.do_check(false);
 
-        auto alphaI = rand_alpha(mt1);
-        auto alphaF = rand_alpha(mt1);
-        auto betaF = math::acos(rand_cosbeta(mt1));
-        if (rand_bool(mt1) == 0) {
-            betaF = -betaF;
-        }
-        auto gammaF = rand_gamma(mt1);
-
-        std::array<scalar, 3u> euler_angles_I{alphaI, 0.f, 0.f};
-        std::array<scalar, 3u> euler_angles_F{alphaF, betaF, gammaF};
-
         // Without volume material
         auto [rect_det, rect_names] =
             build_telescope_detector<test_algebra>(host_mr, rectangle_cfg);
@@ -1727,15 +1815,6 @@ int main(int argc, char** argv) {
                 wire_det_w_mat, 1u, helix_bz.dir(detector_length), alphaF,
                 betaF, gammaF);
 
-        // This IF block should locate after `tilt_surface()` calls for
-        // debugging purpose
-        if (track_count + 1 <= n_skips) {
-            track_count++;
-            continue;
-        }
-
-        track_count++;
-
         if (verbose_lvl >= 1) {
             std::cout << "[Event Property]" << std::endl;
             std::cout << "Track ID: " << track_count
@@ -1817,11 +1896,11 @@ int main(int argc, char** argv) {
                         rect_det_w_mat, detector_length, rect_bparam,
                         inhom_bfield, overstep_tol, on_surface_tol,
                         std::pow(10.f, log10_tols[i]), rk_tol_dis,
-                        constraint_step_size, h_sizes_rect, rect_files[i],
+                        constraint_step_size, h_sizes_rect, out.rect_files[i],
                         ref_rel_diff, true, do_inspect, true,
                         differentiated_jacobian, num_iterations, convergence);
 
-                    dqopdqop_rel_diffs_rect[i].push_back(ref_rel_diff);
+                    out.dqopdqop_rel_diffs_rect[i].push_back(ref_rel_diff);
                 }
             } else if (!rk_tolerance_iterate_mode) {
 
@@ -1831,14 +1910,14 @@ int main(int argc, char** argv) {
                     decltype(rect_det)::masks::id::e_rectangle2>(
                     track_count, euler_angles_I, euler_angles_F, rect_det,
                     detector_length, rect_bparam, B_z, h_sizes_rect,
-                    helix_rect_file, helix_tol);
+                    out.helix_rect_file, helix_tol);
 
                 // Rect Const field
                 evaluate_jacobian_difference<const_field_rect_propagator_t>(
                     track_count, euler_angles_I, euler_angles_F, rect_det,
                     detector_length, rect_bparam, const_bfield, overstep_tol,
                     on_surface_tol, rk_tol_jac, rk_tol_dis,
-                    constraint_step_size, h_sizes_rect, const_rect_file,
+                    constraint_step_size, h_sizes_rect, out.const_rect_file,
                     ref_rel_diff, true, false);
 
                 // Rect Inhomogeneous field
@@ -1846,7 +1925,7 @@ int main(int argc, char** argv) {
                     track_count, euler_angles_I, euler_angles_F, rect_det,
                     detector_length, rect_bparam, inhom_bfield, overstep_tol,
                     on_surface_tol, rk_tol_jac, rk_tol_dis,
-                    constraint_step_size, h_sizes_rect, inhom_rect_file,
+                    constraint_step_size, h_sizes_rect, out.inhom_rect_file,
                     ref_rel_diff, true, false);
 
                 // Rectangle Inhomogeneous field with Material
@@ -1855,7 +1934,7 @@ int main(int argc, char** argv) {
                     detector_length, rect_bparam, inhom_bfield, overstep_tol,
                     on_surface_tol, rk_tol_jac, rk_tol_dis,
                     constraint_step_size, h_sizes_rect,
-                    inhom_rect_material_file, ref_rel_diff, true, false);
+                    out.inhom_rect_material_file, ref_rel_diff, true, false);
 
                 // Rectangle Inhomogeneous field with Material (Covariance
                 // transport)
@@ -1863,7 +1942,7 @@ int main(int argc, char** argv) {
                     track_count, euler_angles_I, euler_angles_F, rect_det_w_mat,
                     detector_length, rect_bparam, inhom_bfield, overstep_tol,
                     on_surface_tol, rk_tol_cov, rk_tol_dis,
-                    constraint_step_size, rect_cov_transport_file, true);
+                    constraint_step_size, out.rect_cov_transport_file, true);
             }
         }
 
@@ -1903,11 +1982,11 @@ int main(int argc, char** argv) {
                         wire_det_w_mat, detector_length, wire_bparam,
                         inhom_bfield, overstep_tol, on_surface_tol,
                         std::pow(10.f, log10_tols[i]), rk_tol_dis,
-                        constraint_step_size, h_sizes_wire, wire_files[i],
+                        constraint_step_size, h_sizes_wire, out.wire_files[i],
                         ref_rel_diff, true, do_inspect, true,
                         differentiated_jacobian, num_iterations, convergence);
 
-                    dqopdqop_rel_diffs_wire[i].push_back(ref_rel_diff);
+                    out.dqopdqop_rel_diffs_wire[i].push_back(ref_rel_diff);
                 }
             } else if (!rk_tolerance_iterate_mode) {
 
@@ -1917,14 +1996,14 @@ int main(int argc, char** argv) {
                     decltype(wire_det)::masks::id::e_drift_cell>(
                     track_count, euler_angles_I, euler_angles_F, wire_det,
                     detector_length, wire_bparam, B_z, h_sizes_wire,
-                    helix_wire_file, helix_tol);
+                    out.helix_wire_file, helix_tol);
 
                 // Wire Const field
                 evaluate_jacobian_difference<const_field_wire_propagator_t>(
                     track_count, euler_angles_I, euler_angles_F, wire_det,
                     detector_length, wire_bparam, const_bfield, overstep_tol,
                     on_surface_tol, rk_tol_jac, rk_tol_dis,
-                    constraint_step_size, h_sizes_wire, const_wire_file,
+                    constraint_step_size, h_sizes_wire, out.const_wire_file,
                     ref_rel_diff, true, false);
 
                 // Wire Inhomogeneous field
@@ -1932,7 +2011,7 @@ int main(int argc, char** argv) {
                     track_count, euler_angles_I, euler_angles_F, wire_det,
                     detector_length, wire_bparam, inhom_bfield, overstep_tol,
                     on_surface_tol, rk_tol_jac, rk_tol_dis,
-                    constraint_step_size, h_sizes_wire, inhom_wire_file,
+                    constraint_step_size, h_sizes_wire, out.inhom_wire_file,
                     ref_rel_diff, true, false);
 
                 // Wire Inhomogeneous field with Material
@@ -1941,15 +2020,93 @@ int main(int argc, char** argv) {
                     detector_length, wire_bparam, inhom_bfield, overstep_tol,
                     on_surface_tol, rk_tol_jac, rk_tol_dis,
                     constraint_step_size, h_sizes_wire,
-                    inhom_wire_material_file, ref_rel_diff, true, false);
+                    out.inhom_wire_material_file, ref_rel_diff, true, false);
 
                 // Wire Inhomogeneous field with Material (Covariance transport)
                 evaluate_covariance_transport<inhom_field_wire_propagator_t>(
                     track_count, euler_angles_I, euler_angles_F, wire_det_w_mat,
                     detector_length, wire_bparam, inhom_bfield, overstep_tol,
                     on_surface_tol, rk_tol_cov, rk_tol_dis,
-                    constraint_step_size, wire_cov_transport_file, true);
+                    constraint_step_size, out.wire_cov_transport_file, true);
+            }
+        }
+    };
+
+    // Distribute the tracks over the threads
+    std::vector<track_output> outputs;
+    outputs.reserve(setups.size());
+    for (std::size_t i = 0u; i < setups.size(); ++i) {
+        outputs.emplace_back(log10_tols.size());
+    }
+
+    std::atomic<std::size_t> next_track{0u};
+    std::vector<std::exception_ptr> errors(n_threads);
+
+    auto run_worker = [&](const std::size_t worker) {
+        try {
+            for (std::size_t i = next_track++; i < setups.size();
+                 i = next_track++) {
+                process_track(setups[i], outputs[i]);
+            }
+        } catch (...) {
+            errors[worker] = std::current_exception();
+        }
+    };
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    if (n_threads == 1u) {
+        run_worker(0u);
+    } else {
+        std::vector<std::thread> workers;
+        workers.reserve(n_threads);
+        for (std::size_t worker = 0u; worker < n_threads; ++worker) {
+            workers.emplace_back(run_worker, worker);
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+    for (const auto& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start_time;
+
+    std::cout << "Validated " << setups.size() << " tracks in "
+              << elapsed.count() << " s with " << n_threads << " thread(s) ("
+              << static_cast<double>(setups.size()) / elapsed.count()
+              << " tracks/s)" << std::endl;
+
+    // Write the results in the order of the tracks
+    for (const auto& out : outputs) {
+        helix_rect_file << out.helix_rect_file.str();
+        const_rect_file << out.const_rect_file.str();
+        inhom_rect_file << out.inhom_rect_file.str();
+        inhom_rect_material_file << out.inhom_rect_material_file.str();
+        helix_wire_file << out.helix_wire_file.str();
+        const_wire_file << out.const_wire_file.str();
+        inhom_wire_file << out.inhom_wire_file.str();
+        inhom_wire_material_file << out.inhom_wire_material_file.str();
+        rect_cov_transport_file << out.rect_cov_transport_file.str();
+        wire_cov_transport_file << out.wire_cov_transport_file.str();
+
+        for (std::size_t i = 0u; i < log10_tols.size(); i++) {
+            if (rk_tolerance_iterate_mode) {
+                rect_files[i] << out.rect_files[i].str();
+                wire_files[i] << out.wire_files[i].str();
             }
+            dqopdqop_rel_diffs_rect[i].insert(
+                dqopdqop_rel_diffs_rect[i].end(),
+                out.dqopdqop_rel_diffs_rect[i].begin(),
+                out.dqopdqop_rel_diffs_rect[i].end());
+            dqopdqop_rel_diffs_wire[i].insert(
+                dqopdqop_rel_diffs_wire[i].end(),
+                out.dqopdqop_rel_diffs_wire[i].begin(),
+                out.dqopdqop_rel_diffs_wire[i].end());
         }
     }
 
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2024 CERN for the benefit of the ACTS project
+ * (c) 2021-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -15,6 +15,7 @@
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/actors.hpp"
 #include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/dormand_prince_stepper.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/tracks/tracks.hpp"
@@ -28,11 +29,15 @@
 #include "detray/test/utils/types.hpp"
 
 // Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/host_memory_resource.hpp>
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <limits>
+
 using namespace detray;
 
 using test_algebra = test::algebra;
@@ -151,6 +156,175 @@ GTEST_TEST(detray_propagator, propagator_line_stepper) {
         << state._navigation.inspector().to_string() << std::endl;
 }
 
+/// Test the looper aborter with low momentum tracks in the toy detector
+GTEST_TEST(detray_propagator, looper_aborter) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using navigator_t = navigator<decltype(det), cache_size>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    using looper_aborter_t = looper_aborter<test_algebra>;
+    using actor_chain_t =
+        actor_chain<pathlimit_aborter<scalar>, looper_aborter_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // The tracks circle in the transverse plane inside the barrel
+    const bfield_t bfield = bfield::create_const_field<scalar>(
+        vector3{0.f, 0.f, 2.f * unit<scalar>::T});
+
+    propagation::config cfg{};
+    propagator_t p{cfg};
+
+    using counter_t = looper_aborter_t::counter_type;
+    vecmem::vector<counter_t> counters(looper_aborter_t::n_counters, 0u,
+                                       &host_mr);
+
+    const point3 pos{0.f, 0.f, 0.f};
+    constexpr unsigned int n_tracks{8u};
+    for (unsigned int i = 0u; i < n_tracks; ++i) {
+        const scalar phi{2.f * constant<scalar>::pi * static_cast<scalar>(i) /
+                         static_cast<scalar>(n_tracks)};
+        const vector3 mom{50.f * unit<scalar>::MeV * math::cos(phi),
+                          50.f * unit<scalar>::MeV * math::sin(phi), 0.f};
+        const free_track_parameters<test_algebra> track(pos, 0.f, mom, -1.f);
+
+        pathlimit_aborter<scalar>::state pathlimit_state{};
+        pathlimit_state.set_path_limit(cfg.stepping.path_limit);
+
+        // Without the looper aborter, the track runs until the path limit
+        looper_aborter_t::state looper_state{};
+        looper_state.max_turning_angle(std::numeric_limits<scalar>::max());
+        looper_state.max_surface_visits(
+            std::numeric_limits<unsigned int>::max());
+
+        propagator_t::state state(track, bfield, det);
+        ASSERT_FALSE(
+            p.propagate(state, detray::tie(pathlimit_state, looper_state)));
+        EXPECT_FALSE(looper_state.is_looper());
+
+        // Abort after the surface revisits
+        looper_aborter_t::state revisit_state{vecmem::get_data(counters)};
+        revisit_state.max_turning_angle(std::numeric_limits<scalar>::max());
+
+        propagator_t::state revisit_prop_state(track, bfield, det);
+        ASSERT_FALSE(p.propagate(revisit_prop_state,
+                                 detray::tie(pathlimit_state, revisit_state)));
+        EXPECT_EQ(revisit_state.reason(), looper_reason::e_surface_revisit);
+
+        // Abort after the turning angle
+        looper_aborter_t::state angle_state{vecmem::get_data(counters)};
+        angle_state.max_surface_visits(
+            std::numeric_limits<unsigned int>::max());
+        angle_state.max_turning_angle(2.f * constant<scalar>::pi);
+
+        propagator_t::state angle_prop_state(track, bfield, det);
+        ASSERT_FALSE(p.propagate(angle_prop_state,
+                                 detray::tie(pathlimit_state, angle_state)));
+        EXPECT_EQ(angle_state.reason(), looper_reason::e_turning_angle);
+        EXPECT_GE(angle_state.turning_angle(), 2.f * constant<scalar>::pi);
+
+        // Loopers are stopped much earlier than at the path limit
+        EXPECT_LT(revisit_prop_state._stepping.abs_path_length(),
+                  0.5f * state._stepping.abs_path_length());
+        EXPECT_LT(angle_prop_state._stepping.abs_path_length(),
+                  0.5f * state._stepping.abs_path_length());
+    }
+
+    // Count the aborted tracks
+    using enum looper_reason;
+    EXPECT_EQ(counters[static_cast<unsigned int>(e_none)], 2u * n_tracks);
+    EXPECT_EQ(counters[static_cast<unsigned int>(e_surface_revisit)],
+              n_tracks);
+    EXPECT_EQ(counters[static_cast<unsigned int>(e_turning_angle)], n_tracks);
+}
+
+/// Test the step budget and the cost record of tracks in the toy detector
+GTEST_TEST(detray_propagator, step_budget_aborter) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using navigator_t = navigator<decltype(det), cache_size,
+                                  navigation::counting_inspector>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    using actor_chain_t =
+        actor_chain<pathlimit_aborter<scalar>, step_budget_aborter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using counter_t = step_budget_aborter::counter_type;
+
+    const bfield_t bfield = bfield::create_const_field<scalar>(
+        vector3{0.f, 0.f, 2.f * unit<scalar>::T});
+
+    propagation::config cfg{};
+    propagator_t p{cfg};
+
+    pathlimit_aborter<scalar>::state pathlimit_state{};
+    pathlimit_state.set_path_limit(cfg.stepping.path_limit);
+
+    // Global step counters per volume
+    vecmem::vector<counter_t> volume_steps(det.volumes().size(), 0u,
+                                           &host_mr);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_steps(5u).phi_steps(5u).p_tot(
+        10.f * unit<scalar>::GeV);
+
+    counter_t n_total_steps{0u};
+    for (const auto track : trk_gen) {
+
+        // Unlimited budget: record the cost of the track
+        step_budget_aborter::state cost_state{vecmem::get_data(volume_steps)};
+
+        propagator_t::state state(track, bfield, det);
+        ASSERT_TRUE(
+            p.propagate(state, detray::tie(pathlimit_state, cost_state)));
+
+        const track_cost &cost = cost_state.cost();
+        const auto &insp = state._navigation.inspector();
+
+        EXPECT_FALSE(cost.is_over_budget);
+        EXPECT_GT(cost.n_steps, 0u);
+        EXPECT_EQ(cost.n_steps + cost.n_rejected_steps,
+                  state._stepping.n_total_trials());
+        EXPECT_EQ(cost.n_reinit + 1u,
+                  insp.count(navigation::counter::e_init));
+        EXPECT_EQ(cost.n_candidates,
+                  insp.count(navigation::counter::e_cached_candidates));
+        n_total_steps += cost.n_steps;
+
+        // Stop the track after half of its steps
+        step_budget_aborter::state budget_state{};
+        budget_state.max_steps(cost.n_steps / 2u);
+
+        propagator_t::state budget_prop_state(track, bfield, det);
+        ASSERT_FALSE(p.propagate(budget_prop_state,
+                                 detray::tie(pathlimit_state, budget_state)));
+
+        EXPECT_TRUE(budget_state.cost().is_over_budget);
+        EXPECT_EQ(budget_state.cost().n_steps, cost.n_steps / 2u);
+        EXPECT_LT(budget_prop_state._stepping.abs_path_length(),
+                  state._stepping.abs_path_length());
+    }
+
+    // Every step was counted in the volume it was taken in
+    counter_t n_volume_steps{0u};
+    for (const counter_t n : volume_steps) {
+        n_volume_steps += n;
+    }
+    EXPECT_EQ(n_volume_steps, n_total_steps);
+}
+
 /// Fixture for Runge-Kutta Propagation
 class PropagatorWithRkStepper : public ::testing::TestWithParam<
                                     std::tuple<scalar, scalar, test::vector3>> {
@@ -297,6 +471,90 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_const_bfield) {
     }
 }
 
+/// Test propagation in a constant magnetic field using the embedded
+/// Dormand-Prince stepper
+TEST_P(PropagatorWithRkStepper, dp5_propagator_const_bfield) {
+
+    // Constant magnetic field type
+    using bfield_t = bfield::const_field_t<scalar>;
+
+    // Toy detector
+    using detector_t = detector<test::toy_metadata>;
+
+    // Dormand-Prince propagation
+    using navigator_t =
+        navigator<detector_t, cache_size, navigation::print_inspector>;
+    using track_t = free_track_parameters<test_algebra>;
+    using constraints_t = constrained_step<scalar>;
+    using policy_t = stepper_rk_policy<scalar>;
+    using stepper_t = dormand_prince_stepper<bfield_t::view_t, test_algebra,
+                                             constraints_t, policy_t>;
+    // Include helix actor to check track position/covariance
+    using actor_chain_t =
+        actor_chain<helix_inspector, pathlimit_aborter<scalar>,
+                    parameter_transporter<test_algebra>,
+                    pointwise_material_interactor<test_algebra>,
+                    parameter_resetter<test_algebra>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Build detector
+    toy_cfg.use_material_maps(false);
+    toy_cfg.mapped_material(detray::vacuum<scalar>());
+    const auto [det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    const bfield_t bfield =
+        bfield::create_const_field<scalar>(std::get<2>(GetParam()));
+
+    // Propagator is built from the stepper and navigator
+    propagation::config cfg{};
+    cfg.navigation.overstep_tolerance = static_cast<float>(overstep_tol);
+    cfg.navigation.search_window = {3u, 3u};
+    // In the tilted fields, the long steps can leave a volume without
+    // crossing one of the straight line candidates
+    cfg.stepping.max_step_deviation = 1.f * unit<float>::mm;
+    propagator_t p{cfg};
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track : generator_t{trk_gen_cfg}) {
+
+        // Generate second track state used for propagation with pathlimit
+        track_t lim_track(track);
+
+        auto actor_states = actor_chain_t::make_default_actor_states();
+        auto actor_states_lim = actor_chain_t::make_default_actor_states();
+
+        // Make sure the lim state is being terminated
+        auto& pathlimit_aborter_state =
+            detail::get<pathlimit_aborter<scalar>::state>(actor_states_lim);
+        pathlimit_aborter_state.set_path_limit(path_limit);
+
+        // Init propagator states
+        propagator_t::state state(track, bfield, det);
+        propagator_t::state lim_state(lim_track, bfield, det);
+
+        // Set step constraints
+        state._stepping.template set_constraint<step::constraint::e_accuracy>(
+            step_constr);
+        lim_state._stepping
+            .template set_constraint<step::constraint::e_accuracy>(step_constr);
+
+        // Propagate the entire detector
+        ASSERT_TRUE(
+            p.propagate(state, actor_chain_t::setup_actor_states(actor_states)))
+            << state._navigation.inspector().to_string() << std::endl;
+
+        // Propagate with path limit
+        ASSERT_FALSE(p.propagate(
+            lim_state, actor_chain_t::setup_actor_states(actor_states_lim)))
+            << lim_state._navigation.inspector().to_string() << std::endl;
+
+        ASSERT_GE(std::abs(path_limit), lim_state._stepping.abs_path_length())
+            << "Absolute path length: " << lim_state._stepping.abs_path_length()
+            << ", path limit: " << path_limit << std::endl;
+    }
+}
+
 /// Test propagation in an inhomogenous magnetic field using a Runge-Kutta
 /// stepper
 TEST_P(PropagatorWithRkStepper, rk4_propagator_inhom_bfield) {
@@ -382,6 +640,100 @@ TEST_P(PropagatorWithRkStepper, rk4_propagator_inhom_bfield) {
     }
 }
 
+/// Test the fast-forward through the gap volumes of the toy detector
+TEST_P(PropagatorWithRkStepper, rk4_fast_forward_gap_volumes) {
+
+    // Constant magnetic field type
+    using bfield_t = bfield::const_field_t<scalar>;
+
+    // Toy detector
+    using detector_t = detector<test::toy_metadata>;
+
+    // Runge-Kutta propagation
+    using navigator_t = navigator<detector_t, cache_size>;
+    using constraints_t = constrained_step<scalar>;
+    using policy_t = stepper_rk_policy<scalar>;
+    using stepper_t =
+        rk_stepper<bfield_t::view_t, test_algebra, constraints_t, policy_t>;
+    using actor_chain_t =
+        actor_chain<parameter_transporter<test_algebra>,
+                    pointwise_material_interactor<test_algebra>,
+                    parameter_resetter<test_algebra>, barcode_sequencer>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Build detector
+    toy_cfg.use_material_maps(false);
+    toy_cfg.mapped_material(detray::vacuum<scalar>());
+    const auto [det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    const bfield_t bfield =
+        bfield::create_const_field<scalar>(std::get<2>(GetParam()));
+
+    propagation::config cfg{};
+    cfg.navigation.overstep_tolerance = static_cast<float>(overstep_tol);
+    cfg.navigation.search_window = {3u, 3u};
+    propagator_t p{cfg};
+
+    propagation::config ff_cfg{cfg};
+    ff_cfg.navigation.fast_forward_gap_volumes = true;
+    propagator_t ff_p{ff_cfg};
+
+    vecmem::copy m_copy;
+
+    std::size_t n_trials{0u};
+    std::size_t n_ff_trials{0u};
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track : generator_t{trk_gen_cfg}) {
+
+        pointwise_material_interactor<test_algebra>::state interactor_state{};
+
+        vecmem::data::vector_buffer<detray::geometry::barcode> bcd_buffer{
+            100u, host_mr, vecmem::data::buffer_type::resizable};
+        vecmem::data::vector_buffer<detray::geometry::barcode> ff_bcd_buffer{
+            100u, host_mr, vecmem::data::buffer_type::resizable};
+        m_copy.setup(bcd_buffer)->wait();
+        m_copy.setup(ff_bcd_buffer)->wait();
+
+        barcode_sequencer::state seq_state(bcd_buffer);
+        barcode_sequencer::state ff_seq_state(ff_bcd_buffer);
+
+        auto actor_states = detray::tie(interactor_state, seq_state);
+        auto ff_actor_states = detray::tie(interactor_state, ff_seq_state);
+
+        propagator_t::state state(track, bfield, det);
+        propagator_t::state ff_state(track, bfield, det);
+
+        state._stepping.template set_constraint<step::constraint::e_accuracy>(
+            step_constr);
+        ff_state._stepping
+            .template set_constraint<step::constraint::e_accuracy>(step_constr);
+
+        ASSERT_TRUE(p.propagate(state, actor_states));
+        ASSERT_TRUE(ff_p.propagate(ff_state, ff_actor_states));
+
+        // The same surfaces are reached
+        ASSERT_EQ(ff_seq_state._sequence.size(), seq_state._sequence.size());
+        for (unsigned int i = 0u; i < seq_state._sequence.size(); ++i) {
+            ASSERT_EQ(ff_seq_state._sequence.at(i), seq_state._sequence.at(i));
+        }
+
+        // The track leaves the detector at the same position
+        const auto &pos = state._stepping().pos();
+        const auto &ff_pos = ff_state._stepping().pos();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            ASSERT_NEAR(ff_pos[i], pos[i], 10.f * unit<scalar>::um);
+        }
+
+        n_trials += state._stepping.n_total_trials();
+        n_ff_trials += ff_state._stepping.n_total_trials();
+    }
+
+    // Fewer steps are needed to cross the gap volumes
+    EXPECT_LT(n_ff_trials, n_trials);
+}
+
 // No step size constraint
 INSTANTIATE_TEST_SUITE_P(
     detray_propagator_validation1, PropagatorWithRkStepper,
@@ -459,6 +811,13 @@ TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, direct_navigator) {
     using direct_propagator_t =
         propagator<stepper_t, direct_navigator_t, actor_chain_t>;
 
+    // Direct navigation on the resolved surface sequence
+    using prefetch_navigator_t =
+        direct_navigator<detector_t, navigation::sequence_type::e_resolved>;
+    using prefetch_propagator_t =
+        propagator<stepper_t, prefetch_navigator_t, actor_chain_t>;
+    using sequence_entry_t = prefetch_navigator_t::sequence_entry;
+
     // Build toy detector
     toy_det_config<scalar> toy_cfg =
         toy_det_config<scalar>{}.n_brl_layers(4u).n_edc_layers(7u);
@@ -481,6 +840,7 @@ TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, direct_navigator) {
     direct_cfg.navigation.max_mask_tolerance = 1.f * unit<float>::mm;
     propagator_t p{cfg};
     direct_propagator_t direct_p{direct_cfg};
+    prefetch_propagator_t prefetch_p{direct_cfg};
 
     // Iterate through uniformly distributed momentum directions
     for (auto track : generator_t{trk_gen_cfg}) {
@@ -495,10 +855,14 @@ TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, direct_navigator) {
         vecmem::data::vector_buffer<detray::geometry::barcode>
             seqs_backward_buffer{100u, host_mr,
                                  vecmem::data::buffer_type::resizable};
+        vecmem::data::vector_buffer<detray::geometry::barcode>
+            seqs_prefetch_buffer{100u, host_mr,
+                                 vecmem::data::buffer_type::resizable};
         vecmem::copy m_copy;
         m_copy.setup(seqs_buffer)->wait();
         m_copy.setup(seqs_forward_buffer)->wait();
         m_copy.setup(seqs_backward_buffer)->wait();
+        m_copy.setup(seqs_prefetch_buffer)->wait();
 
         vecmem::device_vector<detray::geometry::barcode> seqs_device(
             seqs_buffer);
@@ -506,10 +870,13 @@ TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, direct_navigator) {
             seqs_forward_buffer);
         vecmem::device_vector<detray::geometry::barcode> seqs_backward_device(
             seqs_backward_buffer);
+        vecmem::device_vector<detray::geometry::barcode> seqs_prefetch_device(
+            seqs_prefetch_buffer);
 
         barcode_sequencer::state sequencer_state(seqs_device);
         barcode_sequencer::state sequencer_forward_state(seqs_forward_device);
         barcode_sequencer::state sequencer_backward_state(seqs_backward_device);
+        barcode_sequencer::state sequencer_prefetch_state(seqs_prefetch_device);
 
         auto actor_states = detray::tie(interactor_state, sequencer_state);
 
@@ -562,6 +929,33 @@ TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, direct_navigator) {
                 static_cast<float>(
                     direct_forward_state._stepping.bound_params().p(q)));
 
+            // Resolve the sequence up front and navigate it again
+            vecmem::vector<sequence_entry_t> entries(&host_mr);
+            prefetch_navigator_t::resolve(det, sequencer_state._sequence,
+                                          entries);
+            ASSERT_EQ(entries.size(), sequencer_state._sequence.size());
+
+            auto prefetch_actor_states =
+                detray::tie(interactor_state, sequencer_prefetch_state);
+            prefetch_propagator_t::state prefetch_state(
+                track, bfield, det, vecmem::get_data(entries));
+
+            ASSERT_TRUE(
+                prefetch_p.propagate(prefetch_state, prefetch_actor_states));
+            ASSERT_TRUE(prefetch_state._navigation.is_complete());
+            ASSERT_EQ(sequencer_state._sequence.size(),
+                      sequencer_prefetch_state._sequence.size());
+            for (unsigned int i = 0; i < sequencer_state._sequence.size();
+                 i++) {
+                ASSERT_EQ(sequencer_state._sequence.at(i),
+                          sequencer_prefetch_state._sequence.at(i));
+            }
+            ASSERT_FLOAT_EQ(
+                static_cast<float>(
+                    direct_forward_state._stepping.bound_params().p(q)),
+                static_cast<float>(
+                    prefetch_state._stepping.bound_params().p(q)));
+
             direct_propagator_t::state direct_backward_state(
                 direct_forward_state._stepping.bound_params(), bfield, det,
                 seqs_buffer);
@@ -592,6 +986,154 @@ TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, direct_navigator) {
     }
 }
 
+/// Test the replay of a recorded trajectory with the direct navigator
+TEST_P(PropagatorWithRkStepperDirectNavigatorToyDetector, trajectory_replay) {
+
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    // Track generator configuration
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.p_tot(10.f * unit<scalar>::GeV);
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using detector_t = detector<test::toy_metadata>;
+
+    using navigator_t = navigator<detector_t, cache_size>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra,
+                                 constrained_step<scalar>,
+                                 stepper_rk_policy<scalar>>;
+    using actor_chain_t =
+        actor_chain<parameter_transporter<test_algebra>,
+                    pointwise_material_interactor<test_algebra>,
+                    parameter_resetter<test_algebra>, barcode_sequencer,
+                    trajectory_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Replays the recorded trajectory
+    using replay_navigator_t =
+        direct_navigator<detector_t, navigation::sequence_type::e_trajectory>;
+    using replay_propagator_t =
+        propagator<stepper_t, replay_navigator_t, actor_chain_t>;
+    using point_t = navigation::trajectory_point;
+
+    toy_det_config<scalar> toy_cfg =
+        toy_det_config<scalar>{}.n_brl_layers(4u).n_edc_layers(7u);
+    toy_cfg.use_material_maps(false);
+    const auto [det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    const bfield_t bfield =
+        bfield::create_const_field<scalar>(std::get<1>(GetParam()));
+
+    propagation::config cfg{};
+    cfg.navigation.overstep_tolerance =
+        static_cast<float>(std::get<0>(GetParam()));
+    cfg.navigation.search_window = {3u, 3u};
+    propagation::config replay_cfg{};
+    replay_cfg.navigation.min_mask_tolerance = 1.f * unit<float>::mm;
+    replay_cfg.navigation.max_mask_tolerance = 1.f * unit<float>::mm;
+    propagator_t p{cfg};
+    replay_propagator_t replay_p{replay_cfg};
+
+    vecmem::copy m_copy;
+
+    for (auto track : generator_t{trk_gen_cfg}) {
+
+        pointwise_material_interactor<test_algebra>::state interactor_state{};
+
+        // Barcodes and trajectory of the the full navigation, the forward
+        // replay and the backward replay
+        std::array<vecmem::data::vector_buffer<detray::geometry::barcode>, 3>
+            bcd_buffers{};
+        std::array<vecmem::data::vector_buffer<point_t>, 3> traj_buffers{};
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            bcd_buffers[i] = {100u, host_mr,
+                              vecmem::data::buffer_type::resizable};
+            traj_buffers[i] = {100u, host_mr,
+                               vecmem::data::buffer_type::resizable};
+            m_copy.setup(bcd_buffers[i])->wait();
+            m_copy.setup(traj_buffers[i])->wait();
+        }
+
+        barcode_sequencer::state seq_state(bcd_buffers[0]);
+        barcode_sequencer::state seq_forward_state(bcd_buffers[1]);
+        barcode_sequencer::state seq_backward_state(bcd_buffers[2]);
+        trajectory_recorder::state rec_state(traj_buffers[0]);
+        trajectory_recorder::state rec_forward_state(traj_buffers[1]);
+        trajectory_recorder::state rec_backward_state(traj_buffers[2]);
+
+        // Record once
+        auto actor_states =
+            detray::tie(interactor_state, seq_state, rec_state);
+        propagator_t::state state(track, bfield, det);
+        ASSERT_TRUE(p.propagate(state, actor_states));
+
+        const auto &trajectory = rec_state._sequence;
+        ASSERT_FALSE(rec_state.overflow);
+        ASSERT_EQ(trajectory.size(), seq_state._sequence.size());
+        if (trajectory.size() == 0u) {
+            continue;
+        }
+        for (unsigned int i = 0u; i < trajectory.size(); ++i) {
+            ASSERT_EQ(trajectory.at(i).sf_index,
+                      seq_state._sequence.at(i).index());
+        }
+
+        // Replay forward
+        auto forward_actor_states = detray::tie(
+            interactor_state, seq_forward_state, rec_forward_state);
+        replay_propagator_t::state forward_state(track, bfield, det,
+                                                 traj_buffers[0]);
+        ASSERT_TRUE(replay_p.propagate(forward_state, forward_actor_states));
+        ASSERT_TRUE(forward_state._navigation.is_complete());
+
+        const auto &forward_trajectory = rec_forward_state._sequence;
+        ASSERT_EQ(forward_trajectory.size(), trajectory.size());
+        for (unsigned int i = 0u; i < trajectory.size(); ++i) {
+            ASSERT_EQ(seq_forward_state._sequence.at(i),
+                      seq_state._sequence.at(i));
+            ASSERT_EQ(forward_trajectory.at(i).sf_index,
+                      trajectory.at(i).sf_index);
+            // Both propagations stop within the path tolerance of every
+            // surface, so the difference can add up along the track
+            ASSERT_NEAR(forward_trajectory.at(i).path, trajectory.at(i).path,
+                        10.f * unit<float>::um);
+        }
+
+        const auto q = state._stepping.particle_hypothesis().charge();
+        ASSERT_FLOAT_EQ(
+            static_cast<float>(state._stepping.bound_params().p(q)),
+            static_cast<float>(forward_state._stepping.bound_params().p(q)));
+
+        // Replay backward
+        auto backward_actor_states = detray::tie(
+            interactor_state, seq_backward_state, rec_backward_state);
+        replay_propagator_t::state backward_state(
+            forward_state._stepping.bound_params(), bfield, det,
+            traj_buffers[0]);
+        backward_state._navigation.set_direction(
+            detray::navigation::direction::e_backward);
+        ASSERT_TRUE(replay_p.propagate(backward_state, backward_actor_states));
+        ASSERT_TRUE(backward_state._navigation.is_complete());
+
+        ASSERT_EQ(seq_backward_state._sequence.size(), trajectory.size());
+        for (unsigned int i = 0u; i < trajectory.size(); ++i) {
+            const unsigned int j{trajectory.size() - 1u - i};
+            ASSERT_EQ(seq_backward_state._sequence.at(j),
+                      seq_state._sequence.at(i));
+        }
+        ASSERT_NEAR(
+            static_cast<float>(track.p(q)),
+            static_cast<float>(backward_state._stepping.bound_params().p(q)),
+            static_cast<float>(track.p(q)) * 0.0002f);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     detray_propagator_direct_navigator_toy_detector,
     PropagatorWithRkStepperDirectNavigatorToyDetector,
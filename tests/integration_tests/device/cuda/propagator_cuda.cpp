@@ -14,6 +14,7 @@
 
 // Vecmem include(s)
 #include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/cuda/host_memory_resource.hpp>
 #include <vecmem/memory/cuda/managed_memory_resource.hpp>
 #include <vecmem/memory/host_memory_resource.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
@@ -181,3 +182,123 @@ TEST(CudaPropagatorValidation9, inhomogeneous_bfield_cpy) {
     run_propagation_test<bfield::cuda::inhom_bknd_t>(
         &mng_mr, det, cfg, detray::get_data(det_buff), std::move(field));
 }
+
+/// This tests the device propagation in an inhomogeneous magnetic field with
+/// half precision storage
+TEST(CudaPropagatorValidation10, inhomogeneous_bfield_fp16_cpy) {
+
+    // VecMem memory resource(s)
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+
+    vecmem::cuda::copy cuda_cpy;
+
+    // Test configuration
+    propagator_test_config cfg{};
+    cfg.track_generator.phi_steps(10u).theta_steps(10u);
+    cfg.track_generator.p_tot(10.f * unit<scalar>::GeV);
+    cfg.track_generator.eta_range(-3.f, 3.f);
+    cfg.propagation.navigation.search_window = {3u, 3u};
+
+    // Get the magnetic field
+    auto field = bfield::create_inhom_field_fp16();
+
+    // Create the toy geometry with inhomogeneous bfield from file
+    auto [det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    auto det_buff = detray::get_buffer(det, dev_mr, cuda_cpy);
+
+    run_propagation_test<bfield::cuda::inhom_bknd_fp16_t>(
+        &mng_mr, det, cfg, detray::get_data(det_buff), std::move(field));
+}
+
+/// This tests the asynchronous device propagation in chunks on multiple
+/// streams
+TEST(CudaPropagatorValidation11, const_bfield_async) {
+
+    // VecMem memory resource(s)
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::host_memory_resource pinned_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+
+    vecmem::cuda::copy cuda_cpy;
+
+    // Test configuration
+    propagator_test_config cfg{};
+    cfg.track_generator.phi_steps(20u).theta_steps(20u);
+    cfg.track_generator.p_tot(10.f * unit<scalar>::GeV);
+    cfg.track_generator.eta_range(-3.f, 3.f);
+    cfg.propagation.navigation.search_window = {3u, 3u};
+
+    // Get the magnetic field
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+    auto field = bfield::create_const_field<scalar>(B);
+
+    // Create the toy geometry
+    auto [det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    auto det_buff = detray::get_buffer(det, dev_mr, cuda_cpy);
+
+    // 400 tracks in chunks of 64 tracks on 3 streams (last chunk is partial)
+    run_async_propagation_test<bfield::const_bknd_t<scalar>>(
+        &pinned_mr, dev_mr, det, cfg, detray::get_data(det_buff),
+        std::move(field), 3u, 64u);
+}
+
+/// This tests the propagation with the tracks sharded over all devices
+TEST(CudaPropagatorValidation12, const_bfield_multi_device) {
+
+    // VecMem memory resource(s)
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::host_memory_resource pinned_mr;
+
+    // Test configuration
+    propagator_test_config cfg{};
+    cfg.track_generator.phi_steps(20u).theta_steps(20u);
+    cfg.track_generator.p_tot(10.f * unit<scalar>::GeV);
+    cfg.track_generator.eta_range(-3.f, 3.f);
+    cfg.propagation.navigation.search_window = {3u, 3u};
+
+    // Get the magnetic field
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+    auto field = bfield::create_const_field<scalar>(B);
+
+    // Create the toy geometry
+    auto [det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    // One replica of the detector per device
+    cuda::detector_replicas<decltype(det)> replicas(det);
+    ASSERT_GE(replicas.size(), 1u);
+
+    run_multi_device_propagation_test<bfield::const_bknd_t<scalar>>(
+        &pinned_mr, det, cfg, replicas, std::move(field));
+}
+
+/// This tests the wavefront propagation, with the stepping, the navigation
+/// and the actors in separate kernels
+TEST(CudaPropagatorValidation13, const_bfield_wavefront) {
+
+    // VecMem memory resource(s)
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    // Test configuration
+    propagator_test_config cfg{};
+    cfg.track_generator.phi_steps(20u).theta_steps(20u);
+    cfg.track_generator.p_tot(10.f * unit<scalar>::GeV);
+    cfg.track_generator.eta_range(-3.f, 3.f);
+    cfg.propagation.navigation.search_window = {3u, 3u};
+
+    // Get the magnetic field
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+    auto field = bfield::create_const_field<scalar>(B);
+
+    // Create the toy geometry
+    auto [det, names] = build_toy_detector<test_algebra>(mng_mr);
+
+    run_wavefront_propagation_test<bfield::const_bknd_t<scalar>>(
+        &mng_mr, det, cfg, detray::get_data(det), std::move(field));
+}
@@ -7,12 +7,42 @@
 
 // Project include(s)
 #include "detray/definitions/detail/cuda_definitions.hpp"
+#include "detray/propagator/wavefront_propagation.hpp"
 
 // Detray test include(s)
+#include "detray/test/device/cuda/jagged_compaction.hpp"
 #include "propagator_cuda_kernel.hpp"
 
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_buffer.hpp>
+
+// System include(s)
+#include <new>
+#include <utility>
+
 namespace detray {
 
+namespace {
+
+template <typename detector_t>
+using device_detector_t =
+    detector<typename detector_t::metadata, device_container_types>;
+
+template <typename bfield_bknd_t, typename detector_t>
+using device_propagator_t =
+    propagator<rk_stepper_t<covfie::field_view<bfield_bknd_t>>,
+               navigator_t<device_detector_t<detector_t>>,
+               actor_chain_device_t>;
+
+template <typename bfield_bknd_t, typename detector_t>
+using wavefront_view_t =
+    propagation::wavefront_view<device_propagator_t<bfield_bknd_t, detector_t>>;
+
+/// Stages of the wavefront propagation that run in separate kernels
+enum class wavefront_stage { e_step, e_navigate, e_actors, e_compact };
+
+}  // anonymous namespace
+
 template <typename bfield_bknd_t, typename detector_t>
 __global__ void propagator_test_kernel(
     typename detector_t::view_type det_data, const propagation::config cfg,
@@ -66,6 +96,81 @@ __global__ void propagator_test_kernel(
     p.propagate(state, actor_states);
 }
 
+/// Set up the propagation and actor states of every track in global memory
+/// and initialize the propagation
+template <typename bfield_bknd_t, typename detector_t>
+__global__ void wavefront_init_kernel(
+    typename detector_t::view_type det_data, const propagation::config cfg,
+    covfie::field_view<bfield_bknd_t> field_data,
+    vecmem::data::vector_view<test_track> tracks_data,
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>
+        steps_data,
+    wavefront_view_t<bfield_bknd_t, detector_t> view) {
+
+    using propagator_device_t = device_propagator_t<bfield_bknd_t, detector_t>;
+    using view_t = wavefront_view_t<bfield_bknd_t, detector_t>;
+    using state_t = typename view_t::state_type;
+    using actor_states_t = typename view_t::actor_states_type;
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+
+    vecmem::device_vector<test_track> tracks(tracks_data);
+    if (gid >= tracks.size()) {
+        return;
+    }
+
+    device_detector_t<detector_t> det(det_data);
+    vecmem::jagged_device_vector<detail::step_data<test_algebra>> steps(
+        steps_data);
+    vecmem::device_vector<state_t> states(view.states);
+    vecmem::device_vector<actor_states_t> actor_states(view.actor_states);
+
+    // Construct the states in place
+    step_tracer_device_t::state tracer_state(steps.at(gid));
+    tracer_state.collect_only_on_surface(true);
+    new (&actor_states[gid]) actor_states_t(
+        std::move(tracer_state),
+        pathlimit_aborter_t::state{cfg.stepping.path_limit},
+        pointwise_material_interactor<test_algebra>::state{});
+
+    state_t *state = new (&states[gid]) state_t(tracks[gid], field_data, det);
+    state->_stepping.template set_constraint<step::constraint::e_accuracy>(
+        cfg.stepping.step_constraint);
+
+    const propagator_device_t p{cfg};
+    propagation::wavefront::init(p, view, det, gid);
+}
+
+/// Run one stage of the wavefront propagation for all active tracks
+template <wavefront_stage stage, typename bfield_bknd_t, typename detector_t>
+__global__ void wavefront_stage_kernel(
+    typename detector_t::view_type det_data, const propagation::config cfg,
+    wavefront_view_t<bfield_bknd_t, detector_t> view,
+    const unsigned int n_active) {
+
+    using propagator_device_t = device_propagator_t<bfield_bknd_t, detector_t>;
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= n_active) {
+        return;
+    }
+
+    if constexpr (stage == wavefront_stage::e_compact) {
+        propagation::wavefront::compact(view, gid);
+    } else {
+        device_detector_t<detector_t> det(det_data);
+        const propagator_device_t p{cfg};
+
+        if constexpr (stage == wavefront_stage::e_step) {
+            propagation::wavefront::step(p, view, det, gid);
+        } else if constexpr (stage == wavefront_stage::e_navigate) {
+            propagation::wavefront::navigate(p, view, det, gid);
+        } else {
+            propagation::wavefront::run_actors(p, view, det, gid);
+        }
+    }
+}
+
 /// Launch the device kernel
 template <typename bfield_bknd_t, typename detector_t>
 void propagator_test(
@@ -73,21 +178,118 @@ void propagator_test(
     covfie::field_view<bfield_bknd_t> field_data,
     vecmem::data::vector_view<test_track>& tracks_data,
     vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&
-        step_data) {
+        step_data,
+    vecmem::cuda::stream_wrapper* stream) {
 
     constexpr int thread_dim = 2 * WARP_SIZE;
     int block_dim = tracks_data.size() / thread_dim + 1;
 
+    cudaStream_t cuda_stream{
+        stream ? static_cast<cudaStream_t>(stream->stream()) : nullptr};
+
     // run the test kernel
     propagator_test_kernel<bfield_bknd_t, detector_t>
-        <<<block_dim, thread_dim>>>(det_view, cfg, field_data, tracks_data,
-                                    step_data);
+        <<<block_dim, thread_dim, 0, cuda_stream>>>(
+            det_view, cfg, field_data, tracks_data, step_data);
 
     // cuda error check
     DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    if (!stream) {
+        DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+    }
+}
+
+/// Launch the kernels of the wavefront propagation
+template <typename bfield_bknd_t, typename detector_t>
+void propagator_wavefront_test(
+    typename detector_t::view_type det_view, const propagation::config& cfg,
+    covfie::field_view<bfield_bknd_t> field_data,
+    vecmem::data::vector_view<test_track>& tracks_data,
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&
+        step_data,
+    vecmem::memory_resource& mr) {
+
+    using view_t = wavefront_view_t<bfield_bknd_t, detector_t>;
+
+    const unsigned int n_tracks{tracks_data.size()};
+    if (n_tracks == 0u) {
+        return;
+    }
+
+    // Per-track data that is kept between the kernels
+    vecmem::data::vector_buffer<typename view_t::state_type> states(n_tracks,
+                                                                    mr);
+    vecmem::data::vector_buffer<typename view_t::actor_states_type>
+        actor_states(n_tracks, mr);
+    vecmem::data::vector_buffer<unsigned int> is_init(n_tracks, mr);
+    vecmem::data::vector_buffer<dindex> queue(n_tracks, mr);
+    vecmem::data::vector_buffer<dindex> next_queue(n_tracks, mr);
+    vecmem::data::vector_buffer<unsigned int> n_next(1u, mr);
+
+    view_t view{states, actor_states, is_init, queue, next_queue, n_next};
+
+    constexpr unsigned int thread_dim{2u * WARP_SIZE};
+    const auto block_dim = [](const unsigned int n) {
+        return n / thread_dim + 1u;
+    };
+
+    wavefront_init_kernel<bfield_bknd_t, detector_t>
+        <<<block_dim(n_tracks), thread_dim>>>(det_view, cfg, field_data,
+                                              tracks_data, step_data, view);
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+    // Move the tracks that are still alive to the front of the next queue
+    unsigned int n_active{n_tracks};
+    const auto compact_queue = [&]() {
+        DETRAY_CUDA_ERROR_CHECK(
+            cudaMemset(n_next.ptr(), 0, sizeof(unsigned int)));
+        wavefront_stage_kernel<wavefront_stage::e_compact, bfield_bknd_t,
+                               detector_t>
+            <<<block_dim(n_active), thread_dim>>>(det_view, cfg, view,
+                                                  n_active);
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+        std::swap(view.queue, view.next_queue);
+        DETRAY_CUDA_ERROR_CHECK(cudaMemcpy(&n_active, n_next.ptr(),
+                                           sizeof(unsigned int),
+                                           cudaMemcpyDeviceToHost));
+    };
+    compact_queue();
+
+    // Every stage is a separate kernel on the active tracks only
+    while (n_active > 0u) {
+        wavefront_stage_kernel<wavefront_stage::e_step, bfield_bknd_t,
+                               detector_t>
+            <<<block_dim(n_active), thread_dim>>>(det_view, cfg, view,
+                                                  n_active);
+        wavefront_stage_kernel<wavefront_stage::e_navigate, bfield_bknd_t,
+                               detector_t>
+            <<<block_dim(n_active), thread_dim>>>(det_view, cfg, view,
+                                                  n_active);
+        wavefront_stage_kernel<wavefront_stage::e_actors, bfield_bknd_t,
+                               detector_t>
+            <<<block_dim(n_active), thread_dim>>>(det_view, cfg, view,
+                                                  n_active);
+        DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+
+        compact_queue();
+    }
+
     DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 }
 
+vecmem::jagged_vector<detail::step_data<test_algebra>> copy_compacted_steps(
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&
+        steps_view,
+    vecmem::memory_resource& dev_mr, vecmem::memory_resource& host_mr,
+    vecmem::cuda::stream_wrapper* stream) {
+
+    cudaStream_t cuda_stream{
+        stream ? static_cast<cudaStream_t>(stream->stream()) : nullptr};
+
+    return cuda::copy_compacted<detail::step_data<test_algebra>>(
+        steps_view, dev_mr, host_mr, cuda_stream);
+}
+
 /// Explicit instantiation for a constant magnetic field
 template void
 propagator_test<bfield::const_bknd_t<dscalar<test_algebra>>,
@@ -96,7 +298,20 @@ propagator_test<bfield::const_bknd_t<dscalar<test_algebra>>,
     const propagation::config&,
     covfie::field_view<bfield::const_bknd_t<dscalar<test_algebra>>>,
     vecmem::data::vector_view<test_track>&,
-    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&);
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&,
+    vecmem::cuda::stream_wrapper*);
+
+/// Explicit instantiation of the wavefront propagation for a constant
+/// magnetic field
+template void propagator_wavefront_test<
+    bfield::const_bknd_t<dscalar<test_algebra>>,
+    detector<toy_metadata<test_algebra>, host_container_types>>(
+    detector<toy_metadata<test_algebra>, host_container_types>::view_type,
+    const propagation::config&,
+    covfie::field_view<bfield::const_bknd_t<dscalar<test_algebra>>>,
+    vecmem::data::vector_view<test_track>&,
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&,
+    vecmem::memory_resource&);
 
 /// Explicit instantiation for an inhomogeneous magnetic field
 template void
@@ -105,6 +320,19 @@ propagator_test<bfield::cuda::inhom_bknd_t,
     detector<toy_metadata<test_algebra>, host_container_types>::view_type,
     const propagation::config&, covfie::field_view<bfield::cuda::inhom_bknd_t>,
     vecmem::data::vector_view<test_track>&,
-    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&);
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&,
+    vecmem::cuda::stream_wrapper*);
+
+/// Explicit instantiation for an inhomogeneous magnetic field with half
+/// precision storage
+template void
+propagator_test<bfield::cuda::inhom_bknd_fp16_t,
+                detector<toy_metadata<test_algebra>, host_container_types>>(
+    detector<toy_metadata<test_algebra>, host_container_types>::view_type,
+    const propagation::config&,
+    covfie::field_view<bfield::cuda::inhom_bknd_fp16_t>,
+    vecmem::data::vector_view<test_track>&,
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>&,
+    vecmem::cuda::stream_wrapper*);
 
 }  // namespace detray
@@ -12,15 +12,27 @@
 #include "detray/detectors/toy_metadata.hpp"
 
 // Detray test include(s)
+#include "detray/test/device/cuda/managed_prefetch.hpp"
+#include "detray/test/device/cuda/multi_device.hpp"
 #include "detray/test/device/propagator_test.hpp"
 
 // Vecmem include(s)
+#include <vecmem/containers/data/jagged_vector_buffer.hpp>
+#include <vecmem/containers/data/vector_buffer.hpp>
 #include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/utils/cuda/async_copy.hpp>
 #include <vecmem/utils/cuda/copy.hpp>
+#include <vecmem/utils/cuda/stream_wrapper.hpp>
 
 // Covfie include(s)
 #include <covfie/cuda/backend/primitive/cuda_device_array.hpp>
 
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
 namespace detray {
 
 using scalar = test::scalar;
@@ -33,14 +45,46 @@ using inhom_bknd_t = covfie::backend::affine<covfie::backend::linear<
                              covfie::backend::cuda_device_array<
                                  covfie::vector::vector_d<scalar, 3>>>>>;
 
+// Inhomogeneous field with half precision storage (cuda)
+using inhom_bknd_fp16_t = covfie::backend::affine<covfie::backend::linear<
+    covfie::backend::strided<covfie::vector::vector_d<std::size_t, 3>,
+                             covfie::backend::cuda_device_array<
+                                 covfie::vector::vector_d<float16, 3>>>>>;
+
 }  // namespace bfield::cuda
 
 /// Launch the propagation test kernel
+///
+/// @note Synchronizes the device, unless a stream is given
 template <typename bfield_bknd_t, typename detector_t>
 void propagator_test(
     typename detector_t::view_type, const propagation::config &,
     covfie::field_view<bfield_bknd_t>, vecmem::data::vector_view<test_track> &,
-    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>> &);
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>> &,
+    vecmem::cuda::stream_wrapper *stream = nullptr);
+
+/// Launch the kernels of the wavefront propagation, in which the stepping,
+/// the navigation update and the actors run in separate kernels on the active
+/// tracks. The states of the tracks are allocated in @param mr
+///
+/// @note Synchronizes the device
+template <typename bfield_bknd_t, typename detector_t>
+void propagator_wavefront_test(
+    typename detector_t::view_type, const propagation::config &,
+    covfie::field_view<bfield_bknd_t>, vecmem::data::vector_view<test_track> &,
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>> &,
+    vecmem::memory_resource &mr);
+
+/// Copy the recorded steps in @param steps_view to the host, without the
+/// unused capacity of the step buffers
+///
+/// @note Synchronizes the stream @param stream (the default stream if none is
+/// given)
+vecmem::jagged_vector<detail::step_data<test_algebra>> copy_compacted_steps(
+    vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>
+        &steps_view,
+    vecmem::memory_resource &dev_mr, vecmem::memory_resource &host_mr,
+    vecmem::cuda::stream_wrapper *stream = nullptr);
 
 /// Test function for propagator on the device
 template <typename bfield_bknd_t, typename detector_t>
@@ -72,6 +116,16 @@ inline auto run_propagation_device(
 
     copy.setup(steps_buffer)->wait();
 
+    // Migrate managed memory before the kernel, instead of on page faults
+    // (does nothing for device memory)
+    const int device{cuda::current_device()};
+    cuda::prefetch_detector(det_view, device);
+    cuda::prefetch_tracks(tracks_data, device);
+    cuda::prefetch_tracks(
+        vecmem::data::jagged_vector_view<detail::step_data<test_algebra>>{
+            steps_buffer},
+        device);
+
     // Run the propagator test for GPU device
     propagator_test<bfield_bknd_t, detector_t>(det_view, cfg, field_data,
                                                tracks_data, steps_buffer);
@@ -83,6 +137,233 @@ inline auto run_propagation_device(
     return steps;
 }
 
+/// Test function for the wavefront propagation on the device
+template <typename bfield_bknd_t, typename detector_t>
+inline auto run_propagation_device_wavefront(
+    vecmem::memory_resource *mr, const propagation::config &cfg,
+    typename detector_t::view_type det_view,
+    covfie::field_view<bfield_bknd_t> field_data, dvector<test_track> &tracks,
+    const vecmem::jagged_vector<detail::step_data<test_algebra>> &host_steps)
+    -> vecmem::jagged_vector<detail::step_data<test_algebra>> {
+
+    vecmem::copy copy;
+
+    auto tracks_data = vecmem::get_data(tracks);
+
+    // Step recording, with a few more elements in case the device finds more
+    // surfaces
+    std::vector<std::size_t> capacities;
+    for (auto &st : host_steps) {
+        capacities.push_back(st.size() + 10u);
+    }
+
+    vecmem::data::jagged_vector_buffer<detail::step_data<test_algebra>>
+        steps_buffer(capacities, *mr, nullptr,
+                     vecmem::data::buffer_type::resizable);
+
+    copy.setup(steps_buffer)->wait();
+
+    propagator_wavefront_test<bfield_bknd_t, detector_t>(
+        det_view, cfg, field_data, tracks_data, steps_buffer, *mr);
+
+    vecmem::jagged_vector<detail::step_data<test_algebra>> steps(mr);
+
+    copy(steps_buffer, steps)->wait();
+
+    return steps;
+}
+
+/// Test function for the asynchronous propagation on the device
+///
+/// The tracks are split into chunks of @param chunk_size tracks, which are
+/// distributed round-robin over @param n_streams CUDA streams. The
+/// host-to-device copy, the propagation and the device-to-host copy of a
+/// chunk are enqueued on the same stream, so that the transfers of one chunk
+/// overlap with the propagation of the others. Only the used entries of the
+/// step buffers are copied back.
+///
+/// @note @param mr should be pinned host memory for the copies to be
+/// asynchronous. The step buffers are allocated in @param dev_mr.
+template <typename bfield_bknd_t, typename detector_t>
+inline auto run_propagation_device_async(
+    vecmem::memory_resource *mr, vecmem::memory_resource &dev_mr,
+    const propagation::config &cfg, typename detector_t::view_type det_view,
+    covfie::field_view<bfield_bknd_t> field_data,
+    const dvector<test_track> &tracks,
+    const vecmem::jagged_vector<detail::step_data<test_algebra>> &host_steps,
+    const std::size_t n_streams, const std::size_t chunk_size)
+    -> vecmem::jagged_vector<detail::step_data<test_algebra>> {
+
+    using step_t = detail::step_data<test_algebra>;
+
+    assert(n_streams > 0u);
+    assert(chunk_size > 0u);
+    assert(tracks.size() == host_steps.size());
+
+    // One copy object per stream
+    std::vector<vecmem::cuda::stream_wrapper> streams{};
+    std::vector<vecmem::cuda::async_copy> copies{};
+    streams.reserve(n_streams);
+    copies.reserve(n_streams);
+    for (std::size_t i = 0u; i < n_streams; ++i) {
+        copies.emplace_back(streams.emplace_back());
+    }
+
+    // Device data of a chunk: Needs to stay alive until its stream is done
+    struct chunk_data {
+        vecmem::data::vector_buffer<test_track> tracks;
+        vecmem::data::jagged_vector_buffer<step_t> steps;
+    };
+
+    const std::size_t n_chunks{(tracks.size() + chunk_size - 1u) /
+                               chunk_size};
+    std::vector<chunk_data> chunks{};
+    chunks.reserve(n_chunks);
+
+    // Enqueue the upload and the propagation of all chunks before waiting for
+    // any results
+    for (std::size_t c = 0u; c < n_chunks; ++c) {
+        const std::size_t begin{c * chunk_size};
+        const std::size_t n{std::min(chunk_size, tracks.size() - begin)};
+        vecmem::cuda::async_copy &copy = copies[c % n_streams];
+
+        // Capacities of the step recording (with a few more elements in case
+        // the device finds more surfaces)
+        std::vector<std::size_t> capacities;
+        for (std::size_t i = begin; i < begin + n; ++i) {
+            capacities.push_back(host_steps[i].size() + 10u);
+        }
+
+        chunk_data &chunk = chunks.emplace_back(
+            vecmem::data::vector_buffer<test_track>(
+                static_cast<unsigned int>(n), dev_mr),
+            vecmem::data::jagged_vector_buffer<step_t>(
+                capacities, dev_mr, mr, vecmem::data::buffer_type::resizable));
+
+        // Host-to-device copy of the tracks of the chunk
+        const vecmem::data::vector_view<const test_track> tracks_view(
+            static_cast<unsigned int>(n), tracks.data() + begin);
+        copy(tracks_view, chunk.tracks, vecmem::copy::type::host_to_device);
+        copy.setup(chunk.steps);
+
+        // Propagation
+        vecmem::data::vector_view<test_track> chunk_tracks_view{chunk.tracks};
+        vecmem::data::jagged_vector_view<step_t> chunk_steps_view{chunk.steps};
+        propagator_test<bfield_bknd_t, detector_t>(
+            det_view, cfg, field_data, chunk_tracks_view, chunk_steps_view,
+            &streams[c % n_streams]);
+    }
+
+    // Device-to-host copy of the results: Waits only for the stream of the
+    // respective chunk, while the other streams keep propagating
+    vecmem::jagged_vector<step_t> steps(mr);
+    steps.reserve(tracks.size());
+    for (std::size_t c = 0u; c < n_chunks; ++c) {
+        vecmem::data::jagged_vector_view<step_t> chunk_steps_view{
+            chunks[c].steps};
+        vecmem::jagged_vector<step_t> chunk_steps{copy_compacted_steps(
+            chunk_steps_view, dev_mr, *mr, &streams[c % n_streams])};
+
+        for (auto &trk_steps : chunk_steps) {
+            steps.push_back(std::move(trk_steps));
+        }
+    }
+
+    for (auto &stream : streams) {
+        stream.synchronize();
+    }
+
+    return steps;
+}
+
+/// Test function for the propagation on several devices
+///
+/// The tracks are split into one contiguous shard per detector replica. The
+/// upload, the propagation and the device-to-host copy of a shard are
+/// enqueued on the stream of its device, so that all devices propagate
+/// concurrently. The results are collected in the order of the tracks.
+///
+/// @note The magnetic field view @param field_data has to be usable on all
+/// devices (e.g. a constant field). @param mr should be pinned host memory.
+template <typename bfield_bknd_t, typename detector_t>
+inline auto run_propagation_multi_device(
+    vecmem::memory_resource *mr, const propagation::config &cfg,
+    cuda::detector_replicas<detector_t> &replicas,
+    covfie::field_view<bfield_bknd_t> field_data,
+    const dvector<test_track> &tracks,
+    const vecmem::jagged_vector<detail::step_data<test_algebra>> &host_steps)
+    -> vecmem::jagged_vector<detail::step_data<test_algebra>> {
+
+    using step_t = detail::step_data<test_algebra>;
+
+    assert(tracks.size() == host_steps.size());
+
+    const std::vector<cuda::shard_range> shards{
+        cuda::make_shards(tracks.size(), replicas.size())};
+
+    // Device data of a shard: Needs to stay alive until its stream is done
+    struct shard_data {
+        vecmem::data::vector_buffer<test_track> tracks;
+        vecmem::data::jagged_vector_buffer<step_t> steps;
+    };
+    std::vector<shard_data> shard_buffers{};
+    shard_buffers.reserve(shards.size());
+
+    // Enqueue the work of all devices before waiting for any results
+    cuda::for_each_device(replicas, [&](const std::size_t i, auto &rep) {
+        const auto [begin, n] = shards[i];
+
+        std::vector<std::size_t> capacities;
+        for (std::size_t j = begin; j < begin + n; ++j) {
+            capacities.push_back(host_steps[j].size() + 10u);
+        }
+
+        shard_data &shard = shard_buffers.emplace_back(
+            vecmem::data::vector_buffer<test_track>(
+                static_cast<unsigned int>(n), rep.mr),
+            vecmem::data::jagged_vector_buffer<step_t>(
+                capacities, rep.mr, mr, vecmem::data::buffer_type::resizable));
+
+        if (n == 0u) {
+            return;
+        }
+
+        const vecmem::data::vector_view<const test_track> tracks_view(
+            static_cast<unsigned int>(n), tracks.data() + begin);
+        rep.copy(tracks_view, shard.tracks,
+                 vecmem::copy::type::host_to_device);
+        rep.copy.setup(shard.steps);
+
+        vecmem::data::vector_view<test_track> shard_tracks_view{shard.tracks};
+        vecmem::data::jagged_vector_view<step_t> shard_steps_view{shard.steps};
+        propagator_test<bfield_bknd_t, detector_t>(
+            rep.view(), cfg, field_data, shard_tracks_view, shard_steps_view,
+            &rep.stream);
+    });
+
+    // Collect the results in the order of the shards
+    vecmem::jagged_vector<step_t> steps(mr);
+    steps.reserve(tracks.size());
+    cuda::for_each_device(replicas, [&](const std::size_t i, auto &rep) {
+        if (shards[i].size == 0u) {
+            return;
+        }
+
+        vecmem::data::jagged_vector_view<step_t> shard_steps_view{
+            shard_buffers[i].steps};
+        vecmem::jagged_vector<step_t> shard_steps{copy_compacted_steps(
+            shard_steps_view, rep.mr, *mr, &rep.stream)};
+
+        for (auto &trk_steps : shard_steps) {
+            steps.push_back(std::move(trk_steps));
+        }
+    });
+
+    replicas.synchronize();
+
+    return steps;
+}
+
 /// Test chain for the propagator
 template <typename device_bfield_bknd_t, typename host_bfield_bknd_t,
           typename detector_t>
@@ -110,4 +391,86 @@ inline auto run_propagation_test(vecmem::memory_resource *mr, detector_t &det,
     compare_propagation_results(host_steps, device_steps);
 }
 
+/// Test chain for the wavefront propagation on the device
+template <typename device_bfield_bknd_t, typename host_bfield_bknd_t,
+          typename detector_t>
+inline auto run_wavefront_propagation_test(
+    vecmem::memory_resource *mr, detector_t &det,
+    const propagator_test_config &cfg, typename detector_t::view_type det_view,
+    covfie::field<host_bfield_bknd_t> &&field) {
+
+    // Create the vector of initial track parameterizations
+    auto tracks_host = generate_tracks<generator_t>(mr, cfg.track_generator);
+    vecmem::vector<test_track> tracks_device(tracks_host, mr);
+
+    // Host propagation
+    auto host_steps =
+        run_propagation_host(mr, det, cfg.propagation, field, tracks_host);
+
+    // Device propagation, one kernel per stage
+    covfie::field<device_bfield_bknd_t> device_field(field);
+    auto device_steps =
+        run_propagation_device_wavefront<device_bfield_bknd_t, detector_t>(
+            mr, cfg.propagation, det_view, device_field, tracks_device,
+            host_steps);
+
+    // Check the results
+    compare_propagation_results(host_steps, device_steps);
+}
+
+/// Test chain for the asynchronous device propagation
+template <typename device_bfield_bknd_t, typename host_bfield_bknd_t,
+          typename detector_t>
+inline auto run_async_propagation_test(
+    vecmem::memory_resource *mr, vecmem::memory_resource &dev_mr,
+    detector_t &det, const propagator_test_config &cfg,
+    typename detector_t::view_type det_view,
+    covfie::field<host_bfield_bknd_t> &&field, const std::size_t n_streams,
+    const std::size_t chunk_size) {
+
+    // Create the vector of initial track parameterizations
+    auto tracks_host = generate_tracks<generator_t>(mr, cfg.track_generator);
+
+    // Host propagation
+    auto host_steps =
+        run_propagation_host(mr, det, cfg.propagation, field, tracks_host);
+
+    // Device propagation in chunks on multiple streams
+    covfie::field<device_bfield_bknd_t> device_field(field);
+    auto device_steps =
+        run_propagation_device_async<device_bfield_bknd_t, detector_t>(
+            mr, dev_mr, cfg.propagation, det_view, device_field, tracks_host,
+            host_steps, n_streams, chunk_size);
+
+    // Check the results
+    compare_propagation_results(host_steps, device_steps);
+}
+
+/// Test chain for the propagation on several devices
+template <typename device_bfield_bknd_t, typename host_bfield_bknd_t,
+          typename detector_t>
+inline auto run_multi_device_propagation_test(
+    vecmem::memory_resource *mr, detector_t &det,
+    const propagator_test_config &cfg,
+    cuda::detector_replicas<detector_t> &replicas,
+    covfie::field<host_bfield_bknd_t> &&field) {
+
+    // Create the vector of initial track parameterizations
+    auto tracks_host = generate_tracks<generator_t>(mr, cfg.track_generator);
+
+    // Host propagation
+    auto host_steps =
+        run_propagation_host(mr, det, cfg.propagation, field, tracks_host);
+
+    // Device propagation with one shard of the tracks per device
+    covfie::field<device_bfield_bknd_t> device_field(field);
+    auto device_steps =
+        run_propagation_multi_device<device_bfield_bknd_t, detector_t>(
+            mr, cfg.propagation, replicas, device_field, tracks_host,
+            host_steps);
+
+    // Check the results
+    compare_propagation_results(host_steps, device_steps);
+}
+
 }  // namespace detray
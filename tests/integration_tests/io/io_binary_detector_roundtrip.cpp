@@ -0,0 +1,181 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+
+// Detray IO include(s)
+#include "detray/io/binary/binary_io.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+
+// Detray test include(s)
+#include "detray/test/cpu/toy_detector_test.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/detectors/build_wire_chamber.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+using namespace detray;
+
+namespace {
+
+/// Write @param det to a binary file and map it back in
+/// @returns the mapped detector
+template <typename detector_t>
+auto test_detector_binary_io(const detector_t& det,
+                             const typename detector_t::name_map& names) {
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::binary)
+                          .replace_files(true);
+    io::write_detector(det, names, writer_cfg);
+
+    const std::string file_name{names.at(0u) + "_detector.bin"};
+    EXPECT_TRUE(std::filesystem::exists(file_name));
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.verbose_check(true);
+
+    auto mapped_det = io::map_detector<detector_t>(file_name, reader_cfg);
+    const auto& det_io = mapped_det.get();
+
+    // The data is the same, bit by bit
+    EXPECT_EQ(mapped_det.names(), names);
+    EXPECT_EQ(det_io.volumes().size(), det.volumes().size());
+    EXPECT_EQ(det_io.surfaces().size(), det.surfaces().size());
+    EXPECT_EQ(det_io.transform_store().size(), det.transform_store().size());
+
+    for (std::size_t i = 0u; i < det.surfaces().size(); ++i) {
+        EXPECT_EQ(det_io.surfaces()[i], det.surfaces()[i]);
+    }
+    for (std::size_t i = 0u; i < det.volumes().size(); ++i) {
+        EXPECT_EQ(det_io.volumes()[i], det.volumes()[i]);
+    }
+
+    return mapped_det;
+}
+
+}  // anonymous namespace
+
+/// Test the binary writing and mapping of the toy detector
+GTEST_TEST(io, binary_toy_detector_roundtrip) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    const auto mapped_det = test_detector_binary_io(toy_det, toy_names);
+
+    EXPECT_TRUE(toy_detector_test(mapped_det.get(), mapped_det.names()));
+}
+
+/// Test the binary writing and mapping of the wire chamber
+GTEST_TEST(io, binary_wire_chamber_roundtrip) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Wire chamber
+    vecmem::host_memory_resource host_mr;
+    wire_chamber_config<scalar> wire_cfg{};
+    const auto [wire_det, wire_names] =
+        build_wire_chamber<test_algebra>(host_mr, wire_cfg);
+
+    const auto mapped_det = test_detector_binary_io(wire_det, wire_names);
+
+    EXPECT_EQ(mapped_det.get().volumes().size(), 11u);
+
+    // The file does not match a different detector type
+    using toy_detector_t = detector<test::toy_metadata>;
+    EXPECT_THROW(io::map_detector<toy_detector_t>("wire_chamber_detector.bin"),
+                 std::runtime_error);
+}
+
+/// Test the layout signatures of the binary element types
+GTEST_TEST(io, binary_type_signature) {
+
+    using io::detail::binary_type_signature;
+
+    // Same size, but different types
+    static_assert(sizeof(float) == sizeof(std::int32_t));
+    EXPECT_NE(binary_type_signature<float>(),
+              binary_type_signature<std::int32_t>());
+    EXPECT_NE(binary_type_signature<std::uint32_t>(),
+              binary_type_signature<std::int32_t>());
+
+    // The constness of the view does not change the layout
+    EXPECT_EQ(binary_type_signature<const float>(),
+              binary_type_signature<float>());
+}
+
+/// Test sharing the toy detector through shared memory
+GTEST_TEST(io, shared_toy_detector) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using detector_t = detector<test::toy_metadata>;
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    // Unique segment name per test process
+    const std::string segment_name{"/detray_toy_" +
+                                   std::to_string(::getpid())};
+
+    {
+        const auto owner =
+            io::share_detector(toy_det, toy_names, segment_name);
+        EXPECT_TRUE(owner.is_owner());
+
+        // The name is taken
+        EXPECT_THROW(io::share_detector(toy_det, toy_names, segment_name),
+                     std::runtime_error);
+
+        // Attach as another process would
+        io::detector_reader_config reader_cfg{};
+        const auto shared_det =
+            io::attach_detector<detector_t>(segment_name, reader_cfg);
+        const auto& det_shm = shared_det.get();
+
+        EXPECT_FALSE(shared_det.is_owner());
+        EXPECT_EQ(shared_det.size(), owner.size());
+        EXPECT_EQ(shared_det.names(), toy_names);
+        ASSERT_EQ(det_shm.surfaces().size(), toy_det.surfaces().size());
+        for (std::size_t i = 0u; i < toy_det.surfaces().size(); ++i) {
+            EXPECT_EQ(det_shm.surfaces()[i], toy_det.surfaces()[i]);
+        }
+
+        EXPECT_TRUE(toy_detector_test(det_shm, shared_det.names()));
+    }
+
+    // The owner removed the segment
+    EXPECT_THROW(io::attach_detector<detector_t>(segment_name),
+                 std::runtime_error);
+    EXPECT_THROW(io::attach_detector<detector_t>("no_slash"),
+                 std::invalid_argument);
+}
@@ -0,0 +1,133 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/geometry/surface.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_extractor.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/utils/consistency_checker.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// @returns the number of surfaces in the volume @param vol_idx of @param det
+template <typename detector_t>
+auto n_surfaces(const detector_t& det, const dindex vol_idx) {
+    return std::ranges::count_if(det.surfaces(), [vol_idx](const auto& sf) {
+        return sf.volume() == vol_idx;
+    });
+}
+
+/// Compare the extracted detector @param sub_det to the volumes
+/// @param volumes of the detector @param det
+template <typename detector_t>
+void check_extraction(const detector_t& det,
+                      const typename detector_t::name_map& names,
+                      const detector_t& sub_det,
+                      const typename detector_t::name_map& sub_names,
+                      const std::vector<dindex>& volumes) {
+
+    ASSERT_EQ(sub_det.volumes().size(), volumes.size());
+    EXPECT_EQ(sub_names.at(0u), names.at(0u));
+
+    for (dindex i = 0u; i < volumes.size(); ++i) {
+        EXPECT_EQ(sub_det.volumes()[i].index(), i);
+        EXPECT_EQ(sub_names.at(i + 1u), names.at(volumes[i] + 1u));
+        EXPECT_EQ(n_surfaces(sub_det, i), n_surfaces(det, volumes[i]));
+    }
+
+    // Portals either link inside the sub-detector or leave it
+    for (const auto& sf_desc : sub_det.surfaces()) {
+        const geometry::surface sf{sub_det, sf_desc};
+        if (!sf.is_portal()) {
+            continue;
+        }
+        const auto vol_link{sf.volume_link()};
+        EXPECT_TRUE(detail::is_invalid_value(vol_link) ||
+                    vol_link < sub_det.volumes().size())
+            << sf;
+    }
+
+    EXPECT_TRUE(detail::check_consistency(sub_det, false, sub_names));
+}
+
+}  // anonymous namespace
+
+/// Extract a list of volumes from the toy detector
+GTEST_TEST(io, extract_toy_detector_volumes) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    // The first volumes of the toy detector (unsorted, with duplicate)
+    const std::vector<dindex> volumes{3u, 0u, 1u, 2u, 1u};
+    const auto [sub_det, sub_names] =
+        io::extract_detector<detector_t, 1u>(host_mr, toy_det, toy_names,
+                                             volumes);
+
+    check_extraction(toy_det, toy_names, sub_det, sub_names,
+                     {0u, 1u, 2u, 3u});
+
+    // Out of range
+    EXPECT_THROW(io::extract_detector<detector_t, 1u>(
+                     host_mr, toy_det, toy_names,
+                     {static_cast<dindex>(toy_det.volumes().size())}),
+                 std::invalid_argument);
+}
+
+/// Extract an eta-phi region of interest from the toy detector
+GTEST_TEST(io, extract_toy_detector_roi) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    // Central barrel
+    const std::vector<dindex> volumes =
+        io::roi_volumes(toy_det, -0.5f, 0.5f, -0.3f, 0.3f);
+
+    ASSERT_FALSE(volumes.empty());
+    EXPECT_LT(volumes.size(), toy_det.volumes().size());
+
+    const auto [sub_det, sub_names] =
+        io::extract_detector<detector_t, 1u>(host_mr, toy_det, toy_names,
+                                             volumes);
+
+    check_extraction(toy_det, toy_names, sub_det, sub_names, volumes);
+}
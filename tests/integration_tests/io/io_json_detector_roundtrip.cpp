@@ -13,7 +13,9 @@
 #include "detray/io/backend/geometry_writer.hpp"
 #include "detray/io/frontend/detector_reader.hpp"
 #include "detray/io/frontend/detector_writer.hpp"
+#include "detray/io/frontend/impl/json_readers.hpp"
 #include "detray/io/json/json_converter.hpp"
+#include "detray/io/utils/io_metadata.hpp"
 
 // Detray test include(s)
 #include "detray/test/cpu/toy_detector_test.hpp"
@@ -29,8 +31,14 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <ios>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 using namespace detray;
 
@@ -104,6 +112,12 @@ auto test_detector_json_io(
     auto [det2, names2] =
         io::read_detector<detector_t, CAP>(host_mr, reader_cfg);
 
+    // The file headers carry the content hash of the detector
+    const std::string det_hash{io::detail::get_detector_hash(det)};
+    for (const auto& [_, name] : file_names) {
+        EXPECT_EQ(io::detail::deserialize_json_header(name).hash, det_hash);
+    }
+
     // Write the result to a different set of files
     writer_cfg.replace_files(false);
     io::write_detector(det2, names2, writer_cfg);
@@ -295,6 +309,59 @@ GTEST_TEST(io, json_toy_detector_roundtrip_material_maps) {
     // EXPECT_TRUE(toy_detector_test(det_io, names_io));
 }
 
+/// Test parsing the files of the toy detector on several threads
+GTEST_TEST(io, json_toy_detector_threaded_reader) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_material_maps.json")
+        .add_file("toy_detector_surface_grids.json");
+
+    // Single threaded by default
+    EXPECT_EQ(reader_cfg.n_threads(), 1u);
+    auto [det_seq, names_seq] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    // More threads than files, as well as all hardware threads
+    for (const std::size_t n_threads : {2u, 8u, 0u}) {
+        reader_cfg.n_threads(n_threads);
+        auto [det_par, names_par] =
+            io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+        EXPECT_EQ(names_par, names_seq);
+        ASSERT_EQ(det_par.volumes().size(), det_seq.volumes().size());
+        ASSERT_EQ(det_par.surfaces().size(), det_seq.surfaces().size());
+        for (std::size_t i = 0u; i < det_seq.volumes().size(); ++i) {
+            EXPECT_EQ(det_par.volumes()[i], det_seq.volumes()[i]);
+        }
+        for (std::size_t i = 0u; i < det_seq.surfaces().size(); ++i) {
+            EXPECT_EQ(det_par.surfaces()[i], det_seq.surfaces()[i]);
+        }
+        EXPECT_EQ(io::detail::get_detector_hash(det_par),
+                  io::detail::get_detector_hash(det_seq));
+    }
+}
+
 /// Test the reading and writing of a wire chamber
 GTEST_TEST(io, json_wire_chamber_reader) {
 
@@ -322,3 +389,429 @@ GTEST_TEST(io, json_wire_chamber_reader) {
 
     EXPECT_EQ(det_io.volumes().size(), 11u);
 }
+
+/// Test that the detector check is skipped for files that were checked before
+GTEST_TEST(io, json_toy_detector_check_cache) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.use_check_cache(true)
+        .add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_surface_grids.json");
+
+    const auto& files = reader_cfg.files();
+    const std::string cache_file{io::detail::check_cache_file(files)};
+    std::filesystem::remove(cache_file);
+
+    // First read: The detector is checked and the result is recorded
+    const auto hash{io::detail::hash_detector_files<detector_t>(files)};
+    EXPECT_FALSE(io::detail::is_checked(files, hash));
+
+    auto [det1, names1] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+    EXPECT_TRUE(std::filesystem::exists(cache_file));
+    EXPECT_TRUE(io::detail::is_checked(files, hash));
+
+    // Second read: The check is skipped
+    auto [det2, names2] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+    EXPECT_EQ(det2.surfaces().size(), det1.surfaces().size());
+
+    // A modified file invalidates the cached check
+    {
+        std::ofstream grid_file{"toy_detector_surface_grids.json",
+                                std::ios::app};
+        grid_file << "\n";
+    }
+    EXPECT_NE(io::detail::hash_detector_files<detector_t>(files), hash);
+    EXPECT_FALSE(io::detail::is_checked(
+        files, io::detail::hash_detector_files<detector_t>(files)));
+
+    std::filesystem::remove(cache_file);
+    std::filesystem::remove("toy_detector_material_maps.json");
+}
+
+/// Test reading the surface grids of the toy detector from a binary file
+GTEST_TEST(io, json_toy_detector_binary_grids) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    // Write the grids once as json and once as binary file
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+    writer_cfg.binary_grids(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+    ASSERT_TRUE(std::filesystem::exists("toy_detector_surface_grids.bin"));
+
+    io::detector_reader_config json_cfg{};
+    json_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_surface_grids.json");
+
+    io::detector_reader_config bin_cfg{};
+    bin_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_surface_grids.bin");
+
+    const auto [det_json, names_json] =
+        io::read_detector<detector_t, 1u>(host_mr, json_cfg);
+    const auto [det_bin, names_bin] =
+        io::read_detector<detector_t, 1u>(host_mr, bin_cfg);
+
+    // The grids are the same, whether filled bin by bin or copied at once
+    ASSERT_EQ(det_bin.volumes().size(), det_json.volumes().size());
+    for (std::size_t i = 0u; i < det_json.volumes().size(); ++i) {
+        EXPECT_EQ(det_bin.volumes()[i], det_json.volumes()[i]);
+    }
+
+    auto check_grids = [&det_bin, &det_json]<auto grid_id>() {
+        const auto& bins_bin =
+            det_bin.accelerator_store().template get<grid_id>().bin_storage();
+        const auto& bins_json =
+            det_json.accelerator_store().template get<grid_id>().bin_storage();
+
+        ASSERT_EQ(bins_bin.size(), bins_json.size());
+        for (std::size_t i = 0u; i < bins_json.size(); ++i) {
+            EXPECT_TRUE(std::ranges::equal(bins_bin[i], bins_json[i]));
+        }
+    };
+    using accel_id = typename detector_t::accel::id;
+    check_grids.template operator()<accel_id::e_disc_grid>();
+    check_grids.template operator()<accel_id::e_cylinder2_grid>();
+
+    // Detector types with dynamic bin capacity cannot copy the bins
+    EXPECT_THROW(io::read_detector<detector_t>(host_mr, bin_cfg),
+                 std::invalid_argument);
+
+    std::filesystem::remove("toy_detector_material_maps.json");
+}
+
+/// Test reading the material maps of a subset of the toy detector volumes
+GTEST_TEST(io, json_toy_detector_material_volumes) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+    using mat_id = typename detector_t::materials::id;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_material_maps.json")
+        .add_file("toy_detector_surface_grids.json");
+
+    // Number of surfaces with material maps in a volume
+    auto n_maps = [](const detector_t& det, const dindex vol_idx) {
+        return std::ranges::count_if(det.surfaces(), [vol_idx](const auto& sf) {
+            const mat_id id{sf.material().id()};
+            return sf.volume() == vol_idx && id != mat_id::e_slab &&
+                   id != mat_id::e_none;
+        });
+    };
+
+    const auto [det_all, names_all] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    // Only load the material maps of the first volume that has any
+    dindex sel_vol{dindex_invalid};
+    for (const auto& vol_desc : det_all.volumes()) {
+        if (n_maps(det_all, vol_desc.index()) > 0) {
+            sel_vol = vol_desc.index();
+            break;
+        }
+    }
+    ASSERT_NE(sel_vol, dindex_invalid);
+
+    reader_cfg.material_volumes({sel_vol});
+    const auto [det_sel, names_sel] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    ASSERT_EQ(det_sel.volumes().size(), det_all.volumes().size());
+    EXPECT_EQ(det_sel.surfaces().size(), det_all.surfaces().size());
+    for (const auto& vol_desc : det_all.volumes()) {
+        const dindex vol_idx{vol_desc.index()};
+        if (vol_idx == sel_vol) {
+            EXPECT_EQ(n_maps(det_sel, vol_idx), n_maps(det_all, vol_idx));
+        } else {
+            EXPECT_EQ(n_maps(det_sel, vol_idx), 0);
+        }
+    }
+}
+
+/// Test streaming the surface grids and material maps of the toy detector
+GTEST_TEST(io, json_toy_detector_stream_grids) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_material_maps.json")
+        .add_file("toy_detector_surface_grids.json");
+
+    const auto [det_dom, names_dom] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    reader_cfg.stream_json(true);
+    const auto [det_stream, names_stream] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    // The detector is the same, whether the files are parsed or streamed
+    EXPECT_EQ(names_stream, names_dom);
+    ASSERT_EQ(det_stream.volumes().size(), det_dom.volumes().size());
+    for (std::size_t i = 0u; i < det_dom.volumes().size(); ++i) {
+        EXPECT_EQ(det_stream.volumes()[i], det_dom.volumes()[i]);
+    }
+    ASSERT_EQ(det_stream.surfaces().size(), det_dom.surfaces().size());
+    for (std::size_t i = 0u; i < det_dom.surfaces().size(); ++i) {
+        EXPECT_EQ(det_stream.surfaces()[i], det_dom.surfaces()[i]);
+    }
+
+    auto check_grids = [&det_stream, &det_dom]<auto grid_id>() {
+        const auto& bins_stream = det_stream.accelerator_store()
+                                      .template get<grid_id>()
+                                      .bin_storage();
+        const auto& bins_dom =
+            det_dom.accelerator_store().template get<grid_id>().bin_storage();
+
+        ASSERT_EQ(bins_stream.size(), bins_dom.size());
+        for (std::size_t i = 0u; i < bins_dom.size(); ++i) {
+            EXPECT_TRUE(std::ranges::equal(bins_stream[i], bins_dom[i]));
+        }
+    };
+    using accel_id = typename detector_t::accel::id;
+    check_grids.template operator()<accel_id::e_disc_grid>();
+    check_grids.template operator()<accel_id::e_cylinder2_grid>();
+}
+
+/// Test writing the toy detector volume by volume and in parallel
+GTEST_TEST(io, json_toy_detector_stream_writer) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    writer_cfg.path("./stream_writer/").stream_json(true).n_threads(0u);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    const std::vector<std::string> file_names{
+        "toy_detector_geometry.json", "toy_detector_homogeneous_material.json",
+        "toy_detector_material_maps.json", "toy_detector_surface_grids.json"};
+
+    io::detector_reader_config json_cfg{};
+    io::detector_reader_config stream_cfg{};
+    for (const std::string& file_name : file_names) {
+        json_cfg.add_file(file_name);
+        stream_cfg.add_file("./stream_writer/" + file_name);
+    }
+
+    const auto [det_json, names_json] =
+        io::read_detector<detector_t, 1u>(host_mr, json_cfg);
+    const auto [det_stream, names_stream] =
+        io::read_detector<detector_t, 1u>(host_mr, stream_cfg);
+
+    // The same detector is read back from both sets of files
+    EXPECT_EQ(names_stream, names_json);
+    ASSERT_EQ(det_stream.volumes().size(), det_json.volumes().size());
+    for (std::size_t i = 0u; i < det_json.volumes().size(); ++i) {
+        EXPECT_EQ(det_stream.volumes()[i], det_json.volumes()[i]);
+    }
+    ASSERT_EQ(det_stream.surfaces().size(), det_json.surfaces().size());
+    for (std::size_t i = 0u; i < det_json.surfaces().size(); ++i) {
+        EXPECT_EQ(det_stream.surfaces()[i], det_json.surfaces()[i]);
+    }
+
+    // Writing the streamed detector again gives the same files
+    auto rewrite_cfg = io::detector_writer_config{}
+                           .path("./stream_writer_rewrite/")
+                           .format(io::format::json)
+                           .replace_files(true);
+    io::write_detector(det_stream, names_stream, rewrite_cfg);
+    for (const std::string& file_name : file_names) {
+        EXPECT_TRUE(
+            compare_files(file_name, "./stream_writer_rewrite/" + file_name))
+            << file_name;
+    }
+
+    std::filesystem::remove_all("./stream_writer/");
+    std::filesystem::remove_all("./stream_writer_rewrite/");
+}
+
+/// Test reading the toy detector asynchronously
+GTEST_TEST(io, json_toy_detector_async) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json")
+        .add_file("toy_detector_surface_grids.json");
+
+    // Launch two reads at once, one of which runs a continuation
+    auto det_future =
+        io::read_detector_async<detector_t, 1u>(host_mr, reader_cfg);
+    auto n_sf_future = io::read_detector_async<detector_t, 1u>(
+        host_mr, reader_cfg,
+        [](detector_t&& det, typename detector_t::name_map&&) {
+            return det.surfaces().size();
+        });
+
+    const auto [det, names] = det_future.get();
+
+    EXPECT_EQ(names, toy_names);
+    ASSERT_EQ(det.volumes().size(), toy_det.volumes().size());
+    for (std::size_t i = 0u; i < toy_det.volumes().size(); ++i) {
+        EXPECT_EQ(det.volumes()[i], toy_det.volumes()[i]);
+    }
+    EXPECT_EQ(n_sf_future.get(), toy_det.surfaces().size());
+}
+
+/// Test the compressed detector files of the toy detector
+GTEST_TEST(io, json_toy_detector_compressed) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true)
+                          .binary_grids(true)
+                          .compression(io::compression::zstd);
+
+    // Without zstd support, compressed files cannot be written
+    if (!io::is_supported(io::compression::zstd)) {
+        EXPECT_THROW(io::write_detector(toy_det, toy_names, writer_cfg),
+                     std::runtime_error);
+        GTEST_SKIP() << "detray was built without zstd support";
+    }
+
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file("toy_detector_geometry.json.zst")
+        .add_file("toy_detector_homogeneous_material.json.zst")
+        .add_file("toy_detector_material_maps.json.zst")
+        .add_file("toy_detector_surface_grids.bin.zst");
+
+    // The compressed files are smaller
+    writer_cfg.compression(io::compression::none);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+    EXPECT_LT(std::filesystem::file_size("toy_detector_geometry.json.zst"),
+              std::filesystem::file_size("toy_detector_geometry.json"));
+
+    const auto [comp_det, comp_names] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    EXPECT_EQ(comp_names, toy_names);
+    ASSERT_EQ(comp_det.volumes().size(), toy_det.volumes().size());
+    for (std::size_t i = 0u; i < toy_det.volumes().size(); ++i) {
+        EXPECT_EQ(comp_det.volumes()[i], toy_det.volumes()[i]);
+    }
+    EXPECT_EQ(comp_det.surfaces().size(), toy_det.surfaces().size());
+    detail::check_consistency(comp_det);
+}
@@ -31,6 +31,14 @@ void add_options<detray::navigation::config>(
         "search_window",
         boost::program_options::value<std::vector<dindex>>()->multitoken(),
         "Search window size for the grid")(
+        "adaptive_search_window",
+        "Adapt the grid search window to the track incidence angle")(
+        "directed_search_window",
+        "Only search the grid bins in front of the track")(
+        "search_window_depth",
+        boost::program_options::value<float>()->default_value(
+            cfg.search_window_depth / unit<float>::mm),
+        "Depth of the adaptive search window [mm]")(
         "min_mask_tolerance",
         boost::program_options::value<float>()->default_value(
             cfg.min_mask_tolerance / unit<float>::mm),
@@ -108,6 +116,18 @@ void configure_options<detray::navigation::config>(
                 "integer distances.");
         }
     }
+    if (vm.count("adaptive_search_window")) {
+        cfg.adaptive_search_window = true;
+    }
+    if (vm.count("directed_search_window")) {
+        cfg.directed_search_window = true;
+    }
+    if (!vm["search_window_depth"].defaulted()) {
+        const float depth{vm["search_window_depth"].as<float>()};
+        assert(depth >= 0.f);
+
+        cfg.search_window_depth = depth * unit<float>::mm;
+    }
     // Overstepping tolerance
     if (!vm["min_mask_tolerance"].defaulted()) {
         const float mask_tol{vm["min_mask_tolerance"].as<float>()};
@@ -34,11 +34,19 @@ void add_toy_det_options(boost::program_options::options_description &desc,
         "barrel_layers",
         boost::program_options::value<unsigned int>()->default_value(
             cfg.n_brl_layers()),
-        "number of barrel layers [0-4]")(
+        "number of barrel layers (more than 4 scale the detector)")(
         "endcap_layers",
         boost::program_options::value<unsigned int>()->default_value(
             cfg.n_edc_layers()),
-        "number of endcap layers on either side [0-7]")(
+        "number of endcap layers on either side (more than 7 scale the "
+        "detector)")(
+        "module_granularity",
+        boost::program_options::value<scalar_t>()->default_value(1.f),
+        "factor by which the modules are made smaller (>= 1)")(
+        "grid_bin_scale",
+        boost::program_options::value<scalar_t>()->default_value(
+            cfg.grid_bin_scale()),
+        "factor on the number of surface grid bins per module")(
         "homogeneous_material",
         "Generate homogeneous material description (default)")(
         "material_maps", "Generate material maps");
@@ -49,8 +57,16 @@ template <concepts::scalar scalar_t>
 void configure_toy_det_options(const boost::program_options::variables_map &vm,
                                toy_det_config<scalar_t> &cfg) {
 
-    cfg.n_brl_layers(vm["barrel_layers"].as<unsigned int>());
-    cfg.n_edc_layers(vm["endcap_layers"].as<unsigned int>());
+    // Reproduces the toy detector if it is not scaled beyond its size
+    scale_toy_detector(cfg, vm["barrel_layers"].as<unsigned int>(),
+                       vm["endcap_layers"].as<unsigned int>(),
+                       vm["module_granularity"].as<scalar_t>());
+
+    const auto grid_bin_scale{vm["grid_bin_scale"].as<scalar_t>()};
+    if (grid_bin_scale <= 0.f) {
+        throw std::invalid_argument("Grid bin scale has to be positive");
+    }
+    cfg.grid_bin_scale(grid_bin_scale);
 
     if (vm.count("homogeneous_material") && vm.count("material_maps")) {
         throw std::invalid_argument(
@@ -51,7 +51,11 @@ void add_wire_chamber_options(
         "mat_radius",
         boost::program_options::value<float>()->default_value(
             static_cast<float>(cfg.mat_radius())),
-        "radius of material rods [mm]");
+        "radius of material rods [mm]")(
+        "wires_per_bin",
+        boost::program_options::value<unsigned int>()->default_value(
+            cfg.wires_per_bin()),
+        "number of wires per phi bin of the layer grids (0: 100 bins)");
 }
 
 /// Configure options that are independent of the wire surface shape
@@ -65,6 +69,7 @@ void configure_wire_chamber_options(
     cfg.cell_size(vm["cell_size"].as<float>());
     cfg.stereo_angle(vm["stereo_angle"].as<float>());
     cfg.mat_radius(vm["mat_radius"].as<float>());
+    cfg.wires_per_bin(vm["wires_per_bin"].as<unsigned int>());
 }
 
 }  // namespace detail
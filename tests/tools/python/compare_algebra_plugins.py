@@ -0,0 +1,240 @@
+# Detray library, part of the ACTS project (R&D line)
+#
+# (c) 2025 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+
+# detray imports
+from impl import read_benchmark_samples, tabulate_plugin_samples, format_plugin_table
+from options import common_options, parse_common_options
+
+# python imports
+import argparse
+import os
+import subprocess
+import sys
+
+# ------------------------------------------------------------------------------
+# Compare the algebra plugins on the same benchmark workloads
+#
+# Runs the host benchmark executables of every requested algebra plugin
+# (e.g. 'detray_benchmark_cpu_array', 'detray_benchmark_cpu_eigen') on the
+# same workloads and tabulates the results side by side. Benchmark results
+# can also be read from google benchmark json files.
+# ------------------------------------------------------------------------------
+
+# Algebra plugins that detray can be built with
+known_plugins = ["array", "eigen", "smatrix", "vc_aos", "vc_soa"]
+
+# Benchmark filter and executable (prefix) per workload
+workloads = {
+    "intersector": ("BM_INTERSECT_", "detray_benchmark_cpu"),
+    "mask": ("BM_MASK_", "detray_benchmark_cpu"),
+    "jacobian": ("BM_JACOBIAN_", "detray_benchmark_cpu"),
+    "propagation": ("TOY_DETECTOR|WIRE_CHAMBER", "detray_benchmark_cpu_propagation"),
+}
+
+
+""" Run the benchmarks of the workloads for one algebra plugin """
+
+
+def __run_plugin_benchmarks(logging, bindir, plugin, selected, out_dir, options):
+
+    # Combine the workloads that are run by the same executable
+    filters = {}
+    for workload in selected:
+        bm_filter, exe = workloads[workload]
+        filters.setdefault(exe, []).append(bm_filter)
+
+    files = []
+    for exe, bm_filters in filters.items():
+        binary = os.path.join(bindir, f"{exe}_{plugin}")
+        if not os.path.isfile(binary):
+            logging.warning(f"Benchmark binary not found! ({binary})")
+            continue
+
+        data_file = os.path.join(out_dir, f"{exe}_{plugin}.json")
+        logging.info(f"Running {binary}")
+        subprocess.run(
+            [
+                binary,
+                f"--benchmark_filter={'|'.join(bm_filters)}",
+                f"--benchmark_out={data_file}",
+                "--benchmark_out_format=json",
+            ]
+            + options,
+            check=True,
+        )
+        files.append(data_file)
+
+    return files
+
+
+""" Read the label and the file name from a 'label:file.json' argument """
+
+
+def __parse_data_file(arg):
+
+    label, sep, file_name = arg.partition(":")
+    if not sep:
+        return None, arg
+    return label, file_name
+
+
+def __main__():
+
+    # ---------------------------------------------------------------arg parsing
+
+    descr = "Detray Algebra Plugin Comparison"
+
+    common_parser = common_options(descr)
+
+    parser = argparse.ArgumentParser(description=descr, parents=[common_parser])
+
+    parser.add_argument(
+        "--bindir",
+        "-bin",
+        help=("Directoy containing the benchmark executables"),
+        default="./bin",
+        type=str,
+    )
+    parser.add_argument(
+        "--algebra_plugins",
+        "-ap",
+        nargs="*",
+        help=("Algebra plugins to be run (default: all that were built)"),
+        default=[],
+        type=str,
+    )
+    parser.add_argument(
+        "--workloads",
+        "-w",
+        nargs="*",
+        help=("Benchmark workloads to be compared"),
+        choices=list(workloads.keys()),
+        default=list(workloads.keys()),
+    )
+    parser.add_argument(
+        "--data_files",
+        "-f",
+        nargs="*",
+        help=(
+            "Read benchmark results from google benchmark json files instead, "
+            "given as 'plugin:file.json' (the plugin is otherwise taken from "
+            "the benchmark context)"
+        ),
+        default=[],
+        type=str,
+    )
+    parser.add_argument(
+        "--benchmark_repetitions",
+        help=("Number of repeated benchmark runs."),
+        default=3,
+        type=int,
+    )
+    parser.add_argument(
+        "--metric",
+        help=("Benchmark metric, e.g. 'real_time' or a counter name"),
+        default="real_time",
+        type=str,
+    )
+    parser.add_argument(
+        "--reference",
+        help=("Algebra plugin the others are compared to"),
+        default="array",
+        type=str,
+    )
+    parser.add_argument(
+        "--outdir",
+        "-o",
+        help=("Output directory for the benchmark results and the report"),
+        default="./algebra_comparison/",
+        type=str,
+    )
+    parser.add_argument(
+        "--format",
+        help=("Format of the report file"),
+        choices=["csv", "md"],
+        default="md",
+        type=str,
+    )
+
+    args = parser.parse_args()
+
+    logging = parse_common_options(args, descr)
+
+    out_dir = args.outdir
+    if not os.path.isdir(out_dir):
+        os.makedirs(out_dir, 0o755)
+
+    # -----------------------------------------------------------------------run
+
+    data_files = [__parse_data_file(arg) for arg in args.data_files]
+
+    plugins = args.algebra_plugins
+    if len(plugins) == 0 and len(data_files) == 0:
+        plugins = [
+            p
+            for p in known_plugins
+            if os.path.isfile(os.path.join(args.bindir, f"detray_benchmark_cpu_{p}"))
+        ]
+        if len(plugins) == 0:
+            logging.error(f"No benchmark executables found in '{args.bindir}'")
+            sys.exit(1)
+
+    benchmark_options = [
+        f"--benchmark_repetitions={args.benchmark_repetitions}",
+        "--benchmark_display_aggregates_only=true",
+    ]
+
+    for plugin in plugins:
+        for file_name in __run_plugin_benchmarks(
+            logging, args.bindir, plugin, args.workloads, out_dir, benchmark_options
+        ):
+            data_files.append((plugin, file_name))
+
+    # ------------------------------------------------------------------compare
+
+    samples_per_plugin = {}
+    for label, file_name in data_files:
+        context, samples = read_benchmark_samples(logging, file_name, args.metric)
+        if samples is None:
+            sys.exit(1)
+
+        if label is None:
+            label = context.get("Algebra-plugin", os.path.basename(file_name))
+
+        samples_per_plugin.setdefault(label, {}).update(samples)
+
+    if len(samples_per_plugin) == 0:
+        logging.error("No benchmark results to compare")
+        sys.exit(1)
+
+    # Keep the order of the known plugins in the table
+    labels = sorted(
+        samples_per_plugin.keys(),
+        key=lambda p: (0, known_plugins.index(p)) if p in known_plugins else (1, p),
+    )
+    reference = args.reference if args.reference in labels else None
+
+    rows = tabulate_plugin_samples(samples_per_plugin, args.metric)
+
+    logging.info(
+        "\n" + format_plugin_table(rows, labels, args.metric, reference, "text")
+    )
+
+    report = os.path.join(out_dir, f"algebra_plugin_comparison.{args.format}")
+    with open(report, "w") as file:
+        file.write(
+            format_plugin_table(rows, labels, args.metric, reference, args.format)
+        )
+
+    logging.info(f"Wrote report: {report}")
+
+
+# ------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+    __main__()
+
+# ------------------------------------------------------------------------------
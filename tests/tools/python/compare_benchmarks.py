@@ -0,0 +1,114 @@
+# Detray library, part of the ACTS project (R&D line)
+#
+# (c) 2025 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+
+# detray imports
+from impl import (
+    read_benchmark_samples,
+    check_benchmark_context,
+    compare_benchmark_samples,
+    print_comparison,
+)
+from options import common_options, parse_common_options
+
+# python imports
+import argparse
+import sys
+
+# ------------------------------------------------------------------------------
+# Compare two runs of a detray benchmark (google benchmark json output)
+#
+# The runs should be taken with repetitions, e.g.
+# '--benchmark_repetitions=10 --benchmark_out_format=json', so that the
+# significance of a change can be tested.
+# ------------------------------------------------------------------------------
+
+
+def __main__():
+
+    # ---------------------------------------------------------------arg parsing
+
+    descr = "Detray Benchmark Comparison"
+
+    common_parser = common_options(descr)
+
+    parser = argparse.ArgumentParser(description=descr, parents=[common_parser])
+
+    parser.add_argument("baseline", help=("Baseline benchmark file (json)"), type=str)
+    parser.add_argument(
+        "contender", help=("Benchmark file to be compared (json)"), type=str
+    )
+    parser.add_argument(
+        "--metric",
+        help=("Benchmark metric, e.g. 'real_time' or a counter name"),
+        default="real_time",
+        type=str,
+    )
+    parser.add_argument(
+        "--threshold",
+        help=("Minimal relative change of the mean to be reported"),
+        default=0.05,
+        type=float,
+    )
+    parser.add_argument(
+        "--alpha",
+        help=("Significance level of the Welch t-test"),
+        default=0.05,
+        type=float,
+    )
+    parser.add_argument(
+        "--fail_on_regression",
+        help=("Return a non-zero exit code, if a regression was found"),
+        action="store_true",
+    )
+    parser.add_argument(
+        "--ignore_context",
+        help=("Compare runs with different hardware or build setup"),
+        action="store_true",
+    )
+
+    args = parser.parse_args()
+
+    logging = parse_common_options(args, descr)
+
+    # ------------------------------------------------------------------compare
+
+    base_ctx, baseline = read_benchmark_samples(logging, args.baseline, args.metric)
+    cont_ctx, contender = read_benchmark_samples(logging, args.contender, args.metric)
+
+    if baseline is None or contender is None:
+        sys.exit(1)
+
+    if not check_benchmark_context(logging, base_ctx, cont_ctx):
+        if not args.ignore_context:
+            logging.error(
+                "Benchmark runs are not comparable "
+                "(use --ignore_context to compare anyway)"
+            )
+            sys.exit(1)
+
+    results = compare_benchmark_samples(
+        baseline, contender, args.metric, args.threshold, args.alpha
+    )
+
+    print_comparison(logging, results, args.metric)
+
+    n_regressions = sum(r.status == "regression" for r in results)
+    n_improvements = sum(r.status == "improvement" for r in results)
+    logging.info(
+        f"{n_regressions} regression(s), {n_improvements} improvement(s) "
+        f"in {len(results)} benchmark case(s)"
+    )
+
+    if args.fail_on_regression and n_regressions > 0:
+        sys.exit(1)
+
+
+# ------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+    __main__()
+
+# ------------------------------------------------------------------------------
@@ -31,3 +31,11 @@ from .plot_track_params import (
     plot_track_pos_dist,
     plot_track_pos_res,
 )
+from .compare_benchmark_results import (
+    read_benchmark_samples,
+    check_benchmark_context,
+    compare_benchmark_samples,
+    print_comparison,
+    tabulate_plugin_samples,
+    format_plugin_table,
+)
@@ -0,0 +1,300 @@
+# Detray library, part of the ACTS project (R&D line)
+#
+# (c) 2025 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+
+# python includes
+from collections import namedtuple
+import json
+import math
+import numpy as np
+import os
+
+# Context entries that have to match for the runs to be comparable
+comparable_context_keys = [
+    "Schema Version",
+    "Backend",
+    "Backend Name",
+    "Host CPU",
+    "Algebra-plugin",
+    "Scalar Type",
+    "Detector Setup",
+    "Build Type",
+]
+
+# Metrics for which smaller values are better (all others are rates)
+time_metrics = ["real_time", "cpu_time"]
+
+# Convert benchmark timings to 'ns'
+unit_conversion = {"ns": 1, "us": 10**3, "ms": 10**6, "s": 10**9}
+
+# Samples of one benchmark case
+benchmark_samples = namedtuple("benchmark_samples", "mean stddev n values")
+
+# Comparison result of one benchmark case
+comparison_result = namedtuple(
+    "comparison_result", "name baseline contender rel_change p_value status"
+)
+
+""" Read the context and the samples of the metric per benchmark case """
+
+
+def read_benchmark_samples(logging, file_path, metric="real_time"):
+
+    if not os.path.isfile(file_path):
+        logging.error(f"Could not find file: {file_path}")
+        return None, None
+
+    with open(file_path, "r") as file:
+        logging.debug(f"Reading file '{file_path}'")
+        results = json.load(file)
+
+    context = results["context"]
+
+    values = {}
+    aggregates = {}
+    for bench in results["benchmarks"]:
+        if metric not in bench:
+            continue
+
+        value = float(bench[metric])
+        if metric in time_metrics:
+            value = value * unit_conversion[bench.get("time_unit", "ns")]
+
+        name = bench.get("run_name", bench["name"])
+        if bench.get("run_type", "iteration") == "aggregate":
+            aggregates.setdefault(name, {})[bench["aggregate_name"]] = value
+            aggregates[name]["n"] = int(bench.get("repetitions", 1))
+        else:
+            values.setdefault(name, []).append(value)
+
+    samples = {}
+    for name, vals in values.items():
+        vals = np.asarray(vals)
+        std = float(np.std(vals, ddof=1)) if len(vals) > 1 else 0.0
+        samples[name] = benchmark_samples(
+            mean=float(np.mean(vals)), stddev=std, n=len(vals), values=vals
+        )
+
+    # Only aggregates were reported (--benchmark_report_aggregates_only)
+    for name, agg in aggregates.items():
+        if name in samples or "mean" not in agg:
+            continue
+        samples[name] = benchmark_samples(
+            mean=agg["mean"],
+            stddev=agg.get("stddev", 0.0),
+            n=agg["n"],
+            values=None,
+        )
+
+    return context, samples
+
+
+""" Check whether two benchmark runs were taken under the same conditions """
+
+
+def check_benchmark_context(logging, baseline_ctx, contender_ctx):
+
+    is_comparable = True
+    for key in comparable_context_keys:
+        base_val = baseline_ctx.get(key, "unknown")
+        cont_val = contender_ctx.get(key, "unknown")
+        if base_val != cont_val:
+            logging.warning(
+                f"Context mismatch for '{key}': '{base_val}' vs. '{cont_val}'"
+            )
+            is_comparable = False
+
+    return is_comparable
+
+
+""" Two-sided p-value of Welch's t-test for the difference of the means """
+
+
+def welch_t_test(base, cont):
+
+    if base.n < 2 or cont.n < 2:
+        return math.nan
+
+    var_base = base.stddev**2 / base.n
+    var_cont = cont.stddev**2 / cont.n
+    if var_base + var_cont == 0:
+        return 0.0 if base.mean != cont.mean else 1.0
+
+    t = (cont.mean - base.mean) / math.sqrt(var_base + var_cont)
+    dof = (var_base + var_cont) ** 2 / (
+        var_base**2 / (base.n - 1) + var_cont**2 / (cont.n - 1)
+    )
+
+    try:
+        from scipy import stats
+
+        return float(2.0 * stats.t.sf(abs(t), dof))
+    except ImportError:
+        # Normal approximation of the t-distribution
+        return math.erfc(abs(t) / math.sqrt(2.0))
+
+
+"""
+Compare the samples of two benchmark runs
+
+A benchmark case is flagged as regression (or improvement), if the relative
+change of the mean is larger than the threshold and, if repetitions are
+available, the change is significant at the given level alpha.
+"""
+
+
+def compare_benchmark_samples(
+    baseline, contender, metric="real_time", threshold=0.05, alpha=0.05
+):
+
+    smaller_is_better = metric in time_metrics
+
+    results = []
+    for name in sorted(set(baseline.keys()) | set(contender.keys())):
+        if name not in contender:
+            results.append(
+                comparison_result(
+                    name, baseline[name], None, math.nan, math.nan, "removed"
+                )
+            )
+            continue
+        if name not in baseline:
+            results.append(
+                comparison_result(
+                    name, None, contender[name], math.nan, math.nan, "new"
+                )
+            )
+            continue
+
+        base, cont = baseline[name], contender[name]
+        rel_change = (
+            (cont.mean - base.mean) / base.mean if base.mean != 0 else math.nan
+        )
+        p_value = welch_t_test(base, cont)
+
+        is_significant = math.isnan(p_value) or p_value < alpha
+        is_worse = rel_change > 0 if smaller_is_better else rel_change < 0
+
+        status = "unchanged"
+        if abs(rel_change) > threshold and is_significant:
+            status = "regression" if is_worse else "improvement"
+
+        results.append(
+            comparison_result(name, base, cont, rel_change, p_value, status)
+        )
+
+    return results
+
+
+""" Print a table of the comparison results """
+
+
+def print_comparison(logging, results, metric="real_time"):
+
+    unit = "ns" if metric in time_metrics else ""
+    width = max([len(r.name) for r in results] + [10])
+
+    lines = [
+        f"{'Benchmark':<{width}} {'Baseline':>14} {'Contender':>14} "
+        f"{'Change':>9} {'p-value':>8}  Status",
+        "-" * (width + 58),
+    ]
+    for r in results:
+        base = f"{r.baseline.mean:.4g}{unit}" if r.baseline else "-"
+        cont = f"{r.contender.mean:.4g}{unit}" if r.contender else "-"
+        change = (
+            f"{100 * r.rel_change:+.2f}%" if not math.isnan(r.rel_change) else "-"
+        )
+        p_val = f"{r.p_value:.3f}" if not math.isnan(r.p_value) else "-"
+        lines.append(
+            f"{r.name:<{width}} {base:>14} {cont:>14} {change:>9} {p_val:>8}  "
+            f"{r.status}"
+        )
+
+    logging.info("\n" + "\n".join(lines) + "\n")
+
+
+# Comparison of one benchmark case across algebra plugins
+plugin_comparison_row = namedtuple("plugin_comparison_row", "name means best")
+
+"""
+Tabulate the samples of the same benchmark cases for different algebra plugins
+
+The samples are given per plugin, e.g. {"array": samples, "eigen": samples}.
+Every benchmark case that was run for at least one plugin gets a row.
+"""
+
+
+def tabulate_plugin_samples(samples_per_plugin, metric="real_time"):
+
+    smaller_is_better = metric in time_metrics
+
+    names = set()
+    for samples in samples_per_plugin.values():
+        names |= set(samples.keys())
+
+    rows = []
+    for name in sorted(names):
+        means = {
+            plugin: samples[name].mean
+            for plugin, samples in samples_per_plugin.items()
+            if name in samples
+        }
+        select = min if smaller_is_better else max
+        best = select(means, key=means.get) if means else None
+
+        rows.append(plugin_comparison_row(name, means, best))
+
+    return rows
+
+
+""" Format the table of the algebra plugin comparison (text, csv or markdown) """
+
+
+def format_plugin_table(rows, plugins, metric="real_time", reference=None, fmt="text"):
+
+    unit = "ns" if metric in time_metrics else ""
+    width = max([len(r.name) for r in rows] + [10])
+
+    def cell(row, plugin):
+        if plugin not in row.means:
+            return "-"
+        value = f"{row.means[plugin]:.4g}{unit}"
+        ref = row.means.get(reference)
+        if reference is not None and plugin != reference and ref:
+            value += f" ({row.means[plugin] / ref:.2f}x)"
+        if plugin == row.best and len(row.means) > 1:
+            value += " *"
+        return value
+
+    if fmt == "csv":
+        lines = [",".join(["benchmark"] + plugins + ["best"])]
+        for r in rows:
+            values = [f"{r.means[p]:.6g}" if p in r.means else "" for p in plugins]
+            lines.append(",".join([r.name] + values + [r.best or ""]))
+        return "\n".join(lines) + "\n"
+
+    if fmt == "md":
+        lines = [
+            "| Benchmark | " + " | ".join(plugins) + " |",
+            "|---|" + "---:|" * len(plugins),
+        ]
+        for r in rows:
+            lines.append(
+                f"| {r.name} | " + " | ".join(cell(r, p) for p in plugins) + " |"
+            )
+        return "\n".join(lines) + "\n"
+
+    col = max([len(p) for p in plugins] + [22])
+    lines = [
+        f"{'Benchmark':<{width}} " + " ".join(f"{p:>{col}}" for p in plugins),
+        "-" * (width + (col + 1) * len(plugins)),
+    ]
+    for r in rows:
+        lines.append(
+            f"{r.name:<{width}} " + " ".join(f"{cell(r, p):>{col}}" for p in plugins)
+        )
+
+    return "\n".join(lines) + "\n"
@@ -32,6 +32,7 @@
 #include "detray/options/boost_program_options.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <filesystem>
 #include <sstream>
 #include <stdexcept>
@@ -56,6 +57,8 @@ int main(int argc, char** argv) {
     std::vector<dindex> volumes;
     std::vector<dindex> surfaces;
     std::vector<dindex> window;
+    std::vector<float> xy_window;
+    std::vector<float> zr_window;
     desc.add_options()("outdir", po::value<std::string>(),
                        "Output directory for plots")(
         "context", po::value<dindex>(), "Number of the geometry context")(
@@ -69,6 +72,14 @@ int main(int argc, char** argv) {
                                                 "Hide passive surfaces")(
         "hide_material", "Don't draw surface material")(
         "hide_eta_lines", "Hide eta lines")("show_info", "Show info boxes")(
+        "xy_window", po::value<std::vector<float>>(&xy_window)->multitoken(),
+        "Only display the region x_min x_max y_min y_max of the xy-view [mm]")(
+        "zr_window", po::value<std::vector<float>>(&zr_window)->multitoken(),
+        "Only display the region z_min z_max r_min r_max of the zr-view [mm]")(
+        "max_sensitives", po::value<std::size_t>(),
+        "Only display the envelope of volumes that contain more sensitive "
+        "surfaces in the view")("n_threads", po::value<std::size_t>(),
+                                "Number of threads for the volume conversion")(
         "write_volume_graph", "Writes the volume graph to file");
 
     // Configs to be filled
@@ -117,6 +128,28 @@ int main(int argc, char** argv) {
     il.hide_grids(!vm.count("grid_file"));
     il.search_window({window[0], window[1]});
 
+    // Only draw parts of the detector
+    auto to_view_window = [](const std::vector<float>& w) {
+        if (w.size() != 4u) {
+            throw std::invalid_argument(
+                "Incorrect view window. Please provide the lower and upper "
+                "bound of both view axes.");
+        }
+        return detray::svgtools::view_window{{w[0], w[1]}, {w[2], w[3]}};
+    };
+    if (!xy_window.empty()) {
+        il.window(actsvg::views::x_y{}, to_view_window(xy_window));
+    }
+    if (!zr_window.empty()) {
+        il.window(actsvg::views::z_r{}, to_view_window(zr_window));
+    }
+    if (vm.count("max_sensitives")) {
+        il.max_sensitives(vm["max_sensitives"].as<std::size_t>());
+    }
+    if (vm.count("n_threads")) {
+        il.n_threads(vm["n_threads"].as<std::size_t>());
+    }
+
     actsvg::style::stroke stroke_black = actsvg::style::stroke();
     actsvg::style::font axis_font = actsvg::style::font();
     axis_font._size = 35u;
@@ -139,20 +172,33 @@ int main(int argc, char** argv) {
 
     // Display the volumes
     if (!volumes.empty()) {
-        const auto [vol_xy_svg, xy_sheets] = il.draw_volumes(volumes, xy, gctx);
-        detray::svgtools::write_svg(path / vol_xy_svg._id,
-                                    {xy_axis, vol_xy_svg});
-        for (const auto& sheet : xy_sheets) {
-            detray::svgtools::write_svg(path / sheet._id, sheet);
+        // Write the volumes to file one at a time
+        {
+            detray::svgtools::svg_stream_writer writer{
+                path / (det.name(names) + "_volumes_xy")};
+            writer.write(xy_axis);
+            il.stream_volumes(writer, volumes, xy, gctx);
+        }
+        {
+            detray::svgtools::svg_stream_writer writer{
+                path / (det.name(names) + "_volumes_zr")};
+            writer.write(zr_axis);
+            il.stream_volumes(writer, volumes, zr, gctx);
         }
 
-        const auto [vol_zr_svg, _sh] = il.draw_volumes(volumes, zr, gctx);
-        detray::svgtools::write_svg(path / vol_zr_svg._id,
-                                    {zr_axis, vol_zr_svg});
-
-        const auto [_vol, zphi_sheets] = il.draw_volumes(volumes, zphi, gctx);
-        for (const auto& sheet : zphi_sheets) {
-            detray::svgtools::write_svg(path / sheet._id, sheet);
+        // The surface grid sheets
+        for (const dindex index : volumes) {
+            [[maybe_unused]] const auto [vol_xy_svg, xy_sheet] =
+                il.draw_volume(index, xy, gctx);
+            if (xy_sheet.is_defined()) {
+                detray::svgtools::write_svg(path / xy_sheet._id, xy_sheet);
+            }
+
+            [[maybe_unused]] const auto [vol_zphi_svg, zphi_sheet] =
+                il.draw_volume(index, zphi, gctx);
+            if (zphi_sheet.is_defined()) {
+                detray::svgtools::write_svg(path / zphi_sheet._id, zphi_sheet);
+            }
         }
     }
 
@@ -176,13 +222,19 @@ int main(int argc, char** argv) {
 
     // If nothing was specified, display the whole detector
     if (volumes.empty() && surfaces.empty()) {
-        const auto det_xy_svg = il.draw_detector(xy, gctx);
-        detray::svgtools::write_svg(path / det_xy_svg._id,
-                                    {xy_axis, det_xy_svg});
-
-        const auto det_zr_svg = il.draw_detector(zr, gctx);
-        detray::svgtools::write_svg(path / det_zr_svg._id,
-                                    {zr_axis, det_zr_svg});
+        // Write the detector to file one volume at a time
+        {
+            detray::svgtools::svg_stream_writer writer{
+                path / (det.name(names) + "_xy")};
+            writer.write(xy_axis);
+            il.stream_detector(writer, xy, gctx);
+        }
+        {
+            detray::svgtools::svg_stream_writer writer{
+                path / (det.name(names) + "_zr")};
+            writer.write(zr_axis);
+            il.stream_detector(writer, zr, gctx);
+        }
     }
 
     // Display the detector volume graph
@@ -57,6 +57,9 @@ int main(int argc, char** argv) {
 
     desc.add_options()("write_volume_graph", "Write the volume graph to file")(
         "write_scan_data", "Write the ray/helix scan data to file")(
+        "incremental",
+        "Only rescan and validate the tracks that cross volumes, which "
+        "changed since the scan data was written (implies write_scan_data)")(
         "data_dir",
         boost::program_options::value<std::string>()->default_value(
             "./validation_data"),
@@ -80,10 +83,14 @@ int main(int argc, char** argv) {
         con_chk_cfg.write_graph(true);
         throw std::invalid_argument("Writing of volume graph not implemented");
     }
-    if (vm.count("write_scan_data")) {
+    if (vm.count("write_scan_data") || vm.count("incremental")) {
         ray_scan_cfg.write_intersections(true);
         hel_scan_cfg.write_intersections(true);
     }
+    if (vm.count("incremental")) {
+        ray_scan_cfg.incremental(true);
+        hel_scan_cfg.incremental(true);
+    }
     const auto data_dir{vm["data_dir"].as<std::string>()};
 
     // For now: Copy the options to the other tests
@@ -55,7 +55,16 @@ int main(int argc, char **argv) {
 
     desc.add_options()(
         "tol", boost::program_options::value<float>()->default_value(1.f),
-        "Tolerance for comparing the material traces [%]");
+        "Tolerance for comparing the material traces [%]")(
+        "n_threads",
+        boost::program_options::value<std::size_t>()->default_value(1u),
+        "Number of threads for the material scan")(
+        "n_jobs",
+        boost::program_options::value<std::size_t>()->default_value(1u),
+        "Number of jobs the material scan is split into")(
+        "job_index",
+        boost::program_options::value<std::size_t>()->default_value(0u),
+        "Index of the material scan job to run");
 
     // Configs to be filled
     detray::io::detector_reader_config reader_cfg{};
@@ -70,6 +79,13 @@ int main(int argc, char **argv) {
     if (vm.count("tol")) {
         mat_val_cfg.relative_error(vm["tol"].as<float>() / 100.f);
     }
+    if (vm.count("n_threads")) {
+        mat_scan_cfg.n_threads(vm["n_threads"].as<std::size_t>());
+    }
+    if (vm.count("n_jobs")) {
+        mat_scan_cfg.job(vm["job_index"].as<std::size_t>(),
+                         vm["n_jobs"].as<std::size_t>());
+    }
 
     vecmem::host_memory_resource host_mr;
 
@@ -0,0 +1,130 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+
+// Detray IO include(s)
+#include "detray/io/backend/material_map_writer.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_io.hpp"
+#include "detray/io/utils/create_path.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// Detray test include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/test/utils/types.hpp"
+#include "detray/test/validation/material_validation_utils.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost
+#include "detray/options/boost_program_options.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+/// Merges the partial material mapping results of several material scan jobs
+/// (@see material_scan ) and writes the averaged material into the material
+/// maps of the detector.
+///
+/// The partial files are merged in the order of their names, so that the
+/// result does not depend on the order in which they are passed.
+int main(int argc, char **argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detector<test::default_metadata>;
+    using scalar_t = typename detector_t::scalar_type;
+    using accumulator_t =
+        material_validator::material_map_accumulator<scalar_t>;
+
+    // Specific options for this tool
+    po::options_description desc("\ndetray material map merging options");
+
+    desc.add_options()("partial_files",
+                       po::value<std::vector<std::string>>()->multitoken(),
+                       "Partial material mapping results (csv)")(
+        "output_dir", po::value<std::string>()->default_value("./"),
+        "Directory to write the merged material maps to");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+
+    po::variables_map vm =
+        detray::options::parse_options(desc, argc, argv, reader_cfg);
+
+    if (!vm.count("partial_files")) {
+        throw std::invalid_argument("No partial mapping files given");
+    }
+
+    auto file_names = vm["partial_files"].as<std::vector<std::string>>();
+    std::ranges::sort(file_names);
+
+    const std::filesystem::path out_dir{vm["output_dir"].as<std::string>()};
+
+    // The material maps of the detector define the binning
+    vecmem::host_memory_resource host_mr;
+
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    // Merge the partial results
+    accumulator_t mapping{};
+    for (const auto &file_name : file_names) {
+        accumulator_t partial{};
+        material_validator::read_material_mapping(file_name, partial);
+        mapping.merge(partial);
+    }
+
+    std::cout << "INFO: Merged " << file_names.size() << " partial file(s): "
+              << mapping.n_hits() << " material hits in " << mapping.size()
+              << " bins" << std::endl;
+
+    // Fill the averaged material into the material maps
+    const std::string det_name{det.name(names)};
+
+    auto maps_data = io::material_map_writer::to_payload(det, names);
+    const std::size_t n_updated =
+        material_validator::apply_material_mapping(maps_data, mapping);
+
+    std::cout << "INFO: Updated " << n_updated << " material map bins"
+              << std::endl;
+
+    // Write the merged material maps
+    io::create_path(out_dir);
+
+    const std::string file_stem{det_name + "_" +
+                                std::string(io::material_map_writer::tag)};
+    io::file_handle file{out_dir / file_stem, ".json",
+                         std::ios::out | std::ios::binary | std::ios::trunc};
+
+    nlohmann::ordered_json out_json;
+    out_json["header"] =
+        io::material_map_writer::header_to_payload(det, det_name);
+    out_json["data"] = maps_data;
+
+    *file << std::setw(4) << out_json << std::endl;
+
+    std::cout << "INFO: Wrote " << (out_dir / (file_stem + ".json")).string()
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
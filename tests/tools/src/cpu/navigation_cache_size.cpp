@@ -0,0 +1,136 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_reader.hpp"
+
+// Detray test include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+#include "detray/test/utils/inspectors.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost
+#include "detray/options/boost_program_options.hpp"
+
+// System include(s)
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+/// Scans a detector with straight line tracks and recommends the minimal
+/// capacity of the navigation candidate cache, so that no candidate is dropped
+/// in any of the volumes.
+int main(int argc, char **argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detector<test::default_metadata>;
+    using algebra_t = typename detector_t::algebra_type;
+
+    // Use a cache that is large enough to record the full candidate demand
+    constexpr std::size_t scan_capacity{256u};
+
+    using track_t = free_track_parameters<algebra_t>;
+    using generator_t = uniform_track_generator<track_t>;
+    using navigator_t =
+        navigator<detector_t, scan_capacity, navigation::cache_inspector>;
+    using stepper_t = line_stepper<algebra_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    // Specific options for this tool
+    po::options_description desc("\ndetray navigation cache size options");
+
+    desc.add_options()("context", po::value<dindex>(),
+                       "Index of the geometry context")(
+        "margin", po::value<std::size_t>()->default_value(0u),
+        "Additional cache slots on top of the recommendation");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    generator_t::configuration trk_cfg{};
+    propagation::config prop_cfg{};
+
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, trk_cfg, prop_cfg);
+
+    detector_t::geometry_context gctx{};
+    if (vm.count("context")) {
+        gctx = detector_t::geometry_context{vm["context"].as<dindex>()};
+    }
+    const std::size_t margin{vm["margin"].as<std::size_t>()};
+
+    // Read the detector geometry
+    vecmem::host_memory_resource host_mr;
+
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    // Run the scan
+    propagator_t prop{prop_cfg};
+    navigation::cache_inspector cache_stats{};
+
+    std::size_t n_tracks{0u};
+    for (const auto &track : generator_t{trk_cfg}) {
+        typename propagator_t::state propagation(track, det, gctx);
+        prop.propagate(propagation);
+
+        cache_stats.merge(propagation._navigation.inspector());
+        ++n_tracks;
+    }
+
+    // Report
+    std::cout << "\nNavigation cache occupancy for detector "
+              << det.name(names) << " (" << n_tracks << " tracks)\n"
+              << "----------------------------\n";
+    std::cout << std::left << std::setw(8) << "index" << std::setw(40)
+              << "volume" << std::setw(12) << "max. cand." << "calls\n";
+
+    const auto &records = cache_stats.records();
+    for (std::size_t i = 0u; i < records.size(); ++i) {
+        if (records[i].n_calls == 0u) {
+            continue;
+        }
+        const tracking_volume vol{det, static_cast<dindex>(i)};
+
+        std::cout << std::left << std::setw(8) << i << std::setw(40)
+                  << vol.name(names) << std::setw(12)
+                  << records[i].high_water_mark << records[i].n_calls << "\n";
+    }
+
+    if (cache_stats.n_overflows() > 0u) {
+        std::cout << "\nWARNING: " << cache_stats.n_overflows()
+                  << " candidates exceeded the scan capacity of "
+                  << scan_capacity << std::endl;
+    }
+
+    const std::size_t recommended{cache_stats.recommended_capacity() + margin};
+    std::cout << "\nRecommended navigation cache capacity: " << recommended
+              << " (default: " << navigation::default_cache_size << ")\n"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,219 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/utils/create_path.hpp"
+
+// Detray plugin include(s)
+#include "detray/plugins/svgtools/illustrator.hpp"
+#include "detray/plugins/svgtools/writer.hpp"
+
+// Detray test include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+#include "detray/test/utils/inspectors.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Actsvg include(s)
+#include <actsvg/core.hpp>
+
+// Boost
+#include "detray/options/boost_program_options.hpp"
+
+// System include(s)
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+namespace {
+
+/// Write the grid bin statistics of @param heatmap to the csv file
+/// @param file_name
+void write_heatmap(const std::string &file_name,
+                   const navigation::grid_heatmap_inspector &heatmap) {
+
+    io::create_path(std::filesystem::path{file_name}.parent_path());
+
+    std::ofstream file{file_name, std::ios::out | std::ios::trunc};
+    if (!file) {
+        throw std::invalid_argument("Could not open file: " + file_name);
+    }
+
+    file << "volume,bin,lookups,candidates,hits" << std::endl;
+
+    const auto &records = heatmap.records();
+    for (std::size_t v = 0u; v < records.size(); ++v) {
+        for (std::size_t b = 0u; b < records[v].size(); ++b) {
+            const auto &rec = records[v][b];
+            file << v << "," << b << "," << rec.n_lookups << ","
+                 << rec.n_candidates << "," << rec.n_hits << std::endl;
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Scans a detector with straight line tracks and records the surface grid
+/// lookups of the navigation per volume and grid bin. The counts are written
+/// to a csv file and the mean number of candidates per lookup is displayed on
+/// top of the grids, in order to find over- and under-binned grids.
+int main(int argc, char **argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detector<test::default_metadata>;
+    using algebra_t = typename detector_t::algebra_type;
+
+    using track_t = free_track_parameters<algebra_t>;
+    using generator_t = uniform_track_generator<track_t>;
+    using navigator_t =
+        navigator<detector_t, navigation::default_cache_size,
+                  navigation::grid_heatmap_inspector>;
+    using stepper_t = line_stepper<algebra_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    // Specific options for this tool
+    po::options_description desc("\ndetray navigation heatmap options");
+
+    desc.add_options()("outdir", po::value<std::string>(),
+                       "Output directory for the csv file and plots")(
+        "context", po::value<dindex>(), "Index of the geometry context");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    generator_t::configuration trk_cfg{};
+    propagation::config prop_cfg{};
+
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, trk_cfg, prop_cfg);
+
+    std::string outdir{vm.count("outdir") ? vm["outdir"].as<std::string>()
+                                          : "./navigation_heatmap/"};
+    auto path = detray::io::create_path(outdir);
+
+    detector_t::geometry_context gctx{};
+    if (vm.count("context")) {
+        gctx = detector_t::geometry_context{vm["context"].as<dindex>()};
+    }
+
+    // Read the detector geometry
+    vecmem::host_memory_resource host_mr;
+
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    // Run the scan
+    propagator_t prop{prop_cfg};
+    navigation::grid_heatmap_inspector heatmap{};
+
+    std::size_t n_tracks{0u};
+    for (const auto &track : generator_t{trk_cfg}) {
+        typename propagator_t::state propagation(track, det, gctx);
+        prop.propagate(propagation);
+
+        heatmap.merge(propagation._navigation.inspector());
+        ++n_tracks;
+    }
+
+    const std::string csv_file{
+        (path / (det.name(names) + "_heatmap.csv")).string()};
+    write_heatmap(csv_file, heatmap);
+
+    // Report
+    std::cout << "\nSurface grid lookups for detector " << det.name(names)
+              << " (" << n_tracks << " tracks)\n"
+              << "----------------------------\n";
+    std::cout << std::left << std::setw(8) << "index" << std::setw(40)
+              << "volume" << std::setw(10) << "bins" << std::setw(12)
+              << "used bins" << std::setw(14) << "cand./lookup"
+              << "hits/cand.\n";
+
+    // Draw the mean number of candidates per lookup for every grid bin
+    detray::svgtools::illustrator il{det, names};
+
+    const actsvg::views::x_y xy;
+    const actsvg::views::z_phi zphi;
+
+    const auto &records = heatmap.records();
+    for (std::size_t i = 0u; i < records.size(); ++i) {
+        if (records[i].empty()) {
+            continue;
+        }
+        const auto vol_idx{static_cast<dindex>(i)};
+        const tracking_volume vol{det, vol_idx};
+
+        std::size_t n_used_bins{0u};
+        navigation::grid_heatmap_inspector::bin_record vol_sum{};
+        std::vector<double> cand_per_lookup(records[i].size(), 0.);
+
+        for (std::size_t b = 0u; b < records[i].size(); ++b) {
+            const auto &rec = records[i][b];
+            if (rec.n_lookups == 0u) {
+                continue;
+            }
+            ++n_used_bins;
+            vol_sum.n_lookups += rec.n_lookups;
+            vol_sum.n_candidates += rec.n_candidates;
+            vol_sum.n_hits += rec.n_hits;
+
+            cand_per_lookup[b] = static_cast<double>(rec.n_candidates) /
+                                 static_cast<double>(rec.n_lookups);
+        }
+
+        const auto ratio = [](std::size_t num, std::size_t denom) {
+            return denom > 0u ? static_cast<double>(num) /
+                                    static_cast<double>(denom)
+                              : 0.;
+        };
+        std::cout << std::left << std::setw(8) << i << std::setw(40)
+                  << vol.name(names) << std::setw(10) << records[i].size()
+                  << std::setw(12) << n_used_bins << std::setw(14)
+                  << ratio(vol_sum.n_candidates, vol_sum.n_lookups)
+                  << ratio(vol_sum.n_hits, vol_sum.n_candidates) << "\n";
+
+        const std::string prefix{det.name(names) + "_" + vol.name(names)};
+        for (const auto &heatmap_svg :
+             {il.draw_grid_heatmap(prefix + "_xy", vol_idx, cand_per_lookup,
+                                   xy),
+              il.draw_grid_heatmap(prefix + "_zphi", vol_idx, cand_per_lookup,
+                                   zphi)}) {
+            if (!heatmap_svg._sub_objects.empty()) {
+                detray::svgtools::write_svg(path / heatmap_svg._id,
+                                            heatmap_svg);
+            }
+        }
+    }
+
+    std::cout << "\nWrote grid bin statistics to " << csv_file << "\n"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
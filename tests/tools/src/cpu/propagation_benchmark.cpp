@@ -21,6 +21,7 @@
 #include "detray/io/frontend/detector_reader.hpp"
 
 // Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
 #include "detray/benchmarks/cpu/propagation_benchmark.hpp"
 
 // Detray test include(s).
@@ -179,12 +180,9 @@ int main(int argc, char** argv) {
         setup_str += "no cov.";
     }
 
-    // These fields are needed by the plotting scripts, even if undefined
-    ::benchmark::AddCustomContext("Backend", "CPU");
-    ::benchmark::AddCustomContext("Backend Name", proc_name);
-    ::benchmark::AddCustomContext("Algebra-plugin",
-                                  detray::types::get_name<test_algebra>());
-    ::benchmark::AddCustomContext("Detector Setup", setup_str);
+    // Hardware and build information for the plotting and comparison scripts
+    detray::benchmarks::add_benchmark_context<test_algebra>("CPU", proc_name,
+                                                            setup_str);
 
     // Run benchmarks
     ::benchmark::RunSpecifiedBenchmarks();
@@ -21,7 +21,11 @@
 #include "detray/io/frontend/detector_reader.hpp"
 
 // Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
+#include "detray/benchmarks/cpu/hot_detector_replica.hpp"
+#include "detray/benchmarks/cpu/numa_propagation_benchmark.hpp"
 #include "detray/benchmarks/cpu/propagation_benchmark.hpp"
+#include "detray/benchmarks/cpu/thread_placement.hpp"
 
 // Detray test include(s).
 #include "detray/test/utils/simulation/event_generator/track_generators.hpp"
@@ -35,11 +39,14 @@
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
 
 // System include(s)
 #include <algorithm>
+#include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace po = boost::program_options;
 
@@ -113,7 +120,15 @@ int main(int argc, char** argv) {
     desc.add_options()("context", po::value<dindex>(),
                        "Index of the geometry context")(
         "bknd_name", po::value<std::string>(), "Name of the Processor")(
-        "sort_tracks", "Does nothing in scaling test");
+        "sort_tracks", "Does nothing in scaling test")(
+        "thread_placement", po::value<std::string>(),
+        "Pin the threads to the cpus: 'none', 'compact' (fill one NUMA node "
+        "after the other) or 'scatter' (round-robin over the NUMA nodes)")(
+        "numa_local_detector",
+        "Use one copy of the detector and tracks per NUMA node")(
+        "numa_local_hot_data",
+        "Use one copy of the surface descriptors, acceleration grids and "
+        "tracks per NUMA node, share the rest of the detector");
 
     // Configs to be filled
     detray::io::detector_reader_config reader_cfg{};
@@ -135,6 +150,22 @@ int main(int argc, char** argv) {
         proc_name = vm["bknd_name"].as<std::string>();
     }
 
+    // Thread placement and NUMA-local data
+    const detray::benchmarks::numa_topology topo{};
+    auto placement{detray::benchmarks::thread_placement::e_none};
+    if (vm.count("thread_placement")) {
+        placement = detray::benchmarks::thread_placement_from_string(
+            vm["thread_placement"].as<std::string>());
+    }
+    const bool numa_local_hot{vm.count("numa_local_hot_data") != 0u};
+    const bool numa_local{numa_local_hot ||
+                          vm.count("numa_local_detector") != 0u};
+    const bool do_placement{numa_local ||
+                            placement !=
+                                detray::benchmarks::thread_placement::e_none};
+
+    std::cout << "No. NUMA nodes: " << topo.n_nodes() << "\n" << std::endl;
+
     // String that describes the detector setup
     std::string setup_str{};
     auto add_delim = [](std::string& str) { str += ", "; };
@@ -174,6 +205,68 @@ int main(int argc, char** argv) {
     // Create a constant b-field
     auto bfield = bfield::create_const_field<scalar>(B);
 
+    // Per node copies of the detector and the track samples, first touched
+    // on the respective node
+    std::vector<detector_t> det_replicas{};
+    std::vector<std::vector<dvector<free_track_parameters_t>>>
+        weak_sc_replicas{};
+    std::vector<std::vector<dvector<free_track_parameters_t>>>
+        strong_sc_replicas{};
+
+    std::vector<const detector_t*> dets{&det};
+    std::vector<const std::vector<dvector<free_track_parameters_t>>*>
+        weak_sc_samples{&track_samples_weak_sc};
+    std::vector<const std::vector<dvector<free_track_parameters_t>>*>
+        strong_sc_samples{&track_samples_strong_sc};
+
+    // Shared detector and per node copies of its hot data
+    using hot_replica_t = detray::benchmarks::hot_detector_replica<detector_t>;
+    using hot_detector_t = typename hot_replica_t::detector_type;
+
+    vecmem::copy host_copy{};
+    std::vector<detector_t> shared_det{};
+    std::vector<hot_replica_t> hot_replicas{};
+    std::vector<const hot_detector_t*> hot_dets{};
+
+    if (numa_local_hot) {
+        shared_det.push_back(
+            detray::io::read_detector<detector_t>(host_mr, reader_cfg).first);
+        hot_replicas = detray::benchmarks::make_numa_replicas<hot_replica_t>(
+            topo, [&shared_det, &host_mr, &host_copy]() {
+                return hot_replica_t{shared_det.front(), host_mr, host_copy};
+            });
+        for (const hot_replica_t& replica : hot_replicas) {
+            hot_dets.push_back(&replica.get());
+        }
+    } else if (numa_local) {
+        det_replicas = detray::benchmarks::make_numa_replicas<detector_t>(
+            topo, [&host_mr, &reader_cfg]() {
+                return detray::io::read_detector<detector_t>(host_mr,
+                                                             reader_cfg)
+                    .first;
+            });
+    }
+    if (numa_local) {
+        weak_sc_replicas = detray::benchmarks::make_numa_replicas<
+            std::vector<dvector<free_track_parameters_t>>>(
+            topo, [&track_samples_weak_sc]() { return track_samples_weak_sc; });
+        strong_sc_replicas = detray::benchmarks::make_numa_replicas<
+            std::vector<dvector<free_track_parameters_t>>>(
+            topo,
+            [&track_samples_strong_sc]() { return track_samples_strong_sc; });
+
+        dets.clear();
+        weak_sc_samples.clear();
+        strong_sc_samples.clear();
+        for (std::size_t i = 0u; i < topo.n_nodes(); ++i) {
+            if (!numa_local_hot) {
+                dets.push_back(&det_replicas[i]);
+            }
+            weak_sc_samples.push_back(&weak_sc_replicas[i]);
+            strong_sc_samples.push_back(&strong_sc_replicas[i]);
+        }
+    }
+
     // Build actor states
     dtuple<> empty_state{};
 
@@ -190,7 +283,46 @@ int main(int argc, char** argv) {
     bench_cfg.n_warmup(
         static_cast<int>(std::ceil(0.1f * static_cast<float>(n_max_tracks))));
 
-    if (prop_cfg.stepping.do_covariance_transport) {
+    // Register the benchmarks with thread placement on the detector copies
+    // @param pdets (one per node or a single one)
+    auto register_placement_benchmarks =
+        [&]<typename det_t>(const std::vector<const det_t*>& pdets,
+                            const std::string& numa_str) {
+            using cov_propagator_t =
+                propagator<stepper_t, navigator<det_t>, default_chain>;
+            using propagator_t =
+                propagator<stepper_t, navigator<det_t>, empty_chain_t>;
+
+            if (prop_cfg.stepping.do_covariance_transport) {
+                detray::benchmarks::register_numa_benchmark<cov_propagator_t>(
+                    det_name + "_W_COV_TRANSPORT_WEAK-SCALING" + numa_str,
+                    bench_cfg, prop_cfg, topo, placement, pdets, bfield,
+                    &actor_states, weak_sc_samples, n_tracks_weak_sc,
+                    n_threads);
+
+                detray::benchmarks::register_numa_benchmark<cov_propagator_t>(
+                    det_name + "_W_COV_TRANSPORT_STRONG-SCALING" + numa_str,
+                    bench_cfg, prop_cfg, topo, placement, pdets, bfield,
+                    &actor_states, strong_sc_samples,
+                    {strong_sc_sample_size}, n_threads);
+            } else {
+                detray::benchmarks::register_numa_benchmark<propagator_t>(
+                    det_name + "_WEAK-SCALING" + numa_str, bench_cfg,
+                    prop_cfg, topo, placement, pdets, bfield, &empty_state,
+                    weak_sc_samples, n_tracks_weak_sc, n_threads);
+
+                detray::benchmarks::register_numa_benchmark<propagator_t>(
+                    det_name + "_STRONG-SCALING" + numa_str, bench_cfg,
+                    prop_cfg, topo, placement, pdets, bfield, &empty_state,
+                    strong_sc_samples, {strong_sc_sample_size}, n_threads);
+            }
+        };
+
+    if (numa_local_hot) {
+        register_placement_benchmarks(hot_dets, "_NUMA-LOCAL-HOT");
+    } else if (do_placement) {
+        register_placement_benchmarks(dets, numa_local ? "_NUMA-LOCAL" : "");
+    } else if (prop_cfg.stepping.do_covariance_transport) {
         // Number of tracks to be sampled and number of threads are the same
         detray::benchmarks::register_benchmark<
             detray::benchmarks::host_propagation_bm, stepper_t, default_chain>(
@@ -216,21 +348,19 @@ int main(int argc, char** argv) {
             det_name + "_STRONG-SCALING", bench_cfg, prop_cfg, det, bfield,
             &empty_state, track_samples_strong_sc, {strong_sc_sample_size},
             n_threads, max_chunk_size, sched_policy);
+    }
 
+    if (!prop_cfg.stepping.do_covariance_transport) {
         if (!setup_str.empty()) {
             add_delim(setup_str);
         }
         setup_str += "no cov.";
     }
 
-    // These fields are needed by the plotting scripts
-    ::benchmark::AddCustomContext("Backend", "CPU");
-    ::benchmark::AddCustomContext("Backend Name", proc_name);
-    ::benchmark::AddCustomContext(
-        "Max no. Threads", std::to_string(std::thread::hardware_concurrency()));
-    ::benchmark::AddCustomContext("Algebra-plugin",
-                                  detray::types::get_name<test_algebra>());
-    ::benchmark::AddCustomContext("Detector Setup", setup_str);
+    // Hardware and build information for the plotting and comparison scripts
+    detray::benchmarks::add_benchmark_context<test_algebra>(
+        "CPU", proc_name, setup_str,
+        static_cast<unsigned int>(*std::ranges::max_element(n_threads)));
 
     // Run benchmarks
     ::benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,226 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/covfie/read_bfield.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
+#include "detray/benchmarks/propagation_benchmark_utils.hpp"
+#include "detray/benchmarks/startup_benchmark.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Detray tools include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s)
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+namespace {
+
+/// Read the detector and set up the magnetic field, then propagate the
+/// track @param track
+///
+/// @returns the detector, the field and whether the propagation succeeded
+template <typename detector_t, typename field_t, typename make_field_t>
+auto first_propagation(
+    vecmem::memory_resource &mr, const io::detector_reader_config &reader_cfg,
+    const make_field_t &make_field, const propagation::config &prop_cfg,
+    const free_track_parameters<typename detector_t::algebra_type> &track) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using stepper_t = rk_stepper<typename field_t::view_t, algebra_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain<>>;
+
+    auto [det, names] = io::read_detector<detector_t>(mr, reader_cfg);
+    field_t field = make_field();
+
+    propagator_t p{prop_cfg};
+    typename propagator_t::state p_state(track, field, det);
+    const bool success{p.propagate(p_state)};
+
+    return std::make_tuple(std::move(det), std::move(field), success);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detray::detector<test::default_metadata>;
+    using test_algebra = typename detector_t::algebra_type;
+    using scalar = dscalar<test_algebra>;
+    using vector3 = dvector3D<test_algebra>;
+
+    using free_track_parameters_t = free_track_parameters<test_algebra>;
+    using uniform_gen_t =
+        detail::random_numbers<scalar, std::uniform_real_distribution<scalar>>;
+    using track_generator_t =
+        random_track_generator<free_track_parameters_t, uniform_gen_t>;
+
+    using const_field_t = bfield::const_field_t<scalar>;
+    using inhom_field_t = bfield::inhom_field_t<scalar>;
+
+    // Host memory resource (thread safe for the parallel detector reading)
+    vecmem::host_memory_resource host_mr;
+
+    // Constant magnetic field, if no field map is given
+    vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+
+    //
+    // Configuration
+    //
+
+    // Google benchmark specific options
+    ::benchmark::Initialize(&argc, argv);
+
+    // Specific options for this test
+    po::options_description desc("\ndetray startup benchmark options");
+
+    desc.add_options()("bfield_file", po::value<std::string>(),
+                       "Covfie magnetic field map file")(
+        "n_reads", po::value<int>()->default_value(5),
+        "Number of times the detector is set up per benchmark case")(
+        "check", "Check the detector consistency after reading")(
+        "bknd_name", po::value<std::string>(), "Name of the Processor");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    track_generator_t::configuration trk_cfg{};
+    propagation::config prop_cfg{};
+
+    // Read options from commandline
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, trk_cfg, prop_cfg);
+
+    // Custom options
+    const int n_reads{vm["n_reads"].as<int>()};
+    // The consistency check is part of the startup only if requested
+    reader_cfg.do_check(vm.count("check") != 0);
+
+    std::string proc_name{"unknown"};
+    if (vm.count("bknd_name")) {
+        proc_name = vm["bknd_name"].as<std::string>();
+    }
+    std::string bfield_file{};
+    if (vm.count("bfield_file")) {
+        bfield_file = vm["bfield_file"].as<std::string>();
+    }
+
+    // String that describes the detector setup
+    std::string setup_str{};
+    auto add_delim = [](std::string& str) { str += ", "; };
+    if (!vm.count("grid_file")) {
+        setup_str += "no grids";
+    }
+    if (!vm.count("material_file")) {
+        if (!setup_str.empty()) {
+            add_delim(setup_str);
+        }
+        setup_str += "no mat.";
+    }
+    if (bfield_file.empty()) {
+        if (!setup_str.empty()) {
+            add_delim(setup_str);
+        }
+        setup_str += "const. field";
+    }
+
+    //
+    // Prepare data
+    //
+
+    // Read the detector once to get its name
+    std::string det_name{};
+    {
+        const auto [det, names] =
+            detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+        det_name = det.name(names);
+    }
+
+    // The track for the first propagation
+    auto track_samples =
+        detray::benchmarks::generate_track_samples<track_generator_t>(
+            &host_mr, {1}, trk_cfg, false);
+    const free_track_parameters_t track = track_samples.front().front();
+
+    //
+    // Register benchmarks
+    //
+
+    detray::benchmarks::register_startup_benchmark(
+        det_name + "_READ_DETECTOR",
+        [&host_mr, &reader_cfg]() {
+            return detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+        },
+        n_reads);
+
+    if (!bfield_file.empty()) {
+        detray::benchmarks::register_startup_benchmark(
+            det_name + "_READ_BFIELD",
+            [&bfield_file]() {
+                return detray::io::read_bfield<inhom_field_t>(bfield_file);
+            },
+            n_reads);
+
+        detray::benchmarks::register_startup_benchmark(
+            det_name + "_FIRST_PROPAGATION",
+            [&]() {
+                return first_propagation<detector_t, inhom_field_t>(
+                    host_mr, reader_cfg,
+                    [&bfield_file]() {
+                        return detray::io::read_bfield<inhom_field_t>(
+                            bfield_file);
+                    },
+                    prop_cfg, track);
+            },
+            n_reads);
+    } else {
+        detray::benchmarks::register_startup_benchmark(
+            det_name + "_FIRST_PROPAGATION",
+            [&]() {
+                return first_propagation<detector_t, const_field_t>(
+                    host_mr, reader_cfg,
+                    [&B]() { return bfield::create_const_field<scalar>(B); },
+                    prop_cfg, track);
+            },
+            n_reads);
+    }
+
+    // Hardware and build information for the plotting and comparison scripts
+    detray::benchmarks::add_benchmark_context<test_algebra>("CPU", proc_name,
+                                                            setup_str);
+
+    // Run benchmarks
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+}
@@ -0,0 +1,476 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detector.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_reader.hpp"
+
+// Detray test include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost
+#include "detray/options/boost_program_options.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+namespace {
+
+/// Navigation cache capacities that can be tuned (compile time parameter)
+constexpr std::array<std::size_t, 5u> tunable_capacities{4u, 8u, 10u, 16u,
+                                                         32u};
+/// Cache capacity of the reference propagation
+constexpr std::size_t reference_capacity{64u};
+
+/// Records the indices of the sensitive surfaces a track passes
+struct sensitive_recorder : actor {
+
+    static constexpr actor_trigger trigger{actor_trigger::e_on_sensitive};
+
+    struct state {
+        std::vector<dindex> surfaces{};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &recorder_state,
+                    const propagator_state_t &propagation) const {
+        if (propagation._navigation.is_on_sensitive()) {
+            recorder_state.surfaces.push_back(
+                propagation._navigation.barcode().index());
+        }
+    }
+};
+
+/// Result of a single configuration in the parameter sweep
+struct tuning_result {
+    std::size_t cache_capacity{0u};
+    propagation::config cfg{};
+    /// Best throughput over all repetitions [tracks/s]
+    double throughput{0.};
+    /// Fraction of the reference sensitive surfaces that were found
+    double efficiency{0.};
+    /// Number of tracks that missed at least one reference surface
+    std::size_t n_tracks_with_holes{0u};
+    bool is_pareto_optimal{false};
+};
+
+/// Parameter values to sweep (the cache capacity is swept separately)
+struct sweep_config {
+    std::vector<float> max_mask_tolerances{};
+    std::vector<dindex> search_windows{};
+    std::vector<float> overstep_tolerances{};
+    std::vector<float> rk_error_tols{};
+    std::size_t n_repetitions{1u};
+};
+
+/// Propagate all @param tracks with a given navigation cache capacity and
+/// @param cfg and record the sensitive surfaces per track
+template <std::size_t capacity, typename detector_t, typename field_t,
+          typename track_t>
+auto record_surfaces(const detector_t &det,
+                     const typename detector_t::geometry_context &gctx,
+                     const field_t &field, const std::vector<track_t> &tracks,
+                     const propagation::config &cfg) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using stepper_t = rk_stepper<typename field_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<sensitive_recorder>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t, capacity>, actor_chain_t>;
+
+    const propagator_t prop{cfg};
+
+    std::vector<std::vector<dindex>> surfaces{};
+    surfaces.reserve(tracks.size());
+    for (const auto &track : tracks) {
+        sensitive_recorder::state recorder_state{};
+
+        typename propagator_t::state propagation(track, field, det, gctx);
+        prop.propagate(propagation, detray::tie(recorder_state));
+
+        surfaces.push_back(std::move(recorder_state.surfaces));
+    }
+
+    return surfaces;
+}
+
+/// Time the propagation of all @param tracks without any actors
+///
+/// @returns the best throughput of all repetitions [tracks/s]
+template <std::size_t capacity, typename detector_t, typename field_t,
+          typename track_t>
+double measure_throughput(const detector_t &det,
+                          const typename detector_t::geometry_context &gctx,
+                          const field_t &field,
+                          const std::vector<track_t> &tracks,
+                          const propagation::config &cfg,
+                          const std::size_t n_repetitions) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using stepper_t = rk_stepper<typename field_t::view_t, algebra_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t, capacity>, actor_chain<>>;
+
+    const propagator_t prop{cfg};
+
+    double best_time{std::numeric_limits<double>::max()};
+    for (std::size_t i = 0u; i < n_repetitions; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (const auto &track : tracks) {
+            typename propagator_t::state propagation(track, field, det, gctx);
+            prop.propagate(propagation);
+        }
+        const std::chrono::duration<double> t{
+            std::chrono::steady_clock::now() - t0};
+
+        best_time = std::min(best_time, t.count());
+    }
+
+    return static_cast<double>(tracks.size()) / best_time;
+}
+
+/// Compare the recorded sensitive surfaces to the reference and fill the
+/// efficiency into @param result
+void evaluate_efficiency(const std::vector<std::vector<dindex>> &reference,
+                         std::vector<std::vector<dindex>> recorded,
+                         tuning_result &result) {
+
+    std::size_t n_ref{0u};
+    std::size_t n_found{0u};
+    result.n_tracks_with_holes = 0u;
+
+    for (std::size_t i = 0u; i < reference.size(); ++i) {
+        std::vector<dindex> ref{reference[i]};
+        std::ranges::sort(ref);
+        std::ranges::sort(recorded[i]);
+
+        std::vector<dindex> matched{};
+        std::ranges::set_intersection(ref, recorded[i],
+                                      std::back_inserter(matched));
+
+        n_ref += ref.size();
+        n_found += matched.size();
+        if (matched.size() < ref.size()) {
+            ++result.n_tracks_with_holes;
+        }
+    }
+
+    result.efficiency =
+        n_ref == 0u ? 1.
+                    : static_cast<double>(n_found) / static_cast<double>(n_ref);
+}
+
+/// Sweep the runtime parameters for the navigation cache @tparam capacity
+template <std::size_t capacity, typename detector_t, typename field_t,
+          typename track_t>
+void sweep(const detector_t &det,
+           const typename detector_t::geometry_context &gctx,
+           const field_t &field, const std::vector<track_t> &tracks,
+           const propagation::config &base_cfg, const sweep_config &sweep_cfg,
+           const std::vector<std::vector<dindex>> &reference,
+           std::vector<tuning_result> &results) {
+
+    for (const float mask_tol : sweep_cfg.max_mask_tolerances) {
+        for (const dindex window : sweep_cfg.search_windows) {
+            for (const float overstep_tol : sweep_cfg.overstep_tolerances) {
+                for (const float rk_tol : sweep_cfg.rk_error_tols) {
+
+                    tuning_result result{};
+                    result.cache_capacity = capacity;
+                    result.cfg = base_cfg;
+                    result.cfg.navigation.max_mask_tolerance = mask_tol;
+                    result.cfg.navigation.search_window = {window, window};
+                    result.cfg.navigation.overstep_tolerance = overstep_tol;
+                    result.cfg.stepping.rk_error_tol = rk_tol;
+
+                    result.throughput = measure_throughput<capacity>(
+                        det, gctx, field, tracks, result.cfg,
+                        sweep_cfg.n_repetitions);
+
+                    evaluate_efficiency(
+                        reference,
+                        record_surfaces<capacity>(det, gctx, field, tracks,
+                                                  result.cfg),
+                        result);
+
+                    results.push_back(result);
+                }
+            }
+        }
+    }
+}
+
+/// Flag the results that are not outperformed in throughput and efficiency
+/// by any other result
+void find_pareto_front(std::vector<tuning_result> &results) {
+
+    std::ranges::sort(results, [](const auto &a, const auto &b) {
+        return (a.throughput > b.throughput) ||
+               (a.throughput == b.throughput && a.efficiency > b.efficiency);
+    });
+
+    double best_efficiency{-1.};
+    for (auto &result : results) {
+        if (result.efficiency > best_efficiency) {
+            result.is_pareto_optimal = true;
+            best_efficiency = result.efficiency;
+        }
+    }
+}
+
+/// Print a row of the results table
+void print_result(std::ostream &out, const tuning_result &result) {
+    const auto &nav_cfg = result.cfg.navigation;
+
+    out << std::left << std::setw(8) << result.cache_capacity << std::setw(12)
+        << nav_cfg.max_mask_tolerance / unit<float>::mm << std::setw(8)
+        << nav_cfg.search_window[0] << std::setw(14)
+        << nav_cfg.overstep_tolerance / unit<float>::um << std::setw(12)
+        << result.cfg.stepping.rk_error_tol / unit<float>::mm << std::setw(14)
+        << result.throughput << std::setw(12) << result.efficiency
+        << result.n_tracks_with_holes << "\n";
+}
+
+/// Write all results to the csv file @param file_name
+void write_results(const std::string &file_name,
+                   const std::vector<tuning_result> &results) {
+    std::ofstream out{file_name};
+
+    out << "cache_capacity,max_mask_tolerance,search_window,"
+           "overstep_tolerance,rk_error_tol,throughput,efficiency,"
+           "n_tracks_with_holes,pareto_optimal\n";
+
+    for (const auto &result : results) {
+        const auto &nav_cfg = result.cfg.navigation;
+
+        out << result.cache_capacity << ","
+            << nav_cfg.max_mask_tolerance / unit<float>::mm << ","
+            << nav_cfg.search_window[0] << ","
+            << nav_cfg.overstep_tolerance / unit<float>::um << ","
+            << result.cfg.stepping.rk_error_tol / unit<float>::mm << ","
+            << result.throughput << "," << result.efficiency << ","
+            << result.n_tracks_with_holes << ","
+            << (result.is_pareto_optimal ? 1 : 0) << "\n";
+    }
+}
+
+}  // anonymous namespace
+
+/// Sweeps the navigation and stepping configuration, as well as the capacity
+/// of the navigation cache, on a detector in a constant magnetic field. For
+/// every configuration, the propagation throughput and the fraction of the
+/// sensitive surfaces that are found are measured. The efficiency is measured
+/// against a propagation with a large cache and search window. Prints the
+/// Pareto-optimal configurations.
+int main(int argc, char **argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detector<test::default_metadata>;
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar = dscalar<algebra_t>;
+
+    using track_t = free_track_parameters<algebra_t>;
+    using generator_t = uniform_track_generator<track_t>;
+    using field_t = bfield::const_field_t<scalar>;
+
+    // Specific options for this tool
+    po::options_description desc("\ndetray propagation tuner options");
+
+    desc.add_options()("context", po::value<dindex>(),
+                       "Index of the geometry context")(
+        "bz", po::value<float>()->default_value(2.f),
+        "Strength of the constant magnetic field in z [T]")(
+        "repetitions", po::value<std::size_t>()->default_value(3u),
+        "Number of timed runs per configuration (the best is taken)")(
+        "sweep_cache_capacity",
+        po::value<std::vector<std::size_t>>()->multitoken(),
+        "Navigation cache capacities to try (out of 4, 8, 10, 16, 32)")(
+        "sweep_max_mask_tolerance",
+        po::value<std::vector<float>>()->multitoken(),
+        "Maximal mask tolerances to try [mm]")(
+        "sweep_search_window", po::value<std::vector<dindex>>()->multitoken(),
+        "Grid search window sizes to try (same in both directions)")(
+        "sweep_overstep_tolerance",
+        po::value<std::vector<float>>()->multitoken(),
+        "Overstepping tolerances to try [um]")(
+        "sweep_rk_tolerance", po::value<std::vector<float>>()->multitoken(),
+        "Runge-Kutta error tolerances to try [mm]")(
+        "output_file", po::value<std::string>(),
+        "Write all results to this csv file");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    generator_t::configuration trk_cfg{};
+    propagation::config prop_cfg{};
+
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, trk_cfg, prop_cfg);
+
+    detector_t::geometry_context gctx{};
+    if (vm.count("context")) {
+        gctx = detector_t::geometry_context{vm["context"].as<dindex>()};
+    }
+
+    // Parameters that are not swept keep the value of the base configuration
+    sweep_config sweep_cfg{};
+    sweep_cfg.n_repetitions = std::max(vm["repetitions"].as<std::size_t>(),
+                                       static_cast<std::size_t>(1u));
+
+    std::vector<std::size_t> capacities{navigation::default_cache_size};
+    if (vm.count("sweep_cache_capacity")) {
+        capacities = vm["sweep_cache_capacity"].as<std::vector<std::size_t>>();
+    }
+
+    sweep_cfg.max_mask_tolerances = {prop_cfg.navigation.max_mask_tolerance};
+    if (vm.count("sweep_max_mask_tolerance")) {
+        sweep_cfg.max_mask_tolerances.clear();
+        for (const float tol :
+             vm["sweep_max_mask_tolerance"].as<std::vector<float>>()) {
+            sweep_cfg.max_mask_tolerances.push_back(tol * unit<float>::mm);
+        }
+    }
+    sweep_cfg.search_windows = {prop_cfg.navigation.search_window[0]};
+    if (vm.count("sweep_search_window")) {
+        sweep_cfg.search_windows =
+            vm["sweep_search_window"].as<std::vector<dindex>>();
+    }
+    sweep_cfg.overstep_tolerances = {prop_cfg.navigation.overstep_tolerance};
+    if (vm.count("sweep_overstep_tolerance")) {
+        sweep_cfg.overstep_tolerances.clear();
+        for (const float tol :
+             vm["sweep_overstep_tolerance"].as<std::vector<float>>()) {
+            sweep_cfg.overstep_tolerances.push_back(tol * unit<float>::um);
+        }
+    }
+    sweep_cfg.rk_error_tols = {prop_cfg.stepping.rk_error_tol};
+    if (vm.count("sweep_rk_tolerance")) {
+        sweep_cfg.rk_error_tols.clear();
+        for (const float tol :
+             vm["sweep_rk_tolerance"].as<std::vector<float>>()) {
+            sweep_cfg.rk_error_tols.push_back(tol * unit<float>::mm);
+        }
+    }
+
+    // Read the detector geometry
+    vecmem::host_memory_resource host_mr;
+
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    const field_t field = bfield::create_const_field<scalar>(
+        {0.f, 0.f, vm["bz"].as<float>() * unit<scalar>::T});
+
+    std::vector<track_t> tracks{};
+    for (const auto &track : generator_t{trk_cfg}) {
+        tracks.push_back(track);
+    }
+
+    // Reference: Large cache and search window, loose tolerances
+    propagation::config ref_cfg{prop_cfg};
+    dindex max_window{ref_cfg.navigation.search_window[0]};
+    for (const dindex window : sweep_cfg.search_windows) {
+        max_window = std::max(max_window, window);
+    }
+    ref_cfg.navigation.search_window = {max_window + 1u, max_window + 1u};
+    for (const float tol : sweep_cfg.max_mask_tolerances) {
+        ref_cfg.navigation.max_mask_tolerance =
+            std::max(ref_cfg.navigation.max_mask_tolerance, tol);
+    }
+    for (const float tol : sweep_cfg.rk_error_tols) {
+        ref_cfg.stepping.rk_error_tol =
+            std::min(ref_cfg.stepping.rk_error_tol, tol);
+    }
+
+    const auto reference = record_surfaces<reference_capacity>(
+        det, gctx, field, tracks, ref_cfg);
+
+    // Run the sweep
+    std::vector<tuning_result> results{};
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (
+            [&]() {
+                constexpr std::size_t capacity{tunable_capacities[I]};
+                if (std::ranges::find(capacities, capacity) !=
+                    capacities.end()) {
+                    sweep<capacity>(det, gctx, field, tracks, prop_cfg,
+                                    sweep_cfg, reference, results);
+                }
+            }(),
+            ...);
+    }(std::make_index_sequence<tunable_capacities.size()>{});
+
+    for (const std::size_t capacity : capacities) {
+        if (std::ranges::find(tunable_capacities, capacity) ==
+            tunable_capacities.end()) {
+            std::cout << "WARNING: Cache capacity " << capacity
+                      << " is not available and was skipped" << std::endl;
+        }
+    }
+
+    if (results.empty()) {
+        std::cout << "No configuration to tune" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    find_pareto_front(results);
+
+    // Report
+    std::cout << "\nPareto-optimal propagation configurations for detector "
+              << det.name(names) << " (" << tracks.size() << " tracks, "
+              << results.size() << " configurations)\n"
+              << "----------------------------\n";
+    std::cout << std::left << std::setw(8) << "cache" << std::setw(12)
+              << "mask [mm]" << std::setw(8) << "window" << std::setw(14)
+              << "overstep [um]" << std::setw(12) << "rk tol [mm]"
+              << std::setw(14) << "tracks/s" << std::setw(12) << "efficiency"
+              << "tracks w. holes\n";
+
+    for (const auto &result : results) {
+        if (result.is_pareto_optimal) {
+            print_result(std::cout, result);
+        }
+    }
+    std::cout << std::endl;
+
+    if (vm.count("output_file")) {
+        write_results(vm["output_file"].as<std::string>(), results);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -20,9 +20,11 @@
 #include "detray/test/common/detail/register_checks.hpp"
 #include "detray/test/common/detail/whiteboard.hpp"
 #include "detray/test/cpu/detector_scan.hpp"
+#include "detray/test/device/cuda/detector_scan.hpp"
 #include "detray/test/device/cuda/navigation_validation.hpp"
 
 // Vecmem include(s)
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
 #include <vecmem/memory/host_memory_resource.hpp>
 
 // GTest include(s)
@@ -55,6 +57,7 @@ int main(int argc, char** argv) {
 
     desc.add_options()("write_scan_data",
                        "Write the ray/helix scan data to file")(
+        "device_scan", "Run the ray/helix scan on device")(
         "data_dir",
         boost::program_options::value<std::string>()->default_value(
             "./validation_data"),
@@ -104,6 +107,18 @@ int main(int argc, char** argv) {
     str_nav_cfg.whiteboard(white_board);
     hel_nav_cfg.whiteboard(white_board);
 
+    // Generate the scan data on device, the scan tests only check it
+    if (vm.count("device_scan")) {
+        using algebra_t = typename detector_t::algebra_type;
+
+        vecmem::cuda::device_memory_resource dev_mr;
+
+        detray::cuda::fill_scan_data_device<detray::detail::ray<algebra_t>>(
+            &host_mr, &dev_mr, det, ray_scan_cfg);
+        detray::cuda::fill_scan_data_device<detray::detail::helix<algebra_t>>(
+            &host_mr, &dev_mr, det, hel_scan_cfg);
+    }
+
     // Navigation link consistency, discovered by ray intersection
     detray::detail::register_checks<detray::test::ray_scan>(det, names,
                                                             ray_scan_cfg, ctx);
@@ -21,6 +21,7 @@
 #include "detray/io/frontend/detector_reader.hpp"
 
 // Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
 #include "detray/benchmarks/device/cuda/propagation_benchmark.hpp"
 
 // Detray test include(s).
@@ -39,6 +40,7 @@
 // System include(s)
 #include <algorithm>
 #include <string>
+#include <vector>
 
 namespace po = boost::program_options;
 
@@ -84,7 +86,9 @@ int main(int argc, char** argv) {
     desc.add_options()("context", po::value<dindex>(),
                        "Index of the geometry context")(
         "bknd_name", po::value<std::string>(), "Name of the Processor")(
-        "sort_tracks", "Sort track samples by theta angle");
+        "sort_tracks", "Sort track samples by theta angle")(
+        "block_sizes", po::value<std::vector<int>>()->multitoken(),
+        "Scan the numbers of threads per block (default: 256)");
 
     // Configs to be filled
     detray::io::detector_reader_config reader_cfg{};
@@ -98,6 +102,10 @@ int main(int argc, char** argv) {
 
     // Custom options
     bool do_sort{(vm.count("sort_tracks") != 0)};
+    std::vector<int> block_sizes{256};
+    if (vm.count("block_sizes")) {
+        block_sizes = vm["block_sizes"].as<std::vector<int>>();
+    }
 
     // The geometry context to be used
     detector_t::geometry_context gctx;
@@ -158,21 +166,19 @@ int main(int argc, char** argv) {
         static_cast<int>(std::ceil(0.1f * static_cast<float>(n_max_tracks))));
 
     if (prop_cfg.stepping.do_covariance_transport) {
-        detray::benchmarks::register_benchmark<
-            detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::register_block_size_sweep<
             detray::benchmarks::cuda_propagator_type<
                 test::default_metadata, field_bknd_t,
                 detray::benchmarks::default_chain>>(
             det_name + "_W_COV_TRANSPORT", bench_cfg, prop_cfg, det, bfield,
-            &actor_states, track_samples, n_tracks, &dev_mr);
+            &actor_states, track_samples, n_tracks, &dev_mr, block_sizes);
     } else {
-        detray::benchmarks::register_benchmark<
-            detray::benchmarks::cuda_propagation_bm,
+        detray::benchmarks::register_block_size_sweep<
             detray::benchmarks::cuda_propagator_type<
                 test::default_metadata, field_bknd_t,
                 detray::benchmarks::empty_chain>>(
             det_name, bench_cfg, prop_cfg, det, bfield, &empty_state,
-            track_samples, n_tracks, &dev_mr);
+            track_samples, n_tracks, &dev_mr, block_sizes);
 
         if (!setup_str.empty()) {
             add_delim(setup_str);
@@ -180,12 +186,9 @@ int main(int argc, char** argv) {
         setup_str += "no cov.";
     }
 
-    // These fields are needed by the plotting scripts, even if undefined
-    ::benchmark::AddCustomContext("Backend", "CUDA");
-    ::benchmark::AddCustomContext("Backend Name", proc_name);
-    ::benchmark::AddCustomContext("Algebra-plugin",
-                                  detray::types::get_name<test_algebra>());
-    ::benchmark::AddCustomContext("Detector Setup", setup_str);
+    // Hardware and build information for the plotting and comparison scripts
+    detray::benchmarks::add_benchmark_context<test_algebra>("CUDA", proc_name,
+                                                            setup_str);
 
     // Run benchmarks
     ::benchmark::RunSpecifiedBenchmarks();
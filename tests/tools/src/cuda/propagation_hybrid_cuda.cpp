@@ -0,0 +1,228 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_reader.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
+#include "detray/benchmarks/device/cuda/hybrid_propagation_benchmark.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Detray tools include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+int main(int argc, char** argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detray::detector<test::default_metadata>;
+    using test_algebra = typename detector_t::algebra_type;
+    using scalar = dscalar<test_algebra>;
+    using vector3 = dvector3D<test_algebra>;
+
+    using free_track_parameters_t = free_track_parameters<test_algebra>;
+    using uniform_gen_t =
+        detail::random_numbers<scalar, std::uniform_real_distribution<scalar>>;
+    using track_generator_t =
+        random_track_generator<free_track_parameters_t, uniform_gen_t>;
+
+    using field_bknd_t = bfield::const_bknd_t<scalar>;
+
+    // Host and device memory resources
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+
+    // Constant magnetic field
+    vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+
+    // Mix of event sizes that is propagated in every benchmark iteration
+    std::vector<int> n_tracks{10,   10,   50,     100,    100,    500,
+                              1000, 1000, 5000,   10'000, 50'000, 100'000,
+                              10,   100,  10'000, 500,    50,     1000};
+
+    //
+    // Configuration
+    //
+
+    // Google benchmark specific options
+    ::benchmark::Initialize(&argc, argv);
+
+    // Specific options for this test
+    po::options_description desc("\ndetray hybrid propagation options");
+
+    desc.add_options()("bknd_name", po::value<std::string>(),
+                       "Name of the Processor")(
+        "sort_tracks", "Sort track samples by theta angle")(
+        "host_threads", po::value<int>(),
+        "Number of host threads (default: hardware concurrency)")(
+        "min_device_tracks", po::value<unsigned int>(),
+        "Events with fewer tracks stay on the host (default: 5000)")(
+        "max_host_tracks", po::value<unsigned int>(),
+        "Events with at least this many tracks wait for the device "
+        "(default: 100000)")(
+        "max_device_events", po::value<unsigned int>(),
+        "Maximal number of events on the device at the same time "
+        "(default: 1)")("block_size", po::value<int>(),
+                        "Number of threads per block (default: 256)");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    track_generator_t::configuration trk_cfg{};
+    propagation::config prop_cfg{};
+    detray::benchmarks::benchmark_base::configuration bench_cfg{};
+
+    // Read options from commandline
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, trk_cfg, prop_cfg);
+
+    // Custom options
+    bool do_sort{(vm.count("sort_tracks") != 0)};
+    std::string proc_name{"unknown"};
+    if (vm.count("bknd_name")) {
+        proc_name = vm["bknd_name"].as<std::string>();
+    }
+    int n_threads{static_cast<int>(std::thread::hardware_concurrency())};
+    if (vm.count("host_threads")) {
+        n_threads = vm["host_threads"].as<int>();
+    }
+    n_threads = std::max(n_threads, 1);
+
+    detray::benchmarks::hybrid_dispatch_config dispatch_cfg{};
+    if (vm.count("min_device_tracks")) {
+        dispatch_cfg.min_device_tracks =
+            vm["min_device_tracks"].as<unsigned int>();
+    }
+    if (vm.count("max_host_tracks")) {
+        dispatch_cfg.max_host_tracks = vm["max_host_tracks"].as<unsigned int>();
+    }
+    if (vm.count("max_device_events")) {
+        dispatch_cfg.max_device_events =
+            std::max(vm["max_device_events"].as<unsigned int>(), 1u);
+    }
+    if (vm.count("block_size")) {
+        dispatch_cfg.block_size = vm["block_size"].as<int>();
+    }
+
+    // String that describes the detector setup
+    std::string setup_str{};
+    auto add_delim = [](std::string& str) { str += ", "; };
+    if (!vm.count("grid_file")) {
+        setup_str += "no grids";
+    }
+    if (!vm.count("material_file")) {
+        if (!setup_str.empty()) {
+            add_delim(setup_str);
+        }
+        setup_str += "no mat.";
+    }
+    if (!setup_str.empty()) {
+        add_delim(setup_str);
+    }
+    setup_str += "no cov.";
+
+    //
+    // Prepare data
+    //
+
+    // Read the detector geometry
+    reader_cfg.do_check(true);
+
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+    const std::string& det_name = det.name(names);
+
+    // Generate the events
+    auto events =
+        detray::benchmarks::generate_track_samples<track_generator_t>(
+            &host_mr, n_tracks, trk_cfg, do_sort);
+
+    // Create a constant b-field
+    auto bfield = bfield::create_const_field<scalar>(B);
+
+    // Build actor states
+    dtuple<> empty_state{};
+
+    //
+    // Register benchmarks
+    //
+
+    using propagator_t = detray::benchmarks::cuda_propagator_type<
+        test::default_metadata, field_bknd_t,
+        detray::benchmarks::empty_chain>;
+    using hybrid_benchmark_t =
+        detray::benchmarks::hybrid_propagation_bm<propagator_t,
+                                                  decltype(bfield)>;
+
+    // Static choices for comparison: Everything on the host or on the device
+    detray::benchmarks::hybrid_dispatch_config host_cfg{dispatch_cfg};
+    host_cfg.min_device_tracks = std::numeric_limits<unsigned int>::max();
+    host_cfg.max_host_tracks = std::numeric_limits<unsigned int>::max();
+
+    detray::benchmarks::hybrid_dispatch_config device_cfg{dispatch_cfg};
+    device_cfg.min_device_tracks = 0u;
+    device_cfg.max_host_tracks = 0u;
+
+    const std::vector<std::pair<std::string,
+                                detray::benchmarks::hybrid_dispatch_config>>
+        dispatch_cases{{"HOST", host_cfg},
+                       {"DEVICE", device_cfg},
+                       {"HYBRID", dispatch_cfg}};
+
+    for (const auto& [case_name, case_cfg] : dispatch_cases) {
+        typename hybrid_benchmark_t::configuration prop_bm_cfg{bench_cfg};
+        prop_bm_cfg.propagation() = prop_cfg;
+
+        hybrid_benchmark_t prop_benchmark{prop_bm_cfg, case_cfg};
+
+        const std::string bench_name{"HYBRID_PROPAGATION_" + det_name + "_" +
+                                     case_name + "_" +
+                                     std::to_string(n_threads) + "_THREADS"};
+
+        std::cout << bench_name << "\n" << bench_cfg;
+
+        ::benchmark::RegisterBenchmark(bench_name.c_str(), prop_benchmark,
+                                       &dev_mr, &events, &det, &bfield,
+                                       &empty_state, n_threads)
+            ->UseRealTime();
+    }
+
+    // Hardware and build information for the plotting and comparison scripts
+    detray::benchmarks::add_benchmark_context<test_algebra>("CUDA", proc_name,
+                                                            setup_str);
+
+    // Run benchmarks
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+}
@@ -0,0 +1,199 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/bfield.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/frontend/detector_reader.hpp"
+
+// Detray benchmark include(s)
+#include "detray/benchmarks/benchmark_context.hpp"
+#include "detray/benchmarks/device/cuda/propagation_benchmark.hpp"
+#include "detray/benchmarks/startup_benchmark.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Detray tools include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/cuda/device_memory_resource.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/cuda/copy.hpp>
+
+// System include(s)
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+int main(int argc, char** argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using metadata_t = test::default_metadata;
+    using detector_t = detray::detector<metadata_t>;
+    using test_algebra = typename detector_t::algebra_type;
+    using scalar = dscalar<test_algebra>;
+    using vector3 = dvector3D<test_algebra>;
+
+    using free_track_parameters_t = free_track_parameters<test_algebra>;
+    using uniform_gen_t =
+        detail::random_numbers<scalar, std::uniform_real_distribution<scalar>>;
+    using track_generator_t =
+        random_track_generator<free_track_parameters_t, uniform_gen_t>;
+
+    // Only the constant field is instantiated for the device propagation
+    using field_bknd_t = bfield::const_bknd_t<scalar>;
+    using propagator_t = detray::benchmarks::cuda_propagator_type<
+        metadata_t, field_bknd_t, detray::benchmarks::empty_chain>;
+
+    // Host and device memory resources
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+
+    // Helper object for performing memory copies (to CUDA devices)
+    vecmem::cuda::copy cuda_cpy;
+
+    // Constant magnetic field
+    vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+
+    //
+    // Configuration
+    //
+
+    // Google benchmark specific options
+    ::benchmark::Initialize(&argc, argv);
+
+    // Specific options for this test
+    po::options_description desc("\ndetray startup benchmark options");
+
+    desc.add_options()("n_reads", po::value<int>()->default_value(5),
+                       "Number of times the detector is set up per benchmark "
+                       "case")(
+        "check", "Check the detector consistency after reading")(
+        "bknd_name", po::value<std::string>(), "Name of the Processor");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    track_generator_t::configuration trk_cfg{};
+    propagation::config prop_cfg{};
+
+    // Read options from commandline
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, trk_cfg, prop_cfg);
+
+    // Custom options
+    const int n_reads{vm["n_reads"].as<int>()};
+    // The consistency check is part of the startup only if requested
+    reader_cfg.do_check(vm.count("check") != 0);
+
+    std::string proc_name{"unknown"};
+    if (vm.count("bknd_name")) {
+        proc_name = vm["bknd_name"].as<std::string>();
+    }
+
+    // String that describes the detector setup
+    std::string setup_str{};
+    auto add_delim = [](std::string& str) { str += ", "; };
+    if (!vm.count("grid_file")) {
+        setup_str += "no grids";
+    }
+    if (!vm.count("material_file")) {
+        if (!setup_str.empty()) {
+            add_delim(setup_str);
+        }
+        setup_str += "no mat.";
+    }
+    if (!setup_str.empty()) {
+        add_delim(setup_str);
+    }
+    setup_str += "const. field";
+
+    //
+    // Prepare data
+    //
+
+    // The host detector for the upload benchmark
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+    const std::string& det_name = det.name(names);
+
+    // The track for the first propagation
+    auto track_samples =
+        detray::benchmarks::generate_track_samples<track_generator_t>(
+            &host_mr, {1}, trk_cfg, false);
+    const auto& tracks = track_samples.front();
+
+    // Create a constant b-field
+    auto bfield = bfield::create_const_field<scalar>(B);
+
+    dtuple<> empty_state{};
+
+    // Measures the device memory that the benchmark cases hold on to
+    auto device_memory = []() {
+        return detray::benchmarks::get_used_device_memory();
+    };
+
+    //
+    // Register benchmarks
+    //
+
+    // Copy the detector that is already in host memory to device
+    detray::benchmarks::register_startup_benchmark(
+        det_name + "_UPLOAD_DETECTOR",
+        [&det, &dev_mr, &cuda_cpy]() {
+            return detray::get_buffer(det, dev_mr, cuda_cpy);
+        },
+        n_reads, device_memory);
+
+    // Read the detector files, copy the detector and a track to device and
+    // propagate the track. The first iteration includes the initialization
+    // of the CUDA context and the loading of the kernel
+    detray::benchmarks::register_startup_benchmark(
+        det_name + "_FIRST_PROPAGATION",
+        [&]() {
+            auto [host_det, host_names] =
+                detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+
+            auto det_buffer = detray::get_buffer(host_det, dev_mr, cuda_cpy);
+            auto track_buffer = detray::get_buffer(vecmem::get_data(tracks),
+                                                   dev_mr, cuda_cpy);
+
+            auto* device_actor_state_ptr =
+                detray::benchmarks::setup_actor_states<propagator_t>(
+                    &empty_state);
+
+            detray::benchmarks::run_propagation_kernel<propagator_t>(
+                prop_cfg, detray::get_data(det_buffer), bfield,
+                device_actor_state_ptr, track_buffer, 1, 1);
+
+            detray::benchmarks::release_actor_states<propagator_t>(
+                device_actor_state_ptr);
+
+            return std::make_tuple(std::move(host_det), std::move(det_buffer),
+                                   std::move(track_buffer));
+        },
+        n_reads, device_memory);
+
+    // Hardware and build information for the plotting and comparison scripts
+    detray::benchmarks::add_benchmark_context<test_algebra>("CUDA", proc_name,
+                                                            setup_str);
+
+    // Run benchmarks
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+}
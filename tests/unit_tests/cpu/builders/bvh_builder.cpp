@@ -0,0 +1,103 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/builders/bvh_builder.hpp"
+
+#include "detray/builders/surface_factory.hpp"
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/detectors/bvh_metadata.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Gtest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <memory>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using metadata_t = bvh_metadata<test::algebra>;
+using detector_t = detector<metadata_t>;
+using algebra_t = typename detector_t::algebra_type;
+using scalar = dscalar<algebra_t>;
+using point3 = dpoint3D<algebra_t>;
+using transform3 = dtransform3D<algebra_t>;
+
+using bvh_t = bvh_collection<algebra_t, typename detector_t::surface_type>;
+
+}  // anonymous namespace
+
+/// Unittest: Test the BVH builder
+GTEST_TEST(detray_builders, bvh_builder) {
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+
+    auto vbuilder = std::make_unique<volume_builder<detector_t>>(
+        volume_id::e_cylinder);
+    bvh_builder<detector_t, bvh_t> bbuilder{std::move(vbuilder)};
+    bbuilder.set_max_leaf_size(2u);
+
+    // Irregularly placed modules
+    using rectangle_factory = surface_factory<detector_t, rectangle2D>;
+    auto sf_factory = std::make_shared<rectangle_factory>();
+
+    typename rectangle_factory::sf_data_collection sf_data;
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        const auto s{static_cast<scalar>(i)};
+        sf_data.emplace_back(
+            surface_id::e_sensitive,
+            transform3(point3{10.f * s, 3.f * s * s, 100.f + s}), 0u,
+            std::vector<scalar>{3.f, 5.f});
+    }
+    sf_factory->push_back(std::move(sf_data));
+    bbuilder.add_surfaces(sf_factory);
+
+    bbuilder.build(d);
+
+    constexpr auto bvh_id{detector_t::accel::id::e_bvh};
+    ASSERT_EQ(d.volumes().size(), 1u);
+    ASSERT_EQ(d.accelerator_store().template size<bvh_id>(), 1u);
+
+    // The volume links to the BVH for the sensitive surfaces
+    const auto& vol = d.volumes().back();
+    const auto& link =
+        vol.template accel_link<metadata_t::geo_objects::e_sensitive>();
+    EXPECT_EQ(link.id(), bvh_id);
+    EXPECT_EQ(link.index(), 0u);
+
+    // All sensitive surfaces are in the BVH
+    const auto bvh = d.accelerator_store().template get<bvh_id>()[0u];
+    EXPECT_EQ(bvh.all().size(), 10u);
+    EXPECT_EQ(bvh.nodes().size(), 11u);
+    for (const auto& sf : bvh.all()) {
+        EXPECT_TRUE(sf.is_sensitive());
+        EXPECT_EQ(sf.volume(), 0u);
+    }
+
+    // A ray along z through the first module only finds the first leaf
+    const detail::ray<algebra_t> r(point3{0.f, 0.f, 0.f}, 0.f,
+                                   dvector3D<algebra_t>{0.f, 0.f, 1.f}, 0.f);
+    std::vector<dindex> candidates{};
+    for (const auto& sf : bvh.search(r)) {
+        candidates.push_back(sf.index());
+    }
+    ASSERT_FALSE(candidates.empty());
+    EXPECT_LE(candidates.size(), 2u);
+}
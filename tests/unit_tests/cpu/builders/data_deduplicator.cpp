@@ -0,0 +1,122 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/data_deduplicator.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/utils/consistency_checker.hpp"
+#include "detray/utils/detector_hash.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+
+using namespace detray;
+
+namespace {
+
+/// @returns the hash of the mask or material of a surface
+struct entry_hash {
+    template <typename group_t, typename index_t>
+    std::uint64_t operator()(const group_t &group, const index_t &index) const {
+        detail::detector_hasher hasher{};
+        hasher.add(group[index]);
+        return hasher.value();
+    }
+};
+
+/// Check that the surfaces in the grids of type @tparam grid_id of the
+/// detector @param det are up to date
+template <auto grid_id, typename detector_t>
+void check_grids(const detector_t &det) {
+
+    const auto &grids = det.accelerator_store().template get<grid_id>();
+    ASSERT_FALSE(grids.size() == 0u);
+
+    for (dindex i = 0u; i < grids.size(); ++i) {
+        const auto grid = grids[i];
+        for (const auto &sf_desc : grid.all()) {
+            EXPECT_TRUE(sf_desc == det.surface(sf_desc.index()));
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Share the masks and material slabs of the toy detector modules
+GTEST_TEST(detray_builders, data_deduplicator) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<test::scalar> toy_cfg{};
+
+    const auto [ref_det, ref_names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+    auto [det, names] = build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using detector_t = decltype(det);
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using accel_id = typename detector_t::accel::id;
+
+    const std::size_t n_removed{data_deduplicator<detector_t>{}(det)};
+
+    EXPECT_TRUE(detail::check_consistency(det));
+
+    // The modules of a layer share their mask and material slab
+    const auto &masks = det.mask_store();
+    const auto &ref_masks = ref_det.mask_store();
+    const auto &materials = det.material_store();
+    const auto &ref_materials = ref_det.material_store();
+
+    EXPECT_LT(masks.template size<mask_id::e_rectangle2>(),
+              ref_masks.template size<mask_id::e_rectangle2>());
+    EXPECT_LT(masks.template size<mask_id::e_trapezoid2>(),
+              ref_masks.template size<mask_id::e_trapezoid2>());
+    EXPECT_LT(materials.template size<material_id::e_slab>(),
+              ref_materials.template size<material_id::e_slab>());
+    EXPECT_EQ(n_removed, ref_masks.total_size() - masks.total_size() +
+                             ref_materials.total_size() -
+                             materials.total_size());
+
+    // Every surface still has the same mask and material
+    ASSERT_EQ(det.surfaces().size(), ref_det.surfaces().size());
+    for (dindex i = 0u; i < det.surfaces().size(); ++i) {
+        const geometry::surface sf{det, i};
+        const geometry::surface ref_sf{ref_det, i};
+
+        EXPECT_EQ(sf.shape_id(), ref_sf.shape_id());
+        EXPECT_EQ(sf.volume_link(), ref_sf.volume_link());
+        EXPECT_EQ(sf.template visit_mask<entry_hash>(),
+                  ref_sf.template visit_mask<entry_hash>());
+
+        ASSERT_EQ(sf.has_material(), ref_sf.has_material());
+        if (sf.has_material()) {
+            EXPECT_EQ(sf.template visit_material<entry_hash>(),
+                      ref_sf.template visit_material<entry_hash>());
+        }
+    }
+
+    // The surface descriptors in the grids link to the shared entries
+    check_grids<accel_id::e_cylinder2_grid>(det);
+    check_grids<accel_id::e_disc_grid>(det);
+
+    // Running the pass a second time does not change anything
+    EXPECT_EQ(data_deduplicator<detector_t>{}(det), 0u);
+}
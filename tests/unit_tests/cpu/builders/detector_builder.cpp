@@ -82,6 +82,9 @@ GTEST_TEST(detray_builders, detector_builder) {
     //
     // second volume builder
     //
+
+    // Only the builders that are added from now on are timed
+    det_builder.time_builders(true);
     auto vbuilder2 = det_builder.new_volume(volume_id::e_cuboid);
 
     // volume builder
@@ -99,11 +102,16 @@ GTEST_TEST(detray_builders, detector_builder) {
     // initial checks
     EXPECT_EQ(vbuilder2->vol_index(), 1u);
 
+    // The builders are accessed without their timers
+    EXPECT_EQ(det_builder[0u], vbuilder);
+    EXPECT_EQ(det_builder[1u], vbuilder2);
+
     //
     // build the detector
     //
     vecmem::host_memory_resource host_mr;
-    const detector_t d = det_builder.build(host_mr);
+    build_report report{};
+    const detector_t d = det_builder.build(host_mr, &report);
     const auto& vol0 = tracking_volume{d, 0u};
     const auto& vol1 = tracking_volume{d, 1u};
 
@@ -130,4 +138,30 @@ GTEST_TEST(detray_builders, detector_builder) {
     EXPECT_EQ(d.mask_store().template size<mask_id::e_rectangle2>(), 3u);
     EXPECT_EQ(d.mask_store().template size<mask_id::e_ring2>(), 0u);
     EXPECT_EQ(d.mask_store().template size<mask_id::e_trapezoid2>(), 6u);
+
+    // The containers were allocated only once for the data of all volumes
+    EXPECT_EQ(d.transform_store().data()->capacity(),
+              d.transform_store().size());
+    EXPECT_EQ(
+        d.mask_store().template get<mask_id::e_rectangle2>().capacity(), 3u);
+    EXPECT_EQ(
+        d.mask_store().template get<mask_id::e_trapezoid2>().capacity(), 6u);
+
+    // Check the build report: Only the second volume was timed
+    ASSERT_EQ(report.builders.size(), 1u);
+    EXPECT_EQ(report.builders[0].volume, 1u);
+    EXPECT_EQ(report.builders[0].builder, "volume_builder");
+    EXPECT_GE(report.total_time, report.builders[0].time);
+    EXPECT_EQ(report.time_per_builder().size(), 1u);
+
+    // The memory is reported per container and data type
+    const auto& records = report.memory.records;
+    ASSERT_FALSE(records.empty());
+    EXPECT_EQ(records[0].container, "volumes");
+    EXPECT_EQ(records[0].n_elements, 2u);
+    const auto bytes = report.memory.bytes_per_container();
+    EXPECT_GE(bytes.at("surfaces"),
+              12u * sizeof(typename detector_t::surface_type));
+    EXPECT_EQ(report.n_bytes(), get_memory_report(d).n_bytes());
+    EXPECT_GT(report.n_bytes(), 0u);
 }
@@ -14,9 +14,11 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/annulus2D.hpp"
+#include "detray/geometry/tracking_volume.hpp"
 #include "detray/utils/type_list.hpp"
 
 // Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
 #include "detray/test/utils/types.hpp"
 
 // Vecmem include(s)
@@ -27,6 +29,7 @@
 
 // System include(s)
 #include <limits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -384,3 +387,148 @@ GTEST_TEST(detray_builders, grid_builder) {
     EXPECT_NEAR(cyl_axis_z.span()[1], 500.f,
                 std::numeric_limits<scalar>::epsilon());
 }
+
+/// Unittest: Fill a grid with exactly sized, dynamic bins
+GTEST_TEST(detray_builders, grid_builder_counted_fill) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using surface_t = typename detector_t::surface_type;
+    using ref_grid_t = grid<algebra_t, axes<concentric_cylinder2D>,
+                            bins::static_array<surface_t, 4>>;
+    using dyn_grid_t = grid<algebra_t, axes<concentric_cylinder2D>,
+                            bins::dynamic_array<surface_t>>;
+
+    constexpr auto grid_id{detector_t::accel::id::e_cylinder2_grid};
+    constexpr auto sf_id{detector_t::geo_obj_ids::e_sensitive};
+    const auto &toy_grids = toy_det.accelerator_store().template get<grid_id>();
+
+    const typename detector_t::geometry_context ctx{};
+
+    std::size_t n_checked{0u};
+    for (const auto &vol_desc : toy_det.volumes()) {
+        const auto &link = vol_desc.template accel_link<sf_id>();
+        if (link.id() != grid_id) {
+            continue;
+        }
+        const auto vol = tracking_volume{toy_det, vol_desc};
+        const auto toy_grid = toy_grids[link.index()];
+
+        // Same binning as the toy detector grid
+        const auto &ax_phi = toy_grid.template get_axis<0>();
+        const auto &ax_z = toy_grid.template get_axis<1>();
+        const std::vector<scalar> spans{ax_phi.span()[0], ax_phi.span()[1],
+                                        ax_z.span()[0], ax_z.span()[1]};
+        const std::vector<std::size_t> n_bins{ax_phi.nbins(), ax_z.nbins()};
+
+        std::vector<surface_t> surfaces{};
+        for (const auto &sf_desc : vol.surfaces()) {
+            surfaces.push_back(sf_desc);
+        }
+
+        // Reference: Fill the surfaces one by one
+        auto ref_factory = grid_factory_type<ref_grid_t>{host_mr};
+        auto ref_grid =
+            ref_factory.template new_grid<ref_grid_t>(spans, n_bins);
+        fill_by_pos{}(ref_grid, vol, surfaces, toy_det.transform_store(),
+                      toy_det.mask_store(), ctx);
+
+        // Count the entries first, without any bin capacities, in parallel
+        auto dyn_factory = grid_factory_type<dyn_grid_t>{host_mr};
+        auto dyn_grid =
+            dyn_factory.template new_grid<dyn_grid_t>(spans, n_bins);
+        fill_by_pos_counted{4u, 1u}(dyn_grid, vol, surfaces,
+                                    toy_det.transform_store(),
+                                    toy_det.mask_store(), ctx);
+
+        ASSERT_EQ(dyn_grid.nbins(), ref_grid.nbins());
+        ASSERT_GT(dyn_grid.size(), 0u);
+        EXPECT_EQ(dyn_grid.size(), ref_grid.size());
+        // The entry storage is sized exactly
+        EXPECT_EQ(dyn_grid.bins().entry_data().size(), dyn_grid.size());
+
+        for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+            const auto ref_bin = ref_grid.bin(gbin);
+            const auto dyn_bin = dyn_grid.bin(gbin);
+
+            ASSERT_EQ(dyn_bin.size(), ref_bin.size());
+            EXPECT_EQ(dyn_bin.capacity(), ref_bin.size());
+            for (dindex i = 0u; i < ref_bin.size(); ++i) {
+                EXPECT_EQ(dyn_bin[i], ref_bin[i]);
+            }
+        }
+        ++n_checked;
+    }
+    EXPECT_GT(n_checked, 0u);
+}
+
+/// Unittest: Fill a grid with bins that are sorted by the surface radius
+GTEST_TEST(detray_builders, grid_builder_sorted_fill) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using surface_t = typename detector_t::surface_type;
+    using dyn_grid_t = grid<algebra_t, axes<concentric_cylinder2D>,
+                            bins::dynamic_array<surface_t>>;
+
+    constexpr auto grid_id{detector_t::accel::id::e_cylinder2_grid};
+    constexpr auto sf_id{detector_t::geo_obj_ids::e_sensitive};
+    const auto &toy_grids = toy_det.accelerator_store().template get<grid_id>();
+
+    const typename detector_t::geometry_context ctx{};
+
+    std::size_t n_checked{0u};
+    for (const auto &vol_desc : toy_det.volumes()) {
+        const auto &link = vol_desc.template accel_link<sf_id>();
+        if (link.id() != grid_id) {
+            continue;
+        }
+        const auto vol = tracking_volume{toy_det, vol_desc};
+        const auto toy_grid = toy_grids[link.index()];
+
+        const auto &ax_phi = toy_grid.template get_axis<0>();
+        const auto &ax_z = toy_grid.template get_axis<1>();
+        const std::vector<scalar> spans{ax_phi.span()[0], ax_phi.span()[1],
+                                        ax_z.span()[0], ax_z.span()[1]};
+        const std::vector<std::size_t> n_bins{ax_phi.nbins(), ax_z.nbins()};
+
+        std::vector<surface_t> surfaces{};
+        for (const auto &sf_desc : vol.surfaces()) {
+            surfaces.push_back(sf_desc);
+        }
+
+        auto dyn_factory = grid_factory_type<dyn_grid_t>{host_mr};
+        auto dyn_grid =
+            dyn_factory.template new_grid<dyn_grid_t>(spans, n_bins);
+        fill_by_pos_counted{1u, 1024u, bin_sort_key::e_radius}(
+            dyn_grid, vol, surfaces, toy_det.transform_store(),
+            toy_det.mask_store(), ctx);
+
+        ASSERT_GT(dyn_grid.size(), 0u);
+
+        // The entries of every bin are ordered by their radius
+        for (dindex gbin = 0u; gbin < dyn_grid.nbins(); ++gbin) {
+            scalar last_r{0.f};
+            for (const surface_t &sf : dyn_grid.bin(gbin)) {
+                const auto &t =
+                    toy_det.transform_store().at(sf.transform(), ctx);
+                const scalar r{vector::perp(
+                    vol.transform().point_to_local(t.translation()))};
+                EXPECT_GE(r, last_r);
+                last_r = r;
+            }
+        }
+        ++n_checked;
+    }
+    EXPECT_GT(n_checked, 0u);
+}
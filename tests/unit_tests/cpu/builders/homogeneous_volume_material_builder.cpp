@@ -10,6 +10,7 @@
 
 #include "detray/core/detector.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/geometry/tracking_volume.hpp"
 #include "detray/materials/predefined_materials.hpp"
 
 // Detray test include(s)
@@ -62,4 +63,9 @@ TEST(detray_builders, homogeneous_volume_material_builder) {
     EXPECT_EQ(d.material_store().template size<material_id>(), 1u);
     EXPECT_EQ(d.material_store().template get<material_id>()[0],
               argon_liquid<scalar>{});
+
+    // The material is the same everywhere in the volume
+    const tracking_volume vol{d, vol_desc};
+    EXPECT_TRUE(vol.has_material());
+    EXPECT_TRUE(vol.has_homogeneous_material());
 }
@@ -0,0 +1,147 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/layout_optimizer.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/utils/consistency_checker.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Compare the surfaces in the grids of type @tparam grid_id of the detector
+/// @param ref_det to those of the reordered detector @param det
+template <auto grid_id, typename detector_t>
+void check_grids(const detector_t &ref_det, const detector_t &det) {
+
+    const typename detector_t::geometry_context ctx{};
+
+    const auto &ref_grids =
+        ref_det.accelerator_store().template get<grid_id>();
+    const auto &grids = det.accelerator_store().template get<grid_id>();
+    ASSERT_EQ(ref_grids.size(), grids.size());
+
+    for (dindex i = 0u; i < grids.size(); ++i) {
+        const auto ref_grid = ref_grids[i];
+        const auto grid = grids[i];
+
+        std::vector<dindex> first_seen{};
+        std::vector<bool> is_seen(det.surfaces().size(), false);
+
+        std::vector<typename detector_t::surface_type> ref_entries{};
+        for (const auto &sf_desc : ref_grid.all()) {
+            ref_entries.push_back(sf_desc);
+        }
+        std::vector<typename detector_t::surface_type> entries{};
+        for (const auto &sf_desc : grid.all()) {
+            entries.push_back(sf_desc);
+        }
+        ASSERT_EQ(entries.size(), ref_entries.size());
+
+        for (std::size_t j = 0u; j < entries.size(); ++j) {
+            const auto &sf_desc = entries[j];
+
+            // The bin entries point to the same geometry as before
+            const geometry::surface ref_sf{ref_det, ref_entries[j]};
+            const geometry::surface sf{det, sf_desc};
+            EXPECT_TRUE(sf_desc == det.surface(sf_desc.index()));
+            EXPECT_EQ(sf.volume(), ref_sf.volume());
+            EXPECT_EQ(sf.id(), ref_sf.id());
+            EXPECT_EQ(sf.shape_id(), ref_sf.shape_id());
+            EXPECT_EQ(sf.center(ctx), ref_sf.center(ctx));
+            EXPECT_EQ(sf.boundary(0u), ref_sf.boundary(0u));
+            EXPECT_EQ(sf.boundary(1u), ref_sf.boundary(1u));
+            EXPECT_EQ(sf.has_material(), ref_sf.has_material());
+
+            if (!is_seen[sf_desc.index()]) {
+                is_seen[sf_desc.index()] = true;
+                first_seen.push_back(sf_desc.index());
+            }
+        }
+
+        // The surfaces are stored in the order of the grid bins, together
+        // with their transforms
+        for (std::size_t j = 1u; j < first_seen.size(); ++j) {
+            EXPECT_EQ(first_seen[j], first_seen[j - 1u] + 1u);
+            EXPECT_EQ(det.surface(first_seen[j]).transform(),
+                      det.surface(first_seen[j - 1u]).transform() + 1u);
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Reorder the surfaces of the toy detector by grid bin
+GTEST_TEST(detray_builders, layout_optimizer) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+
+    const auto [ref_det, ref_names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+    auto [det, names] = build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using detector_t = decltype(det);
+    using accel_id = typename detector_t::accel::id;
+
+    layout_optimizer<detector_t>{}(det);
+
+    EXPECT_TRUE(detail::check_consistency(det));
+
+    ASSERT_EQ(det.surfaces().size(), ref_det.surfaces().size());
+    ASSERT_EQ(det.transform_store().size(), ref_det.transform_store().size());
+
+    // The surface ranges of the volumes are unchanged
+    for (const auto &vol_desc : det.volumes()) {
+        const auto &ref_vol_desc = ref_det.volume(vol_desc.index());
+        EXPECT_EQ(vol_desc.sf_link(), ref_vol_desc.sf_link());
+        EXPECT_EQ(vol_desc.accel_link(), ref_vol_desc.accel_link());
+    }
+
+    // Portals and passives are not in the grids and keep their place
+    std::size_t n_moved{0u};
+    for (dindex i = 0u; i < det.surfaces().size(); ++i) {
+        const auto &sf_desc = det.surface(i);
+        EXPECT_EQ(sf_desc.index(), i);
+        if (!sf_desc.is_sensitive()) {
+            EXPECT_TRUE(sf_desc == ref_det.surface(i));
+        } else if (geometry::surface{det, i}.center({}) !=
+                   geometry::surface{ref_det, i}.center({})) {
+            ++n_moved;
+        }
+    }
+    EXPECT_GT(n_moved, 0u);
+
+    check_grids<accel_id::e_cylinder2_grid>(ref_det, det);
+    check_grids<accel_id::e_disc_grid>(ref_det, det);
+
+    // Running the pass a second time does not change anything
+    const auto surfaces = det.surfaces();
+    layout_optimizer<detector_t>{}(det);
+    for (dindex i = 0u; i < det.surfaces().size(); ++i) {
+        EXPECT_TRUE(det.surface(i) == surfaces[i]);
+    }
+}
@@ -0,0 +1,158 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/alignment_double_buffer.hpp"
+#include "detray/definitions/units.hpp"
+
+// Detray test include(s)
+#include "detray/test/common/assert.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <chrono>
+#include <future>
+#include <stdexcept>
+
+using namespace detray;
+
+// This tests the update of the alignment while the previous one is in use
+GTEST_TEST(detray_core, alignment_double_buffer) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy;
+
+    auto [det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(det);
+    using view_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+    using transform_t = typename detector_t::transform3_type;
+    using transform_container_t = typename detector_t::transform_container;
+    using context_t = typename detector_t::geometry_context;
+
+    // Nominal transforms before the contexts are added
+    transform_container_t nominal_trfs{host_mr};
+    for (const auto &tf : det.transform_store()) {
+        nominal_trfs.push_back(tf, context_t{});
+    }
+
+    /// @returns the transforms shifted by @param shift
+    auto shifted_trfs = [&](const point3 &shift) {
+        transform_container_t trfs{host_mr};
+        for (const auto &tf : nominal_trfs) {
+            trfs.push_back(
+                transform_t{tf.translation() + shift, tf.x(), tf.y(), tf.z()},
+                context_t{});
+        }
+        return trfs;
+    };
+
+    /// Check the transforms of the host and device detector in a lease
+    auto check_lease = [&](const auto &lease, const point3 &shift) {
+        const view_detector_t device_det{lease.view()};
+        const auto &host_store = det.transform_store();
+
+        for (dindex i = 0u; i < nominal_trfs.size(); ++i) {
+            const point3 &nominal_t = nominal_trfs.at(i).translation();
+
+            EXPECT_POINT3_NEAR(
+                host_store.at(i, lease.context()).translation() - nominal_t,
+                shift, 1e-4);
+            EXPECT_POINT3_NEAR(
+                device_det.transform_store().at(i).translation() - nominal_t,
+                shift, 1e-4);
+        }
+    };
+
+    alignment_double_buffer<detector_t> buffer{det, host_mr, host_mr, cpy};
+
+    // The nominal context of the detector is unchanged
+    ASSERT_EQ(det.transform_store().size(), nominal_trfs.size());
+    EXPECT_EQ(buffer.published_slot(), 0u);
+    EXPECT_EQ(buffer.version(), 0u);
+
+    const point3 no_shift{0.f, 0.f, 0.f};
+    const point3 shift1{.1f * unit<scalar>::mm, .2f * unit<scalar>::mm,
+                        .3f * unit<scalar>::mm};
+    const point3 shift2{-.3f * unit<scalar>::mm, .1f * unit<scalar>::mm,
+                        0.f * unit<scalar>::mm};
+
+    {
+        // A propagation on the nominal alignment
+        auto nominal_lease = buffer.acquire();
+        EXPECT_EQ(nominal_lease.slot(), 0u);
+        EXPECT_EQ(nominal_lease.version(), 0u);
+        check_lease(nominal_lease, no_shift);
+
+        // Write the new alignment to the free slot and publish it
+        buffer.update(shifted_trfs(shift1));
+        EXPECT_EQ(buffer.published_slot(), 1u);
+        EXPECT_EQ(buffer.version(), 1u);
+
+        // New propagations use the new alignment...
+        {
+            const auto aligned_lease = buffer.acquire();
+            EXPECT_EQ(aligned_lease.slot(), 1u);
+            EXPECT_EQ(aligned_lease.version(), 1u);
+            check_lease(aligned_lease, shift1);
+        }
+        // ...while the running one still sees the nominal transforms
+        check_lease(nominal_lease, no_shift);
+
+        // The next update has to wait for the nominal slot to be released
+        auto pending = buffer.update_async(shifted_trfs(shift2));
+        EXPECT_EQ(pending.wait_for(std::chrono::milliseconds(50)),
+                  std::future_status::timeout);
+        EXPECT_EQ(buffer.published_slot(), 1u);
+        check_lease(nominal_lease, no_shift);
+
+        // Hand the lease over: The slot stays in use
+        auto moved_lease{std::move(nominal_lease)};
+        EXPECT_EQ(moved_lease.slot(), 0u);
+        EXPECT_EQ(pending.wait_for(std::chrono::milliseconds(10)),
+                  std::future_status::timeout);
+
+        // Release the nominal slot
+        {
+            const auto done{std::move(moved_lease)};
+        }
+        pending.get();
+    }
+
+    EXPECT_EQ(buffer.published_slot(), 0u);
+    EXPECT_EQ(buffer.version(), 2u);
+
+    const auto lease = buffer.acquire();
+    EXPECT_EQ(lease.slot(), 0u);
+    EXPECT_EQ(lease.version(), 2u);
+    check_lease(lease, shift2);
+
+    // The nominal context of the host detector is unchanged
+    for (dindex i = 0u; i < nominal_trfs.size(); ++i) {
+        EXPECT_POINT3_NEAR(det.transform_store().at(i).translation(),
+                           nominal_trfs.at(i).translation(), 1e-6);
+    }
+
+    // The number of transforms has to match the detector
+    transform_container_t too_few_trfs{host_mr};
+    too_few_trfs.push_back(transform_t{}, context_t{});
+
+    EXPECT_THROW(buffer.update(too_few_trfs), std::invalid_argument);
+}
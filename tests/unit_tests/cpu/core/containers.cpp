@@ -20,6 +20,7 @@
 // System include(s)
 #include <array>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 using namespace detray;
@@ -109,6 +110,47 @@ GTEST_TEST(detray_core, tuple_container) {
     EXPECT_TRUE(detail::get<2>(container).empty());
 }
 
+/// Tuple container of vectors with value types of the sizes 1 to I + 1
+template <std::size_t... I>
+auto make_array_tuple(std::index_sequence<I...> /*seq*/) {
+    return detail::tuple_container<
+        std::tuple, vecmem::vector<std::array<char, I + 1u>>...>{};
+}
+
+struct value_size_func {
+    template <typename container_t>
+    std::size_t operator()(const container_t& /*coll*/) const {
+        return sizeof(typename container_t::value_type);
+    }
+};
+
+/// Check that the dispatch strategies find the same tuple element
+GTEST_TEST(detray_core, tuple_container_visit_dispatch) {
+
+    // Long enough for multiple switch blocks and bisection steps
+    constexpr std::size_t n_types{21u};
+    const auto container =
+        make_array_tuple(std::make_index_sequence<n_types>{});
+
+    using enum detail::visit_dispatch;
+    static_assert(detail::default_visit_dispatch<4u> == e_switch);
+    static_assert(detail::default_visit_dispatch<n_types> == e_binary);
+
+    using func_t = value_size_func;
+
+    for (std::size_t i = 0u; i < n_types; ++i) {
+        EXPECT_EQ((container.template visit<func_t, e_linear>(i)), i + 1u);
+        EXPECT_EQ((container.template visit<func_t, e_switch>(i)), i + 1u);
+        EXPECT_EQ((container.template visit<func_t, e_binary>(i)), i + 1u);
+        EXPECT_EQ(container.template visit<func_t>(i), i + 1u);
+    }
+
+    // No element for the index
+    EXPECT_EQ((container.template visit<func_t, e_linear>(n_types)), 0u);
+    EXPECT_EQ((container.template visit<func_t, e_switch>(n_types)), 0u);
+    EXPECT_EQ((container.template visit<func_t, e_binary>(n_types)), 0u);
+}
+
 GTEST_TEST(detray_core, vector_multi_store) {
 
     // Vecmem memory resource
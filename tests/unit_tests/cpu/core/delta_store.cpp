@@ -0,0 +1,122 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/delta_store.hpp"
+
+// Detray test include(s)
+#include "detray/test/common/assert.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using transform3 = test::transform3;
+using point3 = test::point3;
+
+constexpr test::scalar tol{1e-6f};
+
+}  // namespace
+
+// This tests the transform store with alignment deltas
+GTEST_TEST(detray_core, delta_transform_store) {
+
+    using transform_store_t =
+        delta_store<transform3, dvector, geometry_context>;
+
+    vecmem::host_memory_resource host_mr;
+    transform_store_t store{host_mr};
+    const geometry_context nominal{};
+
+    ASSERT_TRUE(store.empty(nominal));
+
+    // Nominal transforms
+    for (unsigned int i = 0u; i < 5u; ++i) {
+        store.push_back(transform3{point3{static_cast<test::scalar>(i), 0.f,
+                                          0.f}},
+                        nominal);
+    }
+    ASSERT_EQ(store.size(nominal), 5u);
+    EXPECT_EQ(store.n_contexts(), 0u);
+
+    // First alignment context: Shift two transforms (unordered)
+    const point3 shift{.1f, .2f, .3f};
+    std::vector<std::pair<dindex, transform3>> deltas{
+        {3u, transform3{point3{3.f, 0.f, 0.f} + shift}},
+        {1u, transform3{point3{1.f, 0.f, 0.f} + shift}}};
+
+    const geometry_context ctx1 = store.add_context(deltas);
+    ASSERT_EQ(ctx1.get(), 1u);
+    EXPECT_EQ(store.n_contexts(), 1u);
+    EXPECT_EQ(store.n_deltas(ctx1), 2u);
+    EXPECT_FALSE(store.empty(ctx1));
+
+    // Second alignment context: Shift one transform
+    const geometry_context ctx2 = store.add_context(
+        {{4u, transform3{point3{4.f, 0.f, 0.f} - shift}}});
+    ASSERT_EQ(ctx2.get(), 2u);
+    EXPECT_EQ(store.n_deltas(ctx2), 1u);
+    EXPECT_TRUE(store.empty(geometry_context{3u}));
+
+    // Every context has all transforms
+    EXPECT_EQ(store.size(ctx1), 5u);
+    EXPECT_EQ(store.size(ctx2), 5u);
+
+    auto check_store = [&](const auto& s) {
+        for (unsigned int i = 0u; i < 5u; ++i) {
+            const point3 t{static_cast<test::scalar>(i), 0.f, 0.f};
+            EXPECT_POINT3_NEAR(s.at(i, nominal).translation(), t, tol);
+
+            const point3 t1 = (i == 1u || i == 3u) ? t + shift : t;
+            EXPECT_POINT3_NEAR(s.at(i, ctx1).translation(), t1, tol);
+
+            const point3 t2 = (i == 4u) ? t - shift : t;
+            EXPECT_POINT3_NEAR(s.at(i, ctx2).translation(), t2, tol);
+        }
+    };
+    check_store(store);
+
+    // Only the deltas are stored in addition to the nominal transforms
+    auto view = store.get_data();
+    EXPECT_EQ(detail::get<0>(view.m_view).size(), 5u);
+    EXPECT_EQ(detail::get<1>(view.m_view).size(), 3u);
+    EXPECT_EQ(detail::get<2>(view.m_view).size(), 3u);
+    EXPECT_EQ(detail::get<3>(view.m_view).size(), 3u);
+
+    // Device-side access
+    const delta_store<transform3, vecmem::device_vector, geometry_context>
+        device_store{view};
+    EXPECT_EQ(device_store.n_contexts(), 2u);
+    check_store(device_store);
+
+    // Invalid deltas
+    EXPECT_THROW(store.add_context({{5u, transform3{}}}),
+                 std::invalid_argument);
+    EXPECT_THROW(store.add_context({{2u, transform3{}}, {2u, transform3{}}}),
+                 std::invalid_argument);
+    EXPECT_EQ(store.n_contexts(), 2u);
+
+    // Start a new alignment iteration
+    store.clear_contexts();
+    EXPECT_EQ(store.n_contexts(), 0u);
+    EXPECT_EQ(store.size(nominal), 5u);
+    EXPECT_POINT3_NEAR(std::as_const(store).at(3u, ctx1).translation(),
+                       point3({3.f, 0.f, 0.f}), tol);
+}
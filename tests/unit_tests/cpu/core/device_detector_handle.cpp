@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/device_detector_handle.hpp"
+#include "detray/definitions/units.hpp"
+
+// Detray test include(s)
+#include "detray/test/common/assert.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <stdexcept>
+
+using namespace detray;
+
+// This tests the shared detector handle and the transform update
+GTEST_TEST(detray_core, device_detector_handle) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy;
+
+    auto [det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(det);
+    using view_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+    using transform_t = typename detector_t::transform3_type;
+
+    const auto &nominal_trfs = det.transform_store();
+
+    device_detector_handle<detector_t> handle{det, host_mr, cpy};
+    EXPECT_EQ(handle.use_count(), 1);
+    EXPECT_FALSE(handle.has_own_transforms());
+
+    // Copies share the detector data
+    {
+        const auto shared_handle = handle;
+        EXPECT_EQ(handle.use_count(), 2);
+    }
+    EXPECT_EQ(handle.use_count(), 1);
+
+    const view_detector_t nominal_det{handle.view()};
+    ASSERT_EQ(nominal_det.volumes().size(), det.volumes().size());
+    ASSERT_EQ(nominal_det.surfaces().size(), det.surfaces().size());
+    ASSERT_EQ(nominal_det.transform_store().size(), nominal_trfs.size());
+
+    // Shift all transforms by the same translation
+    const point3 shift{.1f * unit<scalar>::mm, .2f * unit<scalar>::mm,
+                       .3f * unit<scalar>::mm};
+
+    typename detector_t::transform_container aligned_trfs;
+    aligned_trfs.reserve(
+        nominal_trfs.size(),
+        typename detector_t::transform_container::context_type{});
+    for (const auto &tf : nominal_trfs) {
+        aligned_trfs.push_back(
+            transform_t{tf.translation() + shift, tf.x(), tf.y(), tf.z()});
+    }
+
+    // Only upload the aligned transforms
+    auto aligned_handle = handle.with_transforms(aligned_trfs);
+    EXPECT_EQ(handle.use_count(), 2);
+    EXPECT_TRUE(aligned_handle.has_own_transforms());
+    EXPECT_FALSE(handle.has_own_transforms());
+
+    const view_detector_t aligned_det{aligned_handle.view()};
+    ASSERT_EQ(aligned_det.transform_store().size(), nominal_trfs.size());
+
+    for (dindex i = 0u; i < nominal_trfs.size(); ++i) {
+        const point3 &nominal_t = nominal_trfs.at(i).translation();
+
+        EXPECT_POINT3_NEAR(
+            aligned_det.transform_store().at(i).translation() - nominal_t,
+            shift, 1e-4);
+        // The nominal transforms are unchanged
+        EXPECT_POINT3_NEAR(nominal_det.transform_store().at(i).translation(),
+                           nominal_t, 1e-6);
+    }
+
+    // Update the aligned transforms in place: The view stays valid
+    aligned_handle.update_transforms(nominal_trfs);
+
+    for (dindex i = 0u; i < nominal_trfs.size(); ++i) {
+        EXPECT_POINT3_NEAR(aligned_det.transform_store().at(i).translation(),
+                           nominal_trfs.at(i).translation(), 1e-6);
+    }
+
+    // The number of transforms has to match the detector
+    using context_t = typename detector_t::transform_container::context_type;
+
+    typename detector_t::transform_container too_few_trfs;
+    too_few_trfs.push_back(transform_t{}, context_t{});
+
+    EXPECT_THROW(aligned_handle.update_transforms(too_few_trfs),
+                 std::invalid_argument);
+    EXPECT_THROW(handle.with_transforms(too_few_trfs), std::invalid_argument);
+}
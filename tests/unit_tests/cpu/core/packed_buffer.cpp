@@ -0,0 +1,120 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/packed_buffer.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+
+using namespace detray;
+
+// This tests packing the detector data into a single allocation
+GTEST_TEST(detray_core, packed_buffer) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy cpy;
+
+    auto [det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(det);
+    using view_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+
+    const auto ctx = typename detector_t::geometry_context{};
+
+    const auto packed_buff = detray::get_packed_buffer(det, host_mr, cpy);
+
+    // All containers are in the allocation
+    const std::size_t n_geo_bytes{
+        det.volumes().size() * sizeof(typename detector_t::volume_type) +
+        det.surfaces().size() * sizeof(typename detector_t::surface_type) +
+        det.transform_store().size() *
+            sizeof(typename detector_t::transform3_type)};
+    EXPECT_GT(packed_buff.size_bytes(), n_geo_bytes);
+    EXPECT_EQ(packed_buff.size_bytes() % sizeof(std::max_align_t), 0u);
+
+    auto packed_view = detray::get_data(packed_buff);
+    const view_detector_t packed_det{packed_view};
+
+    // Data was copied
+    ASSERT_NE(packed_det.volumes().data(), det.volumes().data());
+
+    ASSERT_EQ(packed_det.volumes().size(), det.volumes().size());
+    for (std::size_t i = 0u; i < det.volumes().size(); ++i) {
+        EXPECT_TRUE(packed_det.volumes()[i] == det.volumes()[i]);
+    }
+
+    ASSERT_EQ(packed_det.surfaces().size(), det.surfaces().size());
+    for (std::size_t i = 0u; i < det.surfaces().size(); ++i) {
+        EXPECT_TRUE(packed_det.surfaces()[i] == det.surfaces()[i]);
+    }
+
+    ASSERT_EQ(packed_det.transform_store().size(),
+              det.transform_store().size());
+    for (dindex i = 0u; i < det.transform_store().size(); ++i) {
+        EXPECT_TRUE(packed_det.transform_store().at(i, ctx) ==
+                    det.transform_store().at(i, ctx));
+    }
+
+    const auto &rectangles =
+        det.mask_store().template get<detector_t::masks::id::e_rectangle2>();
+    const auto &packed_rectangles =
+        packed_det.mask_store()
+            .template get<detector_t::masks::id::e_rectangle2>();
+    ASSERT_EQ(packed_rectangles.size(), rectangles.size());
+    for (std::size_t i = 0u; i < rectangles.size(); ++i) {
+        EXPECT_TRUE(packed_rectangles[i] == rectangles[i]);
+    }
+
+    // The acceleration structures of the packed detector give the same
+    // navigation candidates
+    using navigator_t = navigator<detector_t>;
+    using packed_navigator_t = navigator<view_detector_t>;
+
+    const navigation::config nav_cfg{};
+
+    constexpr std::size_t n_tracks{20u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.31f};
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f,
+            vector3{math::cos(phi), math::sin(phi), 0.1f}, -1.f);
+
+        typename navigator_t::state nav_state(det);
+        nav_state.set_volume(0u);
+        navigator_t{}.init(track, nav_state, nav_cfg, ctx);
+
+        typename packed_navigator_t::state packed_state(packed_det);
+        packed_state.set_volume(0u);
+        packed_navigator_t{}.init(track, packed_state, nav_cfg, ctx);
+
+        ASSERT_EQ(packed_state.n_candidates(), nav_state.n_candidates());
+        EXPECT_EQ(packed_state.next_surface().barcode(),
+                  nav_state.next_surface().barcode());
+    }
+}
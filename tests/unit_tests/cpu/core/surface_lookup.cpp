@@ -0,0 +1,167 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/surface_lookup.hpp"
+
+#include "detray/geometry/detail/surface_descriptor.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google test include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+using namespace detray;
+
+namespace {
+
+using surface_t = surface_descriptor<>;
+
+/// Metadata that opts into the compact surface lookup
+struct compact_metadata {
+    using surface_type = surface_t;
+
+    template <template <typename...> class vector_t = dvector>
+    using surface_lookup = compact_surface_lookup<surface_type, vector_t>;
+};
+
+/// Metadata with the default surface lookup
+struct default_metadata {
+    using surface_type = surface_t;
+};
+
+/// Fill a surface lookup with surfaces of ascending index and source links
+template <typename lookup_t>
+void fill_lookup(lookup_t& sf_lookup, const dindex n_surfaces) {
+    // Insert in reverse order to test the resizing
+    for (dindex i = n_surfaces; i-- > 0u;) {
+        surface_t sf{i, {0u, i}, {0u, i}, 1u, surface_id::e_sensitive};
+        sf.set_index(i);
+        sf_lookup.insert(sf, 100u + i);
+    }
+}
+
+/// Test the access to the surfaces of a surface lookup
+template <typename lookup_t>
+void test_lookup(const lookup_t& sf_lookup, const dindex n_surfaces) {
+
+    ASSERT_EQ(sf_lookup.size(), n_surfaces);
+    EXPECT_FALSE(sf_lookup.empty());
+
+    dindex i{0u};
+    for (const auto& sf : sf_lookup) {
+        EXPECT_EQ(sf.index(), i);
+        EXPECT_EQ(sf.transform(), i);
+        EXPECT_EQ(sf.volume(), 1u);
+        EXPECT_EQ(sf_lookup.source(i), 100u + i);
+        ++i;
+    }
+    EXPECT_EQ(i, n_surfaces);
+
+    // Search by index and barcode
+    EXPECT_EQ(sf_lookup.search(3u).index(), 3u);
+    EXPECT_EQ(sf_lookup.search(sf_lookup[5u].barcode()).mask().index(), 5u);
+
+    // Search by source link
+    const auto sf = sf_lookup.search(default_searcher{107u});
+    EXPECT_EQ(sf.index(), 7u);
+    const auto no_sf = sf_lookup.search(default_searcher{42u});
+    EXPECT_TRUE(no_sf.barcode().is_invalid());
+}
+
+/// Test the search by source link with the source index
+template <typename lookup_t>
+void test_source_index(lookup_t& sf_lookup, const dindex n_surfaces) {
+
+    EXPECT_TRUE(sf_lookup.source_index().empty());
+
+    sf_lookup.build_source_index();
+    EXPECT_EQ(sf_lookup.source_index().size(), n_surfaces);
+
+    test_lookup(sf_lookup, n_surfaces);
+    for (dindex i = 0u; i < n_surfaces; ++i) {
+        EXPECT_EQ(sf_lookup.find_source(100u + i), i);
+    }
+    EXPECT_TRUE(detail::is_invalid_value(sf_lookup.find_source(0u)));
+    EXPECT_TRUE(detail::is_invalid_value(sf_lookup.find_source(1000u)));
+
+    // Surfaces without source link are not indexed, duplicates are found in
+    // the order of the surfaces
+    surface_t sf{0u, {0u, 0u}, {0u, 0u}, 1u, surface_id::e_portal};
+    sf.set_index(n_surfaces);
+    sf_lookup.insert(sf);
+    sf.set_index(n_surfaces + 1u);
+    sf_lookup.insert(sf, 105u);
+
+    // Modifying the lookup invalidates the index
+    EXPECT_TRUE(sf_lookup.source_index().empty());
+
+    sf_lookup.build_source_index();
+    EXPECT_EQ(sf_lookup.source_index().size(), n_surfaces + 1u);
+    EXPECT_EQ(sf_lookup.find_source(105u), 5u);
+    EXPECT_EQ(sf_lookup.find_source(109u), 9u);
+}
+
+}  // namespace
+
+/// Test the surface lookup with source links next to the descriptors
+GTEST_TEST(detray_core, surface_lookup) {
+
+    using lookup_t =
+        typename detail::surface_lookup_selector<default_metadata,
+                                                 dvector>::type;
+    static_assert(std::is_same_v<lookup_t, surface_lookup<surface_t>>);
+
+    constexpr dindex n_surfaces{10u};
+
+    vecmem::host_memory_resource host_mr;
+    lookup_t sf_lookup{host_mr};
+    fill_lookup(sf_lookup, n_surfaces);
+
+    test_lookup(sf_lookup, n_surfaces);
+    test_source_index(sf_lookup, n_surfaces);
+}
+
+/// Test the surface lookup with separate source links
+GTEST_TEST(detray_core, compact_surface_lookup) {
+
+    using lookup_t =
+        typename detail::surface_lookup_selector<compact_metadata,
+                                                 dvector>::type;
+    static_assert(
+        std::is_same_v<lookup_t, compact_surface_lookup<surface_t>>);
+
+    // The source link is not part of the data that is iterated over
+    static_assert(sizeof(std::iter_value_t<typename lookup_t::iterator>) ==
+                  sizeof(surface_t));
+    static_assert(sizeof(source_link<surface_t>) >=
+                  sizeof(surface_t) + sizeof(std::uint64_t));
+
+    constexpr dindex n_surfaces{10u};
+
+    vecmem::host_memory_resource host_mr;
+    lookup_t sf_lookup{host_mr};
+    fill_lookup(sf_lookup, n_surfaces);
+
+    test_lookup(sf_lookup, n_surfaces);
+    test_source_index(sf_lookup, n_surfaces);
+
+    // Views of the descriptors, the source links and the source index
+    const auto view = sf_lookup.get_data();
+    EXPECT_EQ(detail::get<0>(view.m_view).size(), n_surfaces + 2u);
+    EXPECT_EQ(detail::get<1>(view.m_view).size(), n_surfaces + 2u);
+    EXPECT_EQ(detail::get<2>(view.m_view).size(), n_surfaces + 1u);
+
+    sf_lookup.clear();
+    EXPECT_TRUE(sf_lookup.empty());
+}
@@ -0,0 +1,163 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/view_staging.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// @returns true if @param ptr points into the staging @param buffer
+template <typename T>
+bool is_staged(const T *ptr, const std::vector<std::max_align_t> &buffer) {
+    const auto *first = reinterpret_cast<const std::byte *>(buffer.data());
+    const auto *last = first + buffer.size() * sizeof(std::max_align_t);
+    const auto *p = reinterpret_cast<const std::byte *>(ptr);
+
+    return first <= p && p < last;
+}
+
+}  // anonymous namespace
+
+// Test the staging of the detector geometry into a small memory area
+GTEST_TEST(detray_core, view_staging) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Test-beam like setup
+    tel_det_config<test_algebra> tel_cfg{20.f * unit<scalar>::mm,
+                                         20.f * unit<scalar>::mm};
+    tel_cfg.n_surfaces(10u).length(500.f * unit<scalar>::mm);
+
+    auto [det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    using detector_t = decltype(det);
+    using view_detector_t =
+        detector<typename detector_t::metadata, device_container_types>;
+
+    const auto ctx = typename detector_t::geometry_context{};
+
+    auto det_view = detray::get_data(det);
+
+    // The entire geometry fits into a few kB
+    const std::size_t n_bytes{detail::staging_size(det_view)};
+    const std::size_t n_expected{
+        det.volumes().size() * sizeof(typename detector_t::volume_type) +
+        det.surfaces().size() * sizeof(typename detector_t::surface_type) +
+        det.transform_store().size() *
+            sizeof(typename detector_t::transform3_type)};
+    EXPECT_GE(n_bytes, n_expected);
+    EXPECT_LT(n_bytes, 16u * 1024u);
+
+    // Stage everything
+    std::vector<std::max_align_t> buffer(n_bytes / sizeof(std::max_align_t) +
+                                         1u);
+    detail::staging_area area{buffer.data(),
+                              buffer.size() * sizeof(std::max_align_t)};
+
+    auto staged_view =
+        detail::stage_detector_view(det_view, area, detail::strided_copy{});
+    EXPECT_EQ(area.size(), n_bytes);
+
+    const view_detector_t staged_det{staged_view};
+
+    ASSERT_TRUE(is_staged(staged_det.volumes().data(), buffer));
+    ASSERT_TRUE(is_staged(&staged_det.surfaces()[0], buffer));
+
+    ASSERT_EQ(staged_det.volumes().size(), det.volumes().size());
+    for (std::size_t i = 0u; i < det.volumes().size(); ++i) {
+        EXPECT_TRUE(staged_det.volumes()[i] == det.volumes()[i]);
+    }
+
+    ASSERT_EQ(staged_det.surfaces().size(), det.surfaces().size());
+    for (std::size_t i = 0u; i < det.surfaces().size(); ++i) {
+        EXPECT_TRUE(staged_det.surfaces()[i] == det.surfaces()[i]);
+    }
+
+    ASSERT_EQ(staged_det.transform_store().size(),
+              det.transform_store().size());
+    for (dindex i = 0u; i < det.transform_store().size(); ++i) {
+        EXPECT_TRUE(staged_det.transform_store().at(i, ctx) ==
+                    det.transform_store().at(i, ctx));
+    }
+
+    const auto &rectangles =
+        det.mask_store().template get<detector_t::masks::id::e_rectangle2>();
+    const auto &staged_rectangles =
+        staged_det.mask_store()
+            .template get<detector_t::masks::id::e_rectangle2>();
+    ASSERT_EQ(staged_rectangles.size(), rectangles.size());
+    ASSERT_TRUE(is_staged(staged_rectangles.data(), buffer));
+    for (std::size_t i = 0u; i < rectangles.size(); ++i) {
+        EXPECT_TRUE(staged_rectangles[i] == rectangles[i]);
+    }
+
+    // Only the volume descriptors fit into a small area: The rest of the
+    // geometry stays in the original memory
+    std::vector<std::max_align_t> small_buffer(
+        det.volumes().size() * sizeof(typename detector_t::volume_type) /
+            sizeof(std::max_align_t) +
+        1u);
+    detail::staging_area small_area{
+        small_buffer.data(), small_buffer.size() * sizeof(std::max_align_t)};
+
+    auto partial_view = detail::stage_detector_view(det_view, small_area,
+                                                    detail::strided_copy{});
+    EXPECT_LE(small_area.size(), small_area.capacity());
+
+    const view_detector_t partial_det{partial_view};
+
+    EXPECT_TRUE(is_staged(partial_det.volumes().data(), small_buffer));
+    EXPECT_EQ(&partial_det.surfaces()[0], &det.surfaces()[0]);
+    EXPECT_TRUE(partial_det.volumes()[0] == det.volumes()[0]);
+    EXPECT_TRUE(partial_det.surfaces()[1] == det.surfaces()[1]);
+
+    // Copy with a group of threads (emulated one after the other)
+    std::vector<std::max_align_t> group_buffer(buffer.size());
+    constexpr unsigned int n_threads{4u};
+    decltype(det_view) group_view{};
+    for (unsigned int rank = 0u; rank < n_threads; ++rank) {
+        detail::staging_area group_area{
+            group_buffer.data(),
+            group_buffer.size() * sizeof(std::max_align_t)};
+        group_view = detail::stage_detector_view(
+            det_view, group_area, detail::strided_copy{rank, n_threads});
+    }
+
+    const view_detector_t group_det{group_view};
+    for (std::size_t i = 0u; i < det.surfaces().size(); ++i) {
+        EXPECT_TRUE(group_det.surfaces()[i] == det.surfaces()[i]);
+    }
+    const auto &group_rectangles =
+        group_det.mask_store()
+            .template get<detector_t::masks::id::e_rectangle2>();
+    for (std::size_t i = 0u; i < rectangles.size(); ++i) {
+        EXPECT_TRUE(group_rectangles[i] == rectangles[i]);
+    }
+}
@@ -37,4 +37,112 @@ GTEST_TEST(detray_detectors, toy_detector) {
         build_toy_detector<test_algebra>(host_mr, toy_cfg);
 
     EXPECT_TRUE(toy_detector_test(toy_det2, names2));
+
+    // Check the volumes and surfaces with several threads
+    EXPECT_TRUE(detail::check_consistency(toy_det2, false, names2, 4u));
+    EXPECT_TRUE(detail::check_consistency(toy_det2, false, names2, 0u));
+}
+
+// This test checks the scaling of the toy geometry beyond its default size
+GTEST_TEST(detray_detectors, scaled_toy_detector) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Without scaling, the toy detector is reproduced
+    toy_det_config<test::scalar> toy_cfg{};
+    scale_toy_detector(toy_cfg, 4u, 3u);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    EXPECT_TRUE(toy_detector_test(toy_det, names));
+
+    // Add layers and make the modules and grid bins smaller
+    for (const bool use_maps : {false, true}) {
+        constexpr unsigned int n_brl{7u};
+        constexpr unsigned int n_edc{9u};
+
+        toy_det_config<test::scalar> scaled_cfg{};
+        scale_toy_detector(scaled_cfg, n_brl, n_edc, 2.f);
+        scaled_cfg.grid_bin_scale(2.f).use_material_maps(use_maps).do_check(
+            true);
+
+        const auto [scaled_det, scaled_names] =
+            build_toy_detector<test_algebra>(host_mr, scaled_cfg);
+
+        // Beampipe, barrel layers and gaps, outer gap and endcaps
+        EXPECT_EQ(scaled_det.volumes().size(), 2u * n_brl + 4u * n_edc + 2u);
+        EXPECT_GT(scaled_cfg.outer_radius(), toy_cfg.outer_radius());
+
+        std::size_t n_expected{0u};
+        for (const auto &bins : scaled_cfg.barrel_layer_binning()) {
+            n_expected += bins.first * bins.second;
+        }
+        for (const unsigned int n_phi : scaled_cfg.endcap_config().binning()) {
+            n_expected += 2u * n_edc * n_phi;
+        }
+
+        std::size_t n_sensitives{0u};
+        for (const auto &sf_desc : scaled_det.surfaces()) {
+            n_sensitives += sf_desc.is_sensitive() ? 1u : 0u;
+        }
+        EXPECT_EQ(n_sensitives, n_expected);
+        EXPECT_GT(n_sensitives, 4u * 3000u);
+    }
+}
+
+// This test checks that the detector containers are allocated exactly once
+// during the build of the toy geometry
+GTEST_TEST(detray_detectors, toy_detector_reserved) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+
+    for (const bool use_maps : {false, true}) {
+        toy_det_config<test::scalar> toy_cfg{};
+        toy_cfg.use_material_maps(use_maps);
+        const auto [toy_det, names] =
+            build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+        using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+        using mask_id = typename detector_t::masks::id;
+        using material_id = typename detector_t::materials::id;
+        using accel_id = typename detector_t::accel::id;
+
+        const auto& masks = toy_det.mask_store();
+        const auto& materials = toy_det.material_store();
+        const auto& accel = toy_det.accelerator_store();
+
+        EXPECT_EQ(toy_det.volumes().capacity(), toy_det.volumes().size());
+        EXPECT_EQ(toy_det.transform_store().data()->capacity(),
+                  toy_det.transform_store().size());
+
+        const auto& rectangles = masks.template get<mask_id::e_rectangle2>();
+        const auto& trapezoids = masks.template get<mask_id::e_trapezoid2>();
+        const auto& cylinders =
+            masks.template get<mask_id::e_portal_cylinder2>();
+        const auto& rings = masks.template get<mask_id::e_portal_ring2>();
+        EXPECT_EQ(rectangles.capacity(), rectangles.size());
+        EXPECT_EQ(trapezoids.capacity(), trapezoids.size());
+        EXPECT_EQ(cylinders.capacity(), cylinders.size());
+        EXPECT_EQ(rings.capacity(), rings.size());
+
+        const auto& slabs = materials.template get<material_id::e_slab>();
+        EXPECT_EQ(slabs.capacity(), slabs.size());
+        const auto& disc_maps =
+            materials.template get<material_id::e_disc2_map>();
+        EXPECT_EQ(disc_maps.headers().capacity(), disc_maps.size());
+        EXPECT_EQ(disc_maps.bin_storage().capacity(),
+                  disc_maps.bin_storage().size());
+
+        const auto& brute_force = accel.template get<accel_id::e_default>();
+        EXPECT_EQ(brute_force.all().capacity(), brute_force.all().size());
+        const auto& cyl_grids =
+            accel.template get<accel_id::e_cylinder2_grid>();
+        EXPECT_EQ(cyl_grids.headers().capacity(), cyl_grids.size());
+        EXPECT_EQ(cyl_grids.bin_storage().capacity(),
+                  cyl_grids.bin_storage().size());
+    }
 }
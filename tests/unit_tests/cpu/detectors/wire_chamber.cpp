@@ -6,6 +6,8 @@
  */
 
 // Project include(s).
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
 #include "detray/utils/consistency_checker.hpp"
 
 // Detray test include(s)
@@ -30,3 +32,48 @@ GTEST_TEST(detray_detectors, wire_chamber) {
     // Check general consistency of the detector
     detail::check_consistency(wire_det, true, names);
 }
+
+GTEST_TEST(detray_detectors, wire_chamber_grid) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // One wire per phi bin in the layer grids
+    wire_chamber_config<test::scalar> cfg{};
+    cfg.wires_per_bin(1u);
+    auto [wire_det, names] = build_wire_chamber<test::algebra>(host_mr, cfg);
+
+    detail::check_consistency(wire_det, false, names);
+
+    using detector_t = decltype(wire_det);
+    using accel_id = typename detector_t::accel::id;
+
+    const auto& cyl_grids = wire_det.accelerator_store()
+                                .template get<accel_id::e_cylinder2_grid>();
+
+    // The first volume is the empty inner volume
+    for (unsigned int i_lay = 0u; i_lay < cfg.n_layers(); ++i_lay) {
+        const auto& vol = wire_det.volumes()[i_lay + 1u];
+
+        const auto link =
+            vol.accel_link()[detector_t::geo_obj_ids::e_sensitive];
+        ASSERT_EQ(link.id(), accel_id::e_cylinder2_grid);
+
+        const auto grid = cyl_grids[link.index()];
+        EXPECT_EQ(grid.nbins(), cfg.n_wires(i_lay));
+
+        // Every wire is in the grid and the wires are spread over the bins
+        const auto sf_range = vol.template sf_link<surface_id::e_sensitive>();
+        EXPECT_EQ(grid.size(), sf_range[1] - sf_range[0]);
+        for (dindex gbin = 0u; gbin < grid.nbins(); ++gbin) {
+            EXPECT_LE(grid.bin(gbin).size(), 2u) << "layer " << i_lay;
+        }
+    }
+
+    // Window that covers the drift radius and the stereo shift of the wires
+    const darray<dindex, 2> search_window{wire_chamber_search_window(cfg)};
+    EXPECT_EQ(search_window[0], 4u);
+    EXPECT_EQ(search_window[1], 0u);
+
+    // Fixed binning with 100 phi bins
+    EXPECT_EQ(wire_chamber_search_window(cfg.wires_per_bin(0u))[0], 2u);
+}
@@ -0,0 +1,191 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/geometry/compact_transform3.hpp"
+
+#include "detray/core/detail/single_store.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/tracks/ray.hpp"
+
+// Detray test include(s)
+#include "detray/test/common/assert.hpp"
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <type_traits>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+using compact_transform = compact_transform3<test_algebra>;
+
+namespace {
+
+constexpr scalar isclose{1e-5f};
+
+/// Rotated and translated test transform
+const vector3 z_axis{vector::normalize(vector3{1.f, 1.f, 1.f})};
+const vector3 x_axis{vector::normalize(vector3{1.f, -1.f, 0.f})};
+const point3 translation{2.f, -3.f, 4.f};
+
+}  // namespace
+
+// Test the compact transform against the algebra transform
+GTEST_TEST(detray_geometry, compact_transform3) {
+
+    // The layout: 3x4 inverse and the translation
+    static_assert(sizeof(compact_transform) == 16u * sizeof(scalar));
+    static_assert(alignof(compact_transform) == 4u * sizeof(scalar));
+
+    const transform3 trf{translation, z_axis, x_axis};
+    const compact_transform ctrf{translation, z_axis, x_axis};
+
+    // Identity
+    const compact_transform identity{};
+    EXPECT_POINT3_NEAR(identity.x(), vector3({1.f, 0.f, 0.f}), isclose);
+    EXPECT_POINT3_NEAR(identity.translation(), point3({0.f, 0.f, 0.f}),
+                       isclose);
+
+    // Axes and translation
+    EXPECT_POINT3_NEAR(ctrf.x(), trf.x(), isclose);
+    EXPECT_POINT3_NEAR(ctrf.y(), trf.y(), isclose);
+    EXPECT_POINT3_NEAR(ctrf.z(), trf.z(), isclose);
+    EXPECT_POINT3_NEAR(ctrf.translation(), trf.translation(), isclose);
+
+    // Conversions
+    const point3 glob_p{1.f, 7.f, -2.f};
+    const vector3 glob_v{vector::normalize(vector3{0.f, 2.f, 1.f})};
+
+    const point3 loc_p = ctrf.point_to_local(glob_p);
+    EXPECT_POINT3_NEAR(loc_p, trf.point_to_local(glob_p), isclose);
+    EXPECT_POINT3_NEAR(ctrf.point_to_global(loc_p), glob_p, isclose);
+
+    const vector3 loc_v = ctrf.vector_to_local(glob_v);
+    EXPECT_POINT3_NEAR(loc_v, trf.vector_to_local(glob_v), isclose);
+    EXPECT_POINT3_NEAR(ctrf.vector_to_global(loc_v), glob_v, isclose);
+
+    // Round trip through the algebra transform
+    const transform3 trf2 = ctrf;
+    EXPECT_POINT3_NEAR(trf2.point_to_local(glob_p), loc_p, isclose);
+
+    const compact_transform ctrf2{trf};
+    EXPECT_POINT3_NEAR(ctrf2.point_to_local(glob_p), loc_p, isclose);
+
+    // Pure translation
+    const compact_transform shift{translation};
+    const point3 shifted_p = glob_p - translation;
+    EXPECT_POINT3_NEAR(shift.point_to_local(glob_p), shifted_p, isclose);
+}
+
+// Test a transform store of compact transforms
+GTEST_TEST(detray_geometry, compact_transform3_store) {
+
+    using transform_store_t =
+        single_store<compact_transform, dvector, geometry_context>;
+
+    transform_store_t store;
+    typename transform_store_t::context_type ctx{};
+
+    // Filled with the algebra transforms, like in the builders
+    store.push_back(transform3{translation, z_axis, x_axis}, ctx);
+    store.push_back(transform3{translation}, ctx);
+    store.emplace_back(ctx, translation, z_axis, x_axis);
+    ASSERT_EQ(store.size(ctx), 3u);
+
+    EXPECT_TRUE(store.at(0u, ctx) == store.at(2u, ctx));
+    EXPECT_FALSE(store.at(0u, ctx) == store.at(1u, ctx));
+    EXPECT_POINT3_NEAR(store.at(1u, ctx).translation(), translation, isclose);
+}
+
+// Test the ray intersectors with the compact transform
+GTEST_TEST(detray_geometry, compact_transform3_intersection) {
+
+    const transform3 trf{translation, z_axis, x_axis};
+    const compact_transform ctrf{trf};
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 dir{vector::normalize(vector3{1.f, 0.2f, 0.5f})};
+    const detail::ray<test_algebra> r(pos, 0.f, dir, 0.f);
+
+    // Plane
+    ray_intersector<rectangle2D, test_algebra, true> pi;
+    mask<rectangle2D, test_algebra> rect{0u, 100.f, 100.f};
+
+    const auto hit = pi(r, surface_descriptor<>{}, rect, trf);
+    const auto c_hit = pi(r, surface_descriptor<>{}, rect, ctrf);
+
+    ASSERT_TRUE(hit.status);
+    ASSERT_TRUE(c_hit.status);
+    EXPECT_NEAR(c_hit.path, hit.path, isclose);
+    EXPECT_NEAR(c_hit.local[0], hit.local[0], isclose);
+    EXPECT_NEAR(c_hit.local[1], hit.local[1], isclose);
+
+    // Cylinder
+    ray_intersector<cylinder2D, test_algebra, true> ci;
+    mask<cylinder2D, test_algebra> cyl{0u, 10.f, -100.f, 100.f};
+
+    const auto hits = ci(r, surface_descriptor<>{}, cyl, trf);
+    const auto c_hits = ci(r, surface_descriptor<>{}, cyl, ctrf);
+
+    for (std::size_t i = 0u; i < 2u; ++i) {
+        ASSERT_EQ(c_hits[i].status, hits[i].status);
+        EXPECT_NEAR(c_hits[i].path, hits[i].path, isclose);
+        EXPECT_NEAR(c_hits[i].local[0], hits[i].local[0], isclose);
+        EXPECT_NEAR(c_hits[i].local[1], hits[i].local[1], isclose);
+    }
+}
+
+// Test the transform with a different storage precision than the algebra
+GTEST_TEST(detray_geometry, compact_transform3_storage_precision) {
+
+    // Store in the other precision (e.g. float for a double precision run)
+    using storage_t =
+        std::conditional_t<std::is_same_v<scalar, float>, double, float>;
+    using mixed_transform = compact_transform3<test_algebra, storage_t>;
+
+    static_assert(sizeof(mixed_transform) == 16u * sizeof(storage_t));
+    static_assert(
+        std::is_same_v<typename mixed_transform::scalar_type, scalar>);
+
+    constexpr scalar tol{1e-4f};
+
+    const transform3 trf{translation, z_axis, x_axis};
+    const mixed_transform ctrf{trf};
+
+    EXPECT_POINT3_NEAR(ctrf.x(), trf.x(), tol);
+    EXPECT_POINT3_NEAR(ctrf.z(), trf.z(), tol);
+    EXPECT_POINT3_NEAR(ctrf.translation(), trf.translation(), tol);
+
+    // The conversions compute in the algebra precision
+    const point3 glob_p{1.f, 7.f, -2.f};
+    const vector3 glob_v{vector::normalize(vector3{0.f, 2.f, 1.f})};
+
+    const point3 loc_p = ctrf.point_to_local(glob_p);
+    EXPECT_POINT3_NEAR(loc_p, trf.point_to_local(glob_p), tol);
+    EXPECT_POINT3_NEAR(ctrf.point_to_global(loc_p), glob_p, tol);
+    EXPECT_POINT3_NEAR(ctrf.vector_to_local(glob_v),
+                       trf.vector_to_local(glob_v), tol);
+
+    // Transform store with the mixed precision transforms
+    single_store<mixed_transform, dvector, geometry_context> store;
+    store.push_back(trf, geometry_context{});
+    ASSERT_EQ(store.size(geometry_context{}), 1u);
+    EXPECT_POINT3_NEAR(store.at(0u, geometry_context{}).point_to_local(glob_p),
+                       loc_p, tol);
+}
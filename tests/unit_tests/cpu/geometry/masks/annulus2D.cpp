@@ -19,6 +19,10 @@
 // GTest include
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <cmath>
+#include <iostream>
+
 using namespace detray;
 
 using test_algebra = test::algebra;
@@ -61,6 +65,15 @@ GTEST_TEST(detray_masks, annulus2D) {
     ASSERT_NEAR(ann2[annulus2D::e_shift_y], 2.0f, tol);
     ASSERT_NEAR(ann2[annulus2D::e_average_phi], 0.f, tol);
 
+    // Values derived from the origin shift
+    ASSERT_NEAR(ann2[annulus2D::e_shift_r2], 8.f, tol);
+    ASSERT_NEAR(ann2[annulus2D::e_two_shift_r], 2.f * std::sqrt(8.f), tol);
+    ASSERT_NEAR(ann2[annulus2D::e_shift_phi], -0.25f * constant<scalar>::pi,
+                tol);
+    ASSERT_NEAR(ann2[annulus2D::e_min_r_focal], 7.2f - std::sqrt(8.f), tol);
+    ASSERT_NEAR(ann2[annulus2D::e_max_r_focal], 12.f + std::sqrt(8.f), tol);
+    ASSERT_TRUE(ann2.get_shape().check_consistency(ann2.values(), std::cout));
+
     ASSERT_TRUE(ann2.is_inside(toStripFrame(p2_in)));
     ASSERT_FALSE(ann2.is_inside(toStripFrame(p2_out1)));
     ASSERT_FALSE(ann2.is_inside(toStripFrame(p2_out2)));
@@ -86,6 +99,25 @@ GTEST_TEST(detray_masks, annulus2D) {
                                                       toStripFrame(p2_out4)),
                 0.80214f, tol);
 
+    // Radius in the beam (module) frame
+    for (const point3 &p : {p2_in, p2_out1, p2_out2, p2_out3, p2_out4}) {
+        const scalar r2{
+            ann2.get_shape().get_r2_beam_frame(ann2.values(), toStripFrame(p))};
+        ASSERT_NEAR(r2, p[0] * p[0] + p[1] * p[1], 1e-4f);
+    }
+
+    // The pre-rejection must not change the result of the boundary check
+    for (scalar x = -15.13f; x < 15.f; x += 0.5f) {
+        for (scalar y = -15.13f; y < 15.f; y += 0.5f) {
+            const point3 p{x, y, 0.f};
+            const point3 loc_p{toStripFrame(p)};
+            const scalar r{vector::perp(p)};
+            const bool expected{r >= minR && r <= maxR && loc_p[1] >= minPhi &&
+                                loc_p[1] <= maxPhi};
+            ASSERT_EQ(ann2.is_inside(loc_p, 0.f), expected) << x << ", " << y;
+        }
+    }
+
     // Check area: @TODO not implemented, yet
     scalar a = ann2.area();
     ASSERT_EQ(a, ann2.measure());
@@ -141,8 +173,8 @@ GTEST_TEST(detray_masks, annulus2D_ratio_test) {
 
     constexpr scalar t{0.f};
 
-    constexpr mask<annulus2D, test_algebra> ann{0u,       2.5f, 5.f,  -0.64299f,
-                                                4.13173f, 1.f,  0.5f, 0.f};
+    const mask<annulus2D, test_algebra> ann{0u,       2.5f, 5.f,  -0.64299f,
+                                            4.13173f, 1.f,  0.5f, 0.f};
     const test::transform3 trf{};
 
     constexpr scalar world{10.f * unit<scalar>::mm};
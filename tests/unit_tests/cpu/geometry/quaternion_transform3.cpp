@@ -0,0 +1,215 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/geometry/quaternion_transform3.hpp"
+
+#include "detray/core/detail/single_store.hpp"
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/tracks/ray.hpp"
+
+// Detray test include(s)
+#include "detray/test/common/assert.hpp"
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <type_traits>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+using quaternion_transform = quaternion_transform3<test_algebra>;
+
+namespace {
+
+constexpr scalar isclose{1e-5f};
+
+/// Rotated and translated test transform
+const vector3 z_axis{vector::normalize(vector3{1.f, 1.f, 1.f})};
+const vector3 x_axis{vector::normalize(vector3{1.f, -1.f, 0.f})};
+const point3 translation{2.f, -3.f, 4.f};
+
+/// Compare the quaternion transform with the algebra transform
+void check_transform(const transform3 &trf) {
+
+    const quaternion_transform qtrf{trf};
+
+    EXPECT_POINT3_NEAR(qtrf.x(), trf.x(), isclose);
+    EXPECT_POINT3_NEAR(qtrf.y(), trf.y(), isclose);
+    EXPECT_POINT3_NEAR(qtrf.z(), trf.z(), isclose);
+    EXPECT_POINT3_NEAR(qtrf.translation(), trf.translation(), isclose);
+
+    const auto q = qtrf.quaternion();
+    EXPECT_NEAR(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3], 1.f,
+                isclose);
+    EXPECT_GE(q[3], 0.f);
+
+    const point3 glob_p{1.f, 7.f, -2.f};
+    const vector3 glob_v{vector::normalize(vector3{0.f, 2.f, 1.f})};
+
+    const point3 loc_p = qtrf.point_to_local(glob_p);
+    EXPECT_POINT3_NEAR(loc_p, trf.point_to_local(glob_p), isclose);
+    EXPECT_POINT3_NEAR(qtrf.point_to_global(loc_p), glob_p, isclose);
+
+    const vector3 loc_v = qtrf.vector_to_local(glob_v);
+    EXPECT_POINT3_NEAR(loc_v, trf.vector_to_local(glob_v), isclose);
+    EXPECT_POINT3_NEAR(qtrf.vector_to_global(loc_v), glob_v, isclose);
+}
+
+}  // namespace
+
+// Test the quaternion transform against the algebra transform
+GTEST_TEST(detray_geometry, quaternion_transform3) {
+
+    // The layout: quaternion and translation
+    static_assert(sizeof(quaternion_transform) == 8u * sizeof(scalar));
+    static_assert(alignof(quaternion_transform) == 8u * sizeof(scalar));
+
+    // Identity
+    const quaternion_transform identity{};
+    EXPECT_POINT3_NEAR(identity.x(), vector3({1.f, 0.f, 0.f}), isclose);
+    EXPECT_POINT3_NEAR(identity.y(), vector3({0.f, 1.f, 0.f}), isclose);
+    EXPECT_POINT3_NEAR(identity.z(), vector3({0.f, 0.f, 1.f}), isclose);
+    EXPECT_POINT3_NEAR(identity.translation(), point3({0.f, 0.f, 0.f}),
+                       isclose);
+
+    // Every pivot of the conversion from the rotation matrix
+    check_transform(transform3{translation, z_axis, x_axis});
+    check_transform(transform3{translation, -1.f * z_axis, x_axis});
+    // Rotations by pi around the x-, y- and z-axis
+    check_transform(transform3{translation, vector3{0.f, 0.f, -1.f},
+                               vector3{1.f, 0.f, 0.f}});
+    check_transform(transform3{translation, vector3{0.f, 0.f, -1.f},
+                               vector3{-1.f, 0.f, 0.f}});
+    check_transform(transform3{translation, vector3{0.f, 0.f, 1.f},
+                               vector3{-1.f, 0.f, 0.f}});
+
+    // Construction from the axes is the same as from the algebra transform
+    const transform3 trf{translation, z_axis, x_axis};
+    const quaternion_transform qtrf{translation, z_axis, x_axis};
+    EXPECT_TRUE(qtrf == quaternion_transform{trf});
+
+    // Round trip through the algebra transform
+    const point3 glob_p{1.f, 7.f, -2.f};
+    const transform3 trf2 = qtrf;
+    EXPECT_POINT3_NEAR(trf2.point_to_local(glob_p), trf.point_to_local(glob_p),
+                       isclose);
+
+    // Pure translation
+    const quaternion_transform shift{translation};
+    const point3 shifted_p = glob_p - translation;
+    EXPECT_POINT3_NEAR(shift.point_to_local(glob_p), shifted_p, isclose);
+    EXPECT_TRUE(shift == quaternion_transform{transform3{translation}});
+}
+
+// Test a transform store of quaternion transforms
+GTEST_TEST(detray_geometry, quaternion_transform3_store) {
+
+    using transform_store_t =
+        single_store<quaternion_transform, dvector, geometry_context>;
+
+    transform_store_t store;
+    typename transform_store_t::context_type ctx{};
+
+    // Filled with the algebra transforms, like in the builders
+    store.push_back(transform3{translation, z_axis, x_axis}, ctx);
+    store.push_back(transform3{translation}, ctx);
+    store.emplace_back(ctx, translation, z_axis, x_axis);
+    ASSERT_EQ(store.size(ctx), 3u);
+
+    EXPECT_TRUE(store.at(0u, ctx) == store.at(2u, ctx));
+    EXPECT_FALSE(store.at(0u, ctx) == store.at(1u, ctx));
+    EXPECT_POINT3_NEAR(store.at(1u, ctx).translation(), translation, isclose);
+}
+
+// Test the ray intersectors with the quaternion transform
+GTEST_TEST(detray_geometry, quaternion_transform3_intersection) {
+
+    const transform3 trf{translation, z_axis, x_axis};
+    const quaternion_transform qtrf{trf};
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const vector3 dir{vector::normalize(vector3{1.f, 0.2f, 0.5f})};
+    const detail::ray<test_algebra> r(pos, 0.f, dir, 0.f);
+
+    // Plane
+    ray_intersector<rectangle2D, test_algebra, true> pi;
+    mask<rectangle2D, test_algebra> rect{0u, 100.f, 100.f};
+
+    const auto hit = pi(r, surface_descriptor<>{}, rect, trf);
+    const auto q_hit = pi(r, surface_descriptor<>{}, rect, qtrf);
+
+    ASSERT_TRUE(hit.status);
+    ASSERT_TRUE(q_hit.status);
+    EXPECT_NEAR(q_hit.path, hit.path, isclose);
+    EXPECT_NEAR(q_hit.local[0], hit.local[0], isclose);
+    EXPECT_NEAR(q_hit.local[1], hit.local[1], isclose);
+
+    // Cylinder
+    ray_intersector<cylinder2D, test_algebra, true> ci;
+    mask<cylinder2D, test_algebra> cyl{0u, 10.f, -100.f, 100.f};
+
+    const auto hits = ci(r, surface_descriptor<>{}, cyl, trf);
+    const auto q_hits = ci(r, surface_descriptor<>{}, cyl, qtrf);
+
+    for (std::size_t i = 0u; i < 2u; ++i) {
+        ASSERT_EQ(q_hits[i].status, hits[i].status);
+        EXPECT_NEAR(q_hits[i].path, hits[i].path, isclose);
+        EXPECT_NEAR(q_hits[i].local[0], hits[i].local[0], isclose);
+        EXPECT_NEAR(q_hits[i].local[1], hits[i].local[1], isclose);
+    }
+}
+
+// Test the transform with a different storage precision than the algebra
+GTEST_TEST(detray_geometry, quaternion_transform3_storage_precision) {
+
+    // Store in the other precision (e.g. float for a double precision run)
+    using storage_t =
+        std::conditional_t<std::is_same_v<scalar, float>, double, float>;
+    using mixed_transform = quaternion_transform3<test_algebra, storage_t>;
+
+    static_assert(sizeof(mixed_transform) == 8u * sizeof(storage_t));
+    static_assert(
+        std::is_same_v<typename mixed_transform::scalar_type, scalar>);
+
+    constexpr scalar tol{1e-4f};
+
+    const transform3 trf{translation, z_axis, x_axis};
+    const mixed_transform qtrf{trf};
+
+    EXPECT_POINT3_NEAR(qtrf.x(), trf.x(), tol);
+    EXPECT_POINT3_NEAR(qtrf.z(), trf.z(), tol);
+    EXPECT_POINT3_NEAR(qtrf.translation(), trf.translation(), tol);
+
+    // The conversions compute in the algebra precision
+    const point3 glob_p{1.f, 7.f, -2.f};
+    const vector3 glob_v{vector::normalize(vector3{0.f, 2.f, 1.f})};
+
+    const point3 loc_p = qtrf.point_to_local(glob_p);
+    EXPECT_POINT3_NEAR(loc_p, trf.point_to_local(glob_p), tol);
+    EXPECT_POINT3_NEAR(qtrf.point_to_global(loc_p), glob_p, tol);
+    EXPECT_POINT3_NEAR(qtrf.vector_to_local(glob_v),
+                       trf.vector_to_local(glob_v), tol);
+
+    // Transform store with the mixed precision transforms
+    single_store<mixed_transform, dvector, geometry_context> store;
+    store.push_back(trf, geometry_context{});
+    ASSERT_EQ(store.size(geometry_context{}), 1u);
+    EXPECT_POINT3_NEAR(store.at(0u, geometry_context{}).point_to_local(glob_p),
+                       loc_p, tol);
+}
@@ -0,0 +1,92 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes.hpp"
+#include "detray/materials/compact_material_map.hpp"
+#include "detray/materials/material_map.hpp"
+#include "detray/materials/predefined_materials.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point2 = test::point2;
+
+using material_t =
+    typename material_grid_factory<test_algebra>::bin_type::entry_type;
+
+/// Unittest: Compress a rectangular material map
+GTEST_TEST(detray_material, compact_material_map) {
+
+    constexpr scalar hx{10.f * unit<scalar>::mm};
+    constexpr scalar hy{20.f * unit<scalar>::mm};
+
+    mask<rectangle2D, test_algebra> r2{0u, hx, hy};
+
+    material_grid_factory<test_algebra> mat_map_factory{};
+    auto rectangle_map = mat_map_factory.new_grid(r2, {10u, 20u});
+
+    // Three distinct materials with varying thickness
+    scalar thickness = 0.1f * unit<scalar>::mm;
+    for (dindex gbin = 0; gbin < rectangle_map.nbins(); ++gbin) {
+        material<scalar> mat{};
+        switch (gbin % 3u) {
+            case 0u:
+                mat = silicon<scalar>{};
+                break;
+            case 1u:
+                mat = beryllium<scalar>{};
+                break;
+            default:
+                mat = argon_liquid<scalar>{};
+        }
+        rectangle_map.template populate<replace<>>(gbin,
+                                                   material_t(mat, thickness));
+        thickness += 0.37f * unit<scalar>::mm;
+    }
+
+    using compact_map_t = compact_material_map<test_algebra, rectangle2D>;
+
+    const auto compact_map = compact_map_t::compress(rectangle_map);
+
+    static_assert(sizeof(compact_material_slab<scalar>) == 4u);
+
+    EXPECT_EQ(compact_map.nbins(), rectangle_map.nbins());
+    EXPECT_EQ(compact_map.palette().size(), 3u);
+    EXPECT_EQ(compact_map.compact_grid().axes(), rectangle_map.axes());
+
+    // Thickness is stored in half precision
+    constexpr scalar tol{1e-3f};
+    for (dindex gbin = 0; gbin < rectangle_map.nbins(); ++gbin) {
+        const material_t &exp = rectangle_map.bin(gbin).value();
+        const material_t slab = compact_map.at(gbin);
+
+        EXPECT_EQ(slab.get_material(), exp.get_material());
+        EXPECT_NEAR(slab.thickness(), exp.thickness(), tol * exp.thickness());
+        EXPECT_NEAR(slab.thickness_in_X0(), exp.thickness_in_X0(),
+                    tol * exp.thickness_in_X0());
+    }
+
+    // Lookup by local position
+    for (const point2 p : {point2{-9.5f, -19.5f}, point2{0.1f, 0.2f},
+                           point2{3.3f, -7.1f}, point2{9.9f, 19.9f}}) {
+        const material_t &exp = rectangle_map.search(p).value();
+        const material_t slab = compact_map.search(p);
+
+        EXPECT_EQ(slab.get_material(), exp.get_material());
+        EXPECT_NEAR(slab.thickness(), exp.thickness(), tol * exp.thickness());
+    }
+}
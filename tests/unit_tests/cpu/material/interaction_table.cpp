@@ -0,0 +1,91 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/materials/interaction_table.hpp"
+
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/predefined_materials.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+
+using namespace detray;
+
+using scalar = test::scalar;
+
+namespace {
+
+/// Compare the tabulated values with the analytic formulas
+void compare(const material<scalar> &mat, const pdg_particle<scalar> &ptc) {
+
+    const interaction_table<scalar> table(mat, ptc);
+    ASSERT_TRUE(table.is_valid());
+    ASSERT_TRUE(table.matches(mat, ptc));
+
+    const interaction<scalar> I{};
+    constexpr scalar path{1.f * unit<scalar>::mm};
+    const scalar x_over_X0{path / mat.X0()};
+
+    constexpr std::array<scalar, 7u> momenta{
+        0.1f * unit<scalar>::GeV, 0.3f * unit<scalar>::GeV,
+        1.f * unit<scalar>::GeV,  3.f * unit<scalar>::GeV,
+        10.f * unit<scalar>::GeV, 100.f * unit<scalar>::GeV,
+        1.f * unit<scalar>::TeV};
+
+    for (const scalar p : momenta) {
+        const scalar qop{ptc.charge() / p};
+        const detail::relativistic_quantities<scalar> rq(ptc, qop);
+
+        typename interaction_table<scalar>::values v{};
+        ASSERT_TRUE(table.lookup(qop, v)) << p;
+
+        const scalar e_loss{
+            I.compute_energy_loss_bethe_bloch(path, mat, ptc, rq)};
+        EXPECT_NEAR(path * v.stopping_power, e_loss, 5e-3f * e_loss) << p;
+
+        const scalar sigma_qop{
+            I.compute_energy_loss_landau_sigma_QOverP(path, mat, ptc, rq)};
+        EXPECT_NEAR(path * v.sigma_qop_per_length, sigma_qop,
+                    5e-3f * sigma_qop)
+            << p;
+
+        const scalar theta0{
+            I.compute_multiple_scattering_theta0(x_over_X0, ptc, rq)};
+        EXPECT_NEAR(table.theta0(v, x_over_X0), theta0, 5e-3f * theta0) << p;
+    }
+}
+
+}  // anonymous namespace
+
+// Test the interaction table against the analytic formulas
+GTEST_TEST(detray_material, interaction_table) {
+
+    compare(silicon<scalar>(), muon<scalar>());
+    compare(silicon<scalar>(), electron<scalar>());
+    compare(argon_liquid<scalar>(), pion_plus<scalar>());
+
+    // Material or particle species that are not covered
+    const interaction_table<scalar> table{silicon<scalar>(), muon<scalar>()};
+    EXPECT_FALSE(table.matches(argon_liquid<scalar>(), muon<scalar>()));
+    EXPECT_FALSE(table.matches(silicon<scalar>(), electron<scalar>()));
+
+    // Outside of the momentum range
+    typename interaction_table<scalar>::values v{};
+    EXPECT_FALSE(table.lookup(-1.f / (1.f * unit<scalar>::keV), v));
+
+    // Empty table
+    EXPECT_FALSE(interaction_table<scalar>{}.lookup(-1.f, v));
+}
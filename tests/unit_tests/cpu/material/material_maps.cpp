@@ -11,6 +11,7 @@
 #include "detray/geometry/shapes.hpp"
 #include "detray/materials/detail/concepts.hpp"
 #include "detray/materials/material_map.hpp"
+#include "detray/materials/volume_material_integral.hpp"
 
 // Detray test include(s)
 #include "detray/test/utils/types.hpp"
@@ -319,3 +320,222 @@ GTEST_TEST(detray_material, material_grid_comparison) {
     auto grid_neq_entries = createGrid(10.f, 20.f, 10u, 20u, true);
     EXPECT_NE(grid_ref, grid_neq_entries);
 }
+
+/// Unittest: Axis spans of a cylinder shaped volume material map
+GTEST_TEST(detray_material, cylinder3D_map_span) {
+
+    constexpr scalar pi{constant<scalar>::pi};
+    mask<cylinder3D, test_algebra> cyl{0u,   10.f, -pi, -100.f,
+                                       50.f, pi,   40.f};
+    auto cyl_map = mat_map_factory.new_grid(cyl, {4u, 4u, 7u});
+
+    static_assert(concepts::volume_material<decltype(cyl_map)>);
+
+    EXPECT_FLOAT_EQ(cyl_map.template get_axis<0>().min(), 10.f);
+    EXPECT_FLOAT_EQ(cyl_map.template get_axis<0>().max(), 50.f);
+    EXPECT_FLOAT_EQ(cyl_map.template get_axis<2>().min(), -100.f);
+    EXPECT_FLOAT_EQ(cyl_map.template get_axis<2>().max(), 40.f);
+}
+
+/// Unittest: Integrate the material of a cuboid shaped volume material map
+GTEST_TEST(detray_material, cuboid_map_integral) {
+
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    constexpr scalar tol{1e-3f};
+
+    // Layers of iron and liquid argon along x, 10mm each
+    mask<cuboid3D, test_algebra> cuboid{0u,   -50.f, -50.f, -50.f,
+                                        50.f, 50.f,  50.f};
+    auto cuboid_map = mat_map_factory.new_grid(cuboid, {10u, 2u, 1u});
+
+    static_assert(concepts::volume_material<decltype(cuboid_map)>);
+
+    using loc_bin_t = typename decltype(cuboid_map)::loc_bin_index;
+    for (dindex i = 0u; i < 10u; ++i) {
+        for (dindex j = 0u; j < 2u; ++j) {
+            const material<scalar> mat =
+                (i % 2u == 0u) ? material<scalar>(iron<scalar>{})
+                               : material<scalar>(argon_liquid<scalar>{});
+            cuboid_map.template populate<replace<>>(
+                loc_bin_t{i, j, 0u}, material_t(mat, 1.f * unit<scalar>::mm));
+        }
+    }
+
+    const scalar X0_fe{iron<scalar>{}.X0()};
+    const scalar X0_ar{argon_liquid<scalar>{}.X0()};
+    const scalar rho_fe{iron<scalar>{}.mass_density()};
+    const scalar rho_ar{argon_liquid<scalar>{}.mass_density()};
+
+    // Placement of the volume
+    const transform3 trf{point3{100.f, 0.f, 0.f}};
+
+    // Step along x: starts and ends in the middle of a bin
+    const point3 pos{55.f, 10.f, 0.f};
+    const vector3 dir{1.f, 0.f, 0.f};
+
+    auto integral = integrate_material(cuboid_map, trf, pos, dir, 50.f);
+
+    EXPECT_EQ(integral.n_bins, 6u);
+    EXPECT_NEAR(integral.path, 50.f, tol);
+    EXPECT_NEAR(integral.path_in_x0, 25.f / X0_fe + 25.f / X0_ar, tol);
+    EXPECT_NEAR(integral.mass / (25.f * (rho_fe + rho_ar)), 1.f, tol);
+
+    const auto avg = integral.average_material();
+    EXPECT_NEAR(avg.X0() / integral.path, 1.f / integral.path_in_x0, tol);
+    EXPECT_NEAR(avg.mass_density() / (0.5f * (rho_fe + rho_ar)), 1.f, tol);
+
+    // Diagonal step that also crosses the y bins
+    const vector3 diag{vector::normalize(vector3{1.f, 1.f, 0.f})};
+    const point3 diag_pos{55.f, -2.f, 0.f};
+    integral = integrate_material(cuboid_map, trf, diag_pos, diag, 20.f);
+
+    EXPECT_NEAR(integral.path, 20.f, tol);
+    // Two x-bins and one crossing of y = 0
+    EXPECT_EQ(integral.n_bins, 3u);
+
+    // Step perpendicular to the layers stays in one bin
+    integral =
+        integrate_material(cuboid_map, trf, pos, vector3{0.f, 0.f, 1.f}, 40.f);
+
+    EXPECT_EQ(integral.n_bins, 1u);
+    EXPECT_NEAR(integral.path_in_x0, 40.f / X0_fe, tol);
+    EXPECT_NEAR(integral.average_material().X0(), X0_fe, tol);
+}
+
+/// Unittest: Integrate the material of a cylinder shaped volume material map
+GTEST_TEST(detray_material, cylinder3D_map_integral) {
+
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    constexpr scalar tol{1e-3f};
+
+    // Radial layers of iron and vacuum, 10mm each, and four phi sectors
+    constexpr scalar pi{constant<scalar>::pi};
+    mask<cylinder3D, test_algebra> cyl{0u,    0.f, -pi,   -100.f,
+                                       100.f, pi,  100.f};
+    auto cyl_map = mat_map_factory.new_grid(cyl, {10u, 4u, 1u});
+
+    static_assert(concepts::volume_material<decltype(cyl_map)>);
+
+    using loc_bin_t = typename decltype(cyl_map)::loc_bin_index;
+    for (dindex i = 0u; i < 10u; ++i) {
+        for (dindex j = 0u; j < 4u; ++j) {
+            const material<scalar> mat =
+                (i % 2u == 0u) ? material<scalar>(iron<scalar>{})
+                               : material<scalar>(vacuum<scalar>{});
+            cyl_map.template populate<replace<>>(
+                loc_bin_t{i, j, 0u}, material_t(mat, 1.f * unit<scalar>::mm));
+        }
+    }
+
+    const scalar X0_fe{iron<scalar>{}.X0()};
+    const scalar rho_fe{iron<scalar>{}.mass_density()};
+
+    const transform3 trf{};
+
+    // Radial step inside a phi sector
+    const vector3 dir{vector::normalize(vector3{1.f, 1.f, 0.f})};
+    const point3 pos = 5.f * dir;
+
+    auto integral = integrate_material(cyl_map, trf, pos, dir, 50.f);
+
+    EXPECT_EQ(integral.n_bins, 6u);
+    EXPECT_NEAR(integral.path, 50.f, tol);
+    // Only the iron layers contribute
+    EXPECT_NEAR(integral.path_in_x0, 25.f / X0_fe, tol);
+
+    const auto avg = integral.average_material();
+    EXPECT_NEAR(avg.X0() / X0_fe, 2.f, tol);
+    EXPECT_NEAR(avg.mass_density() / rho_fe, 0.5f, tol);
+    EXPECT_NEAR(avg.Z(), iron<scalar>{}.Z(), tol);
+
+    // Chord through one radial layer that crosses the phi = 0 boundary
+    const point3 chord_pos{45.f, -20.f, 0.f};
+    integral = integrate_material(cyl_map, trf, chord_pos,
+                                  vector3{0.f, 1.f, 0.f}, 40.f);
+
+    EXPECT_EQ(integral.n_bins, 2u);
+    EXPECT_NEAR(integral.path_in_x0, 40.f / X0_fe, tol);
+
+    // Step from the axis through the first vacuum layer
+    integral = integrate_material(cyl_map, trf, point3{0.f, 0.f, 12.f},
+                                  vector3{1.f, 0.f, 0.f}, 25.f);
+    EXPECT_EQ(integral.n_bins, 3u);
+    EXPECT_NEAR(integral.path_in_x0, 15.f / X0_fe, tol);
+}
+
+/// Unittest: Integrate a volume material map along steps outside of its span
+GTEST_TEST(detray_material, map_integral_out_of_span) {
+
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    constexpr scalar tol{1e-3f};
+
+    mask<cuboid3D, test_algebra> cuboid{0u,   -50.f, -50.f, -50.f,
+                                        50.f, 50.f,  50.f};
+    auto cuboid_map = mat_map_factory.new_grid(cuboid, {10u, 1u, 1u});
+
+    using loc_bin_t = typename decltype(cuboid_map)::loc_bin_index;
+    for (dindex i = 0u; i < 10u; ++i) {
+        cuboid_map.template populate<replace<>>(
+            loc_bin_t{i, 0u, 0u},
+            material_t(iron<scalar>{}, 1.f * unit<scalar>::mm));
+    }
+
+    const scalar X0_fe{iron<scalar>{}.X0()};
+    const transform3 trf{};
+
+    // Step away from the map: Stays in the closest bin
+    auto integral =
+        integrate_material(cuboid_map, trf, point3{-100.f, 0.f, 0.f},
+                           vector3{-1.f, 0.f, 0.f}, 1000.f);
+    EXPECT_EQ(integral.n_bins, 1u);
+    EXPECT_NEAR(integral.path, 1000.f, tol);
+
+    // Step through the whole map: Every bin is visited once
+    integral = integrate_material(cuboid_map, trf, point3{-100.f, 0.f, 0.f},
+                                  vector3{1.f, 0.f, 0.f}, 300.f);
+    EXPECT_EQ(integral.n_bins, 10u);
+    EXPECT_NEAR(integral.path, 300.f, tol);
+    EXPECT_NEAR(integral.path_in_x0, 300.f / X0_fe, tol);
+
+    // Step outside of the map, parallel to its surface
+    integral = integrate_material(cuboid_map, trf, point3{-5.f, 80.f, 0.f},
+                                  vector3{1.f, 0.f, 0.f}, 10.f);
+    EXPECT_EQ(integral.n_bins, 2u);
+    EXPECT_NEAR(integral.path, 10.f, tol);
+
+    // The number of visited bins is limited
+    integral = integrate_material(cuboid_map, trf, point3{-100.f, 0.f, 0.f},
+                                  vector3{1.f, 0.f, 0.f}, 300.f, 3u);
+    EXPECT_EQ(integral.n_bins, 4u);
+    EXPECT_NEAR(integral.path, 300.f, tol);
+
+    // Cylinder: Step outside of the radial span crosses the phi sectors
+    constexpr scalar pi{constant<scalar>::pi};
+    mask<cylinder3D, test_algebra> cyl{0u,   10.f, -pi, -100.f,
+                                       50.f, pi,   100.f};
+    auto cyl_map = mat_map_factory.new_grid(cyl, {4u, 4u, 1u});
+
+    using cyl_bin_t = typename decltype(cyl_map)::loc_bin_index;
+    for (dindex i = 0u; i < 4u; ++i) {
+        for (dindex j = 0u; j < 4u; ++j) {
+            cyl_map.template populate<replace<>>(
+                cyl_bin_t{i, j, 0u},
+                material_t(iron<scalar>{}, 1.f * unit<scalar>::mm));
+        }
+    }
+
+    integral = integrate_material(cyl_map, trf, point3{100.f, -200.f, 0.f},
+                                  vector3{0.f, 1.f, 0.f}, 400.f);
+    EXPECT_EQ(integral.n_bins, 2u);
+    EXPECT_NEAR(integral.path, 400.f, tol);
+    EXPECT_NEAR(integral.path_in_x0, 400.f / X0_fe, tol);
+}
@@ -0,0 +1,249 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/navigation/batched_navigator.hpp"
+
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+/// Compare the batched navigation against the scalar navigator lane by lane
+GTEST_TEST(detray_navigation, batched_navigator_toy_geometry) {
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using batched_navigator_t = batched_navigator<navigator_t, 4u>;
+    using stepper_t = line_stepper<test_algebra>;
+    using track_t = free_track_parameters<test_algebra>;
+
+    constexpr std::size_t n_lanes{batched_navigator_t::size()};
+    static_assert(n_lanes == 4u);
+
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = {3u, 3u};
+    stepping::config step_cfg{};
+
+    // One track per lane in different directions
+    const point3 pos{0.f, 0.f, 0.f};
+    std::vector<track_t> tracks{};
+    tracks.emplace_back(pos, 0.f, vector3{1.f, 1.f, 0.f}, -1.f);
+    tracks.emplace_back(pos, 0.f, vector3{1.f, 0.f, 0.5f}, -1.f);
+    tracks.emplace_back(pos, 0.f, vector3{0.f, 1.f, -0.5f}, -1.f);
+    tracks.emplace_back(pos, 0.f, vector3{-1.f, 1.f, 2.f}, -1.f);
+
+    stepper_t stepper;
+    navigator_t nav;
+    batched_navigator_t batch_nav;
+
+    // Scalar reference and batched states
+    std::vector<navigator_t::state> ref_states{};
+    std::vector<stepper_t::state> ref_stepping{};
+    std::vector<stepper_t::state> batch_stepping{};
+    for (const auto &trk : tracks) {
+        ref_states.emplace_back(toy_det);
+        ref_stepping.emplace_back(trk);
+        batch_stepping.emplace_back(trk);
+    }
+    batched_navigator_t::state batch_state(toy_det);
+
+    // No lane is active before the initialization
+    ASSERT_FALSE(batch_state.is_alive());
+    ASSERT_EQ(batch_state.n_active(), 0u);
+
+    for (std::size_t i = 0u; i < n_lanes; ++i) {
+        nav.init(ref_stepping[i](), ref_states[i], nav_cfg);
+    }
+    batch_nav.init(tracks, batch_state, nav_cfg);
+
+    ASSERT_TRUE(batch_state.is_alive());
+    ASSERT_EQ(batch_state.n_active(), n_lanes);
+
+    // Step all tracks through the detector and compare lane by lane
+    std::vector<track_t> batch_tracks(tracks);
+    for (std::size_t n_steps = 0u; n_steps < 50u; ++n_steps) {
+
+        for (std::size_t i = 0u; i < n_lanes; ++i) {
+            auto &ref_nav = ref_states[i];
+            const auto &lane_nav = batch_state[i];
+
+            ASSERT_EQ(ref_nav.is_alive(), lane_nav.is_alive());
+            ASSERT_EQ(ref_nav.is_alive(), batch_state.is_active(i));
+            if (!ref_nav.is_alive()) {
+                ASSERT_EQ(batch_state.distances()[i], scalar{0.f});
+                continue;
+            }
+
+            ASSERT_EQ(ref_nav.status(), lane_nav.status());
+            ASSERT_EQ(ref_nav.volume(), lane_nav.volume());
+            ASSERT_EQ(ref_nav.n_candidates(), lane_nav.n_candidates());
+            ASSERT_EQ(ref_nav.next_surface().barcode(),
+                      lane_nav.next_surface().barcode());
+            ASSERT_EQ(ref_nav(), batch_state.distances()[i]);
+
+            // Reference step
+            stepper.step(ref_nav(), ref_stepping[i], step_cfg);
+            ref_nav.set_high_trust();
+            nav.update(ref_stepping[i](), ref_nav, nav_cfg);
+
+            // Batched step
+            stepper.step(batch_state.distances()[i], batch_stepping[i],
+                         step_cfg);
+            batch_state[i].set_high_trust();
+            batch_tracks[i] = batch_stepping[i]();
+        }
+
+        if (!batch_state.is_alive()) {
+            break;
+        }
+        batch_nav.update(batch_tracks, batch_state, nav_cfg);
+    }
+
+    // Deactivate a lane by hand and check the lane mask bookkeeping
+    batch_state.activate(0u);
+    ASSERT_TRUE(batch_state.is_active(0u));
+    batch_state.deactivate(0u);
+    ASSERT_FALSE(batch_state.is_active(0u));
+}
+
+/// Compare the initialization of a track bundle against the scalar navigator
+GTEST_TEST(detray_navigation, batched_navigator_bundle) {
+
+    using test_algebra = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using batched_navigator_t = batched_navigator<navigator_t, 4u>;
+    using stepper_t = line_stepper<test_algebra>;
+    using track_t = free_track_parameters<test_algebra>;
+
+    constexpr std::size_t n_lanes{batched_navigator_t::size()};
+
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = {3u, 3u};
+
+    // Collimated tracks from the same point
+    const point3 pos{0.f, 0.f, 0.f};
+    std::vector<track_t> tracks{};
+    tracks.emplace_back(pos, 0.f, vector3{1.f, 0.f, 0.1f}, -1.f);
+    tracks.emplace_back(pos, 0.f, vector3{1.f, 0.01f, 0.1f}, -1.f);
+    tracks.emplace_back(pos, 0.f, vector3{1.f, -0.01f, 0.11f}, -1.f);
+    tracks.emplace_back(pos, 0.f, vector3{1.f, 0.02f, 0.09f}, -1.f);
+
+    navigator_t nav;
+    batched_navigator_t batch_nav;
+
+    // The neighborhood of the bundle is not empty and fits the buffer
+    typename navigator_t::bundle_neighborhood neighborhood{};
+    nav.collect_neighborhood(tracks[0], navigator_t::state{toy_det}, nav_cfg,
+                             {}, neighborhood);
+    ASSERT_GT(neighborhood.size, 0u);
+    ASSERT_FALSE(neighborhood.overflow);
+
+    batched_navigator_t::state batch_state(toy_det);
+    batch_nav.init_bundle(tracks, batch_state, nav_cfg);
+
+    ASSERT_EQ(batch_state.n_active(), n_lanes);
+
+    for (std::size_t i = 0u; i < n_lanes; ++i) {
+        navigator_t::state ref_nav(toy_det);
+        nav.init(tracks[i], ref_nav, nav_cfg);
+
+        const auto &lane_nav = batch_state[i];
+
+        ASSERT_EQ(ref_nav.is_alive(), lane_nav.is_alive());
+        ASSERT_EQ(ref_nav.status(), lane_nav.status());
+        ASSERT_EQ(ref_nav.n_candidates(), lane_nav.n_candidates());
+        ASSERT_EQ(ref_nav.next_surface().barcode(),
+                  lane_nav.next_surface().barcode());
+        ASSERT_EQ(ref_nav(), batch_state.distances()[i]);
+    }
+    EXPECT_TRUE(batch_state.is_bundle());
+    const dindex start_volume{batch_state.neighborhood().volume};
+
+    // Step the bundle through the detector: The lanes share the look-ups of
+    // the volumes they enter and reach the same surfaces as the scalar
+    // navigator
+    stepper_t stepper;
+    stepping::config step_cfg{};
+
+    std::vector<navigator_t::state> ref_states{};
+    std::vector<stepper_t::state> ref_stepping{};
+    std::vector<stepper_t::state> batch_stepping{};
+    for (const auto &trk : tracks) {
+        ref_states.emplace_back(toy_det);
+        ref_stepping.emplace_back(trk);
+        batch_stepping.emplace_back(trk);
+    }
+    for (std::size_t i = 0u; i < n_lanes; ++i) {
+        nav.init(ref_stepping[i](), ref_states[i], nav_cfg);
+    }
+
+    std::vector<track_t> batch_tracks(tracks);
+    for (std::size_t n_steps = 0u; n_steps < 50u; ++n_steps) {
+
+        for (std::size_t i = 0u; i < n_lanes; ++i) {
+            auto &ref_nav = ref_states[i];
+            const auto &lane_nav = batch_state[i];
+
+            ASSERT_EQ(ref_nav.is_alive(), lane_nav.is_alive());
+            if (!ref_nav.is_alive()) {
+                continue;
+            }
+
+            ASSERT_EQ(ref_nav.volume(), lane_nav.volume());
+            ASSERT_EQ(ref_nav.next_surface().barcode(),
+                      lane_nav.next_surface().barcode());
+            ASSERT_NEAR(ref_nav(), batch_state.distances()[i], 1e-4f);
+
+            stepper.step(ref_nav(), ref_stepping[i], step_cfg);
+            ref_nav.set_high_trust();
+            nav.update(ref_stepping[i](), ref_nav, nav_cfg);
+
+            stepper.step(batch_state.distances()[i], batch_stepping[i],
+                         step_cfg);
+            batch_state[i].set_high_trust();
+            batch_tracks[i] = batch_stepping[i]();
+        }
+
+        if (!batch_state.is_alive()) {
+            break;
+        }
+        batch_nav.update(batch_tracks, batch_state, nav_cfg);
+    }
+
+    // The bundle left the start volume and shared the later look-ups
+    EXPECT_NE(batch_state.neighborhood().volume, start_volume);
+}
@@ -0,0 +1,198 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+
+#include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/tracks/ray.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+
+using surface_t = surface_descriptor<>;
+using bvh_t = bvh_collection<test_algebra, surface_t>;
+using box_t = typename bvh_t::box_type;
+
+/// Irregularly placed modules in a disc-like volume
+struct test_modules {
+    std::vector<surface_t> surfaces{};
+    std::vector<transform3> transforms{};
+    std::vector<mask<rectangle2D, test_algebra>> masks{};
+    std::vector<box_t> boxes{};
+
+    explicit test_modules(const dindex n_modules) {
+        for (dindex i = 0u; i < n_modules; ++i) {
+            // Spiral with varying distance along z
+            const auto s{static_cast<scalar>(i)};
+            const point3 t{(10.f + 2.f * s) * math::cos(0.7f * s),
+                           (10.f + 2.f * s) * math::sin(0.7f * s),
+                           100.f + static_cast<scalar>(i % 3u) * 5.f};
+
+            surface_t sf{};
+            sf.set_index(i);
+            surfaces.push_back(sf);
+            transforms.emplace_back(t);
+            masks.emplace_back(0u, 3.f, 5.f);
+
+            boxes.push_back(box_t{masks.back(), i, 0.01f}.transform(
+                transforms.back()));
+        }
+    }
+};
+
+}  // anonymous namespace
+
+/// Test the construction of the trees
+GTEST_TEST(detray_navigation, bvh_collection) {
+
+    const test_modules modules1{50u};
+    const test_modules modules2{3u};
+
+    bvh_t bvh_coll(&host_mr);
+    ASSERT_TRUE(bvh_coll.empty());
+
+    bvh_coll.push_back(modules1.surfaces, modules1.boxes);
+    EXPECT_EQ(bvh_coll.size(), 1u);
+    bvh_coll.push_back(modules2.surfaces, modules2.boxes, 4u);
+    EXPECT_EQ(bvh_coll.size(), 2u);
+    // Empty volume
+    bvh_coll.push_back(std::vector<surface_t>{}, std::vector<box_t>{});
+    EXPECT_EQ(bvh_coll.size(), 3u);
+
+    ASSERT_EQ(bvh_coll.all().size(), 53u);
+    EXPECT_EQ(bvh_coll[0].all().size(), 50u);
+    EXPECT_EQ(bvh_coll[1].all().size(), 3u);
+    EXPECT_EQ(bvh_coll[2].all().size(), 0u);
+
+    // Small volume: Only the root node
+    EXPECT_EQ(bvh_coll[1].nodes().size(), 1u);
+    EXPECT_EQ(bvh_coll[2].nodes().size(), 0u);
+
+    // Every surface is contained in exactly one leaf, which is enclosed by
+    // all of its parent nodes
+    const auto nodes = bvh_coll[0].nodes();
+    ASSERT_EQ(nodes.size() % 2u, 1u);
+
+    std::set<dindex> sf_indices{};
+    dindex n_leaves{0u};
+    for (const auto& n : nodes) {
+        if (n.is_leaf()) {
+            ++n_leaves;
+            EXPECT_LE(n.n_surfaces, 4u);
+            for (dindex i = n.first; i < n.first + n.n_surfaces; ++i) {
+                const dindex sf_idx{bvh_coll[0].at(i).index()};
+                sf_indices.insert(sf_idx);
+
+                const box_t& box = modules1.boxes[sf_idx];
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    EXPECT_LE(n.box[j], box[j]);
+                    EXPECT_GE(n.box[j + 3u], box[j + 3u]);
+                }
+            }
+        } else {
+            for (const dindex c : {n.first, n.first + 1u}) {
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    EXPECT_LE(n.box[j], nodes[c].box[j]);
+                    EXPECT_GE(n.box[j + 3u], nodes[c].box[j + 3u]);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(sf_indices.size(), 50u);
+    EXPECT_EQ(2u * n_leaves - 1u, nodes.size());
+
+    // Invalid input
+    EXPECT_THROW(bvh_coll.push_back(modules1.surfaces, modules2.boxes),
+                 std::invalid_argument);
+    EXPECT_THROW(bvh_coll.push_back(modules1.surfaces, modules1.boxes, 0u),
+                 std::invalid_argument);
+    EXPECT_EQ(bvh_coll.size(), 3u);
+}
+
+/// Compare the BVH search to a brute force search
+GTEST_TEST(detray_navigation, bvh_search) {
+
+    const test_modules modules{100u};
+
+    bvh_t bvh_coll(&host_mr);
+    bvh_coll.push_back(modules.surfaces, modules.boxes, 2u);
+
+    // Device-side access
+    auto view = bvh_coll.get_data();
+    const bvh_collection<test_algebra, surface_t, device_container_types>
+        device_coll{view};
+    ASSERT_EQ(device_coll.size(), 1u);
+
+    ray_intersector<rectangle2D, test_algebra, true> pi;
+
+    for (unsigned int i = 0u; i < 8u; ++i) {
+        // Rays from the origin in different directions
+        const auto s{static_cast<scalar>(i)};
+        const vector3 dir{vector::normalize(vector3{
+            0.05f * s * math::cos(s), 0.05f * s * math::sin(s), 1.f})};
+        const detail::ray<test_algebra> r(point3{0.f, 0.f, 0.f}, 0.f, dir,
+                                          0.f);
+
+        std::set<dindex> candidates{};
+        for (const auto& sf : bvh_coll[0].search(r)) {
+            EXPECT_TRUE(candidates.insert(sf.index()).second);
+        }
+        std::set<dindex> device_candidates{};
+        for (const auto& sf : device_coll[0].search(r)) {
+            device_candidates.insert(sf.index());
+        }
+        EXPECT_EQ(candidates, device_candidates);
+
+        // Fewer candidates than surfaces
+        EXPECT_LT(candidates.size(), modules.surfaces.size());
+
+        // All surfaces that are hit by the ray are candidates
+        for (const auto& sf : modules.surfaces) {
+            const auto hit = pi(r, sf, modules.masks[sf.index()],
+                                modules.transforms[sf.index()]);
+            if (hit.status) {
+                EXPECT_TRUE(candidates.contains(sf.index()))
+                    << "Missing surface " << sf.index();
+            }
+        }
+    }
+
+    // Ray that misses the volume
+    const detail::ray<test_algebra> r(point3{0.f, 0.f, 0.f}, 0.f,
+                                      vector3{1.f, 0.f, 0.f}, 0.f);
+    const auto search_range = bvh_coll[0].search(r);
+    EXPECT_TRUE(search_range.begin() == search_range.end());
+}
@@ -0,0 +1,130 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/navigation/counting_inspector.hpp"
+
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace detray;
+
+/// Aggregate the navigation counters of many tracks in a global buffer
+GTEST_TEST(detray_navigation, counting_inspector) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using inspector_t = navigation::counting_inspector;
+    using navigator_t =
+        navigator<detector_t, navigation::default_cache_size, inspector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+    using counter = navigation::counter;
+    using counter_t = inspector_t::counter_type;
+
+    const typename detector_t::geometry_context gctx{};
+
+    std::vector<track_t> tracks{};
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<counter_t>(tracks.size())};
+
+    propagation::config prop_cfg{};
+    propagator_t prop{prop_cfg};
+
+    // Global counters, filled from several threads
+    vecmem::vector<counter_t> counters(inspector_t::n_counters, 0u, &host_mr);
+    auto counter_view = vecmem::get_data(counters);
+
+    // Reference: sum of the local counts
+    constexpr std::size_t n_threads{4u};
+    std::vector<std::vector<counter_t>> local_sums(
+        n_threads, std::vector<counter_t>(inspector_t::n_counters, 0u));
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0u; t < n_threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (std::size_t i = t; i < tracks.size(); i += n_threads) {
+                typename propagator_t::state propagation(tracks[i], toy_det,
+                                                         counter_view, gctx);
+                ASSERT_TRUE(prop.propagate(propagation));
+
+                const auto &insp = propagation._navigation.inspector();
+                for (unsigned int c = 0u; c < inspector_t::n_counters; ++c) {
+                    const auto n{static_cast<counter_t>(
+                        insp.count(static_cast<counter>(c)))};
+                    local_sums[t][c] =
+                        c == static_cast<unsigned int>(
+                                 counter::e_max_cached_candidates)
+                            ? std::max(local_sums[t][c], n)
+                            : local_sums[t][c] + n;
+                }
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+
+    auto get = [&counters](const counter c) {
+        return counters[static_cast<unsigned int>(c)];
+    };
+
+    EXPECT_EQ(get(counter::e_tracks), n_tracks);
+    EXPECT_EQ(get(counter::e_exit), n_tracks);
+    EXPECT_EQ(get(counter::e_abort), 0u);
+    EXPECT_GE(get(counter::e_init), n_tracks);
+    EXPECT_EQ(get(counter::e_reinit), get(counter::e_init) - n_tracks);
+    EXPECT_GT(get(counter::e_update_high_trust) +
+                  get(counter::e_update_fair_trust),
+              0u);
+    EXPECT_GT(get(counter::e_on_module), 0u);
+    EXPECT_GT(get(counter::e_on_portal), 0u);
+    EXPECT_GT(get(counter::e_cached_candidates), 0u);
+    EXPECT_LE(get(counter::e_max_cached_candidates),
+              navigation::default_cache_size);
+
+    // The atomic aggregation matches the local counts
+    for (unsigned int c = 0u; c < inspector_t::n_counters; ++c) {
+        counter_t expected{0u};
+        for (const auto &sums : local_sums) {
+            expected = c == static_cast<unsigned int>(
+                                counter::e_max_cached_candidates)
+                           ? std::max(expected, sums[c])
+                           : expected + sums[c];
+        }
+        EXPECT_EQ(counters[c], expected) << "counter " << c;
+    }
+}
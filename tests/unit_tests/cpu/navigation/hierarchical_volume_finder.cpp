@@ -0,0 +1,128 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/hierarchical_volume_finder.hpp"
+
+#include "detray/builders/volume_finder_builder.hpp"
+#include "detray/definitions/units.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <limits>
+#include <stdexcept>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+
+using finder_t = hierarchical_volume_finder<test_algebra>;
+using extent_t = typename finder_t::extent_type;
+
+constexpr scalar pi{constant<scalar>::pi};
+
+}  // anonymous namespace
+
+/// Test the volume search in a simple layout of concentric volumes
+GTEST_TEST(detray_navigation, hierarchical_volume_finder) {
+
+    finder_t vol_finder(&host_mr);
+    ASSERT_TRUE(vol_finder.empty());
+
+    // Inner cylinder and two outer volumes, split in z
+    vol_finder.push_back(extent_t{0u, 0.f, -pi, -100.f, 10.f, pi, 100.f});
+    vol_finder.push_back(extent_t{2u, 10.f, -pi, 0.f, 50.f, pi, 100.f});
+    vol_finder.push_back(extent_t{1u, 10.f, -pi, -100.f, 50.f, pi, 0.f});
+    vol_finder.build({6u, 4u, 4u});
+
+    EXPECT_EQ(vol_finder.size(), 96u);
+    EXPECT_EQ(vol_finder.extents().size(), 3u);
+    EXPECT_LE(vol_finder.max_candidates(), 3u);
+
+    EXPECT_EQ(vol_finder.search(point3{1.f, 1.f, 0.f}), 0u);
+    EXPECT_EQ(vol_finder.search(point3{0.f, -20.f, -50.f}), 1u);
+    EXPECT_EQ(vol_finder.search(point3{-30.f, 0.f, 50.f}), 2u);
+
+    // Only the volumes that overlap with the cell are candidates
+    EXPECT_EQ(vol_finder.candidates(point3{0.f, 0.f, -90.f}).size(), 1u);
+    EXPECT_EQ(vol_finder.candidates(point3{45.f, 0.f, 60.f}).size(), 1u);
+    EXPECT_EQ(vol_finder.candidates(point3{45.f, 0.f, 10.f}).size(), 2u);
+
+    // Outside of all volumes
+    EXPECT_EQ(vol_finder.search(point3{60.f, 0.f, 0.f}), dindex_invalid);
+    EXPECT_EQ(vol_finder.search(point3{0.f, 0.f, 200.f}), dindex_invalid);
+    EXPECT_TRUE(vol_finder.candidates(point3{0.f, 0.f, 200.f}).empty());
+
+    // Device-side access
+    auto view = vol_finder.get_data();
+    const hierarchical_volume_finder<test_algebra, device_container_types>
+        device_finder{view};
+    EXPECT_EQ(device_finder.size(), 96u);
+    EXPECT_EQ(device_finder.search(point3{0.f, -20.f, -50.f}), 1u);
+
+    // Invalid input
+    EXPECT_THROW(vol_finder.push_back(extent_t{}), std::invalid_argument);
+    EXPECT_THROW(vol_finder.build({0u, 1u, 1u}), std::invalid_argument);
+}
+
+/// Compare the search in the toy detector to a brute force search
+GTEST_TEST(detray_navigation, hierarchical_volume_finder_toy) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    const auto vol_finder =
+        build_volume_finder(toy_det, {20u, 1u, 40u}, host_mr);
+
+    ASSERT_FALSE(vol_finder.empty());
+    EXPECT_EQ(vol_finder.extents().size(), toy_det.volumes().size());
+    EXPECT_LT(vol_finder.max_candidates(), toy_det.volumes().size());
+
+    std::size_t n_found{0u};
+    for (unsigned int i = 0u; i < 50u; ++i) {
+        for (unsigned int j = 0u; j < 100u; ++j) {
+            const scalar r{4.f * static_cast<scalar>(i)};
+            const scalar z{-1000.f + 20.f * static_cast<scalar>(j)};
+            const point3 p{r * math::cos(0.1f * z), r * math::sin(0.1f * z),
+                           z};
+
+            // The first volume whose extent contains the point
+            dindex expected{dindex_invalid};
+            const point3 loc_p{vector::perp(p), vector::phi(p), p[2]};
+            for (const auto &ext : vol_finder.extents()) {
+                if (ext.is_inside(loc_p,
+                                  std::numeric_limits<scalar>::epsilon())) {
+                    expected = ext.volume_link();
+                    break;
+                }
+            }
+
+            const dindex vol_idx{vol_finder.search(p)};
+            EXPECT_EQ(vol_idx, expected) << p[0] << ", " << p[1] << ", " << z;
+            n_found += (vol_idx != dindex_invalid);
+        }
+    }
+    EXPECT_GT(n_found, 0u);
+}
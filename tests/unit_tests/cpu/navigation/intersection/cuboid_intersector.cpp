@@ -54,3 +54,23 @@ GTEST_TEST(detray_intersection, cuboid_aabb_intersector) {
 
     ASSERT_TRUE(aabb.intersect(r));
 }
+
+// The slab test has to check every axis: The ray overlaps the box in x and y,
+// but passes it in z
+GTEST_TEST(detray_intersection, cuboid_aabb_intersector_z_slab) {
+
+    mask<cuboid3D, test_algebra> c3{0u,    x_min, y_min, z_min,
+                                    x_max, y_max, z_max};
+    axis_aligned_bounding_volume<cuboid3D, test_algebra> aabb{c3, 0u, envelope};
+
+    // Inside the x and y slabs for t in [1, 3], inside the z slab from t = 20
+    const vector3 dir{1.f, 0.f, 0.1f};
+    const detail::ray<test_algebra> miss(point3{0.f, 1.f, 0.f}, 0.f, dir,
+                                         0.f);
+    EXPECT_FALSE(aabb.intersect(miss));
+
+    // Same direction, shifted into the z slab
+    const detail::ray<test_algebra> hit(point3{0.f, 1.f, 2.5f}, 0.f, dir,
+                                        0.f);
+    EXPECT_TRUE(aabb.intersect(hit));
+}
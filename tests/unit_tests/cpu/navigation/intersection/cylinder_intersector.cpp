@@ -10,6 +10,7 @@
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/concentric_cylinder2D.hpp"
 #include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/navigation/intersection/fast_ray_intersector.hpp"
 #include "detray/navigation/intersection/ray_concentric_cylinder_intersector.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/tracks/ray.hpp"
@@ -179,3 +180,170 @@ GTEST_TEST(detray_intersection, concentric_cylinders) {
     EXPECT_NEAR(hits_cylinrical[1].local[0], hit_cocylindrical.local[0], tol);
     EXPECT_NEAR(hits_cylinrical[1].local[1], hit_cocylindrical.local[1], tol);
 }
+
+// This checks the intersections with approximate local phi against those
+// obtained from the exact cylinder intersectors.
+GTEST_TEST(detray_intersection, fast_cylinder) {
+    // Create a translated cylinder
+    const transform3_t shifted(vector3{3.f, 2.f, 10.f});
+    const transform3_t identity{};
+    mask<cylinder2D, test_algebra, std::uint_least16_t> cylinder{0u, r, -hz,
+                                                                 hz};
+
+    ray_intersector<cylinder2D, test_algebra, true> ci;
+    ray_intersector<concentric_cylinder2D, test_algebra, true> cpi;
+    fast_ray_intersector<cylinder2D, test_algebra, true> fci;
+    fast_ray_intersector<concentric_cylinder2D, test_algebra, true> fcpi;
+
+    // Rays in different directions
+    for (int i = 0; i < 36; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 10.f * unit<scalar>::degree};
+        const point3 ori = {3.f, 2.f, 5.f};
+        const point3 dir =
+            vector::normalize(vector3{math::cos(phi), math::sin(phi), 0.1f});
+        const ray_t ray(ori, 0.f, dir, 0.f);
+
+        const darray<scalar, 2u> mask_tol{tol, tol};
+
+        const auto hits = ci(ray, surface_descriptor<>{}, cylinder, shifted,
+                             mask_tol, 0.f, -not_defined);
+        const auto fast_hits = fci(ray, surface_descriptor<>{}, cylinder,
+                                   shifted, mask_tol, 0.f, -not_defined);
+
+        for (std::size_t j = 0u; j < 2u; ++j) {
+            ASSERT_EQ(hits[j].status, fast_hits[j].status);
+            ASSERT_EQ(hits[j].direction, fast_hits[j].direction);
+            EXPECT_EQ(hits[j].path, fast_hits[j].path);
+            // r * phi
+            EXPECT_NEAR(hits[j].local[0], fast_hits[j].local[0], r * 2e-6f);
+            EXPECT_EQ(hits[j].local[1], fast_hits[j].local[1]);
+        }
+
+        // Portal intersection from inside the concentric cylinder
+        const ray_t portal_ray({1.f, 0.5f, 1.f}, 0.f, dir, 0.f);
+        const auto hit = cpi(portal_ray, surface_descriptor<>{}, cylinder,
+                             identity, mask_tol, 0.f, 0.f);
+        const auto fast_hit = fcpi(portal_ray, surface_descriptor<>{},
+                                   cylinder, identity, mask_tol, 0.f, 0.f);
+        ASSERT_EQ(hit.status, fast_hit.status);
+        EXPECT_EQ(hit.path, fast_hit.path);
+        EXPECT_NEAR(hit.local[0], fast_hit.local[0], r * 2e-6f);
+        EXPECT_EQ(hit.local[1], fast_hit.local[1]);
+    }
+}
+
+// This checks that the intersections without full local point (no phi
+// coordinate) give the same results as the ones with the full local point
+GTEST_TEST(detray_intersection, cylinder_check_only_local) {
+    using mask_t = mask<cylinder2D, test_algebra, std::uint_least16_t>;
+    using portal_mask_t =
+        mask<concentric_cylinder2D, test_algebra, std::uint_least16_t>;
+
+    static_assert(!mask_t::check_uses_phi);
+    static_assert(!portal_mask_t::check_uses_phi);
+
+    const transform3_t shifted(vector3{3.f, 2.f, 10.f});
+    const transform3_t identity{};
+    const mask_t cylinder{0u, r, -0.5f * hz, 0.5f * hz};
+    const portal_mask_t portal_cylinder{0u, r, -0.5f * hz, 0.5f * hz};
+
+    // The phi coordinate is not computed
+    const point3 glob_p{3.f, 6.f, 12.f};
+    const point3 loc_p = mask_t::to_local_frame(shifted, glob_p);
+    const point3 check_p = mask_t::to_local_frame<true>(shifted, glob_p);
+    EXPECT_NEAR(loc_p[0], r * constant<scalar>::pi_2, tol);
+    EXPECT_EQ(check_p[0], 0.f);
+    EXPECT_EQ(check_p[1], loc_p[1]);
+    EXPECT_EQ(check_p[2], loc_p[2]);
+
+    ray_intersector<cylinder2D, test_algebra, true> ci_debug;
+    ray_intersector<cylinder2D, test_algebra, false> ci;
+    ray_intersector<concentric_cylinder2D, test_algebra, true> cpi_debug;
+    ray_intersector<concentric_cylinder2D, test_algebra, false> cpi;
+
+    // Rays in different directions, some of which miss the mask
+    for (int i = 0; i < 36; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 10.f * unit<scalar>::degree};
+        const scalar dz{-1.f + static_cast<scalar>(i) / 18.f};
+        const vector3 dir =
+            vector::normalize(vector3{math::cos(phi), math::sin(phi), dz});
+
+        const ray_t ray({3.f, 2.f, 10.f}, 0.f, dir, 0.f);
+        const auto hits_debug = ci_debug(ray, surface_descriptor<>{},
+                                         cylinder, shifted, tol, -not_defined);
+        const auto hits = ci(ray, surface_descriptor<>{}, cylinder, shifted,
+                             tol, -not_defined);
+
+        for (std::size_t j = 0u; j < 2u; ++j) {
+            EXPECT_EQ(hits_debug[j].status, hits[j].status);
+            EXPECT_EQ(hits_debug[j].path, hits[j].path);
+        }
+
+        const ray_t portal_ray({0.f, 0.f, 0.f}, 0.f, dir, 0.f);
+        const auto hit_debug = cpi_debug(portal_ray, surface_descriptor<>{},
+                                         portal_cylinder, identity, tol);
+        const auto hit = cpi(portal_ray, surface_descriptor<>{},
+                             portal_cylinder, identity, tol);
+        EXPECT_EQ(hit_debug.status, hit.status);
+        EXPECT_EQ(hit_debug.path, hit.path);
+    }
+}
+
+// This checks that the portal intersector discards the portals that lie behind
+// the track in radial direction, unless they are within the overstepping
+// tolerance
+GTEST_TEST(detray_intersection, cylinder_portal_radial_direction) {
+    const transform3_t identity{};
+    const mask<concentric_cylinder2D, test_algebra, std::uint_least16_t>
+        inner_portal{0u, r, -hz, hz};
+
+    ray_intersector<cylinder2D, test_algebra, true> ci;
+    ray_intersector<concentric_cylinder2D, test_algebra, true> cpi;
+
+    const scalar overstep_tol{-0.1f};
+
+    // Outside of the inner portal, moving outwards: No intersection
+    const vector3 out_dir = vector::normalize(vector3{1.f, 0.5f, 0.2f});
+    ray_t ray({5.f, 0.f, 0.f}, 0.f, out_dir, 0.f);
+    auto hit = cpi(ray, surface_descriptor<>{}, inner_portal, identity, tol,
+                   overstep_tol);
+    EXPECT_FALSE(hit.status);
+
+    // Moving inwards: Hits the inner portal in front of the track
+    const vector3 in_dir = vector::normalize(vector3{-1.f, 0.f, 0.2f});
+    ray = ray_t({5.f, 0.f, 0.f}, 0.f, in_dir, 0.f);
+    hit = cpi(ray, surface_descriptor<>{}, inner_portal, identity, tol,
+              overstep_tol);
+    ASSERT_TRUE(hit.status);
+    EXPECT_TRUE(hit.direction);
+    EXPECT_NEAR(hit.path, math::sqrt(1.04f), tol);
+
+    // Just overstepped the portal, moving outwards: Still found
+    ray = ray_t({r + 0.01f, 0.f, 0.f}, 0.f, vector3{1.f, 0.f, 0.f}, 0.f);
+    hit = cpi(ray, surface_descriptor<>{}, inner_portal, identity, tol,
+              overstep_tol);
+    ASSERT_TRUE(hit.status);
+    EXPECT_FALSE(hit.direction);
+    EXPECT_NEAR(hit.path, -0.01f, tol);
+
+    // Compare with the general cylinder intersector for rays in all
+    // directions
+    for (int i = 0; i < 36; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 10.f * unit<scalar>::degree};
+        const scalar dz{-1.f + static_cast<scalar>(i) / 18.f};
+        const vector3 dir =
+            vector::normalize(vector3{math::cos(phi), math::sin(phi), dz});
+
+        ray = ray_t({5.f, 1.f, 0.f}, 0.f, dir, 0.f);
+        const auto hits = ci(ray, surface_descriptor<>{}, inner_portal,
+                             identity, tol, overstep_tol);
+        hit = cpi(ray, surface_descriptor<>{}, inner_portal, identity, tol,
+                  overstep_tol);
+
+        const auto& closest = hits[0].status ? hits[0] : hits[1];
+        EXPECT_EQ(hit.status, closest.status);
+        if (hit.status) {
+            EXPECT_NEAR(hit.path, closest.path, tol);
+        }
+    }
+}
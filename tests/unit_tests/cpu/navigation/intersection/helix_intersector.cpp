@@ -404,3 +404,61 @@ GTEST_TEST(detray_intersection, helix_line_intersector) {
     EXPECT_TRUE(is.status);
     EXPECT_FALSE(is.direction);
 }
+
+/// Check that the analytic initial guesses converge in few Newton iterations
+GTEST_TEST(detray_intersection, helix_intersector_iterations) {
+
+    iteration_histogram hist{};
+
+    // Intersectors with the fast path and with the safeguarded method only
+    helix_intersector<rectangle2D, test_algebra> hpi;
+    helix_intersector<cylinder2D, test_algebra> hci;
+    helix_intersector<rectangle2D, test_algebra> hpi_safe;
+    helix_intersector<cylinder2D, test_algebra> hci_safe;
+    hpi.histogram = &hist;
+    hci.histogram = &hist;
+    hpi_safe.max_n_fast_tries = 0u;
+    hci_safe.max_n_fast_tries = 0u;
+
+    const mask<rectangle2D, test_algebra> rectangle{0u, 10.f * unit<scalar>::cm,
+                                                    10.f * unit<scalar>::cm};
+    const mask<cylinder2D, test_algebra> cylinder{
+        0u, 4.f * unit<scalar>::cm, -10.f * unit<scalar>::cm,
+        10.f * unit<scalar>::cm};
+
+    for (unsigned int i = 1u; i <= 10u; ++i) {
+        const scalar s{static_cast<scalar>(i) * 2.f * unit<scalar>::cm};
+        // Both results are precise up to the convergence tolerance
+        const scalar conv_tol{hpi.convergence_tolerance};
+
+        // Plane normal to the track and cylinder parallel to the B-field
+        const transform3_t pl_trf(hlx(s), hlx.dir(s), z_axis);
+        const transform3_t cyl_trf(hlx(s), z_axis, hlx.dir(s));
+
+        const auto pl =
+            hpi(hlx, surface_descriptor<>{}, rectangle, pl_trf, tol);
+        const auto pl_safe =
+            hpi_safe(hlx, surface_descriptor<>{}, rectangle, pl_trf, tol);
+        ASSERT_TRUE(pl.status);
+        EXPECT_NEAR(pl.path, s, conv_tol);
+        EXPECT_NEAR(pl.path, pl_safe.path, conv_tol);
+
+        const auto cyl =
+            hci(hlx, surface_descriptor<>{}, cylinder, cyl_trf, tol);
+        const auto cyl_safe =
+            hci_safe(hlx, surface_descriptor<>{}, cylinder, cyl_trf, tol);
+        for (unsigned int j = 0u; j < 2u; ++j) {
+            ASSERT_EQ(cyl[j].status, cyl_safe[j].status);
+            EXPECT_NEAR(cyl[j].path, cyl_safe[j].path, conv_tol);
+        }
+    }
+
+    // One plane and two cylinder intersections per surface
+    ASSERT_EQ(hist.n_entries(), 30u);
+    EXPECT_EQ(hist.n_fallbacks(), 0u);
+    std::size_t n_fast{0u};
+    for (std::size_t n = 0u; n <= 3u; ++n) {
+        n_fast += hist.counts[n];
+    }
+    EXPECT_EQ(n_fast, hist.n_entries());
+}
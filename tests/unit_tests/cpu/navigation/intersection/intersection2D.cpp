@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2020-2024 CERN for the benefit of the ACTS project
+ * (c) 2020-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/geometry/detail/surface_descriptor.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/mask_tolerance.hpp"
 #include "detray/utils/invalid_values.hpp"
 
 // Detray test include(s)
@@ -88,3 +89,27 @@ GTEST_TEST(detray_intersection, intersection2D) {
     ASSERT_NEAR(intersections[1].path, 2.f, tol);
     ASSERT_TRUE(detail::is_invalid_value(intersections[2].path));
 }
+
+// This tests the path dependent mask tolerance
+GTEST_TEST(detray_intersection, path_mask_tolerance) {
+
+    const darray<scalar_t, 2u> mask_tol{1e-5f, 3.f};
+    const scalar_t scalor{5e-2f};
+
+    auto path_tol = [&mask_tol, scalor](const scalar_t path) {
+        return detail::path_mask_tolerance(mask_tol, scalor, path);
+    };
+
+    // Clamped to the minimal tolerance close to the surface
+    EXPECT_FLOAT_EQ(path_tol(0.f), mask_tol[0]);
+    // Scaled by the distance (in both directions)
+    EXPECT_FLOAT_EQ(path_tol(10.f), 0.5f);
+    EXPECT_FLOAT_EQ(path_tol(-10.f), 0.5f);
+    // Clamped to the maximal tolerance far away from the surface
+    EXPECT_FLOAT_EQ(path_tol(100.f), mask_tol[1]);
+
+    // Broadcast (trivial for a scalar type)
+    const auto bcast = detail::broadcast_mask_tolerance<scalar_t>(mask_tol);
+    EXPECT_FLOAT_EQ(bcast[0], mask_tol[0]);
+    EXPECT_FLOAT_EQ(bcast[1], mask_tol[1]);
+}
@@ -0,0 +1,255 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/landmark_cache.hpp"
+
+#include "detray/builders/landmark_cache_builder.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/inspectors.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <stdexcept>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = dpoint3D<test_algebra>;
+using vector3 = dvector3D<test_algebra>;
+
+/// @returns the barcodes of the surfaces that the @param track encounters in
+/// the detector @param det (straight line, if no field is passed)
+template <typename stepper_t, typename detector_t, typename landmark_cache_t,
+          typename... field_t>
+std::vector<geometry::barcode> trace(
+    const detector_t &det,
+    const free_track_parameters<test_algebra> &track,
+    const landmark_cache_t *cache, const field_t &...b_field) {
+
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test_algebra, false>;
+    using object_tracer_t =
+        navigation::object_tracer<intersection_t, dvector,
+                                  navigation::status::e_on_module,
+                                  navigation::status::e_on_portal>;
+    using navigator_t = navigator<detector_t, navigation::default_cache_size,
+                                  object_tracer_t, intersection_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagator_t p{propagation::config{}};
+    typename propagator_t::state propagation(
+        track, b_field..., det, typename detector_t::geometry_context{});
+    if (cache != nullptr) {
+        propagation._navigation.set_landmark_cache(*cache);
+    }
+    EXPECT_TRUE(p.propagate(propagation));
+
+    std::vector<geometry::barcode> barcodes{};
+    for (const auto &record : propagation._navigation.inspector().trace()) {
+        barcodes.push_back(record.intersection.sf_desc.barcode());
+    }
+    return barcodes;
+}
+
+}  // anonymous namespace
+
+/// Test the construction of the landmark cache in the toy detector
+GTEST_TEST(detray_navigation, landmark_cache) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    constexpr dindex n_eta_bins{10u};
+    constexpr dindex n_phi_bins{8u};
+    const point3 origin{0.f, 0.f, 0.f};
+    const scalar max_dist{1.f * unit<scalar>::mm};
+
+    auto cache = build_landmark_cache(toy_det, origin, max_dist, n_eta_bins,
+                                      n_phi_bins, 4.f, 0.f, 0.f, host_mr);
+
+    ASSERT_EQ(cache.size(), toy_det.volumes().size());
+
+    // Only the beampipe volume contains the landmark
+    const dindex start_vol{toy_det.volume(origin).index()};
+    for (dindex vol_idx = 0u; vol_idx < toy_det.volumes().size(); ++vol_idx) {
+        EXPECT_EQ(cache.contains(vol_idx), vol_idx == start_vol);
+    }
+    const vector3 dir{1.f, 0.f, 0.f};
+    EXPECT_TRUE(cache.applies(start_vol, point3{0.5f, 0.f, -0.5f}, dir,
+                              -1.f / unit<scalar>::GeV));
+    EXPECT_FALSE(cache.applies(start_vol, point3{2.f, 0.f, 0.f}, dir, 0.f));
+
+    // Count the surfaces of the start volume
+    std::size_t n_vol_surfaces{0u};
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        n_vol_surfaces += (sf_desc.volume() == start_vol);
+    }
+
+    // Forward directions do not see the portals of the negative endcap
+    const vector3 fwd{0.01f, 0.f, 1.f};
+    const auto fwd_cands = cache.candidates(start_vol, fwd);
+    EXPECT_LT(fwd_cands.size(), n_vol_surfaces);
+    for (const auto &cand : fwd_cands) {
+        EXPECT_EQ(cand.volume(), start_vol);
+    }
+    EXPECT_EQ(cache.eta_bin(fwd, n_eta_bins, 4.f), n_eta_bins - 1u);
+    EXPECT_EQ(cache.eta_bin(vector3{0.01f, 0.f, -1.f}, n_eta_bins, 4.f), 0u);
+
+    // Device-side access
+    auto view = cache.get_data();
+    const landmark_cache<test_algebra,
+                         typename decltype(toy_det)::surface_type,
+                         device_container_types>
+        device_cache{view};
+    EXPECT_EQ(device_cache.size(), cache.size());
+    EXPECT_EQ(device_cache.all().size(), cache.all().size());
+    EXPECT_EQ(device_cache.n_eta_bins(), n_eta_bins);
+    EXPECT_EQ(device_cache.max_distance(), max_dist);
+
+    EXPECT_THROW(build_landmark_cache(toy_det, origin, max_dist, 0u,
+                                      n_phi_bins, 4.f, 0.f, 0.f, host_mr),
+                 std::invalid_argument);
+    EXPECT_THROW(build_landmark_cache(toy_det, origin, max_dist, n_eta_bins,
+                                      n_phi_bins, 0.f, 0.f, 0.f, host_mr),
+                 std::invalid_argument);
+    EXPECT_THROW(build_landmark_cache(toy_det, origin, max_dist, n_eta_bins,
+                                      n_phi_bins, 4.f, 0.f, -1.f, host_mr),
+                 std::invalid_argument);
+
+    // The bending of charged tracks widens the bins
+    constexpr scalar B{2.f * unit<scalar>::T};
+    constexpr scalar min_pT{1.f * unit<scalar>::GeV};
+    auto bent_cache = build_landmark_cache(toy_det, origin, max_dist,
+                                           n_eta_bins, n_phi_bins, 4.f, min_pT,
+                                           B, host_mr);
+    EXPECT_EQ(bent_cache.min_pT(), min_pT);
+    EXPECT_GE(bent_cache.all().size(), cache.all().size());
+    for (const vector3 &d : {fwd, dir, vector3{0.f, 1.f, 0.5f}}) {
+        EXPECT_GE(bent_cache.candidates(start_vol, d).size(),
+                  cache.candidates(start_vol, d).size());
+    }
+
+    // Only complete above the transverse momentum threshold
+    const scalar qop{-0.5f / min_pT};
+    EXPECT_TRUE(bent_cache.applies(start_vol, origin, dir, qop));
+    EXPECT_TRUE(bent_cache.applies(start_vol, origin, dir, 0.f));
+    EXPECT_FALSE(bent_cache.applies(start_vol, origin, dir, 4.f * qop));
+    EXPECT_FALSE(bent_cache.applies(start_vol, origin, fwd, qop));
+}
+
+/// Compare the navigation with and without the landmark cache
+GTEST_TEST(detray_navigation, landmark_cache_navigation) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+    using detector_t = decltype(toy_det);
+
+    auto cache = build_landmark_cache(toy_det, point3{0.f, 0.f, 0.f},
+                                      1.f * unit<scalar>::mm, 10u, 8u, 4.f,
+                                      0.f, 0.f, host_mr);
+    auto view = cache.get_data();
+    const typename navigator<detector_t>::landmark_cache_type device_cache{
+        view};
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_steps(20u).phi_steps(20u).p_tot(
+        10.f * unit<scalar>::GeV);
+
+    using stepper_t = line_stepper<test_algebra>;
+    for (const auto track : trk_gen) {
+        const auto reference = trace<stepper_t>(
+            toy_det, track, decltype(&device_cache){nullptr});
+        const auto cached = trace<stepper_t>(toy_det, track, &device_cache);
+
+        ASSERT_FALSE(reference.empty());
+        EXPECT_EQ(cached, reference);
+    }
+
+    // The cache is kept when a propagation state is reused for a new track
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain<>>;
+    const auto track = *trk_gen.begin();
+    typename propagator_t::state propagation(
+        track, toy_det, typename detector_t::geometry_context{});
+    propagation._navigation.set_landmark_cache(device_cache);
+    propagation.reset(track);
+    EXPECT_EQ(propagation._navigation.landmarks(), &device_cache);
+}
+
+/// Compare the navigation with and without the landmark cache for charged
+/// tracks in a magnetic field
+GTEST_TEST(detray_navigation, landmark_cache_navigation_bfield) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+    using detector_t = decltype(toy_det);
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    constexpr scalar B{2.f * unit<scalar>::T};
+    const bfield_t b_field =
+        bfield::create_const_field<scalar>({0.f, 0.f, B});
+
+    auto cache = build_landmark_cache(toy_det, point3{0.f, 0.f, 0.f},
+                                      1.f * unit<scalar>::mm, 10u, 8u, 4.f,
+                                      0.5f * unit<scalar>::GeV, B, host_mr);
+    auto view = cache.get_data();
+    const typename navigator<detector_t>::landmark_cache_type device_cache{
+        view};
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_steps(10u).phi_steps(10u);
+
+    for (const scalar p_T :
+         {1.f * unit<scalar>::GeV, 10.f * unit<scalar>::GeV}) {
+        trk_gen.config().p_T(p_T);
+
+        for (const auto track : trk_gen) {
+            const auto reference = trace<stepper_t>(
+                toy_det, track, decltype(&device_cache){nullptr}, b_field);
+            const auto cached =
+                trace<stepper_t>(toy_det, track, &device_cache, b_field);
+
+            ASSERT_FALSE(reference.empty());
+            EXPECT_EQ(cached, reference);
+        }
+    }
+}
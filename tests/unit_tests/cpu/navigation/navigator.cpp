@@ -9,11 +9,17 @@
 #include "detray/navigation/navigator.hpp"
 
 #include "detray/definitions/indexing.hpp"
+#include "detray/navigation/counting_inspector.hpp"
 #include "detray/navigation/navigator.hpp"
+#include "detray/navigation/volume_configs.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
 #include "detray/tracks/tracks.hpp"
 
 // Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
 #include "detray/test/utils/detectors/build_toy_detector.hpp"
 #include "detray/test/utils/detectors/build_wire_chamber.hpp"
 #include "detray/test/utils/inspectors.hpp"
@@ -28,7 +34,14 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <cstring>
 #include <map>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace detray {
 
@@ -115,6 +128,115 @@ inline void step_and_check(navigator_t &nav, stepper_t &stepper,
                                   next_id);
 }
 
+/// Propagate a straight line track through the detector @param det and
+/// @returns the recorded cache statistics
+template <std::size_t capacity, typename detector_t>
+inline auto record_cache_stats(
+    const detector_t &det, const navigation::config &nav_cfg,
+    const free_track_parameters<typename detector_t::algebra_type> &track) {
+
+    using navigator_t =
+        navigator<detector_t, capacity, navigation::cache_inspector>;
+    using stepper_t = line_stepper<typename detector_t::algebra_type>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation = nav_cfg;
+    propagator_t p{prop_cfg};
+
+    typename propagator_t::state propagation(
+        track, det, typename detector_t::geometry_context{});
+    p.propagate(propagation);
+
+    return propagation._navigation.inspector();
+}
+
+/// Records the surfaces that the navigation encounters
+struct surface_recorder : actor {
+
+    struct state {
+        std::vector<geometry::barcode> barcodes{};
+    };
+
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    template <typename propagator_state_t>
+    void operator()(state &recorder_state,
+                    const propagator_state_t &propagation) const {
+        recorder_state.barcodes.push_back(propagation._navigation.barcode());
+    }
+};
+
+/// Propagate a straight line track through the detector @param det with the
+/// navigator @tparam navigator_t and @returns the encountered surfaces (uses
+/// the navigation parameters per volume @param vol_cfgs, if given)
+template <typename navigator_t, typename detector_t>
+inline auto record_surfaces(
+    const detector_t &det,
+    const free_track_parameters<typename detector_t::algebra_type> &track,
+    const propagation::config &cfg = {},
+    const typename navigator_t::volume_configs_type *vol_cfgs = nullptr) {
+
+    using stepper_t = line_stepper<typename detector_t::algebra_type>;
+    using actor_chain_t = actor_chain<surface_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p{cfg};
+
+    typename propagator_t::state propagation(
+        track, det, typename detector_t::geometry_context{});
+    if (vol_cfgs != nullptr) {
+        propagation._navigation.set_volume_configs(*vol_cfgs);
+    }
+
+    typename surface_recorder::state recorder{};
+    EXPECT_TRUE(p.propagate(propagation, detray::tie(recorder)));
+
+    return recorder.barcodes;
+}
+
+/// Emulates a group of lanes with one host thread per lane, which exchange
+/// their values through a shared buffer
+struct thread_lane_group {
+
+    static constexpr unsigned int size{4u};
+
+    static constexpr std::size_t max_value_size{512u};
+
+    static unsigned int rank() { return lane_rank; }
+
+    template <typename T>
+    static T shuffle(const T &v, const unsigned int src_rank) {
+        return exchange(v, src_rank);
+    }
+
+    template <typename T>
+    static T shuffle_xor(const T &v, const unsigned int lane_mask) {
+        return exchange(v, rank() ^ lane_mask);
+    }
+
+    template <typename T>
+    static T exchange(const T &v, const unsigned int src_rank) {
+        static_assert(sizeof(T) <= max_value_size);
+
+        std::memcpy(buffer[rank()].data(), &v, sizeof(T));
+        sync->arrive_and_wait();
+
+        T out;
+        std::memcpy(&out, buffer[src_rank].data(), sizeof(T));
+        sync->arrive_and_wait();
+
+        return out;
+    }
+
+    static thread_local unsigned int lane_rank;
+    static inline std::barrier<> *sync{nullptr};
+    static inline std::array<std::array<std::byte, max_value_size>, size>
+        buffer{};
+};
+
+thread_local unsigned int thread_lane_group::lane_rank{0u};
+
 }  // anonymous namespace
 
 }  // namespace detray
@@ -145,9 +267,9 @@ GTEST_TEST(detray_navigation, navigator_toy_geometry) {
     // State type in the nominal navigation (no inspectors)
     using nav_stat_t = navigator<detector_t, cache_size>::state;
 
-    // 256 bytes for single precision
+    // 264 bytes for single precision
     static_assert(sizeof(nav_stat_t) ==
-                  16 + navigation::default_cache_size *
+                  24 + navigation::default_cache_size *
                            sizeof(typename nav_stat_t::value_type));
 
     // test track
@@ -498,3 +620,744 @@ GTEST_TEST(detray_navigation, navigator_wire_chamber) {
     // std::cout << navigation.inspector().to_string() << std::endl;
     ASSERT_TRUE(navigation.is_complete()) << navigation.inspector().to_string();
 }
+
+/// This tests the recording of the candidate cache occupancy
+GTEST_TEST(detray_navigation, navigator_cache_statistics) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = {3u, 3u};
+
+    // Test track through the barrel layers
+    free_track_parameters<test_algebra> track(point3{0.f, 0.f, 0.f}, 0.f,
+                                              vector3{1.f, 1.f, 0.f}, -1.f);
+
+    // Large cache: Nothing gets dropped
+    const auto large_stats = record_cache_stats<64u>(toy_det, nav_cfg, track);
+    EXPECT_EQ(large_stats.n_overflows(), 0u);
+    EXPECT_FALSE(large_stats.records().empty());
+
+    // The beampipe volume contains the beampipe and the portals
+    EXPECT_GE(large_stats.records()[0].high_water_mark, 2u);
+    EXPECT_GT(large_stats.records()[0].n_calls, 0u);
+
+    // The dense barrel layers need more space than the small cache provides
+    const std::size_t recommended{large_stats.recommended_capacity()};
+    ASSERT_GT(recommended, 4u);
+    ASSERT_LE(recommended, 64u);
+
+    // Small cache: Candidates are dropped, but the demand is still recorded
+    const auto small_stats = record_cache_stats<4u>(toy_det, nav_cfg, track);
+    EXPECT_GT(small_stats.n_overflows(), 0u);
+    EXPECT_GT(small_stats.recommended_capacity(), 4u);
+
+    // Merging statistics keeps the high-water marks
+    navigation::cache_inspector merged{};
+    merged.merge(small_stats);
+    merged.merge(large_stats);
+    EXPECT_EQ(merged.n_overflows(), small_stats.n_overflows());
+    EXPECT_GE(merged.recommended_capacity(), recommended);
+}
+
+/// This tests the recording of the surface grid lookups per bin
+GTEST_TEST(detray_navigation, navigator_grid_heatmap) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+
+    using navigator_t = navigator<detector_t, cache_size,
+                                  navigation::grid_heatmap_inspector>;
+    using stepper_t = line_stepper<test_algebra>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.search_window = {1u, 1u};
+    propagator_t p{prop_cfg};
+
+    // Test tracks through the barrel layers
+    navigation::grid_heatmap_inspector heatmap{};
+    for (const vector3 dir : {vector3{1.f, 1.f, 0.f}, vector3{-1.f, 0.5f, 0.f},
+                              vector3{0.f, -1.f, 0.1f}}) {
+        free_track_parameters<test_algebra> track(point3{0.f, 0.f, 0.f}, 0.f,
+                                                  dir, -1.f);
+
+        typename propagator_t::state propagation(
+            track, toy_det, typename detector_t::geometry_context{});
+        ASSERT_TRUE(p.propagate(propagation));
+
+        heatmap.merge(propagation._navigation.inspector());
+    }
+
+    const auto &records = heatmap.records();
+    ASSERT_FALSE(records.empty());
+
+    // The beampipe volume has no surface grid
+    EXPECT_TRUE(records[0].empty());
+
+    // Every volume with lookups has one record per grid bin
+    std::size_t n_grid_volumes{0u};
+    for (const auto &bins : records) {
+        if (bins.empty()) {
+            continue;
+        }
+        ++n_grid_volumes;
+
+        for (const auto &rec : bins) {
+            // Every candidate that was hit was returned by a lookup
+            EXPECT_LE(rec.n_hits, rec.n_candidates);
+            if (rec.n_lookups == 0u) {
+                EXPECT_EQ(rec.n_candidates, 0u);
+            }
+        }
+    }
+    EXPECT_GT(n_grid_volumes, 0u);
+
+    const auto total = heatmap.total();
+    EXPECT_GT(total.n_lookups, 0u);
+    EXPECT_GT(total.n_candidates, 0u);
+    EXPECT_GT(total.n_hits, 0u);
+
+    // Merging doubles the counts
+    navigation::grid_heatmap_inspector merged{heatmap};
+    merged.merge(heatmap);
+    EXPECT_EQ(merged.total().n_lookups, 2u * total.n_lookups);
+    EXPECT_EQ(merged.total().n_hits, 2u * total.n_hits);
+}
+
+/// This tests that the safe distance skips navigation updates, but does not
+/// change the sequence of surfaces that are encountered
+GTEST_TEST(detray_navigation, navigator_safe_distance) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test_algebra, true>;
+    using object_tracer_t =
+        navigation::object_tracer<intersection_t, dvector,
+                                  navigation::status::e_on_module,
+                                  navigation::status::e_on_portal>;
+    using inspector_t =
+        aggregate_inspector<object_tracer_t, navigation::cache_inspector>;
+    using navigator_t =
+        navigator<detector_t, cache_size, inspector_t, intersection_t>;
+    using stepper_t =
+        line_stepper<test_algebra, constrained_step<scalar>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    // Test track through the barrel layers
+    free_track_parameters<test_algebra> track(point3{0.f, 0.f, 0.f}, 0.f,
+                                              vector3{1.f, 1.f, 0.1f}, -1.f);
+
+    auto run = [&](const bool use_safe_distance) {
+        propagation::config prop_cfg{};
+        prop_cfg.navigation.use_safe_distance = use_safe_distance;
+        propagator_t p{prop_cfg};
+
+        typename propagator_t::state propagation(
+            track, toy_det, typename detector_t::geometry_context{});
+        // Many small steps between the surfaces
+        propagation._stepping
+            .template set_constraint<step::constraint::e_user>(
+                2.f * unit<scalar>::mm);
+        EXPECT_TRUE(p.propagate(propagation));
+
+        return propagation._navigation.inspector();
+    };
+
+    const auto ref_insp = run(false);
+    const auto safe_insp = run(true);
+
+    // Same surfaces in the same order
+    const auto &ref_trace = std::get<0>(ref_insp._inspectors).trace();
+    const auto &safe_trace = std::get<0>(safe_insp._inspectors).trace();
+
+    ASSERT_FALSE(ref_trace.empty());
+    ASSERT_EQ(ref_trace.size(), safe_trace.size());
+    for (std::size_t i = 0u; i < ref_trace.size(); ++i) {
+        EXPECT_EQ(ref_trace[i].intersection.sf_desc.barcode(),
+                  safe_trace[i].intersection.sf_desc.barcode())
+            << "at surface " << i;
+        EXPECT_NEAR(ref_trace[i].intersection.path,
+                    safe_trace[i].intersection.path,
+                    1.f * unit<scalar>::um);
+    }
+
+    // Fewer navigation updates when the safe distance is used
+    auto n_calls = [](const navigation::cache_inspector &insp) {
+        std::size_t n{0u};
+        for (const auto &rec : insp.records()) {
+            n += rec.n_calls;
+        }
+        return n;
+    };
+    EXPECT_LT(n_calls(std::get<1>(safe_insp._inspectors)),
+              n_calls(std::get<1>(ref_insp._inspectors)));
+}
+
+/// This tests that the slim candidates lead to the same navigation as the
+/// full intersections
+GTEST_TEST(detray_navigation, navigator_slim_candidates) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+
+    using surface_t = typename detector_t::surface_type;
+    using full_intersection_t = intersection2D<surface_t, test_algebra, false>;
+    using slim_intersection_t = slim_intersection2D<surface_t, test_algebra>;
+
+    static_assert(sizeof(slim_intersection_t) < sizeof(full_intersection_t));
+
+    using full_navigator_t = navigator<detector_t>;
+    using slim_navigator_t =
+        navigator<detector_t, cache_size, navigation::void_inspector,
+                  slim_intersection_t>;
+
+    // Conversion between the candidate types
+    const auto &sf_desc = toy_det.surface(5u);
+
+    full_intersection_t full_is{};
+    full_is.sf_desc = sf_desc;
+    full_is.path = 2.f;
+    full_is.volume_link = 1u;
+    full_is.status = true;
+    full_is.direction = false;
+
+    const slim_intersection_t slim_is{full_is};
+    EXPECT_EQ(slim_is.sf_index, 5u);
+    EXPECT_FLOAT_EQ(slim_is.path, 2.f);
+    EXPECT_EQ(slim_is.volume_link, 1u);
+    EXPECT_TRUE(slim_is.is_inside());
+    EXPECT_FALSE(slim_is.is_along());
+    EXPECT_EQ(slim_is.surface(toy_det), sf_desc);
+
+    const auto expanded_is = slim_is.expand(slim_is.surface(toy_det));
+    EXPECT_EQ(expanded_is.sf_desc, sf_desc);
+    EXPECT_EQ(expanded_is.volume_link, 1u);
+    EXPECT_TRUE(expanded_is.status);
+    EXPECT_FALSE(expanded_is.direction);
+
+    // No surface set
+    EXPECT_TRUE(slim_intersection_t{}.surface(toy_det).barcode().is_invalid());
+
+    // Same surfaces in the same order
+    for (const vector3 &dir :
+         {vector3{1.f, 1.f, 0.f}, vector3{1.f, 0.f, 1.f},
+          vector3{0.f, -1.f, -0.5f}, vector3{0.2f, 1.f, 3.f}}) {
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        const auto full_seq = record_surfaces<full_navigator_t>(toy_det, track);
+        const auto slim_seq = record_surfaces<slim_navigator_t>(toy_det, track);
+
+        ASSERT_FALSE(full_seq.empty());
+        EXPECT_EQ(full_seq, slim_seq);
+    }
+}
+
+/// Test that grouping the candidate surfaces by mask type does not change the
+/// navigation
+GTEST_TEST(detray_navigation, navigator_grouped_by_mask_type) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+
+    propagation::config grouped_cfg{cfg};
+    grouped_cfg.navigation.group_by_mask_type = true;
+
+    // Same surfaces in the same order
+    constexpr std::size_t n_tracks{50u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.13f};
+        const scalar eta{-1.f + 2.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        const auto seq = record_surfaces<navigator_t>(toy_det, track, cfg);
+        const auto grouped_seq =
+            record_surfaces<navigator_t>(toy_det, track, grouped_cfg);
+
+        ASSERT_FALSE(seq.empty());
+        EXPECT_EQ(seq, grouped_seq);
+    }
+}
+
+/// The approximate local phi must not change the navigation sequence
+GTEST_TEST(detray_navigation, navigator_fast_intersector) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test_algebra, false>;
+
+    using navigator_t = navigator<detector_t>;
+    using fast_navigator_t =
+        navigator<detector_t, navigation::default_cache_size,
+                  navigation::void_inspector, intersection_t,
+                  fast_ray_intersector>;
+
+    constexpr std::size_t n_tracks{50u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.13f};
+        const scalar eta{-3.f + 6.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        const auto seq = record_surfaces<navigator_t>(toy_det, track);
+        const auto fast_seq = record_surfaces<fast_navigator_t>(toy_det, track);
+
+        ASSERT_FALSE(seq.empty());
+        EXPECT_EQ(seq, fast_seq);
+    }
+}
+
+/// Sharing the candidate intersection between a group of lanes must not
+/// change the navigation
+GTEST_TEST(detray_navigation, navigator_cooperative_init) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test_algebra, false>;
+
+    using navigator_t = navigator<detector_t>;
+    using coop_navigator_t =
+        navigator<detector_t, navigation::default_cache_size,
+                  navigation::void_inspector, intersection_t, ray_intersector,
+                  thread_lane_group>;
+
+    constexpr unsigned int n_lanes{thread_lane_group::size};
+    std::barrier sync{static_cast<std::ptrdiff_t>(n_lanes)};
+    thread_lane_group::sync = &sync;
+
+    constexpr std::size_t n_tracks{20u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.31f};
+        const scalar eta{-3.f + 6.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        const auto seq = record_surfaces<navigator_t>(toy_det, track);
+
+        // Every lane navigates the same track
+        std::array<std::vector<geometry::barcode>, n_lanes> lane_seqs{};
+        std::vector<std::thread> lanes;
+        for (unsigned int r = 0u; r < n_lanes; ++r) {
+            lanes.emplace_back([&, r]() {
+                thread_lane_group::lane_rank = r;
+                lane_seqs[r] =
+                    record_surfaces<coop_navigator_t>(toy_det, track);
+            });
+        }
+        for (auto &lane : lanes) {
+            lane.join();
+        }
+
+        ASSERT_FALSE(seq.empty());
+        for (const auto &lane_seq : lane_seqs) {
+            EXPECT_EQ(seq, lane_seq);
+        }
+    }
+
+    thread_lane_group::sync = nullptr;
+}
+
+/// In sensitive-only mode, the navigation has to reach the same sensitive
+/// surfaces and portals, but no passive surfaces
+GTEST_TEST(detray_navigation, navigator_sensitive_only) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+
+    propagation::config sens_cfg{cfg};
+    sens_cfg.navigation.sensitive_only = true;
+
+    std::size_t n_passives{0u};
+    constexpr std::size_t n_tracks{50u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.13f};
+        const scalar eta{-3.f + 6.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        auto seq = record_surfaces<navigator_t>(toy_det, track, cfg);
+        const auto sens_seq =
+            record_surfaces<navigator_t>(toy_det, track, sens_cfg);
+
+        ASSERT_FALSE(seq.empty());
+
+        const auto passive_end = std::ranges::remove_if(
+            seq, [](const geometry::barcode bcd) {
+                return bcd.id() == surface_id::e_passive;
+            });
+        n_passives +=
+            static_cast<std::size_t>(std::ranges::distance(passive_end));
+        seq.erase(passive_end.begin(), passive_end.end());
+
+        EXPECT_EQ(seq, sens_seq);
+    }
+
+    // The beampipe is passive
+    EXPECT_GT(n_passives, 0u);
+}
+
+/// Prefetching the candidate data must not change the navigation
+GTEST_TEST(detray_navigation, navigator_prefetch_candidates) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+
+    propagation::config prefetch_cfg{cfg};
+    prefetch_cfg.navigation.n_prefetch_candidates = 4u;
+
+    constexpr std::size_t n_tracks{50u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.13f};
+        const scalar eta{-3.f + 6.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        const auto seq = record_surfaces<navigator_t>(toy_det, track, cfg);
+        const auto prefetch_seq =
+            record_surfaces<navigator_t>(toy_det, track, prefetch_cfg);
+
+        ASSERT_FALSE(seq.empty());
+        EXPECT_EQ(seq, prefetch_seq);
+    }
+}
+
+/// Writing the neighborhood to a flat buffer must not change the navigation
+GTEST_TEST(detray_navigation, navigator_search_buffer) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {1u, 1u};
+
+    propagation::config buffer_cfg{cfg};
+    buffer_cfg.navigation.use_search_buffer = true;
+
+    constexpr std::size_t n_tracks{50u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.13f};
+        const scalar eta{-3.f + 6.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        const free_track_parameters<test_algebra> track(
+            point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+        const auto seq = record_surfaces<navigator_t>(toy_det, track, cfg);
+        const auto buffer_seq =
+            record_surfaces<navigator_t>(toy_det, track, buffer_cfg);
+
+        ASSERT_FALSE(seq.empty());
+        EXPECT_EQ(seq, buffer_seq);
+    }
+}
+
+/// Test the per-volume navigation parameters
+GTEST_TEST(detray_navigation, navigator_volume_config) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Look-up of the volume parameters
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = {1u, 1u};
+
+    volume_config_table<> vol_cfgs{host_mr};
+    EXPECT_TRUE(vol_cfgs.empty());
+
+    navigation::volume_config vol_cfg{};
+    vol_cfg.volume = 2u;
+    vol_cfg.max_mask_tolerance = 1.f * unit<float>::mm;
+    vol_cfg.search_window = {2u, 2u};
+    vol_cfgs.insert(vol_cfg);
+
+    EXPECT_EQ(vol_cfgs.size(), 3u);
+    EXPECT_FALSE(vol_cfgs.contains(1u));
+    ASSERT_TRUE(vol_cfgs.contains(2u));
+    EXPECT_FALSE(vol_cfgs.contains(3u));
+    EXPECT_EQ(nav_cfg.for_volume(vol_cfgs.at(2u)).search_window[0], 2u);
+    EXPECT_FLOAT_EQ(nav_cfg.for_volume(vol_cfgs.at(2u)).max_mask_tolerance,
+                    1.f * unit<float>::mm);
+
+    // Replace the parameters of the same volume
+    vol_cfg.search_window = {4u, 4u};
+    vol_cfgs.insert(vol_cfg);
+    EXPECT_EQ(vol_cfgs.size(), 3u);
+    EXPECT_EQ(nav_cfg.for_volume(vol_cfgs.at(2u)).search_window[0], 4u);
+
+    // No limit on the number of volumes
+    for (dindex i = 0u; i < 100u; ++i) {
+        vol_cfg.volume = 10u + i;
+        vol_cfgs.insert(vol_cfg);
+    }
+    EXPECT_EQ(vol_cfgs.size(), 110u);
+    EXPECT_TRUE(vol_cfgs.contains(109u));
+
+    // Needs a volume index
+    vol_cfg.volume = dindex_invalid;
+    EXPECT_THROW(vol_cfgs.insert(vol_cfg), std::invalid_argument);
+
+    // Device-side access
+    auto view = vol_cfgs.get_data();
+    const volume_config_table<device_container_types> device_cfgs{view};
+    EXPECT_EQ(device_cfgs.size(), vol_cfgs.size());
+    EXPECT_TRUE(device_cfgs.contains(2u));
+
+    // Navigation: Wide search window only in the volumes with sensitive
+    // surfaces gives the same result as a wide search window everywhere
+
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+
+    constexpr std::size_t n_tracks{50u};
+    std::vector<free_track_parameters<test_algebra>> tracks{};
+    std::vector<std::vector<geometry::barcode>> ref_seqs{};
+    std::vector<dindex> sensitive_volumes{};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const scalar phi{static_cast<scalar>(i) * 0.13f};
+        const scalar eta{-1.f + 2.f * static_cast<scalar>(i) /
+                                    static_cast<scalar>(n_tracks)};
+        const scalar theta{2.f * math::atan(math::exp(-eta))};
+        const vector3 dir{math::cos(phi) * math::sin(theta),
+                          math::sin(phi) * math::sin(theta), math::cos(theta)};
+
+        tracks.emplace_back(point3{0.f, 0.f, 0.f}, 0.f, dir, -1.f);
+        ref_seqs.push_back(
+            record_surfaces<navigator_t>(toy_det, tracks.back(), cfg));
+
+        for (const auto &bcd : ref_seqs.back()) {
+            if (bcd.id() == surface_id::e_sensitive &&
+                std::ranges::find(sensitive_volumes, bcd.volume()) ==
+                    sensitive_volumes.end()) {
+                sensitive_volumes.push_back(bcd.volume());
+            }
+        }
+    }
+    ASSERT_FALSE(sensitive_volumes.empty());
+
+    propagation::config vol_prop_cfg{};
+    vol_prop_cfg.navigation.search_window = {0u, 0u};
+
+    volume_config_table<> sens_cfgs{host_mr};
+    for (const dindex vol_idx : sensitive_volumes) {
+        navigation::volume_config sens_cfg{};
+        sens_cfg.volume = vol_idx;
+        sens_cfg.search_window = {3u, 3u};
+        sens_cfgs.insert(sens_cfg);
+    }
+    auto sens_view = sens_cfgs.get_data();
+    const typename navigator_t::volume_configs_type device_sens_cfgs{
+        sens_view};
+
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto seq = record_surfaces<navigator_t>(
+            toy_det, tracks[i], vol_prop_cfg, &device_sens_cfgs);
+
+        ASSERT_FALSE(ref_seqs[i].empty());
+        EXPECT_EQ(ref_seqs[i], seq);
+    }
+}
+
+/// Test the recovery of an overstepped candidate without reinitialization
+GTEST_TEST(detray_navigation, navigator_overstep_recovery) {
+    using namespace detray;
+
+    using test_algebra = test::algebra;
+    using scalar = test::scalar;
+    using point3 = test::point3;
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Telescope in x-direction
+    detail::ray<test_algebra> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{200.f * unit<scalar>::mm,
+                                                      200.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 10.f, 20.f, 30.f}).pilot_track(traj);
+
+    const auto [tel_det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    // Only the next two planes fit into the cache
+    using navigator_t = navigator<decltype(tel_det), 2u,
+                                  navigation::counting_inspector>;
+    using counter = navigation::counter;
+
+    const vector3 dir{1.f, 0.f, 0.f};
+    const free_track_parameters<test_algebra> track(point3{1.f, 0.f, 0.f},
+                                                    0.f, dir, -1.f);
+    // The track overstepped the plane at 20mm (the cache is exhausted)
+    const free_track_parameters<test_algebra> overstepped_track(
+        point3{20.5f, 0.f, 0.f}, 0.f, dir, -1.f);
+
+    navigation::config cfg{};
+    cfg.overstep_tolerance = -100.f * unit<float>::um;
+
+    const navigator_t nav{};
+
+    // Without retry: The volume is initialized again
+    navigator_t::state nav_state(tel_det);
+    nav.init(track, nav_state, cfg);
+    ASSERT_TRUE(nav_state.is_alive());
+    ASSERT_EQ(nav_state.inspector().count(counter::e_init), 1u);
+
+    nav_state.set_fair_trust();
+    nav.update(overstepped_track, nav_state, cfg);
+
+    EXPECT_TRUE(nav_state.is_alive());
+    EXPECT_EQ(nav_state.inspector().count(counter::e_init), 2u);
+    EXPECT_EQ(nav_state.inspector().count(counter::e_overstep_recovery), 0u);
+
+    // With retry: The overstepped plane is recovered from the cache
+    cfg.retry_overstepped_candidates = true;
+
+    navigator_t::state retry_state(tel_det);
+    nav.init(track, retry_state, cfg);
+    ASSERT_TRUE(retry_state.is_alive());
+
+    retry_state.set_fair_trust();
+    nav.update(overstepped_track, retry_state, cfg);
+
+    EXPECT_TRUE(retry_state.is_alive());
+    EXPECT_EQ(retry_state.inspector().count(counter::e_init), 1u);
+    EXPECT_EQ(retry_state.inspector().count(counter::e_overstep_recovery),
+              1u);
+    EXPECT_EQ(
+        retry_state.inspector().count(counter::e_overstep_recovery_failed),
+        0u);
+    EXPECT_EQ(retry_state.trust_level(), navigation::trust_level::e_full);
+    EXPECT_NEAR(retry_state(), -0.5f * unit<scalar>::mm, 1e-4f);
+}
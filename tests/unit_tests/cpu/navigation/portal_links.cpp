@@ -0,0 +1,250 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/portal_links.hpp"
+
+#include "detray/builders/portal_link_builder.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/inspectors.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+/// @returns the barcodes of the surfaces that the @param track encounters in
+/// the detector @param det (straight line, if no field is passed)
+template <typename stepper_t, typename detector_t, typename portal_links_t,
+          typename... field_t>
+std::vector<geometry::barcode> trace(
+    const detector_t &det,
+    const free_track_parameters<test_algebra> &track,
+    const portal_links_t *links, const field_t &...b_field) {
+
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test_algebra, false>;
+    using object_tracer_t =
+        navigation::object_tracer<intersection_t, dvector,
+                                  navigation::status::e_on_module,
+                                  navigation::status::e_on_portal>;
+    using navigator_t = navigator<detector_t, navigation::default_cache_size,
+                                  object_tracer_t, intersection_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagator_t p{propagation::config{}};
+    typename propagator_t::state propagation(
+        track, b_field..., det, typename detector_t::geometry_context{});
+    if (links != nullptr) {
+        propagation._navigation.set_portal_links(*links);
+    }
+    EXPECT_TRUE(p.propagate(propagation));
+
+    std::vector<geometry::barcode> barcodes{};
+    for (const auto &record : propagation._navigation.inspector().trace()) {
+        barcodes.push_back(record.intersection.sf_desc.barcode());
+    }
+    return barcodes;
+}
+
+}  // anonymous namespace
+
+/// Test the construction of the portal link table in the toy detector
+GTEST_TEST(detray_navigation, portal_link_table) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    constexpr dindex n_eta_bins{8u};
+    constexpr dindex n_phi_bins{16u};
+    constexpr scalar B{2.f * unit<scalar>::T};
+    constexpr scalar min_pT{1.f * unit<scalar>::GeV};
+    auto links = build_portal_links(toy_det, n_eta_bins, n_phi_bins, 4.f,
+                                    0.1f, min_pT, B, host_mr);
+
+    ASSERT_EQ(links.size(), toy_det.surfaces().size());
+
+    std::size_t n_reduced{0u};
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        const auto sf = tracking_surface{toy_det, sf_desc};
+        const dindex next_vol{sf.volume_link()};
+
+        if (!sf.is_portal() || next_vol >= toy_det.volumes().size()) {
+            EXPECT_FALSE(links.contains(sf.index()));
+            continue;
+        }
+        ASSERT_TRUE(links.contains(sf.index()));
+        EXPECT_EQ(links.n_bins(sf.index()), n_eta_bins * n_phi_bins);
+
+        // Count the surfaces of the next volume
+        std::size_t n_vol_surfaces{0u};
+        for (const auto &other : toy_det.surfaces()) {
+            n_vol_surfaces +=
+                (other.volume() == next_vol && !other.is_portal());
+        }
+
+        // The candidates lie in the next volume and are not portals
+        const scalar phi{-constant<scalar>::pi + 0.01f};
+        const dpoint3D<test_algebra> pos{math::cos(phi), math::sin(phi),
+                                         0.f};
+        const auto cands = links.candidates(sf.index(), pos);
+        EXPECT_LE(cands.size(), n_vol_surfaces);
+        for (const auto &cand : cands) {
+            EXPECT_EQ(cand.volume(), next_vol);
+            EXPECT_FALSE(cand.is_portal());
+        }
+        n_reduced += (cands.size() < n_vol_surfaces);
+
+        // Only complete for tracks that point away from the beamline with
+        // a large enough transverse momentum
+        const dvector3D<test_algebra> dir{math::cos(phi), math::sin(phi),
+                                          0.f};
+        const scalar qop{-0.5f / min_pT};
+        EXPECT_TRUE(links.applies(sf.index(), pos, dir, qop));
+        EXPECT_TRUE(links.applies(sf.index(), pos, dir, 0.f));
+        EXPECT_FALSE(links.applies(sf.index(), pos, dir, 4.f * qop));
+        EXPECT_FALSE(links.applies(sf.index(), pos, -1.f * dir, qop));
+        EXPECT_FALSE(links.applies(
+            sf.index(), pos, dvector3D<test_algebra>{0.f, 0.f, 1.f}, qop));
+    }
+    // The barrel layers are split in phi
+    EXPECT_GT(n_reduced, 0u);
+
+    // Device-side access
+    auto view = links.get_data();
+    const portal_link_table<test_algebra,
+                            typename decltype(toy_det)::surface_type,
+                            device_container_types>
+        device_links{view};
+    EXPECT_EQ(device_links.size(), links.size());
+    EXPECT_EQ(device_links.all().size(), links.all().size());
+
+    EXPECT_THROW(
+        build_portal_links(toy_det, 0u, n_phi_bins, 4.f, 0.1f, 0.f, 0.f,
+                           host_mr),
+        std::invalid_argument);
+    EXPECT_THROW(build_portal_links(toy_det, n_eta_bins, n_phi_bins, 4.f,
+                                    constant<scalar>::pi, 0.f, 0.f, host_mr),
+                 std::invalid_argument);
+}
+
+/// Compare the navigation with and without the portal link table
+GTEST_TEST(detray_navigation, portal_link_navigation) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+    using detector_t = decltype(toy_det);
+
+    auto links =
+        build_portal_links(toy_det, 8u, 16u, 4.f, 0.1f, 0.f, 0.f, host_mr);
+    auto view = links.get_data();
+    const typename navigator<detector_t>::portal_links_type device_links{
+        view};
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_steps(10u).phi_steps(10u).p_tot(
+        10.f * unit<scalar>::GeV);
+
+    using stepper_t = line_stepper<test_algebra>;
+    for (const auto track : trk_gen) {
+        const auto reference =
+            trace<stepper_t>(toy_det, track, decltype(&device_links){nullptr});
+        const auto reduced = trace<stepper_t>(toy_det, track, &device_links);
+
+        ASSERT_FALSE(reference.empty());
+
+        // The candidates of the portal links cover at least the surfaces
+        // that the grid neighbourhood search finds (plus possible overlaps)
+        auto itr = reduced.begin();
+        for (const auto &bcd : reference) {
+            itr = std::find(itr, reduced.end(), bcd);
+            ASSERT_NE(itr, reduced.end()) << bcd;
+        }
+    }
+}
+
+/// Compare the navigation with and without the portal link table for
+/// charged tracks in a magnetic field
+GTEST_TEST(detray_navigation, portal_link_navigation_bfield) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+    using detector_t = decltype(toy_det);
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    constexpr scalar B{2.f * unit<scalar>::T};
+    const bfield_t b_field =
+        bfield::create_const_field<scalar>({0.f, 0.f, B});
+
+    auto links = build_portal_links(toy_det, 8u, 16u, 4.f, 0.1f,
+                                    0.5f * unit<scalar>::GeV, B, host_mr);
+    auto view = links.get_data();
+    const typename navigator<detector_t>::portal_links_type device_links{
+        view};
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_steps(10u).phi_steps(10u);
+
+    for (const scalar p_T :
+         {1.f * unit<scalar>::GeV, 10.f * unit<scalar>::GeV}) {
+        trk_gen.config().p_T(p_T);
+
+        for (const auto track : trk_gen) {
+            const auto reference = trace<stepper_t>(
+                toy_det, track, decltype(&device_links){nullptr}, b_field);
+            const auto reduced =
+                trace<stepper_t>(toy_det, track, &device_links, b_field);
+
+            ASSERT_FALSE(reference.empty());
+
+            auto itr = reduced.begin();
+            for (const auto &bcd : reference) {
+                itr = std::find(itr, reduced.end(), bcd);
+                ASSERT_NE(itr, reduced.end()) << bcd;
+            }
+        }
+    }
+}
@@ -0,0 +1,209 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/target_navigator.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using vector3 = test::vector3;
+
+constexpr scalar tol{1e-4f};
+
+/// Record the barcodes of the sensitive surfaces on the track
+struct sensitive_recorder : actor {
+
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    struct state {
+        std::vector<geometry::barcode> barcodes{};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &actor_state,
+                    const propagator_state_t &propagation) const {
+        if (propagation._navigation.is_on_sensitive()) {
+            actor_state.barcodes.push_back(propagation._navigation.barcode());
+        }
+    }
+};
+
+}  // anonymous namespace
+
+/// Compare the direct propagation to a surface with the full navigation
+GTEST_TEST(detray_navigation, target_navigator) {
+
+    tel_det_config<test_algebra> tel_cfg{20.f * unit<scalar>::mm,
+                                         20.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 50.f, 100.f, 150.f, 200.f});
+
+    const auto [tel_det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+    using detector_t = decltype(tel_det);
+
+    using stepper_t = line_stepper<test_algebra>;
+    using actor_chain_t = actor_chain<sensitive_recorder, target_aborter>;
+
+    const free_track_parameters<test_algebra> track(
+        {0.f, 0.f, -10.f}, 0.f, vector3{0.01f, 0.02f, 1.f}, -1.f);
+
+    // Reference: Full navigation, which aborts on the target surface
+    using ref_propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain_t>;
+    const ref_propagator_t ref_p{propagation::config{}};
+
+    sensitive_recorder::state ref_recorder{};
+    typename ref_propagator_t::state ref_propagation(
+        track, tel_det, typename detector_t::geometry_context{});
+    // Unknown target: Record all planes first
+    target_aborter::state no_target{};
+    ASSERT_TRUE(
+        ref_p.propagate(ref_propagation, detray::tie(ref_recorder, no_target)));
+    ASSERT_EQ(ref_recorder.barcodes.size(), 5u);
+
+    const geometry::barcode target{ref_recorder.barcodes[3]};
+
+    ref_recorder.barcodes.clear();
+    target_aborter::state ref_aborter{target};
+    typename ref_propagator_t::state ref_propagation2(
+        track, tel_det, typename detector_t::geometry_context{});
+    ref_p.propagate(ref_propagation2, detray::tie(ref_recorder, ref_aborter));
+
+    // Step directly to the target
+    using propagator_t =
+        propagator<stepper_t, target_navigator<detector_t>, actor_chain_t>;
+    const propagator_t p{propagation::config{}};
+
+    sensitive_recorder::state recorder{};
+    target_aborter::state aborter{};
+    typename propagator_t::state propagation(
+        track, tel_det, typename detector_t::geometry_context{});
+    ASSERT_TRUE(
+        p.propagate_to(propagation, target, detray::tie(recorder, aborter)));
+
+    // Only the target surface was visited
+    ASSERT_EQ(recorder.barcodes.size(), 1u);
+    EXPECT_EQ(recorder.barcodes[0], target);
+    EXPECT_EQ(propagation._navigation.barcode(), target);
+    EXPECT_TRUE(propagation._navigation.is_complete());
+
+    // Same position on the target
+    const auto &ref_pos = ref_propagation2._stepping().pos();
+    const auto &pos = propagation._stepping().pos();
+    EXPECT_NEAR(pos[0], ref_pos[0], tol);
+    EXPECT_NEAR(pos[1], ref_pos[1], tol);
+    EXPECT_NEAR(pos[2], ref_pos[2], tol);
+    EXPECT_NEAR(propagation._stepping.path_length(),
+                ref_propagation2._stepping.path_length(), tol);
+}
+
+/// Collect the volume material on the way to the target
+GTEST_TEST(detray_navigation, target_navigator_volume_material) {
+
+    // Telescope filled with silicon, without material on the planes
+    tel_det_config<test_algebra> tel_cfg{20.f * unit<scalar>::mm,
+                                         20.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 50.f, 100.f, 150.f, 200.f})
+        .module_material(vacuum<scalar>{})
+        .mat_thickness(0.f)
+        .volume_material(silicon<scalar>{});
+
+    const auto [tel_det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+    using detector_t = decltype(tel_det);
+    using context_t = typename detector_t::geometry_context;
+
+    // Field along the telescope: The track moves in a straight line
+    using bfield_t = bfield::const_field_t<scalar>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    const bfield_t b_field =
+        bfield::create_const_field<scalar>({0.f, 0.f, 2.f * unit<scalar>::T});
+
+    const free_track_parameters<test_algebra> track(
+        {0.f, 0.f, -10.f}, 0.f, vector3{0.f, 0.f, 1.f * unit<scalar>::GeV},
+        -1.f);
+
+    // The last plane
+    geometry::barcode target{};
+    for (const auto &sf_desc : tel_det.surfaces()) {
+        if (sf_desc.is_sensitive()) {
+            target = sf_desc.barcode();
+        }
+    }
+    ASSERT_FALSE(target.is_invalid());
+
+    // Full navigation
+    using ref_propagator_t = propagator<stepper_t, navigator<detector_t>,
+                                        actor_chain<target_aborter>>;
+    const ref_propagator_t ref_p{propagation::config{}};
+
+    target_aborter::state ref_aborter{target};
+    typename ref_propagator_t::state ref_propagation(track, b_field, tel_det,
+                                                     context_t{});
+    ref_p.propagate(ref_propagation, detray::tie(ref_aborter));
+
+    const scalar ref_p_mag{ref_propagation._stepping().p(-1.f)};
+    ASSERT_LT(ref_p_mag, 1.f * unit<scalar>::GeV);
+
+    // Direct propagation, with and without tracking of the volumes
+    using mat_propagator_t =
+        propagator<stepper_t, target_navigator<detector_t, true>,
+                   actor_chain<>>;
+    using propagator_t =
+        propagator<stepper_t, target_navigator<detector_t>, actor_chain<>>;
+
+    mat_propagator_t mat_p{propagation::config{}};
+    typename mat_propagator_t::state mat_propagation(track, b_field, tel_det,
+                                                     context_t{});
+    ASSERT_TRUE(mat_p.propagate_to(mat_propagation, target));
+
+    propagator_t p{propagation::config{}};
+    typename propagator_t::state propagation(track, b_field, tel_det,
+                                             context_t{});
+    ASSERT_TRUE(p.propagate_to(propagation, target));
+
+    // The energy loss in the volume is the same as for the full navigation
+    const scalar ref_loss{1.f * unit<scalar>::GeV - ref_p_mag};
+    const scalar loss{1.f * unit<scalar>::GeV -
+                      mat_propagation._stepping().p(-1.f)};
+    EXPECT_NEAR(loss, ref_loss, 0.01f * ref_loss);
+
+    // No volume material without the volume lookup
+    EXPECT_NEAR(propagation._stepping().p(-1.f), 1.f * unit<scalar>::GeV,
+                tol);
+}
@@ -0,0 +1,143 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/telescope_navigator.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+/// Record the barcodes of the sensitive surfaces on the track
+struct sensitive_recorder : actor {
+
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    struct state {
+        std::vector<geometry::barcode> barcodes{};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &actor_state,
+                    const propagator_state_t &propagation) const {
+        if (propagation._navigation.is_on_sensitive()) {
+            actor_state.barcodes.push_back(propagation._navigation.barcode());
+        }
+    }
+};
+
+/// @returns the barcodes of the sensitive surfaces that a straight line
+/// @param track encounters in the detector @param det with the navigator
+/// @tparam navigator_t in the navigation direction @param dir
+template <typename navigator_t, typename detector_t>
+std::vector<geometry::barcode> trace(
+    const detector_t &det, const free_track_parameters<test_algebra> &track,
+    const navigation::direction dir = navigation::direction::e_forward) {
+
+    using stepper_t = line_stepper<test_algebra>;
+    using actor_chain_t = actor_chain<sensitive_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p{propagation::config{}};
+    typename propagator_t::state propagation(
+        track, det, typename detector_t::geometry_context{});
+    propagation._navigation.set_direction(dir);
+
+    sensitive_recorder::state recorder{};
+    EXPECT_TRUE(p.propagate(propagation, detray::tie(recorder)));
+
+    return recorder.barcodes;
+}
+
+}  // anonymous namespace
+
+/// Compare the telescope navigation with the generic navigation
+GTEST_TEST(detray_navigation, telescope_navigator) {
+
+    // Ten planes with 20x20mm half lengths along the z-axis
+    tel_det_config<test_algebra> tel_cfg{20.f * unit<scalar>::mm,
+                                         20.f * unit<scalar>::mm};
+    tel_cfg.n_surfaces(10u).length(500.f * unit<scalar>::mm);
+
+    const auto [tel_det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+    using detector_t = decltype(tel_det);
+
+    // Tracks that leave the telescope on the side miss the last planes
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_range(0.f, 0.1f).theta_steps(10u).phi_steps(10u);
+
+    std::size_t n_missed{0u};
+    for (const auto track : trk_gen) {
+        const auto reference = trace<navigator<detector_t>>(tel_det, track);
+        const auto result =
+            trace<telescope_navigator<detector_t>>(tel_det, track);
+
+        ASSERT_FALSE(reference.empty());
+        EXPECT_EQ(result, reference);
+
+        n_missed += (reference.size() < tel_cfg.n_surfaces()) ? 1u : 0u;
+    }
+    // Check that the skipping of the planes was tested
+    EXPECT_GT(n_missed, 0u);
+}
+
+/// Navigate the telescope in backward direction
+GTEST_TEST(detray_navigation, telescope_navigator_backward) {
+
+    tel_det_config<test_algebra> tel_cfg{20.f * unit<scalar>::mm,
+                                         20.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 50.f, 100.f, 150.f, 200.f});
+
+    const auto [tel_det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+    using navigator_t = telescope_navigator<decltype(tel_det)>;
+
+    // Start on the first and on the last plane, respectively
+    const free_track_parameters<test_algebra> fw_track(
+        {0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, -1.f);
+    const free_track_parameters<test_algebra> bw_track(
+        {0.f, 0.f, 200.f}, 0.f, {0.f, 0.f, 1.f}, -1.f);
+
+    const auto forward = trace<navigator_t>(tel_det, fw_track);
+    auto backward = trace<navigator_t>(tel_det, bw_track,
+                                       navigation::direction::e_backward);
+
+    ASSERT_EQ(forward.size(), 5u);
+    std::ranges::reverse(backward);
+    EXPECT_EQ(backward, forward);
+}
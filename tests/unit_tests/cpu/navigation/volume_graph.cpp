@@ -91,3 +91,57 @@ GTEST_TEST(detray_navigation, volume_graph) {
     // Check this with graph
     ASSERT_TRUE(adj_mat == adj_truth);
 }
+
+// This tests the shortest paths between the volumes of a geometry
+GTEST_TEST(detray_navigation, volume_hop_table) {
+    using namespace detray;
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.n_edc_layers(1u);
+
+    auto [det, names] = build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    volume_graph graph(det);
+    const auto &adj_mat = graph.adjacency_matrix();
+    const dindex dim{graph.n_nodes() + 1u};
+
+    volume_hop_table<> hop_table = graph.hop_table(host_mr);
+    ASSERT_EQ(hop_table.n_volumes(), det.volumes().size());
+
+    // Access the table through its view, as on device
+    auto hop_view = hop_table.get_data();
+    const volume_hop_table<device_container_types> device_table(hop_view);
+    ASSERT_EQ(device_table.n_volumes(), hop_table.n_volumes());
+
+    for (dindex from = 0u; from < hop_table.n_volumes(); ++from) {
+        EXPECT_EQ(hop_table.next_volume(from, from), from);
+        EXPECT_EQ(hop_table.n_hops(from, from), 0u);
+
+        for (dindex to = 0u; to < hop_table.n_volumes(); ++to) {
+            EXPECT_EQ(device_table.next_volume(from, to),
+                      hop_table.next_volume(from, to));
+            EXPECT_EQ(device_table.n_hops(from, to),
+                      hop_table.n_hops(from, to));
+
+            // The toy detector is fully connected
+            ASSERT_TRUE(hop_table.is_reachable(from, to));
+            if (from == to) {
+                continue;
+            }
+
+            // The next volume is a neighbor, from which the target is one
+            // hop closer
+            const dindex next{hop_table.next_volume(from, to)};
+            EXPECT_NE(next, from);
+            EXPECT_GT(adj_mat[dim * from + next], 0u);
+            EXPECT_EQ(hop_table.n_hops(next, to) + 1u,
+                      hop_table.n_hops(from, to));
+        }
+    }
+
+    // Beampipe to barrel layer 4: via the connector layer
+    EXPECT_EQ(hop_table.n_hops(0u, 9u), 2u);
+    EXPECT_EQ(hop_table.next_volume(0u, 9u), 2u);
+}
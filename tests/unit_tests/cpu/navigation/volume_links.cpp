@@ -0,0 +1,159 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/volume_links.hpp"
+
+#include "detray/builders/volume_link_builder.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/inspectors.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+/// @returns the barcodes of the surfaces that a straight line @param track
+/// encounters in the detector @param det
+template <typename detector_t, typename volume_links_t>
+std::vector<geometry::barcode> trace(
+    const detector_t &det,
+    const free_track_parameters<test_algebra> &track,
+    const volume_links_t *links) {
+
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test_algebra, false>;
+    using object_tracer_t =
+        navigation::object_tracer<intersection_t, dvector,
+                                  navigation::status::e_on_module,
+                                  navigation::status::e_on_portal>;
+    using navigator_t = navigator<detector_t, navigation::default_cache_size,
+                                  object_tracer_t, intersection_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagator_t p{propagation::config{}};
+    typename propagator_t::state propagation(
+        track, det, typename detector_t::geometry_context{});
+    if (links != nullptr) {
+        propagation._navigation.set_volume_links(*links);
+    }
+    EXPECT_EQ(propagation._navigation.volume_links(), links);
+    EXPECT_TRUE(p.propagate(propagation));
+
+    std::vector<geometry::barcode> barcodes{};
+    for (const auto &record : propagation._navigation.inspector().trace()) {
+        barcodes.push_back(record.intersection.sf_desc.barcode());
+    }
+    return barcodes;
+}
+
+}  // anonymous namespace
+
+/// Test the construction of the volume link table in the toy detector
+GTEST_TEST(detray_navigation, volume_link_table) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+
+    auto links = build_volume_links(toy_det, host_mr);
+
+    ASSERT_EQ(links.size(), toy_det.surfaces().size());
+
+    // One aligned record per surface
+    using volume_t = typename decltype(toy_det)::volume_type;
+    using record_t = typename decltype(links)::record_type;
+    static_assert(alignof(record_t) == 32u);
+    static_assert(sizeof(record_t) % 32u == 0u);
+    EXPECT_FALSE(links.contains(links.size()));
+
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        const auto sf = tracking_surface{toy_det, sf_desc};
+
+        ASSERT_TRUE(links.contains(sf.index()));
+        const record_t &record = links.at(sf.index());
+
+        // Surfaces that do not lead into another volume keep invalid records
+        if (!sf.is_portal() || detail::is_invalid_value(sf.volume_link())) {
+            EXPECT_TRUE(record.is_exit());
+            continue;
+        }
+
+        // The record packs the links of the volume behind the portal
+        const volume_t &next_vol = toy_det.volume(sf.volume_link());
+        EXPECT_EQ(record.volume, sf.volume_link());
+        EXPECT_EQ(record.material, next_vol.material());
+        EXPECT_EQ(record.accel, next_vol.accel_link());
+
+        const volume_t vol_desc = record.descriptor();
+        EXPECT_EQ(vol_desc, next_vol);
+        EXPECT_EQ(vol_desc.transform(), next_vol.transform());
+        EXPECT_EQ(vol_desc.template sf_link<surface_id::e_portal>(),
+                  next_vol.template sf_link<surface_id::e_portal>());
+    }
+
+    // Device-side access
+    auto view = links.get_data();
+    const volume_link_table<volume_t, device_container_types> device_links{
+        view};
+    EXPECT_EQ(device_links.size(), links.size());
+}
+
+/// Compare the navigation with and without the volume link table
+GTEST_TEST(detray_navigation, volume_link_navigation) {
+
+    toy_det_config<scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test_algebra>(host_mr, toy_cfg);
+    using detector_t = decltype(toy_det);
+
+    auto links = build_volume_links(toy_det, host_mr);
+    auto view = links.get_data();
+    const typename navigator<detector_t>::volume_links_type device_links{
+        view};
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    auto trk_gen = generator_t{};
+    trk_gen.config().theta_steps(10u).phi_steps(10u).p_tot(
+        10.f * unit<scalar>::GeV);
+
+    for (const auto track : trk_gen) {
+        const auto reference =
+            trace(toy_det, track, decltype(&device_links){nullptr});
+        const auto linked = trace(toy_det, track, &device_links);
+
+        ASSERT_FALSE(reference.empty());
+        EXPECT_EQ(linked, reference);
+    }
+}
@@ -185,3 +185,97 @@ GTEST_TEST(detray_propagator, actor_chain) {
                     "obs 0.2]:") == 0)
         << "Printer call chain: " << printer_state.to_string() << std::endl;
 }
+
+namespace {
+
+/// Navigation state mock that only provides the status queries
+struct mock_navigation {
+    bool on_sensitive{false};
+    bool on_portal{false};
+    bool alive{true};
+
+    bool is_on_surface() const { return on_sensitive || on_portal; }
+    bool is_on_sensitive() const { return on_sensitive; }
+    bool is_on_passive() const { return false; }
+    bool is_on_portal() const { return on_portal; }
+    bool is_alive() const { return alive; }
+};
+
+struct mock_prop_state {
+    mock_navigation _navigation{};
+};
+
+/// Actor that counts how often it was called
+template <actor_trigger T>
+struct counting_actor : detray::actor {
+
+    static constexpr actor_trigger trigger{T};
+
+    struct state {
+        unsigned int n_calls{0u};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &counter, const propagator_state_t &) const {
+        ++counter.n_calls;
+    }
+
+    template <typename subj_state_t, typename propagator_state_t>
+    void operator()(state &counter, const subj_state_t &,
+                    const propagator_state_t &) const {
+        ++counter.n_calls;
+    }
+};
+
+}  // anonymous namespace
+
+// Test that the actors are only called when their trigger applies
+GTEST_TEST(detray_propagator, actor_chain_trigger) {
+
+    using every_step_t = counting_actor<actor_trigger::e_every_step>;
+    using surface_t = counting_actor<actor_trigger::e_on_surface>;
+    using sensitive_t = counting_actor<actor_trigger::e_on_sensitive>;
+    using portal_t = counting_actor<actor_trigger::e_on_portal>;
+    using exit_t = counting_actor<actor_trigger::e_on_exit>;
+
+    // The composite is called whenever one of its parts applies
+    using composite_t = composite_actor<sensitive_t, portal_t>;
+    static_assert(composite_t::trigger ==
+                  (actor_trigger::e_on_sensitive | actor_trigger::e_on_portal));
+    static_assert(composite_actor<every_step_t, exit_t>::trigger ==
+                  actor_trigger::e_every_step);
+
+    every_step_t::state every_step_state{};
+    surface_t::state surface_state{};
+    sensitive_t::state sensitive_state{};
+    portal_t::state portal_state{};
+    exit_t::state exit_state{};
+
+    auto actor_states =
+        detray::tie(every_step_state, surface_state, sensitive_state,
+                    portal_state, exit_state);
+
+    actor_chain<every_step_t, surface_t, composite_t, exit_t> run_actors{};
+
+    mock_prop_state prop_state{};
+
+    // Between surfaces
+    run_actors(actor_states, prop_state);
+    // On a sensitive surface
+    prop_state._navigation.on_sensitive = true;
+    run_actors(actor_states, prop_state);
+    // On a portal
+    prop_state._navigation.on_sensitive = false;
+    prop_state._navigation.on_portal = true;
+    run_actors(actor_states, prop_state);
+    // Navigation exited
+    prop_state._navigation.on_portal = false;
+    prop_state._navigation.alive = false;
+    run_actors(actor_states, prop_state);
+
+    EXPECT_EQ(every_step_state.n_calls, 4u);
+    EXPECT_EQ(surface_state.n_calls, 2u);
+    EXPECT_EQ(sensitive_state.n_calls, 1u);
+    EXPECT_EQ(portal_state.n_calls, 1u);
+    EXPECT_EQ(exit_state.n_calls, 1u);
+}
@@ -0,0 +1,116 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/batched_field.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+
+using namespace detray;
+
+using scalar = test::scalar;
+using vector3 = test::vector3;
+
+namespace {
+
+/// Batch of positions with a size that is not a multiple of the chunk size
+constexpr std::size_t n_tracks{37u};
+
+/// Phi-symmetric test field
+struct solenoid_field {
+    darray<float, 3> at(const float x, const float y, const float z) const {
+        constexpr float grad{0.5f * unit<float>::T / unit<float>::m};
+        return {grad * x, grad * y, 2.f * unit<float>::T - grad * z};
+    }
+};
+
+/// Fill the positions of the batch
+void fill_positions(dvector<float> &x, dvector<float> &y, dvector<float> &z) {
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto s{static_cast<float>(i)};
+        x[i] = (-0.8f + 0.04f * s) * unit<float>::m;
+        y[i] = (0.5f - 0.03f * s) * unit<float>::m;
+        z[i] = (-1.5f + 0.08f * s) * unit<float>::m;
+    }
+    // On the z-axis
+    x[0] = 0.f;
+    y[0] = 0.f;
+}
+
+}  // namespace
+
+/// Test the batched evaluation of a constant field
+GTEST_TEST(detray_propagator, batched_const_field) {
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using field_view_t = typename bfield_t::view_t;
+
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    const bfield_t const_bfield = bfield::create_const_field<scalar>(B);
+    const batched_field<field_view_t, scalar> field{
+        field_view_t{const_bfield}};
+
+    dvector<float> x(n_tracks), y(n_tracks), z(n_tracks);
+    dvector<float> bx(n_tracks), by(n_tracks), bz(n_tracks);
+    fill_positions(x, y, z);
+
+    field.at(x, y, z, bx, by, bz);
+
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        EXPECT_FLOAT_EQ(bx[i], B[0]);
+        EXPECT_FLOAT_EQ(by[i], B[1]);
+        EXPECT_FLOAT_EQ(bz[i], B[2]);
+    }
+}
+
+/// Compare the batched evaluation of the r-z field map to the scalar lookup
+GTEST_TEST(detray_propagator, batched_rz_field) {
+
+    using field_view_t = bfield::rz_field_t<float>::view_t;
+
+    const bfield::rz_field_t<float> rz_field{
+        solenoid_field{},
+        {0.f, 1.f * unit<float>::m, 11u},
+        {-2.f * unit<float>::m, 2.f * unit<float>::m, 41u}};
+    const field_view_t view = rz_field.view();
+
+    static_assert(concepts::batched_field_view<field_view_t, float>);
+    const batched_field<field_view_t> field{view};
+
+    dvector<float> x(n_tracks), y(n_tracks), z(n_tracks);
+    dvector<float> bx(n_tracks), by(n_tracks), bz(n_tracks);
+    fill_positions(x, y, z);
+
+    field.at(x, y, z, bx, by, bz);
+
+    constexpr float tol{1e-6f * unit<float>::T};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto b = view.at(x[i], y[i], z[i]);
+        EXPECT_NEAR(bx[i], b[0], tol);
+        EXPECT_NEAR(by[i], b[1], tol);
+        EXPECT_NEAR(bz[i], b[2], tol);
+    }
+
+    // Single lane
+    dvector<float> lane_bx(n_tracks, 0.f), lane_by(n_tracks, 0.f),
+        lane_bz(n_tracks, 0.f);
+    field.at_lane(5u, x, y, z, lane_bx, lane_by, lane_bz);
+    EXPECT_NEAR(lane_bx[5], bx[5], tol);
+    EXPECT_NEAR(lane_by[5], by[5], tol);
+    EXPECT_NEAR(lane_bz[5], bz[5], tol);
+    EXPECT_FLOAT_EQ(lane_bz[4], 0.f);
+}
@@ -0,0 +1,130 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/detail/batched_jacobian_engine.hpp"
+
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+
+namespace {
+
+const scalar isclose{1e-5f};
+
+constexpr std::size_t batch_size{8u};
+
+/// @returns a batch of bound track parameters with distinct covariances
+darray<bound_track_parameters<test_algebra>, batch_size> make_batch() {
+    darray<bound_track_parameters<test_algebra>, batch_size> batch{};
+
+    for (std::size_t i = 0u; i < batch_size; ++i) {
+        const auto s{static_cast<scalar>(i)};
+
+        bound_parameters_vector<test_algebra> bound_vec{};
+        bound_vec.set_bound_local({0.1f * s - 0.2f, 0.3f - 0.05f * s});
+        bound_vec.set_phi(0.2f + 0.3f * s);
+        bound_vec.set_theta(0.4f + 0.1f * s);
+        bound_vec.set_qop(-1.f / (1.f + s));
+        bound_vec.set_time(0.1f * s);
+
+        auto cov = matrix::identity<bound_matrix<test_algebra>>();
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            getter::element(cov, j, j) = 0.01f * (1.f + s + scalar(j));
+        }
+        getter::element(cov, e_bound_loc0, e_bound_loc1) = 0.001f * s;
+        getter::element(cov, e_bound_loc1, e_bound_loc0) = 0.001f * s;
+
+        batch[i].set_parameter_vector(bound_vec);
+        batch[i].set_covariance(cov);
+    }
+
+    return batch;
+}
+
+/// Compare transforming a batch with transforming the parameters one at a time
+template <typename frame_t, typename mask_t>
+void test_batch(const transform3 &trf, const mask_t &msk) {
+
+    using engine_t = detail::jacobian_engine<frame_t>;
+    using batched_engine_t = detail::batched_jacobian_engine<frame_t>;
+
+    const auto bound_batch = make_batch();
+
+    darray<free_track_parameters<test_algebra>, batch_size> free_vecs{};
+    darray<free_matrix<test_algebra>, batch_size> free_covs{};
+    batched_engine_t::bound_to_free(trf, msk, bound_batch, free_vecs,
+                                    free_covs);
+
+    darray<bound_track_parameters<test_algebra>, batch_size> bound_batch2{};
+    batched_engine_t::free_to_bound(trf, free_vecs, free_covs, bound_batch2);
+
+    for (std::size_t i = 0u; i < batch_size; ++i) {
+        const auto &bound = bound_batch[i];
+
+        // Single parameter set
+        const auto free_vec = detail::bound_to_free_vector(trf, msk, bound);
+        const auto jac = engine_t::bound_to_free_jacobian(trf, msk, bound);
+        const free_matrix<test_algebra> free_cov =
+            jac * bound.covariance() * matrix::transpose(jac);
+
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            ASSERT_NEAR(free_vecs[i][j], free_vec[j], isclose);
+            for (unsigned int k = 0u; k < e_free_size; ++k) {
+                ASSERT_NEAR(getter::element(free_covs[i], j, k),
+                            getter::element(free_cov, j, k), isclose);
+            }
+        }
+
+        // Round trip
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            ASSERT_NEAR(bound_batch2[i][j], bound[j], isclose);
+            for (unsigned int k = 0u; k < e_bound_size; ++k) {
+                ASSERT_NEAR(getter::element(bound_batch2[i].covariance(), j, k),
+                            getter::element(bound.covariance(), j, k), 1e-4f);
+            }
+        }
+    }
+}
+
+}  // anonymous namespace
+
+// This tests the batched parameter transformation on a plane
+GTEST_TEST(detray_propagator, batched_jacobian_cartesian2D) {
+
+    const transform3 trf(point3{2.f, 3.f, 4.f}, vector3{0.f, 0.f, 1.f},
+                         vector3{1.f, 0.f, 0.f});
+    const mask<rectangle2D, test_algebra> rect{0u, 2.f, 2.f};
+
+    test_batch<cartesian2D<test_algebra>>(trf, rect);
+}
+
+// This tests the batched parameter transformation on a line
+GTEST_TEST(detray_propagator, batched_jacobian_line2D) {
+
+    const transform3 trf(point3{1.f, 0.5f, 0.f}, vector3{0.f, 0.f, 1.f},
+                         vector3{1.f, 0.f, 0.f});
+    const mask<line<>, test_algebra> ln{0u, 1.f, 10.f};
+
+    test_batch<line2D<test_algebra>>(trf, ln);
+}
@@ -0,0 +1,278 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/actors/bound_state_writer.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/concepts.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/ray.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// google-test include(s).
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+constexpr scalar tol{1e-5f};
+
+/// Reference: Record the bound states on the sensitive surfaces
+struct bound_state_recorder : actor {
+
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    struct state {
+        std::vector<bound_track_parameters<test_algebra>> params{};
+        std::vector<scalar> path_lengths{};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &actor_state,
+                    const propagator_state_t &propagation) const {
+        if (propagation._navigation.is_on_sensitive()) {
+            actor_state.params.push_back(propagation._stepping.bound_params());
+            actor_state.path_lengths.push_back(
+                propagation._stepping.path_length());
+        }
+    }
+};
+
+/// Host buffer for the output of the bound state writer
+template <typename writer_t>
+struct state_buffer {
+
+    state_buffer(vecmem::memory_resource &mr, const std::size_t n_slots,
+                 const std::size_t n_counters)
+        : params(n_slots, &mr),
+          covariances(n_slots, &mr),
+          surface_indices(n_slots, dindex_invalid, &mr),
+          path_lengths(n_slots, 0.f, &mr),
+          track_indices(n_slots, dindex_invalid, &mr),
+          counters(n_counters, 0u, &mr) {}
+
+    typename writer_t::buffer_view view() {
+        return {vecmem::get_data(params),       vecmem::get_data(covariances),
+                vecmem::get_data(surface_indices),
+                vecmem::get_data(path_lengths),
+                vecmem::get_data(track_indices), vecmem::get_data(counters)};
+    }
+
+    vecmem::vector<typename writer_t::vector_type> params;
+    vecmem::vector<typename writer_t::matrix_type> covariances;
+    vecmem::vector<dindex> surface_indices;
+    vecmem::vector<scalar> path_lengths;
+    vecmem::vector<dindex> track_indices;
+    vecmem::vector<typename writer_t::counter_type> counters;
+};
+
+/// Check one written state against the reference
+template <typename buffer_t>
+void check_state(const buffer_t &buffer, const std::size_t slot,
+                 const bound_state_recorder::state &ref,
+                 const std::size_t ref_idx) {
+
+    const auto &ref_params = ref.params.at(ref_idx);
+
+    EXPECT_EQ(buffer.surface_indices[slot],
+              ref_params.surface_link().index());
+    EXPECT_NEAR(buffer.path_lengths[slot], ref.path_lengths.at(ref_idx), tol);
+
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        EXPECT_NEAR(getter::element(buffer.params[slot], i, 0u),
+                    getter::element(ref_params.vector(), i, 0u), tol);
+
+        const auto ref_cov = ref_params.covariance();
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(getter::element(buffer.covariances[slot], i, j),
+                        getter::element(ref_cov, i, j), tol);
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Compare the states in the SoA buffer with the recorded bound states
+GTEST_TEST(detray_propagator, bound_state_writer) {
+
+    using per_track_writer_t = bound_state_writer<test_algebra>;
+    using atomic_writer_t =
+        bound_state_writer<test_algebra, state_slot_layout::e_atomic>;
+
+    static_assert(detray::concepts::actor<per_track_writer_t>);
+    static_assert(detray::concepts::actor<atomic_writer_t>);
+
+    vecmem::host_memory_resource host_mr;
+
+    // Telescope in x-direction
+    detail::ray<test_algebra> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{200.f * unit<scalar>::mm,
+                                                      200.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 10.f, 20.f, 30.f, 40.f, 50.f, 60.f})
+        .pilot_track(traj);
+
+    const auto [det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    using navigator_t = navigator<decltype(det)>;
+    using stepper_t = line_stepper<test_algebra>;
+    using actor_chain_t =
+        actor_chain<parameter_transporter<test_algebra>, bound_state_recorder,
+                    per_track_writer_t, atomic_writer_t,
+                    parameter_resetter<test_algebra>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.overstep_tolerance = -100.f * unit<float>::um;
+    const propagator_t p{prop_cfg};
+
+    // Tracks with different local positions on the first plane
+    constexpr dindex n_tracks{3u};
+    constexpr unsigned int max_states{10u};
+
+    state_buffer<per_track_writer_t> per_track_buffer(
+        host_mr, n_tracks * max_states, n_tracks);
+    state_buffer<atomic_writer_t> atomic_buffer(host_mr,
+                                                n_tracks * max_states, 1u);
+
+    std::vector<bound_state_recorder::state> ref_states(n_tracks);
+
+    for (dindex trk_idx = 0u; trk_idx < n_tracks; ++trk_idx) {
+
+        bound_parameters_vector<test_algebra> bound_vector{};
+        bound_vector.set_bound_local(
+            {static_cast<scalar>(trk_idx) * unit<scalar>::mm,
+             -static_cast<scalar>(trk_idx) * unit<scalar>::mm});
+        bound_vector.set_theta(constant<scalar>::pi_4);
+        bound_vector.set_qop(-0.1f);
+
+        auto bound_cov = matrix::identity<
+            typename bound_track_parameters<test_algebra>::covariance_type>();
+        getter::element(bound_cov, e_bound_phi, e_bound_phi) = 0.f;
+        getter::element(bound_cov, e_bound_theta, e_bound_theta) = 0.f;
+
+        const bound_track_parameters<test_algebra> bound_param0(
+            det.surface(0u).barcode(), bound_vector, bound_cov);
+
+        per_track_writer_t::state per_track_state{per_track_buffer.view(),
+                                                  trk_idx, max_states};
+        atomic_writer_t::state atomic_state{atomic_buffer.view(), trk_idx};
+
+        propagator_t::state propagation(bound_param0, det, prop_cfg.context);
+        p.propagate(propagation, detray::tie(ref_states[trk_idx],
+                                             per_track_state, atomic_state));
+
+        const auto n_ref{ref_states[trk_idx].params.size()};
+        ASSERT_GE(n_ref, 6u);
+
+        EXPECT_FALSE(per_track_state.overflow());
+        EXPECT_FALSE(atomic_state.overflow());
+        EXPECT_EQ(per_track_state.n_states(), n_ref);
+        EXPECT_EQ(atomic_state.n_states(), n_ref);
+        EXPECT_EQ(per_track_buffer.counters[trk_idx], n_ref);
+    }
+
+    // Per track layout: The states of a track are in its slot range
+    for (dindex trk_idx = 0u; trk_idx < n_tracks; ++trk_idx) {
+        const auto &ref = ref_states[trk_idx];
+        for (std::size_t i = 0u; i < ref.params.size(); ++i) {
+            check_state(per_track_buffer, trk_idx * max_states + i, ref, i);
+        }
+    }
+
+    // Atomic layout: The states are densely packed and carry the track index
+    std::vector<std::size_t> n_found(n_tracks, 0u);
+    for (std::size_t slot = 0u; slot < atomic_buffer.counters[0]; ++slot) {
+        const dindex trk_idx{atomic_buffer.track_indices[slot]};
+        ASSERT_LT(trk_idx, n_tracks);
+
+        check_state(atomic_buffer, slot, ref_states[trk_idx],
+                    n_found[trk_idx]);
+        ++n_found[trk_idx];
+    }
+    for (dindex trk_idx = 0u; trk_idx < n_tracks; ++trk_idx) {
+        EXPECT_EQ(n_found[trk_idx], ref_states[trk_idx].params.size());
+    }
+}
+
+/// Check that the writer does not write past the end of its slots
+GTEST_TEST(detray_propagator, bound_state_writer_overflow) {
+
+    using writer_t = bound_state_writer<test_algebra>;
+
+    vecmem::host_memory_resource host_mr;
+
+    detail::ray<test_algebra> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{200.f * unit<scalar>::mm,
+                                                      200.f * unit<scalar>::mm};
+    tel_cfg.positions({0.f, 10.f, 20.f, 30.f, 40.f, 50.f, 60.f})
+        .pilot_track(traj);
+
+    const auto [det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    using propagator_t =
+        propagator<line_stepper<test_algebra>, navigator<decltype(det)>,
+                   actor_chain<parameter_transporter<test_algebra>, writer_t,
+                               parameter_resetter<test_algebra>>>;
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.overstep_tolerance = -100.f * unit<float>::um;
+    const propagator_t p{prop_cfg};
+
+    bound_parameters_vector<test_algebra> bound_vector{};
+    bound_vector.set_theta(constant<scalar>::pi_4);
+    bound_vector.set_qop(-0.1f);
+
+    const bound_track_parameters<test_algebra> bound_param0(
+        det.surface(0u).barcode(), bound_vector,
+        matrix::identity<
+            typename bound_track_parameters<test_algebra>::covariance_type>());
+
+    // Room for three states of the second track
+    constexpr unsigned int max_states{3u};
+    state_buffer<writer_t> buffer(host_mr, 2u * max_states, 2u);
+
+    writer_t::state writer_state{buffer.view(), 1u, max_states};
+    propagator_t::state propagation(bound_param0, det, prop_cfg.context);
+    p.propagate(propagation, detray::tie(writer_state));
+
+    EXPECT_TRUE(writer_state.overflow());
+    EXPECT_EQ(writer_state.n_states(), max_states);
+    EXPECT_EQ(buffer.counters[0], 0u);
+    EXPECT_EQ(buffer.counters[1], max_states);
+
+    // The slots of the first track were not touched
+    for (std::size_t slot = 0u; slot < max_states; ++slot) {
+        EXPECT_EQ(buffer.surface_indices[slot], dindex_invalid);
+    }
+    for (std::size_t slot = max_states; slot < 2u * max_states; ++slot) {
+        EXPECT_NE(buffer.surface_indices[slot], dindex_invalid);
+    }
+}
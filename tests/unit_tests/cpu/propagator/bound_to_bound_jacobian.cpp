@@ -0,0 +1,110 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/detail/jacobian_engine.hpp"
+
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+
+namespace {
+
+const scalar isclose{1e-4f};
+
+/// Compare the full bound-to-bound jacobian with the dense matrix products
+template <typename frame_t>
+void test_bound_to_bound(const transform3 &trf) {
+
+    using dep_engine_t = detail::jacobian_engine<cartesian2D<test_algebra>>;
+    using engine_t = detail::jacobian_engine<frame_t>;
+
+    // Departure surface
+    const transform3 dep_trf(point3{0.f, 0.f, -1.f}, vector3{0.f, 1.f, 1.f},
+                             vector3{1.f, 0.f, 0.f});
+    const mask<rectangle2D, test_algebra> dep_rect{0u, 10.f, 10.f};
+
+    bound_parameters_vector<test_algebra> dep_vec{};
+    dep_vec.set_bound_local({0.5f, -0.3f});
+    dep_vec.set_phi(0.3f);
+    dep_vec.set_theta(1.1f);
+    dep_vec.set_qop(-0.5f);
+    dep_vec.set_time(0.2f);
+
+    const bound_to_free_matrix<test_algebra> bound_to_free =
+        dep_engine_t::bound_to_free_jacobian(dep_trf, dep_rect, dep_vec);
+
+    // A dense transport jacobian
+    auto transport = matrix::identity<free_matrix<test_algebra>>();
+    for (unsigned int i = 0u; i < e_free_size; ++i) {
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            getter::element(transport, i, j) +=
+                0.01f * static_cast<scalar>((3u * i + 7u * j) % 11u);
+        }
+    }
+
+    // Track state on the destination surface
+    const point3 pos{1.8f, 0.9f, 2.f};
+    const vector3 dir = vector::normalize(vector3{0.2f, 0.6f, 1.f});
+    const vector3 dtds{0.01f, -0.02f, 0.005f};
+    const scalar dqopds{-0.001f};
+
+    free_parameters_vector<test_algebra> free_vec{};
+    free_vec.set_pos(pos);
+    free_vec.set_dir(dir);
+    free_vec.set_qop(-0.5f);
+    free_vec.set_time(0.3f);
+
+    const free_to_bound_matrix<test_algebra> free_to_bound =
+        engine_t::free_to_bound_jacobian(trf, free_vec);
+
+    // Dense reference
+    const free_matrix<test_algebra> correction =
+        matrix::identity<free_matrix<test_algebra>>() +
+        engine_t::path_correction(pos, dir, dtds, dqopds, trf);
+    const bound_matrix<test_algebra> ref =
+        free_to_bound * (correction * (transport * bound_to_free));
+
+    const bound_matrix<test_algebra> J = engine_t::bound_to_bound_jacobian(
+        free_to_bound, transport, bound_to_free, pos, dir, dtds, dqopds, trf);
+
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(getter::element(J, i, j), getter::element(ref, i, j),
+                        isclose)
+                << "element (" << i << ", " << j << ")";
+        }
+    }
+}
+
+}  // anonymous namespace
+
+// This tests the bound-to-bound jacobian for all local frames
+GTEST_TEST(detray_propagator, bound_to_bound_jacobian) {
+
+    const transform3 trf(point3{1.f, 0.5f, 0.5f}, vector3{0.f, 0.f, 1.f},
+                         vector3{1.f, 0.f, 0.f});
+
+    test_bound_to_bound<cartesian2D<test_algebra>>(trf);
+    test_bound_to_bound<polar2D<test_algebra>>(trf);
+    test_bound_to_bound<cylindrical2D<test_algebra>>(trf);
+    test_bound_to_bound<line2D<test_algebra>>(trf);
+}
@@ -0,0 +1,111 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/cached_field.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using vector3 = test::vector3;
+
+namespace {
+
+using bfield_t = bfield::const_field_t<scalar>;
+using field_view_t = typename bfield_t::view_t;
+using cached_field_t = cached_field<field_view_t, scalar>;
+
+}  // namespace
+
+/// Test the lookup bookkeeping of the field cache
+GTEST_TEST(detray_propagator, cached_field) {
+
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    const bfield_t const_bfield = bfield::create_const_field<scalar>(B);
+
+    const cached_field_t field{field_view_t{const_bfield},
+                               0.1f * unit<scalar>::mm};
+
+    EXPECT_EQ(field.n_hits(), 0u);
+    EXPECT_EQ(field.n_misses(), 0u);
+
+    // First lookup always queries the field
+    auto bvec = field.at(1.f, 2.f, 3.f);
+    EXPECT_EQ(field.n_misses(), 1u);
+    EXPECT_FLOAT_EQ(bvec[2], B[2]);
+
+    // Inside the tolerance
+    bvec = field.at(1.05f, 2.f, 3.f);
+    EXPECT_EQ(field.n_hits(), 1u);
+    EXPECT_FLOAT_EQ(bvec[2], B[2]);
+
+    // Outside the tolerance
+    field.at(1.f, 2.f, 4.f);
+    EXPECT_EQ(field.n_hits(), 1u);
+    EXPECT_EQ(field.n_misses(), 2u);
+
+    // Same position, but the cache was dropped
+    field.invalidate();
+    field.at(1.f, 2.f, 4.f);
+    EXPECT_EQ(field.n_hits(), 1u);
+    EXPECT_EQ(field.n_misses(), 3u);
+}
+
+/// Compare the RK stepping with and without field cache
+GTEST_TEST(detray_propagator, rk_stepper_cached_field) {
+
+    using rk_stepper_t = rk_stepper<field_view_t, test_algebra>;
+    using cached_rk_stepper_t = rk_stepper<cached_field_t, test_algebra>;
+
+    const vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+                    1.f * unit<scalar>::T};
+    const bfield_t const_bfield = bfield::create_const_field<scalar>(B);
+
+    // The field is constant, so a large tolerance does not change the result
+    const cached_field_t field{field_view_t{const_bfield},
+                               1.f * unit<scalar>::m};
+
+    const stepping::config step_cfg{};
+    constexpr scalar step_size{1.f * unit<scalar>::mm};
+
+    rk_stepper_t rk_stepper;
+    cached_rk_stepper_t cached_rk_stepper;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             10u, 10u, 10.f * unit<scalar>::GeV)) {
+
+        rk_stepper_t::state rk_state{track, field_view_t{const_bfield}};
+        cached_rk_stepper_t::state cached_state{track, field};
+
+        for (unsigned int i_s = 0u; i_s < 100u; i_s++) {
+            rk_stepper.step(step_size, rk_state, step_cfg, true);
+            cached_rk_stepper.step(step_size, cached_state, step_cfg, true);
+        }
+
+        EXPECT_EQ(rk_state(), cached_state());
+
+        // Only the first lookup had to query the field
+        const auto state_field = cached_state.field();
+        EXPECT_EQ(state_field.n_misses(), 1u);
+        EXPECT_GT(state_field.n_hits(), 0u);
+    }
+}
@@ -0,0 +1,282 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/dormand_prince_stepper.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/tracks/trajectories.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using vector3 = test::vector3;
+using point3 = test::point3;
+
+namespace {
+
+constexpr scalar tol{1e-3f};
+
+const stepping::config step_cfg{};
+
+/// Field that returns the same value everywhere, but is not flagged as
+/// constant, so that the steppers integrate the jacobian numerically
+struct uniform_field {
+    vector3 m_b;
+
+    DETRAY_HOST_DEVICE
+    vector3 at(scalar, scalar, scalar) const { return m_b; }
+};
+
+}  // namespace
+
+// This tests the base functionality of the Dormand-Prince stepper
+GTEST_TEST(detray_propagator, dormand_prince_stepper) {
+    using namespace step;
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using dp_stepper_t = dormand_prince_stepper<bfield_t::view_t, test_algebra>;
+    using cdp_stepper_t = dormand_prince_stepper<bfield_t::view_t, test_algebra,
+                                                 constrained_step<scalar>>;
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    dp_stepper_t dp_stepper;
+    cdp_stepper_t cdp_stepper;
+
+    constexpr unsigned int n_steps = 100u;
+    constexpr scalar step_size{1.f * unit<scalar>::mm};
+    constexpr scalar stepsize_constr{0.5f * unit<scalar>::mm};
+
+    // Track generator configuration
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 20u;
+    constexpr unsigned int phi_steps = 20u;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        // helix trajectory
+        detail::helix helix(track, B);
+
+        dp_stepper_t::state dp_state{track, hom_bfield};
+        cdp_stepper_t::state cdp_state{track, hom_bfield};
+
+        cdp_state.template set_constraint<constraint::e_user>(stepsize_constr);
+
+        // Forward stepping
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            dp_stepper.step(step_size, dp_state, step_cfg, true);
+            cdp_stepper.step(step_size, cdp_state, step_cfg, true);
+            cdp_stepper.step(step_size, cdp_state, step_cfg, true);
+        }
+
+        const scalar path_length{dp_state.path_length()};
+        ASSERT_NEAR(path_length, n_steps * step_size, tol);
+        ASSERT_NEAR(cdp_state.path_length(), path_length, tol);
+
+        // The field of the last stage is reused by the subsequent steps
+        EXPECT_EQ(dp_state.n_reused_lookups(), n_steps - 1u);
+        EXPECT_EQ(cdp_state.n_reused_lookups(), 2u * n_steps - 1u);
+
+        // Both stepper states lie on the truth helix
+        EXPECT_NEAR(
+            vector::norm(dp_state().pos() - helix(path_length)) / path_length,
+            0.f, tol);
+        EXPECT_NEAR(
+            vector::norm(cdp_state().pos() - helix(path_length)) / path_length,
+            0.f, tol);
+        EXPECT_NEAR(vector::norm(dp_state().dir() - helix.dir(path_length)),
+                    0.f, tol);
+
+        // Roll the same track back to the origin
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            dp_stepper.step(-step_size, dp_state, step_cfg, true);
+        }
+
+        ASSERT_NEAR(dp_state.path_length(), 0.f, tol);
+        EXPECT_NEAR(vector::norm(dp_state().pos()) / (2.f * path_length), 0.f,
+                    tol);
+    }
+}
+
+// Compare the number of steps with the Runge-Kutta stepper
+GTEST_TEST(detray_propagator, dormand_prince_vs_rk_stepper) {
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using dp_stepper_t = dormand_prince_stepper<bfield_t::view_t, test_algebra>;
+    using rk_stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    dp_stepper_t dp_stepper;
+    rk_stepper_t rk_stepper;
+
+    // Low momentum tracks that are strongly bent
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>>;
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.theta_range(0.5f, 2.5f).theta_steps(10u).phi_steps(10u);
+    trk_gen_cfg.p_tot(0.5f * unit<scalar>::GeV);
+
+    constexpr scalar path{1.f * unit<scalar>::m};
+
+    // Limit the distance of the steps to their initial tangent
+    stepping::config clamped_cfg{};
+    clamped_cfg.max_step_deviation = 1.f * unit<float>::mm;
+
+    std::size_t n_dp_trials{0u};
+    std::size_t n_clamped_trials{0u};
+    for (auto track : generator_t(trk_gen_cfg)) {
+
+        detail::helix helix(track, B);
+
+        dp_stepper_t::state dp_state{track, hom_bfield};
+        dp_stepper_t::state clamped_state{track, hom_bfield};
+        rk_stepper_t::state rk_state{track, hom_bfield};
+
+        // Let the adaptive step size control run over the full path
+        while (dp_state.path_length() < path - tol) {
+            dp_stepper.step(path - dp_state.path_length(), dp_state, step_cfg,
+                            false);
+        }
+        while (clamped_state.path_length() < path - tol) {
+            dp_stepper.step(path - clamped_state.path_length(), clamped_state,
+                            clamped_cfg, false);
+        }
+        while (rk_state.path_length() < path - tol) {
+            rk_stepper.step(path - rk_state.path_length(), rk_state, step_cfg,
+                            false);
+        }
+
+        ASSERT_NEAR(dp_state.path_length(), path, tol);
+        ASSERT_NEAR(clamped_state.path_length(), path, tol);
+        ASSERT_NEAR(rk_state.path_length(), path, tol);
+
+        // Same precision with fewer step trials
+        EXPECT_NEAR(vector::norm(dp_state().pos() - helix(path)) / path, 0.f,
+                    tol);
+        EXPECT_NEAR(vector::norm(clamped_state().pos() - helix(path)) / path,
+                    0.f, tol);
+        EXPECT_NEAR(vector::norm(rk_state().pos() - helix(path)) / path, 0.f,
+                    tol);
+        EXPECT_LT(dp_state.n_total_trials(), rk_state.n_total_trials());
+        EXPECT_LE(dp_state.n_total_trials(), clamped_state.n_total_trials());
+
+        n_dp_trials += dp_state.n_total_trials();
+        n_clamped_trials += clamped_state.n_total_trials();
+    }
+
+    // The step deviation limit costs steps
+    EXPECT_LT(n_dp_trials, n_clamped_trials);
+}
+
+// Check the numerically integrated jacobian against the helix jacobian
+GTEST_TEST(detray_propagator, dormand_prince_stepper_jacobian) {
+
+    using dp_stepper_t = dormand_prince_stepper<uniform_field, test_algebra>;
+
+    const vector3 B{0.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+    const uniform_field field{B};
+
+    dp_stepper_t dp_stepper;
+
+    constexpr unsigned int n_steps = 20u;
+    constexpr scalar step_size{10.f * unit<scalar>::mm};
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 5u;
+    constexpr unsigned int phi_steps = 5u;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        dp_stepper_t::state dp_state{track, field};
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            dp_stepper.step(step_size, dp_state, step_cfg, true);
+        }
+
+        // The free transport along the helix composes over the steps
+        const detail::helix helix(track, B);
+        const auto helix_jac = helix.jacobian(dp_state.path_length());
+        const auto& dp_jac = dp_state.transport_jacobian();
+
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                EXPECT_NEAR(getter::element(dp_jac, i, j),
+                            getter::element(helix_jac, i, j), 1e-2f)
+                    << "(" << i << ", " << j << ")";
+            }
+        }
+    }
+}
+
+// Compare the energy loss with the Runge-Kutta stepper
+GTEST_TEST(detray_propagator, dormand_prince_stepper_eloss) {
+
+    using bfield_t = bfield::const_field_t<scalar>;
+    using dp_stepper_t = dormand_prince_stepper<bfield_t::view_t, test_algebra>;
+    using rk_stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    constexpr material<scalar> vol_mat{
+        detray::cesium_iodide_with_ded<scalar>()};
+
+    dp_stepper_t dp_stepper;
+    rk_stepper_t rk_stepper;
+
+    constexpr unsigned int n_steps = 100u;
+    constexpr scalar step_size{1.f * unit<scalar>::mm};
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 5u;
+    constexpr unsigned int phi_steps = 5u;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        dp_stepper_t::state dp_state{track, hom_bfield};
+        rk_stepper_t::state rk_state{track, hom_bfield};
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            dp_stepper.step(step_size, dp_state, step_cfg, true, &vol_mat);
+            rk_stepper.step(step_size, rk_state, step_cfg, true, &vol_mat);
+        }
+
+        ASSERT_TRUE(dp_state().qop() < track.qop());
+        EXPECT_NEAR(dp_state().qop(), rk_state().qop(),
+                    1e-4f * math::fabs(track.qop()));
+        EXPECT_NEAR(vector::norm(dp_state().pos() - rk_state().pos()) /
+                        dp_state.path_length(),
+                    0.f, tol);
+    }
+}
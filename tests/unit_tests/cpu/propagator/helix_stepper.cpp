@@ -0,0 +1,192 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/helix_stepper.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/tracks/trajectories.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using vector3 = test::vector3;
+using point3 = test::point3;
+
+namespace {
+
+constexpr scalar tol{1e-3f};
+
+const stepping::config step_cfg{};
+
+using bfield_t = bfield::const_field_t<scalar>;
+
+using helix_stepper_t = helix_stepper<bfield_t::view_t, test_algebra>;
+using chelix_stepper_t =
+    helix_stepper<bfield_t::view_t, test_algebra, constrained_step<scalar>>;
+using rk_stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+
+}  // namespace
+
+// This tests the base functionality of the helix stepper
+GTEST_TEST(detray_propagator, helix_stepper) {
+    using namespace step;
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    helix_stepper_t h_stepper;
+    chelix_stepper_t ch_stepper;
+
+    constexpr scalar path{100.f * unit<scalar>::mm};
+    constexpr scalar stepsize_constr{0.5f * unit<scalar>::mm};
+
+    // Track generator configuration
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 50u;
+    constexpr unsigned int phi_steps = 50u;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        // helix trajectory
+        detail::helix helix(track, B);
+
+        helix_stepper_t::state h_state{track, hom_bfield};
+        chelix_stepper_t::state ch_state{track, hom_bfield};
+
+        ASSERT_NEAR(vector::norm(h_state.b_field() - B), 0.f, tol);
+
+        // The constrained stepper has to take many steps
+        ch_state.template set_constraint<constraint::e_user>(stepsize_constr);
+
+        // The full path is covered in a single step
+        h_stepper.step(path, h_state, step_cfg);
+        ASSERT_EQ(h_state.n_total_trials(), 1u);
+        ASSERT_NEAR(h_state.path_length(), path, tol);
+
+        while (ch_state.path_length() < path - tol) {
+            ch_stepper.step(path - ch_state.path_length(), ch_state, step_cfg);
+        }
+        ASSERT_NEAR(ch_state.path_length(), path, tol);
+        ASSERT_EQ(ch_state.n_total_trials(), 200u);
+
+        // Both states lie on the truth helix
+        EXPECT_NEAR(vector::norm(h_state().pos() - helix(path)) / path, 0.f,
+                    tol);
+        EXPECT_NEAR(vector::norm(ch_state().pos() - helix(path)) / path, 0.f,
+                    tol);
+        EXPECT_NEAR(vector::norm(h_state().dir() - helix.dir(path)), 0.f, tol);
+        EXPECT_NEAR(vector::norm(ch_state().dir() - helix.dir(path)), 0.f,
+                    tol);
+
+        // Step back to the origin
+        h_stepper.step(-path, h_state, step_cfg);
+        ASSERT_NEAR(h_state.path_length(), 0.f, tol);
+        EXPECT_NEAR(vector::norm(h_state().pos() - track.pos()) / path, 0.f,
+                    tol);
+        EXPECT_NEAR(vector::norm(h_state().dir() - track.dir()), 0.f, tol);
+    }
+}
+
+// Compare the helix stepper with the Runge-Kutta stepper
+GTEST_TEST(detray_propagator, helix_stepper_vs_rk_stepper) {
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    helix_stepper_t h_stepper;
+    rk_stepper_t rk_stepper;
+
+    constexpr unsigned int n_steps = 100u;
+    constexpr scalar step_size{1.f * unit<scalar>::mm};
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        helix_stepper_t::state h_state{track, hom_bfield};
+        rk_stepper_t::state rk_state{track, hom_bfield};
+
+        for (unsigned int i_s = 0u; i_s < n_steps; i_s++) {
+            h_stepper.step(step_size, h_state, step_cfg);
+            rk_stepper.step(step_size, rk_state, step_cfg, true);
+        }
+
+        const scalar path_length{rk_state.path_length()};
+        ASSERT_NEAR(h_state.path_length(), path_length, tol);
+
+        EXPECT_NEAR(vector::norm(h_state().pos() - rk_state().pos()) /
+                        path_length,
+                    0.f, tol);
+        EXPECT_NEAR(vector::norm(h_state().dir() - rk_state().dir()), 0.f,
+                    tol);
+        EXPECT_NEAR(vector::norm(h_state.dtds() - rk_state.dtds()), 0.f, tol);
+
+        // Both steppers use the helix jacobian in a constant field
+        const auto& h_jac = h_state.transport_jacobian();
+        const auto& rk_jac = rk_state.transport_jacobian();
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                EXPECT_NEAR(getter::element(h_jac, i, j),
+                            getter::element(rk_jac, i, j), tol)
+                    << "(" << i << ", " << j << ")";
+            }
+        }
+    }
+}
+
+// The helix stepper moves the track in a straight line without field
+GTEST_TEST(detray_propagator, helix_stepper_zero_field) {
+
+    const bfield_t zero_bfield =
+        bfield::create_const_field<scalar>(vector3{0.f, 0.f, 0.f});
+
+    helix_stepper_t h_stepper;
+
+    point3 pos{0.f, 0.f, 0.f};
+    vector3 mom{1.f, 1.f, 0.f};
+    free_track_parameters<test_algebra> track(pos, 0.f, mom, -1.f);
+
+    helix_stepper_t::state h_state{track, zero_bfield};
+    ASSERT_FALSE(h_state.is_curved());
+
+    constexpr scalar step_size{10.f * unit<scalar>::mm};
+    h_stepper.step(step_size, h_state, step_cfg);
+
+    const vector3 dir = vector::normalize(mom);
+    EXPECT_NEAR(vector::norm(h_state().pos() - step_size * dir), 0.f, tol);
+    EXPECT_NEAR(vector::norm(h_state().dir() - dir), 0.f, tol);
+
+    // d(x,y,z)/d(n_x,n_y,n_z)
+    const auto& jac = h_state.transport_jacobian();
+    EXPECT_NEAR(getter::element(jac, e_free_pos0, e_free_dir0), step_size,
+                tol);
+    EXPECT_NEAR(getter::element(jac, e_free_pos1, e_free_dir1), step_size,
+                tol);
+    EXPECT_NEAR(getter::element(jac, e_free_pos2, e_free_dir2), step_size,
+                tol);
+}
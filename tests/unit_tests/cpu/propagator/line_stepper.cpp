@@ -101,3 +101,47 @@ GTEST_TEST(detray_propagator, line_stepper) {
     ASSERT_NEAR(track.pos()[1], constant<scalar>::sqrt2, tol);
     ASSERT_NEAR(track.pos()[2], 0.f, tol);
 }
+
+// This tests that the path length and position do not drift over many steps
+GTEST_TEST(detray_propagator, line_stepper_compensated_accumulation) {
+
+    using line_stepper_t =
+        line_stepper<test_algebra, unconstrained_step<scalar>,
+                     stepper_default_policy<scalar>, stepping::void_inspector,
+                     stepping::compensated_storage>;
+
+    // The compensation is opt-in
+    static_assert(line_stepper_t::has_compensated_sum);
+    static_assert(!line_stepper<test_algebra>::has_compensated_sum);
+    static_assert(sizeof(line_stepper<test_algebra>::state) <
+                  sizeof(line_stepper_t::state));
+
+    const vector3 dir{1.f, 0.f, 0.f};
+    free_track_parameters<test_algebra> track(point3{0.f, 0.f, 0.f}, 0.f,
+                                              dir, -1.f);
+
+    line_stepper_t l_stepper;
+    line_stepper_t::state l_state{track};
+
+    // Many small steps: One metre in steps of ten micrometre
+    constexpr unsigned int n_steps{100000u};
+    constexpr scalar small_step{10.f * unit<scalar>::um};
+    for (unsigned int i = 0u; i < n_steps; ++i) {
+        ASSERT_TRUE(l_stepper.step(small_step, l_state, step_cfg));
+    }
+
+    // A naive summation in single precision is off by more than half a mm
+    const scalar expected{static_cast<scalar>(n_steps) * small_step};
+    EXPECT_NEAR(l_state.path_length(), expected, 1.f * unit<scalar>::um);
+    EXPECT_NEAR(l_state.abs_path_length(), expected, 1.f * unit<scalar>::um);
+    EXPECT_NEAR(l_state().pos()[0], expected, 1.f * unit<scalar>::um);
+
+    // The compensation of the position is dropped, when the position is set
+    l_state().set_pos(point3{0.f, 0.f, 0.f});
+    for (unsigned int i = 0u; i < n_steps; ++i) {
+        ASSERT_TRUE(l_stepper.step(small_step, l_state, step_cfg));
+    }
+    EXPECT_NEAR(l_state().pos()[0], expected, 1.f * unit<scalar>::um);
+    EXPECT_NEAR(l_state.path_length(), 2.f * expected,
+                2.f * unit<scalar>::um);
+}
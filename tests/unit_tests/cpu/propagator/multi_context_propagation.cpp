@@ -0,0 +1,212 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/actors/multi_context_intersector.hpp"
+
+#include "detray/builders/cuboid_portal_generator.hpp"
+#include "detray/builders/detector_builder.hpp"
+#include "detray/core/detail/delta_store.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/telescope_metadata.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/factories/telescope_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+
+constexpr scalar tol{1e-4f};
+
+/// Telescope metadata that keeps only the transforms that change per context
+struct aligned_tel_metadata : public telescope_metadata<test_algebra> {
+    template <template <typename...> class vector_t = dvector>
+    using transform_store = delta_store<transform3, vector_t, geometry_context>;
+};
+
+using detector_t = detector<aligned_tel_metadata>;
+using context_t = typename detector_t::geometry_context;
+
+/// Build a telescope of five planes along the z-axis
+detector_t build_aligned_telescope(vecmem::memory_resource &mr) {
+
+    using builder_t = detector_builder<aligned_tel_metadata, volume_builder>;
+    using factory_t =
+        telescope_generator<detector_t, rectangle2D, detail::ray<test_algebra>>;
+
+    builder_t det_builder;
+
+    auto v_builder = det_builder.new_volume(volume_id::e_cuboid);
+    v_builder->add_volume_placement();
+
+    const std::vector<scalar> positions{20.f, 50.f, 100.f, 150.f, 180.f};
+    v_builder->add_surfaces(std::make_shared<factory_t>(
+        positions, rectangle2D::bounds_type<scalar>{20.f, 20.f},
+        detail::ray<test_algebra>{}));
+    v_builder->add_surfaces(
+        std::make_shared<cuboid_portal_generator<detector_t>>(
+            20.f * unit<scalar>::mm));
+
+    det_builder.set_volume_finder(mr);
+    det_builder.volume_finder().push_back(
+        std::vector<dindex>{v_builder->vol_index()});
+
+    return det_builder.build(mr);
+}
+
+/// @returns a geometry context in @param det, in which the sensitive surface
+/// number @param i is shifted by @param shift
+context_t shift_plane(detector_t &det, const dindex i, const vector3 &shift) {
+
+    dindex n_sens{0u};
+    for (const auto &sf_desc : det.surfaces()) {
+        const geometry::surface sf{det, sf_desc};
+        if (!sf.is_sensitive() || n_sens++ != i) {
+            continue;
+        }
+        const transform3 &trf = sf.transform(context_t{});
+        return det.add_geometry_context(
+            {{sf_desc.transform(),
+              transform3{trf.translation() + shift, trf.z(), trf.x()}}});
+    }
+    return context_t{};
+}
+
+/// Record the path lengths of the sensitive surfaces on the track
+struct path_recorder : actor {
+
+    static constexpr actor_trigger trigger{actor_trigger::e_on_surface};
+
+    struct state {
+        std::vector<std::pair<geometry::barcode, scalar>> points{};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &actor_state,
+                    const propagator_state_t &propagation) const {
+        if (propagation._navigation.is_on_sensitive()) {
+            actor_state.points.emplace_back(
+                propagation._navigation.barcode(),
+                propagation._stepping.abs_path_length());
+        }
+    }
+};
+
+using stepper_t = line_stepper<test_algebra>;
+using navigator_t = navigator<detector_t>;
+
+}  // anonymous namespace
+
+/// Propagate a track through several alignment contexts in one pass
+GTEST_TEST(detray_propagator, multi_context_propagation) {
+
+    vecmem::host_memory_resource host_mr;
+    detector_t det = build_aligned_telescope(host_mr);
+
+    // Shift the planes along and across the telescope
+    constexpr std::size_t n_contexts{4u};
+    const darray<context_t, n_contexts> contexts{
+        // Small shift along the telescope: Same navigation
+        shift_plane(det, 2u, {0.f, 0.f, 0.5f * unit<scalar>::mm}),
+        // Small shift across the telescope: Same navigation
+        shift_plane(det, 3u, {0.2f * unit<scalar>::mm, 0.f, 0.f}),
+        // The second plane moves behind the third plane
+        shift_plane(det, 1u, {0.f, 0.f, 60.f * unit<scalar>::mm}),
+        // The last plane moves out of the track
+        shift_plane(det, 4u, {30.f * unit<scalar>::mm, 0.f, 0.f})};
+    ASSERT_EQ(det.transform_store().n_contexts(), n_contexts);
+
+    const free_track_parameters<test_algebra> track(
+        {0.f, 0.f, 10.f * unit<scalar>::mm}, 0.f,
+        vector3{0.01f, 0.02f, 1.f}, -1.f);
+
+    // Propagate once in the nominal context and share the navigation
+    using multi_ctx_t = multi_context_intersector<detector_t, n_contexts>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain<multi_ctx_t>>;
+
+    vecmem::data::vector_buffer<typename multi_ctx_t::record> rec_buffer{
+        100u, host_mr, vecmem::data::buffer_type::resizable};
+    vecmem::copy{}.setup(rec_buffer)->wait();
+
+    typename multi_ctx_t::state multi_ctx_state(
+        contexts, vecmem::device_vector<typename multi_ctx_t::record>(
+                      rec_buffer));
+
+    propagator_t p{propagation::config{}};
+    typename propagator_t::state propagation(track, det, context_t{});
+    ASSERT_TRUE(p.propagate(propagation, detray::tie(multi_ctx_state)));
+
+    EXPECT_FALSE(multi_ctx_state.overflow);
+    EXPECT_FALSE(multi_ctx_state.is_diverged(0u));
+    EXPECT_FALSE(multi_ctx_state.is_diverged(1u));
+    EXPECT_TRUE(multi_ctx_state.is_diverged(2u));
+    EXPECT_TRUE(multi_ctx_state.is_diverged(3u));
+    EXPECT_EQ(multi_ctx_state.n_diverged(), 2u);
+
+    // Compare with a separate propagation per context
+    using ref_propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain<path_recorder>>;
+    const ref_propagator_t ref_p{propagation::config{}};
+
+    for (std::size_t i = 0u; i < n_contexts; ++i) {
+
+        path_recorder::state recorder{};
+        typename ref_propagator_t::state ref_propagation(track, det,
+                                                         contexts[i]);
+        ASSERT_TRUE(ref_p.propagate(ref_propagation, detray::tie(recorder)));
+        ASSERT_EQ(recorder.points.size(), i == 3u ? 4u : 5u);
+
+        std::vector<std::pair<geometry::barcode, scalar>> points{};
+        for (const auto &rec : multi_ctx_state._sequence) {
+            if (rec.context_idx == i) {
+                points.emplace_back(rec.barcode, rec.path_length);
+            }
+        }
+
+        // The records of diverged contexts are incomplete
+        if (multi_ctx_state.is_diverged(i)) {
+            EXPECT_LT(points.size(), 5u);
+            continue;
+        }
+
+        ASSERT_EQ(points.size(), recorder.points.size());
+        for (std::size_t j = 0u; j < points.size(); ++j) {
+            EXPECT_EQ(points[j].first, recorder.points[j].first);
+            EXPECT_NEAR(points[j].second, recorder.points[j].second, tol);
+        }
+    }
+}
@@ -0,0 +1,269 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/parallel_propagation.hpp"
+
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/barcode_sequencer.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_buffer.hpp>
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Counts the sensitive surfaces and records the path length of a track
+struct surface_counter : actor {
+
+    struct state {
+        std::size_t n_sensitives{0u};
+        test::scalar path_length{0.f};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &counter_state,
+                    const propagator_state_t &propagation) const {
+        counter_state.path_length = propagation._stepping.path_length();
+
+        if (propagation._navigation.is_on_sensitive()) {
+            ++counter_state.n_sensitives;
+        }
+    }
+};
+
+}  // namespace
+
+/// Check that stolen and owned index ranges cover every track exactly once
+GTEST_TEST(detray_propagator, parallel_work_range) {
+
+    propagation::detail::work_range range{};
+    range.assign(0u, 10u);
+
+    std::uint32_t begin{0u};
+    std::uint32_t end{0u};
+
+    ASSERT_TRUE(range.pop_front(3u, begin, end));
+    EXPECT_EQ(begin, 0u);
+    EXPECT_EQ(end, 3u);
+
+    // Steal the back half of the remaining [3, 10)
+    ASSERT_TRUE(range.steal_back(begin, end));
+    EXPECT_EQ(begin, 6u);
+    EXPECT_EQ(end, 10u);
+
+    ASSERT_TRUE(range.pop_front(8u, begin, end));
+    EXPECT_EQ(begin, 3u);
+    EXPECT_EQ(end, 6u);
+
+    EXPECT_FALSE(range.pop_front(1u, begin, end));
+    EXPECT_FALSE(range.steal_back(begin, end));
+}
+
+/// Compare the parallel propagation to the sequential propagation
+GTEST_TEST(detray_propagator, parallel_propagation) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using actor_chain_t = actor_chain<surface_counter>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using actor_states_t = typename actor_chain_t::state_tuple;
+
+    const typename detector_t::geometry_context gctx{};
+
+    std::vector<track_t> tracks{};
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 20u,
+                                          /*theta_steps*/ 20u)) {
+        tracks.push_back(track);
+    }
+    const std::size_t n_tracks{tracks.size()};
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    // Sequential reference
+    std::vector<actor_states_t> ref_states(n_tracks);
+    std::size_t n_ref_success{0u};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        typename propagator_t::state propagation(tracks[i], toy_det, gctx);
+        propagation.set_particle(update_particle_hypothesis(
+            propagation._stepping.particle_hypothesis(), tracks[i]));
+
+        n_ref_success += prop.propagate(
+                             propagation,
+                             actor_chain_t::setup_actor_states(ref_states[i]))
+                             ? 1u
+                             : 0u;
+    }
+    ASSERT_EQ(n_ref_success, n_tracks);
+
+    // Parallel propagation with different pool configurations
+    for (const std::size_t n_threads : {1u, 2u, 4u, 7u}) {
+        for (const std::size_t chunk_size : {1u, 8u, 1000u}) {
+            for (const std::size_t n_interleaved : {1u, 3u, 8u}) {
+
+                propagation::parallel_config par_cfg{};
+                par_cfg.n_threads = n_threads;
+                par_cfg.chunk_size = chunk_size;
+                par_cfg.n_interleaved = n_interleaved;
+
+                std::vector<actor_states_t> states(n_tracks);
+                const std::size_t n_success = propagation::parallel_propagate(
+                    prop, toy_det, std::span<const track_t>{tracks},
+                    std::span<actor_states_t>{states}, par_cfg, gctx);
+
+                ASSERT_EQ(n_success, n_ref_success)
+                    << "threads: " << n_threads << ", chunk: " << chunk_size
+                    << ", interleaved: " << n_interleaved;
+
+                for (std::size_t i = 0u; i < n_tracks; ++i) {
+                    const auto &ref = detail::get<0>(ref_states[i]);
+                    const auto &res = detail::get<0>(states[i]);
+
+                    EXPECT_EQ(ref.n_sensitives, res.n_sensitives)
+                        << "track " << i;
+                    EXPECT_FLOAT_EQ(ref.path_length, res.path_length)
+                        << "track " << i;
+                }
+            }
+        }
+    }
+
+    // Default constructed actor states for every track
+    std::size_t n_success = propagation::parallel_propagate(
+        prop, toy_det, std::span<const track_t>{tracks});
+    EXPECT_EQ(n_success, n_ref_success);
+
+    propagation::parallel_config interleaved_cfg{};
+    interleaved_cfg.n_interleaved = 4u;
+    n_success = propagation::parallel_propagate(
+        prop, toy_det, std::span<const track_t>{tracks}, {}, interleaved_cfg);
+    EXPECT_EQ(n_success, n_ref_success);
+}
+
+/// Record the surface sequence of every track into buffers from the arena
+GTEST_TEST(detray_propagator, parallel_propagation_arena) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using actor_chain_t = actor_chain<barcode_sequencer>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const typename detector_t::geometry_context gctx{};
+
+    std::vector<track_t> tracks{};
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+        tracks.push_back(track);
+    }
+    const std::size_t n_tracks{tracks.size()};
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    // Run once with and once without the arena
+    std::vector<std::vector<std::size_t>> n_recorded(2u);
+    for (const std::size_t arena_size : {0u, 4096u}) {
+
+        propagation::parallel_config par_cfg{};
+        par_cfg.n_threads = 4u;
+        par_cfg.arena_size = arena_size;
+
+        auto &result = n_recorded[arena_size > 0u ? 1u : 0u];
+        result.resize(n_tracks, 0u);
+
+        auto propagate_track = [&result](
+                                   const propagator_t &p, const std::size_t i,
+                                   typename propagator_t::state &propagation,
+                                   vecmem::memory_resource &mr) {
+            // Per-track buffer from the worker arena
+            vecmem::data::vector_buffer<geometry::barcode> seq_buffer{
+                100u, mr, vecmem::data::buffer_type::resizable};
+            vecmem::copy{}.setup(seq_buffer)->wait();
+
+            vecmem::device_vector<geometry::barcode> sequence(seq_buffer);
+            barcode_sequencer::state seq_state(sequence);
+            const bool success =
+                p.propagate(propagation, detray::tie(seq_state));
+
+            EXPECT_FALSE(seq_state.overflow);
+            result[i] = seq_state._sequence.size();
+
+            return success;
+        };
+
+        const std::size_t n_success = propagation::parallel_propagate(
+            prop, toy_det, std::span<const track_t>{tracks}, propagate_track,
+            par_cfg, gctx);
+
+        EXPECT_EQ(n_success, n_tracks);
+    }
+
+    EXPECT_EQ(n_recorded[0], n_recorded[1]);
+}
+
+/// Exceptions of the workers are rethrown after all threads were joined
+GTEST_TEST(detray_propagator, parallel_propagation_errors) {
+
+    constexpr std::size_t n_threads{4u};
+
+    for (std::size_t failing = 0u; failing < n_threads; ++failing) {
+        std::atomic<std::size_t> n_finished{0u};
+
+        auto worker = [&](const std::size_t thread_idx) {
+            if (thread_idx == failing) {
+                throw std::runtime_error("worker failed");
+            }
+            n_finished.fetch_add(1u);
+        };
+
+        EXPECT_THROW(propagation::run_pool(n_threads, worker),
+                     std::runtime_error);
+        // The other workers ran to completion
+        EXPECT_EQ(n_finished.load(), n_threads - 1u);
+    }
+}
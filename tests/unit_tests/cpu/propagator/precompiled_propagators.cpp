@@ -0,0 +1,113 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/precompiled/propagators.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <type_traits>
+
+using namespace detray;
+
+using algebra_t = precompiled::algebra;
+using scalar = precompiled::scalar;
+using track_t = free_track_parameters<algebra_t>;
+
+constexpr scalar tol{1e-5f};
+
+/// Compare the precompiled straight line propagation with the header-only
+/// propagation
+GTEST_TEST(detray_propagator, precompiled_line_propagation) {
+
+    using propagator_t =
+        precompiled::propagator_type<precompiled::toy_detector,
+                                     precompiled::line_stepper_type,
+                                     precompiled::empty_chain>;
+
+    static_assert(precompiled::is_precompiled_v<propagator_t>);
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<algebra_t>(host_mr);
+
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(toy_det)>,
+                                 precompiled::toy_detector>);
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+
+        typename propagator_t::state ref_state(track, toy_det);
+        typename propagator_t::state state(track, toy_det);
+
+        ASSERT_TRUE(prop.propagate(
+            ref_state, precompiled::empty_chain::state_ref_tuple{}));
+        ASSERT_TRUE(precompiled::propagate(prop, state));
+
+        EXPECT_NEAR(state._stepping.path_length(),
+                    ref_state._stepping.path_length(), tol);
+        EXPECT_EQ(state._stepping.n_total_trials(),
+                  ref_state._stepping.n_total_trials());
+    }
+}
+
+/// Compare the precompiled propagation in a constant magnetic field with the
+/// header-only propagation
+GTEST_TEST(detray_propagator, precompiled_rk_propagation) {
+
+    using chain_t = precompiled::default_chain;
+    using propagator_t = precompiled::propagator_type<
+        precompiled::toy_detector,
+        precompiled::rk_stepper_type<precompiled::const_field_view>, chain_t>;
+
+    static_assert(precompiled::is_precompiled_v<propagator_t>);
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<algebra_t>(host_mr);
+
+    const auto bfield = bfield::create_const_field<scalar>(
+        {0.f * unit<scalar>::T, 0.f * unit<scalar>::T, 2.f * unit<scalar>::T});
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+
+        typename propagator_t::state ref_state(track, bfield, toy_det);
+        typename propagator_t::state state(track, bfield, toy_det);
+
+        typename chain_t::state_tuple ref_actor_states{};
+        typename chain_t::state_tuple actor_states{};
+
+        ASSERT_TRUE(prop.propagate(
+            ref_state, chain_t::setup_actor_states(ref_actor_states)));
+        ASSERT_TRUE(precompiled::propagate(
+            prop, state, chain_t::setup_actor_states(actor_states)));
+
+        EXPECT_NEAR(state._stepping.path_length(),
+                    ref_state._stepping.path_length(), tol);
+        EXPECT_EQ(state._stepping.n_total_trials(),
+                  ref_state._stepping.n_total_trials());
+    }
+}
@@ -0,0 +1,117 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/propagation_timer.hpp"
+
+#include "detray/definitions/containers.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+#include "detray/test/validation/step_tracer.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <sstream>
+#include <type_traits>
+
+using namespace detray;
+
+using scalar = test::scalar;
+
+/// Time the phases of the propagation through the toy detector
+GTEST_TEST(detray_propagator, propagation_timer) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using step_tracer_t = step_tracer<test_algebra, dvector>;
+    using actor_chain_t =
+        actor_chain<pathlimit_aborter<scalar>, step_tracer_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t,
+                                    propagation::phase_timer>;
+    using untimed_propagator_t =
+        propagator<stepper_t, navigator_t, actor_chain_t>;
+    using propagation::phase;
+
+    // The default timer does not add to the propagation state
+    static_assert(std::is_same_v<typename untimed_propagator_t::timer_type,
+                                 propagation::void_timer>);
+    static_assert(std::is_empty_v<propagation::void_timer>);
+
+    const typename detector_t::geometry_context gctx{};
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+    const untimed_propagator_t untimed_prop{prop_cfg};
+
+    propagation::timing_record total{};
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+
+        pathlimit_aborter<scalar>::state aborter_state{};
+        step_tracer_t::state tracer_state{host_mr};
+
+        typename propagator_t::state propagation(track, toy_det, gctx);
+        ASSERT_TRUE(prop.propagate(propagation,
+                                   detray::tie(aborter_state, tracer_state)));
+
+        const auto &rec = propagation._timer.record();
+        const auto n_steps{tracer_state.get_step_data().size()};
+
+        EXPECT_EQ(rec.calls(phase::e_init), 1u);
+        // The tracer also records the initial state
+        EXPECT_EQ(rec.calls(phase::e_stepper) + 1u, n_steps);
+        EXPECT_GT(rec.calls(phase::e_actors), rec.calls(phase::e_stepper));
+        EXPECT_GT(rec.calls(phase::e_update_high_trust) +
+                      rec.calls(phase::e_update_fair_trust) +
+                      rec.calls(phase::e_update_full_trust),
+                  0u);
+        EXPECT_GT(rec.total_time(), 0u);
+        EXPECT_GT(rec.actor_ns[0] + rec.actor_ns[1], 0u);
+        EXPECT_LE(rec.actor_ns[0] + rec.actor_ns[1], rec.time(phase::e_actors));
+        EXPECT_EQ(rec.actor_ns[2], 0u);
+
+        // Same result without the timer
+        step_tracer_t::state untimed_tracer_state{host_mr};
+        typename untimed_propagator_t::state untimed_propagation(track,
+                                                                 toy_det, gctx);
+        ASSERT_TRUE(untimed_prop.propagate(
+            untimed_propagation,
+            detray::tie(aborter_state, untimed_tracer_state)));
+        EXPECT_EQ(untimed_tracer_state.get_step_data().size(), n_steps);
+
+        total += rec;
+    }
+
+    EXPECT_GE(total.calls(phase::e_init), 100u);
+    EXPECT_GT(total.total_time(), 0u);
+
+    std::stringstream out;
+    out << total;
+    EXPECT_FALSE(out.str().empty());
+}
@@ -24,6 +24,8 @@
 
 // System include(s)
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 // google-test include(s)
 #include <gtest/gtest.h>
@@ -218,6 +220,53 @@ TEST(detray_propagator, rk_stepper_inhomogeneous_bfield) {
     }
 }
 
+/// This tests the Runge-Kutta stepper in an inhomogeneous magnetic field with
+/// half precision storage against the single precision field
+TEST(detray_propagator, rk_stepper_inhomogeneous_bfield_fp16) {
+    using namespace step;
+
+    // Read the magnetic field map
+    using bfield_t = bfield::inhom_field_t<float>;
+    using bfield_fp16_t = bfield::inhom_field_fp16_t;
+    bfield_t inhom_bfield = bfield::create_inhom_field<float>();
+    bfield_fp16_t inhom_bfield_fp16{inhom_bfield};
+
+    // RK stepper
+    rk_stepper_t<bfield_t> rk_stepper;
+    rk_stepper_t<bfield_fp16_t> rk_stepper_fp16;
+
+    constexpr unsigned int rk_steps = 100u;
+
+    // Track generator configuration
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    // Iterate through uniformly distributed momentum directions
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        rk_stepper_t<bfield_t>::state rk_state{track, inhom_bfield};
+        rk_stepper_t<bfield_fp16_t>::state rk_state_fp16{track,
+                                                         inhom_bfield_fp16};
+
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            rk_stepper.step(step_size, rk_state, step_cfg, true);
+            rk_stepper_fp16.step(step_size, rk_state_fp16, step_cfg, true);
+        }
+
+        const scalar path_length{rk_state.path_length()};
+        ASSERT_TRUE(path_length > 0.f);
+        ASSERT_NEAR(rk_state_fp16.path_length(), path_length, tol);
+
+        // The half precision field only introduces small deviations
+        const point3 relative_error{
+            1.f / path_length * (rk_state().pos() - rk_state_fp16().pos())};
+        EXPECT_NEAR(vector::norm(relative_error), 0.f, 1e-4f);
+    }
+}
+
 /// This tests dqop of the Runge-Kutta stepper
 TEST(detray_propagator, qop_derivative) {
     using namespace step;
@@ -266,3 +315,265 @@ TEST(detray_propagator, qop_derivative) {
         }
     }
 }
+
+/// Compare the linear energy loss integration with the evaluation at every
+/// Runge-Kutta point
+TEST(detray_propagator, rk_stepper_linear_eloss) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t<scalar>;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    stepping::config cfg{};
+    cfg.use_eloss_gradient = true;
+    stepping::config lin_cfg{cfg};
+    lin_cfg.linear_eloss_per_step = true;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             5u, 5u, 1.f * unit<scalar>::GeV)) {
+
+        rk_stepper_t<bfield_t>::state rk_state{track, hom_bfield};
+        rk_stepper_t<bfield_t>::state lin_state{track, hom_bfield};
+
+        for (unsigned int i_s = 0u; i_s < 100u; i_s++) {
+            rk_stepper.step(step_size, rk_state, cfg, true, &vol_mat);
+            rk_stepper.step(step_size, lin_state, lin_cfg, true, &vol_mat);
+        }
+
+        const scalar qop{rk_state().qop()};
+        ASSERT_TRUE(math::fabs(qop) > math::fabs(track.qop()));
+        EXPECT_NEAR(lin_state().qop(), qop, 1e-4f * math::fabs(qop));
+
+        const scalar dqop{getter::element(rk_state.transport_jacobian(),
+                                          e_free_qoverp, e_free_qoverp)};
+        EXPECT_NEAR(getter::element(lin_state.transport_jacobian(),
+                                    e_free_qoverp, e_free_qoverp),
+                    dqop, 1e-3f * dqop);
+    }
+}
+
+/// Compare the stepping with an external cold state to the default layout
+TEST(detray_propagator, rk_stepper_external_storage) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t<scalar>;
+    using ext_rk_stepper_t =
+        rk_stepper<typename bfield_t::view_t, test_algebra,
+                   unconstrained_step<scalar>, stepper_rk_policy<scalar>,
+                   stepping::void_inspector, stepping::external_storage>;
+
+    vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+              2.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    // The external state does not hold the jacobian and bound parameters
+    static_assert(sizeof(ext_rk_stepper_t::state) <
+                  sizeof(rk_stepper_t<bfield_t>::state));
+
+    rk_stepper_t<bfield_t> rk_stepper;
+    ext_rk_stepper_t ext_rk_stepper;
+
+    stepping::config cov_cfg{};
+    cov_cfg.do_covariance_transport = true;
+
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+
+    // External buffer with one entry per track
+    std::vector<ext_rk_stepper_t::cold_state_type> cold_buffer(100u);
+
+    std::size_t n_tracks{0u};
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             10u, 10u, p_mag)) {
+
+        rk_stepper_t<bfield_t>::state rk_state{track, hom_bfield};
+        ext_rk_stepper_t::state ext_state{track, hom_bfield};
+
+        ASSERT_FALSE(ext_state.has_cold_state());
+        ext_state.bind_cold_state(cold_buffer.at(n_tracks));
+        ASSERT_TRUE(ext_state.has_cold_state());
+
+        EXPECT_EQ(rk_state.bound_params(), ext_state.bound_params());
+
+        for (unsigned int i_s = 0u; i_s < 100u; i_s++) {
+            rk_stepper.step(step_size, rk_state, cov_cfg, true, &vol_mat);
+            ext_rk_stepper.step(step_size, ext_state, cov_cfg, true, &vol_mat);
+        }
+
+        EXPECT_EQ(rk_state(), ext_state());
+        EXPECT_EQ(rk_state.transport_jacobian(),
+                  cold_buffer[n_tracks].jac_transport);
+
+        ++n_tracks;
+    }
+}
+
+/// Check that the trajectory-only stepper follows the same trajectory
+TEST(detray_propagator, rk_stepper_trajectory_only) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t<scalar>;
+    using traj_rk_stepper_t =
+        rk_stepper<typename bfield_t::view_t, test_algebra,
+                   unconstrained_step<scalar>, stepper_rk_policy<scalar>,
+                   stepping::void_inspector, stepping::trajectory_only>;
+
+    static_assert(!traj_rk_stepper_t::has_transport_jacobian);
+    static_assert(sizeof(traj_rk_stepper_t::state) <
+                  sizeof(rk_stepper_t<bfield_t>::state));
+
+    // The storage options are independent: External cold state without
+    // jacobian
+    using ext_traj_rk_stepper_t =
+        rk_stepper<typename bfield_t::view_t, test_algebra,
+                   unconstrained_step<scalar>, stepper_rk_policy<scalar>,
+                   stepping::void_inspector,
+                   stepping::storage<stepping::cold_storage::e_external,
+                                     false>>;
+
+    static_assert(ext_traj_rk_stepper_t::has_external_storage);
+    static_assert(!ext_traj_rk_stepper_t::has_transport_jacobian);
+    static_assert(std::is_same_v<ext_traj_rk_stepper_t::cold_state_type,
+                                 traj_rk_stepper_t::cold_state_type>);
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+    traj_rk_stepper_t traj_rk_stepper;
+
+    // The covariance transport flag is ignored by the trajectory-only stepper
+    stepping::config cov_cfg{};
+    cov_cfg.do_covariance_transport = true;
+
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             10u, 10u, p_mag)) {
+
+        rk_stepper_t<bfield_t>::state rk_state{track, hom_bfield};
+        traj_rk_stepper_t::state traj_state{track, hom_bfield};
+
+        EXPECT_EQ(rk_state.bound_params(), traj_state.bound_params());
+
+        for (unsigned int i_s = 0u; i_s < 100u; i_s++) {
+            rk_stepper.step(step_size, rk_state, cov_cfg, true, &vol_mat);
+            traj_rk_stepper.step(step_size, traj_state, cov_cfg, true,
+                                 &vol_mat);
+        }
+
+        EXPECT_EQ(rk_state(), traj_state());
+        EXPECT_EQ(rk_state.path_length(), traj_state.path_length());
+    }
+}
+
+/// Compare the number of Runge-Kutta trials with and without step size
+/// prediction across step size resets
+TEST(detray_propagator, rk_stepper_step_size_prediction) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t<scalar>;
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    stepping::config pred_cfg{};
+    pred_cfg.predict_step_size = true;
+
+    // Distance to the next surface: Too large for a low momentum track
+    constexpr scalar dist_to_next{50.f * unit<scalar>::mm};
+    constexpr unsigned int rk_steps = 100u;
+
+    // Track generator configuration
+    const scalar p_mag{0.1f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    std::size_t n_trials{0u};
+    std::size_t n_trials_pred{0u};
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        detail::helix helix(track, B);
+
+        rk_stepper_t<bfield_t>::state rk_state{track, hom_bfield};
+        rk_stepper_t<bfield_t>::state pred_state{track, hom_bfield};
+
+        // Reset the step size on every step, as on a surface
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            rk_stepper.step(dist_to_next, rk_state, step_cfg, true);
+            rk_stepper.step(dist_to_next, pred_state, pred_cfg, true);
+        }
+
+        // The predicted steps stay on the helix
+        const scalar path_length{pred_state.path_length()};
+        ASSERT_TRUE(path_length > 0.f);
+
+        const point3 relative_error{
+            (1.f / path_length) * (pred_state().pos() - helix(path_length))};
+        EXPECT_NEAR(vector::norm(relative_error), 0.f, tol);
+
+        n_trials += rk_state.n_total_trials();
+        n_trials_pred += pred_state.n_total_trials();
+    }
+
+    // Fewer rejected step trials
+    EXPECT_LT(n_trials_pred, n_trials);
+}
+
+/// The transport jacobian in a constant field is the analytic helix jacobian
+TEST(detray_propagator, rk_stepper_const_field_jacobian) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t<scalar>;
+    static_assert(detail::is_constant_field_v<typename bfield_t::view_t>);
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field<scalar>(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+    constexpr unsigned int rk_steps = 100u;
+
+    // Track generator configuration
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    for (auto track :
+         uniform_track_generator<free_track_parameters<test_algebra>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        rk_stepper_t<bfield_t>::state rk_state{track, hom_bfield};
+
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            rk_stepper.step(10.f * unit<scalar>::mm, rk_state, step_cfg, true);
+        }
+
+        // Compare the accumulated step jacobians to the full helix
+        const detail::helix<test_algebra> hlx(track, B);
+        const auto true_jac = hlx.jacobian(rk_state.path_length());
+        const auto &jac = rk_state.transport_jacobian();
+
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                EXPECT_NEAR(getter::element(jac, i, j),
+                            getter::element(true_jac, i, j), 1e-2f)
+                    << "element (" << i << ", " << j << ")";
+            }
+        }
+    }
+}
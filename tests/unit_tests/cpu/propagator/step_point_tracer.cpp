@@ -0,0 +1,130 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+#include "detray/test/validation/step_tracer.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <vector>
+
+using namespace detray;
+
+/// Compare the step point tracer to the full step tracer, when it records into
+/// the rows of a jagged buffer like on device
+GTEST_TEST(detray_propagator, step_point_tracer) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+    vecmem::copy copy;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using step_tracer_t = step_tracer<test_algebra, dvector>;
+    using point_tracer_t =
+        step_point_tracer<test_algebra, vecmem::device_vector>;
+    using host_point_tracer_t = step_point_tracer<test_algebra, dvector>;
+    using actor_chain_t = actor_chain<step_tracer_t, point_tracer_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using host_propagator_t =
+        propagator<stepper_t, navigator_t,
+                   actor_chain<step_tracer_t, host_point_tracer_t>>;
+
+    const typename detector_t::geometry_context gctx{};
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    std::vector<track_t> tracks{};
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+        tracks.push_back(track);
+    }
+
+    // Too small to hold all steps on surfaces of the toy detector
+    constexpr unsigned int small_capacity{5u};
+
+    for (const unsigned int capacity : {1000u, small_capacity}) {
+
+        auto buffer = make_step_point_buffer<test_algebra>(
+            tracks.size(), capacity, host_mr, nullptr, copy);
+        vecmem::jagged_device_vector<detail::step_point<test_algebra>> traces(
+            buffer);
+
+        for (unsigned int i = 0u; i < tracks.size(); ++i) {
+
+            step_tracer_t::state tracer_state{host_mr};
+            tracer_state.collect_only_on_surface(true);
+            point_tracer_t::state point_state{traces.at(i)};
+            point_state.collect_only_on_surface(true);
+
+            typename propagator_t::state propagation(tracks[i], toy_det, gctx);
+            ASSERT_TRUE(prop.propagate(
+                propagation, detray::tie(tracer_state, point_state)));
+
+            const auto &steps = tracer_state.get_step_data();
+            const auto n_steps{static_cast<unsigned int>(steps.size())};
+            const unsigned int n_recorded{std::min(n_steps, capacity)};
+
+            EXPECT_EQ(point_state.capacity(), capacity);
+            EXPECT_EQ(point_state.n_dropped(), n_steps - n_recorded);
+            EXPECT_EQ(point_state.is_truncated(), n_steps > capacity);
+
+            // The steps were written into the buffer
+            ASSERT_EQ(traces.at(i).size(), n_recorded);
+            for (unsigned int j = 0u; j < n_recorded; ++j) {
+                const auto &step = traces.at(i).at(j);
+                EXPECT_EQ(step.path_length, steps[j].path_length);
+                EXPECT_EQ(step.barcode, steps[j].barcode);
+                EXPECT_EQ(vector::norm(step.pos - steps[j].track_params.pos()),
+                          0.f);
+                EXPECT_EQ(vector::norm(step.dir - steps[j].track_params.dir()),
+                          0.f);
+            }
+        }
+    }
+
+    // Record into a host vector of fixed capacity
+    const host_propagator_t host_prop{prop_cfg};
+
+    step_tracer_t::state tracer_state{host_mr};
+    host_point_tracer_t::state point_state{host_mr, small_capacity};
+
+    typename host_propagator_t::state propagation(tracks.front(), toy_det,
+                                                  gctx);
+    ASSERT_TRUE(host_prop.propagate(propagation,
+                                    detray::tie(tracer_state, point_state)));
+
+    EXPECT_EQ(point_state.get_step_data().size(), small_capacity);
+    EXPECT_EQ(point_state.n_dropped(),
+              tracer_state.get_step_data().size() - small_capacity);
+}
@@ -0,0 +1,105 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+#include "detray/test/validation/step_tracer.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+/// Compare the ring buffer tracer to the full step tracer
+GTEST_TEST(detray_propagator, step_ring_tracer) {
+
+    using test_algebra = test::algebra;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<test_algebra>;
+    using step_tracer_t = step_tracer<test_algebra, dvector>;
+    using ring_tracer_t = step_ring_tracer<test_algebra, dvector>;
+    using actor_chain_t = actor_chain<step_tracer_t, ring_tracer_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const typename detector_t::geometry_context gctx{};
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    constexpr unsigned int capacity{16u};
+    constexpr unsigned int stride{3u};
+
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+
+        step_tracer_t::state tracer_state{host_mr};
+        // Keeps the last steps
+        ring_tracer_t::state last_steps{host_mr, capacity};
+
+        typename propagator_t::state propagation(track, toy_det, gctx);
+        ASSERT_TRUE(prop.propagate(propagation,
+                                   detray::tie(tracer_state, last_steps)));
+
+        // Keeps every third step
+        step_tracer_t::state dummy_state{host_mr};
+        ring_tracer_t::state sampled_steps{host_mr, 1000u};
+        sampled_steps.stride(stride);
+
+        typename propagator_t::state propagation2(track, toy_det, gctx);
+        ASSERT_TRUE(prop.propagate(propagation2,
+                                   detray::tie(dummy_state, sampled_steps)));
+
+        const auto &steps = tracer_state.get_step_data();
+        const auto n_steps{static_cast<unsigned int>(steps.size())};
+
+        ASSERT_EQ(last_steps.n_recorded(), n_steps);
+        ASSERT_EQ(last_steps.size(), std::min(n_steps, capacity));
+        EXPECT_EQ(last_steps.wrapped_around(), n_steps > capacity);
+
+        const auto ordered = last_steps.ordered_step_data();
+        ASSERT_EQ(ordered.size(), last_steps.size());
+
+        const unsigned int first{n_steps - last_steps.size()};
+        for (unsigned int i = 0u; i < last_steps.size(); ++i) {
+            EXPECT_EQ(last_steps[i].path_length, steps[first + i].path_length);
+            EXPECT_EQ(last_steps[i].barcode, steps[first + i].barcode);
+            EXPECT_EQ(ordered[i].path_length, steps[first + i].path_length);
+        }
+
+        ASSERT_EQ(sampled_steps.size(), (n_steps + stride - 1u) / stride);
+        EXPECT_FALSE(sampled_steps.wrapped_around());
+        for (unsigned int i = 0u; i < sampled_steps.size(); ++i) {
+            EXPECT_EQ(sampled_steps[i].path_length,
+                      steps[i * stride].path_length);
+        }
+
+        // The buffer is reused
+        last_steps.reset();
+        EXPECT_EQ(last_steps.size(), 0u);
+        EXPECT_EQ(last_steps.capacity(), capacity);
+    }
+}
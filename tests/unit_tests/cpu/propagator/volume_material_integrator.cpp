@@ -0,0 +1,111 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/actors/volume_material_integrator.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using track_t = free_track_parameters<test_algebra>;
+using stepper_t = line_stepper<test_algebra>;
+using integrator_t = volume_material_integrator<test_algebra>;
+
+constexpr scalar tol{1e-3f};
+
+/// Integrate the homogeneous volume material of a telescope detector
+GTEST_TEST(detray_propagator, volume_material_integrator_homogeneous) {
+
+    vecmem::host_memory_resource host_mr;
+
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{20.f * unit<scalar>::mm,
+                                                      20.f * unit<scalar>::mm};
+    tel_cfg.n_surfaces(5u).length(200.f * unit<scalar>::mm);
+    tel_cfg.volume_material(iron<scalar>{});
+
+    const auto [tel_det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+
+    using detector_t = decltype(tel_det);
+    using propagator_t = propagator<stepper_t, navigator<detector_t>,
+                                    actor_chain<integrator_t>>;
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    // Along the pilot track
+    const track_t track(test::point3{0.f, 0.f, 0.f}, 0.f,
+                        test::vector3{1.f, 0.f, 0.f}, -1.f);
+
+    integrator_t::state integrator_state{};
+    typename propagator_t::state propagation(track, tel_det,
+                                             prop_cfg.context);
+
+    ASSERT_TRUE(prop.propagate(propagation, detray::tie(integrator_state)));
+
+    const auto &integral = integrator_state.integral();
+    const scalar path{propagation._stepping.path_length()};
+
+    EXPECT_GT(integral.n_bins, 0u);
+    EXPECT_NEAR(integral.path / path, 1.f, tol);
+    EXPECT_NEAR(integral.path_in_x0 * iron<scalar>{}.X0() / path, 1.f, tol);
+    EXPECT_NEAR(integral.average_material().X0() / iron<scalar>{}.X0(), 1.f,
+                tol);
+}
+
+/// Volumes without material only add to the path
+GTEST_TEST(detray_propagator, volume_material_integrator_vacuum) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using propagator_t = propagator<stepper_t, navigator<detector_t>,
+                                    actor_chain<integrator_t>>;
+
+    propagation::config prop_cfg{};
+    const propagator_t prop{prop_cfg};
+
+    for (const auto track :
+         uniform_track_generator<track_t>(/*phi_steps*/ 10u,
+                                          /*theta_steps*/ 10u)) {
+
+        integrator_t::state integrator_state{};
+        typename propagator_t::state propagation(track, toy_det,
+                                                 prop_cfg.context);
+
+        ASSERT_TRUE(prop.propagate(propagation, detray::tie(integrator_state)));
+
+        const auto &integral = integrator_state.integral();
+
+        EXPECT_NEAR(integral.path / propagation._stepping.path_length(), 1.f,
+                    tol);
+        EXPECT_FLOAT_EQ(integral.path_in_x0, 0.f);
+    }
+}
@@ -0,0 +1,219 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/wavefront_propagation.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <utility>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+
+/// Counts the sensitive surfaces and records the path length of a track
+struct surface_counter : actor {
+
+    struct state {
+        std::size_t n_sensitives{0u};
+        scalar path_length{0.f};
+    };
+
+    template <typename propagator_state_t>
+    void operator()(state &counter_state,
+                    const propagator_state_t &propagation) const {
+        counter_state.path_length = propagation._stepping.path_length();
+
+        if (propagation._navigation.is_on_sensitive()) {
+            ++counter_state.n_sensitives;
+        }
+    }
+};
+
+}  // namespace
+
+/// Compare the wavefront propagation to the propagation track by track
+GTEST_TEST(detray_propagator, wavefront_propagation) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using bfield_t = bfield::const_field_t<scalar>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    using actor_chain_t = actor_chain<surface_counter>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain_t>;
+    using actor_states_t = typename actor_chain_t::state_tuple;
+
+    const typename detector_t::geometry_context gctx{};
+    const bfield_t b_field = bfield::create_const_field<scalar>(
+        {0.f, 0.f, 2.f * unit<scalar>::T});
+
+    std::vector<track_t> tracks{};
+    for (const auto track : uniform_track_generator<track_t>(
+             /*phi_steps*/ 20u, /*theta_steps*/ 20u,
+             /*p_mag*/ 10.f * unit<scalar>::GeV)) {
+        tracks.push_back(track);
+    }
+    const auto n_tracks{static_cast<dindex>(tracks.size())};
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.search_window = {3u, 3u};
+    const propagator_t prop{prop_cfg};
+
+    // Reference: Propagate track by track
+    std::vector<actor_states_t> ref_states(n_tracks);
+    std::vector<scalar> ref_path_lengths{};
+    for (dindex i = 0u; i < n_tracks; ++i) {
+        typename propagator_t::state propagation(tracks[i], b_field, toy_det,
+                                                 gctx);
+        ASSERT_TRUE(prop.propagate(
+            propagation, actor_chain_t::setup_actor_states(ref_states[i])));
+
+        ref_path_lengths.push_back(propagation._stepping.path_length());
+    }
+
+    // Wavefront: Propagate all tracks stage by stage
+    vecmem::vector<typename propagator_t::state> states(&host_mr);
+    states.reserve(n_tracks);
+    for (const auto &track : tracks) {
+        states.emplace_back(track, b_field, toy_det, gctx);
+    }
+    vecmem::vector<actor_states_t> actor_states(n_tracks, &host_mr);
+    vecmem::vector<unsigned int> is_init(n_tracks, 0u, &host_mr);
+    vecmem::vector<dindex> queue(n_tracks, 0u, &host_mr);
+    vecmem::vector<dindex> next_queue(n_tracks, 0u, &host_mr);
+    vecmem::vector<unsigned int> n_next(1u, 0u, &host_mr);
+
+    propagation::wavefront_view<propagator_t> view{
+        vecmem::get_data(states), vecmem::get_data(actor_states),
+        vecmem::get_data(is_init), vecmem::get_data(queue),
+        vecmem::get_data(next_queue), vecmem::get_data(n_next)};
+
+    const std::size_t n_steps{
+        propagation::propagate_wavefront(prop, view, toy_det)};
+
+    EXPECT_GT(n_steps, 0u);
+
+    for (dindex i = 0u; i < n_tracks; ++i) {
+        const auto &propagation = states[i];
+        EXPECT_TRUE(prop.is_complete(propagation)) << "track " << i;
+
+        const auto &ref = detail::get<0>(ref_states[i]);
+        const auto &res = detail::get<0>(actor_states[i]);
+
+        EXPECT_EQ(ref.n_sensitives, res.n_sensitives) << "track " << i;
+        EXPECT_FLOAT_EQ(ref.path_length, res.path_length) << "track " << i;
+        EXPECT_FLOAT_EQ(ref_path_lengths[i],
+                        propagation._stepping.path_length())
+            << "track " << i;
+    }
+}
+
+/// Suspend the propagation after a step budget and finish it on a copy of the
+/// detector (like a track that is moved from device to host)
+GTEST_TEST(detray_propagator, suspended_propagation) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+    const auto [toy_det_copy, names_copy] =
+        build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using track_t = free_track_parameters<test_algebra>;
+    using bfield_t = bfield::const_field_t<scalar>;
+    using stepper_t = rk_stepper<bfield_t::view_t, test_algebra>;
+    using actor_chain_t = actor_chain<surface_counter>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain_t>;
+    using actor_states_t = typename actor_chain_t::state_tuple;
+
+    const typename detector_t::geometry_context gctx{};
+    const bfield_t b_field = bfield::create_const_field<scalar>(
+        {0.f, 0.f, 2.f * unit<scalar>::T});
+
+    propagation::config prop_cfg{};
+    prop_cfg.navigation.search_window = {3u, 3u};
+    const propagator_t prop{prop_cfg};
+
+    constexpr unsigned int max_steps{5u};
+
+    std::size_t n_suspended{0u};
+    for (const auto track : uniform_track_generator<track_t>(
+             /*phi_steps*/ 10u, /*theta_steps*/ 10u,
+             /*p_mag*/ 10.f * unit<scalar>::GeV)) {
+
+        // Reference: Uninterrupted propagation
+        actor_states_t ref_states{};
+        typename propagator_t::state ref_propagation(track, b_field, toy_det,
+                                                     gctx);
+        ASSERT_TRUE(prop.propagate(
+            ref_propagation, actor_chain_t::setup_actor_states(ref_states)));
+
+        // Propagate with a step budget
+        actor_states_t actor_states{};
+        typename propagator_t::state propagation(track, b_field, toy_det,
+                                                 gctx);
+        ASSERT_TRUE(prop.propagate_for(
+            propagation, actor_chain_t::setup_actor_states(actor_states),
+            max_steps));
+
+        if (prop.is_complete(propagation)) {
+            continue;
+        }
+        ASSERT_TRUE(prop.is_paused(propagation));
+        ++n_suspended;
+
+        // Move the suspended state and finish it on the other detector
+        typename propagator_t::state resumed_propagation{
+            std::move(propagation)};
+        resumed_propagation.set_detector(toy_det_copy);
+
+        ASSERT_TRUE(prop.propagate_resume(
+            resumed_propagation,
+            actor_chain_t::setup_actor_states(actor_states)));
+
+        EXPECT_TRUE(prop.is_complete(resumed_propagation));
+
+        const auto &ref = detail::get<0>(ref_states);
+        const auto &res = detail::get<0>(actor_states);
+
+        EXPECT_EQ(ref.n_sensitives, res.n_sensitives);
+        EXPECT_FLOAT_EQ(ref.path_length, res.path_length);
+        EXPECT_FLOAT_EQ(ref_propagation._stepping.path_length(),
+                        resumed_propagation._stepping.path_length());
+    }
+
+    EXPECT_GT(n_suspended, 0u);
+}
@@ -107,3 +107,93 @@ GTEST_TEST(detray_simulation, detector_scanner) {
         ++n_tracks;
     }
 }
+
+/// Stream a ray scan to file in batches on multiple threads
+GTEST_TEST(detray_simulation, detector_scanner_streaming) {
+
+    // Build the geometry
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using ray_t = detail::ray<test_algebra>;
+    using intersection_trace_t = typename detray::ray_scan<
+        test_algebra>::template intersection_trace_type<detector_t>;
+
+    detector_t::geometry_context gctx{};
+
+    uniform_track_generator<ray_t> ray_generator(20u, 20u);
+
+    std::vector<intersection_trace_t> expected;
+    for (const auto test_ray : ray_generator) {
+        expected.push_back(
+            detector_scanner::run<ray_scan>(gctx, toy_det, test_ray));
+    }
+
+    // Batches that do not divide the number of rays
+    detector_scanner::streaming_config cfg{};
+    cfg.n_threads = 3u;
+    cfg.batch_size = 32u;
+
+    const std::string inters_file{"toy_detector_streaming_intersections.csv"};
+    const std::string trk_file{"toy_detector_streaming_track_params.csv"};
+
+    const auto result = detector_scanner::run_to_file<ray_scan>(
+        gctx, toy_det, ray_generator, inters_file, trk_file, cfg);
+
+    EXPECT_EQ(result.n_traces, expected.size());
+
+    std::vector<intersection_trace_t> streamed;
+    detector_scanner::read(inters_file, trk_file, streamed);
+
+    ASSERT_EQ(streamed.size(), expected.size());
+
+    std::size_t n_records{0u};
+    for (std::size_t i = 0u; i < expected.size(); ++i) {
+        ASSERT_EQ(streamed[i].size(), expected[i].size());
+        n_records += expected[i].size();
+
+        for (std::size_t j = 0u; j < expected[i].size(); ++j) {
+            const auto &exp_intr = expected[i][j].intersection;
+            const auto &intr = streamed[i][j].intersection;
+
+            EXPECT_EQ(intr.sf_desc.barcode(), exp_intr.sf_desc.barcode());
+            // The csv output is written with six significant digits
+            EXPECT_NEAR(intr.path, exp_intr.path,
+                        1e-5f * math::fabs(exp_intr.path) + 1e-4f);
+        }
+    }
+    EXPECT_EQ(result.n_records, n_records);
+
+    // Binary columnar output holds the full precision
+    cfg.format = io::csv::output_format::e_binary;
+
+    const std::string inters_bin{"toy_detector_streaming_intersections.bin"};
+    const std::string trk_bin{"toy_detector_streaming_track_params.bin"};
+
+    const auto bin_result = detector_scanner::run_to_file<ray_scan>(
+        gctx, toy_det, ray_generator, inters_bin, trk_bin, cfg);
+
+    EXPECT_EQ(bin_result.n_records, n_records);
+
+    const auto inters_data =
+        io::csv::read_columnar<io::csv::intersection2D>(inters_bin);
+    const auto trk_data =
+        io::csv::read_columnar<io::csv::free_track_parameters>(trk_bin);
+
+    ASSERT_EQ(inters_data.size(), n_records);
+    ASSERT_EQ(trk_data.size(), n_records);
+
+    std::size_t k{0u};
+    for (std::size_t i = 0u; i < expected.size(); ++i) {
+        for (const auto &record : expected[i]) {
+            EXPECT_EQ(inters_data[k].track_id, i);
+            EXPECT_EQ(trk_data[k].track_id, i);
+            EXPECT_EQ(inters_data[k].identifier,
+                      record.intersection.sf_desc.barcode().value());
+            EXPECT_EQ(inters_data[k].path,
+                      static_cast<double>(record.intersection.path));
+            ++k;
+        }
+    }
+}
@@ -10,6 +10,8 @@
 #include "detray/tracks/tracks.hpp"
 
 // Detray test include(s)
+#include "detray/test/utils/simulation/device_random_scatterer.hpp"
+#include "detray/test/utils/simulation/philox_engine.hpp"
 #include "detray/test/utils/simulation/random_scatterer.hpp"
 #include "detray/test/utils/simulation/scattering_helper.hpp"
 #include "detray/test/utils/statistics.hpp"
@@ -20,6 +22,8 @@
 
 // System include(s).
 #include <algorithm>
+#include <concepts>
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -126,3 +130,118 @@ GTEST_TEST(detray_simulation, angle_update) {
     EXPECT_NEAR((var_theta - statistics::rms(thetas, theta0)) / var_theta, 0.f,
                 1e-2f);
 }
+
+// Test the counter-based random number engine
+GTEST_TEST(detray_simulation, philox_engine) {
+
+    static_assert(std::uniform_random_bit_generator<philox_engine>);
+
+    // Known answers of Philox4x32-10 (Random123)
+    using block_t = philox_engine::block_type;
+    EXPECT_EQ(philox_engine::generate({0u, 0u, 0u, 0u}, {0u, 0u}),
+              block_t({0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+    EXPECT_EQ(philox_engine::generate(
+                  {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                  {0xa4093822u, 0x299f31d0u}),
+              block_t({0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+
+    // Same seed and stream give the same sequence, other streams differ
+    philox_engine engine{42u, 7u};
+    philox_engine same_engine{42u, 7u};
+    philox_engine other_stream{42u, 8u};
+
+    std::size_t n_diff{0u};
+    for (std::size_t i = 0u; i < 100u; ++i) {
+        const std::uint32_t r{engine()};
+        EXPECT_EQ(r, same_engine());
+        n_diff += (r != other_stream()) ? 1u : 0u;
+    }
+    EXPECT_GT(n_diff, 95u);
+
+    // Skip ahead
+    philox_engine skipped{42u, 7u};
+    skipped.discard(113u);
+    for (std::size_t i = 0u; i < 13u; ++i) {
+        same_engine();
+    }
+    EXPECT_TRUE(skipped == same_engine);
+
+    // Sample the distributions
+    std::vector<scalar> uniforms;
+    std::vector<scalar> normals;
+    std::size_t n_samples{100000u};
+    for (std::size_t i = 0u; i < n_samples; i++) {
+        const scalar u{detail::uniform_open<scalar>(engine)};
+        ASSERT_GT(u, 0.f);
+        ASSERT_LT(u, 1.f);
+        uniforms.push_back(u);
+        normals.push_back(
+            detail::normal_variate(engine, scalar{1.f}, scalar{2.f}));
+    }
+
+    EXPECT_NEAR(statistics::mean(uniforms), 0.5f, 1e-2f);
+    EXPECT_NEAR(statistics::mean(normals), 1.f, 2e-2f);
+    EXPECT_NEAR(std::sqrt(statistics::rms(normals, 1.f)), 2.f, 2e-2f);
+}
+
+// Test the scattering with the counter-based engine
+GTEST_TEST(detray_simulation, device_scattering) {
+
+    philox_engine engine{0u, 1u};
+
+    // Initial direction
+    const vector3 dir{vector::normalize(vector3{1.f, 2.f, 3.f})};
+
+    const scalar phi0 = vector::phi(dir);
+    const scalar theta0 = vector::theta(dir);
+
+    const scalar projected_scattering_angle{0.01f};
+    const scalar scattering_angle{constant<scalar>::sqrt2 *
+                                  projected_scattering_angle};
+
+    // Bound covariance from the projected scattering angle
+    auto bound_cov = matrix::zero<
+        typename bound_track_parameters<test_algebra>::covariance_type>();
+    pointwise_material_interactor<test_algebra>().update_angle_variance(
+        bound_cov, dir, projected_scattering_angle);
+
+    // Sample the deflection like the device scatterer
+    std::vector<scalar> phis;
+    std::vector<scalar> thetas;
+    std::size_t n_samples{100000u};
+    for (std::size_t i = 0u; i < n_samples; i++) {
+        const scalar r_theta{
+            detail::normal_variate(engine, scalar{0.f}, scattering_angle)};
+        const scalar r_phi{constant<scalar>::pi *
+                           (2.f * detail::uniform_open<scalar>(engine) - 1.f)};
+
+        const auto new_dir =
+            scattering_helper<test_algebra>().deflect(dir, r_theta, r_phi);
+        phis.push_back(vector::phi(new_dir));
+        thetas.push_back(vector::theta(new_dir));
+    }
+
+    // Tolerate upto 1% difference
+    const auto var_phi = getter::element(bound_cov, e_bound_phi, e_bound_phi);
+    const auto var_theta =
+        getter::element(bound_cov, e_bound_theta, e_bound_theta);
+    EXPECT_NEAR((var_phi - statistics::rms(phis, phi0)) / var_phi, 0.f, 1e-2f);
+    EXPECT_NEAR((var_theta - statistics::rms(thetas, theta0)) / var_theta, 0.f,
+                1e-2f);
+
+    // The actor state carries one engine per track
+    using scatterer_t = device_random_scatterer<test_algebra>;
+    const scatterer_t::state track0{0u, 0u};
+    const scatterer_t::state track1{0u, 1u};
+    EXPECT_TRUE(track1.generator == philox_engine(0u, 1u));
+    EXPECT_FALSE(track0.generator == track1.generator);
+
+    // Momentum after the energy loss
+    const scalar m0{105.7f * unit<scalar>::MeV};
+    const scalar p0{1.f * unit<scalar>::GeV};
+    const scalar e_loss{10.f * unit<scalar>::MeV};
+    const scalar new_p{random_scatterer<test_algebra>().attenuate(e_loss, m0,
+                                                                   p0)};
+    EXPECT_NEAR(math::sqrt(new_p * new_p + m0 * m0),
+                math::sqrt(p0 * p0 + m0 * m0) - e_loss, 1e-3f);
+}
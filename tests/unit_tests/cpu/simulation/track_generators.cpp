@@ -19,6 +19,10 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <thread>
+#include <vector>
+
 using namespace detray;
 
 using test_algebra = test::algebra;
@@ -219,6 +223,48 @@ GTEST_TEST(detray_simulation, uniform_track_generator_with_range) {
     EXPECT_NEAR(theta_phi[7][1], 1.f, tol);
 }
 
+/// Tests the generation of uniformly distributed tracks by index
+GTEST_TEST(detray_simulation, uniform_track_generator_by_index) {
+    using counter_gen_t = detail::counter_random_numbers<scalar>;
+    using generator_t =
+        uniform_track_generator<free_track_parameters<test_algebra>,
+                                counter_gen_t>;
+
+    auto trk_gen_cfg = generator_t::configuration{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(7u).randomize_charge(true);
+
+    // Step through theta and eta space
+    for (const bool uniform_eta : {false, true}) {
+        trk_gen_cfg.uniform_eta(uniform_eta);
+
+        const generator_t trk_generator{trk_gen_cfg};
+
+        std::size_t n_tracks{0u};
+        std::size_t n_flipped{0u};
+        for (const auto track : generator_t{trk_gen_cfg}) {
+            // Same track from the configuration alone
+            const auto trk_by_index =
+                generator_t::generate_track(trk_gen_cfg, n_tracks);
+
+            EXPECT_EQ(trk_by_index.pos(), track.pos()) << n_tracks;
+            EXPECT_EQ(trk_by_index.dir(), track.dir()) << n_tracks;
+            EXPECT_EQ(trk_by_index.qop(), track.qop()) << n_tracks;
+            EXPECT_EQ(trk_generator[n_tracks].dir(), track.dir());
+
+            n_flipped += (track.qop() > 0.f) ? 1u : 0u;
+            ++n_tracks;
+        }
+        EXPECT_EQ(n_tracks, trk_gen_cfg.n_tracks());
+        EXPECT_GT(n_flipped, 0u);
+        EXPECT_LT(n_flipped, n_tracks);
+    }
+
+    // A single theta step
+    trk_gen_cfg.uniform_eta(false).theta_range(1.f, 2.f).theta_steps(1u);
+    const auto track = generator_t::generate_track(trk_gen_cfg, 3u);
+    EXPECT_NEAR(vector::theta(track.dir()), 1.f, 1e-5f);
+}
+
 /// Tests a random number based track state generator - uniform distribution
 GTEST_TEST(detray_simulation, random_track_generator_uniform) {
 
@@ -387,3 +433,81 @@ GTEST_TEST(detray_simulation, random_track_generator_normal) {
                 std::pow(0.5f / 3.0f * (theta_range[1] - theta_range[0]), 2.f),
                 tol);
 }
+
+/// Tests a random track generator with counter based random numbers
+GTEST_TEST(detray_simulation, random_track_generator_counter_based) {
+
+    // Known answer test of the Philox4x32-10 block function
+    constexpr darray<std::uint32_t, 4> philox_ref{0x6627e8d5u, 0xe169c58du,
+                                                  0xbc57ac4cu, 0x9b00dbd8u};
+    EXPECT_TRUE(detail::philox4x32_10({0u, 0u, 0u, 0u}, {0u, 0u}) ==
+                philox_ref);
+
+    using counter_gen_t = detail::counter_random_numbers<scalar>;
+    using trk_generator_t =
+        random_track_generator<free_track_parameters<test_algebra>,
+                               counter_gen_t>;
+
+    // Tolerance depends on sample size
+    constexpr scalar tol{0.02f};
+
+    constexpr std::size_t n_gen_tracks{10000u};
+
+    trk_generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.n_tracks(n_gen_tracks);
+    trk_gen_cfg.seed(42u);
+    trk_gen_cfg.randomize_charge(true);
+    trk_gen_cfg.mom_range(1.f * unit<scalar>::GeV, 2.f * unit<scalar>::GeV);
+    trk_gen_cfg.origin_stddev(0.1f * unit<scalar>::mm, 0.f * unit<scalar>::mm,
+                              0.2f * unit<scalar>::mm);
+
+    trk_generator_t trk_generator{trk_gen_cfg};
+
+    // Generate the tracks in sequence
+    std::vector<free_track_parameters<test_algebra>> tracks{};
+    std::vector<scalar> x{};
+    std::vector<scalar> mom{};
+    for (const auto track : trk_generator) {
+        tracks.push_back(track);
+        x.push_back(track.pos()[0]);
+        mom.push_back(track.p(track.qop() > 0.f ? 1.f : -1.f));
+    }
+    ASSERT_EQ(tracks.size(), n_gen_tracks);
+
+    // Generate the tracks by index on several threads, in a different order
+    constexpr std::size_t n_threads{4u};
+    std::vector<free_track_parameters<test_algebra>> tracks_mt(n_gen_tracks);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0u; t < n_threads; ++t) {
+        workers.emplace_back([&tracks_mt, &trk_generator, t]() {
+            for (std::size_t j = t; j < n_gen_tracks; j += n_threads) {
+                const std::size_t i{n_gen_tracks - 1u - j};
+                tracks_mt[i] = trk_generator[i];
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    for (std::size_t i = 0u; i < n_gen_tracks; ++i) {
+        EXPECT_EQ(tracks_mt[i].pos(), tracks[i].pos()) << i;
+        EXPECT_EQ(tracks_mt[i].dir(), tracks[i].dir()) << i;
+        EXPECT_EQ(tracks_mt[i].qop(), tracks[i].qop()) << i;
+    }
+
+    // A different seed gives different tracks
+    trk_gen_cfg.seed(43u);
+    const trk_generator_t other_generator{trk_gen_cfg};
+    EXPECT_NE(other_generator[0u].dir(), tracks[0u].dir());
+
+    // Check the distributions
+    const auto& mom_range = trk_gen_cfg.mom_range();
+    const auto& ori_stddev = trk_gen_cfg.origin_stddev();
+    EXPECT_NEAR(statistics::mean(x), 0.f, tol);
+    EXPECT_NEAR(statistics::variance(x), ori_stddev[0] * ori_stddev[0], tol);
+    EXPECT_NEAR(statistics::mean(mom), 0.5f * (mom_range[0] + mom_range[1]),
+                tol);
+    EXPECT_NEAR(statistics::variance(mom),
+                1.0f / 12.0f * std::pow(mom_range[1] - mom_range[0], 2.f), tol);
+}
@@ -8,6 +8,8 @@
 // Project include(s)
 #include "detray/tracks/bound_track_parameters.hpp"
 
+#include "detray/tracks/detail/packed_covariance.hpp"
+
 // Detray test include(s)
 #include "detray/test/utils/types.hpp"
 
@@ -122,3 +124,95 @@ GTEST_TEST(detray_tracks, bound_track_parameters) {
     bound_param2.set_qop(0.127f);
     EXPECT_FLOAT_EQ(static_cast<float>(bound_param2.qop()), 0.127f);
 }
+
+GTEST_TEST(detray_tracks, packed_bound_covariance) {
+
+    using packed_params_t = packed_bound_track_parameters<test_algebra>;
+
+    static_assert(packed_params_t::has_packed_covariance);
+    static_assert(!bound_track_parameters<test_algebra>::has_packed_covariance);
+    static_assert(sizeof(packed_params_t) <
+                  sizeof(bound_track_parameters<test_algebra>));
+
+    // Symmetric covariance
+    auto cov = matrix::zero<covariance_t>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = i; j < e_bound_size; ++j) {
+            const scalar val{static_cast<scalar>(1u + i * e_bound_size + j)};
+            getter::element(cov, i, j) = val;
+            getter::element(cov, j, i) = val;
+        }
+    }
+
+    bound_parameters_vector<test_algebra> bound_vec{
+        point2{1.f, 2.f}, 0.1f, 0.2f, -0.1f, 0.1f};
+
+    const bound_track_parameters<test_algebra> full_param(
+        geometry::barcode{}.set_index(0u), bound_vec, cov);
+    const packed_params_t packed_param(geometry::barcode{}.set_index(0u),
+                                       bound_vec, cov);
+
+    EXPECT_EQ(packed_param.covariance_storage().data().size(), 21u);
+    EXPECT_FALSE(packed_param.is_invalid());
+    EXPECT_TRUE(packed_params_t{}.covariance_storage().is_zero());
+
+    // Conversion on access and between the storage types
+    const covariance_t unpacked = packed_param.covariance();
+    const packed_params_t packed_from_full{full_param};
+    const bound_track_parameters<test_algebra> full_from_packed{packed_param};
+
+    EXPECT_TRUE(full_from_packed == full_param);
+    EXPECT_TRUE(packed_from_full == packed_param);
+    EXPECT_EQ(full_from_packed.surface_link(), full_param.surface_link());
+
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_FLOAT_EQ(static_cast<float>(getter::element(unpacked, i, j)),
+                            static_cast<float>(getter::element(cov, i, j)));
+            EXPECT_FLOAT_EQ(
+                static_cast<float>(packed_param.covariance_element(i, j)),
+                static_cast<float>(getter::element(cov, i, j)));
+        }
+    }
+}
+
+GTEST_TEST(detray_tracks, symmetric_covariance_transport) {
+
+    // Symmetric, positive definite covariance: A * A^T
+    auto A = matrix::zero<covariance_t>();
+    auto J = matrix::zero<covariance_t>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            getter::element(A, i, j) =
+                0.1f * static_cast<scalar>((i + 2u * j) % 5u) +
+                (i == j ? 1.f : 0.f);
+            getter::element(J, i, j) =
+                0.2f * static_cast<scalar>((3u * i + j) % 7u) - 0.5f;
+        }
+    }
+    const covariance_t cov = A * matrix::transpose(A);
+
+    const covariance_t ref = J * cov * matrix::transpose(J);
+
+    // Full storage
+    covariance_t full_out = matrix::zero<covariance_t>();
+    detail::symmetric_transport<test_algebra>(J, cov, full_out);
+
+    // Packed storage, in place
+    detail::packed_covariance<test_algebra> packed{cov};
+    detail::symmetric_transport<test_algebra>(J, packed, packed);
+
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            const scalar ref_val{getter::element(ref, i, j)};
+            const scalar rel_tol{tol * (1.f + std::abs(ref_val))};
+
+            EXPECT_NEAR(getter::element(full_out, i, j), ref_val,
+                        10.f * rel_tol);
+            EXPECT_NEAR(packed(i, j), ref_val, 10.f * rel_tol);
+            // Exactly symmetric
+            EXPECT_EQ(getter::element(full_out, i, j),
+                      getter::element(full_out, j, i));
+        }
+    }
+}
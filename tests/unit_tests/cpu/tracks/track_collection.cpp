@@ -0,0 +1,316 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/tracks/track_collection.hpp"
+
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/detail/batched_jacobian_engine.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/propagator.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_telescope_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point2 = test::point2;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+
+using free_collection_t = free_track_collection<test_algebra>;
+using bound_collection_t = bound_track_collection<test_algebra>;
+
+// The element proxies can be used where the track concepts are required
+static_assert(concepts::free_track_params<free_track_parameters<test_algebra>>);
+static_assert(concepts::free_track_params<free_collection_t::reference>);
+static_assert(concepts::free_track_params<free_collection_t::const_reference>);
+static_assert(
+    concepts::bound_track_params<bound_track_parameters<test_algebra>>);
+static_assert(concepts::bound_track_params<bound_collection_t::reference>);
+static_assert(
+    concepts::bound_track_params<bound_collection_t::const_reference>);
+
+namespace {
+
+constexpr scalar tol{1e-5f};
+
+constexpr std::size_t n_tracks{10u};
+
+/// @returns bound track parameters with a distinct covariance
+bound_track_parameters<test_algebra> make_bound_track(const std::size_t i) {
+    const auto s{static_cast<scalar>(i)};
+
+    bound_parameters_vector<test_algebra> bound_vec{
+        point2{0.1f * s - 0.2f, 0.3f - 0.05f * s}, 0.2f + 0.25f * s,
+        0.4f + 0.1f * s, -1.f / (1.f + s), 0.1f * s};
+
+    auto cov = matrix::identity<bound_matrix<test_algebra>>();
+    for (unsigned int j = 0u; j < e_bound_size; ++j) {
+        getter::element(cov, j, j) = 0.01f * (1.f + s + static_cast<scalar>(j));
+    }
+    getter::element(cov, e_bound_loc0, e_bound_theta) = 0.001f * s;
+    getter::element(cov, e_bound_theta, e_bound_loc0) = 0.001f * s;
+
+    return {geometry::barcode{}.set_index(static_cast<dindex>(i)), bound_vec,
+            cov};
+}
+
+}  // anonymous namespace
+
+// Test the SoA collection of free track parameters
+GTEST_TEST(detray_tracks, free_track_collection) {
+
+    vecmem::host_memory_resource host_mr;
+
+    free_collection_t tracks{&host_mr};
+    ASSERT_TRUE(tracks.empty());
+
+    std::vector<free_track_parameters<test_algebra>> ref_tracks;
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto s{static_cast<scalar>(i)};
+        ref_tracks.emplace_back(point3{s, 2.f * s, -s}, 0.5f * s,
+                                vector3{1.f, s, 0.5f}, -1.f);
+        tracks.push_back(ref_tracks.back());
+    }
+    ASSERT_EQ(tracks.size(), n_tracks);
+
+    // Every component is a contiguous column
+    for (std::size_t c = 0u; c < e_free_size; ++c) {
+        ASSERT_EQ(tracks.columns().column(c).size(), n_tracks);
+    }
+
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto trk = tracks[i];
+        const free_track_parameters<test_algebra> loaded = trk;
+
+        EXPECT_TRUE(loaded == ref_tracks[i]);
+        EXPECT_NEAR(vector::norm(trk.pos() - ref_tracks[i].pos()), 0.f, tol);
+        EXPECT_NEAR(vector::norm(trk.dir() - ref_tracks[i].dir()), 0.f, tol);
+        EXPECT_NEAR(trk.time(), ref_tracks[i].time(), tol);
+        EXPECT_NEAR(trk.qop(), ref_tracks[i].qop(), tol);
+        EXPECT_NEAR(tracks.columns()(e_free_pos1, i), 2.f * trk.pos()[0], tol);
+    }
+
+    // Write through the proxy
+    tracks[3].set_qop(-0.25f);
+    tracks[4] = tracks[0];
+    EXPECT_NEAR(tracks[3].qop(), -0.25f, tol);
+    EXPECT_TRUE(static_cast<free_track_parameters<test_algebra>>(tracks[4]) ==
+                ref_tracks[0]);
+
+    // Access through the view
+    auto view = tracks.get_data();
+    free_track_collection<test_algebra, device_container_types> dev_tracks(
+        view);
+    ASSERT_EQ(dev_tracks.size(), n_tracks);
+
+    dev_tracks[5].set_time(42.f);
+    EXPECT_NEAR(tracks[5].time(), 42.f, tol);
+    EXPECT_NEAR(vector::norm(dev_tracks[6].pos() - ref_tracks[6].pos()), 0.f,
+                tol);
+}
+
+// Test the SoA collection of bound track parameters
+GTEST_TEST(detray_tracks, bound_track_collection) {
+
+    vecmem::host_memory_resource host_mr;
+
+    bound_collection_t tracks{&host_mr};
+    tracks.reserve(n_tracks);
+
+    std::vector<bound_track_parameters<test_algebra>> ref_tracks;
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        ref_tracks.push_back(make_bound_track(i));
+        tracks.push_back(ref_tracks.back());
+    }
+    ASSERT_EQ(tracks.size(), n_tracks);
+    ASSERT_EQ(bound_collection_t::n_scalar_columns, 27u);
+
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto trk = tracks[i];
+        const bound_track_parameters<test_algebra> loaded = trk;
+
+        EXPECT_TRUE(loaded == ref_tracks[i]);
+        EXPECT_EQ(trk.surface_link(), ref_tracks[i].surface_link());
+        EXPECT_NEAR(trk.phi(), ref_tracks[i].phi(), tol);
+        EXPECT_NEAR(trk.theta(), ref_tracks[i].theta(), tol);
+        EXPECT_NEAR(vector::norm(trk.dir() - ref_tracks[i].dir()), 0.f, tol);
+        EXPECT_NEAR(trk.covariance_element(e_bound_theta, e_bound_loc0),
+                    0.001f * static_cast<scalar>(i), tol);
+    }
+
+    // Write through the proxy
+    tracks[2].set_covariance(ref_tracks[7].covariance());
+    tracks[3] = tracks[8];
+    tracks[4] = packed_bound_track_parameters<test_algebra>{ref_tracks[9]};
+
+    const bound_track_parameters<test_algebra> trk3 = tracks[3];
+    const bound_track_parameters<test_algebra> trk4 = tracks[4];
+    EXPECT_TRUE(trk3 == ref_tracks[8]);
+    EXPECT_TRUE(trk4 == ref_tracks[9]);
+    EXPECT_NEAR(tracks[2].covariance_element(e_bound_qoverp, e_bound_qoverp),
+                ref_tracks[7].covariance_element(e_bound_qoverp,
+                                                 e_bound_qoverp),
+                tol);
+
+    // Access through the view
+    auto view = tracks.get_data();
+    bound_track_collection<test_algebra, device_container_types> dev_tracks(
+        view);
+    ASSERT_EQ(dev_tracks.size(), n_tracks);
+
+    dev_tracks[5].set_surface_link(geometry::barcode{}.set_index(42u));
+    EXPECT_EQ(tracks[5].surface_link().index(), 42u);
+}
+
+// The batched jacobian transport works on the SoA collections
+GTEST_TEST(detray_tracks, track_collection_batched_jacobian) {
+
+    using frame_t = cartesian2D<test_algebra>;
+    using batched_engine_t = detail::batched_jacobian_engine<frame_t>;
+
+    vecmem::host_memory_resource host_mr;
+
+    const transform3 trf(point3{2.f, 3.f, 4.f}, vector3{0.f, 0.f, 1.f},
+                         vector3{1.f, 0.f, 0.f});
+    const mask<rectangle2D, test_algebra> rect{0u, 2.f, 2.f};
+
+    std::vector<bound_track_parameters<test_algebra>> ref_tracks;
+    bound_collection_t tracks{&host_mr};
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        ref_tracks.push_back(make_bound_track(i));
+        tracks.push_back(ref_tracks.back());
+    }
+
+    // AoS
+    std::vector<free_track_parameters<test_algebra>> ref_free_vecs(n_tracks);
+    std::vector<free_matrix<test_algebra>> ref_free_covs(n_tracks);
+    batched_engine_t::bound_to_free(trf, rect, ref_tracks, ref_free_vecs,
+                                    ref_free_covs);
+
+    // SoA
+    free_collection_t free_vecs{&host_mr};
+    free_vecs.resize(n_tracks);
+    std::vector<free_matrix<test_algebra>> free_covs(n_tracks);
+    batched_engine_t::bound_to_free(trf, rect, tracks, free_vecs, free_covs);
+
+    bound_collection_t tracks2{&host_mr};
+    tracks2.resize(n_tracks);
+    batched_engine_t::free_to_bound(trf, free_vecs, free_covs, tracks2);
+
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            EXPECT_NEAR(free_vecs[i][j], ref_free_vecs[i][j], tol);
+            for (unsigned int k = 0u; k < e_free_size; ++k) {
+                EXPECT_NEAR(getter::element(free_covs[i], j, k),
+                            getter::element(ref_free_covs[i], j, k), tol);
+            }
+        }
+
+        // Round trip
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(tracks2[i][j], ref_tracks[i][j], tol);
+            for (unsigned int k = 0u; k < e_bound_size; ++k) {
+                EXPECT_NEAR(tracks2[i].covariance_element(j, k),
+                            ref_tracks[i].covariance_element(j, k), 1e-4f);
+            }
+        }
+    }
+}
+
+// The propagation can be initialized from and written back to the collections
+GTEST_TEST(detray_tracks, track_collection_propagation) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Telescope in x-direction
+    tel_det_config<test_algebra, rectangle2D> tel_cfg{200.f, 200.f};
+    tel_cfg.positions({0.f, 10.f, 20.f, 30.f, 40.f, 50.f, 60.f});
+
+    const auto [det, names] =
+        build_telescope_detector<test_algebra>(host_mr, tel_cfg);
+    using detector_t = decltype(det);
+    using context_t = typename detector_t::geometry_context;
+
+    using propagator_t =
+        propagator<line_stepper<test_algebra>, navigator<detector_t>,
+                   actor_chain<parameter_transporter<test_algebra>,
+                               parameter_resetter<test_algebra>>>;
+    const propagator_t p{propagation::config{}};
+
+    // Free tracks: Propagate from the collection and write back in place
+    std::vector<free_track_parameters<test_algebra>> ref_tracks;
+    free_collection_t tracks{&host_mr};
+    bound_collection_t bound_tracks{&host_mr};
+    bound_tracks.resize(n_tracks);
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const auto s{static_cast<scalar>(i)};
+        ref_tracks.emplace_back(point3{-5.f, 0.1f * s, -0.1f * s}, 0.f,
+                                vector3{1.f, 0.01f * s, 0.02f}, -1.f);
+        tracks.push_back(ref_tracks.back());
+    }
+
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        propagator_t::state ref_propagation(ref_tracks[i], det, context_t{});
+        ASSERT_TRUE(p.propagate(ref_propagation));
+
+        propagator_t::state propagation(tracks[i], det, context_t{});
+        ASSERT_TRUE(p.propagate(propagation));
+        propagation.write_free_params(tracks[i]);
+        propagation.write_bound_params(bound_tracks[i]);
+
+        const auto &ref_free = ref_propagation._stepping();
+        EXPECT_NEAR(vector::norm(tracks[i].pos() - ref_free.pos()), 0.f, tol);
+        EXPECT_NEAR(vector::norm(tracks[i].dir() - ref_free.dir()), 0.f, tol);
+        EXPECT_NEAR(tracks[i].time(), ref_free.time(), tol);
+        EXPECT_NEAR(tracks[i].qop(), ref_free.qop(), tol);
+
+        const auto &ref_bound = ref_propagation._stepping.bound_params();
+        EXPECT_EQ(bound_tracks[i].surface_link(), ref_bound.surface_link());
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            EXPECT_NEAR(bound_tracks[i][j], ref_bound[j], tol);
+        }
+    }
+
+    // Bound tracks: Propagate back from the last plane
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const bound_track_parameters<test_algebra> ref_bound = bound_tracks[i];
+
+        propagator_t::state ref_propagation(ref_bound, det, context_t{});
+        ref_propagation._navigation.set_direction(
+            navigation::direction::e_backward);
+        p.propagate(ref_propagation);
+
+        propagator_t::state propagation(bound_tracks[i], det, context_t{});
+        propagation._navigation.set_direction(
+            navigation::direction::e_backward);
+        p.propagate(propagation);
+
+        const auto &ref_free = ref_propagation._stepping();
+        const auto &free = propagation._stepping();
+        EXPECT_NEAR(vector::norm(free.pos() - ref_free.pos()), 0.f, tol);
+        EXPECT_NEAR(vector::norm(free.dir() - ref_free.dir()), 0.f, tol);
+        EXPECT_NEAR(propagation._stepping.path_length(),
+                    ref_propagation._stepping.path_length(), tol);
+    }
+}
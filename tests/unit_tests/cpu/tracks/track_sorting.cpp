@@ -0,0 +1,87 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/tracks/track_sorting.hpp"
+
+#include "detray/tracks/free_track_parameters.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/uniform_track_generator.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Test include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+using test_algebra = test::algebra;
+using scalar = test::scalar;
+using point3 = test::point3;
+
+GTEST_TEST(detray_tracks, track_sorting) {
+
+    using track_t = free_track_parameters<test_algebra>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector<test_algebra>(host_mr);
+
+    // Tracks from two different starting volumes
+    std::vector<track_t> tracks{};
+    for (const point3 origin : {point3{0.f, 0.f, 0.f}, point3{0.f, 0.f, 0.f},
+                                point3{0.f, 40.f, 0.f}}) {
+        uniform_track_generator<track_t>::configuration trk_cfg{};
+        trk_cfg.phi_steps(10u).theta_steps(10u).origin(origin);
+
+        for (const auto track : uniform_track_generator<track_t>(trk_cfg)) {
+            tracks.push_back(track);
+        }
+    }
+    const std::vector<track_t> original{tracks};
+
+    track_sorting_config<scalar> cfg{};
+    cfg.n_eta_bins = 8u;
+    cfg.n_phi_bins = 8u;
+
+    const std::vector<dindex> permutation = sort_tracks(toy_det, tracks, cfg);
+    ASSERT_EQ(permutation.size(), tracks.size());
+
+    // The permutation maps the sorted to the original positions
+    std::vector<bool> is_used(tracks.size(), false);
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        ASSERT_LT(permutation[i], tracks.size());
+        ASSERT_FALSE(is_used[permutation[i]]);
+        is_used[permutation[i]] = true;
+
+        EXPECT_EQ(tracks[i], original[permutation[i]]);
+    }
+
+    // Sort keys are ascending, equal keys keep their original order
+    for (std::size_t i = 1u; i < tracks.size(); ++i) {
+        const auto prev_key =
+            detail::track_sort_key(toy_det, tracks[i - 1u], cfg);
+        const auto key = detail::track_sort_key(toy_det, tracks[i], cfg);
+
+        ASSERT_LE(prev_key, key);
+        if (prev_key == key) {
+            EXPECT_LT(permutation[i - 1u], permutation[i]);
+        }
+    }
+
+    // Restore the original order
+    restore_track_order(tracks, permutation);
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        EXPECT_EQ(tracks[i], original[i]);
+    }
+}
@@ -0,0 +1,89 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/utils/detector_hash.hpp"
+
+#include "detray/builders/layout_optimizer.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+using namespace detray;
+
+// Test the hashing of single values
+GTEST_TEST(detray_utils, detector_hasher) {
+
+    auto hash_of = [](const auto&... values) {
+        detail::detector_hasher hasher{};
+        (hasher.add(values), ...);
+        return hasher.value();
+    };
+
+    // FNV-1a reference value for an empty input
+    EXPECT_EQ(hash_of(), 14695981039346656037ull);
+
+    EXPECT_EQ(hash_of(1.f), hash_of(1.f));
+    EXPECT_NE(hash_of(1.f), hash_of(2.f));
+    EXPECT_EQ(hash_of(0.f), hash_of(-0.f));
+    EXPECT_NE(hash_of(1u, 2u), hash_of(2u, 1u));
+
+    // The value does not depend on the width of the type
+    EXPECT_EQ(hash_of(std::uint16_t{3u}), hash_of(std::uint64_t{3u}));
+
+    // Ranges of different length are distinguished
+    EXPECT_NE(hash_of(std::array{1u, 2u}, std::array{3u}),
+              hash_of(std::array{1u}, std::array{2u, 3u}));
+}
+
+// Test the content hash of the toy detector
+GTEST_TEST(detray_utils, detector_hash) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+
+    const auto [toy_det, names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+    auto [toy_det2, names2] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    // The same detector content gives the same hash
+    const std::uint64_t hash{detail::hash_detector(toy_det)};
+    EXPECT_EQ(hash, detail::hash_detector(toy_det2));
+
+    // Different material description
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det3, names3] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+    EXPECT_NE(hash, detail::hash_detector(toy_det3));
+
+    // Different number of layers
+    toy_cfg.use_material_maps(true).n_edc_layers(2u);
+    const auto [toy_det4, names4] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+    EXPECT_NE(hash, detail::hash_detector(toy_det4));
+
+    // Reordering the surfaces changes the content
+    layout_optimizer<detector_t>{}(toy_det2);
+    EXPECT_NE(hash, detail::hash_detector(toy_det2));
+}
@@ -0,0 +1,60 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/utils/fast_math.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// Google Test include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+
+using namespace detray;
+
+using vector3 = test::vector3;
+using scalar = test::scalar;
+
+// Test the approximate atan2 against the standard library
+GTEST_TEST(detray_utils, fast_atan2) {
+
+    constexpr double tol{2e-6};
+
+    // Special directions
+    EXPECT_NEAR(detail::fast_atan2(0.f, 1.f), 0.f, tol);
+    EXPECT_NEAR(detail::fast_atan2(1.f, 0.f), constant<float>::pi_2, tol);
+    EXPECT_NEAR(detail::fast_atan2(0.f, -1.f), constant<float>::pi, tol);
+    EXPECT_NEAR(detail::fast_atan2(-0.f, -1.f), -constant<float>::pi, tol);
+    EXPECT_NEAR(detail::fast_atan2(-1.f, 0.f), -constant<float>::pi_2, tol);
+    EXPECT_NEAR(detail::fast_atan2(1.f, 1.f), constant<float>::pi_4, tol);
+    EXPECT_EQ(detail::fast_atan2(0.f, 0.f), 0.f);
+
+    // Full circle at different radii, in single and double precision
+    for (const double r : {1e-3, 1., 1e3}) {
+        for (int i = -1800; i <= 1800; ++i) {
+            const double phi{static_cast<double>(i) * 1e-3 *
+                             constant<double>::pi};
+            const double x{r * std::cos(phi)};
+            const double y{r * std::sin(phi)};
+
+            const double ref{std::atan2(y, x)};
+            EXPECT_NEAR(detail::fast_atan2(y, x), ref, tol)
+                << "r: " << r << ", phi: " << phi;
+            EXPECT_NEAR(detail::fast_atan2(static_cast<float>(y),
+                                           static_cast<float>(x)),
+                        ref, tol)
+                << "r: " << r << ", phi: " << phi;
+        }
+    }
+
+    // Phi of a vector
+    const vector3 v{-2.f, 3.f, 4.f};
+    EXPECT_NEAR(detail::fast_phi(v), vector::phi(v), tol);
+}
@@ -0,0 +1,89 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/utils/float16.hpp"
+
+// Google Test include(s).
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using namespace detray;
+
+// Test the conversion of exactly representable values
+GTEST_TEST(detray_utils, float16_exact) {
+
+    static_assert(sizeof(float16) == 2u);
+
+    for (const float f : {0.f, -0.f, 1.f, -1.f, 0.5f, 2.f, -3.75f, 1024.f,
+                          65504.f, 6.103515625e-05f, 5.9604645e-08f}) {
+        EXPECT_EQ(static_cast<float>(float16{f}), f) << f;
+    }
+
+    // Bit patterns
+    EXPECT_EQ(float16{0.f}.bits(), 0x0000u);
+    EXPECT_EQ(float16{-0.f}.bits(), 0x8000u);
+    EXPECT_EQ(float16{1.f}.bits(), 0x3c00u);
+    EXPECT_EQ(float16{-2.f}.bits(), 0xc000u);
+    EXPECT_EQ(float16{65504.f}.bits(), 0x7bffu);
+    // Smallest normal and subnormal values
+    EXPECT_EQ(float16{6.103515625e-05f}.bits(), 0x0400u);
+    EXPECT_EQ(float16{5.9604645e-08f}.bits(), 0x0001u);
+
+    EXPECT_EQ(static_cast<float>(float16::from_bits(0x3555u)),
+              0.333251953125f);
+}
+
+// Test rounding, overflow and special values
+GTEST_TEST(detray_utils, float16_rounding) {
+
+    constexpr float inf{std::numeric_limits<float>::infinity()};
+
+    // Ties round to even
+    EXPECT_EQ(static_cast<float>(float16{2049.f}), 2048.f);
+    EXPECT_EQ(static_cast<float>(float16{2051.f}), 2052.f);
+    EXPECT_EQ(static_cast<float>(float16{2049.5f}), 2050.f);
+
+    // Rounding into the next exponent
+    EXPECT_EQ(static_cast<float>(float16{2047.9f}), 2048.f);
+
+    // Overflow
+    EXPECT_EQ(static_cast<float>(float16{65519.f}), 65504.f);
+    EXPECT_EQ(static_cast<float>(float16{65520.f}), inf);
+    EXPECT_EQ(static_cast<float>(float16{-1e10f}), -inf);
+    EXPECT_EQ(static_cast<float>(float16{inf}), inf);
+
+    // Underflow
+    EXPECT_EQ(static_cast<float>(float16{1e-10f}), 0.f);
+    EXPECT_EQ(float16{-1e-10f}.bits(), 0x8000u);
+
+    // NaN
+    EXPECT_TRUE(std::isnan(static_cast<float>(
+        float16{std::numeric_limits<float>::quiet_NaN()})));
+
+    // Relative precision in the normal range
+    for (float f = 1e-4f; f < 6e4f; f *= 1.37f) {
+        EXPECT_NEAR(static_cast<float>(float16{f}), f, f * 0x1p-11f) << f;
+        EXPECT_NEAR(static_cast<float>(float16{-f}), -f, f * 0x1p-11f) << f;
+    }
+
+    // Arithmetic
+    float16 h{1.f};
+    h += 0.5f;
+    EXPECT_EQ(static_cast<float>(h), 1.5f);
+    h *= 2.f;
+    EXPECT_EQ(static_cast<float>(h), 3.f);
+    h /= 4.f;
+    EXPECT_EQ(static_cast<float>(h), 0.75f);
+    h -= 1.f;
+    EXPECT_EQ(static_cast<float>(h), -0.25f);
+    EXPECT_EQ(2.f * h, -0.5f);
+}
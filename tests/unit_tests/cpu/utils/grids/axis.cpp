@@ -22,7 +22,9 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -608,3 +610,61 @@ GTEST_TEST(detray_grid, multi_axis_comparison) {
     // Confirm that the axes are not equal
     EXPECT_NE(ref_o_axes, diff_edge_ranges_o_axes);
 }
+
+GTEST_TEST(detray_grid, batched_axis_binning) {
+
+    // Regular binning with 36 bins in [-10, 26] and irregular binning with
+    // the edges [-3, 15]
+    vecmem::vector<scalar> bin_edges = {-10.f, 26.f, -100.f, -3.f, 1.f, 2.f,
+                                        4.f,   8.f,  12.f,   15.f, 18.f};
+
+    single_axis<circular<label::e_phi>, regular<scalar>> reg_axis(
+        dindex_range{0u, 36u}, &bin_edges);
+    single_axis<closed<label::e_z>, irregular<scalar>> irr_axis(
+        dindex_range{3u, 6u}, &bin_edges);
+    single_axis<open<label::e_x>, irregular<scalar>> open_irr_axis(
+        dindex_range{3u, 6u}, &bin_edges);
+
+    // Include under- and overflow values, bin edges and more values than fit
+    // into a single chunk
+    std::vector<scalar> values{-200.f, -10.f, -3.f, 1.f, 15.f, 26.f, 200.f};
+    for (unsigned int i = 0u; i < 150u; ++i) {
+        values.push_back(-20.f + 0.3f * static_cast<scalar>(i));
+    }
+
+    std::vector<int> bins(values.size());
+    std::vector<dindex> axis_bins(values.size());
+
+    // Batched binning is the same as the binning of single values
+    reg_axis.m_binning.bin(values.data(), bins.data(), values.size());
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        EXPECT_EQ(bins[i], reg_axis.m_binning.bin(values[i])) << values[i];
+    }
+    irr_axis.m_binning.bin(values.data(), bins.data(), values.size());
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        EXPECT_EQ(bins[i], irr_axis.m_binning.bin(values[i])) << values[i];
+    }
+
+    // Including the axis bounds
+    reg_axis.bin(values.data(), axis_bins.data(), values.size());
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        EXPECT_EQ(axis_bins[i], reg_axis.bin(values[i])) << values[i];
+    }
+    irr_axis.bin(values.data(), axis_bins.data(), values.size());
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        EXPECT_EQ(axis_bins[i], irr_axis.bin(values[i])) << values[i];
+    }
+    open_irr_axis.bin(values.data(), axis_bins.data(), values.size());
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        EXPECT_EQ(axis_bins[i], open_irr_axis.bin(values[i])) << values[i];
+    }
+
+    // The branchless search finds the same bins as a lower bound search
+    for (const scalar v : values) {
+        const auto first = bin_edges.begin() + 3;
+        const auto pos = std::lower_bound(first, first + 6, v);
+        EXPECT_EQ(irr_axis.m_binning.bin(v),
+                  static_cast<int>(pos - first) - 1)
+            << v;
+    }
+}
@@ -10,7 +10,11 @@
 
 #include "detray/builders/grid_builder.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/navigation/accelerators/search_buffer.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // Detray test include(s)
@@ -28,6 +32,7 @@
 #include <algorithm>
 #include <limits>
 #include <random>
+#include <stdexcept>
 
 using namespace detray;
 using namespace detray::axis;
@@ -347,6 +352,186 @@ GTEST_TEST(detray_grid, dynamic_array) {
         std::equal(flat_bin_view2.begin(), flat_bin_view2.end(), seq.begin()));
 }
 
+/// Unittest: Test grid construction with delta encoded bin content
+GTEST_TEST(detray_grid, compressed_array) {
+
+    using bin_t = bins::compressed_array<dindex>;
+
+    using grid_owning_t = grid<test_algebra, axes<cuboid3D>, bin_t>;
+
+    using grid_device_t = grid<test_algebra, axes<cuboid3D>, bin_t,
+                               simple_serializer, device_container_types>;
+
+    static_assert(concepts::dynamic_bin<bin_t>);
+    static_assert(concepts::grid<grid_owning_t>);
+    static_assert(concepts::grid<grid_device_t>);
+
+    // Single bin: Entries are sorted and deduplicated
+    std::vector<bin_t::storage_type> storage(5u);
+    bin_t::data data{0u, 0u, 5u};
+
+    bin_t bin{storage.data(), data};
+    ASSERT_EQ(bin.capacity(), 5u);
+    ASSERT_EQ(bin.size(), 0u);
+
+    for (const dindex e : {300u, 12u, 40'000u, 12u, 100u, 40'000u}) {
+        bin.push_back(e);
+    }
+    ASSERT_EQ(bin.size(), 4u);
+    EXPECT_EQ(data.base, 12u);
+    EXPECT_EQ(bin[2], 300u);
+
+    const std::vector<dindex> expected{12u, 100u, 300u, 40'000u};
+    EXPECT_TRUE(std::equal(bin.begin(), bin.end(), expected.begin()));
+
+    bin.init(7u);
+    ASSERT_EQ(bin.size(), 1u);
+    EXPECT_EQ(*bin.begin(), 7u);
+
+    // The entries may span at most the bin capacity
+    EXPECT_TRUE(bin.fits(134u));
+    EXPECT_FALSE(bin.fits(135u));
+    bin.push_back(100u);
+    EXPECT_TRUE(bin.fits(0u));
+    EXPECT_FALSE(bin.fits(228u));
+
+    // Grid with two entries per bin
+    grid_owning_t::bin_container_type bin_data{};
+    bin_data.bins.resize(40'000u);
+    bin_data.entries.resize(80'000u);
+
+    dindex offset{0u};
+    for (auto& bin_entry : bin_data.bins) {
+        bin_entry.offset = offset;
+        bin_entry.capacity = 2u;
+        offset += bin_entry.capacity;
+    }
+
+    dvector<scalar> bin_edges_cp(bin_edges);
+    dvector<dindex_range> edge_ranges_cp(edge_ranges);
+    cartesian_3D<is_owning, host_container_types> axes_own(
+        std::move(edge_ranges_cp), std::move(bin_edges_cp));
+    grid_owning_t grid_own(std::move(bin_data), std::move(axes_own));
+
+    // Every bin holds its global index and the index of the next bin
+    for (dindex gbin = 0u; gbin < grid_own.nbins(); ++gbin) {
+        grid_own.template populate<attach<>>(gbin, gbin + 1u);
+        grid_own.template populate<attach<>>(gbin, gbin);
+    }
+
+    EXPECT_EQ(grid_own.size(), 80'000u);
+
+    const point3 p{-4.5f, -4.5f, 4.5f};
+    const auto grid_bin = grid_own.search(p);
+    const dindex gbin{grid_own.serialize(grid_own.axes().bins(p))};
+    ASSERT_EQ(grid_bin.size(), 2u);
+    EXPECT_EQ(grid_bin[0], gbin);
+    EXPECT_EQ(grid_bin[1], gbin + 1u);
+
+    // Neighborhood search
+    const darray<dindex, 2> window{1u, 1u};
+    EXPECT_EQ(grid_own.search(p, window).size(), 54u);
+
+    // Construct a grid from a view
+    grid_owning_t::view_type grid_view = get_data(grid_own);
+    grid_device_t device_grid(grid_view);
+
+    EXPECT_EQ(device_grid.size(), grid_own.size());
+    EXPECT_EQ(device_grid.search(p)[1], gbin + 1u);
+}
+
+/// Unittest: Bins that hold a bitmask of their entries
+GTEST_TEST(detray_grid, bitset) {
+
+    using bin_t = bins::bitset<dindex, 2u>;
+
+    using grid_owning_t = grid<test_algebra, axes<cuboid3D>, bin_t>;
+
+    static_assert(!concepts::dynamic_bin<bin_t>);
+    static_assert(concepts::mergeable_bin<bin_t>);
+    static_assert(concepts::grid<grid_owning_t>);
+
+    // Single bin: Entries are sorted and deduplicated
+    bin_t bin{};
+    ASSERT_EQ(bin.capacity(), 128u);
+    ASSERT_EQ(bin.size(), 0u);
+
+    for (const dindex e : {300u, 312u, 250u, 312u, 377u, 250u}) {
+        bin.push_back(e);
+    }
+    ASSERT_EQ(bin.size(), 4u);
+    EXPECT_EQ(bin.base(), 250u);
+
+    const std::vector<dindex> expected{250u, 300u, 312u, 377u};
+    EXPECT_TRUE(std::equal(bin.begin(), bin.end(), expected.begin()));
+
+    // Union with a bin of a different base index
+    bin_t other{};
+    other.push_back(240u);
+    other.push_back(300u);
+    bin.merge(other);
+
+    const std::vector<dindex> merged{240u, 250u, 300u, 312u, 377u};
+    ASSERT_EQ(bin.size(), 5u);
+    EXPECT_TRUE(std::equal(bin.begin(), bin.end(), merged.begin()));
+
+    bin.init(7u);
+    ASSERT_EQ(bin.size(), 1u);
+    EXPECT_EQ(*bin.begin(), 7u);
+
+    // The entries may span at most the bin capacity
+    EXPECT_TRUE(bin.fits(134u));
+    EXPECT_FALSE(bin.fits(135u));
+    bin.push_back(100u);
+    EXPECT_TRUE(bin.fits(0u));
+    EXPECT_FALSE(bin.fits(228u));
+
+    // Grid in which every bin holds its index and the index of the next bin
+    dvector<scalar> bin_edges_cp(bin_edges);
+    dvector<dindex_range> edge_ranges_cp(edge_ranges);
+    cartesian_3D<is_owning, host_container_types> axes_own(
+        std::move(edge_ranges_cp), std::move(bin_edges_cp));
+
+    grid_owning_t::bin_container_type bin_data{};
+    bin_data.resize(40'000u);
+    grid_owning_t grid_own(std::move(bin_data), std::move(axes_own));
+
+    for (dindex gbin = 0u; gbin < grid_own.nbins(); ++gbin) {
+        grid_own.template populate<attach<>>(gbin, gbin);
+        grid_own.template populate<attach<>>(gbin, gbin + 1u);
+    }
+
+    // The bin fillers refuse entries that do not fit
+    EXPECT_NO_THROW(detail::attach_checked(grid_own, 0u, 127u));
+    EXPECT_THROW(detail::attach_checked(grid_own, 0u, 128u),
+                 std::out_of_range);
+
+    const point3 p{-4.5f, -4.5f, 4.5f};
+    const dindex gbin{grid_own.serialize(grid_own.axes().bins(p))};
+
+    // Neighbouring bins along the first axis share an entry
+    const darray<darray<dindex, 2>, 3> window{darray<dindex, 2>{1u, 1u},
+                                              darray<dindex, 2>{0u, 0u},
+                                              darray<dindex, 2>{0u, 0u}};
+    EXPECT_EQ(grid_own.search(p, window).size(), 6u);
+
+    const bin_t bin_union = grid_own.search_union(p, window);
+    const std::vector<dindex> expected_union{gbin - 1u, gbin, gbin + 1u,
+                                             gbin + 2u};
+    ASSERT_EQ(bin_union.size(), 4u);
+    EXPECT_TRUE(std::equal(bin_union.begin(), bin_union.end(),
+                           expected_union.begin()));
+
+    // The flat search buffer receives the deduplicated union
+    search_buffer<16u> buffer;
+    grid_own.search_into(p, window, buffer);
+
+    ASSERT_EQ(buffer.size(), 4u);
+    for (dindex i = 0u; i < buffer.size(); ++i) {
+        EXPECT_EQ(buffer[i], expected_union[i]);
+    }
+}
+
 /// Test bin entry retrieval
 GTEST_TEST(detray_grid, bin_view) {
 
@@ -722,3 +907,251 @@ GTEST_TEST(detray_grid, regular_attach_population) {
         EXPECT_TRUE(entry == 5.f || entry == 6.f || entry == 7.f);
     }
 }
+
+/// Test the search window that is adapted to the track incidence angle
+GTEST_TEST(detray_grid, adaptive_search_window) {
+
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Disc grid with 10mm wide bins in r and 36 bins in phi
+    auto gr_factory = grid_factory<bins::static_array<dindex, 1>,
+                                   simple_serializer, test_algebra>{host_mr};
+    mask<ring2D, test_algebra> disc{0u, 0.f, 100.f};
+    auto disc_gr = gr_factory.new_grid(disc, {10u, 36u});
+
+    const test::transform3 trf{};
+    const darray<dindex, 2> max_window{3u, 3u};
+    const scalar mask_tol{3.f * unit<scalar>::mm};
+
+    // Normal incidence: Only look at the current bin
+    point3 p{45.f, 0.f, 0.f};
+    vector3 d{0.f, 0.f, 1.f};
+    auto window = disc_gr.adaptive_search_window(trf, p, d, mask_tol,
+                                                  max_window);
+    EXPECT_EQ(window[0], 0u);
+    EXPECT_EQ(window[1], 0u);
+
+    // Crosses into the neighbouring r bin within the tolerance
+    p = {49.f, 0.f, 0.f};
+    d = vector::normalize(vector3{1.f, 0.f, 1.f});
+    window = disc_gr.adaptive_search_window(trf, p, d, mask_tol, max_window);
+    EXPECT_EQ(window[0], 1u);
+    EXPECT_EQ(window[1], 1u);
+
+    // Same in phi, across the wrap-around of the circular axis
+    p = {-45.f, -0.5f, 0.f};
+    d = vector::normalize(vector3{0.f, 1.f, 1.f});
+    window = disc_gr.adaptive_search_window(trf, p, d, mask_tol, max_window);
+    EXPECT_EQ(window[0], 1u);
+    EXPECT_EQ(window[1], 1u);
+
+    // Almost parallel to the grid: Limited by the maximal window
+    p = {45.f, 0.f, 0.f};
+    d = vector::normalize(vector3{1.f, 0.f, 0.01f});
+    window = disc_gr.adaptive_search_window(trf, p, d, mask_tol, max_window);
+    EXPECT_EQ(window[0], max_window[0]);
+    EXPECT_EQ(window[1], max_window[1]);
+}
+
+/// Test the search window that only extends in track direction
+GTEST_TEST(detray_grid, directed_search_window) {
+
+    using vector3 = test::vector3;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Disc grid with 10mm wide bins in r and 36 bins in phi
+    auto gr_factory = grid_factory<bins::static_array<dindex, 1>,
+                                   simple_serializer, test_algebra>{host_mr};
+    mask<ring2D, test_algebra> disc{0u, 0.f, 100.f};
+    auto disc_gr = gr_factory.new_grid(disc, {10u, 36u});
+
+    // Fill every bin with its global bin index
+    for (dindex gbin = 0u; gbin < disc_gr.nbins(); ++gbin) {
+        disc_gr.template populate<replace<>>(gbin, gbin);
+    }
+
+    const test::transform3 trf{};
+    const darray<dindex, 2> max_window{3u, 3u};
+    const scalar mask_tol{3.f * unit<scalar>::mm};
+    const scalar overstep_tol{-1.f * unit<scalar>::mm};
+
+    // Normal incidence: Only look at the current bin
+    point3 p{45.f, 0.f, 0.f};
+    vector3 d{0.f, 0.f, 1.f};
+    auto window = disc_gr.directed_search_window(trf, p, d, mask_tol,
+                                                 overstep_tol, max_window);
+    for (const auto& axis_window : window) {
+        EXPECT_EQ(axis_window[0], 0u);
+        EXPECT_EQ(axis_window[1], 0u);
+    }
+
+    // Crosses into the next r bin in front of the track, but not behind it
+    p = {49.f, 0.f, 0.f};
+    d = vector::normalize(vector3{1.f, 0.f, 1.f});
+    window = disc_gr.directed_search_window(trf, p, d, mask_tol, overstep_tol,
+                                            max_window);
+    EXPECT_EQ(window[0][0], 0u);
+    EXPECT_EQ(window[0][1], 1u);
+    EXPECT_EQ(window[1][0], 0u);
+    EXPECT_EQ(window[1][1], 0u);
+
+    // Flying inwards, with enough overstep tolerance to look behind
+    p = {41.f, 0.f, 0.f};
+    d = vector::normalize(vector3{-1.f, 0.f, 1.f});
+    window = disc_gr.directed_search_window(trf, p, d, mask_tol, -mask_tol,
+                                            max_window);
+    EXPECT_EQ(window[0][0], 1u);
+    EXPECT_EQ(window[0][1], 0u);
+
+    // Same in phi, across the wrap-around of the circular axis
+    p = {-45.f, -0.5f, 0.f};
+    d = vector::normalize(vector3{0.f, 1.f, 1.f});
+    window = disc_gr.directed_search_window(trf, p, d, mask_tol, overstep_tol,
+                                            max_window);
+    EXPECT_EQ(window[0][0], 0u);
+    EXPECT_EQ(window[0][1], 0u);
+    EXPECT_EQ(window[1][0] + window[1][1], 1u);
+
+    // Almost parallel to the grid: Limited by the maximal window
+    p = {45.f, 0.f, 0.f};
+    d = vector::normalize(vector3{1.f, 0.f, 0.01f});
+    window = disc_gr.directed_search_window(trf, p, d, mask_tol, overstep_tol,
+                                            max_window);
+    EXPECT_EQ(window[0][0], 0u);
+    EXPECT_EQ(window[0][1], max_window[1]);
+
+    // The search only returns the bins in front of the track
+    const auto loc_p = disc_gr.project(trf, p, d);
+    const auto candidates = disc_gr.search(loc_p, window);
+    EXPECT_EQ(candidates.size(), 4u);
+    for (const dindex gbin : candidates) {
+        const auto loc_bin = disc_gr.deserialize(gbin);
+        EXPECT_GE(loc_bin[0], 4u);
+        EXPECT_EQ(loc_bin[1], disc_gr.axes().bins(loc_p)[1]);
+    }
+    EXPECT_EQ(disc_gr.search(loc_p, max_window).size(), 49u);
+}
+
+/// Write the neighborhood to a flat buffer instead of the joined bin view
+GTEST_TEST(detray_grid, search_into_buffer) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Disc grid with 10mm wide bins in r and 36 bins in phi
+    auto gr_factory = grid_factory<bins::static_array<dindex, 2>,
+                                   simple_serializer, test_algebra>{host_mr};
+    mask<ring2D, test_algebra> disc{0u, 0.f, 100.f};
+    auto disc_gr = gr_factory.new_grid(disc, {10u, 36u});
+
+    // Fill every bin with its global bin index (twice)
+    for (dindex gbin = 0u; gbin < disc_gr.nbins(); ++gbin) {
+        disc_gr.template populate<complete<>>(gbin, gbin);
+    }
+
+    const test::transform3 trf{};
+    const test::vector3 d{0.f, 0.f, 1.f};
+
+    // Inside the grid, at the border and across the phi wrap-around
+    for (const point3 p : {point3{45.f, 10.f, 0.f}, point3{95.f, 1.f, 0.f},
+                           point3{-45.f, -0.5f, 0.f}}) {
+
+        const auto loc_p = disc_gr.project(trf, p, d);
+
+        for (const darray<dindex, 2> window :
+             {darray<dindex, 2>{0u, 0u}, darray<dindex, 2>{1u, 1u},
+              darray<dindex, 2>{2u, 3u}}) {
+
+            search_buffer<128u> buffer;
+            disc_gr.search_into(loc_p, window, buffer);
+
+            ASSERT_FALSE(buffer.overflow());
+
+            // Same values in the same order
+            const auto candidates = disc_gr.search(loc_p, window);
+            ASSERT_EQ(buffer.size(), candidates.size());
+            dindex i{0u};
+            for (const dindex entry : candidates) {
+                EXPECT_EQ(buffer[i++], entry);
+            }
+        }
+
+        // Search window with separate neighborhoods per axis
+        const darray<darray<dindex, 2>, 2> axis_window{
+            darray<dindex, 2>{0u, 1u}, darray<dindex, 2>{2u, 0u}};
+
+        search_buffer<128u> buffer;
+        disc_gr.search_into(loc_p, axis_window, buffer);
+
+        const auto candidates = disc_gr.search(loc_p, axis_window);
+        ASSERT_EQ(buffer.size(), candidates.size());
+        dindex i{0u};
+        for (const dindex entry : candidates) {
+            EXPECT_EQ(buffer[i++], entry);
+        }
+    }
+
+    // The neighborhood does not fit into the buffer
+    const auto loc_p = disc_gr.project(trf, point3{45.f, 10.f, 0.f}, d);
+    search_buffer<16u> small_buffer;
+    disc_gr.search_into(loc_p, darray<dindex, 2>{2u, 2u}, small_buffer);
+
+    EXPECT_TRUE(small_buffer.overflow());
+    EXPECT_EQ(small_buffer.size(), 16u);
+
+    small_buffer.clear();
+    EXPECT_TRUE(small_buffer.empty());
+    EXPECT_FALSE(small_buffer.overflow());
+}
+
+/// Write only the entries of sorted bins that lie in an interval of keys
+GTEST_TEST(detray_grid, search_into_sorted_bins) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Disc grid with 10mm wide bins in r and 36 bins in phi
+    auto gr_factory = grid_factory<bins::static_array<dindex, 4>,
+                                   simple_serializer, test_algebra>{host_mr};
+    mask<ring2D, test_algebra> disc{0u, 0.f, 100.f};
+    auto disc_gr = gr_factory.new_grid(disc, {10u, 36u});
+
+    // Fill every bin with entries in ascending order
+    for (dindex gbin = 0u; gbin < disc_gr.nbins(); ++gbin) {
+        for (dindex entry = 0u; entry < 4u; ++entry) {
+            disc_gr.template populate<attach<>>(gbin, entry);
+        }
+    }
+
+    // The key is the entry itself: Count how often it is queried
+    dindex n_queries{0u};
+    auto get_key = [&n_queries](const dindex entry) {
+        ++n_queries;
+        return static_cast<scalar>(entry);
+    };
+    const detail::sorted_bin_entries<decltype(get_key), scalar> fill_bin{
+        get_key, 0.5f, 1.5f};
+
+    const auto loc_p =
+        disc_gr.project(test::transform3{}, point3{45.f, 10.f, 0.f},
+                        test::vector3{0.f, 0.f, 1.f});
+
+    search_buffer<128u> buffer;
+    disc_gr.search_into(loc_p, darray<dindex, 2>{1u, 1u}, buffer, fill_bin);
+
+    // Nine bins with the entry 1
+    ASSERT_FALSE(buffer.overflow());
+    ASSERT_EQ(buffer.size(), 9u);
+    for (dindex i = 0u; i < buffer.size(); ++i) {
+        EXPECT_EQ(buffer[i], 1u);
+    }
+
+    // The search stops at the entry 2: The last entry is never visited
+    EXPECT_EQ(n_queries, 9u * 3u);
+
+    // Without filter, all entries are written
+    search_buffer<128u> all_buffer;
+    disc_gr.search_into(loc_p, darray<dindex, 2>{1u, 1u}, all_buffer);
+    EXPECT_EQ(all_buffer.size(), 36u);
+}
@@ -89,9 +89,17 @@ GTEST_TEST(detray_grid, grid_collection) {
     // Basics
     EXPECT_EQ(grid_coll.size(), 3u);
     EXPECT_EQ(grid_coll.bin_storage().size(), 197u);
-    EXPECT_EQ(grid_coll.axes_storage().size(), 9u);
+    EXPECT_EQ(grid_coll.headers().size(), 3u);
     EXPECT_EQ(grid_coll.bin_edges_storage().size(), 18u);
 
+    // The bin offset and the axes of a grid are packed into its header
+    using header_t = typename grid_collection<grid_t>::header_type;
+    static_assert(sizeof(header_t) == 32u);
+    static_assert(alignof(header_t) == 32u);
+    EXPECT_EQ(grid_coll.headers()[1].bin_offset, 48u);
+    EXPECT_EQ(grid_coll.headers()[1].edge_offsets[2][0], 10u);
+    EXPECT_EQ(grid_coll.headers()[1].edge_offsets[2][1], 8u);
+
     // Get a grid instance
     auto single_grid = grid_coll[1];
 
@@ -213,7 +221,7 @@ GTEST_TEST(detray_grid, grid_collection_dynamic_bin) {
     EXPECT_EQ(grid_coll.size(), 3u);
     EXPECT_EQ(grid_coll.bin_storage().bins.size(), 197u);
     EXPECT_EQ(grid_coll.bin_storage().entries.size(), 4u * 197u);
-    EXPECT_EQ(grid_coll.axes_storage().size(), 9u);
+    EXPECT_EQ(grid_coll.headers().size(), 3u);
     EXPECT_EQ(grid_coll.bin_edges_storage().size(), 18u);
 
     // Get a grid instance
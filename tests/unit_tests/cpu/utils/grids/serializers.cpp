@@ -113,3 +113,96 @@ GTEST_TEST(detray_grid, serializer3D) {
     expected_mbin = {1u, 1u, 1u};
     EXPECT_EQ(serializer(axes, 13u), expected_mbin);
 }
+
+GTEST_TEST(detray_grid, tiled_serializer2D) {
+
+    // Offsets into edges container and #bins for all axes: The tiles on the
+    // upper edges of both axes are truncated
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 6u}, {2u, 11u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    polar_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    tiled_serializer<2> serializer{};
+
+    // Serializing: The bins of a 4x4 tile are contiguous
+    multi_bin<2> mbin{0u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 0u);
+    mbin = {3u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 3u);
+    mbin = {0u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 4u);
+    mbin = {3u, 3u};
+    EXPECT_EQ(serializer(axes, mbin), 15u);
+    // Truncated tile on the first axis
+    mbin = {4u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 16u);
+    mbin = {5u, 3u};
+    EXPECT_EQ(serializer(axes, mbin), 23u);
+    // Second row of tiles
+    mbin = {0u, 4u};
+    EXPECT_EQ(serializer(axes, mbin), 24u);
+    // Truncated tiles on the second axis
+    mbin = {1u, 9u};
+    EXPECT_EQ(serializer(axes, mbin), 53u);
+    mbin = {5u, 10u};
+    EXPECT_EQ(serializer(axes, mbin), 65u);
+
+    // Deserialize
+    multi_bin<2> expected_mbin{3u, 3u};
+    EXPECT_EQ(serializer(axes, 15u), expected_mbin);
+    expected_mbin = {5u, 3u};
+    EXPECT_EQ(serializer(axes, 23u), expected_mbin);
+    expected_mbin = {1u, 9u};
+    EXPECT_EQ(serializer(axes, 53u), expected_mbin);
+
+    // The layout is dense and every bin is hit exactly once
+    vecmem::vector<unsigned int> n_hits(axes.nbins(), 0u);
+    for (dindex i = 0u; i < 6u; ++i) {
+        for (dindex j = 0u; j < 11u; ++j) {
+            mbin = {i, j};
+            const dindex gbin{serializer(axes, mbin)};
+            ASSERT_LT(gbin, axes.nbins());
+            ++n_hits[gbin];
+            EXPECT_EQ(serializer(axes, gbin), mbin);
+        }
+    }
+    for (const unsigned int n : n_hits) {
+        EXPECT_EQ(n, 1u);
+    }
+}
+
+GTEST_TEST(detray_grid, tiled_serializer3D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 5u}, {2u, 7u}, {4u, 3u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    cylinder_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    tiled_serializer<3> serializer{};
+
+    // The tiled planes are stacked along the third axis
+    multi_bin<3> mbin{0u, 0u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 35u);
+    mbin = {4u, 6u, 2u};
+    EXPECT_EQ(serializer(axes, mbin), 104u);
+
+    vecmem::vector<unsigned int> n_hits(axes.nbins(), 0u);
+    for (dindex i = 0u; i < 5u; ++i) {
+        for (dindex j = 0u; j < 7u; ++j) {
+            for (dindex k = 0u; k < 3u; ++k) {
+                mbin = {i, j, k};
+                const dindex gbin{serializer(axes, mbin)};
+                ASSERT_LT(gbin, axes.nbins());
+                ++n_hits[gbin];
+                EXPECT_EQ(serializer(axes, gbin), mbin);
+            }
+        }
+    }
+    for (const unsigned int n : n_hits) {
+        EXPECT_EQ(n, 1u);
+    }
+}
@@ -0,0 +1,99 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/algebra.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using scalar = test::scalar;
+using matrix6_type = test::matrix<6, 6>;
+using matrix8_type = test::matrix<8, 8>;
+
+constexpr scalar tolerance = 1e-4f;
+
+namespace {
+
+/// Fill @param m with distinct, non-symmetric entries
+template <typename matrix_t>
+void fill(matrix_t& m, const unsigned int dim, const scalar offset) {
+    for (unsigned int i = 0u; i < dim; ++i) {
+        for (unsigned int j = 0u; j < dim; ++j) {
+            getter::element(m, i, j) =
+                offset + 0.1f * static_cast<scalar>(i) -
+                0.05f * static_cast<scalar>(j * j) +
+                (i == j ? 1.f : 0.f);
+        }
+    }
+}
+
+/// Compare the first @param dim rows and columns of @param A and @param B
+template <typename matrix_t>
+void expect_near(const matrix_t& A, const matrix_t& B,
+                 const unsigned int dim) {
+    for (unsigned int i = 0u; i < dim; ++i) {
+        for (unsigned int j = 0u; j < dim; ++j) {
+            EXPECT_NEAR(getter::element(A, i, j), getter::element(B, i, j),
+                        tolerance)
+                << "(" << i << ", " << j << ")";
+        }
+    }
+}
+
+}  // namespace
+
+// Compare the unrolled 8x8 product with the plugin product
+GTEST_TEST(detray_utils, matrix_kernels_multiply_8x8) {
+
+    matrix8_type A = matrix::zero<matrix8_type>();
+    matrix8_type B = matrix::zero<matrix8_type>();
+    fill(A, 8u, 0.3f);
+    fill(B, 8u, -0.2f);
+
+    expect_near(matrix::multiply_8x8(A, B), A * B, 8u);
+    expect_near(matrix::multiply_8x8(B, A), B * A, 8u);
+
+    // Multiplication with the identity
+    const auto I = matrix::identity<matrix8_type>();
+    expect_near(matrix::multiply_8x8(I, A), A, 8u);
+    expect_near(matrix::multiply_8x8(A, I), A, 8u);
+}
+
+// Compare the unrolled 6x6 product with the plugin product
+GTEST_TEST(detray_utils, matrix_kernels_multiply_6x6) {
+
+    matrix6_type A = matrix::zero<matrix6_type>();
+    matrix6_type B = matrix::zero<matrix6_type>();
+    fill(A, 6u, 0.7f);
+    fill(B, 6u, 0.1f);
+
+    expect_near(matrix::multiply_6x6(A, B), A * B, 6u);
+    expect_near(matrix::multiply_6x6(B, A), B * A, 6u);
+}
+
+// Compare the similarity transform with the plugin products
+GTEST_TEST(detray_utils, matrix_kernels_similarity_6x6) {
+
+    matrix6_type J = matrix::zero<matrix6_type>();
+    matrix6_type L = matrix::zero<matrix6_type>();
+    fill(J, 6u, 0.2f);
+    fill(L, 6u, -0.4f);
+
+    // Symmetric, positive definite covariance
+    const matrix6_type C = L * matrix::transpose(L);
+
+    const matrix6_type out = matrix::similarity_6x6(J, C);
+
+    expect_near(out, J * C * matrix::transpose(J), 6u);
+    expect_near(out, matrix::transpose(out), 6u);
+}
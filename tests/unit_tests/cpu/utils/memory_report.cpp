@@ -0,0 +1,79 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/utils/memory_report.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <iostream>
+#include <type_traits>
+
+using namespace detray;
+
+// Test the memory breakdown of the toy detector
+GTEST_TEST(detray_utils, memory_report) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    const memory_report report = get_memory_report(toy_det);
+    std::cout << report << std::endl;
+
+    // One record per container, or per collection in the multi stores
+    const std::size_t n_records{
+        4u + detector_t::mask_container::n_collections() +
+        detector_t::material_container::n_collections() +
+        detector_t::accelerator_container::n_collections()};
+    ASSERT_EQ(report.records.size(), n_records);
+
+    // Volumes
+    const auto& vol_rec = report.records.front();
+    EXPECT_EQ(vol_rec.container, "volumes");
+    EXPECT_EQ(vol_rec.type, "volume_descriptor");
+    EXPECT_EQ(vol_rec.n_elements, toy_det.volumes().size());
+    EXPECT_EQ(vol_rec.element_size, sizeof(typename detector_t::volume_type));
+    EXPECT_EQ(vol_rec.n_bytes, vol_rec.n_elements * vol_rec.element_size);
+
+    // Masks
+    std::size_t n_masks{0u};
+    for (const auto& rec : report.records) {
+        if (rec.container == "masks") {
+            EXPECT_GT(rec.element_size, 0u);
+            EXPECT_EQ(rec.n_bytes, rec.n_elements * rec.element_size);
+            n_masks += rec.n_elements;
+        }
+    }
+    EXPECT_EQ(n_masks, toy_det.mask_store().total_size());
+
+    // Totals
+    const auto bytes = report.bytes_per_container();
+    EXPECT_EQ(bytes.size(), 7u);
+    EXPECT_GT(bytes.at("material"), 0u);
+    EXPECT_GT(bytes.at("accelerators"), 0u);
+
+    std::size_t total{0u};
+    for (const auto& [_, n] : bytes) {
+        total += n;
+    }
+    EXPECT_EQ(report.n_bytes(), total);
+}
@@ -9,6 +9,7 @@
 #include "detray/utils/quadratic_equation.hpp"
 
 #include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
 #include "detray/utils/tuple_helpers.hpp"
 
 // Detray test include(s)
@@ -73,3 +74,46 @@ GTEST_TEST(detray_utils, quadratic_equation) {
     EXPECT_NEAR(qe8.smaller(), 0.f, epsilon);
     EXPECT_NEAR(qe8.larger(), 5.f / 2.f, epsilon);
 }
+
+// This tests the branchless quadratic equation solver against the reference
+GTEST_TEST(detray_utils, branchless_quadratic_equation) {
+
+    static constexpr scalar epsilon{1e-5f};
+
+    // Coefficients of: no solution, one solution (quadratic and linear), two
+    // solutions and a degenerate equation
+    const darray<darray<scalar, 3>, 9> coeffs{{{1.5f, 0.f, 1.f},
+                                               {1.f, 0.f, 0.f},
+                                               {0.f, 1.f, 2.f},
+                                               {2.f, 5.f, 3.f},
+                                               {2.f, 5.f, -3.f},
+                                               {2.f, -5.f, 3.f},
+                                               {2.f, -5.f, -3.f},
+                                               {2.f, -5.f, 0.f},
+                                               {0.f, 0.f, 1.f}}};
+
+    for (const auto &[a, b, c] : coeffs) {
+        const detail::quadratic_equation<scalar> ref{a, b, c};
+        const detail::branchless_quadratic_equation<scalar> qe{a, b, c};
+
+        ASSERT_EQ(qe.solutions(), ref.solutions());
+
+        if (ref.solutions() > 0) {
+            EXPECT_NEAR(qe.smaller(), ref.smaller(), epsilon);
+        } else {
+            EXPECT_TRUE(detail::is_invalid_value(qe.smaller()));
+        }
+        if (ref.solutions() > 1) {
+            EXPECT_NEAR(qe.larger(), ref.larger(), epsilon);
+        } else {
+            EXPECT_TRUE(detail::is_invalid_value(qe.larger()));
+        }
+    }
+
+    // Numerical stability: The small root does not suffer from cancellation
+    const detail::branchless_quadratic_equation<scalar> qe{1.f, 1e4f, 1.f};
+
+    ASSERT_EQ(qe.solutions(), 2);
+    EXPECT_NEAR(qe.smaller(), -1e4f, 1e-2f);
+    EXPECT_NEAR(qe.larger() / -1e-4f, 1.f, epsilon);
+}
@@ -11,6 +11,13 @@
 // Google Test include(s).
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <ranges>
+#include <vector>
+
 // Test sort functions
 GTEST_TEST(detray_utils, insertion_sort) {
 
@@ -31,3 +38,83 @@ GTEST_TEST(detray_utils, selection_sort) {
 
     ASSERT_EQ(vec, vec_sorted);
 }
+
+GTEST_TEST(detray_utils, repair_sort) {
+
+    // Almost sorted range
+    std::vector<double> vec = {1.2, 4.1, 1.4, 5., 9.};
+    std::vector<double> vec_sorted = {1.2, 1.4, 4.1, 5., 9.};
+
+    detray::detail::repair_sort(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+
+    // Already sorted range remains unchanged
+    detray::detail::repair_sort(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+
+    // Reversed range
+    std::vector<double> vec_rev = {9., 5., 4.1, 1.4, 1.2};
+
+    detray::detail::repair_sort(vec_rev.begin(), vec_rev.end());
+
+    ASSERT_EQ(vec_rev, vec_sorted);
+
+    // Empty range and single element
+    std::vector<double> vec_empty = {};
+    detray::detail::repair_sort(vec_empty.begin(), vec_empty.end());
+    ASSERT_TRUE(vec_empty.empty());
+
+    std::vector<double> vec_single = {3.};
+    detray::detail::repair_sort(vec_single.begin(), vec_single.end());
+    ASSERT_EQ(vec_single.front(), 3.);
+}
+
+GTEST_TEST(detray_utils, network_sort) {
+
+    std::vector<double> vec = {4.1, 5., 1.2, 1.4, 9.};
+    std::vector<double> vec_sorted = {1.2, 1.4, 4.1, 5., 9.};
+
+    detray::detail::network_sort<5>(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+
+    // Shorter range than the network
+    std::vector<double> vec_short = {4.1, 5., 1.2, 1.4, 9.};
+
+    detray::detail::network_sort<10>(vec_short.begin(), vec_short.end());
+
+    ASSERT_EQ(vec_short, vec_sorted);
+
+    // Custom comparator
+    std::array<double, 5> arr_rev = {4.1, 5., 1.2, 1.4, 9.};
+
+    detray::detail::network_sort<5>(arr_rev.begin(), arr_rev.end(),
+                                    std::greater<void>());
+
+    ASSERT_TRUE(std::ranges::equal(arr_rev, std::views::reverse(vec_sorted)));
+
+    // Zero-one principle: A network sorts all inputs, if it sorts all
+    // sequences of zeros and ones
+    constexpr std::size_t n{9u};
+    for (unsigned int bits = 0u; bits < (1u << n); ++bits) {
+        for (std::size_t len = 0u; len <= n; ++len) {
+            std::array<int, n> arr{};
+            for (std::size_t i = 0u; i < n; ++i) {
+                arr[i] = static_cast<int>((bits >> i) & 1u);
+            }
+
+            detray::detail::network_sort<n>(arr.begin(), arr.begin() + len);
+
+            ASSERT_TRUE(std::is_sorted(arr.begin(), arr.begin() + len));
+        }
+    }
+
+    // Network sizes
+    EXPECT_EQ(detray::detail::sorting_network<1>::size(), 0u);
+    EXPECT_EQ(detray::detail::sorting_network<2>::size(), 1u);
+    EXPECT_EQ(detray::detail::sorting_network<4>::size(), 5u);
+    EXPECT_EQ(detray::detail::sorting_network<8>::size(), 19u);
+    EXPECT_EQ(detray::detail::sorting_network<16>::size(), 63u);
+}
@@ -0,0 +1,207 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/utils/type_usage.hpp"
+
+#include "detray/core/detail/pruned_metadata.hpp"
+#include "detray/core/detector.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace detray;
+
+namespace {
+
+/// Toy metadata without material maps, as generated by
+/// @c write_reduced_metadata for the toy detector with homogeneous material
+template <concepts::algebra algebra_t>
+struct toy_slab_metadata : public toy_metadata<algebra_t> {
+
+    using base_type = toy_metadata<algebra_t>;
+
+    enum class mask_ids : std::uint_least8_t {
+        e_rectangle2 = 0u,
+        e_trapezoid2 = 1u,
+        e_portal_cylinder2 = 2u,
+        e_portal_ring2 = 3u,
+    };
+
+    template <template <typename...> class vector_t = dvector>
+    using mask_store = detail::pruned_store_t<
+        typename base_type::template mask_store<vector_t>, mask_ids, 0u, 1u,
+        2u, 3u>;
+
+    enum class material_ids : std::uint_least8_t {
+        e_slab = 0u,
+        e_none = 1u,
+    };
+
+    template <typename container_t = host_container_types>
+    using material_store = detail::pruned_store_t<
+        typename base_type::template material_store<container_t>,
+        material_ids, 3u>;
+
+    using mask_link =
+        detail::relink_t<typename base_type::mask_link, mask_ids>;
+    using material_link =
+        detail::relink_t<typename base_type::material_link, material_ids>;
+    using surface_type =
+        surface_descriptor<mask_link, material_link,
+                           typename base_type::transform_link,
+                           typename base_type::nav_link>;
+
+    enum class accel_ids : std::uint_least8_t {
+        e_brute_force = 0u,
+        e_disc_grid = 1u,
+        e_cylinder2_grid = 2u,
+        e_default = e_brute_force,
+    };
+
+    using object_link_type =
+        dmulti_index<dtyped_index<accel_ids, dindex>,
+                     base_type::geo_objects::e_size>;
+
+    template <typename container_t = host_container_types>
+    using accelerator_store = detail::pruned_store_t<
+        detail::rebind_surface_t<
+            typename base_type::template accelerator_store<container_t>,
+            typename base_type::surface_type, surface_type>,
+        accel_ids, 0u, 1u, 2u>;
+};
+
+}  // namespace
+
+// Test the enumerator names
+GTEST_TEST(detray_utils, enum_name) {
+
+    using mask_ids = test::toy_metadata::mask_ids;
+
+    EXPECT_EQ(types::get_enum_name<mask_ids::e_rectangle2>(), "e_rectangle2");
+    // Aliased enumerators: The first declared name is found
+    EXPECT_EQ(types::get_enum_name<mask_ids::e_cylinder2>(),
+              "e_portal_cylinder2");
+    // Not a named enumerator
+    EXPECT_EQ(types::get_enum_name<static_cast<mask_ids>(7)>(), "");
+}
+
+// Test the pruning of the metadata types
+GTEST_TEST(detray_utils, pruned_metadata) {
+
+    using metadata_t = toy_slab_metadata<test::algebra>;
+    using base_t = test::toy_metadata;
+
+    static_assert(metadata_t::mask_store<>::n_collections() == 4u);
+    static_assert(metadata_t::material_store<>::n_collections() == 1u);
+    static_assert(metadata_t::accelerator_store<>::n_collections() == 3u);
+
+    // The masks are unchanged, only the IDs are replaced
+    static_assert(
+        std::is_same_v<metadata_t::mask_store<>::get_type<
+                           metadata_t::mask_ids::e_portal_ring2>,
+                       base_t::mask_store<>::get_type<
+                           base_t::mask_ids::e_portal_ring2>>);
+    static_assert(
+        std::is_same_v<metadata_t::material_store<>::get_type<
+                           metadata_t::material_ids::e_slab>,
+                       base_t::material_store<>::get_type<
+                           base_t::material_ids::e_slab>>);
+
+    // Rebinding to the same surface type does not change the accelerators
+    static_assert(
+        std::is_same_v<detail::rebind_surface_t<base_t::accelerator_store<>,
+                                                base_t::surface_type,
+                                                base_t::surface_type>,
+                       base_t::accelerator_store<>>);
+
+    // A detector can be built from the reduced metadata
+    vecmem::host_memory_resource host_mr;
+    detector<metadata_t> det(host_mr);
+
+    EXPECT_TRUE(det.material_store().all_empty());
+
+    using brute_force_t = std::remove_cvref_t<
+        decltype(det.accelerator_store()
+                     .template get<metadata_t::accel_ids::e_brute_force>())>;
+    static_assert(
+        std::is_same_v<brute_force_t,
+                       brute_force_collection<metadata_t::surface_type>>);
+}
+
+// Test the type usage of the toy detector
+GTEST_TEST(detray_utils, type_usage) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config<test::scalar> toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [toy_det, names] =
+        build_toy_detector<test::algebra>(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cvref_t<decltype(toy_det)>;
+
+    const type_usage_report report = get_type_usage(toy_det);
+    std::cout << report << std::endl;
+
+    // One record per collection in the multi stores
+    const std::size_t n_records{
+        detector_t::mask_container::n_collections() +
+        detector_t::material_container::n_collections() +
+        detector_t::accelerator_container::n_collections()};
+    ASSERT_EQ(report.records.size(), n_records);
+
+    // Every surface links to a mask
+    std::size_t n_mask_links{0u};
+    for (const auto& rec : report.get_records("masks")) {
+        EXPECT_TRUE(rec.is_used());
+        EXPECT_FALSE(rec.id_name.empty());
+        n_mask_links += rec.n_links;
+    }
+    EXPECT_EQ(n_mask_links, toy_det.surfaces().size());
+
+    // Only the material slabs are used
+    for (const auto& rec : report.get_records("material")) {
+        EXPECT_EQ(rec.is_used(), rec.id_name == "e_slab") << rec.id_name;
+    }
+    ASSERT_EQ(report.unused().size(), 3u);
+
+    // All accelerators are used
+    for (const auto& rec : report.get_records("accelerators")) {
+        EXPECT_GT(rec.n_links, 0u) << rec.id_name;
+    }
+
+    // Generate the reduced metadata
+    std::stringstream header;
+    write_reduced_metadata(header, report, "toy_metadata",
+                           "toy_slab_metadata");
+    const std::string code{header.str()};
+    std::cout << code << std::endl;
+
+    EXPECT_NE(code.find("struct toy_slab_metadata : public "
+                        "toy_metadata<algebra_t>"),
+              std::string::npos);
+    EXPECT_NE(code.find("e_slab = 0u,\n        e_none = 1u,"),
+              std::string::npos);
+    EXPECT_NE(code.find("material_ids, 3u>;"), std::string::npos);
+    EXPECT_NE(code.find("mask_ids, 0u, 1u, 2u, 3u>;"), std::string::npos);
+    EXPECT_NE(code.find("e_default = e_brute_force,"), std::string::npos);
+    EXPECT_NE(code.find("accel_ids, 0u, 1u, 2u>;"), std::string::npos);
+}
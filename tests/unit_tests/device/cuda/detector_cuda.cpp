@@ -8,6 +8,9 @@
 // Detray test include(s)
 #include "detector_cuda_kernel.hpp"
 #include "detray/core/detail/alignment.hpp"
+#include "detray/core/detail/packed_buffer.hpp"
+#include "detray/core/detail/view_staging.hpp"
+#include "detray/core/device_detector_handle.hpp"
 #include "detray/definitions/algebra.hpp"
 #include "detray/test/common/assert.hpp"
 #include "detray/test/utils/detectors/build_toy_detector.hpp"
@@ -24,6 +27,7 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
 #include <limits>
 
 using namespace detray;
@@ -101,6 +105,144 @@ TEST(detector_cuda, detector) {
     }
 }
 
+TEST(detector_cuda, detector_shared_memory_staging) {
+    // memory resource
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    // create toy geometry
+    auto [toy_det, names] = build_toy_detector<test::algebra>(mng_mr);
+
+    auto ctx0 = typename detector_host_t::geometry_context();
+
+    // host objects
+    auto& volumes_host = toy_det.volumes();
+    auto& surfaces_host = toy_det.surfaces();
+    auto& transforms_host = toy_det.transform_store();
+    auto& masks_host = toy_det.mask_store();
+    auto& discs_host = masks_host.get<disc_id>();
+    auto& cylinders_host = masks_host.get<cylinder_id>();
+    auto& rectangles_host = masks_host.get<rectangle_id>();
+
+    // copied outpus from device side
+    vecmem::vector<det_volume_t> volumes_device(volumes_host.size(), &mng_mr);
+    vecmem::vector<det_surface_t> surfaces_device(surfaces_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<transform_t> transforms_device(transforms_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<rectangle_t> rectangles_device(rectangles_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<disc_t> discs_device(discs_host.size(), &mng_mr);
+    vecmem::vector<cylinder_t> cylinders_device(cylinders_host.size(), &mng_mr);
+
+    auto toy_det_data = detray::get_data(toy_det);
+
+    // The toy detector does not fit entirely: Only part of the geometry is
+    // staged, the rest is read from global memory
+    const std::size_t n_shared_bytes{
+        std::min(detail::staging_size(toy_det_data), std::size_t{32768u})};
+    ASSERT_GT(n_shared_bytes, 0u);
+
+    detector_staging_test(toy_det_data, n_shared_bytes,
+                          vecmem::get_data(volumes_device),
+                          vecmem::get_data(surfaces_device),
+                          vecmem::get_data(transforms_device),
+                          vecmem::get_data(rectangles_device),
+                          vecmem::get_data(discs_device),
+                          vecmem::get_data(cylinders_device));
+
+    for (unsigned int i = 0u; i < volumes_host.size(); i++) {
+        EXPECT_EQ(volumes_host[i] == volumes_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < surfaces_host.size(); i++) {
+        EXPECT_EQ(surfaces_device[i] == surfaces_host[i], true);
+    }
+
+    for (unsigned int i = 0u; i < transforms_host.size(ctx0); i++) {
+        EXPECT_EQ(transforms_host.at(i, ctx0) == transforms_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < rectangles_host.size(); i++) {
+        EXPECT_EQ(rectangles_host[i] == rectangles_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < discs_host.size(); i++) {
+        EXPECT_EQ(discs_host[i] == discs_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < cylinders_host.size(); i++) {
+        EXPECT_EQ(cylinders_host[i] == cylinders_device[i], true);
+    }
+}
+
+TEST(detector_cuda, detector_packed_buffer) {
+    // memory resources
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    vecmem::cuda::copy cuda_cpy;
+
+    // create toy geometry in host memory
+    auto [det_host, names_host] = build_toy_detector<test::algebra>(host_mr);
+
+    auto ctx0 = typename detector_host_t::geometry_context();
+
+    // one allocation and one copy for the entire detector
+    auto det_buff_packed =
+        detray::get_packed_buffer(det_host, dev_mr, cuda_cpy);
+    auto det_view_packed = detray::get_data(det_buff_packed);
+
+    auto& volumes_host = det_host.volumes();
+    auto& surfaces_host = det_host.surfaces();
+    auto& transforms_host = det_host.transform_store();
+    auto& masks_host = det_host.mask_store();
+    auto& discs_host = masks_host.get<disc_id>();
+    auto& cylinders_host = masks_host.get<cylinder_id>();
+    auto& rectangles_host = masks_host.get<rectangle_id>();
+
+    vecmem::vector<det_volume_t> volumes_device(volumes_host.size(), &mng_mr);
+    vecmem::vector<det_surface_t> surfaces_device(surfaces_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<transform_t> transforms_device(transforms_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<rectangle_t> rectangles_device(rectangles_host.size(),
+                                                  &mng_mr);
+    vecmem::vector<disc_t> discs_device(discs_host.size(), &mng_mr);
+    vecmem::vector<cylinder_t> cylinders_device(cylinders_host.size(), &mng_mr);
+
+    detector_test(det_view_packed, vecmem::get_data(volumes_device),
+                  vecmem::get_data(surfaces_device),
+                  vecmem::get_data(transforms_device),
+                  vecmem::get_data(rectangles_device),
+                  vecmem::get_data(discs_device),
+                  vecmem::get_data(cylinders_device));
+
+    for (unsigned int i = 0u; i < volumes_host.size(); i++) {
+        EXPECT_EQ(volumes_host[i] == volumes_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < surfaces_host.size(); i++) {
+        EXPECT_EQ(surfaces_device[i] == surfaces_host[i], true);
+    }
+
+    for (unsigned int i = 0u; i < transforms_host.size(ctx0); i++) {
+        EXPECT_EQ(transforms_host.at(i, ctx0) == transforms_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < rectangles_host.size(); i++) {
+        EXPECT_EQ(rectangles_host[i] == rectangles_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < discs_host.size(); i++) {
+        EXPECT_EQ(discs_host[i] == discs_device[i], true);
+    }
+
+    for (unsigned int i = 0u; i < cylinders_host.size(); i++) {
+        EXPECT_EQ(cylinders_host[i] == cylinders_device[i], true);
+    }
+}
+
 TEST(detector_cuda, detector_alignment) {
     // a few typedefs
     using test_algebra = test::algebra;
@@ -180,3 +322,71 @@ TEST(detector_cuda, detector_alignment) {
         EXPECT_POINT3_NEAR(translation_diff, shift, 1e-4);
     }
 }
+
+TEST(detector_cuda, detector_handle_alignment) {
+    // a few typedefs
+    using test_algebra = test::algebra;
+    using scalar = dscalar<test_algebra>;
+    using point3 = dpoint3D<test_algebra>;
+
+    // memory resources
+    vecmem::host_memory_resource host_mr;
+    vecmem::cuda::device_memory_resource dev_mr;
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    // helper object for performing memory copies to CUDA devices
+    vecmem::cuda::copy cuda_cpy;
+
+    // create toy geometry in host memory
+    auto [det_host, names_host] = build_toy_detector<test_algebra>(host_mr);
+
+    // upload the detector once
+    device_detector_handle<detector_host_t> handle{det_host, dev_mr, cuda_cpy};
+
+    // shift all transforms by the same translation
+    typename detector_host_t::transform_container tf_store_aligned_host;
+
+    point3 shift{.1f * unit<scalar>::mm, .2f * unit<scalar>::mm,
+                 .3f * unit<scalar>::mm};
+
+    tf_store_aligned_host.reserve(
+        det_host.transform_store().size(),
+        typename decltype(det_host)::transform_container::context_type{});
+
+    for (const auto& tf : det_host.transform_store()) {
+        point3 shifted = tf.translation() + shift;
+        tf_store_aligned_host.push_back(
+            transform_t{shifted, tf.x(), tf.y(), tf.z()});
+    }
+
+    // only the transforms are copied for the aligned handle
+    auto aligned_handle = handle.with_transforms(tf_store_aligned_host);
+    EXPECT_EQ(handle.use_count(), 2);
+
+    vecmem::vector<transform_t> surfacexf_device_static(
+        det_host.surfaces().size(), &mng_mr);
+    vecmem::vector<transform_t> surfacexf_device_aligned(
+        det_host.surfaces().size(), &mng_mr);
+    auto surfacexf_data_static = vecmem::get_data(surfacexf_device_static);
+    auto surfacexf_data_aligned = vecmem::get_data(surfacexf_device_aligned);
+
+    detector_alignment_test(handle.view(), aligned_handle.view(),
+                            surfacexf_data_static, surfacexf_data_aligned);
+
+    for (unsigned int i = 0u; i < surfacexf_device_static.size(); i++) {
+        auto translation_diff = surfacexf_device_aligned[i].translation() -
+                                surfacexf_device_static[i].translation();
+        EXPECT_POINT3_NEAR(translation_diff, shift, 1e-4);
+    }
+
+    // move the aligned transforms back to their nominal positions in place
+    aligned_handle.update_transforms(det_host.transform_store());
+
+    detector_alignment_test(handle.view(), aligned_handle.view(),
+                            surfacexf_data_static, surfacexf_data_aligned);
+
+    for (unsigned int i = 0u; i < surfacexf_device_static.size(); i++) {
+        EXPECT_POINT3_NEAR(surfacexf_device_aligned[i].translation(),
+                           surfacexf_device_static[i].translation(), 1e-6);
+    }
+}
@@ -5,6 +5,7 @@
  * Mozilla Public License Version 2.0
  */
 
+#include "detray/core/detail/view_staging.hpp"
 #include "detray/definitions/detail/cuda_definitions.hpp"
 #include "detray/geometry/tracking_surface.hpp"
 
@@ -13,9 +14,9 @@
 
 namespace detray {
 
-// cuda kernel to copy sub-detector objects
-__global__ void detector_test_kernel(
-    typename detector_host_t::view_type det_data,
+// copy sub-detector objects
+__device__ void copy_detector(
+    const detector_device_t& det_device,
     vecmem::data::vector_view<det_volume_t> volumes_data,
     vecmem::data::vector_view<det_surface_t> surfaces_data,
     vecmem::data::vector_view<transform_t> transforms_data,
@@ -23,9 +24,6 @@ __global__ void detector_test_kernel(
     vecmem::data::vector_view<disc_t> discs_data,
     vecmem::data::vector_view<cylinder_t> cylinders_data) {
 
-    // convert toy detector_data into detector w/ device vectors
-    detector_device_t det_device(det_data);
-
     // convert subdetector data objects into objects w/ device vectors
     vecmem::device_vector<det_volume_t> volumes_device(volumes_data);
     vecmem::device_vector<det_surface_t> surfaces_device(surfaces_data);
@@ -71,6 +69,24 @@ __global__ void detector_test_kernel(
         cylinders_device[i] = cylinders[i];
     }
 
+}
+
+// cuda kernel to copy sub-detector objects
+__global__ void detector_test_kernel(
+    typename detector_host_t::view_type det_data,
+    vecmem::data::vector_view<det_volume_t> volumes_data,
+    vecmem::data::vector_view<det_surface_t> surfaces_data,
+    vecmem::data::vector_view<transform_t> transforms_data,
+    vecmem::data::vector_view<rectangle_t> rectangles_data,
+    vecmem::data::vector_view<disc_t> discs_data,
+    vecmem::data::vector_view<cylinder_t> cylinders_data) {
+
+    // convert toy detector_data into detector w/ device vectors
+    detector_device_t det_device(det_data);
+
+    copy_detector(det_device, volumes_data, surfaces_data, transforms_data,
+                  rectangles_data, discs_data, cylinders_data);
+
     // print output test for surface finder
     /*auto& accel_device = det_device.accelerator_store();
     for (unsigned int i_s = 0u; i_s < accel_device.size(); i_s++) {
@@ -108,6 +124,57 @@ void detector_test(typename detector_host_t::view_type det_data,
     DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 }
 
+// cuda kernel to copy sub-detector objects from a detector, of which the
+// geometry was staged into shared memory
+__global__ void detector_staging_test_kernel(
+    typename detector_host_t::view_type det_data, std::size_t n_shared_bytes,
+    vecmem::data::vector_view<det_volume_t> volumes_data,
+    vecmem::data::vector_view<det_surface_t> surfaces_data,
+    vecmem::data::vector_view<transform_t> transforms_data,
+    vecmem::data::vector_view<rectangle_t> rectangles_data,
+    vecmem::data::vector_view<disc_t> discs_data,
+    vecmem::data::vector_view<cylinder_t> cylinders_data) {
+
+    extern __shared__ uint4 shared_geometry[];
+
+    // All threads of the block stage a share of the geometry
+    detail::staging_area area{shared_geometry, n_shared_bytes};
+    const auto staged_data = detail::stage_detector_view(
+        det_data, area, detail::strided_copy{threadIdx.x, blockDim.x});
+    __syncthreads();
+
+    detector_device_t det_device(staged_data);
+
+    if (threadIdx.x == 0u) {
+        copy_detector(det_device, volumes_data, surfaces_data,
+                      transforms_data, rectangles_data, discs_data,
+                      cylinders_data);
+    }
+}
+
+/// implementation of the staging test function for detector
+void detector_staging_test(
+    typename detector_host_t::view_type det_data, std::size_t n_shared_bytes,
+    vecmem::data::vector_view<det_volume_t> volumes_data,
+    vecmem::data::vector_view<det_surface_t> surfaces_data,
+    vecmem::data::vector_view<transform_t> transforms_data,
+    vecmem::data::vector_view<rectangle_t> rectangles_data,
+    vecmem::data::vector_view<disc_t> discs_data,
+    vecmem::data::vector_view<cylinder_t> cylinders_data) {
+
+    constexpr int block_dim = 1u;
+    constexpr int thread_dim = 128u;
+
+    // run the test kernel
+    detector_staging_test_kernel<<<block_dim, thread_dim, n_shared_bytes>>>(
+        det_data, n_shared_bytes, volumes_data, surfaces_data, transforms_data,
+        rectangles_data, discs_data, cylinders_data);
+
+    // cuda error check
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+}
+
 // cuda kernel to extract surface transforms from two detector views - static
 // and misaligned - and to copy them into vectors
 __global__ void detector_alignment_test_kernel(
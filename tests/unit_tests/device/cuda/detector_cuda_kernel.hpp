@@ -44,6 +44,17 @@ void detector_test(typename detector_host_t::view_type det_data,
                    vecmem::data::vector_view<disc_t> discs_data,
                    vecmem::data::vector_view<cylinder_t> cylinders_data);
 
+/// declaration of a test function for detector, of which the geometry is
+/// staged into @param n_shared_bytes of shared memory
+void detector_staging_test(
+    typename detector_host_t::view_type det_data, std::size_t n_shared_bytes,
+    vecmem::data::vector_view<det_volume_t> volumes_data,
+    vecmem::data::vector_view<det_surface_t> surfaces_data,
+    vecmem::data::vector_view<transform_t> transforms_data,
+    vecmem::data::vector_view<rectangle_t> rectangles_data,
+    vecmem::data::vector_view<disc_t> discs_data,
+    vecmem::data::vector_view<cylinder_t> cylinders_data);
+
 /// declaration of an alignment test function for detector
 void detector_alignment_test(
     typename detector_host_t::view_type det_data_static,
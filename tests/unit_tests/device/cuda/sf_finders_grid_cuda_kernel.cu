@@ -286,7 +286,8 @@ __global__ void grid_collection_test_kernel(
     if (gid < device_coll[blockIdx.x].nbins()) {
         for (const auto [i, bin_entry] :
              detray::views::enumerate(device_coll[blockIdx.x].bin(gid))) {
-            result_bins[gid + device_coll.offsets()[blockIdx.x]][i] = bin_entry;
+            const dindex offset{device_coll.headers()[blockIdx.x].bin_offset};
+            result_bins[gid + offset][i] = bin_entry;
         }
     }
 }
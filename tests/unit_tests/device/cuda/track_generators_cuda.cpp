@@ -0,0 +1,87 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+
+// Detray test include(s)
+#include "track_generators_cuda_kernel.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/cuda/managed_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+namespace {
+
+/// Compare the tracks generated on device @param device_tracks to the tracks
+/// of the host generator @param host_generator
+template <typename generator_t>
+void check_tracks(generator_t& host_generator,
+                  const vecmem::vector<track_t>& device_tracks) {
+
+    // Loose tolerance, since the device math functions may differ
+    constexpr scalar tol{1e-5f};
+
+    std::size_t n_tracks{0u};
+    for (const auto track : host_generator) {
+        ASSERT_LT(n_tracks, device_tracks.size());
+        const track_t& device_track = device_tracks[n_tracks];
+
+        EXPECT_NEAR(vector::norm(device_track.pos() - track.pos()), 0.f, tol)
+            << n_tracks;
+        EXPECT_NEAR(vector::norm(device_track.dir() - track.dir()), 0.f, tol)
+            << n_tracks;
+        EXPECT_NEAR(device_track.qop(), track.qop(), tol) << n_tracks;
+        ++n_tracks;
+    }
+    EXPECT_EQ(n_tracks, device_tracks.size());
+}
+
+}  // anonymous namespace
+
+/// Generate tracks in uniform angle space directly on device
+TEST(track_generators_cuda, uniform_track_generator) {
+
+    // Helper object for performing memory copies (to CUDA devices)
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    uniform_gen_t::configuration cfg{};
+    cfg.phi_steps(50u).theta_steps(50u).randomize_charge(true);
+    cfg.p_T(10.f * unit<scalar>::GeV);
+
+    vecmem::vector<track_t> tracks(cfg.n_tracks(), &mng_mr);
+
+    uniform_tracks_test(cfg, vecmem::get_data(tracks));
+
+    uniform_gen_t host_generator{cfg};
+    check_tracks(host_generator, tracks);
+}
+
+/// Generate randomly distributed tracks directly on device
+TEST(track_generators_cuda, random_track_generator) {
+
+    // Helper object for performing memory copies (to CUDA devices)
+    vecmem::cuda::managed_memory_resource mng_mr;
+
+    random_gen_t::configuration cfg{};
+    cfg.n_tracks(10000u).seed(42u).randomize_charge(true);
+    cfg.mom_range(1.f * unit<scalar>::GeV, 2.f * unit<scalar>::GeV);
+    cfg.origin_stddev(0.1f * unit<scalar>::mm, 0.f * unit<scalar>::mm,
+                      0.2f * unit<scalar>::mm);
+
+    vecmem::vector<track_t> tracks(cfg.n_tracks(), &mng_mr);
+
+    random_tracks_test(cfg, vecmem::get_data(tracks));
+
+    random_gen_t host_generator{cfg};
+    check_tracks(host_generator, tracks);
+}
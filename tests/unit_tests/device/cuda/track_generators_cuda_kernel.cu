@@ -0,0 +1,63 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/cuda_definitions.hpp"
+
+// Detray test include(s)
+#include "track_generators_cuda_kernel.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+
+namespace detray {
+
+/// Create every track from the generator configuration in place
+template <typename generator_t>
+__global__ void track_generator_kernel(
+    const typename generator_t::configuration cfg,
+    vecmem::data::vector_view<track_t> tracks_data) {
+
+    vecmem::device_vector<track_t> tracks(tracks_data);
+
+    const unsigned int gid{threadIdx.x + blockIdx.x * blockDim.x};
+    if (gid >= tracks.size()) {
+        return;
+    }
+
+    tracks[gid] = generator_t::generate_track(cfg, gid);
+}
+
+/// Launch the track generation for the configuration @param cfg
+template <typename generator_t>
+void launch_track_generation(const typename generator_t::configuration& cfg,
+                             vecmem::data::vector_view<track_t> tracks_data) {
+
+    constexpr int thread_dim{256};
+    const int block_dim{
+        static_cast<int>((tracks_data.size() + thread_dim - 1) / thread_dim)};
+
+    // run the kernel
+    track_generator_kernel<generator_t>
+        <<<block_dim, thread_dim>>>(cfg, tracks_data);
+
+    // cuda error check
+    DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
+    DETRAY_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
+}
+
+void uniform_tracks_test(const uniform_gen_t::configuration& cfg,
+                         vecmem::data::vector_view<track_t> tracks_data) {
+    launch_track_generation<uniform_gen_t>(cfg, tracks_data);
+}
+
+void random_tracks_test(const random_gen_t::configuration& cfg,
+                        vecmem::data::vector_view<track_t> tracks_data) {
+    launch_track_generation<random_gen_t>(cfg, tracks_data);
+}
+
+}  // namespace detray
@@ -0,0 +1,42 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/tracks/free_track_parameters.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+
+namespace detray {
+
+using test_algebra = test::algebra;
+using scalar = dscalar<test_algebra>;
+using track_t = free_track_parameters<test_algebra>;
+
+using counter_gen_t = detail::counter_random_numbers<scalar>;
+
+using uniform_gen_t = uniform_track_generator<track_t, counter_gen_t>;
+using random_gen_t = random_track_generator<track_t, counter_gen_t>;
+
+/// Generate the tracks of the uniform track generator config @param cfg on
+/// device and write them to @param tracks_data
+void uniform_tracks_test(const uniform_gen_t::configuration& cfg,
+                         vecmem::data::vector_view<track_t> tracks_data);
+
+/// Generate the tracks of the random track generator config @param cfg on
+/// device and write them to @param tracks_data
+void random_tracks_test(const random_gen_t::configuration& cfg,
+                        vecmem::data::vector_view<track_t> tracks_data);
+
+}  // namespace detray
@@ -0,0 +1,66 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Detray IO include(s)
+#include "detray/io/covfie/mapped_bfield.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+using namespace detray;
+
+/// This tests the memory mapped field against the deserialized covfie field
+GTEST_TEST(io, covfie_mapped_bfield) {
+
+    const std::string file_name{!std::getenv("DETRAY_BFIELD_FILE")
+                                    ? ""
+                                    : std::getenv("DETRAY_BFIELD_FILE")};
+
+    // Deserialized field
+    const auto inhom_bfield = bfield::create_inhom_field<float>();
+    const auto field_view = bfield::inhom_field_t<float>::view_t{inhom_bfield};
+
+    // Memory mapped field
+    io::mapped_bfield mapped_field = io::map_bfield(file_name);
+    ASSERT_GT(mapped_field.size(), 0u);
+
+    // The view remains valid when the owner is moved
+    const io::mapped_bfield moved_field{std::move(mapped_field)};
+    const auto mapped_view = moved_field.view();
+
+    constexpr float tol{1e-5f * unit<float>::T};
+    constexpr float step{0.25f * unit<float>::m};
+
+    // Compare inside the central part of the field map
+    for (float x = -1.f * unit<float>::m; x <= 1.f * unit<float>::m;
+         x += step) {
+        for (float y = -1.f * unit<float>::m; y <= 1.f * unit<float>::m;
+             y += step) {
+            for (float z = -2.f * unit<float>::m; z <= 2.f * unit<float>::m;
+                 z += step) {
+                const auto b = field_view.at(x, y, z);
+                const auto b_mapped = mapped_view.at(x, y, z);
+
+                EXPECT_NEAR(b[0], b_mapped[0], tol);
+                EXPECT_NEAR(b[1], b_mapped[1], tol);
+                EXPECT_NEAR(b[2], b_mapped[2], tol);
+            }
+        }
+    }
+
+    // Not a covfie file
+    EXPECT_THROW(io::map_bfield(""), std::invalid_argument);
+}
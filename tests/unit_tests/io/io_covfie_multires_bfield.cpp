@@ -0,0 +1,102 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Detray IO include(s)
+#include "detray/io/covfie/read_bfield.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+
+using namespace detray;
+
+namespace {
+
+/// Test field with a steep gradient in z around the end of a "solenoid"
+struct solenoid_end_field {
+    darray<float, 3> at(const float x, const float y, const float z) const {
+        constexpr float B{2.f * unit<float>::T};
+        constexpr float z_end{1.f * unit<float>::m};
+        constexpr float width{5.f * unit<float>::cm};
+
+        const float b_z{B / (1.f + std::exp((std::abs(z) - z_end) / width))};
+        return {1e-3f * B * x / unit<float>::m, 1e-3f * B * y / unit<float>::m,
+                b_z};
+    }
+};
+
+}  // namespace
+
+/// This tests the refinement and lookup of the multi-resolution field map
+GTEST_TEST(io, covfie_multires_bfield) {
+
+    constexpr float m{unit<float>::m};
+    const bfield::field_grid3D<float> grid{
+        {-1.f * m, -1.f * m, -2.f * m}, {1.f * m, 1.f * m, 2.f * m},
+        {11u, 11u, 21u}};
+
+    constexpr float tol{1e-2f * unit<float>::T};
+
+    const solenoid_end_field ref_field{};
+    const bfield::multires_field_t<float> field{ref_field, grid, 8u, tol};
+    ASSERT_EQ(field.n_cells(), 10u * 10u * 20u);
+
+    // Only the cells at the solenoid ends are refined
+    EXPECT_GT(field.n_refined(), 0u);
+    EXPECT_LT(field.n_refined(), field.n_cells() / 2u);
+
+    const auto view = field.view();
+
+    // The field is accurate everywhere, also where it changes quickly
+    constexpr float step{0.07f * m};
+    for (float x = -0.9f * m; x <= 0.9f * m; x += 3.f * step) {
+        for (float y = -0.9f * m; y <= 0.9f * m; y += 3.f * step) {
+            for (float z = -1.9f * m; z <= 1.9f * m; z += step) {
+                const auto b = ref_field.at(x, y, z);
+                const auto b_mr = view.at(x, y, z);
+
+                EXPECT_NEAR(b[0], b_mr[0], 2.f * tol);
+                EXPECT_NEAR(b[1], b_mr[1], 2.f * tol);
+                EXPECT_NEAR(b[2], b_mr[2], 2.f * tol);
+            }
+        }
+    }
+
+    // Write the map to file and read it back
+    const auto file_name{std::filesystem::temp_directory_path() /
+                         "detray_multires_bfield.cvf"};
+    {
+        std::ofstream out{file_name, std::ios::out | std::ios::binary};
+        field.dump(out);
+    }
+    const auto read_field =
+        io::read_bfield<bfield::multires_field_t<float>>(file_name.string());
+    std::filesystem::remove(file_name);
+
+    ASSERT_EQ(read_field.n_refined(), field.n_refined());
+    ASSERT_EQ(read_field.size(), field.size());
+    const auto read_view = read_field.view();
+    const auto b = view.at(0.1f * m, -0.2f * m, 1.02f * m);
+    const auto b_read = read_view.at(0.1f * m, -0.2f * m, 1.02f * m);
+    EXPECT_FLOAT_EQ(b[0], b_read[0]);
+    EXPECT_FLOAT_EQ(b[1], b_read[1]);
+    EXPECT_FLOAT_EQ(b[2], b_read[2]);
+
+    // No refinement
+    EXPECT_THROW(bfield::multires_field_t<float>(ref_field, grid, 1u, tol),
+                 std::invalid_argument);
+}
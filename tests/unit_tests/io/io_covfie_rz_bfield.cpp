@@ -0,0 +1,113 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Detray IO include(s)
+#include "detray/io/covfie/read_bfield.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <sstream>
+#include <stdexcept>
+
+using namespace detray;
+
+namespace {
+
+/// Phi-symmetric test field, which is linear in r and z
+struct linear_rz_field {
+    darray<float, 3> at(const float x, const float y, const float z) const {
+        constexpr float grad{0.5f * unit<float>::T / unit<float>::m};
+        return {grad * x, grad * y, 2.f * unit<float>::T - grad * z};
+    }
+};
+
+}  // namespace
+
+/// This tests the lookup and rotation of the phi-symmetric field map
+GTEST_TEST(io, covfie_rz_bfield) {
+
+    const bfield::rz_axis<float> r_axis{0.f, 1.f * unit<float>::m, 11u};
+    const bfield::rz_axis<float> z_axis{-2.f * unit<float>::m,
+                                        2.f * unit<float>::m, 41u};
+
+    const linear_rz_field ref_field{};
+    const bfield::rz_field_t<float> rz_field{ref_field, r_axis, z_axis};
+    ASSERT_EQ(rz_field.n_points(), 451u);
+    ASSERT_EQ(rz_field.size(), 2u * 451u * sizeof(float));
+
+    const auto rz_view = rz_field.view();
+
+    constexpr float tol{1e-5f * unit<float>::T};
+    constexpr float step{0.13f * unit<float>::m};
+
+    // Linear field: The bilinear interpolation is exact at every phi
+    for (float x = -0.7f * unit<float>::m; x <= 0.7f * unit<float>::m;
+         x += step) {
+        for (float y = -0.7f * unit<float>::m; y <= 0.7f * unit<float>::m;
+             y += step) {
+            for (float z = -1.9f * unit<float>::m; z <= 1.9f * unit<float>::m;
+                 z += step) {
+                const auto b = ref_field.at(x, y, z);
+                const auto b_rz = rz_view.at(x, y, z);
+
+                EXPECT_NEAR(b[0], b_rz[0], tol);
+                EXPECT_NEAR(b[1], b_rz[1], tol);
+                EXPECT_NEAR(b[2], b_rz[2], tol);
+            }
+        }
+    }
+
+    // No radial component on the z-axis
+    const auto b_axis = rz_view.at(0.f, 0.f, 1.f * unit<float>::m);
+    EXPECT_FLOAT_EQ(b_axis[0], 0.f);
+    EXPECT_FLOAT_EQ(b_axis[1], 0.f);
+    EXPECT_NEAR(b_axis[2], ref_field.at(0.f, 0.f, 1.f * unit<float>::m)[2],
+                tol);
+
+    // Clamped to the boundary of the map
+    const auto b_out = rz_view.at(0.f, 0.f, 5.f * unit<float>::m);
+    EXPECT_NEAR(b_out[2], ref_field.at(0.f, 0.f, 2.f * unit<float>::m)[2],
+                tol);
+
+    // Write the map to file and read it back
+    const auto file_name{std::filesystem::temp_directory_path() /
+                         "detray_rz_bfield.cvf"};
+    {
+        std::ofstream out{file_name, std::ios::out | std::ios::binary};
+        rz_field.dump(out);
+    }
+    const auto read_field =
+        io::read_bfield<bfield::rz_field_t<float>>(file_name.string());
+    std::filesystem::remove(file_name);
+
+    ASSERT_EQ(read_field.n_points(), rz_field.n_points());
+    const auto read_view = read_field.view();
+    const auto b = rz_view.at(0.3f, -0.2f, 0.5f);
+    const auto b_read = read_view.at(0.3f, -0.2f, 0.5f);
+    EXPECT_FLOAT_EQ(b[0], b_read[0]);
+    EXPECT_FLOAT_EQ(b[1], b_read[1]);
+    EXPECT_FLOAT_EQ(b[2], b_read[2]);
+
+    // Not an r-z field map
+    std::stringstream not_rz{"not an r-z field map"};
+    EXPECT_THROW(bfield::rz_field_t<float>{not_rz}, std::invalid_argument);
+
+    // Too few grid points to interpolate
+    EXPECT_THROW(bfield::rz_field_t<float>(
+                     bfield::rz_axis<float>{0.f, 1.f, 1u}, z_axis),
+                 std::invalid_argument);
+}
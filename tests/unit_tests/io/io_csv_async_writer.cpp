@@ -0,0 +1,129 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/csv/async_writer.hpp"
+#include "detray/io/csv/columnar.hpp"
+#include "detray/io/csv/dfe.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Test record
+struct test_record {
+
+    unsigned int producer = 0u;
+    std::uint64_t index = 0ul;
+    double value = 0.;
+
+    DFE_NAMEDTUPLE(test_record, producer, index, value);
+};
+
+/// Record with a different column layout
+struct other_record {
+
+    unsigned int producer = 0u;
+    float value = 0.f;
+
+    DFE_NAMEDTUPLE(other_record, producer, value);
+};
+
+constexpr unsigned int n_producers{4u};
+constexpr std::uint64_t n_records{10007ul};
+
+/// Fill the @param writer from several threads
+void fill(detray::io::csv::async_writer<test_record> &writer) {
+
+    std::vector<std::thread> producers;
+    for (unsigned int p = 0u; p < n_producers; ++p) {
+        producers.emplace_back([&writer, p]() {
+            auto buffer = writer.make_buffer();
+            for (std::uint64_t i = 0ul; i < n_records; ++i) {
+                buffer.append({p, i, 0.5 * static_cast<double>(i)});
+            }
+        });
+    }
+    for (auto &t : producers) {
+        t.join();
+    }
+    writer.flush();
+}
+
+/// Check that the @param records of every producer are complete and in order
+void check(const std::vector<test_record> &records) {
+
+    ASSERT_EQ(records.size(), n_producers * n_records);
+
+    std::vector<std::uint64_t> next(n_producers, 0ul);
+    for (const auto &rec : records) {
+        ASSERT_LT(rec.producer, n_producers);
+        EXPECT_EQ(rec.index, next[rec.producer]);
+        EXPECT_EQ(rec.value, 0.5 * static_cast<double>(rec.index));
+        ++next[rec.producer];
+    }
+}
+
+}  // anonymous namespace
+
+/// Write csv records from several producer threads
+GTEST_TEST(io, csv_async_writer) {
+
+    const std::string file_name{"async_writer_test.csv"};
+    {
+        detray::io::csv::async_writer<test_record> writer(
+            file_name, detray::io::csv::output_format::e_csv, 1000u, 4u);
+        fill(writer);
+    }
+
+    detray::io::csv::dfe::NamedTupleCsvReader<test_record> reader(file_name);
+
+    std::vector<test_record> records;
+    test_record rec{};
+    while (reader.read(rec)) {
+        records.push_back(rec);
+    }
+
+    check(records);
+}
+
+/// Write binary columnar records from several producer threads
+GTEST_TEST(io, columnar_async_writer) {
+
+    const std::string file_name{"async_writer_test.bin"};
+    {
+        detray::io::csv::async_writer<test_record> writer(
+            file_name, detray::io::csv::output_format::e_binary, 999u, 2u);
+        fill(writer);
+    }
+
+    check(detray::io::csv::read_columnar<test_record>(file_name));
+}
+
+/// Reading a columnar file with a different record type fails
+GTEST_TEST(io, columnar_type_mismatch) {
+
+    const std::string file_name{"columnar_mismatch_test.bin"};
+    {
+        detray::io::csv::columnar_writer<test_record> writer(file_name);
+        writer.append({test_record{1u, 2ul, 3.}});
+    }
+
+    EXPECT_EQ(detray::io::csv::read_columnar<test_record>(file_name).size(),
+              1u);
+    EXPECT_THROW(detray::io::csv::read_columnar<other_record>(file_name),
+                 std::runtime_error);
+}
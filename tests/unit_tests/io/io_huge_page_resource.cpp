@@ -0,0 +1,82 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray IO include(s)
+#include "detray/io/utils/huge_page_resource.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+
+using namespace detray;
+
+/// Large allocations are mapped, small ones go to the upstream resource
+GTEST_TEST(io, huge_page_resource) {
+
+    io::huge_page_resource::config cfg{};
+    cfg.min_size = 64u * 1024u;
+
+    for (const auto mode : {io::huge_page_resource::mode::e_transparent,
+                            io::huge_page_resource::mode::e_explicit}) {
+        cfg.page_mode = mode;
+        io::huge_page_resource mr{cfg};
+
+        {
+            vecmem::vector<std::uint32_t> small(16u, 1u, &mr);
+            EXPECT_EQ(mr.mapped_bytes(), 0u);
+
+            // Rounded up to full huge pages
+            vecmem::vector<std::uint32_t> large(1024u * 1024u, 2u, &mr);
+            EXPECT_EQ(mr.mapped_bytes(), 2u * cfg.page_size);
+
+            for (std::size_t i = 0u; i < large.size(); ++i) {
+                large[i] = static_cast<std::uint32_t>(i);
+            }
+            EXPECT_EQ(large.back(), large.size() - 1u);
+            EXPECT_EQ(small.back(), 1u);
+        }
+
+        // Everything was unmapped
+        EXPECT_EQ(mr.mapped_bytes(), 0u);
+    }
+}
+
+/// Build a detector into huge pages
+GTEST_TEST(io, huge_page_resource_detector) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [ref_det, ref_names] =
+        build_toy_detector<test::algebra>(host_mr);
+
+    io::huge_page_resource::config cfg{};
+    cfg.min_size = 4u * 1024u;
+    io::huge_page_resource mr{cfg};
+
+    {
+        const auto [det, names] = build_toy_detector<test::algebra>(mr);
+
+        EXPECT_GT(mr.mapped_bytes(), 0u);
+        EXPECT_EQ(det.volumes().size(), ref_det.volumes().size());
+        EXPECT_EQ(det.surfaces().size(), ref_det.surfaces().size());
+        EXPECT_EQ(det.transform_store().size(),
+                  ref_det.transform_store().size());
+
+        for (std::size_t i = 0u; i < det.surfaces().size(); ++i) {
+            EXPECT_EQ(det.surfaces()[i], ref_det.surfaces()[i]);
+        }
+    }
+}
@@ -27,6 +27,8 @@
 
 // System include(s)
 #include <array>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 
 GTEST_TEST(svgtools, detector) {
@@ -62,3 +64,101 @@ GTEST_TEST(svgtools, detector) {
     // Write the svg of toy detector in z-r view
     detray::svgtools::write_svg("test_svgtools_detector_zr", {zr_axis, svg_zr});
 }
+
+GTEST_TEST(svgtools, detector_culling) {
+
+    actsvg::style::stroke stroke_black = actsvg::style::stroke();
+    // z-r axis.
+    auto zr_axis = actsvg::draw::x_y_axes("axes", {0, 250}, {0, 250},
+                                          stroke_black, "z", "r");
+
+    // Creating the views.
+    const actsvg::views::x_y xy;
+    const actsvg::views::z_r zr;
+
+    // Creating the detector and geomentry context.
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] =
+        detray::build_toy_detector<detray::test::algebra>(host_mr);
+
+    const typename decltype(det)::geometry_context gctx{};
+    const auto& style = detray::svgtools::styling::tableau_colorblind::style;
+
+    // Count the volumes and non-portal surfaces of a proto detector
+    auto count = [](const auto& p_detector) {
+        std::size_t n_surfaces{0u};
+        for (const auto& p_volume : p_detector._volumes) {
+            n_surfaces += p_volume._v_surfaces.size();
+        }
+        return std::array{p_detector._volumes.size(), n_surfaces};
+    };
+
+    const auto full = count(detray::svgtools::conversion::detector(
+        gctx, det, zr, style._detector_style));
+
+    // Only the quarter of the zr-view with positive z
+    const detray::svgtools::view_window window{{0.f, 250.f}, {0.f, 250.f}};
+    const auto culled = count(detray::svgtools::conversion::detector(
+        gctx, det, zr, style._detector_style, false, false, false, window));
+
+    EXPECT_LT(culled[0], full[0]);
+    EXPECT_LT(culled[1], full[1]);
+
+    // Coarse level of detail: Only the volume envelopes, on several threads
+    const auto envelopes = count(detray::svgtools::conversion::detector(
+        gctx, det, zr, style._detector_style, false, false, false, {}, 0u,
+        4u));
+
+    EXPECT_EQ(envelopes[0], full[0]);
+    EXPECT_LT(envelopes[1], full[1]);
+
+    // The same via the illustrator
+    detray::svgtools::illustrator il{det, names};
+    il.show_info(false);
+    il.window(zr, window);
+    il.max_sensitives(500u);
+    il.n_threads(0u);
+
+    const auto svg_zr = il.draw_detector(zr);
+    detray::svgtools::write_svg("test_svgtools_detector_culled_zr",
+                                {zr_axis, svg_zr});
+
+    // The window of the zr-view does not affect the xy-view
+    const auto [vol_svg_xy, sheets] = il.draw_volumes(std::array{7u, 8u}, xy);
+    EXPECT_EQ(sheets.size(), 2u);
+}
+
+GTEST_TEST(svgtools, detector_streaming) {
+
+    actsvg::style::stroke stroke_black = actsvg::style::stroke();
+    // z-r axis.
+    auto zr_axis = actsvg::draw::x_y_axes("axes", {-250, 250}, {-250, 250},
+                                          stroke_black, "z", "r");
+
+    // Creating the views.
+    const actsvg::views::z_r zr;
+
+    // Creating the detector and geomentry context.
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] =
+        detray::build_toy_detector<detray::test::algebra>(host_mr);
+
+    // Creating the svg generator for the detector.
+    detray::svgtools::illustrator il{det, names};
+    il.show_info(false);
+    il.n_threads(2u);
+
+    // Write the volumes into the file one after the other
+    detray::svgtools::svg_stream_writer writer{
+        "test_svgtools_detector_streamed_zr"};
+    writer.write(zr_axis);
+
+    const std::size_t n_volumes{il.stream_detector(writer, zr)};
+    EXPECT_EQ(n_volumes, det.volumes().size());
+
+    // Axes, volumes and eta lines
+    EXPECT_EQ(writer.n_objects(), n_volumes + 2u);
+
+    writer.close();
+    EXPECT_THROW(writer.write(zr_axis), std::runtime_error);
+}
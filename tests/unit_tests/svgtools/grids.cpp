@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2023-2024 CERN for the benefit of the ACTS project
+ * (c) 2023-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -22,6 +22,11 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <numeric>
+#include <string>
+#include <vector>
+
 GTEST_TEST(svgtools, grids) {
 
     // This test creates the visualization using the illustrator class.
@@ -56,3 +61,45 @@ GTEST_TEST(svgtools, grids) {
         detray::svgtools::write_svg("test_svgtools_grid_" + sheet._id, sheet);
     }
 }
+
+GTEST_TEST(svgtools, grid_heatmaps) {
+
+    // This test draws a value per grid bin on top of the surface grids, e.g.
+    // the counts of a navigation heatmap (@see grid_heatmap_inspector)
+
+    // Creating the detector.
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] =
+        detray::build_toy_detector<detray::test::algebra>(host_mr);
+
+    // Creating the views: Barrel grids are displayed in z-phi, endcap grids
+    // in x-y.
+    const actsvg::views::x_y xy;
+    const actsvg::views::z_phi zphi;
+
+    // Creating the svg generator for the detector.
+    detray::svgtools::illustrator il{det, names};
+
+    // Use the global bin index as value to show the bin order
+    std::vector<detray::dindex> values(1000u);
+    std::iota(values.begin(), values.end(), 0u);
+
+    std::size_t n_heatmaps{0u};
+    for (const auto& vol_desc : det.volumes()) {
+        const detray::dindex i{vol_desc.index()};
+        const std::string prefix{"volume_" + std::to_string(i)};
+        for (const auto& heatmap_svg :
+             {il.draw_grid_heatmap(prefix + "_xy", i, values, xy),
+              il.draw_grid_heatmap(prefix + "_zphi", i, values, zphi)}) {
+            if (heatmap_svg._sub_objects.empty()) {
+                continue;
+            }
+            detray::svgtools::write_svg(
+                "test_svgtools_heatmap_" + heatmap_svg._id, heatmap_svg);
+            ++n_heatmaps;
+        }
+    }
+
+    // The toy detector has barrel and endcap grids
+    EXPECT_GT(n_heatmaps, 0u);
+}
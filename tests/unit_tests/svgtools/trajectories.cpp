@@ -19,6 +19,7 @@
 #include "detray/test/utils/detectors/build_toy_detector.hpp"
 #include "detray/test/utils/types.hpp"
 #include "detray/test/validation/detector_scanner.hpp"
+#include "detray/test/validation/step_tracer.hpp"
 #include "detray/test/validation/svg_display.hpp"
 
 // Vecmem include(s)
@@ -33,6 +34,7 @@
 // System include(s)
 #include <array>
 #include <string>
+#include <vector>
 
 GTEST_TEST(svgtools, trajectories) {
 
@@ -110,4 +112,15 @@ GTEST_TEST(svgtools, trajectories) {
 
     detray::svgtools::write_svg("test_svgtools_helix",
                                 {svg_volumes, svg_helix, svg_helix_ir});
+
+    // Draw the steps of a track that were recorded during a propagation
+    // (e.g. on device), here taken from the helix
+    std::vector<detray::detail::step_point<test_algebra>> steps;
+    for (scalar s = 0.f; s < 500.f; s += 20.f) {
+        steps.push_back({helix.pos(s), helix.dir(s), s, helix.qop(), {}});
+    }
+    const auto svg_steps = il.draw_trajectory("steps", steps, view);
+
+    detray::svgtools::write_svg("test_svgtools_step_trace",
+                                {svg_volumes, svg_steps});
 }
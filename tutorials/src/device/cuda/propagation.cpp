@@ -24,14 +24,16 @@ int main() {
     // VecMem memory resource(s)
     vecmem::cuda::managed_memory_resource mng_mr;
 
-    // Create the host bfield
-    auto bfield =
-        detray::bfield::create_inhom_field<detray::tutorial::scalar>();
+    // Read the host bfield, while the toy geometry is being built
+    auto bfield_future =
+        detray::bfield::create_inhom_field_async<detray::tutorial::scalar>();
 
     // Create the toy geometry
     auto [det, names] =
         detray::build_toy_detector<detray::tutorial::algebra_t>(mng_mr);
 
+    auto bfield = bfield_future.get();
+
     // Create the vector of initial track parameters
     vecmem::vector<detray::free_track_parameters<detray::tutorial::algebra_t>>
         tracks(&mng_mr);